@@ -0,0 +1,11 @@
+#include "BMDAdvertisedDeviceCallback.h"
+#include <Arduino.h>
+#include <Camera/BMDCameraConnection.h>
+
+void BMDAdvertisedDeviceCallback::onResult(BLEAdvertisedDevice advertisedDevice)
+{
+    if(cameraConnection != nullptr && advertisedDevice.haveServiceUUID() && advertisedDevice.isAdvertisingService(Constants::UUID_BMD_BCS))
+    {
+        cameraConnection->cameraAdvertised(advertisedDevice.getAddress());
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef BMDADVERTISEDDEVICECALLBACK_H
+#define BMDADVERTISEDDEVICECALLBACK_H
+
+#include <BLEAdvertisedDevice.h>
+
+class BMDCameraConnection; // forward declaration, the connection holds one of these
+
+// This class is for advertisements seen while scanning, so we can connect to a camera we've bonded with as soon as it appears
+class BMDAdvertisedDeviceCallback : public BLEAdvertisedDeviceCallbacks
+{
+public:
+    BMDAdvertisedDeviceCallback(BMDCameraConnection *theCameraConnection) : cameraConnection(theCameraConnection) {}
+    virtual void onResult(BLEAdvertisedDevice advertisedDevice);
+
+private:
+    BMDCameraConnection* cameraConnection;
+};
+
+#endif
@@ -1,5 +1,6 @@
 #include "BMDBLEClientCallback.h"
 #include <Arduino.h>
+#include <Camera/BMDCameraConnection.h>
 
 void BMDBLEClientCallback::onConnect(BLEClient* pclient)
 {
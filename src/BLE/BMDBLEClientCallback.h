@@ -2,9 +2,8 @@
 #define BMDBLECLIENTCALLBACK_H
 
 #include <BLEClient.h>
-#include <Camera/BMDCameraConnection.h>
 
-class BMDCameraConnection; // forward declaration as both header files include each other.
+class BMDCameraConnection; // forward declaration, the connection holds one of these
 
 // This class is for notifications on the BLEClient object in terms of connects and disconnects
 class BMDBLEClientCallback : public BLEClientCallbacks
@@ -0,0 +1,91 @@
+#include "PassKeyRequest.h"
+
+portMUX_TYPE PassKeyRequest::lock = portMUX_INITIALIZER_UNLOCKED;
+esp_bd_addr_t PassKeyRequest::address = {};
+volatile bool PassKeyRequest::pending = false;
+volatile unsigned long PassKeyRequest::requestNumber = 0;
+unsigned long PassKeyRequest::requestTime = 0;
+unsigned long PassKeyRequest::timeAllowance = 15000;
+
+byte PassKeyRequest::digits[kDigits] = {};
+byte PassKeyRequest::digitCount = 0;
+
+void PassKeyRequest::requested(const esp_bd_addr_t inAddress)
+{
+    portENTER_CRITICAL(&lock);
+    memcpy(address, inAddress, sizeof(esp_bd_addr_t));
+    requestTime = millis();
+    digitCount = 0;
+    requestNumber++;
+    pending = true;
+    portEXIT_CRITICAL(&lock);
+}
+
+void PassKeyRequest::finished()
+{
+    pending = false;
+}
+
+bool PassKeyRequest::service()
+{
+    if(!pending)
+        return false;
+
+    if(getElapsed() >= timeAllowance)
+    {
+        DEBUG_VERBOSE("%lu seconds to enter pass key, time expired.", timeAllowance / 1000);
+        decline();
+    }
+
+    return pending;
+}
+
+void PassKeyRequest::addDigit(byte digit)
+{
+    if(!pending || digitCount >= kDigits)
+        return;
+
+    digits[digitCount++] = digit;
+
+    if(digitCount == kDigits)
+    {
+        uint32_t passKey = 0;
+        for(byte index = 0; index < kDigits; index++)
+            passKey = passKey * 10 + digits[index];
+
+        submit(passKey);
+    }
+}
+
+void PassKeyRequest::removeDigit()
+{
+    if(digitCount > 0)
+        digitCount--;
+}
+
+void PassKeyRequest::submit(uint32_t passKey)
+{
+    reply(true, passKey);
+}
+
+void PassKeyRequest::decline()
+{
+    reply(false, 0);
+}
+
+void PassKeyRequest::reply(bool accept, uint32_t passKey)
+{
+    esp_bd_addr_t replyAddress;
+
+    portENTER_CRITICAL(&lock);
+    bool wasPending = pending;
+    pending = false;
+    memcpy(replyAddress, address, sizeof(esp_bd_addr_t));
+    portEXIT_CRITICAL(&lock);
+
+    if(!wasPending)
+        return;
+
+    // Queued for the Bluetooth task, authentication completes (or fails) there
+    esp_ble_passkey_reply(replyAddress, accept, passKey);
+}
@@ -0,0 +1,63 @@
+#ifndef PASSKEYREQUEST_H
+#define PASSKEYREQUEST_H
+
+#include <Arduino.h>
+#include <esp_gap_ble_api.h>
+#include "Arduino_DebugUtils.h"
+
+// A pass key request from the camera, shared between the Bluetooth task and loop(). The Bluetooth task only records the request
+// (BMDCameraConnection's GAP handler) and carries on, the board's PassKeyEntry collects the digits from loop() and the key is sent
+// back with esp_ble_passkey_reply once the sixth is entered. Nothing waits inside the Bluetooth task, a request that isn't answered
+// within the entry's time allowance is declined.
+class PassKeyRequest
+{
+  public:
+    static const byte kDigits = 6;
+
+    // From the Bluetooth task
+    static void requested(const esp_bd_addr_t address);
+    static void finished();
+
+    // From loop()
+    static bool isPending() { return pending; }
+    static unsigned long getRequestNumber() { return requestNumber; } // Changes with each request, so entry screens know to start again
+    static bool service(); // Declines the request once its time is up, true while it's still pending
+
+    static void setTimeAllowance(unsigned long milliseconds) { timeAllowance = milliseconds; }
+    static unsigned long getTimeAllowance() { return timeAllowance; }
+    static unsigned long getElapsed() { return millis() - requestTime; }
+
+    // Digits entered so far, the request is answered when the last one is added
+    static byte getDigitCount() { return digitCount; }
+    static byte getDigit(byte index) { return index < digitCount ? digits[index] : 0; }
+    static void addDigit(byte digit);
+    static void removeDigit();
+
+    static void submit(uint32_t passKey);
+    static void decline();
+
+  private:
+    static void reply(bool accept, uint32_t passKey);
+
+    static portMUX_TYPE lock;
+    static esp_bd_addr_t address;
+    static volatile bool pending;
+    static volatile unsigned long requestNumber;
+    static unsigned long requestTime;
+    static unsigned long timeAllowance;
+
+    static byte digits[kDigits];
+    static byte digitCount;
+};
+
+// The board's way of entering a pass key (touch screen, buttons or serial), serviced from loop()
+class PassKeyEntry
+{
+  public:
+    virtual ~PassKeyEntry() {}
+
+    // Shows and handles the entry while a request is pending, true while it has the display and input
+    virtual bool service() = 0;
+};
+
+#endif
@@ -1,62 +1,43 @@
 #include "SerialSecurityHandler.h"
 
-// Take in the 
-SerialSecurityHandler::SerialSecurityHandler(BMDCameraConnection* bmdCameraConnectionPtr)
+SerialSecurityHandler::SerialSecurityHandler()
 {
-  _bmdCameraConnectionPtr = bmdCameraConnectionPtr;
+  // There's no countdown shown on serial, so allow a little longer
+  PassKeyRequest::setTimeAllowance(25000);
 }
 
 // code snippet from jeppo7745 https://www.instructables.com/id/Magic-Button-4k-the-20USD-BMPCC4k-Remote/
 // Found through BlueMagic32, thank you guys!
-uint32_t SerialSecurityHandler::onPassKeyRequest()
+bool SerialSecurityHandler::service()
 {
-    // Update the connection status to requesting PassKey
-    _bmdCameraConnectionPtr->status = BMDCameraConnection::NeedPassKey;
+    if(!PassKeyRequest::service())
+        return false;
 
-    Serial.println("---> PLEASE ENTER 6 DIGIT PIN (end with ENTER) : ");
-    int pinCode = 0;
-    char ch;
-    do
+    if(_promptedRequest != PassKeyRequest::getRequestNumber())
     {
-        while (!Serial.available())
-        {
-            vTaskDelay(1);
-        }
-        ch = Serial.read();
+        _promptedRequest = PassKeyRequest::getRequestNumber();
+        Serial.println("---> PLEASE ENTER 6 DIGIT PIN (end with ENTER) : ");
+    }
+
+    // Take what has arrived, the request is answered when the sixth digit comes in
+    while(Serial.available() && PassKeyRequest::isPending())
+    {
+        char ch = Serial.read();
         if (ch >= '0' && ch <= '9')
         {
-            pinCode = pinCode * 10 + (ch - '0');
+            PassKeyRequest::addDigit(ch - '0');
             Serial.print(ch);
         }
-    } while ((ch != '\n') && !(pinCode >= 100000 && pinCode < 999999)); // Go through if 6 numbers
-    return pinCode;
-}
-
-void SerialSecurityHandler::onPassKeyNotify(uint32_t pass_key)
-{
-    DEBUG_VERBOSE("onPassKeyNotify");
-    pass_key += 1;
-}
+        else if(ch == '\n' && PassKeyRequest::getDigitCount() > 0)
+        {
+            // Enter sends what has been typed so far
+            uint32_t pinCode = 0;
+            for(byte index = 0; index < PassKeyRequest::getDigitCount(); index++)
+                pinCode = pinCode * 10 + PassKeyRequest::getDigit(index);
 
-bool SerialSecurityHandler::onConfirmPIN(uint32_t pin)
-{
-    DEBUG_VERBOSE("onConfirmPIN");
-    return true;
-}
+            PassKeyRequest::submit(pinCode);
+        }
+    }
 
-bool SerialSecurityHandler::onSecurityRequest()
-{
-    DEBUG_VERBOSE("onSecurityRequest");
-    return true;
+    return PassKeyRequest::isPending();
 }
-
-void SerialSecurityHandler::onAuthenticationComplete(esp_ble_auth_cmpl_t auth_cmpl)
-{
-    DEBUG_VERBOSE("onAuthenticationComplete");
-    
-    // Update the connection status based on the outcome of the authentication
-    if(auth_cmpl.success)
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::Connected;
-    else
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::FailedPassKey;
-}
\ No newline at end of file
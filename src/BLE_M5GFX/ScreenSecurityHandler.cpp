@@ -1,26 +1,81 @@
 #include "ScreenSecurityHandler.h"
+#include "UI/DisplayPresenter.h"
+#include "ESP32/I2CScheduler.h"
 #include "Fonts/Lato_Regular11pt7b.h" // Standard font
 
 // Take in all the pointers we need access to to render the screen and handle touch
-ScreenSecurityHandler::ScreenSecurityHandler(BMDCameraConnection* bmdCameraConnectionPtr, lgfx::v1::ITouch* touchPtr, M5GFX* windowPtr, int screenWidth, int screenHeight)
+ScreenSecurityHandler::ScreenSecurityHandler(lgfx::v1::ITouch* touchPtr, M5GFX* windowPtr, int screenWidth, int screenHeight)
 {
-  _bmdCameraConnectionPtr = bmdCameraConnectionPtr;
   _touchPtr = touchPtr;
   _windowPtr = windowPtr;
   // _spritePassKeyPtr = spritePassKeyPtr;
   _screenWidth = screenWidth;
   _screenHeight = screenHeight;
+
+  // Allow 15 seconds to enter the pass key.
+  PassKeyRequest::setTimeAllowance(15000);
 }
 
-// Triggers when a Pass Key is required
-uint32_t ScreenSecurityHandler::onPassKeyRequest()
+// Called from loop(), shows the pass key screen while the camera is waiting for one and passes the taps on
+bool ScreenSecurityHandler::service()
 {
-    // Update the connection status to requesting PassKey
-    _bmdCameraConnectionPtr->status = BMDCameraConnection::NeedPassKey;
+    if(!PassKeyRequest::service())
+        return false;
+
+    unsigned long currentTime = millis();
+
+    if(_shownRequest != PassKeyRequest::getRequestNumber())
+    {
+        _shownRequest = PassKeyRequest::getRequestNumber();
+        _shownDigits = -1;
+        _lastTapTime = 0;
+
+        DrawKeypad();
+    }
+
+    // Use the left bar to show time left
+    unsigned long allowanceSeconds = PassKeyRequest::getTimeAllowance() / 1000;
+    int reduceBar = (PassKeyRequest::getElapsed() / 1000) * (_screenHeight / allowanceSeconds);
+    _windowPtr->fillRect(0, 0, 13, reduceBar, TFT_BLACK);
+
+    // Wait for Touches
+    lgfx::touch_point_t tp[3];
+    int nums = getTouchRaw(tp, 3);
+    if (nums) {
+        // We'll only process one touch (if they have more than one finger on screen only the first will count)
+        int pressedKey = KeyPressed(tp[0].x, tp[0].y);
+
+        if(pressedKey > -2 && (currentTime - _lastTapTime > 400)) // Ensure we don't count a tap as a double entry
+        {
+            if(pressedKey == -1)
+                PassKeyRequest::removeDigit(); // Backspace
+            else
+                PassKeyRequest::addDigit(pressedKey); // The sixth digit sends the pass key
+
+            _lastTapTime = currentTime;
+        }
+    }
+
+    // Show the pin code entered
+    if(_shownDigits != PassKeyRequest::getDigitCount())
+    {
+        _shownDigits = PassKeyRequest::getDigitCount();
+
+        _windowPtr->setTextColor(TFT_WHITE);
+        _windowPtr->fillRect(95, 0, 100, 21, TFT_BLACK);
+        for(int count = 0; count < _shownDigits; count++)
+        {
+            _windowPtr->drawString(String(PassKeyRequest::getDigit(count)), 95 + (count * 15), 7, &Lato_Regular11pt7b);
+        }
+    }
 
-    // Allow 15 seconds to enter the pass key.
-    unsigned long startTime = millis();
-    unsigned long currentTime = 0;
+    return PassKeyRequest::isPending();
+}
+
+void ScreenSecurityHandler::DrawKeypad()
+{
+    // Draws directly to the display, so let any frame still going out finish
+    DisplayPresenter::waitIdle();
 
     // Draw the screen
     _windowPtr->fillScreen(TFT_BLACK);
@@ -61,117 +116,6 @@ uint32_t ScreenSecurityHandler::onPassKeyRequest()
     _windowPtr->drawString("1", 50, 174, &Lato_Regular11pt7b);
     _windowPtr->drawString("2", 125, 174, &Lato_Regular11pt7b);
     _windowPtr->drawString("3", 200, 174, &Lato_Regular11pt7b);
-
-    bool pinComplete = false;
-    std::vector<int> pinCodeArray;
-
-    _windowPtr->setTextColor(TFT_WHITE);
-
-    unsigned long lastTapTime = 0; // Ensure we don't count a tap as a double entry
-
-    do
-    {  
-        // Allow up to 15 seconds to enter the pass key
-        currentTime = millis();
-
-        if(currentTime - startTime >= 15000)
-        {
-            // Took too long!
-            DEBUG_VERBOSE("15 seconds to enter pass key, time expired.");
-            pinComplete = true;
-            break;
-        }
-        else
-        {
-            // Use the left bar to show time left
-            int reduceBar = ((currentTime - startTime) / 1000) * (_screenHeight / 15);
-            _windowPtr->fillRect(0, 0, 13, reduceBar, TFT_BLACK);
-        }
-
-        // Show the pin code entered
-        _windowPtr->fillRect(95, 0, 100, 21, TFT_BLACK);
-        for(int count = 0; count < pinCodeArray.size(); count++)
-        {
-            _windowPtr->drawString(String(pinCodeArray[count]), 95 + (count * 15), 7, &Lato_Regular11pt7b);
-        }
-
-        // Wait for Touches
-        lgfx::touch_point_t tp[3];
-        int nums = getTouchRaw(tp, 3);
-        if (nums) {
-            for (int i = 0; i < nums; ++i)
-            {
-                int touchx = tp[i].x;
-                int touchy = tp[i].y;
-
-                int pressedKey = KeyPressed(touchx, touchy);
-
-                if(pressedKey > -2 && (currentTime - lastTapTime > 400))
-                {
-                    if(pressedKey == -1)
-                    {
-                        // Backspace
-                        pinCodeArray.pop_back();
-                    }
-                    else
-                    {
-                        pinCodeArray.push_back(pressedKey);
-                    }
-
-                    lastTapTime = currentTime;
-                }
-
-                break; // We'll only process one touch (if they have more than one finger on screen only the first will count)
-            }
-        }
-
-        if(pinCodeArray.size() == 6)
-            pinComplete = true;
-        }
-
-    while(!pinComplete); // && !(pinCode >= 100000 && pinCode < 999999));
-
-   // Convert the vector array of 6 numbers into a number
-    if(pinCodeArray.size() == 6)
-    {
-        int result = 0;
-        for (int i = 0; i < 6; i++) {
-            result = result * 10 + pinCodeArray[i];
-        }
-
-        return result; // Here's the pass key heading to authenticate.
-    }
-    else
-        return 0; // Didn't enter a 6 digit pass key in time.
-}
-
-void ScreenSecurityHandler::onPassKeyNotify(uint32_t pass_key)
-{
-    DEBUG_VERBOSE("onPassKeyNotify");
-    pass_key += 1;
-}
-
-bool ScreenSecurityHandler::onConfirmPIN(uint32_t pin)
-{
-    DEBUG_VERBOSE("onConfirmPIN");
-    return true;
-}
-
-bool ScreenSecurityHandler::onSecurityRequest()
-{
-    DEBUG_VERBOSE("onSecurityRequest");
-    return true;
-}
-
-void ScreenSecurityHandler::onAuthenticationComplete(esp_ble_auth_cmpl_t auth_cmpl)
-{
-    DEBUG_VERBOSE("ScreenSecurityHandler::OnAuthenticationComplete");
-
-    // Update the connection status based on the outcome of the authentication
-    if(auth_cmpl.success)
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::Connected;
-    else
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::FailedPassKey;
 }
 
 // Returns the key pressed
@@ -220,8 +164,14 @@ uint_fast8_t ScreenSecurityHandler::getTouchRaw(lgfx::v1::touch_point_t* tp, uin
 // bool need_transaction = (getStartCount() && _touchPtr->config().bus_shared);
 // if (need_transaction) { endTransaction(); }
 
+    // The I2C scheduler may be reading the bus
+    if(!I2CScheduler::lock())
+        return 0;
+
     count = _touchPtr->getTouchRaw(tp, count);
 
+    I2CScheduler::unlock();
+
 // if (need_transaction) { beginTransaction(); }
 
     return count;
@@ -1,36 +1,33 @@
 #ifndef PASSKEYSCREENM5BUTTONS_H
 #define PASSKEYSCREENM5BUTTONS_H
 
-#include <BLEDevice.h>
 #include <Arduino.h>
+#include <vector>
 #include "Arduino_DebugUtils.h"
-#include "Camera/BMDCameraConnection.h"
+#include "BLE/PassKeyRequest.h"
 #include <ESP32-Chimera-Core.h> // Instead of M5Stack.h, plays nicer
 
-class BMDCameraConnection;
-
-// This class handles the BLE security callbacks, primarily for getting the PassKey from the screen with touch screen
+// This class handles getting the PassKey from the screen with the M5Stack's buttons
 // The aim is that there would be a handler for a screen (this), serial, and one for a physically connected keypad (TBD)
 // Once a Bluetooth connection has been established between the device and camera another PassKey should not be required until either has forgotten each other.
-class ScreenSecurityHandlerM5Buttons : public BLESecurityCallbacks
+// It's a screen like the others, called from loop() while the camera is waiting for a pass key, so the Bluetooth task never waits on it.
+class ScreenSecurityHandlerM5Buttons : public PassKeyEntry
 {
   public:
-    ScreenSecurityHandlerM5Buttons(BMDCameraConnection* bmdCameraConnectionPtr, M5Display* displayPtr, int screenWidth, int screenHeight);
+    ScreenSecurityHandlerM5Buttons(M5Display* displayPtr, int screenWidth, int screenHeight);
 
-    uint32_t onPassKeyRequest();
-    void onPassKeyNotify(uint32_t pass_key);
-    bool onConfirmPIN(uint32_t pin);
-    bool onSecurityRequest();
-    void onAuthenticationComplete(esp_ble_auth_cmpl_t auth_cmpl);
+    bool service();
 
   private:
-    // uint_fast8_t getTouchRaw(lgfx::v1::touch_point_t* tp, uint_fast8_t count); // Replicating the touch function to get touches while on the security page
+    void DrawScreen();
 
-    BMDCameraConnection* _bmdCameraConnectionPtr;
     M5Display* _displayPtr;
     int _screenWidth;
     int _screenHeight;
     const int timeAllowance = 30; // 30 seconds
+
+    unsigned long _shownRequest = 0;
+    std::vector<int> _pinCodeArray;
 };
 
 #endif
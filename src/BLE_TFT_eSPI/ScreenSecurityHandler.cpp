@@ -1,26 +1,81 @@
 #include "ScreenSecurityHandler.h"
+#include "UI/DisplayPresenter.h"
 
 // Take in all the pointers we need access to to render the screen and handle touch
-ScreenSecurityHandler::ScreenSecurityHandler(BMDCameraConnection* bmdCameraConnectionPtr, TFT_eSprite* windowPtr, TFT_eSprite* spritePassKeyPtr, CST816S* touchPtr, int screenWidth, int screenHeight)
+ScreenSecurityHandler::ScreenSecurityHandler(TFT_eSprite* windowPtr, TFT_eSprite* spritePassKeyPtr, CST816S* touchPtr, int screenWidth, int screenHeight)
 {
-  _bmdCameraConnectionPtr = bmdCameraConnectionPtr;
   _windowPtr = windowPtr;
   _spritePassKeyPtr = spritePassKeyPtr;
   _touchPtr = touchPtr;
   _screenWidth = screenWidth;
   _screenHeight = screenHeight;
+
+  // Allow 15 seconds to enter the pass key.
+  PassKeyRequest::setTimeAllowance(15000);
 }
 
-// Triggers when a Pass Key is required
-uint32_t ScreenSecurityHandler::onPassKeyRequest()
+// Called from loop(), shows the pass key screen while the camera is waiting for one and passes the taps on
+bool ScreenSecurityHandler::service()
 {
-    // Update the connection status to requesting PassKey
-    _bmdCameraConnectionPtr->status = BMDCameraConnection::NeedPassKey;
+    if(!PassKeyRequest::service())
+        return false;
+
+    if(_shownRequest != PassKeyRequest::getRequestNumber())
+    {
+        _shownRequest = PassKeyRequest::getRequestNumber();
+
+        // Draws straight to the display, so let any frame still going out finish
+        DisplayPresenter::waitIdle();
+
+        DrawKeypad();
+    }
+
+    // Wait for Touches
+    if (_touchPtr->available()) {
+
+        if(_touchPtr->data.eventID == CST816S::TOUCHEVENT::UP) // Only on finger up.
+        {
+            int oriented_x = _screenWidth - _touchPtr->data.y;
+            int oriented_y = _touchPtr->data.x;
+
+            if(_touchPtr->data.gestureID == CST816S::GESTURE::NONE) // Only a tap gesture counts.
+            {
+                int pressedKey = KeyPressed(oriented_x, oriented_y);
+
+                if(pressedKey == -1)
+                    PassKeyRequest::removeDigit(); // Backspace
+                else if(pressedKey > -1)
+                    PassKeyRequest::addDigit(pressedKey); // The sixth digit sends the pass key
+            }
+        }
+    }
+
+    if(!PassKeyRequest::isPending())
+        return false;
+
+    // The keypad is kept in its own sprite, the time left and the pin code go on top of it
+    _spritePassKeyPtr->pushToSprite(_windowPtr, 0, 0);
 
-    // Allow 15 seconds to enter the pass key.
-    unsigned long startTime = millis();
-    unsigned long currentTime = 0;
+    // Use the left bar to show time left
+    unsigned long allowanceSeconds = PassKeyRequest::getTimeAllowance() / 1000;
+    int reduceBar = (PassKeyRequest::getElapsed() / 1000) * (_screenHeight / allowanceSeconds);
+    _windowPtr->fillRect(0, 0, 13, reduceBar, TFT_BLACK);
 
+    // Show the pin code entered
+    _windowPtr->setTextSize(2);
+    _windowPtr->setTextColor(TFT_WHITE);
+    for(int count = 0; count < PassKeyRequest::getDigitCount(); count++)
+    {
+        _windowPtr->drawString(String(PassKeyRequest::getDigit(count)), 95 + (count * 15), 7);
+    }
+
+    _windowPtr->pushSprite(0, 0);
+
+    return true;
+}
+
+void ScreenSecurityHandler::DrawKeypad()
+{
     // Draw the screen
     _spritePassKeyPtr->fillSprite(TFT_BLACK);
 
@@ -61,117 +116,6 @@ uint32_t ScreenSecurityHandler::onPassKeyRequest()
     _spritePassKeyPtr->drawString("1", 50, 134);
     _spritePassKeyPtr->drawString("2", 125, 134);
     _spritePassKeyPtr->drawString("3", 200, 134);
-
-    _spritePassKeyPtr->pushToSprite(_windowPtr, 0, 0);
-    _windowPtr->pushSprite(0, 0);
-
-    bool pinComplete = false;
-    std::vector<int> pinCodeArray;
-
-    _windowPtr->setTextSize(2);
-    _windowPtr->setTextColor(TFT_WHITE);
-
-    do
-    {  
-        // Allow up to 15 seconds to enter the pass key
-        currentTime = millis();
-
-        if(currentTime - startTime >= 15000)
-        {
-            // Took too long!
-            DEBUG_VERBOSE("15 seconds to enter pass key, time expired.");
-            pinComplete = true;
-            break;
-        }
-        else
-        {
-            // Use the left bar to show time left
-            int reduceBar = ((currentTime - startTime) / 1000) * (_screenHeight / 15);
-            _windowPtr->fillRect(0, 0, 13, reduceBar, TFT_BLACK);
-        }
-
-        // Show the pin code entered
-        _windowPtr->fillRect(95, 0, 100, 21, TFT_BLACK);
-        for(int count = 0; count < pinCodeArray.size(); count++)
-        {
-            _windowPtr->drawString(String(pinCodeArray[count]), 95 + (count * 15), 7);
-        }
-
-        _windowPtr->pushSprite(0, 0);
-
-        // Wait for Touches
-        if (_touchPtr->available()) {
-    
-            if(_touchPtr->data.eventID == CST816S::TOUCHEVENT::UP) // Only on finger up.
-            {
-                int oriented_x = _screenWidth - _touchPtr->data.y;
-                int oriented_y = _touchPtr->data.x;
-
-                if(_touchPtr->data.gestureID == CST816S::GESTURE::NONE) // Only a tap gesture counts.
-                {
-                    int pressedKey = KeyPressed(oriented_x, oriented_y);
-
-                    if(pressedKey > -2)
-                    {
-                        if(pressedKey == -1)
-                        {
-                            // Backspace
-                            pinCodeArray.pop_back();
-                        }
-                        else
-                        {
-                            pinCodeArray.push_back(pressedKey);
-                        }
-                    }
-                }
-            }
-        }
-
-        if(pinCodeArray.size() == 6)
-            pinComplete = true;
-        }
-
-    while(!pinComplete); // && !(pinCode >= 100000 && pinCode < 999999));
-
-   // Convert the vector array of 6 numbers into a number
-    if(pinCodeArray.size() == 6)
-    {
-        int result = 0;
-        for (int i = 0; i < 6; i++) {
-            result = result * 10 + pinCodeArray[i];
-        }
-
-        return result; // Here's the pass key heading to authenticate.
-    }
-    else
-        return 0; // Didn't enter a 6 digit pass key in time.
-}
-
-void ScreenSecurityHandler::onPassKeyNotify(uint32_t pass_key)
-{
-    DEBUG_VERBOSE("onPassKeyNotify");
-    pass_key += 1;
-}
-
-bool ScreenSecurityHandler::onConfirmPIN(uint32_t pin)
-{
-    DEBUG_VERBOSE("onConfirmPIN");
-    return true;
-}
-
-bool ScreenSecurityHandler::onSecurityRequest()
-{
-    DEBUG_VERBOSE("onSecurityRequest");
-    return true;
-}
-
-void ScreenSecurityHandler::onAuthenticationComplete(esp_ble_auth_cmpl_t auth_cmpl)
-{
-    // Update the connection status based on the outcome of the authentication
-    if(auth_cmpl.success)
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::Connected;
-    else
-        _bmdCameraConnectionPtr->status = BMDCameraConnection::FailedPassKey;
 }
 
 // Returns the key pressed
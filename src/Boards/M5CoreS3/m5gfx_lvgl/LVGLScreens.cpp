@@ -0,0 +1,803 @@
+#include "LVGLScreens.h"
+#include "Camera/PacketWriter.h"
+#include "Camera/CodecInfo.h"
+#include "Camera/CommandCoalescer.h"
+#include "Camera/MotionEngine.h"
+#include "Config/VideoConfig.h"
+#include "UI/ISOScreen.h"
+#include "UI/ResolutionScreen.h"
+#include "UI/MediaScreen.h"
+#include "BMDControlSystem.h"
+
+BMDCameraConnection* LVGLScreens::connection = nullptr;
+LVGLScreens::Screen LVGLScreens::current = LVGLScreens::Screen::Dashboard;
+
+lv_obj_t* LVGLScreens::values[kMaxValues] = {};
+lv_obj_t* LVGLScreens::options = nullptr;
+lv_obj_t* LVGLScreens::recordButton = nullptr;
+int LVGLScreens::checkedOption = -1;
+bool LVGLScreens::shutterIsAngle = true;
+
+float LVGLScreens::rackFocusA = 0.2f;
+float LVGLScreens::rackFocusB = 0.8f;
+unsigned long LVGLScreens::rackFocusMs = 3000;
+bool LVGLScreens::rackToB = false;
+
+unsigned long LVGLScreens::updates = 0;
+unsigned long LVGLScreens::widgetChanges = 0;
+
+// Button matrix maps, "\n" starts a new row. Option indexes don't count the row breaks.
+static char isoLabels[ISOScreen::kOptionCount][8];
+static const char* isoMap[ISOScreen::kOptionCount + 2];
+
+static const int kShutterAngles[] = { 1500, 6000, 9000, 12000, 15000, 18000, 27000, 36000 };
+static const char* shutterAngleMap[] = { "15", "60", "90", "120", "\n", "150", "180", "270", "360", "" };
+static const int kShutterSpeeds[] = { 30, 50, 60, 125, 200, 250, 500, 2000 };
+static const char* shutterSpeedMap[] = { "1/30", "1/50", "1/60", "1/125", "\n", "1/200", "1/250", "1/500", "1/2000", "" };
+
+// In the order of VideoConfig::kWhiteBalancePresets
+static const char* whiteBalancePresetMap[] = { "Bright", "Tungsten", "\n", "Fluoro", "Mixed", "Cloud", "" };
+static const byte kWhiteBalancePresetCount = 5;
+
+static const CodecInfo kCodecs[] =
+{
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ0),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ1),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ3),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ5),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW3_1),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW5_1),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW8_1),
+    CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW12_1),
+    CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ),
+    CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422),
+    CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT),
+    CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy)
+};
+static const char* codecMap[] = { "Q0", "Q1", "Q3", "Q5", "\n", "3:1", "5:1", "8:1", "12:1", "\n", "HQ", "422", "LT", "PXY", "" };
+
+// Bottom bar, as on the sprite screens
+static const LVGLScreens::Screen kNavScreens[] = { LVGLScreens::Screen::Dashboard, LVGLScreens::Screen::Recording, LVGLScreens::Screen::Codec };
+static const char* kNavLabels[] = { "DASH", "REC", "CODEC" };
+
+static const short kNavHeight = 36;
+static const short kContentTop = 32;
+
+// Focus moved for each pixel dragged along the lens screen's focus strip, as on the sprite screen (65435 is the lens' full range)
+static const int kFocusUnitsPerPixel = 100;
+
+void LVGLScreens::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+
+    for(byte index = 0; index < ISOScreen::kOptionCount; index++)
+    {
+        snprintf(isoLabels[index], sizeof(isoLabels[index]), "%d", ISOScreen::getOption(index));
+        isoMap[index + (index >= ISOScreen::kOptionCount / 2 ? 1 : 0)] = isoLabels[index];
+    }
+    isoMap[ISOScreen::kOptionCount / 2] = "\n";
+    isoMap[ISOScreen::kOptionCount + 1] = "";
+
+    show(Screen::Dashboard);
+
+    DEBUG_INFO("LVGLScreens: Started");
+}
+
+void LVGLScreens::show(Screen screen, bool forward)
+{
+    if(!isStarted())
+        return;
+
+    // The old screen is deleted by LVGL once it has slid out, along with these
+    for(byte index = 0; index < kMaxValues; index++)
+        values[index] = nullptr;
+    options = nullptr;
+    recordButton = nullptr;
+    checkedOption = -1;
+
+    bool first = lv_obj_get_child_cnt(lv_scr_act()) == 0;
+    current = screen;
+
+    lv_obj_t* newScreen;
+    switch(screen)
+    {
+        case Screen::Dashboard:
+            newScreen = createScreen(nullptr);
+            buildDashboard(newScreen);
+            break;
+        case Screen::Recording:
+            newScreen = createScreen("RECORD");
+            buildRecording(newScreen);
+            break;
+        case Screen::ISO:
+            newScreen = createScreen("ISO");
+            buildISO(newScreen);
+            break;
+        case Screen::Shutter:
+            newScreen = createScreen("SHUTTER");
+            buildShutter(newScreen);
+            break;
+        case Screen::WhiteBalanceTint:
+            newScreen = createScreen("WHITE BALANCE");
+            buildWhiteBalanceTint(newScreen);
+            break;
+        case Screen::Codec:
+            newScreen = createScreen("CODEC");
+            buildCodec(newScreen);
+            break;
+        case Screen::Format:
+            newScreen = createScreen("FORMAT");
+            buildFormat(newScreen);
+            break;
+        case Screen::Media:
+            newScreen = createScreen("MEDIA");
+            buildMedia(newScreen);
+            break;
+        default:
+            newScreen = createScreen("LENS");
+            buildLens(newScreen);
+            break;
+    }
+
+    lv_scr_load_anim(newScreen, first ? LV_SCR_LOAD_ANIM_NONE : (forward ? LV_SCR_LOAD_ANIM_MOVE_LEFT : LV_SCR_LOAD_ANIM_MOVE_RIGHT), first ? 0 : 200, 0, true);
+
+    if(connection->status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera())
+        update(BMDControlSystem::getInstance()->getCamera());
+}
+
+void LVGLScreens::update(const std::shared_ptr<BMDCamera>& camera)
+{
+    if(!isStarted() || camera == nullptr)
+        return;
+
+    updates++;
+
+    switch(current)
+    {
+        case Screen::Dashboard: updateDashboard(camera); break;
+        case Screen::Recording: updateRecording(camera); break;
+        case Screen::ISO: updateISO(camera); break;
+        case Screen::Shutter: updateShutter(camera); break;
+        case Screen::WhiteBalanceTint: updateWhiteBalanceTint(camera); break;
+        case Screen::Codec: updateCodec(camera); break;
+        case Screen::Format: updateFormat(camera); break;
+        case Screen::Media: updateMedia(camera); break;
+        case Screen::Lens: updateLens(camera); break;
+    }
+}
+
+void LVGLScreens::invalidateAll()
+{
+    if(isStarted())
+        lv_obj_invalidate(lv_scr_act());
+}
+
+void LVGLScreens::setRackFocus(float a, float b, unsigned long durationMs)
+{
+    rackFocusA = a;
+    rackFocusB = b;
+    rackFocusMs = durationMs;
+}
+
+void LVGLScreens::reportStats()
+{
+    DEBUG_INFO("LVGLScreens: %lu updates changed %lu widgets, %lu pixels sent", updates, widgetChanges, static_cast<unsigned long>(m5gfx_lvgl_flushed_pixels()));
+}
+
+lv_obj_t* LVGLScreens::createScreen(const char* title)
+{
+    lv_obj_t* screen = lv_obj_create(nullptr);
+    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+    lv_obj_clear_flag(screen, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(screen, onGesture, LV_EVENT_GESTURE, nullptr);
+
+    if(title != nullptr)
+    {
+        lv_obj_t* label = lv_label_create(screen);
+        lv_label_set_text(label, title);
+        lv_obj_set_style_text_color(label, lv_color_hex(0xA0A0A0), 0);
+        lv_obj_set_pos(label, 10, 8);
+    }
+
+    // Bottom bar
+    short navWidth = LV_HOR_RES / 3;
+    for(byte index = 0; index < 3; index++)
+    {
+        lv_obj_t* button = createButton(screen, index * navWidth + 2, LV_VER_RES - kNavHeight, navWidth - 4, kNavHeight - 2, kNavLabels[index], onShowScreen, static_cast<intptr_t>(kNavScreens[index]));
+        if(kNavScreens[index] == current)
+            lv_obj_add_state(button, LV_STATE_CHECKED);
+    }
+
+    return screen;
+}
+
+lv_obj_t* LVGLScreens::createTile(lv_obj_t* parent, short x, short y, short w, short h, const char* caption, Screen target, byte valueIndex)
+{
+    lv_obj_t* tile = lv_btn_create(parent);
+    lv_obj_set_pos(tile, x, y);
+    lv_obj_set_size(tile, w, h);
+    lv_obj_set_style_bg_color(tile, lv_color_hex(0x404040), 0);
+    lv_obj_set_style_border_color(tile, lv_palette_main(LV_PALETTE_RED), LV_STATE_USER_1);
+    lv_obj_set_style_border_width(tile, 3, LV_STATE_USER_1);
+    lv_obj_add_event_cb(tile, onShowScreen, LV_EVENT_CLICKED, reinterpret_cast<void*>(static_cast<intptr_t>(target)));
+
+    lv_obj_t* value = lv_label_create(tile);
+    lv_label_set_text(value, "");
+    lv_obj_set_style_text_font(value, &lv_font_montserrat_20, 0);
+    lv_obj_align(value, LV_ALIGN_CENTER, 0, -6);
+    values[valueIndex] = value;
+
+    lv_obj_t* label = lv_label_create(tile);
+    lv_label_set_text(label, caption);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xC0C0C0), 0);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, 4);
+
+    return tile;
+}
+
+lv_obj_t* LVGLScreens::createValue(lv_obj_t* parent, short x, short y, const char* caption, byte valueIndex)
+{
+    lv_obj_t* label = lv_label_create(parent);
+    lv_label_set_text(label, caption);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xA0A0A0), 0);
+    lv_obj_set_pos(label, x, y);
+
+    lv_obj_t* value = lv_label_create(parent);
+    lv_label_set_text(value, "");
+    lv_obj_set_style_text_font(value, &lv_font_montserrat_28, 0);
+    lv_obj_set_pos(value, x, y + 18);
+    values[valueIndex] = value;
+
+    return value;
+}
+
+lv_obj_t* LVGLScreens::createOptions(lv_obj_t* parent, const char** map, lv_event_cb_t onSelected)
+{
+    lv_obj_t* matrix = lv_btnmatrix_create(parent);
+    lv_btnmatrix_set_map(matrix, map);
+    lv_obj_set_pos(matrix, 0, kContentTop + 36);
+    lv_obj_set_size(matrix, LV_HOR_RES, LV_VER_RES - kContentTop - 36 - kNavHeight - 2);
+    lv_obj_set_style_bg_opa(matrix, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(matrix, 0, 0);
+    lv_obj_set_style_pad_all(matrix, 4, 0);
+    lv_obj_add_event_cb(matrix, onSelected, LV_EVENT_VALUE_CHANGED, nullptr);
+
+    options = matrix;
+    return matrix;
+}
+
+lv_obj_t* LVGLScreens::createButton(lv_obj_t* parent, short x, short y, short w, short h, const char* text, lv_event_cb_t onClicked, intptr_t userData)
+{
+    lv_obj_t* button = lv_btn_create(parent);
+    lv_obj_set_pos(button, x, y);
+    lv_obj_set_size(button, w, h);
+    lv_obj_add_event_cb(button, onClicked, LV_EVENT_CLICKED, reinterpret_cast<void*>(userData));
+
+    lv_obj_t* label = lv_label_create(button);
+    lv_label_set_text(label, text);
+    lv_obj_center(label);
+
+    return button;
+}
+
+void LVGLScreens::setText(byte valueIndex, const std::string& text)
+{
+    lv_obj_t* label = values[valueIndex];
+    if(label == nullptr || strcmp(lv_label_get_text(label), text.c_str()) == 0)
+        return;
+
+    lv_label_set_text(label, text.c_str());
+    widgetChanges++;
+}
+
+void LVGLScreens::setState(lv_obj_t* object, lv_state_t state, bool on)
+{
+    if(object == nullptr || lv_obj_has_state(object, state) == on)
+        return;
+
+    if(on)
+        lv_obj_add_state(object, state);
+    else
+        lv_obj_clear_state(object, state);
+
+    widgetChanges++;
+}
+
+void LVGLScreens::setHidden(lv_obj_t* object, bool hidden)
+{
+    if(object == nullptr || lv_obj_has_flag(object, LV_OBJ_FLAG_HIDDEN) == hidden)
+        return;
+
+    if(hidden)
+        lv_obj_add_flag(object, LV_OBJ_FLAG_HIDDEN);
+    else
+        lv_obj_clear_flag(object, LV_OBJ_FLAG_HIDDEN);
+
+    widgetChanges++;
+}
+
+void LVGLScreens::setChecked(int index)
+{
+    if(options == nullptr || index == checkedOption)
+        return;
+
+    // The camera decides what's selected, so options aren't checkable by a tap and only follow it
+    lv_btnmatrix_clear_btn_ctrl_all(options, LV_BTNMATRIX_CTRL_CHECKED);
+    if(index >= 0)
+        lv_btnmatrix_set_btn_ctrl(options, index, LV_BTNMATRIX_CTRL_CHECKED);
+
+    checkedOption = index;
+    widgetChanges++;
+}
+
+//
+// Screens
+//
+
+void LVGLScreens::buildDashboard(lv_obj_t* screen)
+{
+    createTile(screen, 5, 5, 100, 64, "ISO", Screen::ISO, 0);
+    createTile(screen, 110, 5, 100, 64, "SHUTTER", Screen::Shutter, 1);
+    createTile(screen, 215, 5, 100, 64, "WB / TINT", Screen::WhiteBalanceTint, 2);
+    createTile(screen, 5, 74, 155, 52, "CODEC", Screen::Codec, 3);
+    createTile(screen, 165, 74, 150, 52, "FPS", Screen::Format, 4);
+    createTile(screen, 5, 131, 155, 52, "RESOLUTION", Screen::Format, 5);
+    lv_obj_t* media = createTile(screen, 165, 131, 150, 52, "MEDIA", Screen::Media, 6);
+    lv_obj_add_event_cb(media, onShowScreen, LV_EVENT_LONG_PRESSED, reinterpret_cast<void*>(static_cast<intptr_t>(Screen::Recording)));
+}
+
+void LVGLScreens::updateDashboard(const std::shared_ptr<BMDCamera>& camera)
+{
+    setText(0, camera->hasSensorGainISO() ? std::to_string(camera->getSensorGainISO()) : "");
+
+    std::string shutter;
+    if(camera->hasShutterAngle())
+    {
+        if(camera->shutterValueIsAngle)
+        {
+            int angle = camera->getShutterAngle();
+            char buffer[12];
+            snprintf(buffer, sizeof(buffer), angle % 100 == 0 ? "%.0f" : "%.1f", angle / 100.0f);
+            shutter = buffer;
+        }
+        else
+            shutter = "1/" + std::to_string(camera->getShutterSpeed());
+    }
+    setText(1, shutter);
+
+    setText(2, camera->hasWhiteBalance() ? std::to_string(camera->getWhiteBalance()) + "K " + std::to_string(camera->hasTint() ? camera->getTint() : 0) : "");
+    setText(3, camera->hasCodec() ? camera->getCodec().to_string() : "");
+    setText(4, camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "");
+    setText(5, camera->hasRecordingFormat() ? camera->getRecordingFormat().frameDimensionsShort_string() : "");
+
+    bool hasMedia = camera->getMediaSlots().size() != 0 && camera->hasActiveMediaSlot();
+    setText(6, hasMedia ? camera->getActiveMediaSlot().remainingRecordTimeString : "");
+
+    // Red edge while recording or when the media has an error
+    if(values[6] != nullptr)
+        setState(lv_obj_get_parent(values[6]), LV_STATE_USER_1, camera->isRecording || camera->hasRecordError());
+}
+
+void LVGLScreens::buildRecording(lv_obj_t* screen)
+{
+    createValue(screen, 15, kContentTop + 20, "TIMECODE", 0);
+    createValue(screen, 15, kContentTop + 90, "REMAINING TIME", 1);
+
+    recordButton = lv_btn_create(screen);
+    lv_obj_set_size(recordButton, 110, 110);
+    lv_obj_align(recordButton, LV_ALIGN_TOP_RIGHT, -15, kContentTop + 15);
+    lv_obj_set_style_radius(recordButton, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(recordButton, lv_color_hex(0x404040), 0);
+    lv_obj_set_style_bg_color(recordButton, lv_palette_main(LV_PALETTE_RED), LV_STATE_CHECKED);
+    lv_obj_add_event_cb(recordButton, onRecord, LV_EVENT_CLICKED, nullptr);
+
+    lv_obj_t* label = lv_label_create(recordButton);
+    lv_label_set_text(label, "REC");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
+    lv_obj_center(label);
+}
+
+void LVGLScreens::updateRecording(const std::shared_ptr<BMDCamera>& camera)
+{
+    setText(0, camera->getTimecodeString());
+
+    bool hasMedia = camera->getMediaSlots().size() != 0 && camera->hasActiveMediaSlot();
+    if(hasMedia)
+    {
+        BMDCamera::MediaSlot slot = camera->getActiveMediaSlot();
+        setText(1, slot.StatusIsError() ? slot.GetStatusString() : slot.GetMediumString() + " " + slot.remainingRecordTimeString);
+    }
+    else
+        setText(1, "");
+
+    setState(recordButton, LV_STATE_CHECKED, camera->isRecording);
+}
+
+void LVGLScreens::buildISO(lv_obj_t* screen)
+{
+    createValue(screen, 180, 0, "", 0);
+    lv_obj_set_style_text_font(values[0], &lv_font_montserrat_20, 0);
+    createOptions(screen, isoMap, onISO);
+}
+
+void LVGLScreens::updateISO(const std::shared_ptr<BMDCamera>& camera)
+{
+    if(!camera->hasSensorGainISO())
+        return;
+
+    int iso = camera->getSensorGainISO();
+    setText(0, std::to_string(iso));
+
+    int checked = -1;
+    for(byte index = 0; index < ISOScreen::kOptionCount; index++)
+    {
+        if(ISOScreen::getOption(index) == iso)
+            checked = index;
+    }
+    setChecked(checked);
+}
+
+void LVGLScreens::buildShutter(lv_obj_t* screen)
+{
+    createValue(screen, 180, 0, "", 0);
+    lv_obj_set_style_text_font(values[0], &lv_font_montserrat_20, 0);
+
+    shutterIsAngle = BMDControlSystem::getInstance()->getCamera() == nullptr || BMDControlSystem::getInstance()->getCamera()->shutterValueIsAngle;
+    createOptions(screen, shutterIsAngle ? shutterAngleMap : shutterSpeedMap, onShutter);
+}
+
+void LVGLScreens::updateShutter(const std::shared_ptr<BMDCamera>& camera)
+{
+    // The camera changed between angle and speed, the options change with it
+    if(camera->shutterValueIsAngle != shutterIsAngle && options != nullptr)
+    {
+        shutterIsAngle = camera->shutterValueIsAngle;
+        lv_btnmatrix_set_map(options, shutterIsAngle ? shutterAngleMap : shutterSpeedMap);
+        checkedOption = -1;
+    }
+
+    if(!camera->hasShutterAngle())
+        return;
+
+    int value = shutterIsAngle ? camera->getShutterAngle() : camera->getShutterSpeed();
+    const int* optionValues = shutterIsAngle ? kShutterAngles : kShutterSpeeds;
+
+    char buffer[16];
+    if(shutterIsAngle)
+        snprintf(buffer, sizeof(buffer), value % 100 == 0 ? "%.0f DEG" : "%.1f DEG", value / 100.0f);
+    else
+        snprintf(buffer, sizeof(buffer), "1/%d", value);
+    setText(0, buffer);
+
+    int checked = -1;
+    for(byte index = 0; index < 8; index++)
+    {
+        if(optionValues[index] == value)
+            checked = index;
+    }
+    setChecked(checked);
+}
+
+void LVGLScreens::buildWhiteBalanceTint(lv_obj_t* screen)
+{
+    createValue(screen, 160, 0, "", 0);
+    lv_obj_set_style_text_font(values[0], &lv_font_montserrat_20, 0);
+
+    lv_obj_t* presets = createOptions(screen, whiteBalancePresetMap, onWhiteBalancePreset);
+    lv_obj_set_height(presets, 96);
+
+    // WB -, WB +, Tint -, Tint +
+    static const char* kAdjustLabels[] = { "WB -", "WB +", "TINT -", "TINT +" };
+    short y = kContentTop + 36 + 96 + 2;
+    short h = LV_VER_RES - kNavHeight - 4 - y;
+    for(byte index = 0; index < 4; index++)
+        createButton(screen, 4 + index * 79, y, 75, h, kAdjustLabels[index], onWhiteBalanceAdjust, index);
+}
+
+void LVGLScreens::updateWhiteBalanceTint(const std::shared_ptr<BMDCamera>& camera)
+{
+    if(!camera->hasWhiteBalance())
+        return;
+
+    short whiteBalance = camera->getWhiteBalance();
+    short tint = camera->hasTint() ? camera->getTint() : 0;
+    setText(0, std::to_string(whiteBalance) + "K  " + std::to_string(tint));
+
+    setChecked(VideoConfig::GetWhiteBalancePresetFromValues(whiteBalance, tint));
+}
+
+void LVGLScreens::buildCodec(lv_obj_t* screen)
+{
+    createValue(screen, 160, 0, "", 0);
+    lv_obj_set_style_text_font(values[0], &lv_font_montserrat_20, 0);
+    createOptions(screen, codecMap, onCodec);
+}
+
+void LVGLScreens::updateCodec(const std::shared_ptr<BMDCamera>& camera)
+{
+    if(!camera->hasCodec())
+        return;
+
+    CodecInfo codec = camera->getCodec();
+    setText(0, codec.to_string());
+
+    int checked = -1;
+    for(byte index = 0; index < sizeof(kCodecs) / sizeof(kCodecs[0]); index++)
+    {
+        if(kCodecs[index].basicCodec == codec.basicCodec && kCodecs[index].codecVariant == codec.codecVariant)
+            checked = index;
+    }
+    setChecked(checked);
+}
+
+void LVGLScreens::buildFormat(lv_obj_t* screen)
+{
+    createValue(screen, 15, kContentTop + 10, "FRAME RATE", 0);
+    createValue(screen, 15, kContentTop + 70, "RESOLUTION", 1);
+    createValue(screen, 170, kContentTop + 10, "OFF SPEED", 2);
+
+    // Steps through the resolutions and sensor areas the sprite screen shows for this camera. The frame rate isn't editable there
+    // yet either.
+    short y = LV_VER_RES - kNavHeight - 4 - 40;
+    createButton(screen, 4, y, 154, 40, "< RES", onResolution, 0);
+    createButton(screen, 162, y, 154, 40, "RES >", onResolution, 1);
+}
+
+void LVGLScreens::updateFormat(const std::shared_ptr<BMDCamera>& camera)
+{
+    if(!camera->hasRecordingFormat())
+        return;
+
+    CCUPacketTypes::RecordingFormatData format = camera->getRecordingFormat();
+    setText(0, format.frameRate_string());
+    setText(1, format.frameWidthHeight_string());
+    setText(2, format.offSpeedEnabled ? std::to_string(format.offSpeedFrameRate) : "OFF");
+}
+
+void LVGLScreens::buildMedia(lv_obj_t* screen)
+{
+    // A button for each slot, tapping one with media makes it the active one
+    for(byte index = 0; index < MediaScreen::kMaxSlots; index++)
+    {
+        lv_obj_t* button = createButton(screen, 4, kContentTop + 4 + index * 56, LV_HOR_RES - 8, 52, "", onMediaSlot, index);
+        lv_obj_set_style_border_color(button, lv_palette_main(LV_PALETTE_RED), LV_STATE_USER_1);
+        lv_obj_set_style_border_width(button, 3, LV_STATE_USER_1);
+        values[index] = lv_obj_get_child(button, 0);
+    }
+}
+
+void LVGLScreens::updateMedia(const std::shared_ptr<BMDCamera>& camera)
+{
+    const std::vector<BMDCamera::MediaSlot> slots = camera->getMediaSlots();
+    for(byte index = 0; index < MediaScreen::kMaxSlots; index++)
+    {
+        lv_obj_t* button = values[index] != nullptr ? lv_obj_get_parent(values[index]) : nullptr;
+        setHidden(button, index >= slots.size());
+
+        if(index >= slots.size())
+            continue;
+
+        BMDCamera::MediaSlot slot = slots[index];
+        setText(index, std::to_string(index + 1) + "  " + slot.GetMediumString() + "  " + (slot.StatusIsError() || slot.status == CCUPacketTypes::MediaStatus::None ? slot.GetStatusString() : slot.remainingRecordTimeString));
+        setState(button, LV_STATE_CHECKED, slot.active);
+        setState(button, LV_STATE_USER_1, slot.StatusIsError());
+    }
+}
+
+void LVGLScreens::buildLens(lv_obj_t* screen)
+{
+    createValue(screen, 10, kContentTop + 4, "LENS", 0);
+    createValue(screen, 10, kContentTop + 46, "FOCAL LENGTH", 1);
+    createValue(screen, 10, kContentTop + 88, "APERTURE", 2);
+    createValue(screen, 10, kContentTop + 130, "DISTANCE", 3);
+    for(byte index = 0; index < 4; index++)
+        lv_obj_set_style_text_font(values[index], &lv_font_montserrat_20, 0);
+
+    // Autofocus, rack focus and a strip to drag the focus along, as on the sprite screen
+    createButton(screen, 170, kContentTop + 4, 146, 52, "FOCUS", onAutoFocus, 0);
+
+    lv_obj_t* rack = createButton(screen, 170, kContentTop + 60, 146, 52, "", onRackFocus, 0);
+    lv_obj_set_style_bg_color(rack, lv_palette_main(LV_PALETTE_ORANGE), LV_STATE_CHECKED);
+    values[4] = lv_obj_get_child(rack, 0);
+
+    // Dragging along it mustn't swipe to another screen
+    lv_obj_t* strip = createButton(screen, 170, kContentTop + 116, 146, 52, "< DRAG >", onFocusDrag, 0);
+    lv_obj_clear_flag(strip, LV_OBJ_FLAG_GESTURE_BUBBLE);
+    lv_obj_add_event_cb(strip, onFocusDrag, LV_EVENT_PRESSED, nullptr);
+    lv_obj_add_event_cb(strip, onFocusDrag, LV_EVENT_PRESSING, nullptr);
+    lv_obj_add_event_cb(strip, onFocusDrag, LV_EVENT_RELEASED, nullptr);
+}
+
+void LVGLScreens::updateLens(const std::shared_ptr<BMDCamera>& camera)
+{
+    setText(0, camera->hasLensType() ? camera->getLensType() : "");
+    setText(1, camera->hasLensFocalLength() ? camera->getLensFocalLength() : "");
+    setText(2, camera->hasLensIris() ? camera->getLensIris() : "");
+    setText(3, camera->hasLensDistance() ? camera->getLensDistance() : "");
+
+    // Shows where the next tap goes, or that it's moving
+    bool racking = MotionEngine::isMoving(MotionEngine::Axis::Focus);
+    setText(4, racking ? "RACKING" : (rackToB ? "RACK B > A" : "RACK A > B"));
+    if(values[4] != nullptr)
+        setState(lv_obj_get_parent(values[4]), LV_STATE_CHECKED, racking);
+}
+
+//
+// Events
+//
+
+void LVGLScreens::onShowScreen(lv_event_t* event)
+{
+    Screen screen = static_cast<Screen>(reinterpret_cast<intptr_t>(lv_event_get_user_data(event)));
+    if(screen != current)
+        show(screen, static_cast<byte>(screen) > static_cast<byte>(current));
+}
+
+void LVGLScreens::onGesture(lv_event_t* event)
+{
+    lv_dir_t direction = lv_indev_get_gesture_dir(lv_indev_get_act());
+    byte index = static_cast<byte>(current);
+
+    // Swiping left moves on to the next screen
+    if(direction == LV_DIR_LEFT)
+        show(static_cast<Screen>((index + 1) % kScreenCount), true);
+    else if(direction == LV_DIR_RIGHT)
+        show(static_cast<Screen>((index + kScreenCount - 1) % kScreenCount), false);
+}
+
+void LVGLScreens::onRecord(lv_event_t* event)
+{
+    std::shared_ptr<BMDCamera> camera = BMDControlSystem::getInstance()->getCamera();
+    if(camera == nullptr)
+        return;
+
+    auto transportInfo = camera->getTransportMode();
+    transportInfo.mode = camera->isRecording ? CCUPacketTypes::MediaTransportMode::Preview : CCUPacketTypes::MediaTransportMode::Record;
+
+    DEBUG_VERBOSE(camera->isRecording ? "Record Stop" : "Record Start");
+    PacketWriter::writeTransportInfo(transportInfo, connection);
+}
+
+void LVGLScreens::onISO(lv_event_t* event)
+{
+    uint16_t selected = lv_btnmatrix_get_selected_btn(lv_event_get_target(event));
+    if(selected != LV_BTNMATRIX_BTN_NONE && selected < ISOScreen::kOptionCount)
+        PacketWriter::writeISO(ISOScreen::getOption(selected), connection);
+}
+
+void LVGLScreens::onShutter(lv_event_t* event)
+{
+    uint16_t selected = lv_btnmatrix_get_selected_btn(lv_event_get_target(event));
+    if(selected == LV_BTNMATRIX_BTN_NONE || selected >= 8)
+        return;
+
+    if(shutterIsAngle)
+        PacketWriter::writeShutterAngle(kShutterAngles[selected], connection);
+    else
+        PacketWriter::writeShutterSpeed(kShutterSpeeds[selected], connection);
+}
+
+void LVGLScreens::onWhiteBalancePreset(lv_event_t* event)
+{
+    uint16_t selected = lv_btnmatrix_get_selected_btn(lv_event_get_target(event));
+    if(selected != LV_BTNMATRIX_BTN_NONE && selected < kWhiteBalancePresetCount)
+        PacketWriter::writeWhiteBalance(VideoConfig::kWhiteBalancePresets[selected].whiteBalance, VideoConfig::kWhiteBalancePresets[selected].tint, connection);
+}
+
+void LVGLScreens::onWhiteBalanceAdjust(lv_event_t* event)
+{
+    std::shared_ptr<BMDCamera> camera = BMDControlSystem::getInstance()->getCamera();
+    if(camera == nullptr || !camera->hasWhiteBalance())
+        return;
+
+    short whiteBalance = camera->getWhiteBalance();
+    short tint = camera->hasTint() ? camera->getTint() : 0;
+
+    // Same steps and limits as the sprite screen's buttons
+    switch(reinterpret_cast<intptr_t>(lv_event_get_user_data(event)))
+    {
+        case 0: if(whiteBalance >= 2550) whiteBalance -= 50; else return; break;
+        case 1: if(whiteBalance <= 9950) whiteBalance += 50; else return; break;
+        case 2: if(tint > -50) tint--; else return; break;
+        default: if(tint < 50) tint++; else return; break;
+    }
+
+    PacketWriter::writeWhiteBalance(whiteBalance, tint, connection);
+}
+
+void LVGLScreens::onCodec(lv_event_t* event)
+{
+    uint16_t selected = lv_btnmatrix_get_selected_btn(lv_event_get_target(event));
+    if(selected != LV_BTNMATRIX_BTN_NONE && selected < sizeof(kCodecs) / sizeof(kCodecs[0]))
+        PacketWriter::writeCodec(kCodecs[selected], connection);
+}
+
+void LVGLScreens::onResolution(lv_event_t* event)
+{
+    std::shared_ptr<BMDCamera> camera = BMDControlSystem::getInstance()->getCamera();
+    if(camera == nullptr || !camera->hasRecordingFormat())
+        return;
+
+    // The resolutions are UI/ResolutionScreen's for the camera, the URSA Mini Pro 12K doesn't have any yet
+    ResolutionScreen::Model model;
+    if(camera->isPocket4K())
+        model = ResolutionScreen::Model::Pocket4K;
+    else if(camera->isPocket6K())
+        model = ResolutionScreen::Model::Pocket6K;
+    else if(camera->isURSAMiniProG2())
+        model = ResolutionScreen::Model::URSAMiniProG2;
+    else
+        return;
+
+    CCUPacketTypes::BasicCodec codec = camera->hasCodec() ? camera->getCodec().basicCodec : CCUPacketTypes::BasicCodec::BRAW;
+    ResolutionScreen::update(model, codec, camera->getRecordingFormat());
+
+    CCUPacketTypes::RecordingFormatData newRecordingFormat;
+    ResolutionScreen::getNextOption(reinterpret_cast<intptr_t>(lv_event_get_user_data(event)) == 1, newRecordingFormat);
+    PacketWriter::writeRecordingFormat(newRecordingFormat, connection);
+}
+
+void LVGLScreens::onMediaSlot(lv_event_t* event)
+{
+    std::shared_ptr<BMDCamera> camera = BMDControlSystem::getInstance()->getCamera();
+    if(camera == nullptr)
+        return;
+
+    // Only a slot with media that isn't already the active one
+    intptr_t slotIndex = reinterpret_cast<intptr_t>(lv_event_get_user_data(event));
+    const std::vector<BMDCamera::MediaSlot> slots = camera->getMediaSlots();
+    if(slotIndex >= static_cast<intptr_t>(slots.size()) || slots[slotIndex].status == CCUPacketTypes::MediaStatus::None || slots[slotIndex].active)
+        return;
+
+    TransportInfo transportInfo = camera->getTransportMode();
+    for(int index = 0; index < transportInfo.slots.size(); index++)
+        transportInfo.slots[index].active = index == slotIndex;
+    PacketWriter::writeTransportInfo(transportInfo, connection);
+}
+
+void LVGLScreens::onAutoFocus(lv_event_t* event)
+{
+    PacketWriter::writeAutoFocus(connection);
+
+    DEBUG_DEBUG("Instantaneous Autofocus");
+}
+
+void LVGLScreens::onRackFocus(lv_event_t* event)
+{
+    // Racks to the other mark, a tap while it's moving turns it back from where it has got to
+    rackToB = !rackToB;
+    float target = rackToB ? rackFocusB : rackFocusA;
+
+    if(MotionEngine::isMoving(MotionEngine::Axis::Focus))
+        MotionEngine::moveTo(MotionEngine::Axis::Focus, target, rackFocusMs);
+    else
+        MotionEngine::move(MotionEngine::Axis::Focus, rackToB ? rackFocusA : rackFocusB, target, rackFocusMs);
+
+    setText(4, "RACKING");
+    if(values[4] != nullptr)
+        setState(lv_obj_get_parent(values[4]), LV_STATE_CHECKED, true);
+}
+
+void LVGLScreens::onFocusDrag(lv_event_t* event)
+{
+    switch(lv_event_get_code(event))
+    {
+        case LV_EVENT_PRESSED:
+            MotionEngine::cancel(MotionEngine::Axis::Focus); // The finger takes over from a rack
+            break;
+        case LV_EVENT_PRESSING:
+        {
+            // Moved since the last report, written by the coalescer so a quick drag doesn't flood the camera
+            lv_point_t vector;
+            lv_indev_get_vect(lv_indev_get_act(), &vector);
+            if(vector.x != 0)
+                CommandCoalescer::add(CommandCoalescer::Parameter::FocusOffset, vector.x * kFocusUnitsPerPixel, micros());
+            break;
+        }
+        case LV_EVENT_RELEASED:
+            CommandCoalescer::flush(CommandCoalescer::Parameter::FocusOffset); // Last value goes now
+            break;
+        default:
+            break;
+    }
+}
@@ -0,0 +1,122 @@
+#ifndef LVGLSCREENS_H
+#define LVGLSCREENS_H
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include "Arduino_DebugUtils.h"
+#include "m5gfx_lvgl.h"
+#include "Camera/BMDCameraConnection.h"
+#include "Camera/BMDCamera.h"
+
+// EXPERIMENTAL: a scaffold that builds but hasn't been run on a camera, and has no pass key or connection screens of its own, so
+// USING_LVGL stays 0 and the sprite screens are the ones to use.
+//
+// The CoreS3's connected screens built with LVGL (USING_LVGL in its main file). A screen's widgets are created when it's shown and
+// update() is called when the camera changes: only the widgets whose value changed are set, so LVGL only redraws and sends those
+// areas. Swiping left and right moves through the screens, the buttons along the bottom go to the dashboard, recording and codec
+// screens as on the sprite screens. The pass key and connection screens are still drawn in the sprite before LVGL takes over.
+class LVGLScreens
+{
+    public:
+        enum class Screen : byte
+        {
+            Dashboard = 0,
+            Recording,
+            ISO,
+            Shutter,
+            WhiteBalanceTint,
+            Codec,
+            Format,
+            Media,
+            Lens
+        };
+
+        static void begin(BMDCameraConnection* inConnection);
+        static bool isStarted() { return connection != nullptr; }
+
+        // Builds a screen and slides it in, from the right when going forward
+        static void show(Screen screen, bool forward = true);
+        static Screen getScreen() { return current; }
+
+        // Brings the screen up to date with the camera
+        static void update(const std::shared_ptr<BMDCamera>& camera);
+
+        // Redraws everything, e.g. after other screens have drawn straight to the display
+        static void invalidateAll();
+
+        // The lens screen's rack button moves the focus between these (0.0 near to 1.0 far), as the sprite screen's does
+        static void setRackFocus(float a, float b, unsigned long durationMs);
+
+        static void reportStats();
+
+    private:
+        static const byte kScreenCount = 9;
+        static const byte kMaxValues = 8;
+
+        static lv_obj_t* createScreen(const char* title);
+        static lv_obj_t* createTile(lv_obj_t* parent, short x, short y, short w, short h, const char* caption, Screen target, byte valueIndex);
+        static lv_obj_t* createValue(lv_obj_t* parent, short x, short y, const char* caption, byte valueIndex);
+        static lv_obj_t* createOptions(lv_obj_t* parent, const char** map, lv_event_cb_t onSelected);
+        static lv_obj_t* createButton(lv_obj_t* parent, short x, short y, short w, short h, const char* text, lv_event_cb_t onClicked, intptr_t userData);
+
+        // Only touch LVGL when something has changed, setting a widget invalidates its area even if it looks the same
+        static void setText(byte valueIndex, const std::string& text);
+        static void setState(lv_obj_t* object, lv_state_t state, bool on);
+        static void setHidden(lv_obj_t* object, bool hidden);
+        static void setChecked(int index);
+
+        static void buildDashboard(lv_obj_t* screen);
+        static void buildRecording(lv_obj_t* screen);
+        static void buildISO(lv_obj_t* screen);
+        static void buildShutter(lv_obj_t* screen);
+        static void buildWhiteBalanceTint(lv_obj_t* screen);
+        static void buildCodec(lv_obj_t* screen);
+        static void buildFormat(lv_obj_t* screen);
+        static void buildMedia(lv_obj_t* screen);
+        static void buildLens(lv_obj_t* screen);
+
+        static void updateDashboard(const std::shared_ptr<BMDCamera>& camera);
+        static void updateRecording(const std::shared_ptr<BMDCamera>& camera);
+        static void updateISO(const std::shared_ptr<BMDCamera>& camera);
+        static void updateShutter(const std::shared_ptr<BMDCamera>& camera);
+        static void updateWhiteBalanceTint(const std::shared_ptr<BMDCamera>& camera);
+        static void updateCodec(const std::shared_ptr<BMDCamera>& camera);
+        static void updateFormat(const std::shared_ptr<BMDCamera>& camera);
+        static void updateMedia(const std::shared_ptr<BMDCamera>& camera);
+        static void updateLens(const std::shared_ptr<BMDCamera>& camera);
+
+        static void onShowScreen(lv_event_t* event);
+        static void onGesture(lv_event_t* event);
+        static void onRecord(lv_event_t* event);
+        static void onISO(lv_event_t* event);
+        static void onShutter(lv_event_t* event);
+        static void onWhiteBalancePreset(lv_event_t* event);
+        static void onWhiteBalanceAdjust(lv_event_t* event);
+        static void onCodec(lv_event_t* event);
+        static void onResolution(lv_event_t* event);
+        static void onMediaSlot(lv_event_t* event);
+        static void onAutoFocus(lv_event_t* event);
+        static void onRackFocus(lv_event_t* event);
+        static void onFocusDrag(lv_event_t* event);
+
+        static BMDCameraConnection* connection;
+        static Screen current;
+
+        // Widgets of the screen being shown
+        static lv_obj_t* values[kMaxValues];
+        static lv_obj_t* options;
+        static lv_obj_t* recordButton;
+        static int checkedOption;
+        static bool shutterIsAngle;
+
+        static float rackFocusA;
+        static float rackFocusB;
+        static unsigned long rackFocusMs;
+        static bool rackToB;
+
+        static unsigned long updates;
+        static unsigned long widgetChanges;
+};
+
+#endif
@@ -6,20 +6,62 @@ static lv_disp_draw_buf_t draw_buf;
 
 LV_IMG_DECLARE(cursor_hand);
 
+static bool flush_writing       = false;
+static uint32_t flushed_pixels = 0;
+
+// Only the areas LVGL has invalidated are flushed. Each one goes out over DMA
+// and LVGL is told straight away that it can carry on rendering into the other
+// draw buffer, the next flush waits for this DMA before starting its own. The
+// write transaction is kept open until the last area of the refresh as ending
+// it waits for the DMA.
 static void m5gfx_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area,
                              lv_color_t *color_p) {
     int w = (area->x2 - area->x1 + 1);
     int h = (area->y2 - area->y1 + 1);
 
-    M5.Display.startWrite();
-    M5.Display.setAddrWindow(area->x1, area->y1, w, h);
-    M5.Display.writePixels((lgfx::swap565_t *)&color_p->full, w * h);
-    M5.Display.endWrite();
+    if (!flush_writing) {
+        M5.Display.startWrite();
+        flush_writing = true;
+    }
+
+    M5.Display.waitDMA();
+    M5.Display.pushImageDMA(area->x1, area->y1, w, h,
+                            (lgfx::swap565_t *)&color_p->full);
+    flushed_pixels += w * h;
+
+    if (lv_disp_flush_is_last(disp)) {
+        M5.Display.endWrite();
+        flush_writing = false;
+    }
+
     lv_disp_flush_ready(disp);
 }
 
+uint32_t m5gfx_lvgl_flushed_pixels(void) {
+    return flushed_pixels;
+}
+
+static m5gfx_lvgl_touch_reader_t touch_reader = nullptr;
+
+void m5gfx_lvgl_set_touch_reader(m5gfx_lvgl_touch_reader_t reader) {
+    touch_reader = reader;
+}
+
 static void m5gfx_lvgl_read(lv_indev_drv_t *indev_driver,
                             lv_indev_data_t *data) {
+    // Touch already read elsewhere (the I2C scheduler), no bus access here
+    if (touch_reader != nullptr) {
+        lv_coord_t x, y;
+        if (touch_reader(&x, &y)) {
+            data->state   = LV_INDEV_STATE_PR;
+            data->point.x = x;
+            data->point.y = y;
+        } else {
+            data->state = LV_INDEV_STATE_REL;
+        }
+        return;
+    }
+
     uint16_t touchX, touchY;
     lgfx::touch_point_t tp[1];
 
@@ -52,6 +94,8 @@ static void lvgl_tick_task(void *arg) {
 }
 
 void m5gfx_lvgl_init(void) {
+    // Two draw buffers in PSRAM (the S3's DMA can read it), LVGL renders into
+    // one while the other is being sent
     static lv_color_t *buf1 = (lv_color_t *)heap_caps_malloc(
         LCD_WIDTH * 80 * sizeof(lv_color_t), MALLOC_CAP_SPIRAM);
     static lv_color_t *buf2 = (lv_color_t *)heap_caps_malloc(
@@ -11,4 +11,12 @@
 
 void m5gfx_lvgl_init(void);
 
+// Pixels sent to the display so far, only the areas LVGL invalidated are sent
+uint32_t m5gfx_lvgl_flushed_pixels(void);
+
+// Where LVGL gets touch from instead of reading the panel itself, returns
+// true while a finger is down
+typedef bool (*m5gfx_lvgl_touch_reader_t)(lv_coord_t *x, lv_coord_t *y);
+void m5gfx_lvgl_set_touch_reader(m5gfx_lvgl_touch_reader_t reader);
+
 #endif  // __M5GFX_LVGL_H__
\ No newline at end of file
@@ -190,6 +190,23 @@ CCUPacketTypes::Command CCUEncodingFunctions::CreateCodecCommand(CodecInfo codec
     return command;
 }
 
+CCUPacketTypes::Command CCUEncodingFunctions::CreateDisplayLUTCommand(CCUPacketTypes::SelectedLUT selectedLUT, bool enabled)
+{
+    // The same two bytes the camera sends, the LUT and whether it's enabled
+    std::vector<byte> data = { static_cast<byte>(selectedLUT), static_cast<byte>(enabled ? 1 : 0) };
+
+    CCUPacketTypes::Command command(
+        CCUPacketTypes::kBroadcastTarget,
+        CCUPacketTypes::CommandID::ChangeConfiguration,
+        CCUPacketTypes::Category::Video,
+        static_cast<byte>(CCUPacketTypes::VideoParameter::DisplayLUT),
+        CCUPacketTypes::OperationType::AssignValue,
+        static_cast<byte>(CCUPacketTypes::DataTypes::kInt8),
+        data);
+
+    return command;
+}
+
 CCUPacketTypes::Command CCUEncodingFunctions::CreateInt16Command(short value, CCUPacketTypes::Category category, byte parameter) {
 
     short dataArray[] = { 0, value };
@@ -275,6 +275,7 @@ public:
     // Last Modified
     unsigned long getLastModified() const { return lastUpdated; }
     void setLastModified() { modified(); }
+    unsigned long getModifiedCount() const { return modifiedCount; } // Number of changes to the camera state, used to measure redraw pressure
 
     // Last known BRAW Bitrate, BRAW Quality, and ProRes settings (for when we switch between options we know what to change it to)
     // Default options for now, until we get settings from the camera coming through
@@ -288,9 +289,10 @@ private:
     bool connected = false;
     int activeMediaSlotIndex = -1; // The index of the active media slot, used for quick access to info on it.
     unsigned long lastUpdated = millis(); // Keeps track of when it was last changed
+    unsigned long modifiedCount = 0; // Keeps track of how many times it has changed
 
     // Last Modified
-    void modified() { lastUpdated = millis(); }
+    void modified() { lastUpdated = millis(); modifiedCount++; }
 
     // Custom Attributes
     std::vector<MediaSlot> mediaSlots;
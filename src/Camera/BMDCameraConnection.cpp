@@ -1,4 +1,7 @@
 #include "BMDCameraConnection.h"
+#include "PacketRecorder.h"
+#include "LinkHealthMonitor.h"
+#include "ReconnectScheduler.h"
 
 // Update this to what you would like shown on the back of the camera
 const std::string BMDCameraConnection::CODEAPPNAME ="Magic Pocket Control";
@@ -12,7 +15,6 @@ BMDCameraConnection::~BMDCameraConnection()
 {
   delete bleClient;
   delete bleScan;
-  delete bleSecurity;
   delete bleAdvertisedDevice;
   delete bleRemoteService;
 
@@ -42,19 +44,25 @@ void BMDCameraConnection::initialise()
     if(initialised)
         return;
 
+    // Created once and kept for the life of the program, initialise only runs once
+    static SerialSecurityHandler securityHandler;
+    initialiseBluetooth(&securityHandler);
+}
+
+void BMDCameraConnection::initialiseBluetooth(PassKeyEntry* entry)
+{
     appName = CODEAPPNAME;
 
     bleDevice.init("MPC");
     bleDevice.setPower(ESP_PWR_LVL_P9);
     bleDevice.setEncryptionLevel(ESP_BLE_SEC_ENCRYPT);
 
-    SerialSecurityHandler* securityHandler = new SerialSecurityHandler(this);
-    bleDevice.setSecurityCallbacks(securityHandler);
+    // No security callbacks, they'd have to return the pass key from inside the Bluetooth task. Our GAP handler records the
+    // request and the pass key entry answers it from loop() (security requests are still accepted by BLEDevice without them).
+    passKeyEntry = entry;
+    BLEDevice::setCustomGapHandler(BMDCameraConnection::gapEventHandler);
 
-    bleSecurity = new BLESecurity();
-    bleSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
-    bleSecurity->setCapability(ESP_IO_CAP_IN);
-    bleSecurity->setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
+    applySecurity();
 
     status = ConnectionStatus::Disconnected;
     // disconnect();
@@ -62,14 +70,108 @@ void BMDCameraConnection::initialise()
     initialised = true;
 }
 
+void BMDCameraConnection::applySecurity()
+{
+    bleSecurity.setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
+    bleSecurity.setCapability(ESP_IO_CAP_IN);
+    bleSecurity.setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
+}
+
+// Called from the Bluetooth task for every GAP event, it mustn't wait on anything
+void BMDCameraConnection::gapEventHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param)
+{
+    BMDCameraConnection* instance = BMDCameraConnection::instancePtr;
+    if(instance == nullptr)
+        return;
+
+    switch(event)
+    {
+        case ESP_GAP_BLE_PASSKEY_REQ_EVT:
+            DEBUG_VERBOSE("Pass key requested");
+
+            // Update the connection status to requesting PassKey, the entry picks it up in loop()
+            PassKeyRequest::requested(param->ble_security.ble_req.bd_addr);
+            instance->status = ConnectionStatus::NeedPassKey;
+            break;
+
+        case ESP_GAP_BLE_AUTH_CMPL_EVT:
+            DEBUG_VERBOSE("Authentication complete, %s", param->ble_security.auth_cmpl.success ? "succeeded" : "failed");
+
+            PassKeyRequest::finished();
+
+            // connect() sets Connected once it has subscribed to the camera, until then it's still connecting
+            if(param->ble_security.auth_cmpl.success)
+            {
+                if(instance->status == ConnectionStatus::NeedPassKey)
+                    instance->status = ConnectionStatus::Connecting;
+            }
+            else
+            {
+                instance->failedPassKeyTime = millis();
+                instance->status = ConnectionStatus::FailedPassKey;
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool BMDCameraConnection::servicePassKey()
+{
+    if(passKeyEntry == nullptr)
+        return false;
+
+    return passKeyEntry->service();
+}
+
+void BMDCameraConnection::connectInBackground(BLEAddress cameraAddress)
+{
+    if(connectTaskHandle != nullptr)
+        return;
+
+    // Set here rather than in the task so loop() doesn't start another connection before it runs
+    status = ConnectionStatus::Connecting;
+    connectAddress = cameraAddress.toString();
+
+    if(xTaskCreate(BMDCameraConnection::connectTask, "connect", 8192, this, 1, &connectTaskHandle) != pdPASS)
+    {
+        DEBUG_ERROR("Unable to start the connection task, connecting from loop()");
+        connectTaskHandle = nullptr;
+        connect(cameraAddress);
+    }
+}
+
+void BMDCameraConnection::connectTask(void* parameter)
+{
+    BMDCameraConnection* instance = static_cast<BMDCameraConnection*>(parameter);
+
+    instance->connect(BLEAddress(instance->connectAddress));
+
+    // Declines a pass key request left over from a connection that failed
+    if(PassKeyRequest::isPending())
+        PassKeyRequest::decline();
+
+    instance->connectTaskHandle = nullptr;
+    vTaskDelete(nullptr);
+}
+
 bool BMDCameraConnection::scan()
 {
     status = ConnectionStatus::Scanning;
 
     bleScan = bleDevice.getScan();
+
+    if(listening)
+    {
+        bleScan->stop();
+        listening = false;
+    }
+
     bleScan->setInterval(1349);
     bleScan->setWindow(449);
     bleScan->setActiveScan(false);
+    bleScan->setAdvertisedDeviceCallbacks(&advertisedDeviceCallback);
 
     DEBUG_VERBOSE("Scan starting (5 seconds).");
     bleScan->start(5, BMDCameraConnection::connectCallback, false);
@@ -77,6 +179,102 @@ bool BMDCameraConnection::scan()
     return true;
 }
 
+// Replaces a fixed reconnect interval in loop(), the ReconnectScheduler backs off after each failed attempt and while we wait we listen
+// (with a low duty passive scan) for a bonded camera so we can connect as soon as it's back.
+bool BMDCameraConnection::reconnectDue()
+{
+    applyAdvertisedCamera();
+
+    if(status != ConnectionStatus::Disconnected && status != ConnectionStatus::FailedPassKey)
+        return false;
+
+    // A failed pass key is reported before the connection task has finished with the camera
+    if(isConnecting())
+        return false;
+
+    // Left showing for a while (without holding up loop()) so it can be read, then it's an ordinary disconnection
+    if(status == ConnectionStatus::FailedPassKey)
+    {
+        if(millis() - failedPassKeyTime < kFailedPassKeyShowTime)
+            return false;
+
+        status = ConnectionStatus::Disconnected;
+    }
+
+    if(!ReconnectScheduler::isWaiting())
+    {
+        ReconnectScheduler::startWaiting();
+
+        if(initialised && !listening)
+        {
+            bleScan = bleDevice.getScan();
+            bleScan->setInterval(1280);
+            bleScan->setWindow(60);
+            bleScan->setActiveScan(false);
+            bleScan->setAdvertisedDeviceCallbacks(&advertisedDeviceCallback);
+            bleScan->clearResults();
+
+            listening = bleScan->start(0, BMDCameraConnection::listenCallback, false);
+        }
+    }
+
+    return ReconnectScheduler::attemptDue();
+}
+
+// Guards the camera recorded by the Bluetooth task until loop() picks it up
+static portMUX_TYPE advertisedCameraLock = portMUX_INITIALIZER_UNLOCKED;
+
+// Called from the Bluetooth task for each camera seen, only records the camera, loop() connects to it (see applyAdvertisedCamera)
+void BMDCameraConnection::cameraAdvertised(BLEAddress cameraAddress)
+{
+    if(status != ConnectionStatus::Scanning && !listening)
+        return;
+
+    if(!isCameraBonded(cameraAddress))
+        return;
+
+    portENTER_CRITICAL(&advertisedCameraLock);
+    memcpy(advertisedCameraAddress, *cameraAddress.getNative(), sizeof(esp_bd_addr_t));
+    advertisedCameraPending = true;
+    portEXIT_CRITICAL(&advertisedCameraLock);
+}
+
+// From loop(), a bonded camera the Bluetooth task saw advertising
+void BMDCameraConnection::applyAdvertisedCamera()
+{
+    esp_bd_addr_t address;
+
+    portENTER_CRITICAL(&advertisedCameraLock);
+    bool pending = advertisedCameraPending;
+    if(pending)
+        memcpy(address, advertisedCameraAddress, sizeof(esp_bd_addr_t));
+    advertisedCameraPending = false;
+    portEXIT_CRITICAL(&advertisedCameraLock);
+
+    // We may have started connecting (e.g. a fast reconnect) since it was seen
+    if(!pending || (status != ConnectionStatus::Scanning && !listening))
+        return;
+
+    BLEAddress cameraAddress(address);
+
+    DEBUG_VERBOSE("Bonded camera advertising %s, connecting", cameraAddress.toString().c_str());
+
+    // Don't wait for the scan (or next attempt), this is the camera we want
+    bleScan->stop();
+    listening = false;
+
+    ReconnectScheduler::knownCameraSeen();
+
+    cameraAddresses.clear();
+    cameraAddresses.push_back(cameraAddress);
+    status = ConnectionStatus::ScanningFound;
+}
+
+void BMDCameraConnection::listenCallback(BLEScanResults scanResults)
+{
+    BMDCameraConnection::instancePtr->listening = false;
+}
+
 void BMDCameraConnection::connectCallback(BLEScanResults scanResults) {
     // Access the class instance using the static member variable
     BMDCameraConnection* instance = BMDCameraConnection::instancePtr;
@@ -108,33 +306,39 @@ void BMDCameraConnection::connectCallback(BLEScanResults scanResults) {
         instance->status = ConnectionStatus::ScanningNoneFound;
 }
 
+// Bond list is read into a fixed buffer rather than allocating one on every call, these are called for each camera advertisement.
+// A mutex as it's used from both loop() and the Bluetooth task.
+static esp_ble_bond_dev_t bondedDevices[BMDCameraConnection::kMaxBondedDevices];
+static StaticSemaphore_t bondedDevicesMutexBuffer;
+static SemaphoreHandle_t bondedDevicesMutex = xSemaphoreCreateMutexStatic(&bondedDevicesMutexBuffer);
+
 // Clears BLE bonding, mainly for testing pass key connections: https://icircuit.net/esp-idf-bluetooth-remove-bonded-devices/3040
 void BMDCameraConnection::clearBondedDevices()
 {
-    int dev_num = esp_ble_get_bond_device_num();
-    esp_ble_bond_dev_t *dev_list = (esp_ble_bond_dev_t *)malloc(sizeof(esp_ble_bond_dev_t) * dev_num);
-    esp_ble_get_bond_device_list(&dev_num, dev_list);
+    xSemaphoreTake(bondedDevicesMutex, portMAX_DELAY);
+
+    int dev_num = kMaxBondedDevices;
+    esp_ble_get_bond_device_list(&dev_num, bondedDevices);
     for (int i = 0; i < dev_num; i++) {
-        esp_ble_remove_bond_device(dev_list[i].bd_addr);
+        esp_ble_remove_bond_device(bondedDevices[i].bd_addr);
     }
 
-    free(dev_list);
+    xSemaphoreGive(bondedDevicesMutex);
 }
 
 // Have we got a bond to the camera address on the BLE device?
 bool BMDCameraConnection::isCameraBonded(BLEAddress cameraAddress)
 {
-    int dev_num = esp_ble_get_bond_device_num();
-
-    esp_ble_bond_dev_t *dev_list = (esp_ble_bond_dev_t *)malloc(sizeof(esp_ble_bond_dev_t) * dev_num);
+    xSemaphoreTake(bondedDevicesMutex, portMAX_DELAY);
 
-    esp_ble_get_bond_device_list(&dev_num, dev_list);
+    int dev_num = kMaxBondedDevices;
+    esp_ble_get_bond_device_list(&dev_num, bondedDevices);
 
     bool returnValue = false;
 
     for (int i = 0; i < dev_num; i++)
     {  
-        BLEAddress bleBondedAddress(dev_list[i].bd_addr);
+        BLEAddress bleBondedAddress(bondedDevices[i].bd_addr);
 
         if(bleBondedAddress == cameraAddress)
         {
@@ -145,35 +349,55 @@ bool BMDCameraConnection::isCameraBonded(BLEAddress cameraAddress)
         }
     }
 
-    free(dev_list);
+    xSemaphoreGive(bondedDevicesMutex);
     return returnValue;
 }
 
+// Create the client (this device) once, it's reused for every connection after that
+bool BMDCameraConnection::createClient()
+{
+    if(bleClient != nullptr)
+        return true;
+
+    bleClient = bleDevice.createClient();
+
+    delay(500);
+
+    if(bleClient == nullptr)
+    {
+        DEBUG_ERROR("Failed to create Client");
+        return false;
+    }
+
+    // Handle Connect/Disconnect call backs and pass this object in so we can update status
+    bleClient->setClientCallbacks(&clientCallback);
+
+    delay(500);
+
+    DEBUG_VERBOSE("Created Bluetooth client and associated connect/disconnect call backs");
+
+    return true;
+}
+
 void BMDCameraConnection::connect(BLEAddress cameraAddress)
 {
+    // Stop listening for cameras between reconnect attempts
+    if(listening)
+    {
+        bleScan->stop();
+        listening = false;
+    }
+
     if(!cameraAddresses.empty())
     {
         DEBUG_VERBOSE("Cameras found: %i", cameraAddresses.size());
 
-        // Create the client (this device)
-        bleClient = bleDevice.createClient();
-
-        delay(500);
-
-        if(bleClient == nullptr)
+        if(!createClient())
         {
-            DEBUG_ERROR("Failed to create Client");
             disconnect();
             return;
         }
 
-        // Handle Connect/Disconnect call backs and pass this object in so we can update status
-        bleClient->setClientCallbacks(new BMDBLEClientCallback(this));
-
-        delay(500);
-
-        DEBUG_VERBOSE("Created Bluetooth client and associated connect/disconnect call backs");
-
         // Connect to the first BLE Server (Camera)
         status = ConnectionStatus::Connecting;
         bool connectedToCamera = bleClient->connect(cameraAddress); // if you pass BLEAdvertisedDevice instead of address, it will be recognized type of peer device address (public or private)
@@ -185,6 +409,8 @@ void BMDCameraConnection::connect(BLEAddress cameraAddress)
             return;
         }
 
+        lastCameraAddress = cameraAddress.toString();
+
         // Obtain a reference to the service we are after in the remote BLE server
         bleRemoteService = bleClient->getService(Constants::UUID_BMD_BCS);
         if (bleRemoteService == nullptr)
@@ -295,6 +521,8 @@ void BMDCameraConnection::connect(BLEAddress cameraAddress)
         BMDControlSystem::getInstance()->activateCamera();
 
         status = ConnectionStatus::Connected;
+        LinkHealthMonitor::connected();
+        ReconnectScheduler::connected();
 
         bmdConnectionStatus |= ConnectionStatusFlags::kConnected;
         bmdConnectionStatus |= ConnectionStatusFlags::kPaired;
@@ -313,9 +541,18 @@ void BMDCameraConnection::disconnect()
     // Clear known cameras
     cameraAddresses.clear();
 
-    if(bleClient->isConnected())
+    if(bleClient != nullptr && bleClient->isConnected())
         bleClient->disconnect();
 
+    // The client deletes the old services and characteristics when it next connects
+    bleRemoteService = nullptr;
+    bleChar_IncomingCameraControl = nullptr;
+    bleChar_OutgoingCameraControl = nullptr;
+    bleChar_DeviceName = nullptr;
+    bleChar_Timecode = nullptr;
+    bleChar_ProtocolVersion = nullptr;
+    bleChar_CameraStatus = nullptr;
+
     if(BMDControlSystem::getInstance()->hasCamera())
         BMDControlSystem::getInstance()->deactivateCamera();
 
@@ -329,18 +566,130 @@ void BMDCameraConnection::sendCommandToOutgoing(CCUPacketTypes::Command command,
 {
     std::vector<byte> data = command.serialize();
 
+    PacketRecorder::record(PacketRecorder::RecordType::OutgoingCameraControl, data.data(), data.size());
+
+    // No characteristic if we've never connected, e.g. when replaying a capture
+    if(bleChar_OutgoingCameraControl == nullptr)
+        return;
+
+    if(!bleClient->isConnected())
+    {
+        LinkHealthMonitor::writeCompleted(false, 0, response);
+        return;
+    }
+
+    unsigned long writeStart = micros();
     bleChar_OutgoingCameraControl->writeValue(data.data(), data.size(), response);
+    LinkHealthMonitor::writeCompleted(true, micros() - writeStart, response);
 }
 
 // Primarily for testing, sends a byte array rather than a formulated and validated command
 void BMDCameraConnection::sendBytesToOutgoing(std::vector<byte> data, bool response)
 {
+    PacketRecorder::record(PacketRecorder::RecordType::OutgoingCameraControl, data.data(), data.size());
+
+    if(bleChar_OutgoingCameraControl == nullptr)
+        return;
+
+    if(!bleClient->isConnected())
+    {
+        LinkHealthMonitor::writeCompleted(false, 0, response);
+        return;
+    }
+
+    unsigned long writeStart = micros();
     bleChar_OutgoingCameraControl->writeValue(data.data(), data.size(), response);
+    LinkHealthMonitor::writeCompleted(true, micros() - writeStart, response);
+}
+
+int BMDCameraConnection::getRssi()
+{
+    if(bleClient == nullptr || !bleClient->isConnected())
+        return 0;
+
+    return bleClient->getRssi();
+}
+
+bool BMDCameraConnection::probeLink()
+{
+    if(bleChar_ProtocolVersion == nullptr || bleClient == nullptr || !bleClient->isConnected())
+        return false;
+
+    // Any characteristic read needs a reply from the camera, the protocol version is small and always there
+    return !bleChar_ProtocolVersion->readValue().empty() && bleClient->isConnected();
+}
+
+// Everything a connection does up to the radio: the pooled client, security, finding a camera while scanning and the client's connect callback
+bool BMDCameraConnection::soakConnect(BLEAddress cameraAddress)
+{
+    if(!createClient())
+        return false;
+
+    applySecurity();
+
+    // Seen while scanning, as the advertised device callback reports it (connected to straight away if we're bonded)
+    bleScan = bleDevice.getScan();
+    status = ConnectionStatus::Scanning;
+    cameraAdvertised(cameraAddress);
+    applyAdvertisedCamera();
+
+    if(status != ConnectionStatus::ScanningFound)
+    {
+        cameraAddresses.clear();
+        cameraAddresses.push_back(cameraAddress);
+    }
+
+    clientCallback.onConnect(bleClient);
+
+    lastCameraAddress = cameraAddress.toString();
+    status = ConnectionStatus::Connected;
+
+    return true;
+}
+
+// The link dropping, the client's disconnect callback tidies up through disconnect()
+void BMDCameraConnection::soakDisconnect()
+{
+    clientCallback.onDisconnect(bleClient);
+}
+
+bool BMDCameraConnection::reconnect()
+{
+    if(lastCameraAddress.empty())
+        return false;
+
+    BLEAddress cameraAddress(lastCameraAddress);
+
+    // Without a bond we'd need the pass key again, leave that to the normal scan and connect
+    if(!isCameraBonded(cameraAddress))
+        return false;
+
+    DEBUG_INFO("Reconnecting to camera %s", lastCameraAddress.c_str());
+
+    if(status != ConnectionStatus::Disconnected)
+        disconnect();
+
+    // The ReconnectScheduler may already be listening for the camera
+    if(listening)
+    {
+        bleScan->stop();
+        listening = false;
+    }
+
+    // Connecting blocks until the camera answers, so it's done from the connection task to keep loop() (and the screen) running
+    cameraAddresses.push_back(cameraAddress);
+    connectInBackground(cameraAddress);
+
+    return status == ConnectionStatus::Connecting || status == ConnectionStatus::Connected;
 }
 
 // Incoming Control Notifications
 void BMDCameraConnection::IncomingCameraControlNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify)
 {
+    // Recorded before validation so invalid packets can be replayed too
+    PacketRecorder::record(PacketRecorder::RecordType::IncomingCameraControl, pData, length);
+    LinkHealthMonitor::notifyReceived();
+
     // Must be between 8 and 64 bytes inclusive
     if(length >= 8 && length <= 64)
     {
@@ -357,6 +706,9 @@ void BMDCameraConnection::IncomingCameraControlNotify(BLERemoteCharacteristic *p
 // Incoming Timecode
 void BMDCameraConnection::IncomingTimecodeNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify)
 {
+    PacketRecorder::record(PacketRecorder::RecordType::Timecode, pData, length);
+    LinkHealthMonitor::notifyReceived();
+
     // Must be 12 byte
     if(length == 12 ) //>= 8 && length <= 64)
     {
@@ -376,6 +728,9 @@ void BMDCameraConnection::IncomingTimecodeNotify(BLERemoteCharacteristic *pBLERe
 // Incoming Camera Status - primarily using for consistency with BMD's code
 void BMDCameraConnection::IncomingCameraStatusNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify)
 {
+    PacketRecorder::record(PacketRecorder::RecordType::CameraStatus, pData, length);
+    LinkHealthMonitor::notifyReceived();
+
     std::vector<byte> data(pData, pData + length);
     byte cameraStatus = CameraStatus::GetCameraStatusFlags(data);
 
@@ -15,8 +15,10 @@
     #include "BLE_M5GFX/ScreenSecurityHandler.h"
 #endif
 
+#include "BLE/PassKeyRequest.h"
 #include "BLE/SerialSecurityHandler.h"
 #include "BLE/BMDBLEClientCallback.h"
+#include "BLE/BMDAdvertisedDeviceCallback.h"
 #include "BMDCamera.h"
 #include "CCU/CCUUtility.h"
 #include "BMDControlSystem.h"
@@ -75,24 +77,9 @@ class BMDCameraConnection
                 if(initialised)
                     return;
 
-                appName = CODEAPPNAME;
-
-                bleDevice.init("MPC");
-                bleDevice.setPower(ESP_PWR_LVL_P9);
-                bleDevice.setEncryptionLevel(ESP_BLE_SEC_ENCRYPT);
-
-                ScreenSecurityHandler* securityHandler = new ScreenSecurityHandler(this, windowPtr, spritePassKeyPtr, touchPtr, screenWidth, screenHeight);
-                bleDevice.setSecurityCallbacks(securityHandler);
-
-                bleSecurity = new BLESecurity();
-                bleSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
-                bleSecurity->setCapability(ESP_IO_CAP_IN);
-                bleSecurity->setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
-
-                status = ConnectionStatus::Disconnected;
-                // disconnect();
-
-                initialised = true;
+                // Created once and kept for the life of the program, initialise only runs once
+                static ScreenSecurityHandler securityHandler(windowPtr, spritePassKeyPtr, touchPtr, screenWidth, screenHeight);
+                initialiseBluetooth(&securityHandler);
             }
 
         #elif USING_M5_BUTTONS == 1
@@ -103,23 +90,9 @@ class BMDCameraConnection
                 if(initialised)
                     return;
 
-                appName = CODEAPPNAME;
-
-                bleDevice.init("MPC");
-                bleDevice.setPower(ESP_PWR_LVL_P9);
-                bleDevice.setEncryptionLevel(ESP_BLE_SEC_ENCRYPT);
-
-                ScreenSecurityHandlerM5Buttons* securityHandler = new ScreenSecurityHandlerM5Buttons(this, displayPtr, screenWidth, screenHeight);
-                bleDevice.setSecurityCallbacks(securityHandler);
-
-                bleSecurity = new BLESecurity();
-                bleSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
-                bleSecurity->setCapability(ESP_IO_CAP_IN);
-                bleSecurity->setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
-
-                status = ConnectionStatus::Disconnected;
-
-                initialised = true;
+                // Created once and kept for the life of the program, initialise only runs once
+                static ScreenSecurityHandlerM5Buttons securityHandler(displayPtr, screenWidth, screenHeight);
+                initialiseBluetooth(&securityHandler);
             }
 
         #elif USING_M5GFX == 1
@@ -130,34 +103,34 @@ class BMDCameraConnection
                 if(initialised)
                     return;
 
-                appName = CODEAPPNAME;
-
-                bleDevice.init("MPC");
-                bleDevice.setPower(ESP_PWR_LVL_P9);
-                bleDevice.setEncryptionLevel(ESP_BLE_SEC_ENCRYPT);
-
-                ScreenSecurityHandler* securityHandler = new ScreenSecurityHandler(this, touchPtr, windowPtr, screenWidth, screenHeight);
-                bleDevice.setSecurityCallbacks(securityHandler);
-
-                bleSecurity = new BLESecurity();
-                bleSecurity->setAuthenticationMode(ESP_LE_AUTH_REQ_SC_BOND);
-                bleSecurity->setCapability(ESP_IO_CAP_IN);
-                bleSecurity->setRespEncryptionKey(ESP_BLE_ENC_KEY_MASK | ESP_BLE_ID_KEY_MASK);
-
-                status = ConnectionStatus::Disconnected;
-                // disconnect();
-
-                initialised = true;
+                // Created once and kept for the life of the program, initialise only runs once
+                static ScreenSecurityHandler securityHandler(touchPtr, windowPtr, screenWidth, screenHeight);
+                initialiseBluetooth(&securityHandler);
             }
 
         #endif
         
         bool scan();
+        bool reconnectDue(); // Call from loop(), true when it's time to scan for cameras again (see ReconnectScheduler), also picks up a bonded camera seen advertising
+        void cameraAdvertised(BLEAddress cameraAddress); // A camera advertisement was seen while scanning or listening, called from the Bluetooth task
         void connect(BLEAddress cameraAddress);
+        void connectInBackground(BLEAddress cameraAddress); // Connects from its own task so loop() keeps running, e.g. to enter the pass key
+        bool isConnecting() { return connectTaskHandle != nullptr; }
+        bool servicePassKey(); // Call from loop(), shows the pass key entry while the camera is waiting for one, true while it's showing
         void disconnect();
         void sendCommandToOutgoing(CCUPacketTypes::Command command, bool response = true); // Sends the command to the camera
         void sendBytesToOutgoing(std::vector<byte> data, bool response = true); // Primarily for testing, sends a byte array rather than a formulated and validated command
 
+        // Camera emulator soak test seam, runs the parts of connect() and disconnect() that allocate without a camera (see CameraEmulator::runConnectionSoak)
+        bool soakConnect(BLEAddress cameraAddress);
+        void soakDisconnect();
+        BLEClient* getClient() { return bleClient; } // The pooled client, nullptr until the first connection
+
+        // Link health
+        int getRssi(); // Signal strength of the connection to the camera, 0 if not connected
+        bool probeLink(); // Reads from the camera to check it's still there, blocks until it answers or the link drops
+        bool reconnect(); // Connects straight back to the last camera (if bonded) without scanning, in the background like connectInBackground()
+
         ConnectionStatus status;
         std::vector<BLEAddress> cameraAddresses;
 
@@ -165,18 +138,47 @@ class BMDCameraConnection
 
         static void clearBondedDevices(); // Clears BLE bonding so we will require pass key for the next connection
         static bool isCameraBonded(BLEAddress cameraAddress); // Have we got a bond to the camera address on the BLE device?
+        static const int kMaxBondedDevices = 15; // Bluedroid's default maximum number of bonded devices (CONFIG_BT_SMP_MAX_BONDS)
         unsigned long getInitialPayloadTime() { return initialPayloadTime; } // Have we received the initial payload of information from the camera?
 
+        // BLE Notification functions
+        // Public so the camera emulator can inject packets through the same path as the camera (pBLERemoteCharacteristic can be nullptr)
+        static void IncomingCameraControlNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
+        static void IncomingTimecodeNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
+        static void IncomingCameraStatusNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
+
     private:
+        void initialiseBluetooth(PassKeyEntry* entry); // Shared by the initialise functions, entry is the board's pass key entry
+        void applySecurity(); // Bonding with a pass key entered on this device
+        bool createClient(); // The client is created on the first connection and reused after that
+        static void gapEventHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+        static void connectTask(void* parameter);
+
         std::string appName;
+        PassKeyEntry* passKeyEntry = nullptr;
+        std::string connectAddress; // Camera the background connection is for
+        TaskHandle_t connectTaskHandle = nullptr;
         bool initialised = false;
         bool scanned = false;
         unsigned long initialPayloadTime = ULONG_MAX;
+        volatile unsigned long failedPassKeyTime = 0; // Set from the Bluetooth task when the camera rejects the pass key
+        static const unsigned long kFailedPassKeyShowTime = 2000; // How long FailedPassKey is kept before reconnectDue() resets it to Disconnected
+        std::string lastCameraAddress; // Last camera we connected to, for reconnecting without a scan
+        volatile bool listening = false; // Low duty scan between reconnect attempts, watching for bonded cameras
+        // Allocated once and reused for every connection, so long uptimes with many reconnects don't fragment the heap
+        BMDBLEClientCallback clientCallback{this};
+        BMDAdvertisedDeviceCallback advertisedDeviceCallback{this};
+
+        static void listenCallback(BLEScanResults scanResults);
+        void applyAdvertisedCamera(); // Acts on a camera recorded by cameraAdvertised, from loop() through reconnectDue()
+
+        bool advertisedCameraPending = false; // Both guarded by advertisedCameraLock
+        esp_bd_addr_t advertisedCameraAddress;
 
         BLEDevice bleDevice;
         BLEClient* bleClient;
         BLEScan* bleScan;
-        BLESecurity* bleSecurity;
+        BLESecurity bleSecurity;
         BLEAdvertisedDevice* bleAdvertisedDevice;
         BLERemoteService* bleRemoteService;
 
@@ -188,11 +190,6 @@ class BMDCameraConnection
         BLERemoteCharacteristic* bleChar_ProtocolVersion;
         BLERemoteCharacteristic* bleChar_CameraStatus;
 
-        // BLE Notification functions
-        static void IncomingCameraControlNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
-        static void IncomingTimecodeNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
-        static void IncomingCameraStatusNotify(BLERemoteCharacteristic *pBLERemoteCharacteristic, uint8_t *pData, size_t length, bool isNotify);
-
         // For accessing the connection object from a static function
         static BMDCameraConnection* instancePtr;
 };
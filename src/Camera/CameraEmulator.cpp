@@ -0,0 +1,540 @@
+#include "CameraEmulator.h"
+#include <esp_heap_caps.h>
+
+QueueHandle_t CameraEmulator::packetQueue = nullptr;
+TaskHandle_t CameraEmulator::producerHandle = nullptr;
+volatile bool CameraEmulator::running = false;
+CameraEmulator::LoadProfile CameraEmulator::currentProfile = CameraEmulator::LoadProfile::Timecode60fps;
+CameraEmulator::Stats CameraEmulator::stats;
+portMUX_TYPE CameraEmulator::statsLock = portMUX_INITIALIZER_UNLOCKED;
+
+unsigned long CameraEmulator::startTime = 0;
+unsigned long CameraEmulator::lastSeenModified = 0;
+unsigned long CameraEmulator::baseModifiedCount = 0;
+uint32_t CameraEmulator::frameCounter = 0;
+byte CameraEmulator::lensStormIndex = 0;
+bool CameraEmulator::transportRecording = false;
+
+bool CameraEmulator::cyclingProfiles = false;
+unsigned long CameraEmulator::cycleProfileDurationMs = 0;
+
+const char* CameraEmulator::getProfileName(LoadProfile profile)
+{
+    switch(profile)
+    {
+        case LoadProfile::Timecode60fps:
+            return "Timecode 60fps";
+        case LoadProfile::Battery500ms:
+            return "Battery 500ms";
+        case LoadProfile::LensMetadataStorm:
+            return "Lens Metadata Storm";
+        case LoadProfile::TransportToggle:
+            return "Transport Toggle";
+        case LoadProfile::BackToBack64Byte:
+            return "Back-to-back 64 byte";
+        case LoadProfile::Combined:
+            return "Combined";
+        default:
+            return "Unknown";
+    }
+}
+
+CameraEmulator::ProfileSpec CameraEmulator::getProfileSpec(LoadProfile profile)
+{
+    // Timecode, Battery, Lens Storm, Transport, Back-to-back packets per tick
+    switch(profile)
+    {
+        case LoadProfile::Timecode60fps:
+            return { 16667, 0, 0, 0, 0 };
+        case LoadProfile::Battery500ms:
+            return { 0, 500000, 0, 0, 0 };
+        case LoadProfile::LensMetadataStorm:
+            return { 0, 0, 2000, 0, 0 };
+        case LoadProfile::TransportToggle:
+            return { 0, 0, 0, 50000, 0 };
+        case LoadProfile::BackToBack64Byte:
+            return { 0, 0, 0, 0, kQueueCapacity };
+        case LoadProfile::Combined:
+        default:
+            return { 16667, 500000, 2000, 50000, 0 };
+    }
+}
+
+void CameraEmulator::begin(LoadProfile profile)
+{
+    if(running)
+        end();
+
+    currentProfile = profile;
+
+    portENTER_CRITICAL(&statsLock);
+    stats = Stats();
+    portEXIT_CRITICAL(&statsLock);
+    frameCounter = 0;
+    lensStormIndex = 0;
+    transportRecording = false;
+
+    if(packetQueue == nullptr)
+        packetQueue = xQueueCreate(kQueueCapacity, sizeof(EmulatedPacket));
+
+    // A fresh simulated camera for each run
+    BMDControlSystem::getInstance()->activateCamera();
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    baseModifiedCount = camera->getModifiedCount();
+    lastSeenModified = camera->getLastModified();
+
+    // The camera reports it is ready, as a real camera does once connected
+    enqueueCameraReady();
+
+    DEBUG_INFO("CameraEmulator: Starting load profile '%s'", getProfileName(profile));
+
+    startTime = millis();
+    running = true;
+
+    // Producer runs at a higher priority than loop() like the BLE host task
+    xTaskCreate(producerTask, "CamEmulator", 4096, nullptr, 5, &producerHandle);
+}
+
+void CameraEmulator::end()
+{
+    if(!running)
+        return;
+
+    running = false;
+
+    // Wait for the producer to finish its current tick and delete itself
+    while(producerHandle != nullptr)
+        vTaskDelay(1);
+
+    // Decode anything left over so the stats include it
+    service();
+
+    portENTER_CRITICAL(&statsLock);
+    stats.durationMs = millis() - startTime;
+    portEXIT_CRITICAL(&statsLock);
+
+    xQueueReset(packetQueue);
+
+    BMDControlSystem::getInstance()->deactivateCamera();
+}
+
+void CameraEmulator::runAllProfiles(unsigned long profileDurationMs)
+{
+    cyclingProfiles = true;
+    cycleProfileDurationMs = profileDurationMs;
+
+    begin(static_cast<LoadProfile>(0));
+}
+
+// One connection. With a camera address it's a real connect() and disconnect() over the radio, without one the connection's soak seam runs
+// the same pooled client, security, bond list and client callbacks and the emulator sends the initial payload a camera would.
+bool CameraEmulator::soakCycle(BMDCameraConnection* connection, const char* cameraAddress)
+{
+    if(cameraAddress != nullptr)
+    {
+        BLEAddress address(cameraAddress);
+
+        connection->cameraAddresses.clear();
+        connection->cameraAddresses.push_back(address);
+        connection->connect(address);
+
+        bool connected = connection->status == BMDCameraConnection::ConnectionStatus::Connected;
+
+        connection->disconnect();
+
+        // Let Bluedroid finish closing the link (and the client's disconnect callback run) before the next connect
+        unsigned long waitStart = millis();
+        while(connection->getClient() != nullptr && connection->getClient()->isConnected() && millis() - waitStart < kSoakDisconnectWaitMs)
+            vTaskDelay(10);
+
+        return connected;
+    }
+
+    // Not bonded, so the seam finds it the way a scan does
+    if(!connection->soakConnect(BLEAddress("90:fd:9f:00:00:00")))
+        return false;
+
+    BMDControlSystem::getInstance()->activateCamera();
+
+    // Initial payload like a camera sends on connection
+    enqueueCameraReady();
+    enqueueTimecode();
+    enqueueBattery();
+    for(int count = 0; count < 4; count++)
+        enqueueLensMetadata();
+    enqueueTransportToggle();
+
+    service();
+
+    connection->soakDisconnect();
+
+    return connection->status == BMDCameraConnection::ConnectionStatus::Disconnected && !BMDControlSystem::getInstance()->hasCamera();
+}
+
+CameraEmulator::SoakCounts CameraEmulator::soakCounts(BMDCameraConnection* connection)
+{
+    SoakCounts counts;
+    counts.freeHeap = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    counts.largestBlock = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    counts.tasks = uxTaskGetNumberOfTasks();
+    counts.bonds = esp_ble_get_bond_device_num();
+    counts.peers = BLEDevice::getPeerDevices(true).size();
+    counts.client = connection->getClient();
+
+    return counts;
+}
+
+bool CameraEmulator::runConnectionSoak(BMDCameraConnection* connection, unsigned long cycles, const char* cameraAddress)
+{
+    if(running)
+        end();
+
+    if(packetQueue == nullptr)
+        packetQueue = xQueueCreate(kQueueCapacity, sizeof(EmulatedPacket));
+
+    // Bluetooth is needed for the client and the bond list
+    connection->initialise();
+
+    portENTER_CRITICAL(&statsLock);
+    stats = Stats();
+    portEXIT_CRITICAL(&statsLock);
+
+    currentProfile = LoadProfile::Combined;
+
+    DEBUG_INFO("CameraEmulator: Connection soak, %lu cycles %s %s", cycles, cameraAddress != nullptr ? "connecting to camera" : "through the connection's soak seam", cameraAddress != nullptr ? cameraAddress : "");
+
+    for(unsigned long cycle = 0; cycle < kSoakWarmupCycles; cycle++)
+    {
+        if(!soakCycle(connection, cameraAddress))
+        {
+            DEBUG_ERROR("CameraEmulator: Connection soak FAILED, warm up cycle %lu didn't connect and disconnect", cycle + 1);
+            return false;
+        }
+    }
+
+    SoakCounts start = soakCounts(connection);
+    size_t minimumFree = start.freeHeap;
+    size_t minimumLargest = start.largestBlock;
+
+    unsigned long startMillis = millis();
+
+    for(unsigned long cycle = 1; cycle <= cycles; cycle++)
+    {
+        bool cycleCompleted = soakCycle(connection, cameraAddress);
+
+        SoakCounts now = soakCounts(connection);
+        minimumFree = std::min(minimumFree, now.freeHeap);
+        minimumLargest = std::min(minimumLargest, now.largestBlock);
+
+        // Checked every cycle so a failure points at the cycle it started on
+        const char* failure = nullptr;
+        if(!cycleCompleted)
+            failure = "didn't connect and disconnect";
+        else if(now.freeHeap + kSoakHeapTolerance < start.freeHeap)
+            failure = "free heap is shrinking (leak)";
+        else if(now.largestBlock + kSoakHeapTolerance < start.largestBlock)
+            failure = "largest free block is shrinking (fragmentation)";
+        else if(now.tasks != start.tasks)
+            failure = "task count changed (a connection task wasn't deleted)";
+        else if(now.client != start.client)
+            failure = "the client was recreated rather than reused";
+        else if(now.peers != 0)
+            failure = "a peer device was left registered after disconnecting";
+        else if(now.bonds != start.bonds)
+            failure = "bond count changed";
+
+        if(failure != nullptr)
+        {
+            DEBUG_ERROR("CameraEmulator: Connection soak FAILED on cycle %lu, %s", cycle, failure);
+            DEBUG_ERROR("  Free heap %u -> %u, largest free block %u -> %u, tasks %u -> %u, peers %u, bonds %i -> %i", start.freeHeap, now.freeHeap, start.largestBlock, now.largestBlock, start.tasks, now.tasks, now.peers, start.bonds, now.bonds);
+            return false;
+        }
+
+        if(cycle % (cycles / 10 + 1) == 0)
+            DEBUG_INFO("  Cycle %lu, free heap %u, largest free block %u", cycle, now.freeHeap, now.largestBlock);
+
+        // Let the idle task run (and the watchdog be fed)
+        if(cycle % 50 == 0)
+            vTaskDelay(1);
+    }
+
+    SoakCounts end = soakCounts(connection);
+
+    DEBUG_INFO("CameraEmulator: Connection soak of %lu cycles took %lums, %lu packets decoded", cycles, millis() - startMillis, getStats().packetsDecoded);
+    DEBUG_INFO("  Free heap %u -> %u (lowest %u), largest free block %u -> %u (lowest %u)", start.freeHeap, end.freeHeap, minimumFree, start.largestBlock, end.largestBlock, minimumLargest);
+    DEBUG_INFO("CameraEmulator: Connection soak PASSED");
+
+    return true;
+}
+
+void CameraEmulator::service()
+{
+    if(packetQueue == nullptr || !BMDControlSystem::getInstance()->hasCamera())
+        return;
+
+    EmulatedPacket packet;
+    while(xQueueReceive(packetQueue, &packet, 0) == pdTRUE)
+    {
+        unsigned long decodeStart = micros();
+        bool decodeError = false;
+
+        try
+        {
+            switch(packet.channel)
+            {
+                case Channel::CameraControl:
+                    BMDCameraConnection::IncomingCameraControlNotify(nullptr, packet.data, packet.length, true);
+                    break;
+                case Channel::Timecode:
+                    BMDCameraConnection::IncomingTimecodeNotify(nullptr, packet.data, packet.length, true);
+                    break;
+                case Channel::CameraStatus:
+                    BMDCameraConnection::IncomingCameraStatusNotify(nullptr, packet.data, packet.length, true);
+                    break;
+            }
+        }
+        catch(...)
+        {
+            decodeError = true;
+        }
+
+        unsigned long decodeMicros = micros() - decodeStart;
+
+        portENTER_CRITICAL(&statsLock);
+        stats.decodeErrors += decodeError ? 1 : 0;
+        stats.packetsDecoded++;
+        stats.decodeMicrosTotal += decodeMicros;
+        if(decodeMicros > stats.decodeMicrosMax)
+            stats.decodeMicrosMax = decodeMicros;
+        portEXIT_CRITICAL(&statsLock);
+    }
+
+    // A screen refreshes whenever the camera's last modified time changes between loop passes
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    bool redrawn = camera->getLastModified() != lastSeenModified;
+    lastSeenModified = camera->getLastModified();
+
+    portENTER_CRITICAL(&statsLock);
+    stats.redraws += redrawn ? 1 : 0;
+    stats.modelModifications = camera->getModifiedCount() - baseModifiedCount;
+    portEXIT_CRITICAL(&statsLock);
+
+    // Move on to the next profile when cycling through them all
+    if(cyclingProfiles && running && millis() - startTime >= cycleProfileDurationMs)
+    {
+        end();
+        reportStats();
+
+        byte nextProfile = static_cast<byte>(currentProfile) + 1;
+        if(nextProfile < kLoadProfileCount)
+            begin(static_cast<LoadProfile>(nextProfile));
+        else
+        {
+            cyclingProfiles = false;
+            DEBUG_INFO("CameraEmulator: All load profiles complete");
+        }
+    }
+}
+
+CameraEmulator::Stats CameraEmulator::getStats()
+{
+    portENTER_CRITICAL(&statsLock);
+    Stats snapshot = stats;
+    portEXIT_CRITICAL(&statsLock);
+
+    return snapshot;
+}
+
+void CameraEmulator::reportStats()
+{
+    // A copy so the producer task's counts don't change part way through
+    Stats snapshot = getStats();
+
+    unsigned long durationMs = running ? millis() - startTime : snapshot.durationMs;
+    if(durationMs == 0)
+        durationMs = 1;
+
+    unsigned long averageDecodeMicros = snapshot.packetsDecoded != 0 ? snapshot.decodeMicrosTotal / snapshot.packetsDecoded : 0;
+    unsigned long decodeThroughput = snapshot.decodeMicrosTotal != 0 ? (snapshot.packetsDecoded * 1000000UL) / snapshot.decodeMicrosTotal : 0;
+    float decodeCPUPercent = (snapshot.decodeMicrosTotal / 10.0f) / durationMs;
+
+    DEBUG_INFO("CameraEmulator: '%s' over %lums", getProfileName(currentProfile), durationMs);
+    DEBUG_INFO("  Packets generated %lu, decoded %lu, dropped %lu, decode errors %lu", snapshot.packetsGenerated, snapshot.packetsDecoded, snapshot.packetsDropped, snapshot.decodeErrors);
+    DEBUG_INFO("  Queue high-water mark %u of %i", snapshot.queueHighWater, kQueueCapacity);
+    DEBUG_INFO("  Decode average %luus, max %luus, throughput %lu packets/s, %.1f%% of loop time", averageDecodeMicros, snapshot.decodeMicrosMax, decodeThroughput, decodeCPUPercent);
+    DEBUG_INFO("  Camera modifications %lu, redraws %lu (%lu per second)", snapshot.modelModifications, snapshot.redraws, (snapshot.redraws * 1000UL) / durationMs);
+}
+
+void CameraEmulator::producerTask(void* parameter)
+{
+    ProfileSpec spec = getProfileSpec(currentProfile);
+
+    unsigned long lastTimecode = micros();
+    unsigned long lastBattery = lastTimecode;
+    unsigned long lastLensStorm = lastTimecode;
+    unsigned long lastTransport = lastTimecode;
+
+    TickType_t lastWakeTime = xTaskGetTickCount();
+
+    while(running)
+    {
+        unsigned long now = micros();
+
+        if(spec.timecodeIntervalUs != 0 && now - lastTimecode >= spec.timecodeIntervalUs)
+        {
+            enqueueTimecode();
+            lastTimecode += spec.timecodeIntervalUs;
+        }
+
+        if(spec.batteryIntervalUs != 0 && now - lastBattery >= spec.batteryIntervalUs)
+        {
+            enqueueBattery();
+            lastBattery += spec.batteryIntervalUs;
+        }
+
+        if(spec.lensStormIntervalUs != 0 && now - lastLensStorm >= spec.lensStormIntervalUs)
+        {
+            enqueueLensMetadata();
+            lastLensStorm += spec.lensStormIntervalUs;
+        }
+
+        if(spec.transportIntervalUs != 0 && now - lastTransport >= spec.transportIntervalUs)
+        {
+            enqueueTransportToggle();
+            lastTransport += spec.transportIntervalUs;
+        }
+
+        for(int count = 0; count < spec.backToBackPerTick; count++)
+            enqueueMaximumSizePacket();
+
+        vTaskDelayUntil(&lastWakeTime, 1);
+    }
+
+    producerHandle = nullptr;
+    vTaskDelete(nullptr);
+}
+
+bool CameraEmulator::enqueue(Channel channel, const std::vector<byte>& data)
+{
+    EmulatedPacket packet;
+    packet.channel = channel;
+    packet.length = static_cast<byte>(std::min(data.size(), sizeof(packet.data)));
+    memcpy(packet.data, data.data(), packet.length);
+
+    bool sent = xQueueSend(packetQueue, &packet, 0) == pdTRUE;
+    unsigned int waiting = uxQueueMessagesWaiting(packetQueue);
+
+    portENTER_CRITICAL(&statsLock);
+    stats.packetsGenerated++;
+    if(!sent)
+        stats.packetsDropped++;
+    else if(waiting > stats.queueHighWater)
+        stats.queueHighWater = waiting;
+    portEXIT_CRITICAL(&statsLock);
+
+    return sent;
+}
+
+void CameraEmulator::enqueueCommand(CCUPacketTypes::Category category, byte parameter, CCUPacketTypes::DataTypes dataType, const std::vector<byte>& payload)
+{
+    CCUPacketTypes::Command command(CCUPacketTypes::kBroadcastTarget, CCUPacketTypes::CommandID::ChangeConfiguration, category, parameter, CCUPacketTypes::OperationType::AssignValue, static_cast<byte>(dataType), payload);
+    enqueue(Channel::CameraControl, command.serialize());
+}
+
+// Timecode notifications are 12 bytes with the BCD timecode in the last 4 (hours in the most significant byte)
+void CameraEmulator::enqueueTimecode()
+{
+    uint32_t frames = frameCounter % 60;
+    uint32_t seconds = (frameCounter / 60) % 60;
+    uint32_t minutes = (frameCounter / 3600) % 60;
+    uint32_t hours = (frameCounter / 216000) % 24;
+
+    auto toBCD = [](uint32_t value) { return static_cast<byte>(((value / 10) << 4) | (value % 10)); };
+
+    std::vector<byte> data(12, 0);
+    data[8] = toBCD(frames);
+    data[9] = toBCD(seconds);
+    data[10] = toBCD(minutes);
+    data[11] = toBCD(hours);
+
+    enqueue(Channel::Timecode, data);
+
+    frameCounter++;
+}
+
+void CameraEmulator::enqueueBattery()
+{
+    // Battery level, unknown (typically 100), flags
+    short batteryLevelX1000 = 1000 - static_cast<short>(frameCounter % 1000);
+    short flags = static_cast<short>(CCUPacketTypes::BatteryStatus::BatteryPresent);
+    short values[3] = { batteryLevelX1000, 100, flags };
+
+    enqueueCommand(CCUPacketTypes::Category::Status, static_cast<byte>(CCUPacketTypes::StatusParameter::Battery), CCUPacketTypes::DataTypes::kInt16, CCUUtility::ToByteArrayFromArray(values, 3));
+}
+
+// A lens change sends a burst of metadata strings, we rotate through them
+void CameraEmulator::enqueueLensMetadata()
+{
+    static const char* lensTypes[] = { "Canon EF-S 18-55mm f/3.5-5.6 IS II", "Canon EF 50mm f/1.2L USM" };
+    static const char* lensIrises[] = { "f3.5", "f5.6", "f1.2", "f2.8" };
+    static const char* lensFocalLengths[] = { "18mm", "35mm", "50mm", "55mm" };
+    static const char* lensDistances[] = { "460mm to 590mm", "1000mm to 1400mm", "Infinity" };
+
+    std::string value;
+    CCUPacketTypes::MetadataParameter parameter;
+
+    switch(lensStormIndex % 4)
+    {
+        case 0:
+            parameter = CCUPacketTypes::MetadataParameter::LensType;
+            value = lensTypes[(lensStormIndex / 4) % 2];
+            break;
+        case 1:
+            parameter = CCUPacketTypes::MetadataParameter::LensIris;
+            value = lensIrises[(lensStormIndex / 4) % 4];
+            break;
+        case 2:
+            parameter = CCUPacketTypes::MetadataParameter::LensFocalLength;
+            value = lensFocalLengths[(lensStormIndex / 4) % 4];
+            break;
+        default:
+            parameter = CCUPacketTypes::MetadataParameter::LensDistance;
+            value = lensDistances[(lensStormIndex / 4) % 3];
+            break;
+    }
+
+    lensStormIndex++;
+
+    enqueueCommand(CCUPacketTypes::Category::Metadata, static_cast<byte>(parameter), CCUPacketTypes::DataTypes::kString, std::vector<byte>(value.begin(), value.end()));
+}
+
+void CameraEmulator::enqueueTransportToggle()
+{
+    transportRecording = !transportRecording;
+
+    // Mode, speed, flags (disk 1 active), slot 1 medium
+    std::vector<byte> payload = {
+        static_cast<byte>(transportRecording ? CCUPacketTypes::MediaTransportMode::Record : CCUPacketTypes::MediaTransportMode::Preview),
+        0,
+        static_cast<byte>(CCUPacketTypes::MediaTransportFlag::Disk1Active),
+        static_cast<byte>(CCUPacketTypes::ActiveStorageMedium::SDCard)
+    };
+
+    enqueueCommand(CCUPacketTypes::Category::Media, static_cast<byte>(CCUPacketTypes::MediaParameter::TransportMode), CCUPacketTypes::DataTypes::kInt8, payload);
+}
+
+// Largest packet possible, a 56 character metadata string gives a 64 byte packet
+void CameraEmulator::enqueueMaximumSizePacket()
+{
+    const int payloadSize = CCUPacketTypes::kPacketSizeMax - CCUPacketTypes::kCCUPacketHeaderSize - CCUPacketTypes::kCCUCommandHeaderSize;
+
+    std::vector<byte> payload(payloadSize, 'A' + (frameCounter++ % 26));
+
+    enqueueCommand(CCUPacketTypes::Category::Metadata, static_cast<byte>(CCUPacketTypes::MetadataParameter::Director), CCUPacketTypes::DataTypes::kString, payload);
+}
+
+void CameraEmulator::enqueueCameraReady()
+{
+    std::vector<byte> data = { static_cast<byte>(CameraStatus::Flags::CameraPowerFlag | CameraStatus::Flags::CameraReadyFlag) };
+    enqueue(Channel::CameraStatus, data);
+}
@@ -0,0 +1,143 @@
+#ifndef CAMERAEMULATOR_H
+#define CAMERAEMULATOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#include "Arduino_DebugUtils.h"
+#include "Camera/ConstantsTypes.h"
+#include "Camera/BMDCameraConnection.h"
+#include "CCU/CCUPacketTypes.h"
+#include "BMDControlSystem.h"
+
+// Simulated camera that generates the traffic a real camera sends over BLE, used to stress-test decoding and rendering without a camera.
+// A producer task generates packets at the rate set by the load profile and puts them on a bounded queue (like the BLE notification backlog),
+// service() is called from loop() and drains the queue through the same notify functions as the BLE connection.
+class CameraEmulator
+{
+    public:
+        enum class LoadProfile : byte
+        {
+            Timecode60fps = 0,      // Timecode notifications at 60 frames per second
+            Battery500ms = 1,       // Battery status every 500ms
+            LensMetadataStorm = 2,  // Lens metadata strings (lens type, iris, focal length, distance) as fast as a lens change sends them
+            TransportToggle = 3,    // Record/Preview toggling every 50ms
+            BackToBack64Byte = 4,   // Worst case, maximum size (64 byte) packets filling the queue every tick
+            Combined = 5            // Timecode, battery, lens storm and transport together
+        };
+        static const byte kLoadProfileCount = 6;
+
+        // Channels match the BLE characteristics the packets would come in on
+        enum class Channel : byte
+        {
+            CameraControl = 0,
+            Timecode = 1,
+            CameraStatus = 2
+        };
+
+        struct Stats
+        {
+            unsigned long durationMs = 0;
+            unsigned long packetsGenerated = 0;
+            unsigned long packetsDecoded = 0;
+            unsigned long packetsDropped = 0;   // Queue was full when the producer had a packet ready
+            unsigned long decodeErrors = 0;
+            unsigned int queueHighWater = 0;    // Most packets waiting in the queue at once
+            unsigned long decodeMicrosTotal = 0;
+            unsigned long decodeMicrosMax = 0;
+            unsigned long modelModifications = 0; // BMDCamera state changes
+            unsigned long redraws = 0;            // Loop passes where a screen would have refreshed (camera's last modified changed)
+        };
+
+        static const int kQueueCapacity = 32;
+
+        static void begin(LoadProfile profile);
+        static void end();
+        static bool isRunning() { return running; }
+
+        // Call from loop(), decodes all queued packets and counts redraws
+        static void service();
+
+        // Cycles through every load profile for profileDurationMs each, reporting the stats of each
+        static void runAllProfiles(unsigned long profileDurationMs);
+
+        // Soak test of the connect/disconnect lifecycle. Given a bonded camera's address each cycle is a real connect() and disconnect(),
+        // without one it runs through the connection's soak seam (pooled client, security, bond list, client callbacks) and decodes an
+        // initial payload. The heap, task, peer and bond counts and the client are checked after every cycle, it stops and logs an error on
+        // the first cycle that leaks or fails. Blocks until done, returns true if it passed.
+        static bool runConnectionSoak(BMDCameraConnection* connection, unsigned long cycles, const char* cameraAddress = nullptr);
+
+        static LoadProfile getProfile() { return currentProfile; }
+        static const char* getProfileName(LoadProfile profile);
+        static Stats getStats();
+        static void reportStats();
+
+    private:
+        struct EmulatedPacket
+        {
+            Channel channel;
+            byte length;
+            byte data[CCUPacketTypes::kPacketSizeMax];
+        };
+
+        // Intervals in microseconds, 0 = not sent in this profile
+        struct ProfileSpec
+        {
+            unsigned long timecodeIntervalUs;
+            unsigned long batteryIntervalUs;
+            unsigned long lensStormIntervalUs;
+            unsigned long transportIntervalUs;
+            int backToBackPerTick;
+        };
+
+        static void producerTask(void* parameter);
+        static ProfileSpec getProfileSpec(LoadProfile profile);
+
+        static bool enqueue(Channel channel, const std::vector<byte>& data);
+        static void enqueueCommand(CCUPacketTypes::Category category, byte parameter, CCUPacketTypes::DataTypes dataType, const std::vector<byte>& payload);
+        static void enqueueTimecode();
+        static void enqueueBattery();
+        static void enqueueLensMetadata();
+        static void enqueueTransportToggle();
+        static void enqueueMaximumSizePacket();
+        static void enqueueCameraReady();
+
+        // What's checked after each soak cycle
+        struct SoakCounts
+        {
+            size_t freeHeap = 0;
+            size_t largestBlock = 0;
+            UBaseType_t tasks = 0;
+            int bonds = 0;
+            size_t peers = 0;           // Client connections BLEDevice still knows about
+            const BLEClient* client = nullptr;
+        };
+
+        static bool soakCycle(BMDCameraConnection* connection, const char* cameraAddress);
+        static SoakCounts soakCounts(BMDCameraConnection* connection);
+
+        static const unsigned long kSoakWarmupCycles = 20; // Let one-off allocations (queue, camera object pools, the client) settle before measuring
+        static const size_t kSoakHeapTolerance = 1024;     // Bytes of drift allowed (timing of the Bluetooth and idle tasks' allocations)
+        static const unsigned long kSoakDisconnectWaitMs = 2000;
+
+        static QueueHandle_t packetQueue;
+        static TaskHandle_t producerHandle;
+        static volatile bool running;
+        static LoadProfile currentProfile;
+        static Stats stats;                     // Counted by the producer task and loop(), changed and read under statsLock
+        static portMUX_TYPE statsLock;
+
+        static unsigned long startTime;
+        static unsigned long lastSeenModified;
+        static unsigned long baseModifiedCount;
+        static uint32_t frameCounter;
+        static byte lensStormIndex;
+        static bool transportRecording;
+
+        // Cycling through all profiles
+        static bool cyclingProfiles;
+        static unsigned long cycleProfileDurationMs;
+};
+
+#endif
@@ -0,0 +1,122 @@
+#include "CommandCoalescer.h"
+#include "PacketWriter.h"
+
+BMDCameraConnection* CommandCoalescer::connection = nullptr;
+CommandCoalescer::Slot CommandCoalescer::slots[kParameterCount];
+
+unsigned long CommandCoalescer::writes = 0;
+unsigned long CommandCoalescer::coalesced = 0;
+unsigned long CommandCoalescer::averageLatencyMicros = 0;
+unsigned long CommandCoalescer::maxLatencyMicros = 0;
+
+void CommandCoalescer::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+}
+
+void CommandCoalescer::set(Parameter parameter, int value, int value2, unsigned long sampleMicros)
+{
+    Slot& slot = slots[static_cast<byte>(parameter)];
+
+    if(slot.pending)
+        coalesced++;
+    else
+        slot.sampleMicros = sampleMicros;
+
+    slot.value = value;
+    slot.value2 = value2;
+    slot.pending = true;
+}
+
+void CommandCoalescer::add(Parameter parameter, int offset, unsigned long sampleMicros)
+{
+    Slot& slot = slots[static_cast<byte>(parameter)];
+
+    if(slot.pending)
+    {
+        slot.value += offset;
+        coalesced++;
+    }
+    else
+    {
+        slot.value = offset;
+        slot.sampleMicros = sampleMicros;
+    }
+
+    slot.pending = true;
+}
+
+void CommandCoalescer::service()
+{
+    unsigned long now = millis();
+
+    for(byte index = 0; index < kParameterCount; index++)
+    {
+        if(slots[index].pending && now - slots[index].lastWrite >= kMinIntervalMs)
+            write(static_cast<Parameter>(index), false);
+    }
+}
+
+void CommandCoalescer::flush(Parameter parameter)
+{
+    Slot& slot = slots[static_cast<byte>(parameter)];
+
+    if(slot.pending)
+        write(parameter, true);
+    else if(slot.unconfirmed)
+    {
+        // service() sent the last value without a response, so it's sent again with one. Offsets add up, so that's a zero offset rather
+        // than moving the focus twice.
+        if(parameter == Parameter::FocusOffset)
+            slot.value = 0;
+
+        write(parameter, true, true);
+    }
+}
+
+void CommandCoalescer::write(Parameter parameter, bool response, bool resend)
+{
+    Slot& slot = slots[static_cast<byte>(parameter)];
+    slot.pending = false;
+    slot.lastWrite = millis();
+
+    if(connection == nullptr)
+        return;
+
+    switch(parameter)
+    {
+        case Parameter::WhiteBalanceTint:
+            PacketWriter::writeWhiteBalance(slot.value, slot.value2, connection, response);
+            break;
+        case Parameter::FocusOffset:
+            // One with a response is still written, it's what confirms the focus has stopped where it is
+            if(slot.value == 0 && !response)
+                return;
+            PacketWriter::writeFocusPositionWithOffset(slot.value, connection, response);
+            break;
+        case Parameter::FocusPosition:
+            PacketWriter::writeFocusPositionWithActual(slot.value, connection, response);
+            break;
+        default:
+            return;
+    }
+
+    slot.unconfirmed = !response;
+
+    // Nothing new was touched for a resend
+    if(resend)
+        return;
+
+    // Touch report to the write leaving, averaged over the last several
+    unsigned long latency = micros() - slot.sampleMicros;
+    averageLatencyMicros = writes == 0 ? latency : (averageLatencyMicros * 7 + latency) / 8;
+    if(latency > maxLatencyMicros)
+        maxLatencyMicros = latency;
+
+    writes++;
+}
+
+void CommandCoalescer::reportStats()
+{
+    DEBUG_INFO("CommandCoalescer: %lu writes, %lu values coalesced, touch to write %lu us average, %lu us max", writes, coalesced, averageLatencyMicros, maxLatencyMicros);
+}
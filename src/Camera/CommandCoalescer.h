@@ -0,0 +1,68 @@
+#ifndef COMMANDCOALESCER_H
+#define COMMANDCOALESCER_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+
+// Sends the values from continuous controls (dragging a slider) without flooding the camera.
+// A drag (or a spinning encoder) produces a new value on every touch report, far more often than the camera can act on them. Each parameter keeps only its
+// latest value and it's written at most every kMinIntervalMs (without waiting for a response), offsets add up until they're written.
+// The last value is written (or written again, if service() already sent it) with a response when the finger lifts. Latency is timed from the touch report behind a value to its write.
+class CommandCoalescer
+{
+    public:
+        enum class Parameter : byte
+        {
+            WhiteBalanceTint = 0,   // Kelvin and tint
+            FocusOffset,            // Focus moved relative to where it is, 0 to 65435 is the lens' full range
+            FocusPosition,          // Focus moved to a position, 0 to 65435
+            Count
+        };
+
+        static void begin(BMDCameraConnection* inConnection);
+
+        // Latest absolute value(s), replaces any not yet written
+        static void set(Parameter parameter, int value, int value2, unsigned long sampleMicros);
+
+        // Relative value, added to any not yet written
+        static void add(Parameter parameter, int offset, unsigned long sampleMicros);
+
+        // Call from loop(), writes the values that are due
+        static void service();
+
+        // Writes the parameter's value now, e.g. the finger has lifted
+        static void flush(Parameter parameter);
+
+        static bool isPending(Parameter parameter) { return slots[static_cast<byte>(parameter)].pending; }
+
+        static unsigned long getAverageLatencyMicros() { return averageLatencyMicros; }
+        static unsigned long getMaxLatencyMicros() { return maxLatencyMicros; }
+        static void reportStats();
+
+    private:
+        static const unsigned long kMinIntervalMs = 50;
+        static const byte kParameterCount = static_cast<byte>(Parameter::Count);
+
+        struct Slot
+        {
+            bool pending = false;
+            int value = 0;
+            int value2 = 0;
+            unsigned long sampleMicros = 0;   // Oldest report behind the value, it's been waiting since then
+            unsigned long lastWrite = 0;
+            bool unconfirmed = false;         // Last value was written without a response
+        };
+
+        static void write(Parameter parameter, bool response, bool resend = false);
+
+        static BMDCameraConnection* connection;
+        static Slot slots[kParameterCount];
+
+        static unsigned long writes;
+        static unsigned long coalesced;         // Values replaced (or added to) before they were written
+        static unsigned long averageLatencyMicros;
+        static unsigned long maxLatencyMicros;
+};
+
+#endif
@@ -0,0 +1,263 @@
+#include "ExposureEngine.h"
+#include "PacketWriter.h"
+
+BMDCameraConnection* ExposureEngine::connection = nullptr;
+bool ExposureEngine::running = false;
+bool ExposureEngine::ended = false;
+ExposureEngine::Parameter ExposureEngine::stepParameter = ExposureEngine::Parameter::Iris;
+ExposureEngine::Exposure ExposureEngine::startExposure;
+ExposureEngine::Exposure ExposureEngine::lastSent;
+int32_t ExposureEngine::steps[kMaxSteps];
+byte ExposureEngine::stepCount = 0;
+byte ExposureEngine::nextStep = 0;
+unsigned long ExposureEngine::startMillis = 0;
+unsigned long ExposureEngine::durationMs = 0;
+
+unsigned long ExposureEngine::transitions = 0;
+unsigned long ExposureEngine::stepsSent = 0;
+unsigned long ExposureEngine::writes = 0;
+unsigned long ExposureEngine::lateSteps = 0;
+float ExposureEngine::maxErrorStops = 0;
+
+void ExposureEngine::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+}
+
+bool ExposureEngine::fromCamera(Exposure& exposure)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera())
+        return false;
+
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    if(!camera->hasSensorGainISOValue())
+        return false;
+
+    exposure.iso = camera->getSensorGainISOValue();
+    exposure.shutterIsAngle = camera->shutterValueIsAngle;
+
+    if(exposure.shutterIsAngle ? !camera->hasShutterAngle() : !camera->hasShutterSpeed())
+        return false;
+
+    exposure.shutter = exposure.shutterIsAngle ? camera->getShutterAngle() : camera->getShutterSpeed();
+
+    // The camera keeps the aperture as the text shown, e.g. "f2.8"
+    exposure.hasAperture = false;
+    if(camera->hasApertureFStopString())
+    {
+        std::string text = camera->getApertureFStopString();
+        float fStop = text.size() > 1 ? atof(text.c_str() + 1) : 0.0f;
+
+        if(fStop > 0.0f)
+        {
+            exposure.aperture = CCUEncodingFunctions::ConvertFStopToCCUAperture(fStop);
+            exposure.hasAperture = true;
+        }
+    }
+
+    return exposure.iso > 0 && exposure.shutter > 0;
+}
+
+bool ExposureEngine::transition(Parameter parameter, int32_t value, unsigned long inDurationMs)
+{
+    Exposure current;
+    if(!fromCamera(current))
+    {
+        DEBUG_ERROR("ExposureEngine: The camera's exposure isn't known yet");
+        return false;
+    }
+
+    if(parameter == Parameter::Iris && !current.hasAperture)
+    {
+        DEBUG_ERROR("ExposureEngine: The lens isn't reporting its aperture");
+        return false;
+    }
+
+    cancel();
+    ended = false;
+
+    // Through each table value on the way, in the order they're reached
+    int32_t from = ExposureMath::getValue(parameter, current);
+    stepCount = 0;
+    if(inDurationMs > 0)
+    {
+        byte count = ExposureMath::getTableCount(parameter, current.shutterIsAngle);
+        for(byte index = 0; index < count && stepCount < kMaxSteps - 1; index++)
+        {
+            int32_t option = ExposureMath::getTableValue(parameter, current.shutterIsAngle, value > from ? index : count - 1 - index);
+            if((option > from && option < value) || (option < from && option > value))
+                steps[stepCount++] = option;
+        }
+    }
+
+    steps[stepCount++] = value;
+
+    stepParameter = parameter;
+    startExposure = current;
+    lastSent = current;
+    nextStep = 0;
+    startMillis = millis();
+    durationMs = inDurationMs;
+    running = true;
+    transitions++;
+
+    DEBUG_INFO("ExposureEngine: %s from %li to %li over %lu ms in %u steps, starting at %.2f stops", getParameterName(parameter), static_cast<long>(from), static_cast<long>(value), durationMs, stepCount, ExposureMath::stops(current));
+
+    // Without a duration it's sent now
+    service();
+
+    return true;
+}
+
+bool ExposureEngine::transitionTo(Parameter parameter, float value, unsigned long inDurationMs)
+{
+    if(value <= 0.0f)
+        return false;
+
+    switch(parameter)
+    {
+        case Parameter::Shutter:
+        {
+            bool shutterIsAngle = !BMDControlSystem::getInstance()->hasCamera() || BMDControlSystem::getInstance()->getCamera()->shutterValueIsAngle;
+            return transition(parameter, shutterIsAngle ? lroundf(value * 100.0f) : lroundf(value), inDurationMs);
+        }
+        case Parameter::Iris:
+            return transition(parameter, CCUEncodingFunctions::ConvertFStopToCCUAperture(value), inDurationMs);
+        default:
+            return transition(parameter, lroundf(value), inDurationMs);
+    }
+}
+
+void ExposureEngine::cancel()
+{
+    if(!running)
+        return;
+
+    // What's been sent stays, each step kept the brightness
+    running = false;
+    ended = true;
+}
+
+bool ExposureEngine::service()
+{
+    bool hasEnded = ended;
+    ended = false;
+
+    if(!running)
+        return hasEnded;
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected)
+    {
+        cancel();
+        ended = false;
+        return true;
+    }
+
+    unsigned long elapsed = millis() - startMillis;
+    if(elapsed < durationMs * (nextStep + 1) / stepCount)
+        return hasEnded;
+
+    // A late step isn't made up for, it goes straight on to the step that's due now
+    if(nextStep + 1 < stepCount && elapsed >= durationMs * (nextStep + 2) / stepCount)
+    {
+        lateSteps++;
+        while(nextStep + 1 < stepCount && elapsed >= durationMs * (nextStep + 2) / stepCount)
+            nextStep++;
+    }
+
+    Exposure target = startExposure;
+    float errorStops = ExposureMath::compensate(startExposure, target, stepParameter, steps[nextStep]);
+    maxErrorStops = std::max(maxErrorStops, fabsf(errorStops));
+
+    // The last write of the last step waits for its response
+    bool last = nextStep + 1 >= stepCount;
+    sendStep(target, last);
+
+    nextStep++;
+    stepsSent++;
+
+    if(last)
+    {
+        running = false;
+        hasEnded = true;
+
+        DEBUG_VERBOSE("ExposureEngine: Finished, ISO %i, shutter %li, aperture %i, %.2f stops from the start", target.iso, static_cast<long>(target.shutter), target.aperture, errorStops);
+    }
+
+    return hasEnded;
+}
+
+void ExposureEngine::sendStep(const Exposure& target, bool response)
+{
+    // Darker changes first, then brighter, so between the writes the picture dips rather than flares
+    Parameter order[static_cast<byte>(Parameter::Count)];
+    byte count = 0;
+
+    for(byte pass = 0; pass < 2; pass++)
+    {
+        for(byte index = 0; index < static_cast<byte>(Parameter::Count); index++)
+        {
+            Parameter parameter = static_cast<Parameter>(index);
+            int32_t value = ExposureMath::getValue(parameter, target);
+            int32_t previous = ExposureMath::getValue(parameter, lastSent);
+
+            if(value == previous)
+                continue;
+
+            bool darker = ExposureMath::getStops(parameter, target, value) < ExposureMath::getStops(parameter, lastSent, previous);
+            if(darker == (pass == 0))
+                order[count++] = parameter;
+        }
+    }
+
+    for(byte index = 0; index < count; index++)
+        write(order[index], target, response && index == count - 1);
+
+    lastSent = target;
+}
+
+void ExposureEngine::write(Parameter parameter, const Exposure& exposure, bool response)
+{
+    if(connection == nullptr)
+        return;
+
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            PacketWriter::writeISO(exposure.iso, connection, response);
+            break;
+        case Parameter::Shutter:
+            if(exposure.shutterIsAngle)
+                PacketWriter::writeShutterAngle(exposure.shutter, connection, response);
+            else
+                PacketWriter::writeShutterSpeed(exposure.shutter, connection, response);
+            break;
+        case Parameter::Iris:
+            PacketWriter::writeIris(exposure.aperture, connection, response);
+            break;
+        default:
+            return;
+    }
+
+    writes++;
+}
+
+const char* ExposureEngine::getParameterName(Parameter parameter)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            return "ISO";
+        case Parameter::Shutter:
+            return "Shutter";
+        case Parameter::Iris:
+            return "Iris";
+        default:
+            return "Unknown";
+    }
+}
+
+void ExposureEngine::reportStats()
+{
+    DEBUG_INFO("ExposureEngine: %lu transitions, %lu steps, %lu writes, %lu late steps, furthest %.2f stops from the starting brightness", transitions, stepsSent, writes, lateSteps, maxErrorStops);
+}
@@ -0,0 +1,70 @@
+#ifndef EXPOSUREENGINE_H
+#define EXPOSUREENGINE_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+#include "ExposureMath.h"
+
+// Changes one of ISO, shutter or iris while keeping the picture as bright as it was, e.g. opening the iris two stops for a shallower
+// depth of field. The other two make up the difference in stops, ISO first, then shutter, then iris (never the one being changed).
+// A change can be spread over a duration, in which case the changed parameter goes through each of its table values in turn
+// (VideoConfig::kISOStops, kShutterAngles or kShutterSpeeds, LensConfig::apertureNumbers), third stops or so at a time.
+// Each step's values are worked out from where the transition started, so rounding to the tables doesn't build up.
+// A step's writes are sent together in one loop() pass without waiting for responses. Changes that darken the picture go first,
+// so the brief gap between writes goes darker rather than brighter.
+class ExposureEngine
+{
+    public:
+        // Shared with the host tests, see ExposureMath
+        typedef ExposureMath::Parameter Parameter;
+        typedef ExposureMath::Exposure Exposure;
+
+        static void begin(BMDCameraConnection* inConnection);
+
+        // The camera's ISO, shutter and aperture. False if it hasn't sent the ISO and shutter yet.
+        static bool fromCamera(Exposure& exposure);
+
+        // From the camera's exposure, over durationMs (0 for one step). Value is the ISO, the shutter angle x 100 or speed (as the
+        // camera is using) or the CCU aperture number. False if the camera's exposure isn't known or the parameter can't be changed.
+        static bool transition(Parameter parameter, int32_t value, unsigned long durationMs = 0);
+
+        // As it's shown, the ISO, the shutter angle in degrees or speed as 1/x, or the f-stop
+        static bool transitionTo(Parameter parameter, float value, unsigned long durationMs = 0);
+
+        static void cancel();
+
+        // Call from loop(), sends the step that's due. Returns true when a transition has finished (or been cancelled).
+        static bool service();
+
+        static bool isRunning() { return running; }
+        static const char* getParameterName(Parameter parameter);
+
+        static void reportStats();
+
+    private:
+        static const byte kMaxSteps = 32;
+
+        static void sendStep(const Exposure& target, bool response);
+        static void write(Parameter parameter, const Exposure& exposure, bool response);
+
+        static BMDCameraConnection* connection;
+        static bool running;
+        static bool ended;
+        static Parameter stepParameter;
+        static Exposure startExposure;
+        static Exposure lastSent;
+        static int32_t steps[kMaxSteps];            // The changed parameter's value at each step
+        static byte stepCount;
+        static byte nextStep;
+        static unsigned long startMillis;
+        static unsigned long durationMs;
+
+        static unsigned long transitions;
+        static unsigned long stepsSent;
+        static unsigned long writes;
+        static unsigned long lateSteps;             // Sent a step or more after they were due
+        static float maxErrorStops;                 // Furthest any step was from the starting brightness
+};
+
+#endif
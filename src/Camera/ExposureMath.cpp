@@ -0,0 +1,147 @@
+#include "ExposureMath.h"
+#include "Config/VideoConfig.h"
+#include "Config/LensConfig.h"
+#include <math.h>
+
+float ExposureMath::stops(const Exposure& exposure)
+{
+    float total = isoStops(exposure.iso) + shutterStops(exposure.shutterIsAngle, exposure.shutter);
+    if(exposure.hasAperture)
+        total += apertureStops(exposure.aperture);
+
+    return total;
+}
+
+float ExposureMath::isoStops(int iso)
+{
+    return log2f(iso / 100.0f);
+}
+
+float ExposureMath::shutterStops(bool shutterIsAngle, int32_t shutter)
+{
+    // An angle is a share of the frame, so against a full 360 degrees. A speed is 1/x of a second.
+    return shutterIsAngle ? log2f(shutter / 36000.0f) : -log2f(static_cast<float>(shutter));
+}
+
+float ExposureMath::apertureStops(short aperture)
+{
+    // The aperture number is already in stops (fixed16), a larger number lets in less light
+    return -aperture / 2048.0f;
+}
+
+float ExposureMath::compensate(const Exposure& start, Exposure& target, Parameter parameter, int32_t value)
+{
+    setValue(parameter, target, value);
+
+    for(byte index = 0; index < static_cast<byte>(Parameter::Count); index++)
+    {
+        Parameter other = static_cast<Parameter>(index);
+        if(other == parameter || (other == Parameter::Iris && !target.hasAperture))
+            continue;
+
+        // Close enough, less than the smallest step on any table
+        float needed = stops(start) - stops(target);
+        if(fabsf(needed) < 0.05f)
+            break;
+
+        // The table value that makes up as much of it as it can
+        float wanted = getStops(other, target, getValue(other, target)) + needed;
+
+        byte count = getTableCount(other, target.shutterIsAngle);
+        int32_t best = getValue(other, target);
+        float bestDifference = fabsf(needed);
+        for(byte tableIndex = 0; tableIndex < count; tableIndex++)
+        {
+            int32_t option = getTableValue(other, target.shutterIsAngle, tableIndex);
+            float difference = fabsf(getStops(other, target, option) - wanted);
+
+            if(difference < bestDifference)
+            {
+                best = option;
+                bestDifference = difference;
+            }
+        }
+
+        setValue(other, target, best);
+    }
+
+    return stops(target) - stops(start);
+}
+
+byte ExposureMath::getTableCount(Parameter parameter, bool shutterIsAngle)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            return VideoConfig::kISOStopCount;
+        case Parameter::Shutter:
+            return shutterIsAngle ? VideoConfig::kShutterAngleCount : VideoConfig::kShutterSpeedCount;
+        case Parameter::Iris:
+            return LensConfig::kApertureCount;
+        default:
+            return 0;
+    }
+}
+
+int32_t ExposureMath::getTableValue(Parameter parameter, bool shutterIsAngle, byte index)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            return VideoConfig::kISOStops[index];
+        case Parameter::Shutter:
+            return shutterIsAngle ? lround(VideoConfig::kShutterAngles[index] * 100.0) : VideoConfig::kShutterSpeeds[index];
+        case Parameter::Iris:
+            return LensConfig::apertureNumbers[index];
+        default:
+            return 0;
+    }
+}
+
+float ExposureMath::getStops(Parameter parameter, const Exposure& exposure, int32_t value)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            return isoStops(value);
+        case Parameter::Shutter:
+            return shutterStops(exposure.shutterIsAngle, value);
+        case Parameter::Iris:
+            return apertureStops(static_cast<short>(value));
+        default:
+            return 0.0f;
+    }
+}
+
+int32_t ExposureMath::getValue(Parameter parameter, const Exposure& exposure)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            return exposure.iso;
+        case Parameter::Shutter:
+            return exposure.shutter;
+        case Parameter::Iris:
+            return exposure.aperture;
+        default:
+            return 0;
+    }
+}
+
+void ExposureMath::setValue(Parameter parameter, Exposure& exposure, int32_t value)
+{
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            exposure.iso = value;
+            break;
+        case Parameter::Shutter:
+            exposure.shutter = value;
+            break;
+        case Parameter::Iris:
+            exposure.aperture = static_cast<short>(value);
+            break;
+        default:
+            break;
+    }
+}
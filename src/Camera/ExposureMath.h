@@ -0,0 +1,49 @@
+#ifndef EXPOSUREMATH_H
+#define EXPOSUREMATH_H
+
+#include <stdint.h>
+#include "Camera/ConstantsTypes.h"
+
+// The exposure value maths behind ExposureEngine, brightness in stops and picking table values that keep it, with nothing from
+// Arduino or the camera connection so it can be built and tested on the host (see test/ExposureMath).
+// The tables are VideoConfig::kISOStops, kShutterAngles or kShutterSpeeds and LensConfig::apertureNumbers.
+class ExposureMath
+{
+    public:
+        enum class Parameter : byte
+        {
+            ISO = 0,
+            Shutter,    // Angle or speed, whichever the camera is using
+            Iris,
+            Count
+        };
+
+        struct Exposure
+        {
+            int iso = 0;
+            bool shutterIsAngle = true;
+            int32_t shutter = 0;        // Angle x 100 (e.g. 18000 for 180 degrees), or speed as 1/x
+            short aperture = 0;         // CCU aperture number, log2(f-number squared) as fixed16 (as LensConfig::apertureNumbers)
+            bool hasAperture = false;   // No lens, or one that doesn't report its aperture
+        };
+
+        // Brightness in stops, each parameter's share, higher is brighter
+        static float stops(const Exposure& exposure);
+        static float isoStops(int iso);
+        static float shutterStops(bool shutterIsAngle, int32_t shutter);
+        static float apertureStops(short aperture);
+
+        // Sets the parameter to value in target (already a copy of start) and moves the others in to keep start's brightness.
+        // Returns the stops it's still off by, plus is brighter, when the tables can't make up all of it.
+        static float compensate(const Exposure& start, Exposure& target, Parameter parameter, int32_t value);
+
+        // The table for the parameter, in order of value
+        static byte getTableCount(Parameter parameter, bool shutterIsAngle);
+        static int32_t getTableValue(Parameter parameter, bool shutterIsAngle, byte index);
+
+        static float getStops(Parameter parameter, const Exposure& exposure, int32_t value);
+        static int32_t getValue(Parameter parameter, const Exposure& exposure);
+        static void setValue(Parameter parameter, Exposure& exposure, int32_t value);
+};
+
+#endif
@@ -0,0 +1,231 @@
+#include "LinkHealthMonitor.h"
+#include "BMDCameraConnection.h"
+
+bool LinkHealthMonitor::proactiveReconnect = true;
+
+BMDCameraConnection* LinkHealthMonitor::cameraConnection = nullptr;
+TaskHandle_t LinkHealthMonitor::probeHandle = nullptr;
+
+volatile unsigned long LinkHealthMonitor::lastNotifyTime = 0;
+unsigned long LinkHealthMonitor::lastRssiTime = 0;
+unsigned long LinkHealthMonitor::lastTelemetryTime = 0;
+unsigned long LinkHealthMonitor::lastWriteFailureDecay = 0;
+int LinkHealthMonitor::rssi = 0;
+byte LinkHealthMonitor::score = 0;
+LinkHealthMonitor::Level LinkHealthMonitor::level = LinkHealthMonitor::Level::Unknown;
+
+volatile unsigned long LinkHealthMonitor::probeStartTime = 0;
+volatile unsigned long LinkHealthMonitor::lastProbeTime = 0;
+volatile unsigned long LinkHealthMonitor::lastProbeSuccessTime = 0;
+bool LinkHealthMonitor::linkDead = false;
+unsigned long LinkHealthMonitor::reconnectPendingTime = 0;
+
+volatile unsigned long LinkHealthMonitor::writeFailures = 0;
+volatile byte LinkHealthMonitor::recentWriteFailures = 0;
+unsigned long LinkHealthMonitor::averageWriteMicros = 0;
+unsigned long LinkHealthMonitor::fastReconnects = 0;
+
+void LinkHealthMonitor::begin(BMDCameraConnection* connection)
+{
+    cameraConnection = connection;
+
+    // The probe read blocks until the camera answers (or the link drops), so it runs in its own task
+    if(probeHandle == nullptr)
+        xTaskCreate(probeTask, "LinkProbe", 3072, nullptr, 1, &probeHandle);
+}
+
+const char* LinkHealthMonitor::getLevelName(Level healthLevel)
+{
+    switch(healthLevel)
+    {
+        case Level::Good:
+            return "Good";
+        case Level::Warning:
+            return "Warning";
+        case Level::Poor:
+            return "Poor";
+        default:
+            return "Unknown";
+    }
+}
+
+// Green, orange and red, with dark grey when we don't know yet
+uint16_t LinkHealthMonitor::getSidebarColour(Level healthLevel)
+{
+    switch(healthLevel)
+    {
+        case Level::Good:
+            return 0x07E0;
+        case Level::Warning:
+            return 0xFDA0;
+        case Level::Poor:
+            return 0xF800;
+        default:
+            return 0x7BEF;
+    }
+}
+
+// Start of a new connection
+void LinkHealthMonitor::connected()
+{
+    unsigned long now = millis();
+
+    lastNotifyTime = now;
+    lastProbeTime = now;
+    lastRssiTime = 0; // Sample straight away
+    lastWriteFailureDecay = now;
+    recentWriteFailures = 0;
+    linkDead = false;
+}
+
+void LinkHealthMonitor::notifyReceived()
+{
+    lastNotifyTime = millis();
+}
+
+void LinkHealthMonitor::writeCompleted(bool success, unsigned long durationMicros, bool response)
+{
+    // A write with a response waits for the camera, averaged it's how quickly the link can take one write after another
+    if(success && response)
+        averageWriteMicros = averageWriteMicros == 0 ? durationMicros : (averageWriteMicros * 7 + durationMicros) / 8;
+
+    if(success && durationMicros <= kSlowWriteMicros)
+        return;
+
+    writeFailures++;
+
+    if(recentWriteFailures < 4)
+        recentWriteFailures++;
+}
+
+unsigned long LinkHealthMonitor::getNotifyGapMs()
+{
+    return millis() - lastNotifyTime;
+}
+
+void LinkHealthMonitor::probeTask(void* parameter)
+{
+    while(true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        if(cameraConnection->probeLink())
+            lastProbeSuccessTime = millis();
+
+        probeStartTime = 0;
+    }
+}
+
+byte LinkHealthMonitor::calculateScore(unsigned long now)
+{
+    if(linkDead)
+        return 0;
+
+    // -55dBm or better is perfect, -95dBm is about where the link drops (0 = not read yet)
+    int rssiScore = rssi == 0 ? 100 : constrain((rssi + 95) * 100 / 40, 0, 100);
+
+    // A quiet camera is fine if the last probe answered after the notifications stopped
+    bool cameraReady = (BMDCameraConnection::bmdConnectionStatus & BMDCameraConnection::ConnectionStatusFlags::kCameraReady) != 0;
+    int notifyScore = 100;
+    if(cameraReady && now - lastNotifyTime >= kNotifyGapWarningMs && lastProbeSuccessTime < lastNotifyTime)
+        notifyScore = 50;
+
+    int writeScore = 100 - 25 * recentWriteFailures;
+
+    // The weakest signal decides, a great RSSI doesn't help if writes are failing
+    return static_cast<byte>(min(rssiScore, min(notifyScore, writeScore)));
+}
+
+bool LinkHealthMonitor::update()
+{
+    if(cameraConnection == nullptr)
+        return false;
+
+    Level previousLevel = level;
+    unsigned long now = millis();
+
+    // A proactive reconnect waits (without blocking loop()) for the probe to let go of the old connection
+    if(reconnectPendingTime != 0 && (probeStartTime == 0 || now - reconnectPendingTime >= kReconnectProbeWaitMs))
+    {
+        reconnectPendingTime = 0;
+
+        // Connects in the background, if the camera isn't bonded (or the scheduler has already started a scan) it's left to the ReconnectScheduler
+        if(cameraConnection->status == BMDCameraConnection::ConnectionStatus::Disconnected)
+            cameraConnection->reconnect();
+    }
+
+    if(cameraConnection->status != BMDCameraConnection::ConnectionStatus::Connected)
+    {
+        score = 0;
+        level = Level::Unknown;
+        return level != previousLevel;
+    }
+
+    if(now - lastRssiTime >= kRssiIntervalMs && probeStartTime == 0)
+    {
+        rssi = cameraConnection->getRssi();
+        lastRssiTime = now;
+    }
+
+    if(recentWriteFailures > 0 && now - lastWriteFailureDecay >= kWriteFailureDecayMs)
+    {
+        recentWriteFailures--;
+        lastWriteFailureDecay = now;
+    }
+    else if(recentWriteFailures == 0)
+        lastWriteFailureDecay = now;
+
+    // Nothing from the camera for a while, check it's still there
+    bool cameraReady = (BMDCameraConnection::bmdConnectionStatus & BMDCameraConnection::ConnectionStatusFlags::kCameraReady) != 0;
+    if(cameraReady && probeStartTime == 0 && now - lastNotifyTime >= kNotifyGapWarningMs && now - lastProbeTime >= kNotifyGapWarningMs)
+    {
+        lastProbeTime = now;
+        probeStartTime = now;
+        xTaskNotifyGive(probeHandle);
+    }
+
+    unsigned long probeStarted = probeStartTime;
+    if(probeStarted != 0 && now - probeStarted >= kProbeTimeoutMs && !linkDead)
+    {
+        DEBUG_ERROR("LinkHealthMonitor: Camera hasn't answered for %lums, link is dead (RSSI %i)", now - lastNotifyTime, rssi);
+        linkDead = true;
+    }
+
+    // Camera came back by itself (e.g. when not reconnecting proactively)
+    if(linkDead && now - lastNotifyTime < kNotifyGapWarningMs)
+        linkDead = false;
+
+    score = calculateScore(now);
+
+    if(linkDead)
+        level = Level::Poor;
+    else if(score < 60)
+        level = Level::Warning;
+    else
+        level = Level::Good;
+
+    if(level != previousLevel)
+        DEBUG_INFO("LinkHealthMonitor: %s (score %i, RSSI %i, notify gap %lums, write failures %lu)", getLevelName(level), score, rssi, now - lastNotifyTime, writeFailures);
+    else if(now - lastTelemetryTime >= kTelemetryIntervalMs)
+    {
+        DEBUG_VERBOSE("LinkHealthMonitor: Score %i, RSSI %i, notify gap %lums, write failures %lu", score, rssi, now - lastNotifyTime, writeFailures);
+        lastTelemetryTime = now;
+    }
+
+    // Don't wait for the supervision timeout, drop the link and go straight back to the camera
+    if(linkDead && proactiveReconnect)
+    {
+        fastReconnects++;
+
+        // Disconnecting releases the probe's read so it isn't left using the old connection, we reconnect once it has finished
+        cameraConnection->disconnect();
+        reconnectPendingTime = now;
+    }
+
+    return level != previousLevel;
+}
+
+void LinkHealthMonitor::printTelemetry(Stream& output)
+{
+    output.printf("LINKHEALTH:%i,%s,%i,%lu,%lu,%lu\n", score, getLevelName(level), rssi, getNotifyGapMs(), writeFailures, fastReconnects);
+}
@@ -0,0 +1,86 @@
+#ifndef LINKHEALTHMONITOR_H
+#define LINKHEALTHMONITOR_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "Arduino_DebugUtils.h"
+
+class BMDCameraConnection; // forward declaration as the connection reports notifications and writes to the monitor
+
+// Keeps track of how healthy the Bluetooth link to the camera is so we can warn before control drops, rather than waiting for the
+// supervision timeout to disconnect us. Samples RSSI, watches for gaps in the camera's notifications and tracks failed/slow writes.
+// A gap in notifications isn't enough by itself (e.g. timecode stops in Record Run when not recording), so on a gap we probe the link
+// with a read of the protocol version, if that doesn't come back in time the link is dead and we reconnect to the camera straight away.
+class LinkHealthMonitor
+{
+    public:
+        enum class Level : byte
+        {
+            Unknown = 0, // Not connected
+            Good = 1,
+            Warning = 2, // Weak signal, a notification gap or write failures, warn the operator
+            Poor = 3     // Link probe failed, reconnecting
+        };
+
+        static void begin(BMDCameraConnection* connection);
+
+        // Call from loop(), returns true if the health level changed (e.g. so the screen can be refreshed)
+        static bool update();
+
+        // Called by the connection
+        static void connected();
+        static void notifyReceived();
+        static void writeCompleted(bool success, unsigned long durationMicros, bool response);
+
+        static byte getScore() { return score; } // 0 (dead) to 100 (perfect)
+        static Level getLevel() { return level; }
+        static const char* getLevelName(Level healthLevel);
+        static uint16_t getSidebarColour(Level healthLevel); // RGB565 (the TFT_ colour values every board's display library uses)
+        static int getRssi() { return rssi; }
+        static unsigned long getNotifyGapMs();
+        static unsigned long getWriteFailures() { return writeFailures; }
+        static unsigned long getAverageWriteMicros() { return averageWriteMicros; } // Writes with a response, how long the camera takes to answer
+        static unsigned long getFastReconnects() { return fastReconnects; }
+
+        // Machine readable telemetry line, e.g. "LINKHEALTH:82,Good,-67,120,0,0" (score, level, RSSI, notify gap ms, write failures, fast reconnects)
+        static void printTelemetry(Stream& output);
+
+        static bool proactiveReconnect; // Reconnect when the link probe fails, rather than waiting for the supervision timeout
+
+    private:
+        static void probeTask(void* parameter);
+        static byte calculateScore(unsigned long now);
+
+        static const unsigned long kRssiIntervalMs = 2000;
+        static const unsigned long kNotifyGapWarningMs = 2500;  // No notifications for this long while the camera is ready = probe the link
+        static const unsigned long kProbeTimeoutMs = 1500;      // A live camera answers a read well within this
+        static const unsigned long kSlowWriteMicros = 250000;   // Writes (with response) taking longer than this count against the link
+        static const unsigned long kWriteFailureDecayMs = 10000; // Each recent write failure is forgotten after this long
+        static const unsigned long kTelemetryIntervalMs = 5000;
+        static const unsigned long kReconnectProbeWaitMs = 2000; // Longest we wait for the probe to let go of the old connection before reconnecting
+
+        static BMDCameraConnection* cameraConnection;
+        static TaskHandle_t probeHandle;
+
+        static volatile unsigned long lastNotifyTime;
+        static unsigned long lastRssiTime;
+        static unsigned long lastTelemetryTime;
+        static unsigned long lastWriteFailureDecay;
+        static int rssi;
+        static byte score;
+        static Level level;
+
+        static volatile unsigned long probeStartTime; // 0 = no probe in flight
+        static volatile unsigned long lastProbeTime;
+        static volatile unsigned long lastProbeSuccessTime;
+        static bool linkDead;
+        static unsigned long reconnectPendingTime; // 0 = no proactive reconnect waiting on the probe
+
+        static volatile unsigned long writeFailures;
+        static volatile byte recentWriteFailures;
+        static unsigned long averageWriteMicros;
+        static unsigned long fastReconnects;
+};
+
+#endif
@@ -0,0 +1,577 @@
+#include "LookPresets.h"
+#include "PacketWriter.h"
+#include "ExposureEngine.h"
+#include "SpeedRamp.h"
+
+BMDCameraConnection* LookPresets::connection = nullptr;
+Preferences LookPresets::preferences;
+LookPresets::Look LookPresets::looks[kMaxLooks];
+
+bool LookPresets::recalling = false;
+bool LookPresets::ended = false;
+byte LookPresets::recallSlot = 0;
+uint16_t LookPresets::pendingFields = 0;
+bool LookPresets::resent = false;
+unsigned long LookPresets::recallMillis = 0;
+unsigned long LookPresets::sentMillis = 0;
+int LookPresets::lastRecalled = -1;
+unsigned long LookPresets::lastRecallMs = 0;
+
+unsigned long LookPresets::recalls = 0;
+unsigned long LookPresets::fieldsSent = 0;
+unsigned long LookPresets::fieldsSkipped = 0;
+unsigned long LookPresets::fieldsResent = 0;
+unsigned long LookPresets::fieldsUnverified = 0;
+unsigned long LookPresets::averageRecallMs = 0;
+unsigned long LookPresets::maxRecallMs = 0;
+
+void LookPresets::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+
+    if(!preferences.begin("looks", false))
+    {
+        DEBUG_ERROR("LookPresets: Couldn't open NVS");
+        return;
+    }
+
+    byte loaded = 0;
+    for(byte slot = 0; slot < kMaxLooks; slot++)
+    {
+        char key[8];
+        getKey(slot, key);
+
+        // A look saved by a build with a different layout is left out rather than read wrongly
+        if(preferences.getBytesLength(key) == sizeof(Look) && preferences.getBytes(key, &looks[slot], sizeof(Look)) == sizeof(Look))
+        {
+            looks[slot].name[kNameLength] = '\0';
+            loaded += isUsed(slot) ? 1 : 0;
+        }
+        else
+            looks[slot].fields = 0;
+    }
+
+    DEBUG_VERBOSE("LookPresets: %u looks", loaded);
+}
+
+bool LookPresets::capture(byte slot, const char* name)
+{
+    if(slot >= kMaxLooks)
+        return false;
+
+    Look look = {};
+    if(!fromCamera(look))
+    {
+        DEBUG_ERROR("LookPresets: The camera hasn't sent its settings yet");
+        return false;
+    }
+
+    if(name == nullptr || name[0] == '\0')
+        snprintf(look.name, sizeof(look.name), "LOOK %u", slot + 1);
+    else
+    {
+        strncpy(look.name, name, kNameLength);
+        look.name[kNameLength] = '\0';
+    }
+
+    looks[slot] = look;
+
+    DEBUG_VERBOSE("LookPresets: Saved %s to %u, %s", look.name, slot + 1, getSummary(slot).c_str());
+
+    return save(slot);
+}
+
+bool LookPresets::remove(byte slot)
+{
+    if(!isUsed(slot))
+        return false;
+
+    looks[slot].fields = 0;
+
+    char key[8];
+    getKey(slot, key);
+    return preferences.remove(key);
+}
+
+bool LookPresets::recall(byte slot)
+{
+    if(!isUsed(slot))
+        return false;
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected || !BMDControlSystem::getInstance()->hasCamera())
+        return false;
+
+    // The look takes over from anything still moving the exposure or frame rate
+    ExposureEngine::cancel();
+    SpeedRamp::stop();
+
+    const Look& look = looks[slot];
+    uint16_t fields = differences(look, look.fields);
+
+    recalls++;
+    fieldsSkipped += countFields(look.fields) - countFields(fields);
+    recallSlot = slot;
+    recallMillis = millis();
+    lastRecalled = slot;
+
+    if(fields == 0)
+    {
+        // Already there
+        recalling = false;
+        ended = true;
+        lastRecallMs = 0;
+
+        DEBUG_VERBOSE("LookPresets: Already on %s", look.name);
+        return true;
+    }
+
+    send(look, fields);
+    pendingFields = fields;
+    resent = false;
+    recalling = true;
+
+    DEBUG_VERBOSE("LookPresets: Recalling %s, %u of %u settings sent", look.name, countFields(fields), countFields(look.fields));
+
+    return true;
+}
+
+int LookPresets::find(const char* name)
+{
+    for(byte slot = 0; slot < kMaxLooks; slot++)
+    {
+        if(isUsed(slot) && strcasecmp(looks[slot].name, name) == 0)
+            return slot;
+    }
+
+    return -1;
+}
+
+int LookPresets::findEmpty()
+{
+    for(byte slot = 0; slot < kMaxLooks; slot++)
+    {
+        if(!isUsed(slot))
+            return slot;
+    }
+
+    return -1;
+}
+
+int LookPresets::parseSlot(const char* text)
+{
+    char* end = nullptr;
+    long number = strtol(text, &end, 10);
+
+    if(end != text && *end == '\0')
+        return number >= 1 && number <= kMaxLooks ? static_cast<int>(number - 1) : -1;
+
+    return find(text);
+}
+
+bool LookPresets::service()
+{
+    bool hasEnded = ended;
+    ended = false;
+
+    if(!recalling)
+        return hasEnded;
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected)
+    {
+        recalling = false;
+        return true;
+    }
+
+    const Look& look = looks[recallSlot];
+    unsigned long now = millis();
+
+    // Echoed settings drop out, whatever's left is still on its way (or the camera didn't take it)
+    pendingFields = differences(look, pendingFields);
+
+    if(pendingFields != 0)
+    {
+        if(now - sentMillis < kEchoTimeoutMs)
+            return hasEnded;
+
+        if(!resent)
+        {
+            fieldsResent += countFields(pendingFields);
+            send(look, pendingFields);
+            resent = true;
+            return hasEnded;
+        }
+
+        fieldsUnverified += countFields(pendingFields);
+        for(byte index = 0; index < static_cast<byte>(Field::Count); index++)
+        {
+            if(pendingFields & bit(static_cast<Field>(index)))
+                DEBUG_ERROR("LookPresets: %s of %s wasn't echoed by the camera", getFieldName(static_cast<Field>(index)), look.name);
+        }
+    }
+
+    recalling = false;
+    pendingFields = 0;
+    lastRecallMs = now - recallMillis;
+    averageRecallMs = averageRecallMs == 0 ? lastRecallMs : (averageRecallMs * 7 + lastRecallMs) / 8;
+    maxRecallMs = std::max(maxRecallMs, lastRecallMs);
+
+    DEBUG_VERBOSE("LookPresets: Recalled %s in %lu ms", look.name, lastRecallMs);
+
+    return true;
+}
+
+std::string LookPresets::getSummary(byte slot)
+{
+    if(!isUsed(slot))
+        return "";
+
+    const Look& look = looks[slot];
+    std::string summary;
+    char text[24];
+
+    if(look.fields & bit(Field::ISO))
+    {
+        snprintf(text, sizeof(text), "ISO %li  ", static_cast<long>(look.iso));
+        summary += text;
+    }
+
+    if(look.fields & bit(Field::Shutter))
+    {
+        if(look.shutterIsAngle)
+            snprintf(text, sizeof(text), "%.1f  ", look.shutter / 100.0f);
+        else
+            snprintf(text, sizeof(text), "1/%li  ", static_cast<long>(look.shutter));
+        summary += text;
+    }
+
+    if(look.fields & bit(Field::WhiteBalance))
+    {
+        snprintf(text, sizeof(text), "%iK  ", look.whiteBalance);
+        summary += text;
+    }
+
+    if(look.fields & bit(Field::RecordingFormat))
+    {
+        CCUPacketTypes::RecordingFormatData format = look.recordingFormat;
+        summary += format.frameRate_string();
+    }
+
+    return summary;
+}
+
+bool LookPresets::matches(byte slot)
+{
+    return isUsed(slot) && differences(looks[slot], looks[slot].fields) == 0;
+}
+
+void LookPresets::print(Stream& output)
+{
+    byte used = 0;
+
+    for(byte slot = 0; slot < kMaxLooks; slot++)
+    {
+        if(!isUsed(slot))
+            continue;
+
+        const Look& look = looks[slot];
+        used++;
+
+        output.printf("LOOK:%u,%s", slot + 1, look.name);
+
+        if(look.fields & bit(Field::ISO))
+            output.printf(",ISO %li", static_cast<long>(look.iso));
+        if(look.fields & bit(Field::Shutter))
+        {
+            if(look.shutterIsAngle)
+                output.printf(",SHUTTER %.1f", look.shutter / 100.0f);
+            else
+                output.printf(",SHUTTER 1/%li", static_cast<long>(look.shutter));
+        }
+        if(look.fields & bit(Field::WhiteBalance))
+            output.printf(",WB %i/%i", look.whiteBalance, look.tint);
+        if(look.fields & bit(Field::Codec))
+            output.printf(",%s", CodecInfo(static_cast<CCUPacketTypes::BasicCodec>(look.basicCodec), look.codecVariant).to_string().c_str());
+        if(look.fields & bit(Field::RecordingFormat))
+        {
+            CCUPacketTypes::RecordingFormatData format = look.recordingFormat;
+            output.printf(",%s,%s", format.frameWidthHeight_string().c_str(), format.frameRate_string().c_str());
+        }
+        if(look.fields & bit(Field::LUT))
+            output.printf(",LUT %u %s", look.lut, look.lutEnabled ? "ON" : "OFF");
+        if(look.fields & bit(Field::Iris))
+            output.printf(",f%.1f", powf(2.0f, look.aperture / 4096.0f)); // The aperture number is log2(f-number squared) x 2048
+        if(look.fields & bit(Field::Zoom))
+            output.printf(",%imm", look.focalLengthMM);
+
+        output.printf("\n");
+    }
+
+    if(used == 0)
+        output.printf("LOOK:NONE\n");
+}
+
+bool LookPresets::fromCamera(Look& look)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera())
+        return false;
+
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    look.fields = 0;
+
+    if(camera->hasCodec())
+    {
+        CodecInfo codec = camera->getCodec();
+        look.basicCodec = static_cast<byte>(codec.basicCodec);
+        look.codecVariant = codec.codecVariant;
+        look.fields |= bit(Field::Codec);
+    }
+
+    if(camera->hasRecordingFormat())
+    {
+        look.recordingFormat = camera->getRecordingFormat();
+        look.fields |= bit(Field::RecordingFormat);
+    }
+
+    if(camera->hasSensorGainISOValue())
+    {
+        look.iso = camera->getSensorGainISOValue();
+        look.fields |= bit(Field::ISO);
+    }
+
+    look.shutterIsAngle = camera->shutterValueIsAngle;
+    if(look.shutterIsAngle ? camera->hasShutterAngle() : camera->hasShutterSpeed())
+    {
+        look.shutter = look.shutterIsAngle ? camera->getShutterAngle() : camera->getShutterSpeed();
+        look.fields |= bit(Field::Shutter);
+    }
+
+    if(camera->hasWhiteBalance())
+    {
+        look.whiteBalance = camera->getWhiteBalance();
+        look.tint = camera->hasTint() ? camera->getTint() : 0;
+        look.fields |= bit(Field::WhiteBalance);
+    }
+
+    if(camera->hasSelectedLUT())
+    {
+        look.lut = static_cast<byte>(camera->getSelectedLUT());
+        look.lutEnabled = camera->hasSelectedLUTEnabled() && camera->getSelectedLUTEnabled();
+        look.fields |= bit(Field::LUT);
+    }
+
+    if(cameraAperture(look.aperture))
+        look.fields |= bit(Field::Iris);
+
+    if(camera->hasFocalLengthMM())
+    {
+        look.focalLengthMM = camera->getFocalLengthMM();
+        look.fields |= bit(Field::Zoom);
+    }
+
+    return look.fields != 0;
+}
+
+bool LookPresets::cameraAperture(short& aperture)
+{
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    if(!camera->hasApertureFStopString())
+        return false;
+
+    // The camera keeps the aperture as the text shown, e.g. "f2.8"
+    std::string text = camera->getApertureFStopString();
+    float fStop = text.size() > 1 ? atof(text.c_str() + 1) : 0.0f;
+    if(fStop <= 0.0f)
+        return false;
+
+    aperture = CCUEncodingFunctions::ConvertFStopToCCUAperture(fStop);
+    return true;
+}
+
+uint16_t LookPresets::differences(const Look& look, uint16_t fields)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera())
+        return fields;
+
+    auto camera = BMDControlSystem::getInstance()->getCamera();
+    uint16_t different = 0;
+
+    for(byte index = 0; index < static_cast<byte>(Field::Count); index++)
+    {
+        Field field = static_cast<Field>(index);
+        if(!(fields & bit(field)))
+            continue;
+
+        bool same = false;
+        switch(field)
+        {
+            case Field::Codec:
+                if(camera->hasCodec())
+                {
+                    CodecInfo codec = camera->getCodec();
+                    same = static_cast<byte>(codec.basicCodec) == look.basicCodec && codec.codecVariant == look.codecVariant;
+                }
+                break;
+            case Field::RecordingFormat:
+                if(camera->hasRecordingFormat())
+                {
+                    const CCUPacketTypes::RecordingFormatData& target = look.recordingFormat;
+                    CCUPacketTypes::RecordingFormatData format = camera->getRecordingFormat();
+
+                    // The off-speed rate only counts while it's on
+                    same = format.frameRate == target.frameRate && format.width == target.width && format.height == target.height
+                        && format.mRateEnabled == target.mRateEnabled && format.offSpeedEnabled == target.offSpeedEnabled
+                        && (!target.offSpeedEnabled || format.offSpeedFrameRate == target.offSpeedFrameRate)
+                        && format.interlacedEnabled == target.interlacedEnabled && format.windowedModeEnabled == target.windowedModeEnabled;
+                }
+                break;
+            case Field::ISO:
+                same = camera->hasSensorGainISOValue() && camera->getSensorGainISOValue() == look.iso;
+                break;
+            case Field::Shutter:
+                if(look.shutterIsAngle)
+                    same = camera->hasShutterAngle() && camera->getShutterAngle() == look.shutter;
+                else
+                    same = camera->hasShutterSpeed() && camera->getShutterSpeed() == look.shutter;
+                break;
+            case Field::WhiteBalance:
+                same = camera->hasWhiteBalance() && camera->getWhiteBalance() == look.whiteBalance && (camera->hasTint() ? camera->getTint() : 0) == look.tint;
+                break;
+            case Field::LUT:
+                same = camera->hasSelectedLUT() && static_cast<byte>(camera->getSelectedLUT()) == look.lut && (camera->hasSelectedLUTEnabled() && camera->getSelectedLUTEnabled()) == look.lutEnabled;
+                break;
+            case Field::Iris:
+            {
+                short aperture = 0;
+                same = cameraAperture(aperture) && abs(aperture - look.aperture) <= kApertureTolerance;
+                break;
+            }
+            case Field::Zoom:
+                same = camera->hasFocalLengthMM() && camera->getFocalLengthMM() == look.focalLengthMM;
+                break;
+            default:
+                same = true;
+                break;
+        }
+
+        if(!same)
+            different |= bit(field);
+    }
+
+    return different;
+}
+
+void LookPresets::send(const Look& look, uint16_t fields)
+{
+    // Back to back, only the last waits for the camera's response
+    byte remaining = countFields(fields);
+
+    for(byte index = 0; index < static_cast<byte>(Field::Count); index++)
+    {
+        Field field = static_cast<Field>(index);
+        if(!(fields & bit(field)))
+            continue;
+
+        remaining--;
+        write(field, look, remaining == 0);
+        fieldsSent++;
+    }
+
+    sentMillis = millis();
+}
+
+void LookPresets::write(Field field, const Look& look, bool response)
+{
+    if(connection == nullptr)
+        return;
+
+    switch(field)
+    {
+        case Field::Codec:
+            PacketWriter::writeCodec(CodecInfo(static_cast<CCUPacketTypes::BasicCodec>(look.basicCodec), look.codecVariant), connection, response);
+            break;
+        case Field::RecordingFormat:
+            PacketWriter::writeRecordingFormat(look.recordingFormat, connection, response);
+            break;
+        case Field::ISO:
+            PacketWriter::writeISO(look.iso, connection, response);
+            break;
+        case Field::Shutter:
+            if(look.shutterIsAngle)
+                PacketWriter::writeShutterAngle(look.shutter, connection, response);
+            else
+                PacketWriter::writeShutterSpeed(look.shutter, connection, response);
+            break;
+        case Field::WhiteBalance:
+            PacketWriter::writeWhiteBalance(look.whiteBalance, look.tint, connection, response);
+            break;
+        case Field::LUT:
+            PacketWriter::writeDisplayLUT(static_cast<CCUPacketTypes::SelectedLUT>(look.lut), look.lutEnabled, connection, response);
+            break;
+        case Field::Iris:
+            PacketWriter::writeIris(look.aperture, connection, response);
+            break;
+        case Field::Zoom:
+            PacketWriter::writeZoomMM(look.focalLengthMM, connection, response);
+            break;
+        default:
+            break;
+    }
+}
+
+bool LookPresets::save(byte slot)
+{
+    char key[8];
+    getKey(slot, key);
+
+    if(preferences.putBytes(key, &looks[slot], sizeof(Look)) != sizeof(Look))
+    {
+        DEBUG_ERROR("LookPresets: Couldn't save %s to NVS", looks[slot].name);
+        return false;
+    }
+
+    return true;
+}
+
+void LookPresets::getKey(byte slot, char* key)
+{
+    snprintf(key, 8, "look%u", slot);
+}
+
+byte LookPresets::countFields(uint16_t fields)
+{
+    byte count = 0;
+    for(; fields != 0; fields &= fields - 1)
+        count++;
+
+    return count;
+}
+
+const char* LookPresets::getFieldName(Field field)
+{
+    switch(field)
+    {
+        case Field::Codec:
+            return "Codec";
+        case Field::RecordingFormat:
+            return "Recording format";
+        case Field::ISO:
+            return "ISO";
+        case Field::Shutter:
+            return "Shutter";
+        case Field::WhiteBalance:
+            return "White balance";
+        case Field::LUT:
+            return "LUT";
+        case Field::Iris:
+            return "Iris";
+        case Field::Zoom:
+            return "Zoom";
+        default:
+            return "Unknown";
+    }
+}
+
+void LookPresets::reportStats()
+{
+    DEBUG_INFO("LookPresets: %lu recalls, %lu settings sent (%lu already on, %lu sent again, %lu never echoed), %lu ms on average, %lu ms at most", recalls, fieldsSent, fieldsSkipped, fieldsResent, fieldsUnverified, averageRecallMs, maxRecallMs);
+}
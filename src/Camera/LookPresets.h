@@ -0,0 +1,135 @@
+#ifndef LOOKPRESETS_H
+#define LOOKPRESETS_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+#include "CCU/CCUPacketTypes.h"
+
+// Named looks, e.g. "INTERVIEW" and "B-ROLL", each the camera's ISO, shutter, white balance and tint, codec, recording format
+// (resolution, frame rate and off-speed), display LUT, iris and zoom as they were when it was saved. They're kept in NVS so they're
+// there after a restart, on every board.
+// Recalling a look only sends what the camera isn't already on, back to back in one loop() pass with a response on the last write
+// only, codec and recording format first as they decide what the rest can be. Each is then checked against what the camera sends
+// back, anything it hasn't echoed in time is sent once more, anything still missing after that is counted and logged.
+// Focus isn't part of a look, the camera doesn't report where the focus is so there's nothing to compare against.
+class LookPresets
+{
+    public:
+        // In the order they're sent
+        enum class Field : byte
+        {
+            Codec = 0,
+            RecordingFormat,
+            ISO,
+            Shutter,
+            WhiteBalance,       // With tint
+            LUT,
+            Iris,
+            Zoom,
+            Count
+        };
+
+        static const byte kMaxLooks = 6;
+        static const byte kNameLength = 15;
+
+        struct Look
+        {
+            char name[kNameLength + 1];
+            uint16_t fields;                                        // A bit for each Field it holds, 0 for an empty slot
+            byte basicCodec;
+            byte codecVariant;
+            CCUPacketTypes::RecordingFormatData recordingFormat;
+            int32_t iso;
+            bool shutterIsAngle;
+            int32_t shutter;                                        // Angle x 100, or speed as 1/x
+            short whiteBalance;
+            short tint;
+            byte lut;                                               // CCUPacketTypes::SelectedLUT
+            bool lutEnabled;
+            short aperture;                                         // CCU aperture number, as LensConfig::apertureNumbers
+            short focalLengthMM;
+        };
+
+        // Reads the looks from NVS
+        static void begin(BMDCameraConnection* inConnection);
+
+        // The camera's settings into the slot (0 to kMaxLooks - 1) and saved. An empty name is "LOOK n". False if the camera hasn't
+        // sent its settings yet.
+        static bool capture(byte slot, const char* name);
+        static bool remove(byte slot);
+
+        // Sends the look's settings the camera isn't on. False if the slot is empty or the camera isn't connected.
+        static bool recall(byte slot);
+
+        // The slot with the name (not case sensitive), or -1
+        static int find(const char* name);
+
+        // The first empty slot, or -1 when they're all used
+        static int findEmpty();
+
+        // The slot a command means, its number from 1 or the look's name, or -1
+        static int parseSlot(const char* text);
+
+        // Call from loop(), checks the recalled settings against the camera's echoes. Returns true when a recall has finished.
+        static bool service();
+
+        static bool isUsed(byte slot) { return slot < kMaxLooks && looks[slot].fields != 0; }
+        static const Look& getLook(byte slot) { return looks[slot]; }
+
+        // Short description for the screens, e.g. "ISO 800  180.0  5600K  24"
+        static std::string getSummary(byte slot);
+
+        // The camera is on the look, everything it holds is the same
+        static bool matches(byte slot);
+
+        static bool isRecalling() { return recalling; }
+        static int getLastRecalled() { return lastRecalled; }       // -1 before the first recall
+        static unsigned long getLastRecallMs() { return lastRecallMs; } // From the press to the last echo
+
+        // One line for each look, e.g. "LOOK:1,INTERVIEW,ISO 800,SHUTTER 180.0,WB 5600/0,BRAW 5:1,3840 x 2160,24,LUT 1 ON,f2.8,35mm"
+        static void print(Stream& output);
+
+        static const char* getFieldName(Field field);
+
+        static void reportStats();
+
+    private:
+        static const unsigned long kEchoTimeoutMs = 750;    // Sent again if it's not back by then, and given up on after twice this
+        static const short kApertureTolerance = 128;        // Sixteenth of a stop, the echoed f-stop text is rounded
+
+        static uint16_t bit(Field field) { return 1 << static_cast<byte>(field); }
+        static bool fromCamera(Look& look);
+        static bool cameraAperture(short& aperture);
+        static uint16_t differences(const Look& look, uint16_t fields); // Which of the fields the camera isn't on
+        static void send(const Look& look, uint16_t fields);
+        static void write(Field field, const Look& look, bool response);
+        static bool save(byte slot);
+        static void getKey(byte slot, char* key);
+        static byte countFields(uint16_t fields);
+
+        static BMDCameraConnection* connection;
+        static Preferences preferences;
+        static Look looks[kMaxLooks];
+
+        static bool recalling;
+        static bool ended;
+        static byte recallSlot;
+        static uint16_t pendingFields;                      // Sent and not echoed yet
+        static bool resent;
+        static unsigned long recallMillis;
+        static unsigned long sentMillis;
+        static int lastRecalled;
+        static unsigned long lastRecallMs;
+
+        static unsigned long recalls;
+        static unsigned long fieldsSent;
+        static unsigned long fieldsSkipped;                 // The camera was already on them
+        static unsigned long fieldsResent;
+        static unsigned long fieldsUnverified;              // Never echoed
+        static unsigned long averageRecallMs;
+        static unsigned long maxRecallMs;
+};
+
+#endif
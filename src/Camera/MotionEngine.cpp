@@ -0,0 +1,270 @@
+#include "MotionEngine.h"
+#include "PacketWriter.h"
+#include "LinkHealthMonitor.h"
+#include "CCU/CCUPacketTypes.h"
+
+BMDCameraConnection* MotionEngine::connection = nullptr;
+MotionEngine::Move MotionEngine::moves[kAxisCount];
+unsigned long MotionEngine::tickMs = kDefaultTickMs;
+unsigned long MotionEngine::nextTick = 0;
+bool MotionEngine::ended = false;
+
+unsigned long MotionEngine::movesStarted = 0;
+unsigned long MotionEngine::retargets = 0;
+unsigned long MotionEngine::cancels = 0;
+unsigned long MotionEngine::writes = 0;
+unsigned long MotionEngine::lateTicks = 0;
+
+void MotionEngine::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+}
+
+void MotionEngine::move(Axis axis, float start, float target, unsigned long durationMs, Easing easing)
+{
+    Move& move = moves[static_cast<byte>(axis)];
+    unsigned long now = millis();
+
+    start = constrain(start, 0.0f, 1.0f);
+    target = constrain(target, 0.0f, 1.0f);
+
+    if(move.active)
+        retargets++;
+
+    bool otherMoves = false;
+    for(byte index = 0; index < kAxisCount; index++)
+        otherMoves |= index != static_cast<byte>(axis) && moves[index].active;
+
+    // Not where the move starts (or not known), it goes there first
+    if(!move.known || CCUPacketTypes::toFixed16(move.position) != CCUPacketTypes::toFixed16(start))
+        write(axis, start, false);
+
+    move.active = true;
+    move.known = true;
+    move.start = start;
+    move.target = target;
+    move.position = start;
+    move.easing = easing;
+    move.startTime = now;
+    move.durationMs = std::max(1UL, durationMs);
+
+    movesStarted++;
+    updateTick();
+
+    // Other axes keep the tick they're on
+    if(!otherMoves)
+        nextTick = now + tickMs;
+
+    DEBUG_VERBOSE("MotionEngine: %s %.3f to %.3f over %lu ms (%s), ticks every %lu ms", getAxisName(axis), start, target, durationMs, getEasingName(easing), tickMs);
+}
+
+bool MotionEngine::moveTo(Axis axis, float target, unsigned long durationMs, Easing easing)
+{
+    const Move& current = moves[static_cast<byte>(axis)];
+    if(!current.known)
+        return false;
+
+    // Part way through a move it carries on from where it has got to
+    float start = current.active ? positionNow(current, millis()) : current.position;
+    move(axis, start, target, durationMs, easing);
+
+    return true;
+}
+
+void MotionEngine::set(Axis axis, float position)
+{
+    Move& move = moves[static_cast<byte>(axis)];
+
+    if(move.active)
+        cancel(axis);
+
+    position = constrain(position, 0.0f, 1.0f);
+    write(axis, position, true);
+    move.known = true;
+}
+
+void MotionEngine::cancel(Axis axis)
+{
+    Move& move = moves[static_cast<byte>(axis)];
+    if(!move.active)
+        return;
+
+    // The last position written is where it stops
+    move.active = false;
+    ended = true;
+    cancels++;
+}
+
+void MotionEngine::cancelAll()
+{
+    for(byte index = 0; index < kAxisCount; index++)
+        cancel(static_cast<Axis>(index));
+}
+
+bool MotionEngine::service()
+{
+    bool anyActive = false;
+    for(byte index = 0; index < kAxisCount; index++)
+        anyActive |= moves[index].active;
+
+    if(anyActive && (connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected))
+    {
+        cancelAll();
+        anyActive = false;
+    }
+
+    unsigned long now = millis();
+    if(anyActive && static_cast<long>(now - nextTick) >= 0)
+    {
+        // A late tick isn't made up for, the curve is worked out from the time so the move still ends on time
+        if(now - nextTick > tickMs)
+        {
+            lateTicks++;
+            nextTick = now + tickMs;
+        }
+        else
+            nextTick += tickMs;
+
+        for(byte index = 0; index < kAxisCount; index++)
+        {
+            Move& move = moves[index];
+            if(!move.active)
+                continue;
+
+            if(now - move.startTime >= move.durationMs)
+            {
+                // Ends exactly on the target, with a response so it's known to have got there
+                write(static_cast<Axis>(index), move.target, true);
+                move.active = false;
+                ended = true;
+                continue;
+            }
+
+            float position = positionNow(move, now);
+
+            // Nothing to send until it's moved a step the camera can see
+            if(CCUPacketTypes::toFixed16(position) != CCUPacketTypes::toFixed16(move.position))
+                write(static_cast<Axis>(index), position, false);
+        }
+    }
+
+    bool hasEnded = ended;
+    ended = false;
+
+    return hasEnded;
+}
+
+float MotionEngine::ease(Easing easing, float progress)
+{
+    switch(easing)
+    {
+        case Easing::EaseIn:
+            return progress * progress;
+        case Easing::EaseOut:
+            return progress * (2.0f - progress);
+        case Easing::SCurve:
+            return progress * progress * (3.0f - 2.0f * progress);
+        default:
+            return progress;
+    }
+}
+
+float MotionEngine::positionNow(const Move& move, unsigned long now)
+{
+    float progress = std::min(1.0f, static_cast<float>(now - move.startTime) / move.durationMs);
+    return move.start + (move.target - move.start) * ease(move.easing, progress);
+}
+
+void MotionEngine::write(Axis axis, float position, bool response)
+{
+    moves[static_cast<byte>(axis)].position = position;
+
+    if(connection == nullptr)
+        return;
+
+    switch(axis)
+    {
+        case Axis::Focus:
+            PacketWriter::writeFocusNormalised(position, connection, response);
+            break;
+        case Axis::Zoom:
+            PacketWriter::writeZoomNormalised(position, connection, response);
+            break;
+        case Axis::Iris:
+            PacketWriter::writeApertureNormalised(CCUPacketTypes::toFixed16(position), connection, response);
+            break;
+        default:
+            return;
+    }
+
+    writes++;
+}
+
+void MotionEngine::updateTick()
+{
+    // One write for each moving axis each time the camera can answer one
+    unsigned long writeMs = LinkHealthMonitor::getAverageWriteMicros() / 1000;
+    if(writeMs == 0)
+    {
+        tickMs = kDefaultTickMs;
+        return;
+    }
+
+    byte activeAxes = 0;
+    for(byte index = 0; index < kAxisCount; index++)
+        activeAxes += moves[index].active ? 1 : 0;
+
+    tickMs = writeMs * std::max(static_cast<byte>(1), activeAxes);
+    tickMs = std::max(static_cast<unsigned long>(kMinTickMs), std::min(static_cast<unsigned long>(kMaxTickMs), tickMs));
+}
+
+const char* MotionEngine::getAxisName(Axis axis)
+{
+    switch(axis)
+    {
+        case Axis::Focus:
+            return "Focus";
+        case Axis::Zoom:
+            return "Zoom";
+        case Axis::Iris:
+            return "Iris";
+        default:
+            return "Unknown";
+    }
+}
+
+const char* MotionEngine::getEasingName(Easing easing)
+{
+    switch(easing)
+    {
+        case Easing::Linear:
+            return "Linear";
+        case Easing::EaseIn:
+            return "EaseIn";
+        case Easing::EaseOut:
+            return "EaseOut";
+        case Easing::SCurve:
+            return "SCurve";
+        default:
+            return "Unknown";
+    }
+}
+
+bool MotionEngine::parseEasing(const char* name, Easing& easing)
+{
+    for(byte index = 0; index <= static_cast<byte>(Easing::SCurve); index++)
+    {
+        if(strcasecmp(name, getEasingName(static_cast<Easing>(index))) == 0)
+        {
+            easing = static_cast<Easing>(index);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void MotionEngine::reportStats()
+{
+    DEBUG_INFO("MotionEngine: %lu moves (%lu retargeted, %lu cancelled), %lu writes, %lu late ticks, ticks every %lu ms", movesStarted, retargets, cancels, writes, lateTicks, tickMs);
+}
@@ -0,0 +1,102 @@
+#ifndef MOTIONENGINE_H
+#define MOTIONENGINE_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+
+// Smooth focus, zoom and iris moves, e.g. a rack focus, rather than jumping straight to the new position.
+// A move goes from a start to a target (0.0 to 1.0, the same as the normalised lens commands) over a duration, following an easing
+// curve. Each tick the axis' position along the curve is written (without waiting for a response), the last one is the target with a
+// response. The tick is set when a move starts from how long the camera is taking to answer a write (LinkHealthMonitor), so the moves
+// go as smoothly as the link allows without queuing up writes. A new move on an axis that's moving starts from where it has got to.
+class MotionEngine
+{
+    public:
+        enum class Axis : byte
+        {
+            Focus = 0,  // 0.0 near to 1.0 far
+            Zoom,       // 0.0 wide to 1.0 telephoto
+            Iris,       // 0.0 open to 1.0 closed
+            Count
+        };
+
+        enum class Easing : byte
+        {
+            Linear = 0,
+            EaseIn,     // Starts slowly
+            EaseOut,    // Slows to a stop
+            SCurve      // Both, no sudden starts or stops
+        };
+
+        static void begin(BMDCameraConnection* inConnection);
+
+        // Replaces any move on the axis, the axis jumps to start first if it isn't already there
+        static void move(Axis axis, float start, float target, unsigned long durationMs, Easing easing = Easing::SCurve);
+
+        // From where the axis is now (part way through a move or the last position written). False if it hasn't been moved or set yet,
+        // so where it is isn't known.
+        static bool moveTo(Axis axis, float target, unsigned long durationMs, Easing easing = Easing::SCurve);
+
+        // Straight to the position, stopping any move
+        static void set(Axis axis, float position);
+
+        // Stops where it has got to, nothing more is written
+        static void cancel(Axis axis);
+        static void cancelAll();
+
+        // Call from loop(), writes the next positions when a tick is due. Returns true when a move has ended (or been cancelled) since
+        // the last call, e.g. so the screen can be redrawn.
+        static bool service();
+
+        static bool isMoving(Axis axis) { return moves[static_cast<byte>(axis)].active; }
+        static bool hasPosition(Axis axis) { return moves[static_cast<byte>(axis)].known; }
+        static float getPosition(Axis axis) { return moves[static_cast<byte>(axis)].position; } // Last written
+        static float getTarget(Axis axis) { return moves[static_cast<byte>(axis)].target; }
+        static unsigned long getTickMs() { return tickMs; }
+
+        static const char* getAxisName(Axis axis);
+        static const char* getEasingName(Easing easing);
+        static bool parseEasing(const char* name, Easing& easing); // e.g. "SCURVE", not case sensitive
+
+        // How far along the curve it is, progress 0.0 to 1.0
+        static float ease(Easing easing, float progress);
+
+        static void reportStats();
+
+    private:
+        static const unsigned long kMinTickMs = 20;
+        static const unsigned long kMaxTickMs = 200;
+        static const unsigned long kDefaultTickMs = 50;     // Until a write's been timed
+        static const byte kAxisCount = static_cast<byte>(Axis::Count);
+
+        struct Move
+        {
+            bool active = false;
+            bool known = false;         // position is where the axis is
+            float start = 0;
+            float target = 0;
+            float position = 0;
+            Easing easing = Easing::SCurve;
+            unsigned long startTime = 0;
+            unsigned long durationMs = 0;
+        };
+
+        static float positionNow(const Move& move, unsigned long now);
+        static void write(Axis axis, float position, bool response);
+        static void updateTick();
+
+        static BMDCameraConnection* connection;
+        static Move moves[kAxisCount];
+        static unsigned long tickMs;
+        static unsigned long nextTick;
+        static bool ended;
+
+        static unsigned long movesStarted;
+        static unsigned long retargets;         // New moves on an axis that was already moving
+        static unsigned long cancels;
+        static unsigned long writes;
+        static unsigned long lateTicks;
+};
+
+#endif
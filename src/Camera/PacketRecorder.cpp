@@ -0,0 +1,201 @@
+#include "PacketRecorder.h"
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+const char PacketRecorder::kFileMagic[4] = { 'M', 'P', 'C', 'R' };
+
+volatile bool PacketRecorder::recording = false;
+File PacketRecorder::captureFile;
+TaskHandle_t PacketRecorder::writerHandle = nullptr;
+portMUX_TYPE PacketRecorder::bufferMux = portMUX_INITIALIZER_UNLOCKED;
+
+uint8_t* PacketRecorder::buffer = nullptr;
+volatile size_t PacketRecorder::head = 0;
+volatile size_t PacketRecorder::tail = 0;
+
+unsigned long PacketRecorder::recordCount = 0;
+unsigned long PacketRecorder::droppedCount = 0;
+unsigned long PacketRecorder::bytesWritten = 0;
+
+bool PacketRecorder::begin(const char* path)
+{
+    if(recording)
+        return true;
+
+    if(!FFat.begin(true))
+    {
+        DEBUG_ERROR("PacketRecorder: Unable to mount FFat, is there an ffat partition?");
+        return false;
+    }
+
+    // Use PSRAM for the buffer if we have it
+    if(buffer == nullptr)
+    {
+        buffer = static_cast<uint8_t*>(heap_caps_malloc(kBufferSize, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if(buffer == nullptr)
+            buffer = static_cast<uint8_t*>(malloc(kBufferSize));
+
+        if(buffer == nullptr)
+        {
+            DEBUG_ERROR("PacketRecorder: Unable to allocate capture buffer");
+            return false;
+        }
+    }
+
+    captureFile = FFat.open(path, FILE_WRITE);
+    if(!captureFile)
+    {
+        DEBUG_ERROR("PacketRecorder: Unable to create %s", path);
+        return false;
+    }
+
+    byte header[kFileHeaderSize] = { 0 };
+    memcpy(header, kFileMagic, sizeof(kFileMagic));
+    header[4] = kFileVersion;
+    captureFile.write(header, sizeof(header));
+
+    head = 0;
+    tail = 0;
+    recordCount = 0;
+    droppedCount = 0;
+    bytesWritten = sizeof(header);
+
+    recording = true;
+
+    // Low priority, it only needs to keep up with the camera's packet rate
+    xTaskCreate(writerTask, "PacketRecorder", 4096, nullptr, 1, &writerHandle);
+
+    DEBUG_INFO("PacketRecorder: Recording to %s (%u bytes free)", path, static_cast<unsigned int>(FFat.freeBytes()));
+
+    return true;
+}
+
+void PacketRecorder::end()
+{
+    if(!recording)
+        return;
+
+    recording = false;
+
+    // Writer task does a final write and closes the file before deleting itself
+    while(writerHandle != nullptr)
+        vTaskDelay(1);
+
+    DEBUG_INFO("PacketRecorder: Stopped, %lu records, %lu bytes, %lu dropped", recordCount, bytesWritten, droppedCount);
+}
+
+bool PacketRecorder::dump(Stream& output, const char* path)
+{
+    if(recording || !FFat.begin(false))
+        return false;
+
+    File file = FFat.open(path, FILE_READ);
+    if(!file)
+        return false;
+
+    output.printf("MPCR-BEGIN %s %u\n", path, static_cast<unsigned int>(file.size()));
+
+    uint8_t line[32];
+    size_t read;
+    while((read = file.read(line, sizeof(line))) > 0)
+    {
+        for(size_t index = 0; index < read; index++)
+            output.printf("%02X", line[index]);
+
+        output.print("\n");
+    }
+
+    output.print("MPCR-END\n");
+    file.close();
+
+    return true;
+}
+
+void PacketRecorder::record(RecordType type, const uint8_t* data, size_t length)
+{
+    if(!recording)
+        return;
+
+    if(length > kMaxRecordLength)
+    {
+        droppedCount++;
+        return;
+    }
+
+    uint64_t timestamp = esp_timer_get_time();
+    size_t recordSize = kRecordHeaderSize + length;
+
+    portENTER_CRITICAL(&bufferMux);
+
+    size_t used = (head + kBufferSize - tail) % kBufferSize;
+    if(kBufferSize - used - 1 < recordSize)
+    {
+        // Writer can't keep up, drop rather than block the BLE task
+        droppedCount++;
+        portEXIT_CRITICAL(&bufferMux);
+        return;
+    }
+
+    uint8_t recordHeader[kRecordHeaderSize];
+    memcpy(recordHeader, &timestamp, sizeof(timestamp));
+    recordHeader[8] = static_cast<uint8_t>(type);
+    recordHeader[9] = static_cast<uint8_t>(length);
+
+    for(size_t index = 0; index < kRecordHeaderSize; index++)
+        buffer[(head + index) % kBufferSize] = recordHeader[index];
+
+    for(size_t index = 0; index < length; index++)
+        buffer[(head + kRecordHeaderSize + index) % kBufferSize] = data[index];
+
+    head = (head + recordSize) % kBufferSize;
+    recordCount++;
+
+    portEXIT_CRITICAL(&bufferMux);
+}
+
+// Writes whatever is in the ring buffer to the file, outside of the critical section
+void PacketRecorder::writeBuffered()
+{
+    size_t currentHead;
+
+    portENTER_CRITICAL(&bufferMux);
+    currentHead = head;
+    portEXIT_CRITICAL(&bufferMux);
+
+    size_t currentTail = tail;
+
+    if(currentHead == currentTail)
+        return;
+
+    // Either one contiguous block, or up to the end of the buffer and then from the start
+    if(currentHead > currentTail)
+    {
+        bytesWritten += captureFile.write(buffer + currentTail, currentHead - currentTail);
+    }
+    else
+    {
+        bytesWritten += captureFile.write(buffer + currentTail, kBufferSize - currentTail);
+        bytesWritten += captureFile.write(buffer, currentHead);
+    }
+
+    portENTER_CRITICAL(&bufferMux);
+    tail = currentHead;
+    portEXIT_CRITICAL(&bufferMux);
+}
+
+void PacketRecorder::writerTask(void* parameter)
+{
+    while(recording)
+    {
+        writeBuffered();
+        captureFile.flush();
+
+        vTaskDelay(pdMS_TO_TICKS(kFlushIntervalMs));
+    }
+
+    writeBuffered();
+    captureFile.close();
+
+    writerHandle = nullptr;
+    vTaskDelete(nullptr);
+}
@@ -0,0 +1,73 @@
+#ifndef PACKETRECORDER_H
+#define PACKETRECORDER_H
+
+#include <Arduino.h>
+#include <FFat.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "Arduino_DebugUtils.h"
+#include "Camera/ConstantsTypes.h"
+
+// Records every packet to/from the camera to a compact binary capture file on FFat so field issues can be replayed (see PacketReplayer).
+// Recording is cheap for the BLE task, records are copied into a RAM ring buffer and a background task writes them to the file.
+//
+// File format (little endian):
+//   Header:  "MPCR" (4 bytes), version (1 byte), 3 reserved bytes
+//   Records: timestamp in microseconds since boot (uint64, esp_timer_get_time() so it doesn't wrap), record type (1 byte),
+//            data length (1 byte, up to kMaxRecordLength), data
+//   Version 1 captures had a uint32 micros() timestamp, which wraps every ~71 minutes. PacketReplayer still reads them.
+class PacketRecorder
+{
+    public:
+        enum class RecordType : byte
+        {
+            IncomingCameraControl = 0,
+            OutgoingCameraControl = 1,
+            Timecode = 2,
+            CameraStatus = 3,
+            Count
+        };
+
+        static const char kFileMagic[4];
+        static const byte kFileVersion = 2;
+        static const byte kFileHeaderSize = 8;
+        static const byte kRecordHeaderSize = 10;
+        static const byte kRecordHeaderSizeVersion1 = 6;
+        static const byte kMaxRecordLength = 64;    // The largest packet the camera sends (CCUPacketTypes::kPacketSizeMax)
+
+        static bool begin(const char* path = "/capture.mpc"); // Mounts FFat and starts a new capture file
+        static void end(); // Flushes everything buffered and closes the file
+        static bool isRecording() { return recording; }
+
+        // Writes a capture file to the output as hex lines between MPCR-BEGIN and MPCR-END, for tools/mpc_capture.py to pull off the device
+        static bool dump(Stream& output, const char* path = "/capture.mpc");
+
+        // Called from the BLE notify functions and the outgoing write path
+        static void record(RecordType type, const uint8_t* data, size_t length);
+
+        static unsigned long getRecordCount() { return recordCount; }
+        static unsigned long getDroppedCount() { return droppedCount; }
+        static unsigned long getBytesWritten() { return bytesWritten; }
+
+    private:
+        static void writerTask(void* parameter);
+        static void writeBuffered();
+
+        static const size_t kBufferSize = 8192; // Ring buffer, several seconds of typical camera traffic
+        static const unsigned long kFlushIntervalMs = 250;
+
+        static volatile bool recording;
+        static File captureFile;
+        static TaskHandle_t writerHandle;
+        static portMUX_TYPE bufferMux;
+
+        static uint8_t* buffer;
+        static volatile size_t head; // Where the next record is written
+        static volatile size_t tail; // Where the writer task reads from
+
+        static unsigned long recordCount;
+        static unsigned long droppedCount;
+        static unsigned long bytesWritten;
+};
+
+#endif
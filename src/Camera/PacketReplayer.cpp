@@ -0,0 +1,222 @@
+#include "PacketReplayer.h"
+#include <esp_timer.h>
+
+File PacketReplayer::captureFile;
+bool PacketReplayer::running = false;
+float PacketReplayer::speed = 1.0f;
+PacketReplayer::Stats PacketReplayer::stats;
+
+byte PacketReplayer::fileVersion = PacketRecorder::kFileVersion;
+int64_t PacketReplayer::startMicros = 0;
+unsigned long PacketReplayer::baseModifiedCount = 0;
+bool PacketReplayer::firstRecord = true;
+uint64_t PacketReplayer::firstTimestamp = 0;
+uint32_t PacketReplayer::lastTimestampVersion1 = 0;
+
+bool PacketReplayer::recordPending = false;
+unsigned long PacketReplayer::recordIndex = 0;
+uint64_t PacketReplayer::recordTimestamp = 0;
+byte PacketReplayer::recordType = 0;
+byte PacketReplayer::recordLength = 0;
+uint8_t PacketReplayer::recordData[PacketRecorder::kMaxRecordLength];
+
+bool PacketReplayer::begin(const char* path, float speedFactor)
+{
+    if(running)
+        end();
+
+    // Replaying through the notify functions would record the packets again
+    if(PacketRecorder::isRecording())
+    {
+        DEBUG_ERROR("PacketReplayer: Stop the PacketRecorder before replaying");
+        return false;
+    }
+
+    if(!FFat.begin(false))
+    {
+        DEBUG_ERROR("PacketReplayer: Unable to mount FFat");
+        return false;
+    }
+
+    captureFile = FFat.open(path, FILE_READ);
+    if(!captureFile)
+    {
+        DEBUG_ERROR("PacketReplayer: Unable to open %s", path);
+        return false;
+    }
+
+    byte header[PacketRecorder::kFileHeaderSize];
+    if(captureFile.read(header, sizeof(header)) != sizeof(header) || memcmp(header, PacketRecorder::kFileMagic, sizeof(PacketRecorder::kFileMagic)) != 0)
+    {
+        DEBUG_ERROR("PacketReplayer: %s is not a capture file", path);
+        captureFile.close();
+        return false;
+    }
+
+    if(header[4] != PacketRecorder::kFileVersion && header[4] != 1)
+    {
+        DEBUG_ERROR("PacketReplayer: Capture version %i not supported", header[4]);
+        captureFile.close();
+        return false;
+    }
+
+    fileVersion = header[4];
+    speed = speedFactor;
+    stats = Stats();
+    firstRecord = true;
+    recordPending = false;
+    recordIndex = 0;
+
+    // A fresh camera, as if we'd just connected
+    BMDControlSystem::getInstance()->activateCamera();
+    baseModifiedCount = BMDControlSystem::getInstance()->getCamera()->getModifiedCount();
+
+    startMicros = esp_timer_get_time();
+    running = true;
+
+    DEBUG_INFO("PacketReplayer: Replaying %s (%u bytes) at %.1fx", path, static_cast<unsigned int>(captureFile.size()), speedFactor);
+
+    return true;
+}
+
+void PacketReplayer::end()
+{
+    if(!running)
+        return;
+
+    running = false;
+    captureFile.close();
+
+    stats.durationMs = static_cast<unsigned long>((esp_timer_get_time() - startMicros) / 1000);
+
+    if(BMDControlSystem::getInstance()->hasCamera())
+        stats.modelModifications = BMDControlSystem::getInstance()->getCamera()->getModifiedCount() - baseModifiedCount;
+}
+
+bool PacketReplayer::readRecord()
+{
+    byte recordHeader[PacketRecorder::kRecordHeaderSize];
+    size_t headerSize = fileVersion == 1 ? PacketRecorder::kRecordHeaderSizeVersion1 : PacketRecorder::kRecordHeaderSize;
+
+    if(captureFile.read(recordHeader, headerSize) != headerSize)
+        return false;
+
+    if(fileVersion == 1)
+    {
+        // micros(), wraps every ~71 minutes, so the time goes forward by the difference from the last record
+        uint32_t timestamp;
+        memcpy(&timestamp, recordHeader, sizeof(timestamp));
+        recordTimestamp = firstRecord ? timestamp : recordTimestamp + static_cast<uint32_t>(timestamp - lastTimestampVersion1);
+        lastTimestampVersion1 = timestamp;
+    }
+    else
+        memcpy(&recordTimestamp, recordHeader, sizeof(recordTimestamp));
+
+    recordType = recordHeader[headerSize - 2];
+    recordLength = recordHeader[headerSize - 1];
+    recordIndex++;
+
+    // Past a bad header the rest of the file can't be read in step, so there's nothing to skip to
+    if(recordType >= static_cast<byte>(PacketRecorder::RecordType::Count) || recordLength > PacketRecorder::kMaxRecordLength)
+    {
+        DEBUG_ERROR("PacketReplayer: Record %lu has type %i and length %i, the capture is corrupt", recordIndex, recordType, recordLength);
+        stats.corrupt = true;
+        return false;
+    }
+
+    if(captureFile.read(recordData, recordLength) != recordLength)
+    {
+        DEBUG_ERROR("PacketReplayer: Capture truncated");
+        return false;
+    }
+
+    if(firstRecord)
+    {
+        firstTimestamp = recordTimestamp;
+        firstRecord = false;
+    }
+
+    return true;
+}
+
+void PacketReplayer::dispatchRecord()
+{
+    unsigned long decodeStart = micros();
+
+    switch(static_cast<PacketRecorder::RecordType>(recordType))
+    {
+        case PacketRecorder::RecordType::IncomingCameraControl:
+            BMDCameraConnection::IncomingCameraControlNotify(nullptr, recordData, recordLength, true);
+            break;
+        case PacketRecorder::RecordType::Timecode:
+            BMDCameraConnection::IncomingTimecodeNotify(nullptr, recordData, recordLength, true);
+            break;
+        case PacketRecorder::RecordType::CameraStatus:
+            BMDCameraConnection::IncomingCameraStatusNotify(nullptr, recordData, recordLength, true);
+            break;
+        default:
+            // Outgoing, not sent, only counted (readRecord() has already turned away unknown types)
+            break;
+    }
+
+    unsigned long decodeMicros = micros() - decodeStart;
+
+    if(recordType != static_cast<byte>(PacketRecorder::RecordType::OutgoingCameraControl))
+    {
+        stats.decodeMicrosTotal += decodeMicros;
+        if(decodeMicros > stats.decodeMicrosMax)
+            stats.decodeMicrosMax = decodeMicros;
+    }
+
+    stats.recordsReplayed[recordType]++;
+}
+
+void PacketReplayer::service()
+{
+    if(!running)
+        return;
+
+    while(true)
+    {
+        if(!recordPending)
+        {
+            if(!readRecord())
+            {
+                end();
+                if(stats.corrupt)
+                    DEBUG_ERROR("PacketReplayer: Replay stopped after %lu records", recordIndex - 1);
+                else
+                    DEBUG_INFO("PacketReplayer: Replay complete");
+                reportStats();
+                return;
+            }
+
+            recordPending = true;
+        }
+
+        // 64 bit on both sides, a capture hours long replays with the gaps it had
+        uint64_t dueMicros = speed > 0 ? static_cast<uint64_t>((recordTimestamp - firstTimestamp) / speed) : 0;
+        uint64_t elapsedMicros = static_cast<uint64_t>(esp_timer_get_time() - startMicros);
+
+        if(elapsedMicros < dueMicros)
+            return; // Not due yet, keep the loop responsive
+
+        if(speed > 0 && elapsedMicros - dueMicros > stats.maxLateMicros)
+            stats.maxLateMicros = static_cast<unsigned long>(std::min<uint64_t>(elapsedMicros - dueMicros, ULONG_MAX));
+
+        dispatchRecord();
+        recordPending = false;
+    }
+}
+
+void PacketReplayer::reportStats()
+{
+    unsigned long durationMs = running ? static_cast<unsigned long>((esp_timer_get_time() - startMicros) / 1000) : stats.durationMs;
+    unsigned long decoded = stats.recordsReplayed[0] + stats.recordsReplayed[2] + stats.recordsReplayed[3];
+    unsigned long averageDecodeMicros = decoded != 0 ? stats.decodeMicrosTotal / decoded : 0;
+
+    DEBUG_INFO("PacketReplayer: Replayed over %lums at %.1fx", durationMs, speed);
+    DEBUG_INFO("  Camera control %lu, timecode %lu, camera status %lu, outgoing (not sent) %lu", stats.recordsReplayed[0], stats.recordsReplayed[2], stats.recordsReplayed[3], stats.recordsReplayed[1]);
+    DEBUG_INFO("  Decode average %luus, max %luus, total %luus", averageDecodeMicros, stats.decodeMicrosMax, stats.decodeMicrosTotal);
+    DEBUG_INFO("  Max late %luus, camera modifications %lu", stats.maxLateMicros, stats.modelModifications);
+}
@@ -0,0 +1,65 @@
+#ifndef PACKETREPLAYER_H
+#define PACKETREPLAYER_H
+
+#include <Arduino.h>
+#include <FFat.h>
+#include "Arduino_DebugUtils.h"
+#include "Camera/PacketRecorder.h"
+#include "Camera/BMDCameraConnection.h"
+#include "BMDControlSystem.h"
+
+// Replays a PacketRecorder capture from FFat through the same notify functions as the BLE connection,
+// so the decoding and camera model see exactly the packets (and order) the camera sent.
+// Outgoing packets in the capture are counted but not sent anywhere. A record with an unknown type or a length longer than any packet
+// means the file is corrupt (everything after it would be read out of step), so the replay stops there.
+class PacketReplayer
+{
+    public:
+        struct Stats
+        {
+            unsigned long durationMs = 0;
+            unsigned long recordsReplayed[static_cast<byte>(PacketRecorder::RecordType::Count)] = { 0 }; // By PacketRecorder::RecordType
+            unsigned long decodeMicrosTotal = 0;
+            unsigned long decodeMicrosMax = 0;
+            unsigned long maxLateMicros = 0; // Furthest behind the capture's timing a record was decoded
+            unsigned long modelModifications = 0;
+            bool corrupt = false;            // Stopped at a record that couldn't be read
+        };
+
+        // speedFactor of 1.0 replays at the original timing, 10.0 at ten times the speed, 0 as fast as possible
+        static bool begin(const char* path = "/capture.mpc", float speedFactor = 1.0f);
+        static void end();
+        static bool isRunning() { return running; }
+
+        // Call from loop(), decodes every record that is due
+        static void service();
+
+        static Stats getStats() { return stats; }
+        static void reportStats();
+
+    private:
+        static bool readRecord();
+        static void dispatchRecord();
+
+        static File captureFile;
+        static bool running;
+        static float speed;
+        static Stats stats;
+
+        static byte fileVersion;
+        static int64_t startMicros;             // esp_timer_get_time(), so long replays don't wrap
+        static unsigned long baseModifiedCount;
+        static bool firstRecord;
+        static uint64_t firstTimestamp;
+        static uint32_t lastTimestampVersion1;  // Version 1's wrapping timestamps are added up from the differences
+
+        // Next record waiting to be dispatched
+        static bool recordPending;
+        static unsigned long recordIndex;
+        static uint64_t recordTimestamp;
+        static byte recordType;
+        static byte recordLength;
+        static uint8_t recordData[PacketRecorder::kMaxRecordLength];
+};
+
+#endif
@@ -10,10 +10,10 @@ void PacketWriter::validateAndSendCCUCommand(CCUPacketTypes::Command command, BM
         DEBUG_ERROR("PacketWriter::validateAndSendCCUCommand: Invalid Packet");
 }
 
-void PacketWriter::writeWhiteBalance(short whiteBalance, short tint, BMDCameraConnection* connection)
+void PacketWriter::writeWhiteBalance(short whiteBalance, short tint, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateVideoWhiteBalanceCommand(whiteBalance, tint);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 void PacketWriter::writeAutoWhiteBalance(BMDCameraConnection* connection)
@@ -22,36 +22,36 @@ void PacketWriter::writeAutoWhiteBalance(BMDCameraConnection* connection)
     validateAndSendCCUCommand(command, connection);
 }
 
-void PacketWriter::writeRecordingFormat(CCUPacketTypes::RecordingFormatData recordingFormatData, BMDCameraConnection* connection)
+void PacketWriter::writeRecordingFormat(CCUPacketTypes::RecordingFormatData recordingFormatData, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateRecordingFormatCommand(recordingFormatData);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
-void PacketWriter::writeApertureNormalised(short normalisedApertureValue, BMDCameraConnection* connection)
+void PacketWriter::writeApertureNormalised(short normalisedApertureValue, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(normalisedApertureValue, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::ApertureNormalised);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
-void PacketWriter::writeIris(short apertureValue, BMDCameraConnection* connection)
+void PacketWriter::writeIris(short apertureValue, BMDCameraConnection* connection, bool response)
 {
     DEBUG_DEBUG("writeIris, AV:");
     DEBUG_DEBUG(std::to_string(apertureValue).c_str());
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(apertureValue, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::ApertureFstop);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
-void PacketWriter::writeShutterSpeed(int shutter, BMDCameraConnection* connection)
+void PacketWriter::writeShutterSpeed(int shutter, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateCommand(shutter, CCUPacketTypes::Category::Video, (byte)CCUPacketTypes::VideoParameter::ShutterSpeed);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
-void PacketWriter::writeShutterAngle(int shutterAngleX100, BMDCameraConnection* connection)
+void PacketWriter::writeShutterAngle(int shutterAngleX100, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateShutterAngleCommand(shutterAngleX100);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 void PacketWriter::writeSensorGain(int sensorGain, BMDCameraConnection* connection)
@@ -61,10 +61,10 @@ void PacketWriter::writeSensorGain(int sensorGain, BMDCameraConnection* connecti
     validateAndSendCCUCommand(command, connection);
 }
 
-void PacketWriter::writeISO(int iso, BMDCameraConnection* connection)
+void PacketWriter::writeISO(int iso, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateVideoISOCommand(iso);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 void PacketWriter::writeTransportInfo(TransportInfo transportInfo, BMDCameraConnection* connection)
@@ -73,10 +73,16 @@ void PacketWriter::writeTransportInfo(TransportInfo transportInfo, BMDCameraConn
     validateAndSendCCUCommand(command, connection);
 }
 
-void PacketWriter::writeCodec(CodecInfo codecInfo, BMDCameraConnection* connection)
+void PacketWriter::writeCodec(CodecInfo codecInfo, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateCodecCommand(codecInfo);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
+}
+
+void PacketWriter::writeDisplayLUT(CCUPacketTypes::SelectedLUT selectedLUT, bool enabled, BMDCameraConnection* connection, bool response)
+{
+    CCUPacketTypes::Command command = CCUEncodingFunctions::CreateDisplayLUTCommand(selectedLUT, enabled);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 void PacketWriter::writeAutoFocus(BMDCameraConnection* connection)
@@ -87,7 +93,7 @@ void PacketWriter::writeAutoFocus(BMDCameraConnection* connection)
 
 // Focus position is 0 to 65435
 // NOTE - this uses an offset of the previous value (which works on the URSA Mini G2, whereas a set value does not)
-void PacketWriter::writeFocusPositionWithOffset(int32_t focusPositionOffset, BMDCameraConnection* connection)
+void PacketWriter::writeFocusPositionWithOffset(int32_t focusPositionOffset, BMDCameraConnection* connection, bool response)
 {
     float focusFloatPosition = static_cast<float>(focusPositionOffset) / static_cast<float>(65435);
 
@@ -95,12 +101,12 @@ void PacketWriter::writeFocusPositionWithOffset(int32_t focusPositionOffset, BMD
 
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(fixedFromFloat, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::Focus, CCUPacketTypes::OperationType::OffsetValue);
 
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 // Focus position is 0 to 65435
 // NOTE - this uses the specific focus position to move to
-void PacketWriter::writeFocusPositionWithActual(int32_t focusPosition, BMDCameraConnection* connection)
+void PacketWriter::writeFocusPositionWithActual(int32_t focusPosition, BMDCameraConnection* connection, bool response)
 {
     float focusFloatPosition = static_cast<float>(focusPosition) / static_cast<float>(65435);
 
@@ -108,32 +114,32 @@ void PacketWriter::writeFocusPositionWithActual(int32_t focusPosition, BMDCamera
 
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(fixedFromFloat, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::Focus, CCUPacketTypes::OperationType::AssignValue);
 
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 // Focus position is 0.0 (near) to 1.0 (far)
-void PacketWriter::writeFocusNormalised(float focusPosition, BMDCameraConnection* connection)
+void PacketWriter::writeFocusNormalised(float focusPosition, BMDCameraConnection* connection, bool response)
 {
     int16_t shortFocusPosition = CCUPacketTypes::toFixed16(focusPosition);
 
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(shortFocusPosition, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::Focus);
 
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 // Zoom position (can't confirm this works as I don't have the lens, let me know if it doesn't)
-void PacketWriter::writeZoomMM(short zoomPositionMM, BMDCameraConnection* connection)
+void PacketWriter::writeZoomMM(short zoomPositionMM, BMDCameraConnection* connection, bool response)
 {
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateInt16Command(zoomPositionMM, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::Zoom);
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
 
 // Focus position is 0.0 (widest) to 1.0 (telephoto)
-void PacketWriter::writeZoomNormalised(float zoomPosition, BMDCameraConnection* connection)
+void PacketWriter::writeZoomNormalised(float zoomPosition, BMDCameraConnection* connection, bool response)
 {
     int16_t shortZoomPosition = CCUPacketTypes::toFixed16(zoomPosition);
 
     CCUPacketTypes::Command command = CCUEncodingFunctions::CreateFixed16Command(shortZoomPosition, CCUPacketTypes::Category::Lens, (byte)CCUPacketTypes::LensParameter::ZoomNormalised);
 
-    validateAndSendCCUCommand(command, connection);
+    validateAndSendCCUCommand(command, connection, response);
 }
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "ReconnectScheduler.h"
+#include <esp_random.h>
+
+bool ReconnectScheduler::waiting = false;
+byte ReconnectScheduler::attempt = 0;
+unsigned long ReconnectScheduler::nextAttemptTime = 0;
+unsigned long ReconnectScheduler::disconnectedTime = 0;
+bool ReconnectScheduler::wasConnected = false;
+ReconnectScheduler::Stats ReconnectScheduler::stats;
+
+unsigned long ReconnectScheduler::backoffMs(byte attemptNumber)
+{
+    unsigned long backoff = kBackoffBaseMs;
+    for(byte index = 0; index < attemptNumber && backoff < kBackoffMaxMs; index++)
+        backoff *= 2;
+
+    if(backoff > kBackoffMaxMs)
+        backoff = kBackoffMaxMs;
+
+    // Jitter of +/- kJitterPercent
+    long jitterRange = (backoff * kJitterPercent) / 100;
+    long jitter = static_cast<long>(esp_random() % (2 * jitterRange + 1)) - jitterRange;
+
+    return backoff + jitter;
+}
+
+void ReconnectScheduler::startWaiting()
+{
+    unsigned long now = millis();
+
+    // First time we've noticed the connection was lost
+    if(wasConnected && disconnectedTime == 0)
+        disconnectedTime = now;
+
+    unsigned long backoff = backoffMs(attempt);
+    nextAttemptTime = now + backoff;
+    waiting = true;
+
+    DEBUG_VERBOSE("ReconnectScheduler: Attempt %i in %lums", attempt + 1, backoff);
+}
+
+bool ReconnectScheduler::attemptDue()
+{
+    if(!waiting || static_cast<long>(millis() - nextAttemptTime) < 0)
+        return false;
+
+    waiting = false;
+
+    if(attempt < 255)
+        attempt++;
+
+    stats.attempts++;
+
+    return true;
+}
+
+void ReconnectScheduler::knownCameraSeen()
+{
+    stats.knownCameraSeen++;
+
+    waiting = false;
+    attempt = 0;
+}
+
+void ReconnectScheduler::connected()
+{
+    if(disconnectedTime != 0)
+    {
+        unsigned long reconnectMs = millis() - disconnectedTime;
+
+        stats.reconnects++;
+        stats.lastReconnectMs = reconnectMs;
+        stats.totalReconnectMs += reconnectMs;
+        if(reconnectMs > stats.maxReconnectMs)
+            stats.maxReconnectMs = reconnectMs;
+
+        DEBUG_INFO("ReconnectScheduler: Reconnected in %lums after %i attempt(s)", reconnectMs, attempt);
+    }
+
+    waiting = false;
+    attempt = 0;
+    disconnectedTime = 0;
+    wasConnected = true;
+}
+
+unsigned long ReconnectScheduler::getNextAttemptInMs()
+{
+    if(!waiting)
+        return 0;
+
+    long remaining = static_cast<long>(nextAttemptTime - millis());
+    return remaining > 0 ? remaining : 0;
+}
+
+void ReconnectScheduler::reportStats()
+{
+    unsigned long averageMs = stats.reconnects != 0 ? stats.totalReconnectMs / stats.reconnects : 0;
+
+    DEBUG_INFO("ReconnectScheduler: %lu reconnects (last %lums, average %lums, max %lums), %lu scans, %lu cut short by a known camera",
+        stats.reconnects, stats.lastReconnectMs, averageMs, stats.maxReconnectMs, stats.attempts, stats.knownCameraSeen);
+}
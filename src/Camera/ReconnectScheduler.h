@@ -0,0 +1,49 @@
+#ifndef RECONNECTSCHEDULER_H
+#define RECONNECTSCHEDULER_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+
+// Decides when BMDCameraConnection should next try to reconnect. Each failed attempt doubles the wait (with jitter so
+// multiple controllers don't scan in step), up to a maximum. Seeing a bonded camera advertising skips the wait.
+// Also keeps time-to-reconnect statistics, from when the connection was lost until we're connected again.
+class ReconnectScheduler
+{
+    public:
+        struct Stats
+        {
+            unsigned long reconnects = 0;
+            unsigned long attempts = 0;      // Scans started
+            unsigned long knownCameraSeen = 0; // Times a bonded camera's advertisement cut the wait short
+            unsigned long lastReconnectMs = 0;
+            unsigned long maxReconnectMs = 0;
+            unsigned long totalReconnectMs = 0;
+        };
+
+        static bool isWaiting() { return waiting; }
+        static void startWaiting(); // Not connected, work out when the next attempt is
+        static bool attemptDue();   // True (once) when it's time for the next attempt
+
+        static void knownCameraSeen(); // A bonded camera is advertising, connect straight away
+        static void connected();       // Connected, reset the backoff and record the time it took
+
+        static unsigned long getNextAttemptInMs();
+        static Stats getStats() { return stats; }
+        static void reportStats();
+
+    private:
+        static unsigned long backoffMs(byte attempt);
+
+        static const unsigned long kBackoffBaseMs = 1000;
+        static const unsigned long kBackoffMaxMs = 30000;
+        static const byte kJitterPercent = 25; // +/- this percentage of the backoff
+
+        static bool waiting;
+        static byte attempt;
+        static unsigned long nextAttemptTime;
+        static unsigned long disconnectedTime; // 0 = we haven't been connected yet (or are connected)
+        static bool wasConnected;
+        static Stats stats;
+};
+
+#endif
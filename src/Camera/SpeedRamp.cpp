@@ -0,0 +1,276 @@
+#include "SpeedRamp.h"
+#include "PacketWriter.h"
+#include "LinkHealthMonitor.h"
+#include "Config/VideoConfig.h"
+
+BMDCameraConnection* SpeedRamp::connection = nullptr;
+bool SpeedRamp::running = false;
+bool SpeedRamp::ended = false;
+CCUPacketTypes::RecordingFormatData SpeedRamp::baseFormat;
+short SpeedRamp::fromRate = 0;
+short SpeedRamp::toRate = 0;
+unsigned long SpeedRamp::durationMs = 0;
+MotionEngine::Easing SpeedRamp::easing = MotionEngine::Easing::SCurve;
+unsigned long SpeedRamp::startMillis = 0;
+short SpeedRamp::sentRate = 0;
+unsigned long SpeedRamp::sentMillis = 0;
+bool SpeedRamp::awaitingEcho = false;
+
+unsigned long SpeedRamp::ramps = 0;
+unsigned long SpeedRamp::stepsSent = 0;
+unsigned long SpeedRamp::stepsVerified = 0;
+unsigned long SpeedRamp::stepsUnverified = 0;
+unsigned long SpeedRamp::ratesSkipped = 0;
+unsigned long SpeedRamp::averageEchoMs = 0;
+unsigned long SpeedRamp::maxEchoMs = 0;
+
+void SpeedRamp::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+}
+
+bool SpeedRamp::start(short fromFrameRate, short toFrameRate, unsigned long inDurationMs, MotionEngine::Easing inEasing)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera() || !BMDControlSystem::getInstance()->getCamera()->hasRecordingFormat())
+    {
+        DEBUG_ERROR("SpeedRamp: The camera's recording format isn't known yet");
+        return false;
+    }
+
+    if(!validRate(fromFrameRate) || !validRate(toFrameRate))
+    {
+        DEBUG_ERROR("SpeedRamp: Frame rates are %i to %i fps", VideoConfig::kOffSpeedFrameRateMin, static_cast<int>(kMaxFrameRate));
+        return false;
+    }
+
+    baseFormat = BMDControlSystem::getInstance()->getCamera()->getRecordingFormat();
+    baseFormat.offSpeedEnabled = true;
+
+    fromRate = fromFrameRate;
+    toRate = toFrameRate;
+    durationMs = inDurationMs;
+    easing = inEasing;
+    startMillis = millis();
+    sentRate = 0;
+    awaitingEcho = false;
+    running = true;
+
+    ramps++;
+
+    DEBUG_VERBOSE("SpeedRamp: %i to %i fps over %lu ms (%s), a step every %lu ms or so", fromRate, toRate, durationMs, MotionEngine::getEasingName(easing), getStepMs());
+
+    // The first rate goes now rather than on the next loop()
+    service();
+
+    return true;
+}
+
+bool SpeedRamp::startTo(short toFrameRate, unsigned long inDurationMs, MotionEngine::Easing inEasing)
+{
+    short fromFrameRate = 0;
+    if(!cameraFrameRate(fromFrameRate))
+    {
+        DEBUG_ERROR("SpeedRamp: The camera's recording format isn't known yet");
+        return false;
+    }
+
+    return start(fromFrameRate, toFrameRate, inDurationMs, inEasing);
+}
+
+bool SpeedRamp::dryRun(short fromFrameRate, short toFrameRate, unsigned long inDurationMs, MotionEngine::Easing inEasing, Stream& output)
+{
+    if(fromFrameRate == 0 && !cameraFrameRate(fromFrameRate))
+    {
+        output.println("SPEEDRAMP: The camera's recording format isn't known yet");
+        return false;
+    }
+
+    if(!validRate(fromFrameRate) || !validRate(toFrameRate))
+    {
+        output.printf("SPEEDRAMP: Frame rates are %i to %i fps\n", VideoConfig::kOffSpeedFrameRateMin, static_cast<int>(kMaxFrameRate));
+        return false;
+    }
+
+    unsigned long stepMs = getStepMs();
+    output.printf("SPEEDRAMP: %i to %i fps over %lu ms (%s)\n", fromFrameRate, toFrameRate, inDurationMs, MotionEngine::getEasingName(inEasing));
+    output.printf("SPEEDRAMP: The camera takes a change every %lu ms (%s), %.1f steps a second\n", stepMs, averageEchoMs != 0 ? "measured" : "estimated", 1000.0f / stepMs);
+
+    // The same as service(), a step as soon as the last has been echoed, then the target once the time is up
+    unsigned int steps = 0;
+    unsigned int skipped = 0;
+    short lastRate = 0;
+    unsigned long elapsed = 0;
+    unsigned long lastStepMs = 0;
+
+    while(true)
+    {
+        bool finished = elapsed >= inDurationMs;
+        short rate = finished ? toFrameRate : rateAt(fromFrameRate, toFrameRate, inDurationMs, inEasing, elapsed);
+
+        if(rate != lastRate)
+        {
+            if(lastRate != 0)
+                skipped += abs(rate - lastRate) - 1;
+
+            output.printf("  %6lu ms  %i fps\n", elapsed, rate);
+            lastRate = rate;
+            lastStepMs = elapsed;
+            steps++;
+            elapsed += stepMs;
+        }
+        else if(finished)
+            break;
+        else
+            elapsed = std::min(inDurationMs, elapsed + kMinStepMs);
+    }
+
+    unsigned int rates = abs(toFrameRate - fromFrameRate) + 1;
+    output.printf("SPEEDRAMP: %u steps for %u frame rates, %u skipped, the last sent at %lu ms\n", steps, rates, skipped, lastStepMs);
+
+    return true;
+}
+
+void SpeedRamp::stop()
+{
+    if(!running)
+        return;
+
+    running = false;
+    ended = true;
+
+    DEBUG_VERBOSE("SpeedRamp: Stopped at %i fps", sentRate);
+}
+
+bool SpeedRamp::service()
+{
+    bool hasEnded = ended;
+    ended = false;
+
+    if(!running)
+        return hasEnded;
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected)
+    {
+        stop();
+        ended = false;
+        return true;
+    }
+
+    unsigned long now = millis();
+
+    // One change in flight at a time, the next waits for the camera to echo this one back
+    if(awaitingEcho)
+    {
+        unsigned long echoMs = now - sentMillis;
+
+        if(echoed(sentRate))
+        {
+            awaitingEcho = false;
+            stepsVerified++;
+            averageEchoMs = averageEchoMs == 0 ? echoMs : (averageEchoMs * 7 + echoMs) / 8;
+            maxEchoMs = std::max(maxEchoMs, echoMs);
+        }
+        else if(echoMs >= kEchoTimeoutMs)
+        {
+            awaitingEcho = false;
+            stepsUnverified++;
+            DEBUG_ERROR("SpeedRamp: %i fps wasn't echoed by the camera", sentRate);
+        }
+        else
+            return hasEnded;
+
+        if(now - sentMillis < kMinStepMs)
+            return hasEnded;
+    }
+
+    unsigned long elapsed = now - startMillis;
+    short rate = elapsed >= durationMs ? toRate : rateAt(fromRate, toRate, durationMs, easing, elapsed);
+
+    if(rate != sentRate)
+    {
+        if(sentRate != 0)
+            ratesSkipped += abs(rate - sentRate) - 1;
+
+        write(rate);
+    }
+    else if(elapsed >= durationMs)
+    {
+        // On the target and echoed (or given up on)
+        running = false;
+        hasEnded = true;
+
+        DEBUG_VERBOSE("SpeedRamp: Finished at %i fps, %lu ms late", toRate, elapsed - durationMs);
+    }
+
+    return hasEnded;
+}
+
+unsigned long SpeedRamp::getStepMs()
+{
+    unsigned long stepMs = averageEchoMs;
+
+    // Until a ramp has run, the round trip of a write with a response is the nearest thing
+    if(stepMs == 0)
+        stepMs = LinkHealthMonitor::getAverageWriteMicros() / 1000;
+
+    if(stepMs == 0)
+        stepMs = kDefaultStepMs;
+
+    return std::max(static_cast<unsigned long>(kMinStepMs), stepMs);
+}
+
+bool SpeedRamp::cameraFrameRate(short& frameRate)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera() || !BMDControlSystem::getInstance()->getCamera()->hasRecordingFormat())
+        return false;
+
+    CCUPacketTypes::RecordingFormatData format = BMDControlSystem::getInstance()->getCamera()->getRecordingFormat();
+    frameRate = format.offSpeedEnabled ? format.offSpeedFrameRate : format.frameRate;
+
+    return true;
+}
+
+bool SpeedRamp::validRate(short frameRate)
+{
+    return frameRate >= VideoConfig::kOffSpeedFrameRateMin && frameRate <= kMaxFrameRate;
+}
+
+short SpeedRamp::rateAt(short fromFrameRate, short toFrameRate, unsigned long rampMs, MotionEngine::Easing rampEasing, unsigned long elapsedMs)
+{
+    float progress = rampMs == 0 ? 1.0f : std::min(1.0f, static_cast<float>(elapsedMs) / rampMs);
+    return static_cast<short>(lroundf(fromFrameRate + (toFrameRate - fromFrameRate) * MotionEngine::ease(rampEasing, progress)));
+}
+
+bool SpeedRamp::echoed(short frameRate)
+{
+    if(!BMDControlSystem::getInstance()->hasCamera() || !BMDControlSystem::getInstance()->getCamera()->hasRecordingFormat())
+        return false;
+
+    CCUPacketTypes::RecordingFormatData format = BMDControlSystem::getInstance()->getCamera()->getRecordingFormat();
+    return format.offSpeedEnabled && format.offSpeedFrameRate == frameRate;
+}
+
+void SpeedRamp::write(short frameRate)
+{
+    sentRate = frameRate;
+    sentMillis = millis();
+    stepsSent++;
+
+    // Already there (e.g. the first step), nothing to wait for
+    if(echoed(frameRate))
+    {
+        stepsVerified++;
+        return;
+    }
+
+    CCUPacketTypes::RecordingFormatData format = baseFormat;
+    format.offSpeedFrameRate = frameRate;
+    PacketWriter::writeRecordingFormat(format, connection);
+
+    awaitingEcho = true;
+}
+
+void SpeedRamp::reportStats()
+{
+    DEBUG_INFO("SpeedRamp: %lu ramps, %lu steps (%lu echoed, %lu not), %lu rates skipped, echoed in %lu ms on average, %lu ms at most", ramps, stepsSent, stepsVerified, stepsUnverified, ratesSkipped, averageEchoMs, maxEchoMs);
+}
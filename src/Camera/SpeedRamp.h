@@ -0,0 +1,77 @@
+#ifndef SPEEDRAMP_H
+#define SPEEDRAMP_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+#include "MotionEngine.h"
+
+// Ramps the off-speed (sensor) frame rate from one rate to another over a duration along an easing curve, e.g. 24 to 120 fps over
+// 4 seconds for a speed ramp in camera. Each change is a recording format write, the camera's other settings are kept as they were.
+// Only one change is in flight at a time: the next isn't sent until the camera has echoed the last one back in its recording format
+// (or it's timed out), so the ramp goes at the rate the camera takes changes. Rates the curve passes between two steps are skipped,
+// the ramp still ends on time and on the target rate. A dry run works out the steps against how fast the camera has been taking
+// changes and writes them out without sending anything.
+class SpeedRamp
+{
+    public:
+        static void begin(BMDCameraConnection* inConnection);
+
+        // Off-speed frame rates, from and to. False if the camera's recording format isn't known yet or a rate is out of range.
+        static bool start(short fromFrameRate, short toFrameRate, unsigned long durationMs, MotionEngine::Easing easing = MotionEngine::Easing::SCurve);
+
+        // From the camera's off-speed frame rate, or its project frame rate when it's not off-speed
+        static bool startTo(short toFrameRate, unsigned long durationMs, MotionEngine::Easing easing = MotionEngine::Easing::SCurve);
+
+        // Writes out the steps the ramp would send and how many frame rates it would skip, nothing is sent to the camera.
+        // A from frame rate of 0 is the camera's, as startTo().
+        static bool dryRun(short fromFrameRate, short toFrameRate, unsigned long durationMs, MotionEngine::Easing easing, Stream& output);
+
+        // Leaves the camera at the last rate it was sent
+        static void stop();
+
+        // Call from loop(), sends the next rate once the last has been echoed. Returns true when a ramp has finished (or been stopped).
+        static bool service();
+
+        static bool isRunning() { return running; }
+
+        // How long the camera takes to echo a change, or an estimate from the link until it's been seen
+        static unsigned long getStepMs();
+
+        static void reportStats();
+
+    private:
+        static const short kMaxFrameRate = 300;                 // The highest off-speed rate the screens offer (BRAW, HD)
+        static const unsigned long kMinStepMs = 40;
+        static const unsigned long kDefaultStepMs = 150;        // Before there's anything to go on
+        static const unsigned long kEchoTimeoutMs = 1000;       // Not echoed by then, the camera didn't take it (or it's out of range)
+
+        static bool cameraFrameRate(short& frameRate);
+        static bool validRate(short frameRate);
+        static short rateAt(short fromFrameRate, short toFrameRate, unsigned long durationMs, MotionEngine::Easing easing, unsigned long elapsedMs);
+        static bool echoed(short frameRate);
+        static void write(short frameRate);
+
+        static BMDCameraConnection* connection;
+        static bool running;
+        static bool ended;
+        static CCUPacketTypes::RecordingFormatData baseFormat;  // The camera's format when the ramp started
+        static short fromRate;
+        static short toRate;
+        static unsigned long durationMs;
+        static MotionEngine::Easing easing;
+        static unsigned long startMillis;
+        static short sentRate;                                  // 0 before the first step
+        static unsigned long sentMillis;
+        static bool awaitingEcho;
+
+        static unsigned long ramps;
+        static unsigned long stepsSent;
+        static unsigned long stepsVerified;
+        static unsigned long stepsUnverified;                   // Not echoed within kEchoTimeoutMs
+        static unsigned long ratesSkipped;                      // Passed by the curve between two steps
+        static unsigned long averageEchoMs;
+        static unsigned long maxEchoMs;
+};
+
+#endif
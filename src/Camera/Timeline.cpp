@@ -0,0 +1,601 @@
+#include "Timeline.h"
+#include "PacketWriter.h"
+
+BMDCameraConnection* Timeline::connection = nullptr;
+Timeline::Keyframe Timeline::keyframes[kMaxKeyframes];
+byte Timeline::keyframeCount = 0;
+Timeline::Clock Timeline::clock = Timeline::Clock::Wall;
+float Timeline::framesPerSecond = kDefaultFramesPerSecond;
+
+bool Timeline::running = false;
+bool Timeline::ended = false;
+byte Timeline::nextKeyframe = 0;
+unsigned long Timeline::startMillis = 0;
+unsigned long Timeline::lastTimeMs = 0;
+unsigned long Timeline::timecodeMs = ULONG_MAX;
+unsigned long Timeline::timecodeChangedMillis = 0;
+int Timeline::whiteBalanceFrom = -1;
+int Timeline::whiteBalanceTo = -1;
+unsigned long Timeline::nextWhiteBalanceMs = 0;
+short Timeline::lastWhiteBalance = 0;
+
+unsigned long Timeline::runs = 0;
+unsigned long Timeline::keyframesReached = 0;
+unsigned long Timeline::writes = 0;
+unsigned long Timeline::averageLateMs = 0;
+unsigned long Timeline::maxLateMs = 0;
+unsigned long Timeline::lateFrames = 0;
+
+void Timeline::begin(BMDCameraConnection* inConnection)
+{
+    connection = inConnection;
+}
+
+bool Timeline::load(const char* path)
+{
+    if(!FFat.begin(true))
+    {
+        DEBUG_ERROR("Timeline: Unable to mount FFat, is there an ffat partition?");
+        return false;
+    }
+
+    File file = FFat.open(path, FILE_READ);
+    if(!file)
+    {
+        DEBUG_INFO("Timeline: No %s", path);
+        return false;
+    }
+
+    clear();
+
+    // A bad line is skipped, the rest still load
+    bool valid = true;
+    char line[kMaxLineLength];
+    while(file.available())
+    {
+        size_t length = file.readBytesUntil('\n', line, sizeof(line) - 1);
+        line[length] = 0;
+
+        valid &= addLine(line);
+    }
+
+    file.close();
+
+    DEBUG_INFO("Timeline: %u keyframes from %s", keyframeCount, path);
+
+    return valid;
+}
+
+bool Timeline::save(const char* path)
+{
+    if(!FFat.begin(true))
+    {
+        DEBUG_ERROR("Timeline: Unable to mount FFat, is there an ffat partition?");
+        return false;
+    }
+
+    File file = FFat.open(path, FILE_WRITE);
+    if(!file)
+    {
+        DEBUG_ERROR("Timeline: Unable to create %s", path);
+        return false;
+    }
+
+    print(file);
+    file.close();
+
+    DEBUG_INFO("Timeline: %u keyframes saved to %s", keyframeCount, path);
+
+    return true;
+}
+
+void Timeline::clear()
+{
+    stop();
+
+    keyframeCount = 0;
+    clock = Clock::Wall;
+    framesPerSecond = kDefaultFramesPerSecond;
+}
+
+bool Timeline::addLine(const char* text)
+{
+    char line[kMaxLineLength];
+    strncpy(line, text, sizeof(line) - 1);
+    line[sizeof(line) - 1] = 0;
+
+    // Line ends and spaces either side
+    size_t length = strlen(line);
+    while(length > 0 && isspace(line[length - 1]))
+        line[--length] = 0;
+
+    char* start = line;
+    while(isspace(*start))
+        start++;
+
+    if(*start == 0 || *start == '#')
+        return true;
+
+    char* fields[4];
+    byte fieldCount = 0;
+    char* position = nullptr;
+    for(char* field = strtok_r(start, ",", &position); field != nullptr && fieldCount < 4; field = strtok_r(nullptr, ",", &position))
+        fields[fieldCount++] = field;
+
+    // Nothing but commas
+    if(fieldCount == 0)
+    {
+        DEBUG_ERROR("Timeline: Unable to read \"%s\"", text);
+        return false;
+    }
+
+    if(strcasecmp(fields[0], "CLOCK") == 0)
+    {
+        if(fieldCount < 2 || (strcasecmp(fields[1], "WALL") != 0 && strcasecmp(fields[1], "TIMECODE") != 0))
+        {
+            DEBUG_ERROR("Timeline: Unable to read \"%s\"", text);
+            return false;
+        }
+
+        if(keyframeCount != 0)
+        {
+            DEBUG_ERROR("Timeline: The clock has to be set before the keyframes");
+            return false;
+        }
+
+        clock = strcasecmp(fields[1], "TIMECODE") == 0 ? Clock::Timecode : Clock::Wall;
+
+        float rate = fieldCount > 2 ? atof(fields[2]) : kDefaultFramesPerSecond;
+        framesPerSecond = rate > 0.0f && rate <= 120.0f ? rate : kDefaultFramesPerSecond;
+
+        return true;
+    }
+
+    if(fieldCount < 3)
+    {
+        DEBUG_ERROR("Timeline: Unable to read \"%s\"", text);
+        return false;
+    }
+
+    if(running)
+    {
+        DEBUG_ERROR("Timeline: Unable to add keyframes while it's running");
+        return false;
+    }
+
+    if(keyframeCount >= kMaxKeyframes)
+    {
+        DEBUG_ERROR("Timeline: No room for more than %u keyframes", kMaxKeyframes);
+        return false;
+    }
+
+    Keyframe keyframe;
+
+    if(clock == Clock::Timecode)
+    {
+        if(!parseTimecode(fields[0], keyframe.timeMs))
+        {
+            DEBUG_ERROR("Timeline: Unable to read the timecode in \"%s\"", text);
+            return false;
+        }
+    }
+    else
+    {
+        float seconds = atof(fields[0]);
+        if(seconds < 0.0f)
+        {
+            DEBUG_ERROR("Timeline: Unable to read the time in \"%s\"", text);
+            return false;
+        }
+
+        keyframe.timeMs = lroundf(seconds * 1000.0f);
+    }
+
+    byte parameter = 0;
+    while(parameter < kParameterCount && strcasecmp(fields[1], getParameterName(static_cast<Parameter>(parameter))) != 0)
+        parameter++;
+
+    if(parameter == kParameterCount)
+    {
+        DEBUG_ERROR("Timeline: Unknown parameter in \"%s\"", text);
+        return false;
+    }
+
+    keyframe.parameter = static_cast<Parameter>(parameter);
+    keyframe.value = atof(fields[2]);
+
+    float minimum = 0.0f;
+    float maximum = 1.0f;
+    switch(keyframe.parameter)
+    {
+        case Parameter::ISO:
+            minimum = 100.0f;
+            maximum = 25600.0f;
+            break;
+        case Parameter::WhiteBalance:
+            minimum = 2500.0f;
+            maximum = 10000.0f;
+            break;
+        case Parameter::ShutterAngle:
+            minimum = 1.0f;
+            maximum = 360.0f;
+            break;
+        default:
+            break;
+    }
+
+    if(keyframe.value < minimum || keyframe.value > maximum)
+    {
+        DEBUG_ERROR("Timeline: Value out of range (%g to %g) in \"%s\"", minimum, maximum, text);
+        return false;
+    }
+
+    keyframe.easing = MotionEngine::Easing::Linear;
+    if(fieldCount > 3 && !MotionEngine::parseEasing(fields[3], keyframe.easing))
+    {
+        DEBUG_ERROR("Timeline: Unknown easing in \"%s\"", text);
+        return false;
+    }
+
+    // Kept in time order, after any others at the same time
+    byte index = keyframeCount;
+    while(index > 0 && keyframes[index - 1].timeMs > keyframe.timeMs)
+    {
+        keyframes[index] = keyframes[index - 1];
+        index--;
+    }
+
+    keyframes[index] = keyframe;
+    keyframeCount++;
+
+    return true;
+}
+
+void Timeline::print(Stream& output)
+{
+    output.printf("CLOCK,%s,%g\n", clock == Clock::Timecode ? "TIMECODE" : "WALL", framesPerSecond);
+
+    for(byte index = 0; index < keyframeCount; index++)
+    {
+        const Keyframe& keyframe = keyframes[index];
+
+        char time[16];
+        if(clock == Clock::Timecode)
+        {
+            unsigned long seconds = keyframe.timeMs / 1000;
+            unsigned long frames = lroundf((keyframe.timeMs % 1000) * framesPerSecond / 1000.0f);
+            snprintf(time, sizeof(time), "%02lu:%02lu:%02lu:%02lu", seconds / 3600, seconds / 60 % 60, seconds % 60, frames);
+        }
+        else
+            snprintf(time, sizeof(time), "%.3f", keyframe.timeMs / 1000.0f);
+
+        output.printf("%s,%s,%g,%s\n", time, getParameterName(keyframe.parameter), keyframe.value, MotionEngine::getEasingName(keyframe.easing));
+    }
+}
+
+bool Timeline::start()
+{
+    if(keyframeCount == 0)
+    {
+        DEBUG_ERROR("Timeline: Nothing to play");
+        return false;
+    }
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected)
+        return false;
+
+    startMillis = millis();
+    timecodeMs = ULONG_MAX;
+
+    unsigned long timeMs;
+    if(!timeNow(timeMs))
+    {
+        DEBUG_ERROR("Timeline: No timecode from the camera");
+        return false;
+    }
+
+    running = true;
+    ended = true;
+    lastTimeMs = timeMs;
+    runs++;
+
+    seek(timeMs);
+
+    DEBUG_INFO("Timeline: Started at %lu ms, %u keyframes", timeMs, keyframeCount);
+
+    return true;
+}
+
+void Timeline::stop()
+{
+    if(!running)
+        return;
+
+    running = false;
+    ended = true;
+    whiteBalanceTo = -1;
+
+    // Its lens moves stop where they've got to
+    for(byte parameter = 0; parameter <= static_cast<byte>(Parameter::Iris); parameter++)
+    {
+        if(find(static_cast<Parameter>(parameter), -1, 1) >= 0)
+            MotionEngine::cancel(static_cast<MotionEngine::Axis>(parameter));
+    }
+
+    DEBUG_INFO("Timeline: Stopped");
+}
+
+bool Timeline::service()
+{
+    bool hasEnded = ended;
+    ended = false;
+
+    if(!running)
+        return hasEnded;
+
+    if(connection == nullptr || connection->status != BMDCameraConnection::ConnectionStatus::Connected)
+    {
+        stop();
+        return true;
+    }
+
+    unsigned long timeMs;
+    if(!timeNow(timeMs))
+        return hasEnded;
+
+    if(clock == Clock::Timecode)
+    {
+        // The timecode went back, e.g. the camera was cued again, it picks up from there
+        if(timeMs + kMaxExtrapolateMs < lastTimeMs)
+        {
+            DEBUG_VERBOSE("Timeline: Timecode went back to %lu ms", timeMs);
+            lastTimeMs = timeMs;
+            seek(timeMs);
+            return true;
+        }
+
+        timeMs = std::max(timeMs, lastTimeMs);
+    }
+
+    lastTimeMs = timeMs;
+
+    while(nextKeyframe < keyframeCount && keyframes[nextKeyframe].timeMs <= timeMs)
+        reach(nextKeyframe++, timeMs);
+
+    serviceWhiteBalance(timeMs);
+
+    // The lens moves to the last keyframes finish by themselves
+    if(nextKeyframe >= keyframeCount)
+    {
+        running = false;
+        hasEnded = true;
+
+        DEBUG_INFO("Timeline: Finished");
+    }
+
+    return hasEnded;
+}
+
+bool Timeline::timeNow(unsigned long& timeMs)
+{
+    if(clock == Clock::Wall)
+    {
+        timeMs = millis() - startMillis;
+        return true;
+    }
+
+    if(!BMDControlSystem::getInstance()->hasCamera())
+        return false;
+
+    unsigned long readMs;
+    if(!parseTimecode(BMDControlSystem::getInstance()->getCamera()->getTimecodeString().c_str(), readMs))
+        return false;
+
+    unsigned long now = millis();
+    if(readMs != timecodeMs)
+    {
+        timecodeMs = readMs;
+        timecodeChangedMillis = now;
+    }
+
+    // Between the camera's timecode updates it carries on by the clock, until it's clear the timecode has stopped
+    timeMs = timecodeMs + std::min(now - timecodeChangedMillis, static_cast<unsigned long>(kMaxExtrapolateMs));
+
+    return true;
+}
+
+bool Timeline::parseTimecode(const char* text, unsigned long& timeMs)
+{
+    // Drop frame timecode has a ; before the frames
+    unsigned int hours, minutes, seconds, frames;
+    if(sscanf(text, "%u:%u:%u%*[:;]%u", &hours, &minutes, &seconds, &frames) != 4 || minutes > 59 || seconds > 59 || frames >= ceilf(framesPerSecond))
+        return false;
+
+    timeMs = ((hours * 60UL + minutes) * 60UL + seconds) * 1000UL + lroundf(frames * 1000.0f / framesPerSecond);
+
+    return true;
+}
+
+int Timeline::find(Parameter parameter, int from, int direction)
+{
+    for(int index = from + direction; index >= 0 && index < keyframeCount; index += direction)
+    {
+        if(keyframes[index].parameter == parameter)
+            return index;
+    }
+
+    return -1;
+}
+
+void Timeline::seek(unsigned long timeMs)
+{
+    nextKeyframe = 0;
+    while(nextKeyframe < keyframeCount && keyframes[nextKeyframe].timeMs <= timeMs)
+        nextKeyframe++;
+
+    whiteBalanceTo = -1;
+
+    // Each parameter goes to where it would be by now, those without a keyframe yet are left alone
+    for(byte parameter = 0; parameter < kParameterCount; parameter++)
+    {
+        int before = find(static_cast<Parameter>(parameter), nextKeyframe, -1);
+        int after = find(static_cast<Parameter>(parameter), nextKeyframe - 1, 1);
+
+        if(before < 0)
+            continue;
+
+        float value = after < 0 ? keyframes[before].value : valueAt(before, after, timeMs);
+
+        if(after >= 0 && parameter <= static_cast<byte>(Parameter::Iris))
+            MotionEngine::move(static_cast<MotionEngine::Axis>(parameter), value, keyframes[after].value, keyframes[after].timeMs - timeMs, keyframes[after].easing);
+        else
+            write(static_cast<Parameter>(parameter), value, true);
+
+        if(after >= 0 && static_cast<Parameter>(parameter) == Parameter::WhiteBalance)
+        {
+            whiteBalanceFrom = before;
+            whiteBalanceTo = after;
+            nextWhiteBalanceMs = timeMs;
+        }
+    }
+}
+
+void Timeline::reach(byte index, unsigned long timeMs)
+{
+    const Keyframe& keyframe = keyframes[index];
+
+    // How late it's written, the jitter from being written in loop()
+    unsigned long late = timeMs - keyframe.timeMs;
+    averageLateMs = keyframesReached == 0 ? late : (averageLateMs * 7 + late) / 8;
+    if(late > maxLateMs)
+        maxLateMs = late;
+    if(late * framesPerSecond >= 1000.0f)
+        lateFrames++;
+
+    keyframesReached++;
+
+    int after = find(keyframe.parameter, index, 1);
+
+    switch(keyframe.parameter)
+    {
+        case Parameter::Focus:
+        case Parameter::Zoom:
+        case Parameter::Iris:
+        {
+            MotionEngine::Axis axis = static_cast<MotionEngine::Axis>(keyframe.parameter);
+
+            if(after >= 0)
+            {
+                // Along the next keyframe's easing, to arrive on its time
+                unsigned long durationMs = keyframes[after].timeMs > timeMs ? keyframes[after].timeMs - timeMs : 1;
+                MotionEngine::move(axis, keyframe.value, keyframes[after].value, durationMs, keyframes[after].easing);
+            }
+            else
+            {
+                // The move to here finishes on it by itself
+                bool arriving = MotionEngine::isMoving(axis) ? MotionEngine::getTarget(axis) == keyframe.value : MotionEngine::hasPosition(axis) && MotionEngine::getPosition(axis) == keyframe.value;
+                if(!arriving)
+                    MotionEngine::set(axis, keyframe.value);
+            }
+            break;
+        }
+        case Parameter::WhiteBalance:
+            write(keyframe.parameter, keyframe.value, true);
+
+            whiteBalanceFrom = index;
+            whiteBalanceTo = after;
+            nextWhiteBalanceMs = timeMs + lroundf(1000.0f / framesPerSecond);
+            break;
+        default:
+            write(keyframe.parameter, keyframe.value, true);
+            break;
+    }
+}
+
+float Timeline::valueAt(int from, int to, unsigned long timeMs)
+{
+    const Keyframe& start = keyframes[from];
+    const Keyframe& end = keyframes[to];
+
+    if(end.timeMs <= start.timeMs || timeMs >= end.timeMs)
+        return end.value;
+
+    float progress = timeMs <= start.timeMs ? 0.0f : static_cast<float>(timeMs - start.timeMs) / (end.timeMs - start.timeMs);
+
+    return start.value + (end.value - start.value) * MotionEngine::ease(end.easing, progress);
+}
+
+void Timeline::write(Parameter parameter, float value, bool response)
+{
+    if(parameter <= Parameter::Iris)
+    {
+        MotionEngine::set(static_cast<MotionEngine::Axis>(parameter), value);
+        return;
+    }
+
+    if(connection == nullptr)
+        return;
+
+    switch(parameter)
+    {
+        case Parameter::ISO:
+            PacketWriter::writeISO(lroundf(value), connection);
+            break;
+        case Parameter::WhiteBalance:
+        {
+            // The camera's tint is kept
+            auto camera = BMDControlSystem::getInstance()->getCamera();
+            short tint = camera->hasTint() ? camera->getTint() : 0;
+
+            lastWhiteBalance = static_cast<short>(lroundf(value / kWhiteBalanceStep) * kWhiteBalanceStep);
+            PacketWriter::writeWhiteBalance(lastWhiteBalance, tint, connection, response);
+            break;
+        }
+        case Parameter::ShutterAngle:
+            PacketWriter::writeShutterAngle(lroundf(value * 100.0f), connection);
+            break;
+        default:
+            return;
+    }
+
+    writes++;
+}
+
+void Timeline::serviceWhiteBalance(unsigned long timeMs)
+{
+    // Once a frame while it's moving to a white balance keyframe
+    if(whiteBalanceTo < 0 || static_cast<long>(timeMs - nextWhiteBalanceMs) < 0)
+        return;
+
+    nextWhiteBalanceMs = timeMs + lroundf(1000.0f / framesPerSecond);
+
+    float value = valueAt(whiteBalanceFrom, whiteBalanceTo, timeMs);
+    if(static_cast<short>(lroundf(value / kWhiteBalanceStep) * kWhiteBalanceStep) != lastWhiteBalance)
+        write(Parameter::WhiteBalance, value, false);
+}
+
+const char* Timeline::getParameterName(Parameter parameter)
+{
+    switch(parameter)
+    {
+        case Parameter::Focus:
+            return "FOCUS";
+        case Parameter::Zoom:
+            return "ZOOM";
+        case Parameter::Iris:
+            return "IRIS";
+        case Parameter::ISO:
+            return "ISO";
+        case Parameter::WhiteBalance:
+            return "WB";
+        case Parameter::ShutterAngle:
+            return "SHUTTER";
+        default:
+            return "UNKNOWN";
+    }
+}
+
+void Timeline::reportStats()
+{
+    DEBUG_INFO("Timeline: %u keyframes (%s, %g fps), %lu runs, %lu keyframes reached, %lu writes (ISO, WB, shutter), keyframes %lu ms late average, %lu ms max, %lu a frame or more late", keyframeCount, clock == Clock::Timecode ? "timecode" : "wall clock", framesPerSecond, runs, keyframesReached, writes, averageLateMs, maxLateMs, lateFrames);
+}
@@ -0,0 +1,129 @@
+#ifndef TIMELINE_H
+#define TIMELINE_H
+
+#include <Arduino.h>
+#include <FFat.h>
+#include "Arduino_DebugUtils.h"
+#include "BMDCameraConnection.h"
+#include "MotionEngine.h"
+
+// Plays keyframed focus, zoom, iris, ISO, white balance and shutter changes against the clock or the camera's timecode, so a shot can
+// be repeated exactly, e.g. a product shot or a motion control style pass without the rig.
+// Between keyframes focus, zoom and iris are moved by the MotionEngine and white balance is written once a frame, along the easing
+// of the keyframe being moved to. ISO and shutter change on their keyframes. Keyframes are written when their time comes around in
+// loop(), so they're late by at most a loop (a few milliseconds, well under a frame), how late is kept in the stats.
+//
+// Timelines are text files on FFat, one line each, blank lines and lines starting with # are ignored:
+//   CLOCK,WALL[,fps]           Keyframe times are seconds from when it's started (the default)
+//   CLOCK,TIMECODE[,fps]       Keyframe times are the camera's timecode, HH:MM:SS:FF. It plays while the timecode runs.
+//   time,parameter,value[,easing]
+// Parameters are FOCUS, ZOOM and IRIS (0.0 to 1.0, as the normalised lens commands), ISO, WB (Kelvin) and SHUTTER (angle in degrees).
+// fps is the camera's frame rate, 25 if it's not given. White balance is written at that rate.
+// Easing (LINEAR, the default, EASEIN, EASEOUT or SCURVE) is how the value gets to that keyframe from the one before. E.g.
+//   CLOCK,WALL
+//   0,FOCUS,0.2
+//   4.5,FOCUS,0.8,SCURVE
+//   2,ISO,800
+class Timeline
+{
+    public:
+        enum class Parameter : byte
+        {
+            Focus = 0,
+            Zoom,
+            Iris,
+            ISO,
+            WhiteBalance,
+            ShutterAngle,
+            Count
+        };
+
+        enum class Clock : byte
+        {
+            Wall = 0,   // From start()
+            Timecode    // The camera's timecode
+        };
+
+        static void begin(BMDCameraConnection* inConnection);
+
+        // Replaces the keyframes with the file's, false if it's missing or has a line that can't be read
+        static bool load(const char* path = "/timeline.txt");
+        static bool save(const char* path = "/timeline.txt");
+
+        // Empties it, ready for lines to be added
+        static void clear();
+
+        // One line of a timeline file, e.g. from serial. False if it can't be read or there's no room.
+        static bool addLine(const char* line);
+
+        // Writes the keyframes out in the file's format
+        static void print(Stream& output);
+
+        // From the start, or with the timecode clock from wherever the timecode is now. False if there's nothing to play or no timecode.
+        static bool start();
+        static void stop();
+
+        // Call from loop() before MotionEngine::service(), writes the keyframes that are due. Returns true when it starts, stops or
+        // finishes, e.g. so the screen can be redrawn.
+        static bool service();
+
+        static bool isRunning() { return running; }
+        static byte getKeyframeCount() { return keyframeCount; }
+        static Clock getClock() { return clock; }
+
+        static const char* getParameterName(Parameter parameter);
+
+        static void reportStats();
+
+    private:
+        static const byte kMaxKeyframes = 64;
+        static const byte kParameterCount = static_cast<byte>(Parameter::Count);
+        static const byte kMaxLineLength = 64;
+        static const unsigned long kMaxExtrapolateMs = 1000; // Timecode that's stopped updating for this long has stopped
+        static const short kWhiteBalanceStep = 50;
+        static const unsigned long kDefaultFramesPerSecond = 25;
+
+        struct Keyframe
+        {
+            unsigned long timeMs;
+            Parameter parameter;
+            float value;
+            MotionEngine::Easing easing;
+        };
+
+        static bool timeNow(unsigned long& timeMs);
+        static bool parseTimecode(const char* text, unsigned long& timeMs);
+        static int find(Parameter parameter, int from, int direction); // The next keyframe of the parameter either side of from, -1 for none
+        static void seek(unsigned long timeMs);
+        static void reach(byte index, unsigned long timeMs);
+        static float valueAt(int from, int to, unsigned long timeMs);
+        static void write(Parameter parameter, float value, bool response);
+        static void serviceWhiteBalance(unsigned long timeMs);
+
+        static BMDCameraConnection* connection;
+        static Keyframe keyframes[kMaxKeyframes];   // In time order
+        static byte keyframeCount;
+        static Clock clock;
+        static float framesPerSecond;
+
+        static bool running;
+        static bool ended;
+        static byte nextKeyframe;
+        static unsigned long startMillis;
+        static unsigned long lastTimeMs;
+        static unsigned long timecodeMs;            // The last timecode read and when it changed
+        static unsigned long timecodeChangedMillis;
+        static int whiteBalanceFrom;                // Keyframes white balance is going between, -1 when it's not moving
+        static int whiteBalanceTo;
+        static unsigned long nextWhiteBalanceMs;
+        static short lastWhiteBalance;
+
+        static unsigned long runs;
+        static unsigned long keyframesReached;
+        static unsigned long writes;
+        static unsigned long averageLateMs;
+        static unsigned long maxLateMs;
+        static unsigned long lateFrames;            // Keyframes written a frame or more late
+};
+
+#endif
@@ -4,6 +4,8 @@ double LensConfig::fStopValues[] = { 1.2, 1.4, 1.8, 2.0, 2.2, 2.4, 2.6, 2.8, 3.2
 
 short LensConfig::apertureNumbers[] = { 1077, 1988, 3473, 4096, 4659, 5173, 5646, 6084, 6873, 7402, 7731, 8192, 8888, 9269, 9742, 10180, 10781, 11240, 11746, 12288, 12783, 13303, 13606, 14169, 14684, 15594, 16002, 16384, 16742, 17399, 17990, 18265 };
 
+const unsigned char LensConfig::kApertureCount = sizeof(LensConfig::apertureNumbers) / sizeof(LensConfig::apertureNumbers[0]);
+
 short LensConfig::GetIndexForApertureNumber(short targetNumber) {
     if(targetNumber > apertureNumbers[sizeof(apertureNumbers)/sizeof(apertureNumbers[0]) - 1])
         return apertureNumbers[sizeof(apertureNumbers)/sizeof(apertureNumbers[0]) - 1];
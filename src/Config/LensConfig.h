@@ -9,6 +9,7 @@ class LensConfig {
 public:
     static double fStopValues[];
     static short apertureNumbers[];
+    static const unsigned char kApertureCount;
 
     enum ApertureUnits : short
     {
@@ -23,9 +23,13 @@ const short VideoConfig::kOffSpeedFrameRateMax = 60;
 const ushort VideoConfig::kSentSensorGainBase = 100;
 const ushort VideoConfig::kReceivedSensorGainBase = 200;
 const int VideoConfig::kISOValues[] = { 200, 400, 800, 1600 };
+const int VideoConfig::kISOStops[] = { 100, 125, 160, 200, 250, 320, 400, 500, 640, 800, 1000, 1250, 1600, 2000, 2500, 3200, 4000, 5000, 6400, 8000, 10000, 12800, 16000, 20000, 25600 };
+const byte VideoConfig::kISOStopCount = sizeof(VideoConfig::kISOStops) / sizeof(VideoConfig::kISOStops[0]);
 const int VideoConfig::kGainValues[] = { -6, 0, 6, 12 };
 const double VideoConfig::kShutterAngles[] = { 11.2, 15.0, 22.5, 30.0, 37.5, 45.0, 60.0, 72.0, 75.0, 90.0, 108.0, 120.0, 144.0, 150.0, 172.8, 180.0, 216.0, 270.0, 324.0, 360.0 };
+const byte VideoConfig::kShutterAngleCount = sizeof(VideoConfig::kShutterAngles) / sizeof(VideoConfig::kShutterAngles[0]);
 const int32_t VideoConfig::kShutterSpeeds[] = { 24, 25, 30, 50, 60, 100, 125, 200, 250, 500, 1000, 2000 };
+const byte VideoConfig::kShutterSpeedCount = sizeof(VideoConfig::kShutterSpeeds) / sizeof(VideoConfig::kShutterSpeeds[0]);
 const int VideoConfig::kShutterSpeedMin = 24;
 const int VideoConfig::kShutterSpeedMax = 2000;
 const double kShutterAngleMin = 5.0;
@@ -27,9 +27,13 @@ public:
     static const ushort kSentSensorGainBase;
     static const ushort kReceivedSensorGainBase;
     static const int kISOValues[];
+    static const int kISOStops[];           // Third stops, 100 to 25600
+    static const byte kISOStopCount;
     static const int kGainValues[];
     static const double kShutterAngles[];
+    static const byte kShutterAngleCount;
     static const int32_t kShutterSpeeds[];
+    static const byte kShutterSpeedCount;
     static const int kShutterSpeedMin;
     static const int kShutterSpeedMax;
     static const double kShutterAngleMin;
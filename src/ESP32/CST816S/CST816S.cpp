@@ -112,8 +112,12 @@ bool CST816S::getTouchCST816T(uint16_t *x, uint16_t *y, uint8_t *gesture, uint8_
     @brief  handle interrupts
 */
 void IRAM_ATTR CST816S::handleISR(void) {
+  _event_micros = micros();
   _event_available = true;
 
+  if (_interrupt_callback != nullptr)
+    _interrupt_callback();
+
 }
 
 /*!
@@ -147,6 +151,7 @@ void CST816S::begin(int interrupt) {
 bool CST816S::available() {
   if (_event_available) {
     read_touch();
+    data.micros = _event_micros;
     _event_available = false;
     return true;
   }
@@ -165,6 +170,21 @@ void CST816S::sleep() {
   i2c_write(CST816S_ADDRESS, 0xA5, &standby_value, 1);
 }
 
+/*!
+    @brief  Added, report touch and each change of position (IrqCtl EnTouch | EnChange) so drags can be followed
+*/
+void CST816S::enableMotionReports() {
+  byte irq_ctl = 0x60;
+  i2c_write(CST816S_ADDRESS, 0xFA, &irq_ctl, 1);
+}
+
+/*!
+    @brief  Added, a function for the interrupt to call as well, e.g. to queue the report for loop()
+*/
+void CST816S::onInterrupt(void (*callback)()) {
+  _interrupt_callback = callback;
+}
+
 /*!
     @brief  get the gesture event name
 */
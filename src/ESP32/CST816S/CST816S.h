@@ -74,6 +74,7 @@ class CST816S {
       byte eventID; // Event (0 = Down, 1 = Up, 2 = Contact), Changed to eventID to match the enum value
       int x;
       int y;
+      unsigned long micros; // Added, when the interrupt for this report came in
       uint8_t version; // [NOT USED]
       uint8_t versionInfo[3]; // [NOT USED]
     };
@@ -81,6 +82,8 @@ class CST816S {
     CST816S(int sda, int scl, int rst, int irq);
     void begin(int interrupt = RISING);
     void sleep();
+    void enableMotionReports(); // Added, interrupt on every change of position while touched, not just touch and release
+    void onInterrupt(void (*callback)()); // Added, also called from the interrupt, must be in IRAM
     bool available();
     data_struct data;
     String gesture();
@@ -92,7 +95,9 @@ class CST816S {
     int _scl;
     int _rst;
     int _irq;
-    bool _event_available;
+    volatile bool _event_available;
+    volatile unsigned long _event_micros;
+    void (*_interrupt_callback)() = nullptr;
 
     void IRAM_ATTR handleISR();
     void read_touch();
@@ -0,0 +1,316 @@
+#include "I2CScheduler.h"
+
+I2CScheduler::Device I2CScheduler::devices[kMaxDevices];
+byte I2CScheduler::deviceCount = 0;
+I2CScheduler::Event I2CScheduler::latestEvents[kMaxDevices];
+bool I2CScheduler::started = false;
+I2CScheduler::EventCallback I2CScheduler::eventCallback = nullptr;
+
+TaskHandle_t I2CScheduler::taskHandle = nullptr;
+QueueHandle_t I2CScheduler::events = nullptr;
+QueueHandle_t I2CScheduler::writes = nullptr;
+SemaphoreHandle_t I2CScheduler::busLock = nullptr;
+portMUX_TYPE I2CScheduler::latestLock = portMUX_INITIALIZER_UNLOCKED;
+
+unsigned long I2CScheduler::writesDone = 0;
+unsigned long I2CScheduler::eventsDropped = 0;
+unsigned long I2CScheduler::batches = 0;
+unsigned long I2CScheduler::lockWaits = 0;
+unsigned long I2CScheduler::busMicrosTotal = 0;
+unsigned long I2CScheduler::windowStart = 0;
+unsigned long I2CScheduler::windowBusMicros = 0;
+byte I2CScheduler::busUtilisationPercent = 0;
+
+byte I2CScheduler::addDevice(const char* name, Priority priority, unsigned long periodMicros, ReadFunction read)
+{
+    if(started || deviceCount >= kMaxDevices)
+    {
+        DEBUG_ERROR("I2CScheduler: Unable to add %s", name);
+        return 0xFF;
+    }
+
+    Device& device = devices[deviceCount];
+    device.name = name;
+    device.priority = priority;
+    device.periodMicros = periodMicros;
+    device.nextMicros = micros();
+    device.read = read;
+    device.reads = 0;
+    device.failures = 0;
+    device.events = 0;
+    device.lateMicros = 0;
+    device.maxLateMicros = 0;
+    device.busMicros = 0;
+
+    latestEvents[deviceCount].device = deviceCount;
+    latestEvents[deviceCount].length = 0;
+    latestEvents[deviceCount].micros = 0;
+
+    return deviceCount++;
+}
+
+bool I2CScheduler::begin(byte core, EventCallback onEvent)
+{
+    if(started)
+        return true;
+
+    eventCallback = onEvent;
+
+    events = xQueueCreate(kEventQueueSize, sizeof(Event));
+    writes = xQueueCreate(kWriteQueueSize, sizeof(Write));
+    busLock = xSemaphoreCreateMutex();
+
+    if(events == nullptr || writes == nullptr || busLock == nullptr)
+    {
+        DEBUG_ERROR("I2CScheduler: Unable to create queues");
+        return false;
+    }
+
+    windowStart = micros();
+
+    // Above loop() so a touch read isn't held up by drawing, it's waiting on the bus nearly all the time
+    if(xTaskCreatePinnedToCore(schedulerTask, "I2C", 4096, nullptr, 3, &taskHandle, core) != pdPASS)
+    {
+        DEBUG_ERROR("I2CScheduler: Unable to start the task");
+        return false;
+    }
+
+    started = true;
+
+    DEBUG_INFO("I2CScheduler: %u devices", deviceCount);
+
+    return true;
+}
+
+void I2CScheduler::setPeriod(byte device, unsigned long periodMicros)
+{
+    if(device >= deviceCount)
+        return;
+
+    devices[device].periodMicros = periodMicros;
+    devices[device].nextMicros = micros();
+
+    if(taskHandle != nullptr)
+        xTaskNotifyGive(taskHandle);
+}
+
+bool I2CScheduler::write(byte device, WriteFunction function, const byte* data, byte length)
+{
+    if(writes == nullptr || length > kMaxData)
+        return false;
+
+    Write queued;
+    queued.device = device;
+    queued.function = function;
+    queued.length = length;
+    memcpy(queued.data, data, length);
+
+    if(xQueueSend(writes, &queued, 0) != pdTRUE)
+    {
+        DEBUG_ERROR("I2CScheduler: Write queue full");
+        return false;
+    }
+
+    xTaskNotifyGive(taskHandle);
+
+    return true;
+}
+
+bool I2CScheduler::poll(Event& event)
+{
+    return events != nullptr && xQueueReceive(events, &event, 0) == pdTRUE;
+}
+
+void I2CScheduler::clear()
+{
+    if(events != nullptr)
+        xQueueReset(events);
+}
+
+bool I2CScheduler::latest(byte device, Event& event)
+{
+    if(device >= deviceCount)
+        return false;
+
+    portENTER_CRITICAL(&latestLock);
+    event = latestEvents[device];
+    portEXIT_CRITICAL(&latestLock);
+
+    return event.micros != 0;
+}
+
+bool I2CScheduler::lock(unsigned long timeoutMs)
+{
+    if(busLock == nullptr)
+        return true; // Not started, nothing else is using the bus
+
+    return xSemaphoreTake(busLock, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+}
+
+void I2CScheduler::unlock()
+{
+    if(busLock != nullptr)
+        xSemaphoreGive(busLock);
+}
+
+void I2CScheduler::schedulerTask(void* parameter)
+{
+    while(true)
+    {
+        // Held by someone using the bus directly
+        if(xSemaphoreTake(busLock, 0) != pdTRUE)
+        {
+            lockWaits++;
+            xSemaphoreTake(busLock, portMAX_DELAY);
+        }
+
+        // Everything that's due goes in this batch, touch first and then writes ahead of the other reads
+        while(true)
+        {
+            unsigned long now = micros();
+            int index = nextDue(now);
+
+            if(index >= 0 && devices[index].priority == Priority::Touch)
+                runRead(index, now);
+            else if(runWrite())
+                continue;
+            else if(index >= 0)
+                runRead(index, now);
+            else
+                break;
+        }
+
+        xSemaphoreGive(busLock);
+        batches++;
+
+        // Sleep until the next device is due, or a write is queued
+        unsigned long now = micros();
+        long waitMicros = static_cast<long>(kStatsPeriodMicros);
+        for(byte index = 0; index < deviceCount; index++)
+        {
+            if(devices[index].periodMicros == 0)
+                continue;
+
+            long untilDue = static_cast<long>(devices[index].nextMicros - now);
+            if(untilDue < waitMicros)
+                waitMicros = untilDue;
+        }
+
+        TickType_t waitTicks = waitMicros >= 1000 ? pdMS_TO_TICKS(waitMicros / 1000) : 0;
+        if(waitTicks == 0)
+            waitTicks = 1; // Let the other tasks on this core in
+
+        ulTaskNotifyTake(pdTRUE, waitTicks);
+
+        // Bus utilisation over the last second
+        now = micros();
+        if(now - windowStart >= kStatsPeriodMicros)
+        {
+            busUtilisationPercent = static_cast<byte>(windowBusMicros * 100 / (now - windowStart));
+            windowBusMicros = 0;
+            windowStart = now;
+        }
+    }
+}
+
+int I2CScheduler::nextDue(unsigned long now)
+{
+    // The highest priority device that's due, the most overdue of those
+    int due = -1;
+    for(byte index = 0; index < deviceCount; index++)
+    {
+        const Device& device = devices[index];
+        if(device.periodMicros == 0 || static_cast<long>(now - device.nextMicros) < 0)
+            continue;
+
+        if(due < 0 || device.priority < devices[due].priority || (device.priority == devices[due].priority && static_cast<long>(device.nextMicros - devices[due].nextMicros) < 0))
+            due = index;
+    }
+
+    return due;
+}
+
+bool I2CScheduler::runWrite()
+{
+    Write queued;
+    if(xQueueReceive(writes, &queued, 0) != pdTRUE)
+        return false;
+
+    unsigned long start = micros();
+    queued.function(queued.data, queued.length);
+    unsigned long busMicros = micros() - start;
+
+    if(queued.device < deviceCount)
+        devices[queued.device].busMicros += busMicros;
+
+    busMicrosTotal += busMicros;
+    windowBusMicros += busMicros;
+    writesDone++;
+
+    return true;
+}
+
+void I2CScheduler::runRead(byte index, unsigned long now)
+{
+    Device& device = devices[index];
+
+    unsigned long late = now - device.nextMicros;
+    device.lateMicros = device.reads == 0 ? late : (device.lateMicros * 7 + late) / 8;
+    if(late > device.maxLateMicros)
+        device.maxLateMicros = late;
+
+    // The next read is lined up on the period, unless it's fallen a whole period behind
+    device.nextMicros += device.periodMicros;
+    if(static_cast<long>(now - device.nextMicros) >= 0)
+        device.nextMicros = now + device.periodMicros;
+
+    Event event;
+    event.device = index;
+
+    int length = device.read(event.data);
+    unsigned long end = micros();
+
+    device.busMicros += end - now;
+    busMicrosTotal += end - now;
+    windowBusMicros += end - now;
+    device.reads++;
+
+    if(length < 0)
+    {
+        device.failures++;
+        return;
+    }
+
+    event.length = static_cast<byte>(std::min(length, static_cast<int>(kMaxData)));
+    event.micros = end;
+
+    // Only changes are passed on
+    const Event& previous = latestEvents[index];
+    bool changed = previous.micros == 0 || previous.length != event.length || memcmp(previous.data, event.data, event.length) != 0;
+
+    portENTER_CRITICAL(&latestLock);
+    latestEvents[index] = event;
+    portEXIT_CRITICAL(&latestLock);
+
+    if(!changed)
+        return;
+
+    device.events++;
+
+    if(xQueueSend(events, &event, 0) != pdTRUE)
+        eventsDropped++;
+
+    if(eventCallback != nullptr)
+        eventCallback();
+}
+
+void I2CScheduler::reportStats()
+{
+    DEBUG_INFO("I2CScheduler: Bus %u%% busy (last second), %lu ms on the bus in total, %lu batches, %lu writes, %lu events dropped (queue full), waited on lock() %lu times", busUtilisationPercent, busMicrosTotal / 1000, batches, writesDone, eventsDropped, lockWaits);
+
+    for(byte index = 0; index < deviceCount; index++)
+    {
+        const Device& device = devices[index];
+        DEBUG_INFO("I2CScheduler: %s, %lu reads (%lu failed), %lu events, %lu us late average, %lu us max, %lu ms on the bus", device.name, device.reads, device.failures, device.events, device.lateMicros, device.maxLateMicros, device.busMicros / 1000);
+    }
+}
@@ -0,0 +1,133 @@
+#ifndef I2CSCHEDULER_H
+#define I2CSCHEDULER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/queue.h>
+#include "Arduino_DebugUtils.h"
+
+// Runs the I2C reads and writes for all the devices from one task, so loop() never waits on the bus.
+// Each device is read on its own period by a function that does its transaction(s), the most important device that's due goes first
+// and the scheduler looks again after every transaction, so a touch read never waits behind more than one transaction of a lower
+// priority device. Devices that are due together are read in one go while the task has the bus. Writes are queued and done between
+// the reads. A read that returns something new is passed to loop() as an event (and wakes it), the latest read of each device can
+// also be looked at any time.
+//
+// Code that still uses the bus directly (e.g. the pass key screen's touch reads) holds it with lock() / unlock() while it does.
+class I2CScheduler
+{
+    public:
+        enum class Priority : byte
+        {
+            Touch = 0,      // Read as soon as it's due, ahead of everything else
+            Input,          // Encoders and buttons, at a steady rate
+            Status,         // Power, battery
+            Background      // IMU, clock
+        };
+
+        static const byte kMaxData = 8;
+
+        struct Event
+        {
+            byte device = 0;
+            byte length = 0;
+            byte data[kMaxData];
+            unsigned long micros = 0;   // When the read finished
+        };
+
+        // Does the device's transaction(s), on the scheduler's task. Returns the bytes put in data (up to kMaxData), or -1 if the
+        // read failed.
+        typedef int (*ReadFunction)(byte* data);
+
+        // A queued write, with the bytes it was queued with
+        typedef void (*WriteFunction)(const byte* data, byte length);
+
+        // Called on the scheduler's task when there's a new event, e.g. to wake loop()
+        typedef void (*EventCallback)();
+
+        // Before begin(). periodMicros of 0 adds it paused. Returns the device's id.
+        static byte addDevice(const char* name, Priority priority, unsigned long periodMicros, ReadFunction read);
+
+        // Starts the task, on the same core as the Bluetooth stack as it spends nearly all its time waiting on the bus
+        static bool begin(byte core = 0, EventCallback onEvent = nullptr);
+
+        // Changes how often a device is read, 0 pauses it
+        static void setPeriod(byte device, unsigned long periodMicros);
+
+        // Queues a write, done before the next read of a lower priority device
+        static bool write(byte device, WriteFunction function, const byte* data, byte length);
+
+        // Next event from loop(), false when there are none
+        static bool poll(Event& event);
+
+        // Drops the events not yet taken, e.g. while another screen had the touch
+        static void clear();
+
+        // The device's latest read, false if it hasn't been read yet
+        static bool latest(byte device, Event& event);
+
+        // For code that still uses the bus itself, the scheduler waits while it's held
+        static bool lock(unsigned long timeoutMs = 100);
+        static void unlock();
+
+        static void reportStats();
+
+    private:
+        static const byte kMaxDevices = 6;
+        static const byte kEventQueueSize = 16;
+        static const byte kWriteQueueSize = 8;
+        static const unsigned long kStatsPeriodMicros = 1000000;
+
+        struct Device
+        {
+            const char* name;
+            Priority priority;
+            unsigned long periodMicros;
+            unsigned long nextMicros;
+            ReadFunction read;
+
+            unsigned long reads;
+            unsigned long failures;
+            unsigned long events;
+            unsigned long lateMicros;       // How long after it was due it was read, averaged
+            unsigned long maxLateMicros;
+            unsigned long busMicros;        // Time spent on its reads and writes
+        };
+
+        struct Write
+        {
+            byte device;
+            WriteFunction function;
+            byte length;
+            byte data[kMaxData];
+        };
+
+        static void schedulerTask(void* parameter);
+        static int nextDue(unsigned long now);
+        static bool runWrite();
+        static void runRead(byte index, unsigned long now);
+
+        static Device devices[kMaxDevices];
+        static byte deviceCount;
+        static Event latestEvents[kMaxDevices];
+        static bool started;
+        static EventCallback eventCallback;
+
+        static TaskHandle_t taskHandle;
+        static QueueHandle_t events;
+        static QueueHandle_t writes;
+        static SemaphoreHandle_t busLock;
+        static portMUX_TYPE latestLock;
+
+        static unsigned long writesDone;
+        static unsigned long eventsDropped;
+        static unsigned long batches;
+        static unsigned long lockWaits;         // Times the scheduler waited on lock()
+        static unsigned long busMicrosTotal;
+        static unsigned long windowStart;
+        static unsigned long windowBusMicros;
+        static byte busUtilisationPercent;      // Over the last second
+};
+
+#endif
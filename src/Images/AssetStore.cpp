@@ -0,0 +1,114 @@
+#include "AssetStore.h"
+
+bool AssetStore::mapped = false;
+spi_flash_mmap_handle_t AssetStore::mapHandle;
+const uint8_t* AssetStore::mappedData = nullptr;
+
+AssetStore::Asset AssetStore::assets[kMaxAssets];
+char AssetStore::names[kMaxAssets][kMaxNameLength + 1];
+uint16_t AssetStore::assetCount = 0;
+
+namespace
+{
+    uint16_t readUInt16(const uint8_t* data) { return data[0] | (data[1] << 8); }
+    uint32_t readUInt32(const uint8_t* data) { return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<uint32_t>(data[3]) << 24); }
+}
+
+bool AssetStore::begin(const char* partitionLabel)
+{
+    if(mapped)
+        return true;
+
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, partitionLabel);
+    if(partition == nullptr)
+    {
+        DEBUG_INFO("AssetStore: No %s partition, using built in images", partitionLabel);
+        return false;
+    }
+
+    const void* data = nullptr;
+    if(esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &data, &mapHandle) != ESP_OK)
+    {
+        DEBUG_ERROR("AssetStore: Unable to map the %s partition", partitionLabel);
+        return false;
+    }
+
+    const uint8_t* header = static_cast<const uint8_t*>(data);
+    uint16_t count = readUInt16(header + 6);
+    uint32_t totalSize = readUInt32(header + 12);
+
+    // An erased partition (never written) reads as 0xFF
+    if(memcmp(header, "MPCA", 4) != 0 || header[4] != kVersion || totalSize > partition->size || count > kMaxAssets || kHeaderSize + count * kEntrySize > totalSize)
+    {
+        DEBUG_INFO("AssetStore: Nothing in the %s partition, using built in images", partitionLabel);
+        spi_flash_munmap(mapHandle);
+        return false;
+    }
+
+    assetCount = 0;
+    for(uint16_t index = 0; index < count; index++)
+    {
+        const uint8_t* entry = header + kHeaderSize + index * kEntrySize;
+
+        uint32_t offset = readUInt32(entry + 32);
+        uint32_t size = readUInt32(entry + 36);
+        Format format = static_cast<Format>(entry[24]);
+        uint16_t width = readUInt16(entry + 26);
+        uint16_t height = readUInt16(entry + 28);
+
+        // Checked this way round so a huge offset or size can't wrap past totalSize
+        if(offset > totalSize || size > totalSize - offset)
+        {
+            DEBUG_ERROR("AssetStore: Asset %u runs past the end of the partition, ignored", index);
+            continue;
+        }
+
+        // An image's pixels are pushed as width x height, so the size must be exactly that
+        if(format == Format::RGB565Swapped && size != static_cast<uint32_t>(width) * height * 2)
+        {
+            DEBUG_ERROR("AssetStore: Asset %u is %u bytes, not %u x %u pixels, ignored", index, static_cast<unsigned int>(size), width, height);
+            continue;
+        }
+
+        memcpy(names[assetCount], entry, kMaxNameLength);
+        names[assetCount][kMaxNameLength] = '\0';
+
+        Asset& asset = assets[assetCount++];
+        asset.name = names[assetCount - 1];
+        asset.format = format;
+        asset.width = width;
+        asset.height = height;
+        asset.data = header + offset;
+        asset.size = size;
+    }
+
+    mappedData = header;
+    mapped = true;
+
+    DEBUG_INFO("AssetStore: %u assets (%u bytes) mapped from the %s partition", assetCount, static_cast<unsigned int>(totalSize), partitionLabel);
+
+    return true;
+}
+
+void AssetStore::end()
+{
+    if(!mapped)
+        return;
+
+    spi_flash_munmap(mapHandle);
+
+    mapped = false;
+    mappedData = nullptr;
+    assetCount = 0;
+}
+
+const AssetStore::Asset* AssetStore::find(const char* name)
+{
+    for(uint16_t index = 0; index < assetCount; index++)
+    {
+        if(strcmp(assets[index].name, name) == 0)
+            return &assets[index];
+    }
+
+    return nullptr;
+}
@@ -0,0 +1,63 @@
+#ifndef ASSETSTORE_H
+#define ASSETSTORE_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "Arduino_DebugUtils.h"
+
+// Images (and other assets) kept in their own flash partition, built by tools/mpc_assets.py and written separately from the
+// firmware so they can be changed without recompiling. The partition is memory mapped, so an asset's pixels are read straight
+// from flash, nothing is copied into RAM first.
+//
+// Container format (little endian):
+//   Header:  "MPCA" (4 bytes), version (1 byte), 1 reserved byte, asset count (uint16), 4 reserved bytes, total size (uint32)
+//   Entries: name (24 bytes, NUL padded), format (1 byte), 1 reserved byte, width (uint16), height (uint16), 2 reserved bytes,
+//            offset from the start of the container (uint32, 4 byte aligned), size in bytes (uint32)
+class AssetStore
+{
+    public:
+        enum class Format : byte
+        {
+            RGB565Swapped = 0, // Display byte order, can be pushed as is
+            Raw = 1
+        };
+
+        struct Asset
+        {
+            const char* name;
+            Format format;
+            short width;
+            short height;
+            const uint8_t* data;
+            size_t size;
+        };
+
+        static const byte kVersion = 1;
+        static const byte kMaxNameLength = 24;
+
+        // Maps the partition and checks its header, false if there isn't one or it's empty (built in images are used instead)
+        static bool begin(const char* partitionLabel = "assets");
+        static void end();
+        static bool isMapped() { return mapped; }
+
+        // Returns nullptr if there's no asset with that name
+        static const Asset* find(const char* name);
+
+        static byte getCount() { return static_cast<byte>(assetCount); }
+        static const Asset* getAsset(byte index) { return index < assetCount ? &assets[index] : nullptr; }
+
+    private:
+        static const byte kHeaderSize = 16;
+        static const byte kEntrySize = 40;
+        static const byte kMaxAssets = 32;
+
+        static bool mapped;
+        static spi_flash_mmap_handle_t mapHandle;
+        static const uint8_t* mappedData;
+
+        static Asset assets[kMaxAssets];
+        static char names[kMaxAssets][kMaxNameLength + 1];
+        static uint16_t assetCount;
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include "CompressedImage.h"
+
+namespace
+{
+    const uint8_t kOpIndex = 0x00;
+    const uint8_t kOpDiff = 0x40;
+    const uint8_t kOpLuma = 0x80;
+    const uint8_t kOpRun = 0xC0;
+    const uint8_t kOpColour = 0xFE;
+    const uint8_t kOpMask = 0xC0;
+}
+
+CompressedImage::CompressedImage(const uint8_t* inData, size_t inSize) : data(inData), size(inSize)
+{
+    if(size >= kHeaderSize && data[0] == 'M' && data[1] == 'P' && data[2] == 'C' && data[3] == 'I')
+    {
+        width = data[4] | (data[5] << 8);
+        height = data[6] | (data[7] << 8);
+        valid = width > 0 && height > 0;
+    }
+
+    rewind();
+}
+
+void CompressedImage::rewind()
+{
+    position = kHeaderSize;
+    rowsDecoded = 0;
+    previous = 0;
+    runRemaining = 0;
+    truncated = false;
+    memset(index, 0, sizeof(index));
+}
+
+byte CompressedImage::colourHash(uint16_t colour)
+{
+    return ((colour >> 11) * 3 + ((colour >> 5) & 0x3F) * 5 + (colour & 0x1F) * 7) % 64;
+}
+
+short CompressedImage::decodeRows(uint16_t* pixels, short rows, bool swapBytes)
+{
+    if(!valid || truncated)
+        return 0;
+
+    if(rows > height - rowsDecoded)
+        rows = height - rowsDecoded;
+
+    size_t count = static_cast<size_t>(width) * rows;
+
+    for(size_t pixel = 0; pixel < count; pixel++)
+    {
+        // Runs carry on across rows and bands
+        if(runRemaining == 0)
+        {
+            // Every pixel not in a run needs an op, and colour and luma ops have operands after them
+            uint8_t op = position < size ? data[position] : 0;
+            size_t operands = op == kOpColour ? 2 : (op & kOpMask) == kOpLuma ? 1 : 0;
+            if(position >= size || operands > size - position - 1)
+            {
+                DEBUG_ERROR("CompressedImage: Data ends at pixel %u of row %d, image not decoded", static_cast<unsigned int>(pixel % width), rowsDecoded + static_cast<short>(pixel / width));
+                truncated = true;
+                return 0;
+            }
+
+            position++;
+
+            if(op == kOpColour)
+            {
+                previous = data[position] | (data[position + 1] << 8);
+                position += 2;
+                index[colourHash(previous)] = previous;
+            }
+            else if((op & kOpMask) == kOpRun)
+            {
+                runRemaining = (op & 0x3F) + 1;
+            }
+            else if((op & kOpMask) == kOpIndex)
+            {
+                previous = index[op & 0x3F];
+            }
+            else
+            {
+                int red = previous >> 11;
+                int green = (previous >> 5) & 0x3F;
+                int blue = previous & 0x1F;
+
+                if((op & kOpMask) == kOpDiff)
+                {
+                    red += ((op >> 4) & 0x03) - 2;
+                    green += ((op >> 2) & 0x03) - 2;
+                    blue += (op & 0x03) - 2;
+                }
+                else
+                {
+                    int greenDiff = (op & 0x3F) - 32;
+                    uint8_t second = data[position++];
+
+                    red += greenDiff + (second >> 4) - 8;
+                    green += greenDiff;
+                    blue += greenDiff + (second & 0x0F) - 8;
+                }
+
+                previous = ((red & 0x1F) << 11) | ((green & 0x3F) << 5) | (blue & 0x1F);
+                index[colourHash(previous)] = previous;
+            }
+        }
+
+        if(runRemaining > 0)
+            runRemaining--;
+
+        pixels[pixel] = swapBytes ? static_cast<uint16_t>((previous << 8) | (previous >> 8)) : previous;
+    }
+
+    rowsDecoded += rows;
+    return rows;
+}
+
+bool CompressedImage::draw(short x, short y, uint16_t* band, short bandRows, PushBand pushBand, bool swapBytes)
+{
+    if(!valid || band == nullptr || bandRows <= 0)
+        return false;
+
+    rewind();
+
+    short row = 0;
+    while(row < height)
+    {
+        short rows = decodeRows(band, bandRows, swapBytes);
+        if(rows == 0)
+            break;
+
+        pushBand(x, y + row, width, rows, band);
+        row += rows;
+    }
+
+    return row == height;
+}
+
+void CompressedImage::benchmark(const char* name, const uint8_t* data, size_t size, const uint16_t* raw)
+{
+    CompressedImage image(data, size);
+    if(!image.isValid())
+    {
+        DEBUG_ERROR("CompressedImage: %s isn't a compressed image", name);
+        return;
+    }
+
+    const short bandRows = 16;
+    uint16_t* band = static_cast<uint16_t*>(malloc(image.getWidth() * bandRows * sizeof(uint16_t)));
+    if(band == nullptr)
+        return;
+
+    size_t rawBytes = static_cast<size_t>(image.getWidth()) * image.getHeight() * sizeof(uint16_t);
+
+    // Decode in bands, as drawing does
+    unsigned long start = micros();
+    short rows;
+    while((rows = image.decodeRows(band, bandRows)) > 0);
+    unsigned long decodeMicros = micros() - start;
+
+    // Copy the raw pixels out of flash in the same bands, what pushImage reads
+    start = micros();
+    for(short row = 0; row < image.getHeight(); row += bandRows)
+    {
+        short copyRows = min(bandRows, static_cast<short>(image.getHeight() - row));
+        memcpy(band, raw + row * image.getWidth(), image.getWidth() * copyRows * sizeof(uint16_t));
+    }
+    unsigned long copyMicros = micros() - start;
+
+    // Check it decoded to the same pixels
+    image.rewind();
+    bool matches = true;
+    for(short row = 0; row < image.getHeight() && matches; row++)
+    {
+        image.decodeRows(band, 1);
+        matches = memcmp(band, raw + row * image.getWidth(), image.getWidth() * sizeof(uint16_t)) == 0;
+    }
+
+    free(band);
+
+    DEBUG_INFO("CompressedImage: %s %dx%d, %u bytes (raw %u, %u saved), decode %luus, raw copy %luus, %s", name, image.getWidth(), image.getHeight(), static_cast<unsigned int>(size), static_cast<unsigned int>(rawBytes), static_cast<unsigned int>(rawBytes - size), decodeMicros, copyMicros, matches ? "matches" : "DOES NOT MATCH");
+}
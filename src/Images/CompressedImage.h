@@ -0,0 +1,53 @@
+#ifndef COMPRESSEDIMAGE_H
+#define COMPRESSEDIMAGE_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+
+// Decodes images compressed by tools/mpc_image.py (QOI-style operations on RGB565 pixels, see the tool for the format).
+// Decoding streams top to bottom a band of rows at a time, so an image can go straight to the display or into a sprite without
+// the whole uncompressed image ever being in memory.
+class CompressedImage
+{
+    public:
+        static const byte kHeaderSize = 8;
+
+        // Pushes a decoded band, e.g. to the display or a sprite's pushImage
+        typedef void (*PushBand)(short x, short y, short w, short h, const uint16_t* pixels);
+
+        CompressedImage(const uint8_t* inData, size_t inSize);
+
+        bool isValid() const { return valid; }
+        short getWidth() const { return width; }
+        short getHeight() const { return height; }
+
+        // Decodes up to rows of the next rows into pixels (width * rows), returns how many rows were decoded. Returns 0 once the
+        // compressed data has ended before the image has (the rows it was decoding are left incomplete), until rewind().
+        short decodeRows(uint16_t* pixels, short rows, bool swapBytes = false);
+        void rewind();
+
+        // Decodes the whole image in bands of bandRows (band must hold width * bandRows pixels) and pushes each band at x, y
+        bool draw(short x, short y, uint16_t* band, short bandRows, PushBand pushBand, bool swapBytes = false);
+
+        // Logs the compressed and raw sizes and how long decoding takes compared to copying the raw pixels
+        static void benchmark(const char* name, const uint8_t* data, size_t size, const uint16_t* raw);
+
+    private:
+        static byte colourHash(uint16_t colour);
+
+        const uint8_t* data;
+        size_t size;
+        bool valid = false;
+        short width = 0;
+        short height = 0;
+
+        // Decoder state
+        size_t position;
+        short rowsDecoded;
+        uint16_t previous;
+        byte runRemaining;
+        bool truncated;
+        uint16_t index[64];
+};
+
+#endif
@@ -0,0 +1,28 @@
+// Compressed with tools/mpc_image.py from ImageBluetooth.h, decode with CompressedImage
+// Image Size     : 30x46 pixels
+// Memory usage   : 467 bytes (raw RGB565 is 2760 bytes)
+
+#include <Arduino.h>
+
+const uint8_t Wikipedia_Bluetooth_30x46_Compressed[467] PROGMEM = {
+0x4D, 0x50, 0x43, 0x49, 0x1E, 0x00, 0x2E, 0x00, 0xC7, 0xFE, 0xF2, 0x09, 0xCC, 0x00, 0xCC, 0x0C, 0xD0, 0x00, 0xC9, 0x0C, 0xD2, 0x00, 0xC7, 0x0C,
+0xD4, 0x00, 0xC5, 0x0C, 0xD6, 0x00, 0xC3, 0x0C, 0xC9, 0xFE, 0xD6, 0x53, 0xFE, 0x53, 0x1A, 0x0C, 0xCB, 0x00, 0xC1, 0x0C, 0xCA, 0xFE, 0xF9, 0x84,
+0xFE, 0xDD, 0xD6, 0x0C, 0xCC, 0x00, 0xC0, 0x0C, 0xCA, 0x22, 0xFE, 0xFF, 0xFF, 0xFE, 0xBA, 0xA5, 0x0C, 0xCB, 0x00, 0x0C, 0xCB, 0x22, 0x31, 0xC0,
+0xFE, 0x59, 0x95, 0x0C, 0xD8, 0x22, 0x31, 0xC1, 0xFE, 0x37, 0x64, 0x0C, 0xD7, 0x22, 0x31, 0xC2, 0xFE, 0x75, 0x43, 0x0C, 0xD6, 0x22, 0x31, 0xC2,
+0x9D, 0xAB, 0xFE, 0x14, 0x3B, 0x0C, 0xD5, 0x22, 0x31, 0xC0, 0xFE, 0x98, 0x74, 0x31, 0xC0, 0x9A, 0xBD, 0x28, 0x0C, 0xD4, 0x22, 0x31, 0xC0, 0x0C,
+0x13, 0x31, 0xC0, 0x27, 0x28, 0x0C, 0xCD, 0x28, 0xA3, 0x75, 0x0C, 0xC2, 0x22, 0x31, 0xC0, 0x0C, 0xC0, 0xFE, 0x7C, 0xC6, 0x31, 0xC0, 0x13, 0x0C,
+0xCC, 0x28, 0x27, 0x1F, 0x19, 0x0C, 0xC1, 0x22, 0x31, 0xC0, 0x0C, 0xC0, 0x28, 0x27, 0x31, 0xC0, 0x37, 0x0C, 0xCB, 0x06, 0x31, 0xC0, 0x1F, 0x19,
+0x0C, 0xC0, 0x22, 0x31, 0xC0, 0x0C, 0xC1, 0x06, 0x31, 0xC1, 0x3D, 0x0C, 0xCB, 0x13, 0x31, 0xC0, 0x1F, 0x19, 0x0C, 0x22, 0x31, 0xC0, 0x0C, 0xC0,
+0x2A, 0x31, 0xC1, 0x2A, 0x0C, 0xCD, 0x13, 0x31, 0xC0, 0x1F, 0x19, 0x22, 0x31, 0xC0, 0x0C, 0x2A, 0x31, 0xC1, 0x2A, 0x0C, 0xCF, 0x13, 0x31, 0xC0,
+0x1F, 0xFE, 0x1B, 0xB6, 0x31, 0xC0, 0x2A, 0x31, 0xC1, 0x2A, 0x0C, 0xD1, 0x13, 0x31, 0xC6, 0x2A, 0x0C, 0xD3, 0x13, 0x31, 0xC4, 0x2A, 0x0C, 0xD5,
+0x13, 0x31, 0xC2, 0x2A, 0x0C, 0xD6, 0x2A, 0x31, 0xC1, 0x1F, 0x19, 0x0C, 0xD5, 0x2A, 0x31, 0xC3, 0x1F, 0x19, 0x0C, 0xD3, 0x2A, 0x31, 0xC5, 0x1F,
+0x19, 0x0C, 0xD1, 0x2A, 0x31, 0xC1, 0x27, 0x31, 0xC0, 0x13, 0x31, 0xC0, 0x1F, 0x28, 0x0C, 0xCF, 0x2A, 0x31, 0xC1, 0x2A, 0x22, 0x31, 0xC0, 0x0C,
+0x13, 0x31, 0xC0, 0x27, 0x28, 0x0C, 0xCD, 0x2A, 0x31, 0xC1, 0x2A, 0x0C, 0x22, 0x31, 0xC0, 0x0C, 0xC0, 0x13, 0x31, 0xC0, 0x27, 0x28, 0x0C, 0xCB,
+0x0E, 0x31, 0xC1, 0x2A, 0x0C, 0xC0, 0x22, 0x31, 0xC0, 0x0C, 0xC1, 0x13, 0x31, 0xC0, 0x27, 0x28, 0x0C, 0xCA, 0x28, 0x27, 0x1F, 0x2A, 0x0C, 0xC1,
+0x22, 0x31, 0xC0, 0x0C, 0xC1, 0x2A, 0x31, 0xC0, 0x27, 0x28, 0x0C, 0xCB, 0x28, 0x19, 0x0C, 0xC2, 0x22, 0x31, 0xC0, 0x0C, 0xC0, 0x32, 0x31, 0xC0,
+0x1F, 0x19, 0x0C, 0xD2, 0x22, 0x31, 0xC0, 0x0C, 0x19, 0x1F, 0x31, 0xC0, 0x0E, 0x0C, 0xD3, 0x22, 0x31, 0xC0, 0x28, 0x27, 0x31, 0xC0, 0x06, 0x0C,
+0xD4, 0x22, 0x31, 0xC0, 0x2F, 0x31, 0xC0, 0x13, 0x0C, 0xD5, 0x22, 0x31, 0xC2, 0x27, 0x28, 0x0C, 0xD5, 0x22, 0x31, 0xC1, 0x1F, 0x28, 0x0C, 0xD6,
+0x22, 0x31, 0xC0, 0x1F, 0x19, 0x0C, 0xCA, 0x00, 0x0C, 0xCA, 0x22, 0x31, 0xC0, 0x2A, 0x0C, 0xCA, 0x00, 0xC0, 0x0C, 0xCA, 0x22, 0x31, 0x37, 0x0C,
+0xCB, 0x00, 0xC1, 0x0C, 0xC9, 0x22, 0x2F, 0x0C, 0xCB, 0x00, 0xC3, 0x0C, 0xC8, 0x0E, 0x28, 0x0C, 0xCA, 0x00, 0xC5, 0x0C, 0xD4, 0x00, 0xC7, 0x0C,
+0xD2, 0x00, 0xC9, 0x0C, 0xD0, 0x00, 0xCC, 0x0C, 0xCC, 0x00, 0xC6,
+};
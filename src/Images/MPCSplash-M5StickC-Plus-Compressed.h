@@ -0,0 +1,1012 @@
+// Compressed with tools/mpc_image.py from MPCSplash-M5StickC-Plus.h, decode with CompressedImage
+// Image Size     : 240x135 pixels
+// Memory usage   : 24088 bytes (raw RGB565 is 64800 bytes)
+
+#include <Arduino.h>
+
+const uint8_t MPCSplash_M5StickC_Plus_Compressed[24088] PROGMEM = {
+0x4D, 0x50, 0x43, 0x49, 0xF0, 0x00, 0x87, 0x00, 0xA6, 0x55, 0x5A, 0x66, 0xC2, 0x3C, 0x6E, 0x3C, 0x6F, 0xC1, 0x6E, 0xC0, 0x08, 0x0D, 0x7A, 0x0D,
+0x10, 0xC3, 0x6E, 0x10, 0xC5, 0x15, 0xC1, 0x10, 0x15, 0xC0, 0x08, 0x10, 0x15, 0x6B, 0xC0, 0x7A, 0x1C, 0xC3, 0x15, 0xC2, 0x10, 0x15, 0xC1, 0x10,
+0x0D, 0x10, 0xC1, 0x0D, 0x08, 0xC0, 0x10, 0x15, 0x6F, 0xA2, 0x77, 0xA3, 0x77, 0xA4, 0x66, 0xA4, 0x66, 0x51, 0x9B, 0xAA, 0x9B, 0xBB, 0x01, 0x9C,
+0xAB, 0x65, 0xC5, 0x55, 0xCB, 0x66, 0xC0, 0x05, 0xC4, 0x14, 0xC0, 0x05, 0x14, 0xC8, 0x6E, 0xDD, 0x14, 0xC1, 0x19, 0xCE, 0x20, 0xC0, 0x7E, 0xC0,
+0x34, 0x3C, 0xC1, 0x34, 0xC0, 0x28, 0xC4, 0x19, 0x28, 0xC2, 0x34, 0x08, 0x01, 0x08, 0xAE, 0x11, 0x7E, 0x35, 0x96, 0xED, 0x00, 0x05, 0xC0, 0x19,
+0xC0, 0x05, 0xC1, 0x14, 0xC0, 0xA3, 0x66, 0x19, 0x00, 0x05, 0xC0, 0x14, 0xC0, 0x2D, 0x28, 0x00, 0x05, 0xC1, 0x19, 0xC0, 0x01, 0x28, 0x00, 0x05,
+0xC3, 0x28, 0xC0, 0x2D, 0xA7, 0x55, 0xA5, 0x56, 0x69, 0x66, 0xC3, 0xA8, 0x44, 0x9A, 0xBB, 0x9C, 0xAA, 0x9C, 0xAA, 0x3C, 0x56, 0xC3, 0x3C, 0xC1,
+0x01, 0xC1, 0x08, 0xC0, 0x10, 0x08, 0x10, 0xC0, 0x0D, 0x10, 0xC0, 0x0D, 0x10, 0xC3, 0x15, 0x10, 0xC7, 0x15, 0x10, 0x15, 0xC0, 0x10, 0x6F, 0x24,
+0x1C, 0xC0, 0x10, 0xC0, 0x15, 0xC0, 0x10, 0xC1, 0x0D, 0xC0, 0x08, 0xC0, 0x0D, 0x08, 0x0D, 0xC0, 0x1C, 0x38, 0xA2, 0x67, 0x20, 0xA3, 0x67, 0xA3,
+0x77, 0x40, 0x0C, 0x21, 0x34, 0x19, 0x14, 0xC3, 0x55, 0xCD, 0x66, 0xC0, 0x05, 0xC4, 0x14, 0xD1, 0x19, 0xC1, 0x14, 0xC0, 0x19, 0xE5, 0x6B, 0x28,
+0xC0, 0x2D, 0x34, 0x3C, 0xC0, 0x34, 0x2D, 0xC0, 0x28, 0xC0, 0x69, 0x28, 0xC6, 0x34, 0x08, 0x01, 0x39, 0x2C, 0xA9, 0x43, 0x2C, 0x19, 0x00, 0x05,
+0x14, 0x19, 0x05, 0x00, 0x05, 0xC0, 0x14, 0x19, 0x28, 0x05, 0xC2, 0x14, 0x19, 0x3C, 0x05, 0x00, 0x05, 0x00, 0x14, 0xC0, 0x2D, 0x3C, 0x05, 0xC3,
+0x00, 0x28, 0xC1, 0x15, 0xA7, 0x55, 0x2C, 0x20, 0xC1, 0x2C, 0xC1, 0xFE, 0x35, 0xA5, 0x51, 0x51, 0x9B, 0xBA, 0x04, 0x9B, 0xAB, 0x1D, 0x9D, 0xA9,
+0x24, 0x01, 0x3C, 0x56, 0xC0, 0x39, 0x34, 0xC0, 0x39, 0x01, 0xC1, 0x6B, 0x01, 0xC0, 0x10, 0xC0, 0x0D, 0xC1, 0x10, 0xC0, 0x0D, 0x10, 0xC3, 0x0D,
+0x10, 0xC3, 0x0D, 0x10, 0xC1, 0x15, 0xC0, 0x10, 0x15, 0xC2, 0x10, 0xC2, 0x0D, 0xC1, 0x08, 0xC0, 0x01, 0x08, 0x10, 0x24, 0x3D, 0x18, 0xA3, 0x66,
+0x14, 0x7E, 0x9D, 0x9A, 0x3D, 0x10, 0x28, 0x19, 0x66, 0xC3, 0x05, 0xCD, 0x66, 0xC0, 0x05, 0xC5, 0x14, 0xD0, 0x19, 0xEA, 0x6B, 0x28, 0xC0, 0x2D,
+0x3C, 0xC2, 0x34, 0x28, 0xCA, 0x2D, 0x01, 0x08, 0x39, 0x0C, 0xAD, 0x12, 0x18, 0x92, 0xFF, 0x00, 0x05, 0x14, 0x19, 0x05, 0xC2, 0x14, 0x2D, 0x14,
+0x00, 0x05, 0xC0, 0x14, 0xC0, 0x2D, 0x28, 0x00, 0x05, 0xC1, 0x19, 0xC0, 0x3C, 0x19, 0x00, 0x05, 0xC1, 0x00, 0x14, 0x28, 0x20, 0x39, 0xA7, 0x55,
+0x2C, 0x65, 0x18, 0x1D, 0x20, 0xC2, 0xFE, 0xF4, 0x9C, 0xC0, 0xA2, 0x77, 0xC0, 0x55, 0x7B, 0x50, 0x41, 0x9B, 0xBB, 0x9A, 0xBB, 0x51, 0x9D, 0xA9,
+0x1D, 0x9C, 0xBA, 0x24, 0x9D, 0x9A, 0x65, 0xC0, 0x34, 0x39, 0xC0, 0x3C, 0xC1, 0x01, 0xC2, 0x08, 0xC2, 0x6E, 0x7A, 0x08, 0xC0, 0x0D, 0xC0, 0x10,
+0xC8, 0x0D, 0xC0, 0x10, 0xC3, 0x0D, 0x10, 0xC2, 0x0D, 0x08, 0x01, 0x10, 0x6F, 0xA2, 0x77, 0x04, 0x20, 0xA3, 0x67, 0xA2, 0x77, 0xC0, 0x20, 0x24,
+0x3C, 0x51, 0x51, 0xC3, 0x05, 0xCE, 0x66, 0xC0, 0x05, 0xC6, 0x14, 0xC3, 0x19, 0xC9, 0x14, 0xC0, 0x19, 0xE9, 0x28, 0xC1, 0x2D, 0x34, 0xC1, 0x2D,
+0xC0, 0x28, 0xC9, 0x56, 0x28, 0x3C, 0x08, 0x3C, 0x24, 0xAF, 0x01, 0x95, 0xED, 0x93, 0xEF, 0x00, 0x05, 0x19, 0x14, 0x05, 0xC1, 0x14, 0x19, 0x28,
+0x05, 0xC2, 0x14, 0x19, 0x2D, 0x05, 0xC2, 0x14, 0x19, 0x2D, 0x7F, 0x00, 0xC0, 0x05, 0xC0, 0x00, 0x05, 0x28, 0xC0, 0x20, 0x24, 0xA6, 0x55, 0xC0,
+0x1D, 0xC2, 0x20, 0xC1, 0xFE, 0x92, 0x94, 0xA2, 0x77, 0x28, 0x56, 0x51, 0x20, 0xA5, 0x55, 0x66, 0x3C, 0xC0, 0x56, 0xC0, 0x25, 0x9C, 0xBA, 0x51,
+0x9C, 0xAA, 0x9C, 0xAA, 0x9C, 0xAA, 0x18, 0x38, 0x24, 0x15, 0x10, 0x01, 0x66, 0xC7, 0x01, 0xC1, 0x6B, 0xC1, 0x6E, 0xC0, 0x08, 0x0D, 0x08, 0xC0,
+0x10, 0xC1, 0x0D, 0x08, 0x0D, 0xC0, 0x10, 0x0D, 0x08, 0xC0, 0x10, 0xC1, 0x0D, 0x01, 0xC1, 0x10, 0xA2, 0x67, 0x38, 0xA2, 0x77, 0xA3, 0x67, 0xA3,
+0x76, 0x1C, 0x9D, 0x9A, 0x0C, 0x10, 0x9D, 0x9A, 0x19, 0x14, 0xC3, 0x05, 0xCF, 0x66, 0x05, 0xC6, 0x14, 0xC2, 0x19, 0x14, 0xC0, 0x19, 0xC8, 0x14,
+0x19, 0xE9, 0x7F, 0xC1, 0x2D, 0xC1, 0x28, 0xCE, 0x3C, 0x6F, 0x3C, 0x0D, 0xB0, 0x00, 0x9B, 0xBB, 0x19, 0x9D, 0xAA, 0x05, 0x19, 0x05, 0xC1, 0x14,
+0xC0, 0x28, 0x14, 0x05, 0xC1, 0x14, 0xC0, 0xA3, 0x66, 0x19, 0x00, 0x05, 0xC0, 0x14, 0x19, 0xC0, 0x3C, 0x14, 0x00, 0x05, 0xC2, 0x14, 0x2D, 0x28,
+0x39, 0x0C, 0xA3, 0x66, 0x18, 0x7E, 0x18, 0xC0, 0x1D, 0x20, 0x1D, 0x18, 0xFE, 0x92, 0x94, 0xA2, 0x77, 0x28, 0x6B, 0x55, 0x55, 0x20, 0x28, 0x5A,
+0x20, 0xC1, 0xA2, 0x77, 0x28, 0x34, 0xC0, 0x28, 0x55, 0x9D, 0xAA, 0x56, 0x51, 0x04, 0x51, 0x9D, 0x9A, 0x9D, 0xA9, 0x18, 0x51, 0x65, 0x9D, 0x9A,
+0x10, 0xC0, 0x01, 0x66, 0xC0, 0x01, 0x3C, 0xC2, 0x08, 0x01, 0x3C, 0x01, 0xC1, 0x08, 0x01, 0x08, 0xC1, 0x0D, 0x10, 0x08, 0x0D, 0xC0, 0x08, 0xC0,
+0x0D, 0xC0, 0x08, 0xC0, 0x01, 0x08, 0x0D, 0x1C, 0x3D, 0x18, 0x34, 0x14, 0xC0, 0x2C, 0x38, 0x01, 0x9D, 0xAA, 0x51, 0xC4, 0x05, 0xCF, 0x66, 0xC0,
+0x05, 0xC5, 0x14, 0xC1, 0x6E, 0xC4, 0x14, 0xC0, 0x19, 0xF0, 0x28, 0xC2, 0x2D, 0xC0, 0x28, 0xCD, 0x66, 0x2D, 0x10, 0x08, 0x3C, 0xAD, 0x12, 0xA4,
+0x66, 0xFE, 0xA3, 0x10, 0x05, 0x14, 0xC0, 0x05, 0xC2, 0x19, 0x7F, 0x05, 0xC2, 0x14, 0x19, 0x2D, 0x05, 0x66, 0x05, 0xC0, 0x14, 0x19, 0x2D, 0xC0,
+0x00, 0x05, 0xC3, 0x28, 0xC1, 0xA7, 0x44, 0xA6, 0x55, 0x66, 0x18, 0x1D, 0x18, 0xC1, 0x1D, 0x20, 0xC0, 0xFE, 0xB3, 0x94, 0xC1, 0x65, 0xC0, 0x56,
+0x2F, 0x20, 0x28, 0x20, 0x65, 0x52, 0xC0, 0x6E, 0xC2, 0x14, 0x0C, 0x11, 0x0C, 0xC0, 0x11, 0x0C, 0x07, 0x24, 0xC1, 0x9D, 0x99, 0x30, 0x52, 0x40,
+0x61, 0x52, 0x18, 0x04, 0x38, 0x51, 0x1C, 0xC0, 0x10, 0x0D, 0x08, 0x3C, 0x6E, 0xC0, 0x3C, 0xC2, 0x01, 0xC0, 0x3C, 0x01, 0x08, 0x0D, 0xC0, 0x01,
+0xC1, 0x08, 0x10, 0x0D, 0x10, 0x24, 0xA4, 0x66, 0x2C, 0xA2, 0x77, 0xA2, 0x77, 0x00, 0x9C, 0xA9, 0x1C, 0x2D, 0x19, 0x66, 0xC4, 0x55, 0xD0, 0x66,
+0x05, 0xC5, 0x14, 0xC1, 0x19, 0x14, 0x19, 0xC1, 0x14, 0xC1, 0x19, 0xEF, 0x7E, 0x6B, 0xC1, 0x2D, 0xC1, 0x28, 0xC2, 0x56, 0xC0, 0x28, 0xC9, 0x01,
+0x10, 0x3C, 0x0C, 0xAB, 0x23, 0x29, 0x05, 0x6B, 0x14, 0x05, 0xC0, 0x14, 0xC0, 0x28, 0x14, 0x00, 0x05, 0xC0, 0x14, 0xC0, 0x2D, 0x19, 0x00, 0x05,
+0x00, 0x05, 0x19, 0x28, 0xA2, 0x77, 0x14, 0x00, 0x05, 0xC0, 0x00, 0x05, 0x14, 0x28, 0x19, 0x01, 0x18, 0x7E, 0x18, 0xC1, 0x1D, 0x18, 0x1D, 0x20,
+0xC0, 0x2C, 0xFE, 0xB3, 0x94, 0x51, 0x34, 0x9D, 0xA9, 0x6B, 0x34, 0x65, 0x1B, 0x20, 0x51, 0xC0, 0x07, 0x55, 0x0C, 0xC3, 0x65, 0xC0, 0x38, 0x51,
+0xC1, 0x7F, 0x69, 0xC0, 0x33, 0x59, 0x38, 0xC0, 0x29, 0x2C, 0x24, 0x51, 0x65, 0x10, 0x9D, 0x99, 0x66, 0x65, 0x51, 0x56, 0x65, 0x56, 0x18, 0x65,
+0x51, 0x56, 0x65, 0x15, 0x66, 0x01, 0xC0, 0x3C, 0x01, 0xC5, 0x6B, 0x10, 0x6F, 0x30, 0x18, 0x34, 0xA2, 0x67, 0x7F, 0x31, 0x9B, 0xBB, 0x01, 0x19,
+0xC0, 0x66, 0xC4, 0x55, 0xD1, 0x66, 0x05, 0xC3, 0x14, 0xC2, 0x19, 0x14, 0x19, 0xF5, 0x7F, 0xD5, 0x6E, 0x01, 0x10, 0x08, 0xA4, 0x65, 0xAD, 0x22,
+0x2C, 0x2D, 0x05, 0x14, 0x05, 0xC1, 0x19, 0x28, 0x05, 0xC2, 0x14, 0x19, 0x2D, 0x05, 0xC2, 0x14, 0xC0, 0x2D, 0x28, 0x00, 0x05, 0xC1, 0x00, 0x05,
+0x28, 0x5A, 0x28, 0x35, 0xA5, 0x65, 0x1D, 0x18, 0xC3, 0x1D, 0x7A, 0xC1, 0xFE, 0x92, 0x8C, 0x7A, 0x6F, 0x51, 0x65, 0x25, 0x20, 0x1B, 0x55, 0xC0,
+0x14, 0x1B, 0x0C, 0xC1, 0x65, 0x56, 0xC0, 0x00, 0x5A, 0x38, 0x65, 0x56, 0xC3, 0x65, 0xC0, 0x24, 0x18, 0x5A, 0x18, 0x56, 0x66, 0x10, 0xC1, 0x15,
+0xC0, 0x61, 0x5A, 0x10, 0x51, 0x55, 0x3C, 0x51, 0x51, 0xC0, 0x55, 0x61, 0x51, 0x11, 0x51, 0x9D, 0xAA, 0x9D, 0x99, 0x39, 0x7A, 0xC2, 0x08, 0xA2,
+0x76, 0x24, 0xA3, 0x67, 0x20, 0xA3, 0x67, 0x05, 0xC0, 0x9B, 0xBB, 0x24, 0x39, 0x19, 0x66, 0xC5, 0x55, 0xD1, 0x66, 0x05, 0xC4, 0x14, 0xC1, 0x19,
+0xF7, 0x7F, 0xD6, 0x3C, 0xA2, 0x77, 0x0D, 0x10, 0xAC, 0x23, 0xA3, 0x66, 0x29, 0x14, 0x05, 0xC2, 0xA3, 0x77, 0x19, 0x00, 0x05, 0xC0, 0x14, 0xC0,
+0xA3, 0x66, 0x14, 0x00, 0x05, 0x00, 0x05, 0x19, 0xC0, 0x2D, 0x14, 0x05, 0xC3, 0x19, 0x28, 0x56, 0x10, 0x1D, 0x7A, 0x18, 0xC5, 0x1D, 0x20, 0xC0,
+0xFE, 0x92, 0x94, 0x56, 0xC1, 0x28, 0x20, 0x1B, 0x59, 0x7A, 0x0C, 0x20, 0x14, 0xC0, 0x11, 0x61, 0x0C, 0x38, 0xC0, 0x0C, 0x2C, 0x38, 0x33, 0x55,
+0x2C, 0xC0, 0x52, 0x24, 0xC0, 0x65, 0x5A, 0xC0, 0x66, 0xC1, 0x65, 0x0B, 0x30, 0x6F, 0xC2, 0x51, 0xC0, 0x65, 0x56, 0x28, 0x6E, 0x28, 0xC0, 0x1C,
+0x5A, 0xC0, 0x6E, 0x19, 0x51, 0x1D, 0x35, 0x08, 0x51, 0x7E, 0xC0, 0x08, 0xA3, 0x66, 0x29, 0xA2, 0x78, 0xA4, 0x66, 0x14, 0x19, 0x9D, 0xAA, 0x04,
+0x9B, 0xBA, 0x9C, 0xAA, 0x55, 0x66, 0xC5, 0x55, 0xD1, 0x66, 0x05, 0xC4, 0x14, 0xC1, 0x19, 0xF7, 0x28, 0xD6, 0xA2, 0x66, 0x10, 0x6E, 0x01, 0x2C,
+0xA9, 0x33, 0x97, 0xDC, 0x34, 0x00, 0x05, 0xC0, 0x14, 0x28, 0x05, 0xC1, 0x14, 0x05, 0x28, 0xC0, 0x05, 0x00, 0x05, 0xC0, 0x14, 0xC0, 0xA3, 0x66,
+0x28, 0x00, 0x05, 0xC1, 0x00, 0x14, 0x28, 0x19, 0x34, 0x04, 0xA3, 0x76, 0x56, 0x65, 0xC1, 0x18, 0x1D, 0x20, 0x1D, 0x18, 0x20, 0xC0, 0xFE, 0x72,
+0x8C, 0x65, 0xC0, 0x2F, 0x20, 0x7E, 0x20, 0x1B, 0x14, 0x07, 0x14, 0x11, 0x66, 0x07, 0x38, 0x7E, 0xC0, 0x5A, 0x14, 0x38, 0xC0, 0x33, 0x24, 0x33,
+0xC0, 0x59, 0x24, 0x1F, 0xC0, 0x55, 0x6E, 0x1F, 0x24, 0x10, 0xC0, 0x01, 0x66, 0x0B, 0x3C, 0x30, 0x01, 0x9D, 0xAA, 0x1C, 0x30, 0x28, 0x1C, 0x23,
+0x59, 0x66, 0x65, 0x5A, 0x7E, 0x14, 0xC0, 0x19, 0xC0, 0x0D, 0x9B, 0xBB, 0x04, 0x9A, 0xBB, 0x2D, 0xA2, 0x77, 0xA3, 0x77, 0xA2, 0x77, 0xA2, 0x77,
+0x2C, 0x1C, 0x19, 0x25, 0x9A, 0xBC, 0x9B, 0xBA, 0x9D, 0x9A, 0x65, 0xC6, 0x55, 0xD1, 0x66, 0x05, 0xC4, 0x14, 0xC1, 0x6E, 0xF7, 0x7F, 0xC7, 0x69,
+0x28, 0xCB, 0x2D, 0xC0, 0xA3, 0x67, 0x7E, 0x01, 0x0C, 0x10, 0x98, 0xCC, 0x34, 0x9B, 0xBA, 0x05, 0x14, 0x19, 0x14, 0x00, 0x05, 0xC0, 0x14, 0xC0,
+0x2D, 0x14, 0x00, 0x05, 0xC0, 0x14, 0xC0, 0x28, 0x2D, 0x05, 0xC4, 0x19, 0x28, 0x19, 0x24, 0x1D, 0x65, 0x0C, 0x18, 0xC3, 0x1D, 0x18, 0xC0, 0x1D,
+0x7A, 0x2F, 0x55, 0x51, 0x20, 0x0C, 0x2F, 0x20, 0xC0, 0x1B, 0x9D, 0x99, 0x0C, 0xC1, 0x07, 0x69, 0x38, 0x65, 0x38, 0xC0, 0x00, 0x38, 0xC0, 0x2C,
+0xC0, 0x33, 0x2C, 0x56, 0xC1, 0x65, 0x24, 0x2C, 0x24, 0x55, 0x10, 0xC2, 0x65, 0x52, 0x69, 0x6F, 0x51, 0xC2, 0x51, 0xC2, 0x65, 0x5A, 0x14, 0xC0,
+0x08, 0x56, 0x08, 0x05, 0x14, 0x27, 0x98, 0xCB, 0x2D, 0xA4, 0x66, 0x09, 0xA2, 0x87, 0x05, 0xA2, 0x77, 0x05, 0x11, 0x15, 0x2D, 0x51, 0x66, 0xC3,
+0x55, 0x14, 0xC0, 0x05, 0xD1, 0x66, 0x05, 0xC4, 0x14, 0xC1, 0x19, 0xF7, 0x7F, 0xC7, 0x56, 0x28, 0xCC, 0x2D, 0x01, 0x15, 0x52, 0xA3, 0x77, 0x04,
+0x99, 0xBB, 0x19, 0x00, 0xA2, 0x67, 0x14, 0x19, 0x05, 0xC2, 0x14, 0x19, 0x28, 0x05, 0xC2, 0x14, 0xC0, 0x2D, 0x19, 0x00, 0x05, 0xC2, 0x14, 0x28,
+0x20, 0x2D, 0xA9, 0x44, 0x6F, 0x0C, 0x18, 0xC5, 0x7E, 0xC0, 0x6F, 0xC0, 0x2F, 0x6E, 0x51, 0xC0, 0x65, 0x20, 0x7E, 0x14, 0xC0, 0x07, 0x14, 0xC0,
+0x07, 0x69, 0x6F, 0x00, 0x38, 0x00, 0x51, 0x07, 0x3D, 0x00, 0x38, 0x24, 0x38, 0x00, 0x33, 0x38, 0x24, 0xC0, 0x2C, 0xC0, 0x9D, 0x9A, 0x04, 0x10,
+0xC0, 0x04, 0xC0, 0x0B, 0x10, 0x3C, 0x6E, 0x30, 0x56, 0xC0, 0x23, 0x59, 0x66, 0x1C, 0x19, 0x14, 0x0F, 0xC0, 0x14, 0xC0, 0x51, 0x7E, 0x00, 0x31,
+0x14, 0x08, 0x95, 0xDE, 0x9B, 0xBA, 0xA8, 0x44, 0xA6, 0x55, 0x14, 0xC0, 0x31, 0x9B, 0xBB, 0x0D, 0x2D, 0x51, 0x05, 0x7F, 0xC3, 0x05, 0xDA, 0x14,
+0xC0, 0x19, 0xF9, 0x28, 0xD6, 0xA2, 0x77, 0x1C, 0x65, 0x66, 0xAF, 0x00, 0x56, 0x2D, 0x11, 0x66, 0x7E, 0xC0, 0x05, 0xC1, 0x14, 0xC0, 0x28, 0x19,
+0x05, 0xC1, 0x14, 0xC0, 0x28, 0x2D, 0x05, 0xC4, 0x28, 0xC0, 0x5A, 0xA7, 0x55, 0x18, 0xC0, 0x65, 0xC1, 0x18, 0xC3, 0x1D, 0x7A, 0xC0, 0x6F, 0xFE,
+0x92, 0x94, 0x2F, 0x28, 0xC1, 0x56, 0x65, 0xC0, 0x56, 0xC0, 0x20, 0x55, 0x0C, 0xC0, 0x51, 0xC0, 0x0C, 0x65, 0x38, 0xC0, 0x00, 0xC0, 0x38, 0xC0,
+0x3D, 0x0C, 0x38, 0x24, 0x51, 0x51, 0x9D, 0x99, 0x0F, 0x34, 0xC0, 0x2C, 0x34, 0x6F, 0x6E, 0x7F, 0xA2, 0x77, 0x7E, 0x3C, 0x37, 0xC0, 0x28, 0x14,
+0x28, 0x23, 0x0F, 0xC0, 0x14, 0x08, 0xC0, 0x05, 0x08, 0xC0, 0x05, 0x08, 0x00, 0xC0, 0x14, 0x08, 0x92, 0xFF, 0x56, 0x2C, 0x08, 0x00, 0x1D, 0x9A,
+0xCB, 0x9C, 0x9A, 0x9D, 0xAA, 0x65, 0xC5, 0x55, 0xDA, 0x14, 0xC0, 0x6E, 0xF9, 0x7F, 0xD6, 0x3C, 0xA3, 0x67, 0x15, 0x52, 0x31, 0xA7, 0x54, 0xFE,
+0x04, 0x21, 0x99, 0xBC, 0xC0, 0x14, 0x05, 0xC1, 0x14, 0xC0, 0x19, 0x28, 0x05, 0xC2, 0x14, 0x19, 0x3C, 0x19, 0x9D, 0xAA, 0x05, 0xC2, 0x19, 0x28,
+0x20, 0x08, 0x18, 0x65, 0x18, 0xC0, 0x09, 0x0C, 0x18, 0xC1, 0x1D, 0xC0, 0x7A, 0xC1, 0x2C, 0xFE, 0x92, 0x94, 0x1B, 0x28, 0x56, 0xC0, 0x1B, 0x55,
+0x28, 0x0C, 0xC0, 0x20, 0x11, 0x7A, 0x20, 0x38, 0xC1, 0x7E, 0x0C, 0x9C, 0xAA, 0x0C, 0x14, 0x00, 0xC0, 0x51, 0x41, 0x9B, 0xBB, 0x9B, 0xBA, 0x51,
+0x18, 0x09, 0x7A, 0xC0, 0x18, 0x04, 0xC0, 0x0C, 0xC1, 0x1D, 0x34, 0xA2, 0x67, 0x28, 0xA2, 0x77, 0xC0, 0x9D, 0xA9, 0x56, 0x28, 0x1C, 0x14, 0xC0,
+0x65, 0x1C, 0x14, 0x51, 0x05, 0x7E, 0x14, 0x05, 0x00, 0x34, 0x14, 0x18, 0x93, 0xFE, 0xA8, 0x44, 0x08, 0x31, 0x09, 0x10, 0x25, 0x19, 0x14, 0xC5,
+0x55, 0xD3, 0x66, 0x05, 0xC4, 0x14, 0xC0, 0x19, 0xD0, 0x7F, 0x19, 0xE6, 0x28, 0xD6, 0xA2, 0x77, 0x10, 0x6E, 0x10, 0x04, 0xAC, 0x22, 0x04, 0x95,
+0xDD, 0x66, 0x14, 0x05, 0xC0, 0x14, 0xC1, 0x2D, 0x19, 0x00, 0x05, 0xC0, 0x14, 0xC0, 0x28, 0x2D, 0x05, 0xC4, 0x28, 0x21, 0x28, 0xA8, 0x44, 0x18,
+0x04, 0x18, 0xC0, 0x09, 0x18, 0xC2, 0x1D, 0x20, 0xC0, 0x1D, 0x20, 0x6F, 0xFE, 0x92, 0x94, 0x9D, 0x9A, 0xA2, 0x77, 0xC2, 0x55, 0x7A, 0x11, 0x1B,
+0x11, 0x61, 0x0C, 0x14, 0x0C, 0xC0, 0x51, 0x3D, 0x07, 0x3D, 0x14, 0xC0, 0x3D, 0x01, 0x9A, 0xBB, 0x1D, 0x61, 0xC0, 0x18, 0xC1, 0x7E, 0x2C, 0x20,
+0x18, 0x20, 0x18, 0x0C, 0x18, 0xC0, 0x1D, 0xC0, 0x34, 0xA4, 0x56, 0x7F, 0x01, 0x23, 0xC0, 0x1C, 0x0F, 0x55, 0xA2, 0x77, 0xC0, 0x0F, 0x08, 0xC0,
+0x0D, 0x00, 0x69, 0x00, 0xC0, 0x39, 0x08, 0x96, 0xCD, 0x99, 0xCC, 0x18, 0x1D, 0x9B, 0xBB, 0x9B, 0xBA, 0x20, 0x65, 0xC6, 0x55, 0xD2, 0x66, 0xC0,
+0x05, 0xC4, 0x14, 0xC0, 0x6E, 0xFB, 0x7F, 0xD4, 0x2D, 0x10, 0x6F, 0xC0, 0x24, 0xAD, 0x11, 0x08, 0xFE, 0xA3, 0x10, 0x9C, 0xAA, 0x14, 0xC0, 0x05,
+0xC0, 0x14, 0x19, 0x28, 0x05, 0xC2, 0x14, 0x19, 0x3C, 0x14, 0x00, 0x05, 0xC2, 0x19, 0x28, 0x19, 0x15, 0x18, 0x65, 0xC0, 0x18, 0x0C, 0xC1, 0x18,
+0xC5, 0x7E, 0x2C, 0xFE, 0x72, 0x8C, 0x65, 0x1B, 0x20, 0x7E, 0xC0, 0x9D, 0x9A, 0xC0, 0x20, 0x0C, 0x07, 0x0C, 0x3D, 0x0C, 0x14, 0x0C, 0x07, 0x38,
+0x0C, 0x11, 0x0C, 0x9B, 0xAA, 0x98, 0xCC, 0x09, 0x65, 0x04, 0xA2, 0x76, 0x18, 0x7E, 0x04, 0x30, 0x69, 0xC0, 0x24, 0xA2, 0x77, 0x11, 0x3D, 0x09,
+0x18, 0x65, 0xC0, 0x1D, 0x2C, 0x39, 0x0F, 0xA4, 0x65, 0xA3, 0x67, 0x51, 0x9C, 0xAA, 0x08, 0x56, 0x14, 0x08, 0xC0, 0x14, 0x05, 0x00, 0xC0, 0x08,
+0x00, 0xC0, 0x39, 0x08, 0x2C, 0x34, 0xA3, 0x76, 0x0C, 0x9B, 0xAA, 0x9B, 0xBB, 0x19, 0x66, 0xC6, 0x55, 0xD2, 0x66, 0xC0, 0x05, 0xC4, 0x14, 0xC0,
+0x19, 0xFB, 0x28, 0xD5, 0xA3, 0x66, 0x24, 0x1C, 0xC0, 0xAB, 0x22, 0x30, 0x2B, 0x19, 0x51, 0xC2, 0x19, 0x2D, 0x14, 0x00, 0x05, 0xC0, 0x14, 0xC0,
+0x2D, 0xC0, 0x05, 0xC3, 0x14, 0x2D, 0x52, 0x2D, 0x3D, 0x18, 0x0C, 0xC0, 0x04, 0x0C, 0xC1, 0x18, 0xC2, 0x7E, 0xC3, 0xFE, 0x72, 0x8C, 0xC1, 0x1B,
+0xC1, 0x55, 0xC0, 0x7E, 0x5A, 0x0C, 0x1B, 0x40, 0x7A, 0xC0, 0x0C, 0x07, 0x0C, 0x1B, 0x9D, 0x99, 0x98, 0xCC, 0x09, 0x9D, 0xAA, 0x04, 0xC0, 0x65,
+0x1C, 0x01, 0xC0, 0x2D, 0x19, 0xC0, 0x66, 0xC0, 0x19, 0xC0, 0x7F, 0xA2, 0x77, 0x10, 0x29, 0x24, 0x29, 0x38, 0xA6, 0x55, 0x23, 0x6E, 0xA3, 0x66,
+0x7F, 0x28, 0x51, 0xC0, 0x0F, 0x51, 0xA2, 0x66, 0xC0, 0x66, 0xC0, 0x05, 0x00, 0xC1, 0x05, 0x14, 0x7E, 0x92, 0xFF, 0x9C, 0xAA, 0x38, 0x9B, 0xAA,
+0x19, 0x66, 0xC7, 0x55, 0xD3, 0x66, 0xC0, 0x05, 0xC3, 0x14, 0xC0, 0x19, 0xDD, 0x28, 0xC4, 0x19, 0xC4, 0x28, 0x19, 0xD0, 0x28, 0xCE, 0x2D, 0x28,
+0xC0, 0x2D, 0x28, 0xC0, 0x3C, 0x24, 0xC0, 0x15, 0x1D, 0xA9, 0x44, 0x2C, 0x97, 0xCC, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0x28, 0x05, 0xC2, 0x14, 0x19,
+0xA3, 0x77, 0x14, 0x05, 0x00, 0x05, 0xC1, 0x28, 0xC1, 0x24, 0xA4, 0x66, 0xC2, 0x09, 0x0C, 0x18, 0xC0, 0x0C, 0x18, 0xC1, 0x7E, 0xC0, 0x2C, 0xC0,
+0x20, 0x11, 0x1B, 0x6E, 0x65, 0xC0, 0x11, 0x14, 0xC0, 0x3D, 0x7F, 0xC1, 0x07, 0x11, 0x0C, 0x65, 0x0C, 0x20, 0x9B, 0xAA, 0x34, 0x38, 0x55, 0x6F,
+0x38, 0x30, 0xC0, 0x3C, 0x9C, 0xAA, 0xC0, 0x19, 0xC5, 0x14, 0xC1, 0x28, 0x2D, 0x10, 0x30, 0x29, 0xA3, 0x77, 0xAA, 0x23, 0xA3, 0x77, 0x7E, 0x6F,
+0x9D, 0xA9, 0x9A, 0xAB, 0x08, 0x0F, 0x08, 0x05, 0x66, 0x3B, 0xC0, 0x00, 0x08, 0x00, 0x05, 0xC0, 0x1C, 0x15, 0x9A, 0xBC, 0x15, 0x9C, 0xAA, 0x19,
+0x14, 0xC7, 0x55, 0xD2, 0x66, 0xC1, 0x05, 0xC3, 0x14, 0xC0, 0x19, 0xDD, 0x28, 0xC4, 0x19, 0xC4, 0x28, 0x19, 0xD0, 0x28, 0xCE, 0x2D, 0x28, 0xC3,
+0x2D, 0x15, 0x7F, 0x15, 0x35, 0x37, 0x55, 0x30, 0x00, 0xC0, 0x14, 0xC0, 0xA2, 0x77, 0x14, 0x05, 0xC1, 0x14, 0xC0, 0x2D, 0x28, 0x05, 0xC1, 0x00,
+0x05, 0x14, 0x2D, 0x19, 0x01, 0x0C, 0xC0, 0x56, 0xC0, 0x0C, 0xC4, 0x6F, 0xC1, 0x7E, 0xC0, 0x2C, 0xC1, 0xB0, 0x00, 0xC1, 0x1B, 0x6E, 0x0C, 0x07,
+0x0C, 0x7E, 0x07, 0x69, 0xC1, 0x0C, 0xC0, 0x14, 0x0C, 0x10, 0x18, 0x9A, 0xBB, 0x29, 0x35, 0x30, 0xA3, 0x76, 0x34, 0x38, 0x28, 0x19, 0x28, 0x19,
+0xC9, 0x62, 0x5A, 0x01, 0xAA, 0x33, 0x30, 0x9D, 0xA9, 0xFE, 0x2D, 0x63, 0xA6, 0x55, 0x3D, 0x7F, 0x37, 0x9D, 0x99, 0x66, 0x55, 0x08, 0xC1, 0x00,
+0x08, 0x00, 0x08, 0x5A, 0xC0, 0xA2, 0x77, 0x29, 0x98, 0xCC, 0xA3, 0x77, 0x28, 0x51, 0xC2, 0x19, 0xC0, 0x14, 0xC2, 0x55, 0xD1, 0x66, 0xC3, 0x05,
+0xC2, 0x14, 0xC0, 0x19, 0xDD, 0x28, 0xC4, 0x19, 0xC5, 0x28, 0xC0, 0x19, 0xCE, 0x28, 0xCF, 0x2D, 0xC0, 0x28, 0x2D, 0xC1, 0x10, 0x24, 0x5A, 0xC0,
+0xAC, 0x32, 0xA3, 0x67, 0x15, 0x05, 0xC0, 0x14, 0xC0, 0x28, 0x05, 0xC2, 0x14, 0x28, 0xA2, 0x77, 0x14, 0x05, 0xC3, 0x28, 0xC1, 0x29, 0xA4, 0x66,
+0x09, 0x7A, 0xC2, 0x09, 0xC0, 0x0C, 0x18, 0xC1, 0x1D, 0x7A, 0xC2, 0x2C, 0x07, 0x6E, 0xC0, 0x1B, 0x69, 0x07, 0x38, 0xA3, 0x66, 0x14, 0x38, 0x7E,
+0x0C, 0xC0, 0x00, 0x0C, 0xA2, 0x77, 0x98, 0xCC, 0x04, 0x9C, 0xAA, 0x24, 0xC0, 0xA3, 0x66, 0x31, 0xA3, 0x77, 0x25, 0x94, 0xEF, 0x19, 0xC1, 0x56,
+0x19, 0x7E, 0x66, 0xC0, 0x4A, 0x19, 0xC0, 0x7B, 0x19, 0xC2, 0x05, 0x3C, 0xAE, 0x10, 0x15, 0x2D, 0x10, 0xAA, 0x33, 0x2F, 0x1B, 0x97, 0xCC, 0x9A,
+0xBB, 0xC2, 0x65, 0x08, 0x00, 0xC1, 0x6E, 0x14, 0x7E, 0x35, 0x97, 0xDD, 0xA2, 0x77, 0x19, 0x66, 0x55, 0x14, 0x19, 0xC1, 0x14, 0xC2, 0x05, 0xD1,
+0x66, 0xC4, 0x05, 0xC1, 0x14, 0xC0, 0x19, 0xDD, 0x28, 0xC4, 0x19, 0xC5, 0x28, 0xC0, 0x19, 0xCE, 0x28, 0xCF, 0x2D, 0xC4, 0xA2, 0x77, 0x24, 0x29,
+0x52, 0x31, 0x3C, 0x1C, 0x05, 0xC0, 0x14, 0x19, 0xC0, 0x05, 0xC1, 0x14, 0x19, 0x2D, 0x28, 0x00, 0x05, 0xC2, 0x19, 0x2D, 0x19, 0x01, 0xA7, 0x55,
+0xC0, 0x04, 0x09, 0x0C, 0x09, 0x0C, 0xC2, 0x18, 0xC1, 0x7E, 0x1D, 0x20, 0xC0, 0x2C, 0xC0, 0xAF, 0x10, 0x07, 0x6E, 0xC2, 0x00, 0x0C, 0x00, 0x38,
+0x0C, 0x07, 0xC0, 0x0C, 0xA2, 0x77, 0x10, 0x04, 0x9B, 0xBA, 0x1C, 0x24, 0xA5, 0x55, 0xA6, 0x55, 0x6B, 0x39, 0x96, 0xCD, 0x99, 0xDC, 0x6F, 0x19,
+0xA0, 0xB9, 0xA4, 0x75, 0xA4, 0x96, 0xA1, 0xA8, 0x61, 0x5A, 0x9E, 0x69, 0x9D, 0x69, 0x19, 0x20, 0xC0, 0x79, 0x19, 0xC1, 0x05, 0xA5, 0x65, 0xFE,
+0xEB, 0x5A, 0x28, 0x01, 0x0C, 0xA8, 0x44, 0xC0, 0x9A, 0xBB, 0x92, 0xFF, 0x9D, 0xA9, 0x08, 0x56, 0xC0, 0x08, 0x34, 0xA2, 0x67, 0x34, 0x00, 0x14,
+0xA3, 0x66, 0x94, 0xFE, 0x19, 0xA2, 0x77, 0x19, 0x66, 0xC2, 0x19, 0xC0, 0x14, 0xC2, 0x55, 0xC4, 0xFE, 0x25, 0x58, 0xA0, 0xA9, 0xC0, 0xA0, 0x36,
+0x05, 0xC4, 0xA0, 0xDA, 0xFE, 0x06, 0x68, 0xC1, 0xFE, 0x00, 0x00, 0xC3, 0x05, 0xC0, 0x6B, 0x14, 0x19, 0xC0, 0xA0, 0xDA, 0xFE, 0x47, 0x70, 0xC1,
+0x19, 0xC1, 0x28, 0x19, 0xC7, 0xFE, 0x46, 0x58, 0x25, 0xC6, 0x36, 0x19, 0xC1, 0x28, 0xC3, 0x36, 0x25, 0xC1, 0x19, 0xC1, 0x28, 0x19, 0xC3, 0x15,
+0xA0, 0xA9, 0xC4, 0x25, 0xC0, 0x36, 0x19, 0xC1, 0x28, 0xCF, 0x2D, 0x28, 0xC0, 0x2D, 0xC1, 0x7F, 0xA3, 0x67, 0xA3, 0x66, 0x51, 0x04, 0xAD, 0x21,
+0x18, 0x14, 0x05, 0x14, 0x19, 0x14, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0x3C, 0x05, 0xC4, 0x28, 0xC0, 0x2D, 0x35, 0xA3, 0x76, 0x56, 0xC0, 0x7A, 0x56,
+0xC0, 0x0C, 0x04, 0x0C, 0x18, 0xC3, 0x7E, 0xC0, 0x2C, 0xC1, 0x07, 0xC0, 0x69, 0x56, 0x00, 0x07, 0x6E, 0xC0, 0x38, 0x00, 0x0C, 0x62, 0x07, 0x1B,
+0x9B, 0xAA, 0x09, 0x3C, 0x10, 0x21, 0x1D, 0xA6, 0x55, 0x66, 0x55, 0x9A, 0xCA, 0x96, 0xCD, 0x9D, 0xAB, 0xA3, 0x86, 0xA8, 0x93, 0xA8, 0x95, 0xA2,
+0xB8, 0x70, 0x9D, 0xAA, 0x52, 0x7A, 0xA0, 0xA9, 0x9E, 0x58, 0x9B, 0x29, 0x2B, 0x9E, 0x7A, 0xA2, 0x76, 0x65, 0xC1, 0x25, 0x9C, 0xBA, 0x30, 0xAA,
+0x32, 0x0C, 0xAB, 0x32, 0xFE, 0x14, 0xA5, 0xA4, 0x56, 0x66, 0x24, 0x34, 0x6F, 0xC1, 0x08, 0x00, 0xC0, 0x69, 0x6F, 0x14, 0xA2, 0x77, 0x38, 0x19,
+0x7F, 0x19, 0x66, 0xC0, 0x19, 0xC0, 0x14, 0xC3, 0x55, 0xC5, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xA0, 0x03, 0x05, 0xC4, 0xFE, 0x09, 0x88, 0x0D,
+0xC1, 0xFE, 0x00, 0x00, 0xC3, 0x05, 0xC0, 0x14, 0xC0, 0x6F, 0xC0, 0xFE, 0x29, 0x90, 0x0D, 0xC1, 0xFE, 0x46, 0x58, 0x19, 0xC9, 0xFE, 0x2A, 0x98,
+0x0D, 0xC7, 0x59, 0x36, 0x28, 0xC5, 0xFE, 0x47, 0x70, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x04, 0x0D, 0xC7, 0x03, 0x36, 0x19, 0xC0, 0x28, 0xD1,
+0x2D, 0xC1, 0x28, 0x6F, 0xA3, 0x76, 0xA3, 0x66, 0x66, 0x6F, 0xAC, 0x22, 0x9C, 0xAA, 0x91, 0xFF, 0x05, 0x14, 0xC0, 0x05, 0xC1, 0x14, 0x19, 0x2D,
+0x66, 0x05, 0xC3, 0x19, 0x2D, 0x25, 0xA5, 0x65, 0x09, 0xC0, 0x66, 0xC2, 0x7E, 0xC0, 0x04, 0x0C, 0x6F, 0x0C, 0x18, 0x1D, 0x18, 0x7E, 0xC2, 0x2C,
+0xAF, 0x10, 0x56, 0xC2, 0x6E, 0x07, 0x00, 0x41, 0x33, 0x3D, 0x07, 0xA2, 0x66, 0x38, 0x20, 0x3C, 0x6F, 0xC0, 0x1D, 0xA7, 0x55, 0x51, 0x65, 0x46,
+0x96, 0xDC, 0x97, 0xED, 0xA6, 0x75, 0xB0, 0x60, 0xAA, 0x82, 0x46, 0x97, 0x8D, 0x93, 0xBE, 0x9B, 0xAB, 0x5E, 0xA1, 0xA7, 0xA2, 0xE9, 0xA5, 0xD6,
+0xA1, 0xC8, 0x9C, 0x09, 0xFE, 0x81, 0x18, 0xA0, 0x58, 0x77, 0x19, 0x1E, 0x19, 0xC0, 0x05, 0x39, 0x97, 0xDD, 0x00, 0x28, 0xFE, 0xF8, 0xBD, 0x55,
+0x98, 0xCC, 0x0F, 0x40, 0xA2, 0x77, 0x66, 0x08, 0x00, 0xC0, 0x65, 0x00, 0x14, 0xC0, 0x24, 0x20, 0x7E, 0x51, 0xC1, 0x19, 0xC0, 0x14, 0xC3, 0x55,
+0xC5, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0x03, 0x05, 0xC4, 0xFE, 0x0C, 0xC0, 0x0D, 0xC1, 0xFE, 0x00, 0x00, 0xC2, 0x05, 0xC0, 0x14, 0x19, 0x20, 0x28,
+0x2D, 0xFE, 0x2B, 0xA8, 0x0D, 0xC1, 0xFE, 0x49, 0x90, 0x19, 0xC9, 0x29, 0x0D, 0xC8, 0xFE, 0x47, 0x70, 0x28, 0xC5, 0x25, 0x0D, 0xC1, 0x28, 0xC3,
+0x19, 0xC1, 0x29, 0x0D, 0xC8, 0x25, 0x19, 0xC0, 0x28, 0xD1, 0x2D, 0x28, 0xC0, 0x2D, 0xC0, 0xA2, 0x77, 0x24, 0x30, 0x55, 0xA9, 0x44, 0xA5, 0x55,
+0x10, 0x9A, 0xAB, 0x14, 0xC0, 0x05, 0xC0, 0x14, 0xC0, 0x28, 0x3C, 0x14, 0x05, 0xC0, 0x14, 0x05, 0x14, 0x28, 0xC0, 0xA2, 0x67, 0xA6, 0x65, 0x0C,
+0x5A, 0x65, 0x6B, 0xC0, 0x09, 0x04, 0x0C, 0xC0, 0x6F, 0xC4, 0x1D, 0x2C, 0xC2, 0xAE, 0x11, 0x55, 0x7B, 0x38, 0xC3, 0x65, 0xC0, 0x38, 0xA2, 0x77,
+0x6E, 0x93, 0xFF, 0x92, 0xFF, 0xC0, 0x39, 0x04, 0x2D, 0x51, 0x51, 0x0F, 0x9A, 0xBB, 0x1B, 0xA4, 0xA7, 0xFE, 0xD0, 0xC3, 0xA7, 0x64, 0x9A, 0x6B,
+0x2C, 0x98, 0x9C, 0xFE, 0x82, 0x00, 0x61, 0x6E, 0x69, 0x63, 0xA4, 0x74, 0xFE, 0x87, 0xB1, 0xA2, 0xF9, 0xFE, 0x45, 0x89, 0xFE, 0x60, 0x08, 0x20,
+0xC0, 0x79, 0xC0, 0x20, 0x9D, 0xA9, 0xA9, 0x34, 0xA8, 0x44, 0x00, 0x20, 0xFE, 0x35, 0xA5, 0xA8, 0x44, 0x9A, 0xBB, 0xFE, 0x6E, 0x6B, 0x34, 0xC0,
+0x56, 0x34, 0x6F, 0x7E, 0x05, 0xC0, 0x19, 0x14, 0x94, 0xED, 0x20, 0x28, 0x51, 0xC0, 0x6E, 0xC1, 0x14, 0xC2, 0x55, 0xC6, 0xFE, 0x0D, 0xD0, 0x0D,
+0xC1, 0xFE, 0x26, 0x68, 0x05, 0xC3, 0x0D, 0xC2, 0xFE, 0x00, 0x00, 0xC2, 0x05, 0x14, 0x19, 0xC0, 0x28, 0x6E, 0x6B, 0xFE, 0x2D, 0xD0, 0x0D, 0xC1,
+0xFE, 0x2A, 0x98, 0x28, 0x19, 0xC8, 0x29, 0x0D, 0xC0, 0x49, 0x29, 0xC2, 0x0D, 0xC1, 0x25, 0x28, 0xC5, 0x25, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1,
+0x29, 0x0D, 0xC0, 0x00, 0x29, 0xC2, 0x0D, 0xC1, 0x25, 0x19, 0xC0, 0x28, 0xD0, 0x2D, 0xC1, 0x28, 0x2D, 0xC0, 0x3C, 0x24, 0x6F, 0x51, 0x18, 0xAA,
+0x33, 0x18, 0x28, 0x14, 0xC0, 0x05, 0xC0, 0x14, 0x19, 0x2D, 0x28, 0x05, 0xC3, 0x28, 0x2D, 0x28, 0x1C, 0xA6, 0x54, 0x52, 0xC0, 0x09, 0x04, 0x09,
+0x7A, 0x04, 0x0C, 0x18, 0xC4, 0x1D, 0xC0, 0x7A, 0x2C, 0xC0, 0x31, 0x33, 0xC0, 0x38, 0xC1, 0x33, 0x69, 0xC0, 0x38, 0xC1, 0xA3, 0x66, 0x9B, 0xBB,
+0x30, 0x34, 0x01, 0xC0, 0xAF, 0x11, 0xA2, 0x77, 0x9D, 0x9A, 0xC0, 0x5A, 0x95, 0xDD, 0xA0, 0xC8, 0xFE, 0x31, 0xC4, 0xA8, 0x65, 0x96, 0x8B, 0x38,
+0xA4, 0x56, 0x14, 0x19, 0xC0, 0x7E, 0x5B, 0x66, 0x51, 0xA6, 0x64, 0xFE, 0xC8, 0xD1, 0x9E, 0xEA, 0xFE, 0xC2, 0x40, 0x9C, 0x4B, 0x25, 0x75, 0x19,
+0x20, 0x65, 0x28, 0xAC, 0x22, 0x28, 0x9C, 0xAA, 0x3C, 0xFE, 0x59, 0xCE, 0x51, 0x93, 0xEF, 0xFE, 0x4A, 0x4A, 0x69, 0xC2, 0x08, 0x5A, 0xC0, 0xA2,
+0x87, 0x56, 0x15, 0x99, 0xCC, 0x6F, 0x64, 0x14, 0x19, 0xC1, 0x14, 0xC1, 0x55, 0xC7, 0x29, 0xA0, 0xDB, 0xC1, 0xFE, 0x0B, 0xA8, 0x05, 0xC2, 0xFE,
+0x08, 0x78, 0x0D, 0xC2, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x6F, 0xC1, 0x0D, 0xC2, 0x29, 0x19, 0xC9, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28,
+0xC2, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x28, 0xC5, 0x25, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x25,
+0x19, 0xC0, 0x28, 0xCF, 0x2D, 0xC3, 0x28, 0x2D, 0x7F, 0xA4, 0x66, 0x6F, 0x66, 0xA2, 0x76, 0xAB, 0x23, 0x51, 0x24, 0x19, 0x66, 0x05, 0x14, 0x19,
+0x7F, 0x2D, 0x14, 0x05, 0xC2, 0x19, 0x2D, 0x28, 0xA3, 0x66, 0x3D, 0x7F, 0x56, 0x3D, 0x04, 0xC0, 0x0C, 0xC0, 0x04, 0x0C, 0x18, 0x0C, 0x18, 0xC1,
+0x7E, 0x5A, 0x20, 0xC0, 0x6F, 0xC1, 0xAC, 0x22, 0x6E, 0x24, 0x7E, 0x33, 0x24, 0x2C, 0x29, 0xC0, 0x7F, 0x6E, 0xC0, 0x08, 0x3C, 0x01, 0x2D, 0x18,
+0x10, 0x9C, 0xAA, 0x55, 0x28, 0x9B, 0x9A, 0x99, 0xCC, 0xFE, 0x31, 0xAC, 0xAF, 0x30, 0x95, 0xBC, 0x9C, 0x4B, 0xA2, 0x89, 0x59, 0xFE, 0x28, 0x42,
+0xFE, 0x41, 0x10, 0x6E, 0x5B, 0x23, 0xA2, 0x55, 0x53, 0x69, 0xA9, 0xD3, 0xFE, 0x89, 0xF9, 0xFE, 0x04, 0x89, 0x11, 0x7E, 0x1C, 0x20, 0x19, 0x14,
+0xC0, 0xAD, 0x11, 0x01, 0x00, 0x30, 0xFE, 0xF8, 0xBD, 0xA4, 0x66, 0x95, 0xED, 0xFE, 0x6A, 0x4A, 0x3B, 0xA2, 0x66, 0x9D, 0xAA, 0xC0, 0x7E, 0x05,
+0xC0, 0xA2, 0x77, 0x2C, 0x39, 0x61, 0x55, 0x51, 0x14, 0x19, 0xC1, 0x14, 0xC1, 0x05, 0xC7, 0xFE, 0x0D, 0xD0, 0x0D, 0xC1, 0x49, 0x05, 0xC2, 0xFE,
+0x0B, 0xB8, 0x0D, 0xC2, 0xFE, 0x00, 0x00, 0xC1, 0x05, 0x14, 0x28, 0x6E, 0x6B, 0x3C, 0xC0, 0xFE, 0x86, 0x60, 0x0D, 0xC2, 0x03, 0x19, 0xC7, 0x28,
+0xC0, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xC2, 0x0D, 0xC1, 0xFE, 0x67, 0x70, 0x28, 0xC5, 0xFE, 0x47, 0x70, 0x0D, 0xC1, 0x28, 0xC3, 0x19,
+0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x25, 0x19, 0xC0, 0x28, 0xCF, 0x2D, 0xC2, 0x34, 0x28, 0x2D, 0x34, 0xA3, 0x76, 0xA4, 0x56,
+0x30, 0x69, 0x08, 0xA4, 0x66, 0x98, 0xCC, 0x95, 0xEE, 0x05, 0xC0, 0x14, 0xC0, 0x2D, 0x28, 0x05, 0xC3, 0x28, 0xC1, 0x29, 0x0C, 0x55, 0x6B, 0xC1,
+0x0C, 0xC5, 0x6F, 0xC0, 0x6E, 0x20, 0xC1, 0x2C, 0xC2, 0x24, 0xC0, 0x66, 0xA2, 0x76, 0x1F, 0xC0, 0x2C, 0x5A, 0x51, 0x2C, 0xA2, 0x77, 0x9D, 0x99,
+0xFE, 0x65, 0x29, 0x2D, 0x3C, 0x2D, 0xFE, 0x0C, 0x5B, 0xA2, 0x77, 0x9D, 0xAA, 0x2D, 0x30, 0x04, 0xA6, 0x55, 0xFE, 0xD7, 0xE5, 0xA0, 0xB8, 0x95,
+0x6D, 0xA1, 0x69, 0x7E, 0x69, 0x20, 0x14, 0x19, 0x6B, 0xC0, 0x6D, 0x63, 0x59, 0xA7, 0xA4, 0xFE, 0x69, 0xF9, 0x9D, 0x17, 0x16, 0x14, 0x19, 0x20,
+0x19, 0x14, 0x05, 0x0C, 0x99, 0xBB, 0x99, 0xCC, 0x14, 0xFE, 0xD3, 0x9C, 0xAE, 0x12, 0x98, 0xCB, 0xFE, 0xCB, 0x52, 0x9B, 0xBB, 0x7E, 0xC0, 0x6F,
+0x34, 0x00, 0x6E, 0x19, 0x9A, 0xCB, 0x94, 0xEE, 0x56, 0x14, 0xC1, 0x6E, 0x14, 0xC2, 0x55, 0xC1, 0x14, 0x05, 0xC4, 0xFE, 0x0D, 0xD0, 0x0D, 0xC2,
+0xFE, 0x24, 0x40, 0x05, 0xC1, 0xFE, 0x0F, 0xE8, 0x0D, 0xC2, 0xFE, 0x00, 0x00, 0xC0, 0x05, 0x14, 0x28, 0x6F, 0x7E, 0xC0, 0x55, 0xC0, 0x3F, 0x0D,
+0xC0, 0x29, 0x0D, 0xC0, 0xFE, 0x65, 0x48, 0x28, 0xC0, 0x19, 0xC4, 0x28, 0xC0, 0x29, 0xA0, 0xDB, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xC2, 0x0D, 0xC1,
+0x25, 0x28, 0xC5, 0x25, 0x0D, 0xC1, 0x28, 0xC0, 0x19, 0xC4, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x25, 0x19, 0xC0, 0x28, 0xCC, 0x2D,
+0x28, 0xC1, 0x2D, 0xC3, 0x34, 0xC0, 0x01, 0xA4, 0x67, 0x7E, 0x55, 0x18, 0xAB, 0x32, 0x99, 0xBB, 0x34, 0x00, 0x05, 0x14, 0x19, 0x2D, 0x14, 0x05,
+0xC0, 0x14, 0x05, 0x19, 0x2D, 0x28, 0x01, 0x3D, 0x6B, 0xC2, 0x6E, 0x0C, 0x09, 0x04, 0x0C, 0xC0, 0x18, 0x0C, 0xC0, 0x18, 0x7E, 0x18, 0x20, 0xC1,
+0x2C, 0xC1, 0xAC, 0x22, 0x7E, 0x51, 0x1F, 0x55, 0x18, 0x2C, 0x24, 0xC0, 0x6E, 0xA2, 0x77, 0x97, 0xDD, 0x3C, 0x01, 0x14, 0x30, 0x24, 0x9B, 0xBB,
+0x28, 0xA3, 0x76, 0x51, 0x93, 0xEF, 0x2C, 0xFE, 0xBA, 0xFE, 0x99, 0xEC, 0x97, 0x6C, 0xA2, 0x58, 0xA1, 0x98, 0x59, 0x20, 0xFE, 0x21, 0x00, 0x19,
+0xC0, 0x7A, 0x19, 0x9F, 0x9B, 0x9F, 0x86, 0xA9, 0xC3, 0xFE, 0x68, 0xF9, 0x9B, 0x39, 0x16, 0xC0, 0x19, 0xC0, 0x14, 0x19, 0x14, 0xA6, 0x55, 0x9C,
+0xAA, 0x00, 0xC0, 0x29, 0xFE, 0x7A, 0xCE, 0x9A, 0xBB, 0xFE, 0x0C, 0x5B, 0x20, 0x6F, 0x7E, 0x6F, 0x34, 0xC0, 0x31, 0xA4, 0x76, 0x38, 0x98, 0xBC,
+0x28, 0x14, 0xC1, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xC8, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC2, 0xFE, 0x0A, 0x98, 0x05, 0xC0, 0xFE, 0x05, 0x58, 0x0D,
+0xC3, 0x05, 0x14, 0x19, 0x28, 0x6F, 0x3C, 0xC0, 0x55, 0xC0, 0x28, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0x04, 0x0D, 0xC0, 0xFE, 0x48, 0x80, 0x28, 0xC5,
+0x19, 0x28, 0xC0, 0x29, 0x0D, 0xC0, 0x04, 0x28, 0xC2, 0x04, 0xC1, 0xFE, 0x65, 0x48, 0x28, 0xC5, 0xFE, 0x47, 0x70, 0xFE, 0x10, 0xF8, 0xC1, 0x28,
+0xC2, 0x19, 0xC2, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x25, 0x19, 0xC0, 0x28, 0xCC, 0x2D, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0x2D, 0xC0,
+0x34, 0xC0, 0x3C, 0xA5, 0x55, 0x38, 0x56, 0x38, 0xAE, 0x11, 0x99, 0xBB, 0x19, 0x05, 0x14, 0xC0, 0x28, 0xC0, 0x14, 0x05, 0xC0, 0x14, 0xC0, 0x28,
+0x2D, 0xC0, 0xA5, 0x66, 0xA3, 0x67, 0xC4, 0x7E, 0x04, 0xC0, 0x0C, 0x6F, 0x0C, 0x18, 0xC1, 0x20, 0x5A, 0xC0, 0x20, 0x2C, 0xC2, 0x15, 0x7F, 0x51,
+0xC1, 0x7E, 0x24, 0x18, 0x24, 0xC0, 0x1F, 0x2C, 0x2D, 0x6E, 0x9A, 0xCC, 0xB1, 0x00, 0xAD, 0x11, 0x37, 0x6E, 0x10, 0x9A, 0xBB, 0x9A, 0xBB, 0xFE,
+0x14, 0xAD, 0xAE, 0x41, 0x9D, 0xA9, 0x94, 0xBE, 0xA1, 0x59, 0xA4, 0x66, 0x65, 0x18, 0x05, 0x19, 0xC1, 0x6B, 0x11, 0xA2, 0x86, 0xFE, 0x86, 0xB9,
+0xFE, 0x68, 0xF9, 0xFE, 0xA2, 0x68, 0x16, 0x20, 0x79, 0x19, 0xC1, 0x66, 0xC1, 0x05, 0x00, 0x10, 0xFE, 0x39, 0xC6, 0x30, 0xFE, 0x0C, 0x5B, 0x18,
+0xA3, 0x76, 0x56, 0xC0, 0xA2, 0x77, 0x31, 0xA2, 0x77, 0x7E, 0x93, 0xFF, 0x20, 0x7E, 0x14, 0xC0, 0x19, 0xC1, 0x14, 0xC1, 0x55, 0xC8, 0xFE, 0x0D,
+0xD0, 0xA0, 0xDB, 0xC2, 0xA0, 0x14, 0x05, 0xC0, 0xFE, 0x09, 0x98, 0x0D, 0xC3, 0x14, 0x19, 0x28, 0x6F, 0x7E, 0xC0, 0x34, 0x28, 0x6E, 0x28, 0x29,
+0x0D, 0xC0, 0x25, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xC5, 0x19, 0x28, 0xC0, 0x29, 0x0D, 0xC0, 0x04, 0x28, 0xCD, 0x2A, 0x0D, 0xC1, 0x28, 0xC3,
+0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC2, 0xFE, 0x47, 0x68, 0x25, 0xC0, 0x36, 0x19, 0xC0, 0x28, 0xCD, 0x2D, 0xC3, 0x34, 0xC0, 0x2D, 0x34,
+0xC1, 0xA4, 0x66, 0xA3, 0x76, 0xC0, 0x56, 0xAB, 0x22, 0xC0, 0x2D, 0x9C, 0xAB, 0x7D, 0x6F, 0x28, 0x14, 0x05, 0x14, 0x05, 0xC0, 0x28, 0x2D, 0x28,
+0xA4, 0x56, 0xA5, 0x65, 0x6B, 0x38, 0xC0, 0x04, 0xC1, 0x09, 0x7A, 0xC4, 0x18, 0xC0, 0x7E, 0xC2, 0x2C, 0xC1, 0x31, 0xA8, 0x54, 0x6B, 0x04, 0xA2,
+0x77, 0x56, 0xC2, 0x18, 0x24, 0x9D, 0x99, 0x92, 0xFF, 0x9A, 0xBB, 0x2D, 0x9B, 0xBB, 0xFE, 0xAB, 0x52, 0xA9, 0x33, 0x9B, 0xBB, 0x0B, 0x18, 0x2C,
+0x14, 0xFE, 0xD7, 0xBD, 0xA4, 0x96, 0xA6, 0x55, 0x96, 0xDD, 0x13, 0xA5, 0x46, 0x55, 0xFE, 0xE8, 0x39, 0x05, 0x19, 0xC0, 0x66, 0x16, 0xA0, 0xB8,
+0xA6, 0xF6, 0xFE, 0x88, 0xF9, 0x9D, 0x59, 0xFE, 0x81, 0x18, 0x9E, 0x7A, 0x19, 0x69, 0xA0, 0x8A, 0x19, 0xC1, 0x14, 0x05, 0x66, 0xC0, 0x01, 0xFE,
+0x18, 0xC6, 0x99, 0xBC, 0xFE, 0xCB, 0x52, 0x9B, 0xBA, 0x7F, 0x2C, 0xA2, 0x77, 0x2C, 0xC0, 0xA4, 0x66, 0x34, 0x2D, 0x52, 0x69, 0x05, 0x7F, 0xC0,
+0x19, 0x14, 0xC2, 0x05, 0xC8, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0x03, 0x0D, 0xC0, 0xFE, 0x22, 0x28, 0x05, 0xFE, 0x0E, 0xD8, 0x0D, 0x03, 0x0D,
+0xC1, 0x19, 0x28, 0x6F, 0x7E, 0x34, 0xC0, 0x2D, 0x28, 0xC1, 0x03, 0x0D, 0x33, 0x36, 0x0D, 0xC0, 0xA1, 0x03, 0x28, 0xC5, 0x19, 0x28, 0xC0, 0x29,
+0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xCD, 0x2A, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x14, 0x19, 0xC7, 0x28, 0xCD, 0x2D,
+0xC3, 0x34, 0xC0, 0x2D, 0x34, 0xC0, 0x2D, 0xA3, 0x77, 0x38, 0x6F, 0x55, 0x2C, 0xA8, 0x43, 0xFE, 0x45, 0x29, 0x97, 0xCD, 0x14, 0x19, 0xC0, 0x65,
+0x05, 0x14, 0x05, 0x19, 0x2D, 0xC0, 0x6F, 0x30, 0x04, 0x69, 0x38, 0x04, 0xC3, 0x7E, 0xC1, 0x18, 0xC3, 0x7E, 0xC2, 0x2C, 0xC1, 0x7E, 0x0B, 0x69,
+0x56, 0xA2, 0x77, 0x0B, 0x01, 0x04, 0xA2, 0x67, 0xC0, 0x7F, 0x3C, 0xFE, 0x04, 0x21, 0x28, 0x2D, 0x9B, 0xBB, 0xFE, 0xCB, 0x5A, 0xA9, 0x34, 0x01,
+0x7F, 0x15, 0x18, 0xFE, 0xF0, 0x73, 0xFE, 0x9A, 0xCE, 0x9B, 0xDA, 0xA7, 0x65, 0x7E, 0x95, 0xEE, 0xA1, 0x47, 0x42, 0x09, 0xFE, 0x00, 0x08, 0x14,
+0xC0, 0x1F, 0xA3, 0x86, 0xFE, 0x05, 0x99, 0xA5, 0xF7, 0x9C, 0x8A, 0xFE, 0x61, 0x50, 0x11, 0x1B, 0x19, 0x1E, 0x73, 0x19, 0xC1, 0x14, 0x55, 0x66,
+0xC0, 0x3C, 0xFE, 0x97, 0xB5, 0x99, 0xBB, 0xFE, 0xAA, 0x52, 0x2C, 0xC0, 0xA2, 0x77, 0x65, 0x2C, 0x00, 0xA3, 0x66, 0x96, 0xED, 0x97, 0xCD, 0x6E,
+0x14, 0xC5, 0x05, 0xC9, 0x14, 0x29, 0xA0, 0xDB, 0xC0, 0x49, 0x0D, 0xC0, 0xFE, 0x08, 0x78, 0xFE, 0x02, 0x28, 0x0D, 0xC0, 0x00, 0x0D, 0xC1, 0x28,
+0x6E, 0x7F, 0xC0, 0x2D, 0xC1, 0x28, 0xC0, 0xFE, 0x65, 0x48, 0xFE, 0x10, 0xF8, 0xC0, 0xA0, 0x14, 0xFE, 0x61, 0x08, 0xFE, 0x0F, 0xF0, 0x0D, 0x00,
+0x28, 0xC6, 0x19, 0x28, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xCD, 0x2A, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x14,
+0xC0, 0x19, 0xC6, 0x28, 0xCC, 0x2D, 0xC4, 0x6B, 0xC4, 0xA2, 0x76, 0xA4, 0x66, 0xA2, 0x78, 0x38, 0x0C, 0xAA, 0x33, 0x98, 0xCC, 0x93, 0xEF, 0x14,
+0x19, 0xC0, 0x05, 0x14, 0x05, 0x19, 0x2D, 0xC0, 0x28, 0xA6, 0x45, 0x3D, 0xC1, 0x38, 0x04, 0xC2, 0x09, 0xC1, 0x0C, 0x18, 0x0C, 0x18, 0xC1, 0x7E,
+0xC0, 0x2C, 0xC2, 0x31, 0x2C, 0xA9, 0x43, 0x56, 0xC0, 0x04, 0x3C, 0xC1, 0x10, 0xC0, 0x15, 0x9B, 0xBB, 0xFE, 0xC3, 0x18, 0x2D, 0x34, 0x9B, 0xBA,
+0xFE, 0xCB, 0x5A, 0xAA, 0x33, 0x0B, 0xA2, 0x76, 0x0B, 0x96, 0xCC, 0xFE, 0xD3, 0x94, 0xFE, 0x1C, 0xDF, 0x98, 0xDC, 0x17, 0xA6, 0x75, 0x72, 0x9C,
+0xA9, 0x9A, 0xBB, 0xFE, 0xCB, 0x7A, 0x94, 0xFE, 0x75, 0x7F, 0xA2, 0xB8, 0xFE, 0xA8, 0xD9, 0x9F, 0xB9, 0x9F, 0x68, 0xFE, 0xA3, 0x58, 0x05, 0xA2,
+0x77, 0xC5, 0x14, 0x05, 0xC0, 0x66, 0x6F, 0x10, 0xAD, 0x22, 0x98, 0xCC, 0x92, 0xFE, 0x2C, 0x31, 0x7F, 0x34, 0x00, 0x7E, 0x55, 0x95, 0xEE, 0x9C,
+0xAA, 0x19, 0x05, 0x14, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xCA, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xA0, 0x14, 0x0D, 0xC0, 0xA0, 0x03, 0xA0, 0x25, 0x0D,
+0xC0, 0x1C, 0x0D, 0xC1, 0xFE, 0xA2, 0x10, 0x6B, 0x3C, 0x2D, 0xC0, 0x28, 0xC2, 0xFE, 0x48, 0x80, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0x29, 0x0D,
+0xC0, 0xFE, 0x63, 0x30, 0x28, 0xC7, 0x29, 0x0D, 0xC0, 0x04, 0x28, 0x04, 0x0D, 0xC3, 0xFE, 0x47, 0x70, 0x28, 0xC5, 0x25, 0x0D, 0xC1, 0x28, 0xC2,
+0x19, 0xC2, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC6, 0x28, 0xC4, 0x19, 0xC1, 0x28, 0xC6, 0x2D, 0xC2, 0x34, 0xC4, 0x2D, 0x3C, 0xA4, 0x66, 0x3D, 0xC0,
+0x56, 0xA9, 0x44, 0x6E, 0xFE, 0xE4, 0x18, 0x9B, 0xBA, 0x6E, 0xC0, 0x0C, 0x14, 0xC0, 0x28, 0x3C, 0x28, 0x3C, 0xA5, 0x56, 0x38, 0x3D, 0xC0, 0x38,
+0x6F, 0xC3, 0x7E, 0xC1, 0x6F, 0xC3, 0x7E, 0xC2, 0x2C, 0xC1, 0x31, 0xA6, 0x65, 0x6F, 0x7E, 0x3C, 0x30, 0x37, 0x3C, 0x04, 0x5A, 0x7F, 0x9A, 0xBB,
+0xFE, 0xC3, 0x18, 0x28, 0xC0, 0x9C, 0xAA, 0x39, 0xB0, 0x01, 0x97, 0xDD, 0xA2, 0x77, 0x9C, 0x99, 0x9A, 0xCB, 0xFE, 0xB7, 0xB5, 0xAD, 0x11, 0x9A,
+0xBB, 0x9A, 0xCB, 0x71, 0xA2, 0x87, 0x9F, 0xC9, 0x9C, 0xDA, 0x9C, 0xC9, 0x99, 0xFB, 0x9A, 0xEB, 0x9D, 0xAA, 0x9C, 0xAB, 0x9C, 0xAA, 0x9B, 0x5A,
+0x9C, 0x09, 0x9E, 0x5A, 0x6F, 0xA0, 0xA7, 0x5A, 0xC4, 0x66, 0x55, 0xC0, 0x00, 0x3C, 0xFE, 0xCF, 0x7B, 0xA7, 0x45, 0x97, 0xDC, 0x93, 0xEF, 0xA2,
+0x77, 0x7E, 0xC2, 0xA3, 0x67, 0x99, 0xCB, 0x97, 0xCC, 0x52, 0x65, 0x05, 0x14, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xCA, 0x29, 0x0D, 0xC0, 0xFE, 0x0A,
+0x98, 0x03, 0x0D, 0x03, 0xA0, 0x25, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x0D, 0xC1, 0xFE, 0xA3, 0x10, 0x3C, 0x2D, 0xC0, 0x28, 0xC0, 0x19, 0xC0, 0x28,
+0x04, 0x0D, 0xC0, 0x32, 0x28, 0xFE, 0x2C, 0xB8, 0x0D, 0xC0, 0xFE, 0x47, 0x70, 0x28, 0xC7, 0x29, 0x0D, 0xC0, 0x04, 0x28, 0x04, 0x0D, 0xC3, 0xFE,
+0x67, 0x70, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x28, 0xC2, 0x19, 0xC2, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC8, 0x28, 0xC0, 0x19, 0xC0, 0x14, 0x05, 0xC0,
+0x14, 0x19, 0x28, 0xC0, 0x2D, 0x28, 0xC0, 0x2D, 0x34, 0xC0, 0x2D, 0x34, 0xC0, 0x3C, 0xC3, 0x34, 0x2D, 0xA4, 0x66, 0xA4, 0x66, 0xC0, 0x35, 0x2C,
+0xA7, 0x44, 0x95, 0xEE, 0x98, 0xCB, 0x19, 0x14, 0x56, 0x14, 0x28, 0x34, 0x3C, 0x34, 0x24, 0x38, 0xC0, 0x3D, 0x35, 0x38, 0x04, 0xC3, 0x7E, 0xC1,
+0x18, 0xC1, 0x6E, 0x18, 0x1D, 0x7A, 0xC1, 0x2C, 0xC1, 0x7E, 0x30, 0x6B, 0x30, 0x5A, 0x30, 0x37, 0x30, 0x6F, 0xC0, 0x10, 0x9A, 0xBB, 0x08, 0x28,
+0xC0, 0x00, 0x38, 0xFE, 0x72, 0x8C, 0x9A, 0xBB, 0x10, 0x14, 0xC0, 0xFE, 0x7A, 0xCE, 0x01, 0x9A, 0xBB, 0x9C, 0xAA, 0x9B, 0xBB, 0x9C, 0xBA, 0x61,
+0x9E, 0xC9, 0x96, 0xFC, 0x99, 0xEB, 0x9C, 0xCA, 0x9D, 0x9A, 0x9C, 0x7A, 0x9E, 0x39, 0x16, 0x11, 0xA2, 0x76, 0x66, 0xC5, 0x66, 0x55, 0x14, 0x51,
+0xC0, 0x38, 0xFE, 0xCF, 0x7B, 0xA3, 0x67, 0x94, 0xEE, 0x18, 0x31, 0x34, 0xC2, 0x6F, 0x98, 0xCB, 0x28, 0x56, 0x65, 0xC0, 0x19, 0xC1, 0x14, 0xC1,
+0x05, 0xCA, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0x3F, 0xA0, 0xC9, 0x0D, 0xC0, 0x29, 0x0D, 0x49, 0xFE, 0x47, 0x68, 0x0D, 0xC1, 0xFE, 0xA3, 0x10, 0xC0,
+0x69, 0x28, 0xC1, 0x19, 0xC0, 0x28, 0xFE, 0x2C, 0xC0, 0x0D, 0xC0, 0x25, 0x28, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0x04, 0x28, 0xC7, 0x29, 0x0D, 0xC0,
+0x04, 0x28, 0x04, 0x0D, 0xC3, 0x2A, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0xC8, 0x28, 0xC0, 0x19,
+0x14, 0x19, 0x28, 0xC0, 0x14, 0xC1, 0x19, 0xC0, 0x28, 0x2D, 0xC0, 0x34, 0xC0, 0x2D, 0x34, 0x7E, 0xC6, 0xA2, 0x67, 0x38, 0x6F, 0x59, 0xA2, 0x77,
+0xA8, 0x55, 0x9D, 0x99, 0x96, 0xED, 0x9A, 0xBB, 0x9D, 0x9A, 0xC0, 0x28, 0x34, 0xC0, 0x2D, 0xA3, 0x77, 0x3D, 0x38, 0x35, 0x38, 0xC1, 0x04, 0x38,
+0x04, 0xC1, 0x7E, 0xC1, 0x18, 0xC2, 0x6E, 0xC0, 0x7A, 0x6F, 0xC2, 0x7E, 0xC0, 0xA5, 0x56, 0xC3, 0x7E, 0xC0, 0x37, 0x6E, 0x7E, 0x28, 0xFE, 0x25,
+0x29, 0x9B, 0xAA, 0x6F, 0x9B, 0xBA, 0x2D, 0xFE, 0x6E, 0x6B, 0xA5, 0x55, 0x3C, 0x9A, 0xBB, 0xA5, 0x55, 0xFE, 0xBB, 0xD6, 0xA4, 0x65, 0x99, 0xCC,
+0x9A, 0xBB, 0x41, 0x9C, 0xAB, 0x51, 0x9D, 0x99, 0xFE, 0xA7, 0x31, 0x93, 0xFE, 0xC0, 0xA2, 0x66, 0xC0, 0x11, 0x7F, 0xC1, 0x19, 0xC4, 0x66, 0xC0,
+0x55, 0xC0, 0x00, 0x05, 0x31, 0xAB, 0x33, 0x10, 0x96, 0xDD, 0x65, 0x2C, 0x31, 0x2C, 0x7E, 0x6F, 0x18, 0x97, 0xDC, 0x28, 0x19, 0x14, 0xC1, 0x19,
+0x14, 0xC8, 0x05, 0xC4, 0x29, 0xA0, 0xDB, 0xC0, 0x3F, 0x49, 0x0D, 0xC2, 0xFE, 0x2C, 0xB8, 0x2A, 0x0D, 0xC1, 0xFE, 0xA2, 0x10, 0xC0, 0x28, 0xC1,
+0x19, 0x28, 0xC1, 0xFE, 0x0F, 0xE8, 0x0D, 0xC0, 0x28, 0xC0, 0x25, 0x0D, 0xC0, 0x1E, 0x28, 0xC7, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0xC2,
+0x0D, 0xC1, 0x2A, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x28, 0xC3, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0x04, 0x14, 0xC0, 0x19, 0xC5, 0x28, 0xC0, 0x19, 0xC0,
+0x28, 0xC0, 0x2D, 0xC2, 0x19, 0x14, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x6B, 0xC0, 0x3C, 0xC0, 0x34, 0xC1, 0x3C, 0xC2, 0x6E, 0xA5, 0x56, 0xA2, 0x77,
+0xC0, 0x66, 0xA8, 0x44, 0xA4, 0x66, 0x20, 0x96, 0xDD, 0x9B, 0xAB, 0xA2, 0x77, 0x3C, 0xC0, 0x28, 0xA3, 0x67, 0xA4, 0x66, 0x7E, 0xC1, 0x30, 0xA2,
+0x76, 0x38, 0x04, 0xC2, 0x09, 0x7A, 0xC1, 0x18, 0xC1, 0x1D, 0x7A, 0xC2, 0x2C, 0x7E, 0xC2, 0xA4, 0x67, 0x6E, 0xC0, 0x23, 0x28, 0xC2, 0x6E, 0x7F,
+0xC0, 0x04, 0x97, 0xDC, 0xA2, 0x67, 0x9C, 0xBA, 0x51, 0x04, 0xAF, 0x11, 0x50, 0x31, 0x04, 0xFE, 0xBB, 0xD6, 0x69, 0x9A, 0xBC, 0x9B, 0xBA, 0x9D,
+0x9A, 0x9D, 0x9A, 0x64, 0x67, 0xFE, 0x29, 0x42, 0xFE, 0x21, 0x00, 0x11, 0x7A, 0x6F, 0x69, 0x6E, 0xC0, 0x14, 0x20, 0x19, 0xC2, 0x14, 0x05, 0xC1,
+0x00, 0xC0, 0x01, 0xAE, 0x11, 0x04, 0x9B, 0xAB, 0x34, 0x31, 0x2C, 0x34, 0x2C, 0xA2, 0x77, 0x31, 0x15, 0x28, 0x20, 0x65, 0xC0, 0x19, 0x14, 0xC3,
+0x05, 0x14, 0xC4, 0x05, 0xC4, 0x29, 0xA0, 0xDB, 0xC0, 0x3F, 0xFE, 0x24, 0x40, 0x0D, 0xC2, 0xFE, 0x29, 0x90, 0x2A, 0x0D, 0xC1, 0xFE, 0xA3, 0x10,
+0x28, 0xC2, 0x19, 0xC1, 0x36, 0x0D, 0xC0, 0x49, 0x28, 0xC0, 0xFE, 0x66, 0x58, 0x0D, 0xC0, 0xA0, 0x46, 0x28, 0xC7, 0x29, 0x0D, 0xC0, 0xFE, 0x2A,
+0x98, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x28, 0xC2, 0x19, 0xC2, 0x29, 0x0D, 0xC0, 0x04, 0x14, 0xC0, 0x19, 0xC0, 0x04,
+0xC1, 0xFE, 0x65, 0x48, 0x19, 0x20, 0xC0, 0x28, 0xC5, 0x6E, 0xC1, 0x28, 0x19, 0x14, 0x0C, 0x14, 0x20, 0x2D, 0x7F, 0xC8, 0xA4, 0x66, 0x09, 0x7A,
+0x56, 0xA5, 0x65, 0xA8, 0x44, 0x95, 0xDD, 0x28, 0xC0, 0x3C, 0xC0, 0x56, 0x3C, 0x24, 0x38, 0x30, 0x38, 0x35, 0x38, 0xC1, 0x6F, 0xC1, 0x09, 0x0C,
+0x6F, 0xC5, 0x7E, 0xC1, 0x2C, 0x31, 0xC0, 0x7A, 0xC1, 0xA5, 0x56, 0x23, 0x55, 0x7E, 0x23, 0x59, 0xC1, 0x28, 0x6E, 0x7A, 0x2C, 0x94, 0xEE, 0x65,
+0xC0, 0x05, 0xA3, 0x67, 0x2C, 0xA8, 0x44, 0x31, 0x10, 0xFE, 0x7A, 0xCE, 0xC0, 0x9A, 0xBB, 0x9C, 0xAA, 0x9C, 0xAA, 0x55, 0x66, 0x9D, 0xA9, 0x1D,
+0xFE, 0x41, 0x08, 0x6E, 0xC9, 0x14, 0x05, 0xC0, 0x66, 0x05, 0x00, 0x19, 0x38, 0xA9, 0x34, 0x6E, 0x2C, 0xC0, 0x7E, 0x31, 0x34, 0x2C, 0xA2, 0x77,
+0x11, 0x96, 0xDE, 0x50, 0x66, 0x05, 0x14, 0x19, 0xC0, 0x14, 0xC9, 0x05, 0xC4, 0x29, 0xA0, 0xDB, 0xC0, 0x3F, 0xFE, 0x00, 0x00, 0xFE, 0x0F, 0xE8,
+0x0D, 0xC1, 0xFE, 0x65, 0x48, 0xA1, 0xC9, 0xFE, 0x10, 0xF8, 0xC1, 0x28, 0xC6, 0xFE, 0x47, 0x70, 0x0D, 0xC7, 0x28, 0xC7, 0x29, 0x0D, 0xC0, 0xFE,
+0x4A, 0x98, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x34, 0x69, 0x28, 0xC1, 0x19, 0xC1, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98,
+0x19, 0xC0, 0x14, 0x19, 0x0D, 0xC1, 0x25, 0xFE, 0x62, 0x08, 0x28, 0xCA, 0xA2, 0x77, 0xC0, 0x2D, 0x28, 0x19, 0x14, 0x56, 0x19, 0x28, 0x2D, 0x34,
+0x3C, 0xC2, 0x01, 0x56, 0xA2, 0x87, 0xA5, 0x56, 0xC0, 0x18, 0xA5, 0x65, 0x18, 0x10, 0x2D, 0x01, 0x3C, 0x39, 0xC0, 0xA3, 0x77, 0x35, 0xC0, 0x66,
+0xC0, 0x35, 0x38, 0x04, 0xC3, 0x7E, 0xC3, 0x18, 0xC1, 0x7E, 0xC2, 0x2C, 0xC1, 0x7E, 0x6F, 0xC0, 0xA2, 0x77, 0x6E, 0x14, 0xC4, 0xA2, 0x77, 0x65,
+0xA2, 0x67, 0x19, 0x15, 0x9B, 0xAB, 0x7E, 0x51, 0x66, 0xA3, 0x67, 0x18, 0x31, 0x11, 0xB0, 0x01, 0xAF, 0x10, 0x56, 0x9A, 0xBB, 0x51, 0x51, 0x9B,
+0xBA, 0x95, 0xEE, 0x94, 0xEE, 0x14, 0x19, 0xC3, 0x14, 0xA2, 0x77, 0x3C, 0x28, 0x14, 0x05, 0xC0, 0x66, 0xC0, 0x05, 0x00, 0x05, 0x15, 0xA8, 0x45,
+0xA4, 0x66, 0x9D, 0xA9, 0x1D, 0x2C, 0x65, 0x31, 0xC0, 0x7F, 0x50, 0x10, 0x9B, 0xAB, 0x19, 0x66, 0xC2, 0x19, 0x14, 0xC9, 0x05, 0xC4, 0x29, 0x0D,
+0xC0, 0x3F, 0xFE, 0x00, 0x00, 0x12, 0x0D, 0xC0, 0x49, 0x2D, 0x2F, 0x0D, 0xC1, 0x28, 0xC6, 0xFE, 0x2A, 0x98, 0x0D, 0xC7, 0x2A, 0x28, 0xC6, 0x29,
+0x0D, 0xC0, 0x09, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0x28, 0x2D, 0x6B, 0xC1, 0x2F, 0x0D, 0xC1, 0x2D, 0xC2, 0x28, 0x19, 0xC1, 0x29, 0x0D,
+0xC0, 0x04, 0x19, 0xC0, 0x14, 0x19, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x20, 0x28, 0xC8, 0x2D, 0x28, 0xC0, 0x2D, 0xC0, 0x34, 0x3C, 0xC0, 0x28, 0x19,
+0x52, 0xC0, 0x14, 0x20, 0x2D, 0x3C, 0x01, 0xC0, 0x3C, 0x6F, 0x30, 0xA3, 0x76, 0xA7, 0x45, 0x0C, 0x28, 0x3C, 0x01, 0xC0, 0x3C, 0x01, 0x15, 0x24,
+0xA2, 0x77, 0x30, 0x66, 0x30, 0x38, 0xC1, 0x6F, 0xC3, 0x0C, 0xC0, 0x18, 0xC2, 0x7E, 0xC3, 0x6B, 0xA2, 0x76, 0x31, 0x34, 0x6F, 0xC0, 0x7F, 0x14,
+0xC0, 0x65, 0xC0, 0x14, 0x0F, 0x14, 0xC1, 0x6E, 0x7E, 0x18, 0x39, 0x28, 0xC1, 0x51, 0xA3, 0x67, 0x15, 0x98, 0xCD, 0x28, 0x00, 0xA8, 0x44, 0xA3,
+0x76, 0xA2, 0x67, 0x9A, 0xBB, 0x94, 0xFE, 0x34, 0x14, 0x28, 0x55, 0x28, 0x2D, 0xA2, 0x77, 0x24, 0x11, 0xA2, 0x77, 0x38, 0x14, 0x05, 0x14, 0x05,
+0xC0, 0x66, 0xC0, 0x6F, 0x01, 0x04, 0xA6, 0x55, 0xC0, 0x18, 0x20, 0x6F, 0x18, 0x1D, 0x31, 0x7A, 0x99, 0xBB, 0x28, 0x19, 0x14, 0x05, 0x14, 0xC0,
+0x19, 0xC0, 0x14, 0xC9, 0x05, 0xC4, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x09, 0x98, 0xFE, 0x00, 0x00, 0xFE, 0x28, 0x78, 0x0D, 0xC0, 0xFE, 0x2C,
+0xB8, 0xFE, 0xA3, 0x10, 0x2F, 0x0D, 0xC1, 0x28, 0xC6, 0xFE, 0x2C, 0xC0, 0x0D, 0xC7, 0xFE, 0x49, 0x90, 0x28, 0xC6, 0x29, 0x0D, 0xC0, 0xFE, 0x2A,
+0x98, 0x28, 0x2D, 0xC0, 0x28, 0x0D, 0xC1, 0x2F, 0x34, 0x3C, 0x2D, 0x28, 0xC0, 0x19, 0xC0, 0xFE, 0x27, 0x68, 0x0D, 0xC1, 0x0C, 0x14, 0x0C, 0x05,
+0xC0, 0x14, 0xC0, 0x19, 0x29, 0x0D, 0xC0, 0x04, 0x19, 0x14, 0xC0, 0x19, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0xFE, 0x62, 0x08, 0x28, 0xCD, 0x2D, 0x34,
+0x3C, 0xC2, 0x28, 0x19, 0x0C, 0xC0, 0x14, 0x20, 0x28, 0x39, 0x7F, 0xA3, 0x66, 0xA9, 0x43, 0xC0, 0x93, 0xEF, 0xC0, 0x01, 0x3C, 0x01, 0x08, 0x15,
+0xA2, 0x77, 0xC1, 0x30, 0xC1, 0x7E, 0xC1, 0x6F, 0xC2, 0x6E, 0x18, 0x65, 0x18, 0xC2, 0x6E, 0xC0, 0x7A, 0x2C, 0xC0, 0x31, 0x3B, 0x69, 0x6F, 0xC0,
+0xA2, 0x77, 0x65, 0xC1, 0x00, 0x08, 0x5A, 0xC0, 0x14, 0x08, 0x0F, 0x05, 0x14, 0x1C, 0x38, 0x99, 0xBC, 0x28, 0x2D, 0x19, 0x9D, 0xAA, 0x19, 0x6B,
+0x50, 0x00, 0x05, 0x2D, 0xA3, 0x77, 0x3C, 0x9C, 0xAA, 0x19, 0xC0, 0x15, 0x0C, 0xA2, 0x77, 0xA3, 0x67, 0xA2, 0x76, 0x08, 0x51, 0x29, 0x19, 0x05,
+0x2D, 0x28, 0x9C, 0xAA, 0xC1, 0x14, 0xA5, 0x56, 0x38, 0x2C, 0x34, 0x20, 0x2C, 0x20, 0xC1, 0x1D, 0x7E, 0x9C, 0xAA, 0x01, 0x19, 0xC0, 0x14, 0xC3,
+0x19, 0x14, 0xC1, 0x05, 0xC0, 0x14, 0xC4, 0x05, 0xC4, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x0A, 0x98, 0x05, 0xA1, 0xCA, 0x0D, 0xC0, 0xFE,
+0x68, 0x80, 0xFE, 0xA3, 0x10, 0x2F, 0x0D, 0xC1, 0x28, 0xC0, 0x19, 0xC0, 0x28, 0xC2, 0x33, 0x0D, 0xC0, 0xFE, 0x67, 0x70, 0x28, 0xC1, 0xFE, 0x2A,
+0x98, 0x0D, 0xC0, 0xFE, 0x2B, 0xA8, 0x28, 0xC6, 0x29, 0x0D, 0xC0, 0xFE, 0x4A, 0xA0, 0x34, 0xC0, 0x3C, 0x34, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x14,
+0xC0, 0x05, 0x00, 0x19, 0x14, 0x00, 0xFE, 0x27, 0x68, 0x0D, 0xC1, 0x24, 0xA4, 0x66, 0x05, 0x00, 0x2D, 0x14, 0x00, 0x05, 0x29, 0x0D, 0xC0, 0x04,
+0x14, 0xC0, 0x19, 0xC0, 0x0D, 0xC1, 0x25, 0xFE, 0x62, 0x08, 0x28, 0xC9, 0x2D, 0xC2, 0x34, 0xC0, 0x2D, 0xC0, 0x3C, 0xC0, 0x08, 0x01, 0x3C, 0x2D,
+0x19, 0x14, 0x56, 0xC0, 0x14, 0x01, 0x38, 0x10, 0x39, 0xA2, 0x77, 0x08, 0x3C, 0x0D, 0x7F, 0xC0, 0x24, 0xC0, 0x6E, 0x30, 0xC0, 0x35, 0x38, 0x35,
+0x38, 0x6F, 0xC0, 0x38, 0xA2, 0x77, 0xC2, 0x18, 0xC1, 0x6E, 0x7A, 0xC0, 0x2C, 0xC0, 0x31, 0x7A, 0xC0, 0x6F, 0x7E, 0xA2, 0x77, 0xA9, 0x34, 0x00,
+0xC1, 0x34, 0x00, 0xC1, 0x6E, 0x08, 0x00, 0x05, 0xC0, 0x7F, 0x05, 0x30, 0x28, 0xC0, 0x2D, 0x9D, 0xAA, 0x55, 0x19, 0x6E, 0x19, 0x05, 0x66, 0xC1,
+0xA2, 0x76, 0x14, 0xC0, 0x10, 0x3D, 0x04, 0x3D, 0x9C, 0xAB, 0x28, 0x00, 0xC1, 0x14, 0xC0, 0x05, 0x00, 0x05, 0x19, 0x01, 0x35, 0x1D, 0x31, 0xC0,
+0x2C, 0x1D, 0x20, 0x2C, 0x31, 0xC0, 0x09, 0x01, 0x28, 0x19, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0xC0, 0x14, 0xC2, 0x05, 0xC0, 0x14, 0xC4, 0x05, 0xC4,
+0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0x3F, 0xFE, 0x21, 0x00, 0x19, 0xFE, 0x2C, 0xB8, 0x29, 0xFE, 0xA4, 0x30, 0xA0, 0x47, 0x2F, 0x0D, 0xC1, 0x28,
+0xC0, 0x19, 0xC0, 0x28, 0xC2, 0x0D, 0xC1, 0x1A, 0x28, 0xC1, 0xFE, 0x4A, 0x98, 0x0D, 0xC0, 0x29, 0x28, 0xC4, 0x2D, 0xC0, 0xFE, 0x2D, 0xD0, 0x0D,
+0xC8, 0x25, 0x2D, 0x3C, 0x14, 0x05, 0x20, 0x24, 0x00, 0x2A, 0x0D, 0xC1, 0xFE, 0xE7, 0x39, 0xA7, 0x55, 0x05, 0xC0, 0x1C, 0x15, 0x00, 0xC0, 0x29,
+0x0D, 0xC8, 0x25, 0xFE, 0x62, 0x08, 0x28, 0xC9, 0x2D, 0xC0, 0x28, 0x2D, 0x34, 0xC4, 0x3C, 0xC1, 0x01, 0xC0, 0x6B, 0x39, 0x20, 0x14, 0x5A, 0x28,
+0x01, 0x6F, 0x08, 0x10, 0x0D, 0x15, 0x24, 0xC2, 0x6E, 0x24, 0x30, 0xC1, 0x7E, 0xC0, 0x04, 0xC1, 0x7E, 0x04, 0xC0, 0x0C, 0x18, 0xC1, 0x7E, 0x2C,
+0xC2, 0x7E, 0xC0, 0x6F, 0xC0, 0xA6, 0x55, 0xA8, 0x44, 0x9C, 0xAA, 0x00, 0x34, 0x00, 0xC0, 0x34, 0xC2, 0x00, 0x34, 0x00, 0x3B, 0x34, 0xA3, 0x67,
+0x3B, 0x30, 0x28, 0xC0, 0xA2, 0x76, 0x19, 0x05, 0xC0, 0x7F, 0xC4, 0x69, 0x05, 0x66, 0xC4, 0x05, 0xC1, 0x00, 0xC1, 0x14, 0x28, 0x10, 0xA4, 0x56,
+0x1D, 0x2C, 0xC0, 0x20, 0xC0, 0x1D, 0x20, 0xC0, 0x2C, 0x61, 0x10, 0x28, 0x19, 0x0D, 0x05, 0x14, 0xD1, 0x05, 0xC2, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB,
+0xC0, 0x3F, 0x14, 0x28, 0xC0, 0x2D, 0x6B, 0xC0, 0x2F, 0x0D, 0xC1, 0x28, 0xC5, 0x2A, 0x0D, 0xC1, 0x28, 0xC2, 0x2A, 0x0D, 0xC1, 0x2D, 0x28, 0x2D,
+0x34, 0xC0, 0x7E, 0xC0, 0x2D, 0x2E, 0x0D, 0xC8, 0xFE, 0xEB, 0x89, 0x1C, 0xA3, 0x67, 0x38, 0x10, 0xAD, 0x12, 0x99, 0xCB, 0x95, 0xDE, 0x2F, 0x0D,
+0xC1, 0x34, 0x08, 0x9B, 0xBA, 0xC0, 0xB0, 0x00, 0x30, 0x05, 0x28, 0x29, 0x0D, 0xC8, 0x25, 0x28, 0xCD, 0x2D, 0xC1, 0x6B, 0xC1, 0x7E, 0x39, 0x3C,
+0xC2, 0x08, 0xC0, 0x6E, 0x10, 0x01, 0x10, 0xC0, 0x0D, 0x10, 0xC0, 0x15, 0x6B, 0x21, 0x7E, 0xC0, 0x66, 0xC0, 0x30, 0xC1, 0x38, 0xC2, 0x04, 0x6E,
+0x0C, 0x09, 0x0C, 0xC0, 0x18, 0xC1, 0x1D, 0x27, 0xC0, 0x31, 0xC0, 0x2C, 0x31, 0xA3, 0x77, 0xA7, 0x44, 0xA5, 0x66, 0x98, 0xCB, 0x3C, 0x31, 0x2C,
+0x31, 0x2C, 0x31, 0x7A, 0x2C, 0xC0, 0x34, 0xC0, 0x2C, 0xC1, 0xA2, 0x77, 0x7E, 0x00, 0x38, 0x3C, 0x2D, 0x3C, 0x2D, 0x19, 0x61, 0x05, 0xCA, 0x66,
+0xC2, 0x05, 0x7F, 0x28, 0x01, 0x21, 0xA4, 0x76, 0xA2, 0x77, 0x2C, 0x20, 0x18, 0xC1, 0x20, 0x18, 0x1D, 0x09, 0x10, 0x28, 0x19, 0x14, 0x05, 0xC0,
+0x14, 0xD1, 0x05, 0xC2, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x2A, 0x98, 0x19, 0x28, 0x2D, 0x6B, 0xC0, 0x2D, 0x2A, 0x0D, 0xC1, 0x28, 0xC5,
+0xFE, 0x4A, 0x98, 0x0D, 0xC0, 0x33, 0x28, 0xC2, 0xA0, 0xCA, 0x0D, 0xC1, 0xFE, 0x87, 0x60, 0x3C, 0x34, 0x2D, 0x28, 0x19, 0x14, 0x05, 0xFE, 0x07,
+0x78, 0xFE, 0x0F, 0xF0, 0x0D, 0xC6, 0xFE, 0xCE, 0xD8, 0xFE, 0xCB, 0x5A, 0x20, 0x9D, 0x9A, 0x38, 0x9D, 0x9A, 0x28, 0x34, 0x24, 0xFE, 0xC8, 0x70,
+0x0D, 0xC1, 0x01, 0x3C, 0xA3, 0x66, 0x52, 0x2D, 0x01, 0x3C, 0x20, 0xFE, 0xC9, 0x80, 0x03, 0x7B, 0xC6, 0xA0, 0x35, 0x19, 0xC0, 0x28, 0xCB, 0x2D,
+0xC2, 0x34, 0xC0, 0x3C, 0xC0, 0x34, 0x3C, 0xC2, 0x01, 0xC0, 0x08, 0x10, 0xC0, 0x5A, 0xC0, 0x08, 0x10, 0x15, 0xC1, 0x1C, 0x24, 0x6E, 0x24, 0xC0,
+0x30, 0x6E, 0x30, 0x38, 0xC1, 0x04, 0xC1, 0x6E, 0x0C, 0xC1, 0x18, 0xC1, 0x20, 0x27, 0x2C, 0x7E, 0xC0, 0x2C, 0x0F, 0xAA, 0x22, 0xA2, 0x87, 0x2C,
+0x91, 0xFF, 0x61, 0x2C, 0xC1, 0x1D, 0x2C, 0xC5, 0x34, 0x31, 0x34, 0x2C, 0xA2, 0x77, 0x69, 0x9C, 0xAA, 0x24, 0x3C, 0x5A, 0x3C, 0x28, 0x19, 0x14,
+0xC0, 0x05, 0xC1, 0x66, 0xC2, 0x05, 0xC2, 0x14, 0x6F, 0x2D, 0x01, 0x15, 0x38, 0x1D, 0x31, 0x2C, 0x65, 0x18, 0x0C, 0xC0, 0x18, 0xC1, 0x09, 0x10,
+0x2D, 0x28, 0x14, 0x05, 0xC1, 0x14, 0xD1, 0x05, 0xC5, 0x14, 0x6F, 0x28, 0x2D, 0x6B, 0xC0, 0x28, 0xD0, 0x2D, 0xC0, 0x34, 0x3C, 0xC0, 0x2D, 0x20,
+0x14, 0xC0, 0x00, 0x05, 0x14, 0x19, 0x28, 0x08, 0x20, 0x00, 0x38, 0xA4, 0x66, 0x05, 0x00, 0x0C, 0x10, 0x00, 0x14, 0x01, 0x05, 0x00, 0x34, 0x01,
+0x00, 0x05, 0x15, 0x28, 0x00, 0x28, 0x15, 0x14, 0x05, 0x01, 0x10, 0x14, 0x28, 0x08, 0x24, 0x3C, 0x05, 0x00, 0x14, 0x19, 0x14, 0x19, 0xC5, 0x28,
+0xCB, 0x2D, 0xC2, 0x34, 0xC3, 0x3C, 0xC2, 0x01, 0x08, 0xC1, 0x10, 0xC3, 0x15, 0x1C, 0xC1, 0x24, 0xC1, 0x6E, 0x30, 0xC1, 0x38, 0xC1, 0x04, 0x09,
+0x0C, 0x09, 0x0C, 0xC0, 0x18, 0xC0, 0x1D, 0xC0, 0x20, 0x2C, 0x31, 0x7A, 0x31, 0x23, 0xA9, 0x33, 0x51, 0x3D, 0x00, 0xC0, 0x19, 0x20, 0xC2, 0x1D,
+0x20, 0x2C, 0xC2, 0x20, 0x2C, 0xC1, 0x20, 0xC0, 0x2C, 0x34, 0x6E, 0x11, 0x9B, 0xBB, 0x08, 0x01, 0x3C, 0x2D, 0x28, 0xC0, 0x19, 0xC4, 0x6B, 0x28,
+0xC0, 0x6F, 0x01, 0x10, 0x24, 0x04, 0x18, 0x7E, 0x2C, 0xC0, 0x1D, 0x18, 0xC1, 0x0C, 0x11, 0x04, 0x29, 0x01, 0x2D, 0xC0, 0x19, 0x05, 0xC0, 0x14,
+0xD3, 0x05, 0xC5, 0x19, 0x28, 0x2D, 0xC0, 0x34, 0x2D, 0x28, 0xCB, 0x2D, 0xC1, 0x34, 0x3C, 0xC0, 0x2D, 0x28, 0x19, 0x05, 0x00, 0xC1, 0x14, 0x28,
+0x3C, 0x30, 0x18, 0xA3, 0x76, 0xA2, 0x77, 0x98, 0xCC, 0x28, 0x24, 0x38, 0x2D, 0x28, 0x3C, 0x2D, 0x28, 0x01, 0x24, 0x9B, 0xAB, 0x2D, 0x1C, 0xC0,
+0x28, 0xC0, 0x24, 0x3C, 0x14, 0x34, 0x1C, 0x28, 0x14, 0x3C, 0x10, 0x14, 0x05, 0x3C, 0x19, 0x05, 0xC2, 0x14, 0xC0, 0x19, 0xC5, 0x28, 0xCB, 0x2D,
+0xC3, 0x34, 0xC2, 0x3C, 0xC3, 0x01, 0x6B, 0xC0, 0x10, 0xC2, 0x15, 0xC0, 0x1C, 0xC0, 0x21, 0xC0, 0x24, 0xC0, 0x29, 0x35, 0xC1, 0x04, 0xC2, 0x0C,
+0x09, 0x04, 0x0C, 0xC0, 0x18, 0xC1, 0x1D, 0x20, 0x2C, 0xC0, 0x7E, 0xA6, 0x55, 0xA9, 0x34, 0x99, 0xBB, 0xFE, 0xE3, 0x18, 0x00, 0x05, 0x19, 0x7A,
+0x18, 0xC0, 0x1D, 0x18, 0x1D, 0x20, 0x18, 0x20, 0xC0, 0x18, 0xC0, 0x20, 0xC3, 0x1D, 0xC0, 0x31, 0xC0, 0x2C, 0x18, 0x3D, 0x29, 0x24, 0x15, 0x08,
+0x01, 0xC2, 0x3C, 0x01, 0x0D, 0x15, 0x6B, 0x29, 0x04, 0x18, 0xC0, 0xA2, 0x76, 0x1D, 0x18, 0x1D, 0x18, 0x65, 0xC0, 0x20, 0xC0, 0x18, 0x38, 0x15,
+0x08, 0x3C, 0x28, 0x14, 0x05, 0xC0, 0x14, 0xD4, 0x05, 0xC4, 0x14, 0x19, 0x28, 0x2D, 0xC2, 0x28, 0xC9, 0x2D, 0xC0, 0x28, 0x2D, 0x3C, 0xC0, 0x28,
+0x14, 0x05, 0x00, 0xC0, 0x05, 0x28, 0x05, 0x00, 0x24, 0x20, 0x01, 0xA4, 0x67, 0x18, 0x29, 0x01, 0xC0, 0x15, 0x9A, 0xBC, 0x28, 0x1C, 0x15, 0x9C,
+0xAB, 0x3C, 0x24, 0x15, 0x3C, 0x15, 0x29, 0x01, 0xC0, 0x1C, 0xC0, 0x01, 0x10, 0x1C, 0x10, 0xC1, 0x15, 0x08, 0x15, 0xC0, 0x01, 0xC0, 0x10, 0x2D,
+0x28, 0x00, 0xC0, 0x14, 0xC0, 0x19, 0xC5, 0x28, 0xCB, 0x2D, 0xC3, 0x34, 0xC2, 0x3C, 0xC2, 0x01, 0xC0, 0x08, 0xC1, 0x10, 0x15, 0xC4, 0x24, 0xC3,
+0x30, 0x38, 0x35, 0x04, 0xC5, 0x0C, 0x18, 0xC1, 0x1D, 0x7A, 0x2C, 0xC0, 0x3B, 0xA7, 0x44, 0xA8, 0x44, 0x95, 0xED, 0x28, 0x00, 0x14, 0x19, 0xC0,
+0x7E, 0xAA, 0x34, 0x11, 0xC0, 0x18, 0x1D, 0x18, 0x11, 0x1D, 0x18, 0xC0, 0x0C, 0x11, 0x18, 0x1D, 0x18, 0xC1, 0x1D, 0x20, 0x18, 0x20, 0x2C, 0x20,
+0xC1, 0x1D, 0x0C, 0x04, 0x09, 0x0C, 0xC0, 0x04, 0xC0, 0x0C, 0xC0, 0x18, 0xC0, 0x1D, 0x20, 0x09, 0xC0, 0x0C, 0x18, 0x04, 0x0C, 0x18, 0x0C, 0x18,
+0x04, 0x30, 0x24, 0x10, 0xC0, 0x51, 0x14, 0x05, 0xC1, 0x14, 0xC9, 0x05, 0xC0, 0x14, 0xC9, 0x05, 0xC2, 0x14, 0x28, 0x2D, 0xC2, 0x28, 0xCA, 0x2D,
+0xC0, 0x3C, 0xC0, 0x28, 0x14, 0x00, 0xC0, 0x6F, 0x14, 0x05, 0x34, 0xA9, 0x43, 0x19, 0x05, 0x15, 0xC0, 0x05, 0xC0, 0x01, 0x14, 0x00, 0x14, 0x15,
+0x05, 0x00, 0x08, 0xC0, 0x00, 0x05, 0x24, 0x28, 0x00, 0x2D, 0x24, 0x05, 0x00, 0x10, 0x01, 0x00, 0x14, 0x24, 0x28, 0x00, 0x2D, 0x15, 0x14, 0xC0,
+0x08, 0x10, 0x28, 0x34, 0x15, 0x10, 0x00, 0xC0, 0x14, 0x19, 0xC6, 0x28, 0xCA, 0x2D, 0xC1, 0x34, 0xC2, 0x3C, 0xC5, 0x01, 0xC0, 0x08, 0xC1, 0x10,
+0x15, 0x10, 0x15, 0xC1, 0x6B, 0x6E, 0x24, 0xC1, 0x30, 0xC0, 0x35, 0x38, 0xC0, 0x04, 0xC1, 0x0C, 0xC2, 0x18, 0xC1, 0x20, 0x2C, 0xC0, 0x31, 0xA8,
+0x45, 0xA7, 0x53, 0x39, 0xFE, 0x20, 0x00, 0x00, 0x19, 0xC1, 0x7B, 0x6D, 0x04, 0x09, 0xC0, 0x04, 0x0C, 0x11, 0x0C, 0xC0, 0x09, 0x18, 0xC0, 0x0C,
+0xC0, 0x18, 0x11, 0xC0, 0x0C, 0xC0, 0x11, 0xC0, 0x18, 0xC2, 0x0C, 0x1D, 0xC0, 0x18, 0xC0, 0x20, 0x18, 0xC2, 0x0C, 0xC0, 0x09, 0x04, 0x0C, 0x04,
+0xC0, 0x0C, 0xC0, 0x38, 0x0C, 0x2C, 0x0C, 0x38, 0x30, 0xC0, 0x29, 0x10, 0x34, 0x14, 0x05, 0xC1, 0x14, 0xCA, 0x05, 0xC0, 0x14, 0xC9, 0x05, 0xC2,
+0x19, 0x28, 0x2D, 0xC2, 0x28, 0xCA, 0x34, 0x3C, 0x2D, 0x14, 0x00, 0xC1, 0x19, 0xA4, 0x67, 0x24, 0x01, 0x08, 0x30, 0x08, 0x3C, 0x10, 0xC0, 0x3C,
+0x01, 0x29, 0x10, 0x2D, 0x01, 0x1C, 0x3C, 0x2D, 0x1C, 0xC0, 0x2D, 0x3C, 0x29, 0x10, 0x28, 0x10, 0x29, 0x34, 0x2D, 0x15, 0xC0, 0x28, 0xC0, 0x24,
+0x3C, 0x14, 0x34, 0x15, 0x19, 0x14, 0x3C, 0xC0, 0x05, 0x00, 0x3C, 0x14, 0x00, 0xC0, 0x14, 0x19, 0xC6, 0x28, 0xCA, 0x2D, 0xC1, 0x34, 0xC0, 0x2D,
+0x34, 0xC0, 0x3C, 0xC4, 0x01, 0x08, 0xC1, 0x0D, 0xC0, 0x10, 0xC2, 0x15, 0x24, 0xC0, 0x1C, 0x24, 0xC0, 0x30, 0x35, 0x30, 0x35, 0x38, 0x04, 0xC1,
+0x09, 0x0C, 0xC0, 0x18, 0x1D, 0x18, 0x1D, 0x20, 0x2C, 0x7E, 0xA9, 0x34, 0xA3, 0x77, 0x18, 0x05, 0x00, 0x19, 0xC3, 0x28, 0x2C, 0x20, 0xC0, 0x18,
+0x0C, 0x18, 0x09, 0x04, 0x09, 0x18, 0x09, 0x38, 0x04, 0x09, 0x04, 0x0C, 0x04, 0xC3, 0x18, 0x0C, 0xC0, 0x04, 0x0C, 0x04, 0xC2, 0x0C, 0xC1, 0x04,
+0xC0, 0x0C, 0xC0, 0x04, 0x09, 0x0C, 0xC0, 0x18, 0xC1, 0x1D, 0x18, 0xC0, 0x0C, 0xC0, 0x30, 0x3C, 0x19, 0x14, 0x56, 0x05, 0xC0, 0x7E, 0x14, 0xCC,
+0x05, 0x14, 0xC7, 0x05, 0xC2, 0x14, 0x19, 0x28, 0x2D, 0x6B, 0x2D, 0xC0, 0x28, 0xC9, 0x3C, 0xC0, 0x28, 0x00, 0xC2, 0x19, 0x01, 0x2D, 0xC0, 0x24,
+0x3C, 0x28, 0xA4, 0x66, 0x29, 0x3C, 0x34, 0x29, 0x24, 0x34, 0x3C, 0x24, 0x08, 0x2D, 0x10, 0x24, 0x3C, 0xC0, 0x24, 0xC0, 0x3C, 0x10, 0x30, 0x10,
+0x3C, 0x1C, 0x38, 0x01, 0xC0, 0x24, 0x1C, 0x01, 0x10, 0x24, 0x15, 0x10, 0x15, 0x10, 0x08, 0x1C, 0x08, 0x28, 0x3C, 0x2D, 0x00, 0xC0, 0x05, 0x19,
+0x14, 0x19, 0xC4, 0x28, 0xCA, 0x2D, 0xC4, 0x34, 0xC1, 0x3C, 0xC1, 0x01, 0x3C, 0xC0, 0x01, 0x08, 0xC0, 0x6E, 0x10, 0xC0, 0x15, 0xC0, 0x10, 0x15,
+0x24, 0xC1, 0x30, 0xC2, 0x35, 0x38, 0xC0, 0x04, 0xC2, 0x09, 0x7A, 0xC0, 0x18, 0x20, 0xC1, 0xA2, 0x77, 0xAA, 0x33, 0xA2, 0x67, 0x30, 0x00, 0x05,
+0x19, 0xC2, 0x28, 0xC1, 0xFE, 0x52, 0x8C, 0x50, 0x56, 0x51, 0x51, 0x51, 0x65, 0x52, 0x69, 0x56, 0x65, 0x34, 0xC0, 0x31, 0x2C, 0xC0, 0x20, 0x27,
+0x20, 0x56, 0xC7, 0x20, 0x18, 0x2C, 0x20, 0xC0, 0x2C, 0x20, 0x2C, 0xC0, 0x20, 0xC0, 0x2C, 0xC2, 0x34, 0xC1, 0x20, 0x9C, 0xAB, 0x9D, 0x99, 0x9C,
+0xAA, 0x9D, 0xA9, 0xC1, 0x56, 0xC0, 0x14, 0xCE, 0x05, 0x14, 0xC7, 0x05, 0xC2, 0x19, 0x28, 0xC0, 0x2D, 0x34, 0x2D, 0xC0, 0x28, 0xC8, 0xA2, 0x77,
+0xC0, 0x14, 0x51, 0xC1, 0x05, 0xC0, 0x3C, 0xC0, 0x05, 0x0C, 0xA9, 0x43, 0x28, 0x05, 0x2D, 0x1C, 0x05, 0xC0, 0xA7, 0x55, 0x01, 0x05, 0xC0, 0x1C,
+0x9A, 0xBB, 0x00, 0x2D, 0x15, 0x05, 0xC0, 0x10, 0x01, 0x00, 0x14, 0xA9, 0x33, 0x19, 0x00, 0x34, 0x24, 0x00, 0xC0, 0x10, 0x3C, 0x00, 0x19, 0x1C,
+0x28, 0x05, 0x3C, 0x1C, 0x14, 0x28, 0x10, 0x56, 0x3C, 0x29, 0x14, 0x00, 0x05, 0x19, 0xC6, 0x28, 0xCA, 0x2D, 0xC3, 0x34, 0xC2, 0x3C, 0xC2, 0x01,
+0xC2, 0x0D, 0x10, 0xC1, 0x1C, 0x15, 0x10, 0x1C, 0x24, 0x5A, 0x24, 0x6F, 0xC1, 0x7E, 0xC3, 0x04, 0xC0, 0x09, 0x7A, 0xC0, 0x18, 0xC0, 0x7E, 0x2C,
+0x7E, 0xAB, 0x23, 0x65, 0x15, 0x00, 0x14, 0x6F, 0xC0, 0x19, 0x28, 0xC3, 0x33, 0x6E, 0x7E, 0xA2, 0x67, 0xC0, 0x66, 0xC0, 0x55, 0x00, 0xC0, 0x38,
+0x33, 0x38, 0xC0, 0x24, 0xC0, 0x51, 0xC0, 0x65, 0x5A, 0x66, 0xC1, 0x65, 0x3C, 0x51, 0xC1, 0x6E, 0x9D, 0xAA, 0xC0, 0x6E, 0xC0, 0x14, 0x65, 0x5A,
+0x08, 0xC0, 0x56, 0x08, 0x14, 0x00, 0xC1, 0x1D, 0x9C, 0xBA, 0x9C, 0xAA, 0x9D, 0x9A, 0x65, 0x20, 0x65, 0x56, 0x14, 0xCF, 0x55, 0xC0, 0x14, 0xC8,
+0x05, 0xC1, 0x0C, 0xA2, 0x76, 0x28, 0x6E, 0xC3, 0x28, 0xC7, 0xA2, 0x77, 0xC0, 0x14, 0x51, 0xC1, 0x05, 0x2D, 0x10, 0xA2, 0x77, 0xC0, 0x9D, 0x9A,
+0x10, 0x24, 0x10, 0x55, 0x15, 0x24, 0x01, 0x3C, 0x24, 0x1C, 0x3C, 0x01, 0x24, 0x08, 0x34, 0x10, 0x24, 0x34, 0xC0, 0x1C, 0xC0, 0x2D, 0x01, 0x29,
+0x08, 0x28, 0x10, 0x24, 0x2D, 0x28, 0x15, 0x10, 0x20, 0x2D, 0x15, 0x34, 0x14, 0x2D, 0x15, 0x14, 0x05, 0x3C, 0x34, 0x00, 0x28, 0x14, 0x00, 0x14,
+0xC0, 0x19, 0xC5, 0x28, 0xCA, 0x2D, 0xC3, 0x34, 0xC2, 0x3C, 0xC2, 0x01, 0xC0, 0x08, 0xC1, 0x0D, 0xC0, 0x10, 0x15, 0x10, 0xC0, 0x21, 0xC0, 0x1C,
+0x21, 0x24, 0x6F, 0xC0, 0x38, 0xC3, 0x6F, 0xC0, 0x09, 0x7A, 0x6F, 0xC0, 0x1D, 0xC0, 0xA2, 0x87, 0xAB, 0x23, 0x65, 0x10, 0x00, 0xA2, 0x76, 0x19,
+0x7B, 0x20, 0x23, 0x28, 0xC3, 0x08, 0x15, 0x7F, 0x38, 0x04, 0xA2, 0x76, 0x1D, 0x25, 0x2C, 0x34, 0xA2, 0x67, 0xA2, 0x77, 0x7F, 0x19, 0x7A, 0x28,
+0x19, 0xA2, 0x77, 0x28, 0x19, 0x28, 0xC0, 0x19, 0x1C, 0x28, 0x19, 0x66, 0xC0, 0x19, 0x14, 0xC0, 0x05, 0xC5, 0x66, 0x31, 0x2C, 0x0C, 0x35, 0x9D,
+0xAA, 0x08, 0x01, 0x51, 0x66, 0x20, 0x65, 0xC2, 0x56, 0x69, 0x14, 0xCB, 0x05, 0xC1, 0x14, 0xC6, 0x05, 0x14, 0x05, 0x66, 0x05, 0x14, 0x20, 0x28,
+0x2D, 0x6B, 0x2D, 0xC1, 0x28, 0xC6, 0x2D, 0x01, 0x14, 0x00, 0xC0, 0x05, 0x0C, 0x05, 0x3C, 0x30, 0x2D, 0x28, 0x29, 0x1C, 0x28, 0x3C, 0x38, 0x3C,
+0x28, 0x15, 0x29, 0x2D, 0x34, 0x29, 0x1C, 0x28, 0x01, 0x38, 0x01, 0x2D, 0x1C, 0x30, 0x3C, 0xC0, 0x38, 0x24, 0x34, 0x10, 0x38, 0x01, 0x3C, 0x24,
+0x29, 0x3C, 0x01, 0x29, 0x1C, 0x01, 0x1C, 0x24, 0x10, 0x15, 0x1C, 0x3C, 0x10, 0xC0, 0x34, 0x28, 0x00, 0xC0, 0x14, 0xC1, 0x6E, 0xC3, 0x28, 0xC9,
+0x2D, 0xC5, 0x34, 0x3C, 0xC4, 0x01, 0x3C, 0x01, 0x08, 0x01, 0x08, 0xC0, 0x10, 0xC2, 0x15, 0x21, 0xC0, 0x1C, 0x24, 0xC1, 0x30, 0x38, 0x35, 0x38,
+0x04, 0xC2, 0x7E, 0x6F, 0xC2, 0x31, 0xAA, 0x43, 0xC0, 0xFE, 0x04, 0x19, 0x00, 0x14, 0x19, 0x28, 0x19, 0xC0, 0x23, 0x28, 0xC6, 0x2D, 0x34, 0x2D,
+0x34, 0x3C, 0xC0, 0x01, 0x08, 0x10, 0x1C, 0xC1, 0x21, 0xC0, 0x29, 0x30, 0x35, 0xC1, 0x04, 0xC0, 0x09, 0x04, 0x0C, 0x09, 0x7F, 0x11, 0x18, 0xC2,
+0x09, 0xC1, 0x04, 0xC0, 0x24, 0x21, 0x1C, 0x10, 0x01, 0x3C, 0xC0, 0x28, 0x20, 0x19, 0x14, 0xC0, 0x69, 0x05, 0xC0, 0x14, 0xCC, 0x05, 0xC3, 0x14,
+0xC5, 0x05, 0xC0, 0x00, 0x6F, 0x14, 0x28, 0xC0, 0x34, 0xC0, 0x2D, 0xC1, 0x28, 0xC5, 0x2D, 0x01, 0x28, 0x00, 0xC1, 0x14, 0x28, 0x05, 0x3C, 0x24,
+0x0C, 0xC0, 0x15, 0x3C, 0x05, 0x14, 0x24, 0x19, 0x05, 0x3C, 0x1C, 0x05, 0xC0, 0x15, 0x3C, 0x05, 0x14, 0x29, 0x14, 0x05, 0x3C, 0x24, 0x05, 0xC0,
+0x24, 0x3C, 0x05, 0x19, 0x29, 0x0C, 0x00, 0x3C, 0x15, 0x00, 0x05, 0x1C, 0x3C, 0x00, 0x28, 0x24, 0x28, 0x14, 0x08, 0x1C, 0x28, 0x3C, 0xA7, 0x44,
+0x15, 0x00, 0xC0, 0x14, 0xC1, 0x19, 0xC3, 0x28, 0xC9, 0x2D, 0xC5, 0x34, 0x3C, 0xC4, 0x01, 0xC3, 0x08, 0xC0, 0x10, 0x15, 0xC1, 0x1C, 0x21, 0xC0,
+0x24, 0x30, 0xC0, 0x24, 0x30, 0xC0, 0x35, 0x38, 0xC0, 0x04, 0xC0, 0x09, 0x18, 0xC1, 0x1D, 0x2C, 0xAB, 0x22, 0x7F, 0x08, 0x00, 0x14, 0x19, 0xC0,
+0x28, 0xC1, 0x20, 0x28, 0xC3, 0x2D, 0xC2, 0x34, 0x28, 0x2D, 0x34, 0xC0, 0x6E, 0x3C, 0xC6, 0x08, 0x10, 0xC0, 0x08, 0x10, 0x1C, 0xC0, 0x10, 0x1C,
+0xC0, 0x7E, 0x55, 0x1C, 0x24, 0xC0, 0x1C, 0xC0, 0x21, 0x1C, 0x15, 0x1C, 0x10, 0xC0, 0x01, 0x3C, 0x39, 0x2D, 0x28, 0xC0, 0x19, 0x14, 0xD2, 0x05,
+0xC3, 0x14, 0xC5, 0x05, 0x00, 0xC0, 0x0C, 0x14, 0x28, 0x2D, 0x34, 0xC0, 0x2D, 0xC0, 0x28, 0xC6, 0x3C, 0xC0, 0x05, 0x00, 0xC1, 0x28, 0x24, 0x10,
+0x24, 0xC0, 0x10, 0xC0, 0x24, 0x1C, 0x01, 0x10, 0x29, 0x10, 0x01, 0x1C, 0x24, 0x08, 0xC0, 0x29, 0x24, 0x01, 0x10, 0x30, 0x10, 0x3C, 0x1C, 0x29,
+0x01, 0x3C, 0x29, 0x24, 0x3C, 0x10, 0x30, 0x01, 0x34, 0x15, 0x24, 0x2D, 0x28, 0x24, 0x10, 0x19, 0x2D, 0x24, 0x2D, 0x14, 0x2D, 0x10, 0x05, 0xC0,
+0x1C, 0x34, 0x00, 0xC0, 0x14, 0xC1, 0x19, 0xC3, 0x28, 0xC9, 0x2D, 0xC5, 0x34, 0x3C, 0xC7, 0x01, 0x08, 0xC0, 0x6E, 0x10, 0xC0, 0x15, 0xC0, 0x1C,
+0x15, 0x1C, 0x24, 0x30, 0xC0, 0x24, 0x30, 0xC0, 0x38, 0x04, 0x38, 0xC0, 0x09, 0xC0, 0x18, 0xC1, 0x7E, 0xAB, 0x23, 0xA2, 0x77, 0x1C, 0x00, 0x14,
+0x19, 0xC1, 0x28, 0xCC, 0x2D, 0xC0, 0x28, 0x2D, 0x34, 0x3C, 0x34, 0x39, 0x3C, 0x39, 0xC0, 0x01, 0x3C, 0xC1, 0x01, 0x3C, 0x01, 0x7F, 0xC0, 0x0D,
+0x08, 0x10, 0x15, 0x10, 0xC0, 0x15, 0xC0, 0x10, 0xC0, 0x15, 0x10, 0x08, 0xC0, 0x01, 0x3C, 0x34, 0x2D, 0xC0, 0x28, 0x19, 0x6B, 0x19, 0x14, 0xD2,
+0x05, 0xC3, 0x14, 0xC4, 0x05, 0x00, 0xC0, 0x05, 0x0C, 0x19, 0x28, 0x2D, 0x34, 0xC0, 0x2D, 0xC0, 0x28, 0xC5, 0x2D, 0x3C, 0x19, 0x00, 0xC1, 0x14,
+0xC0, 0x3C, 0x30, 0x34, 0x19, 0x15, 0x29, 0x20, 0x28, 0x30, 0x10, 0x28, 0x3C, 0x30, 0x3C, 0x28, 0xA6, 0x55, 0x30, 0x2D, 0x3C, 0x38, 0x1C, 0x28,
+0x08, 0x38, 0x3C, 0x2D, 0x30, 0x29, 0x34, 0x01, 0x38, 0x15, 0x2D, 0x10, 0x38, 0x01, 0x3C, 0x24, 0xC0, 0x01, 0x10, 0x29, 0x15, 0x10, 0x24, 0x1C,
+0x10, 0x1C, 0x08, 0x34, 0x29, 0x2D, 0x00, 0xC0, 0x14, 0xC1, 0x19, 0xC3, 0x28, 0xC9, 0x2D, 0xC5, 0x34, 0x3C, 0xC5, 0x01, 0xC1, 0x08, 0x0D, 0x10,
+0xC1, 0x15, 0xC0, 0x1C, 0x15, 0x1C, 0x24, 0x30, 0x24, 0xC0, 0x30, 0x38, 0xC1, 0x04, 0xC2, 0x18, 0xC1, 0xAA, 0x33, 0xA4, 0x66, 0xFE, 0x45, 0x29,
+0x00, 0x14, 0x19, 0xC1, 0x28, 0xCF, 0x23, 0x28, 0x2D, 0xC5, 0x7F, 0x2D, 0xC0, 0x3C, 0xC1, 0x01, 0xC0, 0x34, 0x3C, 0xC0, 0x01, 0xC3, 0x08, 0x3C,
+0xC0, 0x01, 0xC0, 0x62, 0x3C, 0xC0, 0x2D, 0x28, 0x2D, 0x56, 0x20, 0x19, 0xC1, 0x14, 0xCE, 0x05, 0xC0, 0x14, 0xC0, 0x05, 0xC3, 0x14, 0xFE, 0x25,
+0x58, 0xA0, 0xAA, 0xC2, 0x65, 0xC2, 0x4E, 0x20, 0x2D, 0xC3, 0x28, 0xC2, 0x1A, 0x2A, 0xC1, 0x6F, 0x2F, 0x11, 0xC1, 0xFE, 0x22, 0x28, 0x28, 0x14,
+0x19, 0x24, 0x19, 0x05, 0x3C, 0x1C, 0x99, 0xBB, 0x0C, 0xA7, 0xE8, 0x36, 0x1D, 0x7E, 0xA6, 0x34, 0x1D, 0xC0, 0xA4, 0x55, 0xA2, 0x66, 0x22, 0xA0,
+0x36, 0x24, 0x3C, 0x05, 0x20, 0x29, 0x0C, 0x05, 0xA6, 0x97, 0xFE, 0xE8, 0x78, 0x99, 0xDD, 0x1D, 0x24, 0x2D, 0x05, 0x20, 0xA6, 0xE8, 0x11, 0xC0,
+0xFE, 0xC6, 0x50, 0xA2, 0x04, 0x00, 0x6F, 0x24, 0x2D, 0x00, 0xA5, 0x97, 0x14, 0x2A, 0x25, 0xA5, 0x34, 0x14, 0x51, 0x1D, 0x11, 0xC0, 0xFE, 0x41,
+0x08, 0xC1, 0x19, 0xC2, 0xFE, 0x46, 0x58, 0x25, 0xC2, 0x2A, 0xC4, 0x28, 0x2D, 0xC5, 0x34, 0x3C, 0xC4, 0x01, 0xC0, 0x6B, 0xC2, 0x10, 0xC1, 0x6E,
+0xC0, 0x1C, 0x21, 0xC0, 0x24, 0x30, 0x2B, 0x24, 0x30, 0x04, 0xC0, 0x38, 0x04, 0x7E, 0x04, 0x6E, 0x0C, 0x6B, 0xAA, 0x32, 0xA6, 0x55, 0xFE, 0x66,
+0x29, 0x95, 0xED, 0x6F, 0x19, 0x7A, 0x19, 0xC1, 0x28, 0xC9, 0x20, 0xC0, 0x28, 0xCA, 0x2D, 0xC4, 0x34, 0xC0, 0x2D, 0x37, 0x3C, 0x34, 0xC1, 0x2D,
+0x34, 0x3C, 0x2D, 0xC1, 0x28, 0xC0, 0x2D, 0xC0, 0x28, 0xC1, 0x19, 0xC1, 0x14, 0xD0, 0x55, 0xC1, 0x14, 0x05, 0xC2, 0x14, 0x05, 0xFE, 0x0D, 0xD0,
+0xA0, 0xDB, 0xC7, 0xFE, 0x2A, 0x98, 0x2D, 0xC3, 0x28, 0xC1, 0xFE, 0x4A, 0x98, 0x0D, 0xC7, 0x03, 0xFE, 0x05, 0x39, 0xA1, 0x47, 0x24, 0xC0, 0x15,
+0x10, 0x24, 0xC0, 0x10, 0xFE, 0x8B, 0xA0, 0x0D, 0xC7, 0x03, 0xFE, 0xC5, 0x38, 0x30, 0x24, 0x08, 0x15, 0x30, 0x10, 0x01, 0xFE, 0x09, 0x79, 0x0D,
+0xC1, 0x30, 0x1C, 0x3C, 0xA1, 0xEA, 0x0D, 0xC1, 0xFE, 0xE8, 0x70, 0x24, 0x2D, 0x34, 0xA6, 0x54, 0x08, 0x19, 0x2A, 0x0D, 0xC7, 0x19, 0x66, 0xC0,
+0x19, 0xC2, 0xFE, 0x0D, 0xD0, 0x0D, 0xC8, 0x28, 0xC1, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0xC5, 0x01, 0x08, 0xC0, 0x6E, 0x10, 0xC1, 0x1C, 0x10, 0x1C,
+0x24, 0xC0, 0x6E, 0xC2, 0x30, 0x38, 0xC0, 0x6F, 0xC0, 0x7E, 0x18, 0x55, 0x0C, 0xA8, 0x44, 0xA9, 0x34, 0x91, 0xFF, 0x00, 0x6E, 0x19, 0xC0, 0x7A,
+0x6E, 0x28, 0x19, 0xC1, 0x28, 0xC6, 0x19, 0x28, 0xC2, 0x19, 0xC1, 0x21, 0x28, 0xCA, 0x56, 0x28, 0x2D, 0xC4, 0x28, 0xC2, 0x2D, 0x28, 0xC2, 0x23,
+0x19, 0xC3, 0x14, 0xD1, 0x05, 0xC6, 0x14, 0x05, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC7, 0x29, 0x2D, 0xC3, 0x28, 0xC1, 0x29, 0x0D, 0xC8, 0x2A, 0x30,
+0x01, 0x14, 0x3C, 0xA6, 0x55, 0x2D, 0x19, 0xA6, 0x56, 0xFE, 0x6E, 0xD0, 0x0D, 0xC8, 0xFE, 0x09, 0x79, 0x28, 0x34, 0x3D, 0x10, 0x28, 0x1C, 0x3D,
+0x2F, 0x0D, 0xC1, 0x2D, 0x01, 0x38, 0xFE, 0x8B, 0xB0, 0x0D, 0xC0, 0x3F, 0x01, 0x3C, 0xA5, 0x55, 0x24, 0x41, 0x15, 0x24, 0xFE, 0xE8, 0x70, 0xFE,
+0x10, 0xF8, 0xC7, 0xFE, 0x41, 0x08, 0xC1, 0x19, 0xC2, 0xFE, 0x0D, 0xD0, 0x0D, 0xC8, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0x2D, 0xC0, 0x34, 0xC0, 0x3C,
+0xC4, 0x01, 0xC0, 0x08, 0xC1, 0x10, 0xC1, 0x15, 0x10, 0x1C, 0xC0, 0x24, 0xC0, 0x6E, 0x30, 0xC0, 0x35, 0x30, 0x38, 0x04, 0xC0, 0x09, 0x0C, 0x04,
+0xA6, 0x55, 0x2C, 0x31, 0xFE, 0x20, 0x00, 0xC0, 0x14, 0x19, 0xC8, 0x28, 0xC9, 0x19, 0x28, 0xC7, 0x19, 0x28, 0xC3, 0x20, 0x28, 0xC6, 0x20, 0xC0,
+0x19, 0x28, 0xC2, 0x19, 0xC3, 0x14, 0xD3, 0x05, 0xC6, 0x14, 0x05, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0x49, 0x29, 0xC1, 0x00, 0x0D, 0xC0, 0x29, 0x2D,
+0x34, 0x2D, 0xC1, 0x28, 0xC1, 0x29, 0x0D, 0xC0, 0x00, 0x2E, 0xC0, 0x29, 0xC0, 0x0D, 0xC1, 0xFE, 0x27, 0x68, 0x24, 0x3C, 0x14, 0x28, 0xA7, 0x44,
+0x14, 0xC0, 0xA6, 0x45, 0xFE, 0x4E, 0xD0, 0x9E, 0xFC, 0xC0, 0x4D, 0x2E, 0x66, 0xC0, 0x3F, 0x0D, 0xC1, 0xFE, 0xC8, 0x70, 0xFE, 0x20, 0x00, 0x14,
+0xA9, 0x33, 0x2D, 0x05, 0x34, 0x30, 0x1D, 0x0D, 0xC1, 0x05, 0x6B, 0xA9, 0x74, 0x03, 0x0D, 0xC0, 0xFE, 0xCA, 0x90, 0x05, 0x66, 0x10, 0xC0, 0x00,
+0x14, 0x24, 0x2A, 0x0D, 0xC1, 0x2E, 0xC0, 0x3F, 0x9D, 0xBA, 0xC1, 0x14, 0xC1, 0x19, 0xC2, 0xFE, 0x2B, 0xA8, 0x29, 0xC1, 0x0D, 0xC1, 0xA0, 0x46,
+0x29, 0xC1, 0x28, 0xC1, 0x2D, 0xC0, 0x6B, 0x2D, 0x34, 0xC1, 0x3C, 0xC3, 0x01, 0xC1, 0x08, 0xC1, 0x6E, 0x10, 0xC0, 0x15, 0x1C, 0xC1, 0x24, 0x6E,
+0xC0, 0x35, 0xC0, 0x30, 0x35, 0x04, 0x38, 0x09, 0x04, 0x09, 0xA3, 0x77, 0xAD, 0x11, 0x98, 0xDC, 0x05, 0x00, 0x19, 0xCF, 0x28, 0xC1, 0x19, 0xC1,
+0x28, 0x19, 0xCB, 0x28, 0x20, 0xC0, 0x28, 0xC1, 0x20, 0xC5, 0x28, 0x19, 0xC4, 0x14, 0x19, 0x14, 0xC7, 0x19, 0xC4, 0x14, 0xC5, 0x05, 0xC0, 0x14,
+0xC6, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x0A, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29, 0x2D, 0x34, 0x2D, 0xC0, 0x28, 0xC2, 0x29, 0x0D,
+0xC0, 0xFE, 0x4A, 0x98, 0x3C, 0x28, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0x09, 0x79, 0xFE, 0x25, 0x21, 0x24, 0x15, 0x1C, 0x24, 0x1C, 0xC0, 0x6E, 0x3A,
+0x0D, 0xC0, 0xFE, 0xCB, 0xA0, 0x24, 0x15, 0x24, 0x6E, 0x0D, 0xC1, 0x14, 0x10, 0x15, 0x30, 0x24, 0x10, 0x24, 0x38, 0xFE, 0xC8, 0x70, 0x0D, 0xC1,
+0x08, 0x10, 0xFE, 0xEB, 0xA0, 0x0D, 0xC0, 0x49, 0x29, 0x01, 0x34, 0x21, 0xC0, 0x28, 0xC0, 0x29, 0x36, 0x0D, 0xC1, 0xFE, 0x41, 0x08, 0x0C, 0x01,
+0x05, 0x66, 0x05, 0x14, 0xC1, 0x19, 0xC2, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC4, 0x2D, 0xC0, 0x34, 0xC3, 0x3C, 0xC3, 0x01, 0xC0, 0x08, 0xC0,
+0x6E, 0x10, 0x0D, 0x10, 0xC0, 0x1C, 0xC1, 0x29, 0x24, 0xC1, 0x29, 0x30, 0x35, 0x38, 0x04, 0x6E, 0xC0, 0x7A, 0xC0, 0xAD, 0x11, 0x56, 0x28, 0x00,
+0x14, 0x19, 0xD0, 0x20, 0x28, 0xC5, 0x19, 0xC0, 0x28, 0x19, 0xC0, 0x28, 0x19, 0x28, 0x19, 0xC3, 0x20, 0xC8, 0x19, 0xC5, 0x14, 0xCA, 0x19, 0xC4,
+0x14, 0xC5, 0x05, 0xC0, 0x14, 0xC6, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29, 0x2D, 0x34, 0xC1,
+0x28, 0xC2, 0x29, 0x0D, 0xC0, 0xFE, 0x4A, 0xA0, 0x3C, 0x20, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0xE9, 0x78, 0x05, 0x19, 0xA9, 0x44, 0x9B, 0xAA, 0x14,
+0x01, 0x35, 0x20, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x2D, 0x3D, 0x08, 0x14, 0x0D, 0xC1, 0x25, 0x38, 0x55, 0x19, 0x3C, 0xA7, 0x55, 0x08, 0x28,
+0xFE, 0xE8, 0x78, 0x0D, 0xC1, 0x38, 0x24, 0xFE, 0x0F, 0xE8, 0x0D, 0xC0, 0xFE, 0x8A, 0x90, 0x34, 0x24, 0x38, 0x01, 0x6B, 0x35, 0x24, 0x41, 0xFE,
+0x09, 0x79, 0xFE, 0x10, 0xF8, 0xC1, 0x1C, 0x65, 0x01, 0x05, 0x66, 0x05, 0x19, 0x66, 0xC0, 0x19, 0xC2, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC4,
+0x2D, 0xC0, 0x34, 0xC2, 0x3C, 0xC4, 0x01, 0xC0, 0x08, 0x01, 0x6F, 0x15, 0x10, 0xC1, 0x1C, 0x15, 0xC0, 0x24, 0xC0, 0x1C, 0x24, 0x29, 0x30, 0x38,
+0xC1, 0xA2, 0x67, 0x66, 0xC0, 0xAA, 0x33, 0xA7, 0x44, 0x10, 0x00, 0xA2, 0x67, 0x14, 0x19, 0xCF, 0x00, 0x05, 0xC0, 0x14, 0xC1, 0x19, 0xC0, 0x7F,
+0x19, 0xC1, 0x28, 0x19, 0x28, 0xC2, 0x19, 0x28, 0x19, 0x28, 0x20, 0x28, 0xC1, 0x19, 0x20, 0xC0, 0x19, 0xC9, 0x14, 0x19, 0x14, 0xC3, 0x19, 0xC0,
+0x14, 0x19, 0xC5, 0x14, 0xC2, 0x05, 0xC1, 0x14, 0xC8, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29,
+0x2D, 0x34, 0xC1, 0x28, 0xC2, 0x29, 0x0D, 0xC0, 0x0C, 0x34, 0x14, 0x05, 0xC0, 0x0D, 0xC1, 0xFE, 0xE8, 0x78, 0x14, 0xC0, 0x30, 0x3C, 0x14, 0x34,
+0x30, 0x14, 0x29, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x14, 0xA9, 0x33, 0x34, 0x14, 0x0D, 0xC1, 0x1D, 0x1C, 0x15, 0x98, 0xCD, 0x14, 0xAA, 0x33, 0x28,
+0x05, 0x3B, 0x0D, 0xC1, 0x24, 0xFE, 0xAA, 0x90, 0x0D, 0xC0, 0x03, 0xFE, 0x63, 0x30, 0x05, 0x34, 0x29, 0x05, 0xC0, 0x21, 0x01, 0x00, 0x25, 0x0D,
+0xC1, 0x1C, 0x38, 0x28, 0x00, 0xC0, 0x14, 0xC2, 0x19, 0xC2, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC4, 0x2D, 0xC0, 0x34, 0xC2, 0x3C, 0xC2, 0x01,
+0xC0, 0x3C, 0x01, 0xC0, 0x6B, 0x6E, 0x10, 0xC1, 0x6E, 0xC1, 0x1C, 0x24, 0x21, 0x24, 0x30, 0xC1, 0x35, 0x38, 0xC0, 0x6F, 0xC0, 0xA6, 0x55, 0xAA,
+0x33, 0xFE, 0xC7, 0x39, 0x92, 0xFF, 0x05, 0x14, 0x19, 0xD0, 0x28, 0x14, 0xC0, 0x05, 0x00, 0xC2, 0x05, 0x00, 0x05, 0xC0, 0x14, 0xC3, 0x19, 0xC1,
+0x28, 0xC0, 0x19, 0xC0, 0x28, 0xC8, 0x19, 0xC0, 0x28, 0xC1, 0x19, 0xC0, 0x28, 0x19, 0xC2, 0x14, 0x19, 0xC8, 0x14, 0xC2, 0x05, 0xC1, 0x14, 0xC8,
+0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29, 0x2D, 0x34, 0xC1, 0x2D, 0x28, 0xC1, 0x29, 0x0D, 0xC0,
+0xFE, 0x4A, 0xA0, 0x3C, 0x14, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0xE8, 0x70, 0xFE, 0x45, 0x29, 0xC0, 0x15, 0x24, 0xC3, 0x3A, 0x0D, 0xC0, 0xFE, 0xAB,
+0xA0, 0x21, 0x7E, 0x24, 0x21, 0x0D, 0xC1, 0x05, 0x29, 0x24, 0x15, 0x1C, 0x30, 0x24, 0x15, 0xFE, 0x09, 0x79, 0x0D, 0xC1, 0x30, 0xFE, 0x2F, 0xE8,
+0x0D, 0xC0, 0x2C, 0x15, 0x01, 0x1C, 0x30, 0x01, 0x34, 0x24, 0x1C, 0x28, 0x2A, 0x0D, 0xC1, 0x3C, 0x15, 0x00, 0xC0, 0x6E, 0x7F, 0xC1, 0x19, 0xC4,
+0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC2, 0x34, 0xC1, 0x3C, 0xC4, 0x01, 0xC2, 0x08, 0x6E, 0xC0, 0x10, 0xC1, 0x15, 0x1C, 0x21, 0x24,
+0xC0, 0x30, 0xC2, 0x7E, 0x3D, 0x38, 0x3D, 0x18, 0xAE, 0x11, 0x96, 0xDD, 0xFE, 0x00, 0x00, 0x05, 0x14, 0x19, 0xD1, 0xA7, 0x55, 0x10, 0x38, 0x3C,
+0x00, 0xCD, 0x05, 0xC4, 0x14, 0xC1, 0x19, 0xC6, 0x28, 0xC0, 0x19, 0xC0, 0x28, 0x19, 0x28, 0xC0, 0x2D, 0x3C, 0xC0, 0x19, 0xC3, 0x28, 0x19, 0xC2,
+0x14, 0xC5, 0x05, 0xC0, 0x14, 0xC4, 0x05, 0xC0, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29, 0x34,
+0x2D, 0xC0, 0x34, 0x2D, 0x28, 0xC1, 0x29, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0x9B, 0xAB, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0x06, 0x68, 0x24, 0x10,
+0x00, 0x20, 0xA9, 0x43, 0x34, 0x0C, 0x08, 0xFE, 0x6E, 0xD0, 0x0D, 0xC0, 0x2C, 0x1C, 0x14, 0x28, 0x3D, 0xFE, 0x88, 0x70, 0x1D, 0xA6, 0x33, 0xFE,
+0x67, 0x41, 0x19, 0xC0, 0x38, 0x1C, 0x19, 0x3C, 0x09, 0x2F, 0x0D, 0xC1, 0x25, 0x0D, 0xC1, 0x02, 0x08, 0x04, 0x01, 0x2D, 0xA6, 0x55, 0x38, 0x01,
+0x10, 0x38, 0x0F, 0x0D, 0xC1, 0x15, 0x38, 0x19, 0x9D, 0xAA, 0x6E, 0x14, 0x05, 0x14, 0x19, 0xC4, 0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D,
+0xC2, 0x34, 0xC1, 0x3C, 0xC5, 0x08, 0x01, 0x08, 0x6E, 0x08, 0x10, 0xC1, 0x1C, 0xC0, 0x15, 0x1C, 0xC0, 0x21, 0x7B, 0x30, 0xC1, 0x38, 0x04, 0x3D,
+0x04, 0xAC, 0x22, 0x65, 0x28, 0x00, 0x19, 0x14, 0x19, 0xD1, 0x08, 0x34, 0x24, 0x38, 0x34, 0x19, 0x20, 0x14, 0x19, 0x56, 0x00, 0x05, 0xC2, 0x00,
+0xD4, 0x14, 0x05, 0x00, 0x05, 0xC0, 0x19, 0x01, 0x10, 0xC0, 0x24, 0x10, 0x28, 0x19, 0x7E, 0x28, 0xC2, 0x19, 0xC0, 0x14, 0xC5, 0x05, 0xC0, 0x14,
+0xC6, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0xFE, 0x0A, 0x98, 0x0D, 0xC0, 0x29, 0x34, 0x2D, 0xC0, 0x34, 0x2D, 0x28,
+0xC1, 0x29, 0x0D, 0xC0, 0xFE, 0x4A, 0xA0, 0xFE, 0xC3, 0x18, 0x9B, 0xAB, 0x00, 0xC0, 0x0D, 0xC1, 0x1D, 0xFE, 0x45, 0x21, 0x10, 0x14, 0x20, 0xA8,
+0x44, 0x3C, 0x14, 0x3C, 0xFE, 0x6E, 0xD0, 0x0D, 0xC0, 0x27, 0x10, 0x14, 0x19, 0x30, 0x28, 0x14, 0x08, 0xA4, 0x65, 0x14, 0xC0, 0x24, 0x10, 0x11,
+0x20, 0x30, 0xFE, 0x47, 0x68, 0x0D, 0xC1, 0xA0, 0x35, 0x0D, 0xC0, 0xFE, 0x4C, 0xB8, 0x05, 0x20, 0xA9, 0x43, 0x19, 0x05, 0x3C, 0x24, 0x05, 0xC0,
+0x24, 0x3B, 0x0D, 0xC1, 0x3C, 0x01, 0x28, 0x00, 0x05, 0x14, 0x05, 0x14, 0x19, 0xC4, 0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC2, 0x34,
+0xC1, 0x3C, 0xC4, 0x01, 0x08, 0xC1, 0x6E, 0xC0, 0x10, 0xC0, 0x0D, 0x15, 0x1C, 0xC1, 0x21, 0x1C, 0x24, 0x30, 0xC0, 0x38, 0x04, 0xC0, 0x38, 0xA9,
+0x34, 0xA7, 0x54, 0x15, 0x00, 0xA2, 0x77, 0x19, 0xD3, 0x10, 0x34, 0x00, 0x3D, 0xAB, 0x33, 0x98, 0xCC, 0x3C, 0x15, 0xA2, 0x78, 0x35, 0x01, 0x19,
+0xC0, 0x28, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xC4, 0x00, 0xC8, 0x05, 0x28, 0x10, 0x01, 0x19, 0x05, 0xC0, 0x00, 0x01, 0x24, 0x15, 0x1C, 0x24, 0x01,
+0x28, 0xC4, 0x19, 0xC0, 0x14, 0xC5, 0x05, 0xC7, 0x14, 0x29, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0xFE, 0x0A, 0x98, 0x0D, 0xC0, 0x29,
+0x2D, 0x34, 0xC1, 0x2D, 0xC2, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0x0C, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0x29, 0x79, 0x1C, 0xC0, 0xA2, 0x76,
+0x30, 0x15, 0x1C, 0x30, 0x24, 0x3A, 0x0D, 0xC0, 0x27, 0x24, 0x29, 0x24, 0xC6, 0x30, 0xC0, 0x1C, 0x24, 0x29, 0xFE, 0x09, 0x79, 0x0D, 0xC4, 0xFE,
+0x27, 0x51, 0x10, 0x15, 0xA3, 0x77, 0x15, 0x10, 0x24, 0x38, 0x08, 0x34, 0x29, 0xFE, 0xE8, 0x70, 0x0D, 0xC6, 0xFE, 0x06, 0x68, 0xFE, 0x41, 0x08,
+0xC0, 0x6E, 0xC4, 0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC2, 0x34, 0xC1, 0x7E, 0xC2, 0x01, 0xC2, 0x08, 0xC1, 0x10, 0x5A, 0x10, 0xC0,
+0x15, 0xC1, 0x1C, 0x24, 0xC1, 0x30, 0xC0, 0x38, 0xC1, 0x20, 0xAB, 0x23, 0x94, 0xEE, 0x00, 0x0C, 0x14, 0x19, 0xC1, 0x28, 0xC0, 0x19, 0xC0, 0x28,
+0xC1, 0x19, 0xC9, 0xA5, 0x66, 0x3C, 0x19, 0x10, 0xAA, 0x33, 0xA2, 0x77, 0x24, 0x30, 0x04, 0xA6, 0x55, 0xA6, 0x54, 0x38, 0x28, 0x3C, 0x39, 0x2D,
+0x6B, 0x3C, 0x39, 0x2D, 0x52, 0xC0, 0x28, 0x20, 0x28, 0x19, 0xC0, 0x6F, 0x28, 0xC1, 0x14, 0xC0, 0x51, 0xC0, 0x10, 0x38, 0x15, 0x10, 0xC0, 0x2D,
+0x19, 0x00, 0x6E, 0x01, 0x10, 0x56, 0x10, 0x08, 0x2D, 0x20, 0x28, 0xC2, 0x20, 0x19, 0xC0, 0x14, 0xC4, 0x05, 0xC6, 0x14, 0x19, 0xFE, 0x0D, 0xD0,
+0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC1, 0x3F, 0x0D, 0xC0, 0x29, 0x2D, 0x34, 0xC1, 0x2D, 0xC2, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x34,
+0x0C, 0x05, 0xC0, 0x0D, 0xC1, 0xFE, 0x29, 0x79, 0x05, 0xC0, 0x30, 0x10, 0x00, 0x28, 0xA8, 0x44, 0x28, 0x29, 0x0D, 0xC0, 0x3F, 0x14, 0x38, 0x10,
+0x05, 0x34, 0x04, 0x28, 0x14, 0x24, 0x38, 0x14, 0x28, 0x3D, 0x10, 0x14, 0x3B, 0x0D, 0xC3, 0x33, 0x2D, 0x3D, 0x10, 0x28, 0x10, 0x04, 0x3C, 0xC0,
+0x38, 0x30, 0x08, 0xFE, 0xE8, 0x70, 0x0D, 0xC6, 0xFE, 0x26, 0x68, 0x14, 0xC0, 0x6E, 0xC4, 0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC2,
+0x34, 0xC1, 0x3C, 0xC2, 0x01, 0xC0, 0x3C, 0xC0, 0x08, 0x6E, 0xC1, 0x08, 0x10, 0x1C, 0xC3, 0x24, 0xC1, 0xA2, 0x67, 0xC1, 0x38, 0xA2, 0x77, 0xAC,
+0x12, 0x9A, 0xCB, 0x14, 0x55, 0x19, 0xC5, 0x28, 0x19, 0x28, 0xC1, 0x19, 0xC2, 0x28, 0x19, 0xC4, 0xA4, 0x66, 0x28, 0xC0, 0x2D, 0x14, 0x2D, 0xA2,
+0x78, 0x3C, 0x2D, 0x28, 0xAF, 0x00, 0xA5, 0x66, 0x97, 0xCC, 0x3D, 0x0D, 0x28, 0x21, 0x04, 0x18, 0xA4, 0x66, 0x38, 0x9A, 0xAB, 0x34, 0x3C, 0x34,
+0xC0, 0x01, 0x3D, 0x0C, 0xA4, 0x66, 0x56, 0x39, 0x3C, 0x19, 0x9D, 0xAA, 0xAB, 0x23, 0x18, 0x3C, 0x01, 0x15, 0x3C, 0x14, 0x00, 0x05, 0x28, 0x3C,
+0xC1, 0x01, 0x52, 0x20, 0x28, 0xC3, 0x19, 0xC0, 0x14, 0xC3, 0x05, 0xC5, 0x14, 0xC0, 0x19, 0xC0, 0x29, 0xA0, 0xDB, 0xC7, 0x29, 0x34, 0x2D, 0xC5,
+0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x34, 0x05, 0xC1, 0x0D, 0xC1, 0xFE, 0x29, 0x79, 0x20, 0xC0, 0xA8, 0x43, 0x15, 0x9A, 0xBB, 0x2D, 0x35, 0x34,
+0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x14, 0x30, 0x10, 0x14, 0x28, 0x38, 0x28, 0x14, 0x10, 0xA3, 0x66, 0x14, 0xC0, 0x30, 0x08, 0x14,
+0x2F, 0x0D, 0xC4, 0x1D, 0x30, 0x3C, 0x9B, 0xAB, 0x28, 0x30, 0x14, 0x05, 0x10, 0x1C, 0x05, 0x1D, 0x0D, 0xC6, 0x1D, 0x14, 0xC0, 0x19, 0xC3, 0x28,
+0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0xC4, 0x01, 0xC1, 0x08, 0x6E, 0x10, 0xC1, 0x15, 0xC1, 0x24, 0x1C, 0x21, 0xC0,
+0x30, 0x38, 0x30, 0x38, 0x6F, 0xA8, 0x44, 0xA4, 0x66, 0xFE, 0xC3, 0x18, 0x00, 0xA2, 0x76, 0x19, 0xC2, 0x28, 0x19, 0xC1, 0x28, 0xC0, 0x19, 0x28,
+0xC0, 0x19, 0x28, 0x19, 0x28, 0xC1, 0x19, 0x28, 0x19, 0xC0, 0x66, 0x05, 0x14, 0x2D, 0xC0, 0x34, 0x10, 0x3C, 0x01, 0x28, 0x19, 0x38, 0xA3, 0x66,
+0x6F, 0x24, 0x41, 0x24, 0xC0, 0x29, 0x2C, 0xA8, 0x44, 0x97, 0xDC, 0x35, 0x29, 0x25, 0xA2, 0x87, 0x30, 0x1C, 0xC0, 0x30, 0x11, 0x24, 0x3D, 0x15,
+0x00, 0x15, 0xA5, 0x66, 0x3C, 0x01, 0x15, 0x3C, 0x14, 0x00, 0x05, 0x19, 0x2D, 0xC1, 0x3C, 0x2D, 0x28, 0x2D, 0xC1, 0x28, 0xC0, 0x19, 0xC0, 0x14,
+0xC3, 0x05, 0xC5, 0x14, 0x19, 0x28, 0x19, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC7, 0x2E, 0x34, 0xC3, 0x2D, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0,
+0x34, 0x05, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0xC8, 0x70, 0xFE, 0x65, 0x29, 0x35, 0x15, 0x1C, 0x38, 0x29, 0x15, 0x24, 0xFE, 0x6E, 0xD0, 0x0D, 0xC0,
+0xFE, 0xEB, 0xA0, 0x30, 0x21, 0x24, 0x30, 0x29, 0x24, 0x29, 0xC1, 0x24, 0x29, 0xC2, 0x24, 0xFE, 0x29, 0x79, 0x0D, 0xC1, 0x3F, 0x0D, 0xC0, 0x3A,
+0x29, 0xC0, 0x15, 0x24, 0x38, 0x1C, 0x10, 0x24, 0x30, 0x3C, 0x2A, 0x0D, 0xC1, 0x34, 0x30, 0x95, 0xED, 0xC0, 0x05, 0xC0, 0x14, 0x6E, 0xC4, 0x28,
+0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0xC4, 0x01, 0xC1, 0x6F, 0x10, 0xC3, 0x1C, 0x15, 0x1C, 0xC0, 0x21, 0x24, 0x30,
+0x38, 0x35, 0x30, 0xA6, 0x55, 0xA9, 0x43, 0x35, 0x00, 0x14, 0xC0, 0x19, 0xC3, 0x28, 0xC3, 0x19, 0xC2, 0x28, 0xC2, 0x19, 0xC0, 0x28, 0x19, 0xC0,
+0x14, 0x05, 0x00, 0x14, 0x34, 0x3C, 0x08, 0x3C, 0x01, 0x39, 0x34, 0x28, 0xC0, 0x2D, 0x10, 0x1D, 0x24, 0x28, 0x34, 0x14, 0x24, 0xA3, 0x67, 0x29,
+0xC0, 0x98, 0xCD, 0x10, 0x0C, 0x3C, 0xC0, 0x28, 0xC0, 0x35, 0x2C, 0x38, 0x00, 0x08, 0xA8, 0x43, 0x08, 0x3C, 0x15, 0x2D, 0x05, 0x00, 0x05, 0x19,
+0x28, 0xC2, 0x2D, 0x28, 0x2D, 0xC1, 0x28, 0xC0, 0x19, 0xC0, 0x14, 0xC3, 0x05, 0xC4, 0x14, 0xC0, 0x19, 0xC1, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC6,
+0x03, 0xFE, 0x68, 0x80, 0x34, 0xC3, 0x2D, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x34, 0x05, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0x06, 0x68, 0x10,
+0xA3, 0x66, 0x00, 0xC0, 0x30, 0x08, 0x00, 0x2D, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xFE, 0xAB, 0xA0, 0x29, 0x00, 0x14, 0xAB, 0x23, 0x08, 0x00, 0x3C,
+0x04, 0x20, 0x05, 0x29, 0x30, 0x05, 0x20, 0x04, 0x3B, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x0D, 0xC1, 0xFE, 0x44, 0x48, 0x2D, 0x04, 0x10, 0x28, 0x15,
+0x04, 0x3C, 0x6E, 0x38, 0xFE, 0x29, 0x79, 0x0D, 0xC1, 0x29, 0xC0, 0x05, 0x00, 0x05, 0xC1, 0x14, 0x6E, 0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28,
+0xC2, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0xC4, 0x01, 0xC1, 0x08, 0x6E, 0xC0, 0x10, 0xC0, 0x15, 0x1C, 0x15, 0x1C, 0x24, 0xC0, 0x30, 0x24, 0x35, 0x30,
+0x04, 0xAD, 0x11, 0x2C, 0x05, 0x14, 0x19, 0xC0, 0x20, 0x19, 0xC1, 0x28, 0xC0, 0x19, 0xC0, 0x14, 0x05, 0xC0, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x28,
+0xC2, 0x19, 0xC1, 0x38, 0x24, 0x9D, 0x99, 0x3C, 0x08, 0x3C, 0x01, 0xC0, 0x10, 0x3C, 0x34, 0x3C, 0x08, 0x01, 0x0D, 0x0C, 0x30, 0x01, 0x0D, 0x2D,
+0x20, 0x39, 0x2D, 0x08, 0x34, 0x08, 0x0C, 0x01, 0xC0, 0x3C, 0xC0, 0x38, 0x1D, 0x38, 0x00, 0x2D, 0x24, 0x2D, 0x28, 0x2D, 0x14, 0x00, 0xC0, 0x05,
+0x14, 0x19, 0x20, 0xC0, 0x28, 0xC0, 0x2D, 0xC2, 0x28, 0xC1, 0x19, 0xC0, 0x14, 0xC2, 0x05, 0xC4, 0x14, 0x19, 0x28, 0x19, 0xC0, 0xFE, 0x0D, 0xD0,
+0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC0, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x34, 0xC3, 0x2D, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x2D,
+0x05, 0x00, 0xC0, 0x0D, 0xC1, 0x2A, 0x1C, 0x30, 0x28, 0xC0, 0xA8, 0x44, 0x1C, 0x19, 0x01, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0x27, 0x30, 0x19, 0x6F,
+0x38, 0xFE, 0x8B, 0xA0, 0x9D, 0xAA, 0x11, 0xFE, 0x68, 0x59, 0x28, 0x14, 0x24, 0x6E, 0x14, 0x20, 0x3D, 0x3B, 0x0D, 0xC1, 0x19, 0x33, 0x0D, 0xC0,
+0x12, 0x14, 0x38, 0x2D, 0x14, 0x34, 0x30, 0x14, 0x05, 0x1C, 0xFE, 0xC8, 0x70, 0x0D, 0xC1, 0x08, 0x14, 0x05, 0x66, 0x05, 0x14, 0xC1, 0x19, 0xC3,
+0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0xC4, 0x01, 0xC0, 0x08, 0x01, 0x08, 0x7E, 0x15, 0xC0, 0x10, 0x15, 0xC0,
+0x21, 0x24, 0xC0, 0x29, 0x30, 0xC1, 0xAB, 0x22, 0x7F, 0xFE, 0x82, 0x10, 0x05, 0xA2, 0x77, 0xC0, 0x20, 0x28, 0x19, 0xC0, 0x28, 0xC0, 0x19, 0x05,
+0x00, 0xC1, 0x05, 0xC2, 0x00, 0xC1, 0x14, 0x2D, 0x28, 0x19, 0x28, 0xC0, 0xFE, 0x2D, 0x63, 0x65, 0x56, 0x65, 0x41, 0x09, 0x08, 0x9D, 0xA9, 0x2D,
+0xC1, 0x39, 0x08, 0xC1, 0xA6, 0x55, 0x29, 0x01, 0x10, 0x2D, 0x34, 0x08, 0x01, 0x10, 0x28, 0x08, 0xA8, 0x43, 0x08, 0x01, 0x34, 0xC0, 0x35, 0x18,
+0x38, 0x95, 0xDD, 0x00, 0xC4, 0x05, 0x14, 0xC3, 0x19, 0xC0, 0x28, 0x2D, 0xC2, 0x28, 0xC1, 0x19, 0xC0, 0x14, 0xC2, 0x05, 0xC3, 0x14, 0x19, 0x28,
+0xC1, 0x19, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC0, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x34, 0xC3, 0x2D, 0xC1, 0x2E, 0x0D, 0xC0,
+0xFE, 0x6A, 0xA0, 0x28, 0x05, 0x00, 0xC0, 0x0D, 0xC1, 0xFE, 0x49, 0x79, 0x15, 0x10, 0xA4, 0x66, 0xC0, 0x10, 0x15, 0x38, 0x55, 0x3A, 0x0D, 0xC0,
+0x22, 0x15, 0x35, 0x38, 0x15, 0x0D, 0xC1, 0xFE, 0xE8, 0x78, 0x29, 0x6B, 0x24, 0xC0, 0x30, 0x29, 0x24, 0xFE, 0x09, 0x79, 0x0D, 0xC1, 0x29, 0xFE,
+0xEB, 0x98, 0x0D, 0xC1, 0xFE, 0x46, 0x41, 0xA1, 0x46, 0xC0, 0x21, 0x29, 0x38, 0x9D, 0x9A, 0x01, 0x30, 0x14, 0x0D, 0xC1, 0x2D, 0x9D, 0xAA, 0x5A,
+0x00, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0xC2, 0x2D, 0xC3, 0x6B, 0xC0, 0x7E, 0xC4, 0x01, 0xC1, 0x6B, 0xC1,
+0x10, 0x15, 0x10, 0x15, 0x1C, 0xC0, 0x24, 0xC0, 0x29, 0x35, 0x24, 0x2C, 0xA8, 0x44, 0x10, 0x05, 0x19, 0xC0, 0x20, 0xC0, 0x28, 0x19, 0xC0, 0x2D,
+0x14, 0x00, 0xC1, 0x14, 0x10, 0x51, 0x19, 0x14, 0x19, 0x14, 0x00, 0xC1, 0x05, 0x2D, 0xC0, 0x19, 0x28, 0xFE, 0x4D, 0x63, 0xC0, 0x7F, 0x66, 0xC0,
+0x9D, 0x99, 0x38, 0x3C, 0x2D, 0xC0, 0x19, 0x2D, 0x08, 0x7E, 0xC0, 0x30, 0x1C, 0x3C, 0xA2, 0x67, 0x65, 0x39, 0x01, 0xC0, 0x10, 0x34, 0xC0, 0x24,
+0x2D, 0xC0, 0x34, 0xC0, 0x1C, 0x24, 0x01, 0x05, 0x6B, 0x11, 0x14, 0xC0, 0x20, 0x3C, 0x29, 0xC0, 0x99, 0xCC, 0x14, 0xC3, 0x28, 0x34, 0xC1, 0x2D,
+0xC0, 0x28, 0x19, 0xC1, 0x14, 0xC2, 0x05, 0x14, 0xC0, 0x05, 0x14, 0xC0, 0x19, 0xC3, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00,
+0xC0, 0x05, 0xC0, 0x14, 0x28, 0x2D, 0x3C, 0xC1, 0x34, 0xC0, 0x2D, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x2D, 0x05, 0x00, 0x05, 0x0D, 0xC1,
+0xFE, 0x29, 0x79, 0x14, 0x00, 0x15, 0x24, 0x00, 0xC0, 0xAC, 0x22, 0x3C, 0x29, 0x0D, 0xC0, 0xFE, 0x0A, 0x98, 0x00, 0x24, 0xC0, 0x00, 0x0D, 0xC1,
+0xFE, 0x06, 0x68, 0x01, 0x38, 0x05, 0xC0, 0xAA, 0x33, 0x24, 0x00, 0xFE, 0x47, 0x70, 0x0D, 0xC1, 0x08, 0x38, 0xFE, 0x0F, 0xE8, 0x0D, 0xC0, 0x22,
+0x14, 0x34, 0xA9, 0x43, 0x01, 0x9D, 0x9A, 0x24, 0x3D, 0x01, 0xFE, 0xC8, 0x70, 0x0D, 0xC1, 0x30, 0x1C, 0x05, 0x66, 0x14, 0x05, 0xC0, 0x14, 0x6E,
+0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0xC0, 0x28, 0xC0, 0x2D, 0xC0, 0x34, 0xC0, 0x39, 0xC0, 0x3C, 0xC4, 0x01, 0x08, 0xC3, 0x10, 0xC0,
+0x15, 0xC0, 0x21, 0xC0, 0x24, 0x29, 0x30, 0x29, 0x3D, 0xAC, 0x22, 0x97, 0xDD, 0x05, 0x14, 0x19, 0xC1, 0x28, 0xC0, 0x19, 0x28, 0xC0, 0x00, 0xC2,
+0x38, 0xA9, 0x34, 0x10, 0x99, 0xBC, 0x00, 0x05, 0x19, 0xC0, 0x05, 0x00, 0xC0, 0xA2, 0x77, 0x2D, 0x28, 0x19, 0xB0, 0x01, 0xA4, 0x66, 0x7E, 0x28,
+0x7F, 0x6E, 0x9D, 0x99, 0x9C, 0xBA, 0x9C, 0xAA, 0x38, 0x29, 0x21, 0x10, 0x5A, 0x39, 0x9D, 0xAA, 0x14, 0x6E, 0x25, 0x7A, 0x2D, 0x7F, 0x01, 0x08,
+0x28, 0x05, 0x14, 0x28, 0x3C, 0xC1, 0x28, 0x20, 0xA2, 0x77, 0x1C, 0x24, 0x6F, 0x3D, 0x04, 0xA5, 0x65, 0xA6, 0x45, 0x66, 0x34, 0x0C, 0x29, 0x08,
+0x3C, 0x19, 0xC0, 0xA2, 0x77, 0x3C, 0xC1, 0x2D, 0x66, 0xC1, 0x19, 0xC0, 0x14, 0xC1, 0x05, 0xC0, 0x14, 0xC0, 0x05, 0x14, 0x28, 0xC0, 0x19, 0xC2,
+0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0xFE, 0x00, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x28, 0x2D, 0x3C, 0xC0, 0x56, 0xC2, 0x2D, 0xC0,
+0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x2D, 0x00, 0xC1, 0x0D, 0xC1, 0x1E, 0x01, 0x2D, 0x24, 0x30, 0x2D, 0x3C, 0xA6, 0x55, 0x15, 0x29, 0x0D, 0xC0,
+0xFE, 0x4A, 0xA0, 0x28, 0xA7, 0x44, 0x30, 0x28, 0x0D, 0xC1, 0xFE, 0x47, 0x68, 0x10, 0x38, 0x28, 0x19, 0x24, 0xC0, 0x19, 0x2A, 0x0D, 0xC1, 0x10,
+0x30, 0xFE, 0x29, 0x90, 0x0D, 0xC0, 0x03, 0xFE, 0x43, 0x28, 0x20, 0x38, 0x28, 0x14, 0x01, 0x29, 0x14, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x08, 0x38,
+0x00, 0xC0, 0x05, 0xC1, 0x14, 0x19, 0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0xC3, 0x34, 0xC1, 0x39, 0xC0, 0x3C, 0xC4, 0x01, 0x08, 0xC1,
+0x01, 0x08, 0x10, 0xC0, 0x15, 0xC0, 0x1C, 0x21, 0x24, 0xC0, 0x29, 0x30, 0xA9, 0x33, 0x7F, 0x28, 0x9D, 0x99, 0x19, 0xC2, 0x28, 0x19, 0xC0, 0x2D,
+0x9D, 0xAA, 0x00, 0xC1, 0x28, 0x3D, 0x2D, 0x00, 0xC3, 0x14, 0x19, 0x00, 0xC1, 0x28, 0x2D, 0x19, 0x28, 0x08, 0x15, 0x24, 0x3D, 0x18, 0x2C, 0x7E,
+0x2C, 0xC0, 0xA2, 0x77, 0xC0, 0x18, 0x21, 0x3C, 0x28, 0xC0, 0x3C, 0x01, 0x10, 0x3C, 0x56, 0x25, 0x20, 0x14, 0x20, 0x15, 0xA5, 0x66, 0x2C, 0x65,
+0x04, 0x30, 0x09, 0xA4, 0x76, 0xA2, 0x77, 0x6F, 0x7E, 0xA2, 0x67, 0x66, 0xA2, 0x77, 0x7E, 0x3C, 0xC0, 0x04, 0x51, 0x08, 0x0C, 0x97, 0xCC, 0x19,
+0x2D, 0x6B, 0x7E, 0xC0, 0x34, 0xC0, 0x2D, 0x66, 0x19, 0xC0, 0x66, 0xC2, 0x05, 0xC0, 0x14, 0x19, 0x28, 0xC0, 0x19, 0xC3, 0xFE, 0x0D, 0xD0, 0x0D,
+0xC0, 0xFE, 0x09, 0x98, 0xFE, 0x00, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x28, 0x2D, 0x3C, 0xC2, 0x34, 0x2D, 0xC1, 0xFE, 0x2D, 0xD0, 0x0D, 0xC0, 0xFE,
+0x6A, 0xA0, 0x28, 0x00, 0xC1, 0x0D, 0xC1, 0x3B, 0x24, 0x0C, 0x10, 0x01, 0x3D, 0x66, 0x01, 0x15, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xFE, 0xEB, 0xA0,
+0xFE, 0xA7, 0x31, 0x10, 0xC0, 0x04, 0x0D, 0xC1, 0xFE, 0x6A, 0x81, 0x24, 0x10, 0x38, 0x04, 0x9C, 0xAA, 0x24, 0x3D, 0xFE, 0x29, 0x79, 0x0D, 0xC1,
+0xFE, 0x65, 0x29, 0x1C, 0x38, 0xFE, 0x2F, 0xE8, 0x0D, 0xC0, 0xFE, 0xEA, 0x98, 0xFE, 0x86, 0x29, 0x66, 0x24, 0x1C, 0x24, 0x3D, 0x1C, 0x3B, 0x0D,
+0xC1, 0x34, 0x29, 0x00, 0xC1, 0x6E, 0x14, 0xC0, 0x6E, 0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x6E, 0xC3, 0x34, 0xC1, 0x39, 0xC0, 0x3C, 0xC4,
+0x01, 0x6B, 0xC3, 0x10, 0xC1, 0x15, 0xC0, 0x1C, 0xC0, 0x24, 0xC0, 0xA7, 0x34, 0xA7, 0x55, 0x15, 0x00, 0x19, 0xC1, 0x28, 0xC4, 0x05, 0x00, 0x05,
+0x00, 0x15, 0x10, 0x00, 0xC0, 0x14, 0x05, 0x00, 0xC1, 0x05, 0xC0, 0x00, 0x05, 0x28, 0x6E, 0x28, 0x2D, 0xC0, 0x28, 0xC2, 0x2D, 0x3C, 0x10, 0x21,
+0x30, 0x38, 0x04, 0x38, 0x30, 0x24, 0x29, 0x04, 0xC1, 0x38, 0x24, 0x08, 0x6E, 0x1C, 0x3D, 0xA4, 0x66, 0x7F, 0x6F, 0x34, 0x00, 0x6E, 0x7F, 0x69,
+0x00, 0x05, 0xC0, 0x00, 0x7E, 0xC0, 0x14, 0xA2, 0x77, 0x6E, 0xC0, 0x65, 0x9A, 0xBC, 0x15, 0x9B, 0xBB, 0x6E, 0xC0, 0x3C, 0xC2, 0x56, 0x2D, 0x28,
+0x19, 0xC0, 0x66, 0xC1, 0x55, 0xC0, 0x14, 0x19, 0x28, 0xC1, 0x19, 0xC3, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0xFE, 0x00, 0x00,
+0xC0, 0x05, 0xC0, 0x14, 0x28, 0x2D, 0x3C, 0xC2, 0x34, 0xC0, 0x2D, 0xC0, 0x2E, 0x0D, 0xC8, 0xFE, 0x06, 0x68, 0x2D, 0xA7, 0x55, 0x05, 0xC0, 0x24,
+0x15, 0x00, 0x14, 0xFE, 0x8E, 0xD0, 0x0D, 0xC8, 0xFE, 0x6A, 0x81, 0x28, 0x00, 0x10, 0x38, 0x00, 0xC0, 0x38, 0xFE, 0xC8, 0x70, 0x0D, 0xC1, 0x28,
+0x9C, 0xAA, 0x15, 0xFE, 0xEB, 0xA0, 0x0D, 0xC0, 0x4D, 0x10, 0x14, 0x3C, 0x09, 0x3C, 0x55, 0x30, 0x1E, 0x0D, 0xC7, 0xFE, 0x20, 0x00, 0x14, 0x19,
+0xC3, 0x28, 0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0x39, 0xC0, 0x3C, 0xC4, 0x01, 0x6B, 0xC0, 0x6E, 0xC1, 0x10, 0xC0, 0x15,
+0x1C, 0x15, 0x1C, 0x24, 0xC0, 0x38, 0xAB, 0x23, 0x25, 0xFE, 0x21, 0x00, 0x14, 0x19, 0xC1, 0x7F, 0xC4, 0x05, 0xC1, 0x00, 0x3C, 0x14, 0x00, 0x05,
+0x3C, 0x19, 0x00, 0xC2, 0x05, 0x00, 0x19, 0x28, 0x2D, 0x28, 0x15, 0xC1, 0x10, 0xC0, 0x59, 0x01, 0x3C, 0xC0, 0x39, 0x34, 0xC1, 0x3C, 0x08, 0xC0,
+0x01, 0x15, 0xC0, 0x0D, 0x10, 0x24, 0x5A, 0x7E, 0x30, 0x3D, 0x7F, 0x56, 0x09, 0xC0, 0xA2, 0x77, 0x7F, 0xC0, 0x20, 0x55, 0x18, 0xC0, 0x11, 0x0C,
+0x09, 0x38, 0xC0, 0x35, 0x15, 0x3C, 0x9D, 0xAA, 0x28, 0x3C, 0x01, 0x3C, 0x08, 0xC1, 0x3C, 0xC0, 0x28, 0x69, 0x19, 0xC0, 0x14, 0xC0, 0x05, 0x14,
+0xC0, 0x19, 0x28, 0xC1, 0x19, 0xC3, 0x14, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x28, 0x2D, 0x3C,
+0xC2, 0x34, 0xC2, 0x2E, 0x0D, 0xC8, 0x3B, 0x24, 0x04, 0x10, 0x3C, 0xA6, 0x55, 0x55, 0x3C, 0x08, 0xFE, 0x8E, 0xD0, 0x0D, 0xC8, 0xFE, 0x4A, 0x79,
+0x08, 0x28, 0xA6, 0x45, 0x3D, 0x28, 0xC0, 0x38, 0xFE, 0x09, 0x79, 0x0D, 0xC1, 0x3C, 0x19, 0x1C, 0xA2, 0xB8, 0xFE, 0x0F, 0xF0, 0x0D, 0xC0, 0xFE,
+0xAA, 0x90, 0xFE, 0x41, 0x08, 0x2D, 0x3D, 0x96, 0xDE, 0x14, 0xA6, 0x45, 0xFE, 0x09, 0x79, 0xFE, 0x10, 0xF8, 0xC7, 0x05, 0x7F, 0x19, 0xC3, 0x28,
+0xC2, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0xC3, 0x34, 0xC0, 0x3C, 0x39, 0xC0, 0x3C, 0xC4, 0x01, 0x08, 0xC0, 0x6E, 0xC1, 0x10, 0xC0, 0x1C, 0x69, 0x1C,
+0x24, 0xC0, 0x1C, 0xA9, 0x43, 0xA4, 0x66, 0x39, 0x9B, 0xBB, 0x20, 0x19, 0x28, 0xC0, 0x19, 0x28, 0xC3, 0x00, 0xC0, 0x05, 0xC0, 0x00, 0xC2, 0x28,
+0x14, 0x00, 0x05, 0xC0, 0x00, 0x05, 0xC0, 0x14, 0x19, 0x28, 0xC0, 0x24, 0xC3, 0x56, 0x24, 0xC1, 0x1C, 0xC2, 0x10, 0xC1, 0x08, 0xC1, 0x01, 0x3C,
+0xC0, 0x08, 0x01, 0xC0, 0x3C, 0xC6, 0x01, 0x3C, 0x56, 0x3C, 0xC0, 0x34, 0x2D, 0x28, 0xC2, 0x2D, 0x3C, 0x08, 0x10, 0xC2, 0x08, 0x01, 0x34, 0x28,
+0xC0, 0x19, 0x14, 0xC0, 0x05, 0x14, 0xC0, 0x19, 0xC1, 0x2D, 0x28, 0x19, 0xC5, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC0,
+0x05, 0x14, 0x19, 0x28, 0x2D, 0x3C, 0xC3, 0x34, 0xC1, 0xFE, 0x88, 0x80, 0x03, 0x0D, 0xC6, 0x2E, 0x09, 0x21, 0x9C, 0xBA, 0xA5, 0x55, 0x09, 0x3C,
+0x01, 0xA6, 0x56, 0x35, 0xFE, 0x89, 0x80, 0xFE, 0x0F, 0xF0, 0x0D, 0xC6, 0xA3, 0x03, 0x08, 0x21, 0x09, 0x21, 0x10, 0x35, 0x3D, 0x10, 0xFE, 0xE8,
+0x70, 0x0D, 0xC1, 0x29, 0x09, 0x21, 0x15, 0xFE, 0xEB, 0xA0, 0x0D, 0xC0, 0x3F, 0x30, 0xC0, 0x29, 0xC0, 0x1C, 0x30, 0xFE, 0x29, 0x79, 0x0D, 0xC7,
+0x14, 0xC0, 0x6E, 0xC4, 0x28, 0xC1, 0x0D, 0xC1, 0x2A, 0x28, 0x2D, 0xC2, 0x34, 0xC3, 0x39, 0x3C, 0xC2, 0x01, 0x3C, 0x01, 0x08, 0xC0, 0x6E, 0x10,
+0xC1, 0x15, 0xC0, 0x1C, 0x24, 0xC0, 0x1C, 0x04, 0xAA, 0x33, 0x30, 0x00, 0x14, 0x20, 0xC0, 0x7E, 0xC6, 0x9D, 0x99, 0x00, 0x05, 0xC0, 0x00, 0x05,
+0x00, 0x05, 0x28, 0x19, 0x14, 0xC0, 0x05, 0x00, 0x05, 0x14, 0xC1, 0x28, 0xC0, 0x3C, 0x08, 0x10, 0xC0, 0x15, 0xC0, 0x1C, 0x24, 0xCA, 0x21, 0x1C,
+0xC2, 0x15, 0xC0, 0x10, 0x08, 0x10, 0x08, 0xC1, 0x01, 0xC3, 0x3C, 0x01, 0x08, 0xC0, 0x10, 0xC6, 0x08, 0x3C, 0x34, 0x28, 0x20, 0x19, 0x14, 0x05,
+0xC0, 0x14, 0x19, 0x28, 0xC3, 0x2D, 0x28, 0x19, 0xC5, 0x14, 0xC0, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x3C, 0xC0, 0x34, 0xC0, 0x3C, 0x34,
+0xC1, 0x3C, 0xC1, 0x08, 0x2D, 0x00, 0xC1, 0x28, 0x14, 0xC0, 0xAA, 0x33, 0x2D, 0x05, 0x39, 0x38, 0x0C, 0x05, 0x29, 0x15, 0x05, 0x14, 0x04, 0x19,
+0x05, 0x08, 0x30, 0x05, 0xC0, 0x35, 0x08, 0x00, 0x28, 0x3D, 0x14, 0x00, 0x10, 0x30, 0x05, 0xC0, 0x3D, 0x01, 0x00, 0x2D, 0x04, 0x19, 0x00, 0x24,
+0xC0, 0x00, 0x14, 0x04, 0x0D, 0x05, 0x10, 0x04, 0x34, 0x2D, 0x3D, 0x04, 0x15, 0x38, 0x1C, 0x00, 0xC1, 0x14, 0xC1, 0x19, 0xC4, 0x28, 0xC6, 0x2D,
+0xC1, 0x34, 0xC0, 0x3C, 0xC0, 0x66, 0x39, 0xC0, 0x3C, 0xC2, 0x01, 0x3C, 0x01, 0x08, 0xC1, 0x10, 0xC1, 0x15, 0x10, 0x1C, 0x24, 0x21, 0x24, 0xAB,
+0x23, 0x9C, 0xAA, 0xFE, 0x41, 0x08, 0x0C, 0x19, 0x28, 0x20, 0x28, 0xC5, 0x2D, 0x19, 0x00, 0xC1, 0x05, 0xC1, 0x14, 0x19, 0x05, 0xC4, 0x14, 0x05,
+0x19, 0x28, 0x19, 0x14, 0xC0, 0x19, 0x20, 0x28, 0x2D, 0xC0, 0x34, 0x01, 0x10, 0xC2, 0x15, 0xC1, 0x1C, 0x21, 0xC0, 0x24, 0xC5, 0x1C, 0xC5, 0x15,
+0x1C, 0x15, 0x10, 0xC6, 0x08, 0x01, 0x3C, 0xC0, 0x2D, 0x28, 0x19, 0x14, 0x0C, 0xC0, 0x14, 0xC1, 0x19, 0x28, 0xC5, 0x2D, 0x28, 0x19, 0xC5, 0x14,
+0xC0, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x3C, 0xC2, 0x34, 0xC4, 0x3C, 0x08, 0x2D, 0x00, 0xC1, 0x20, 0x1C, 0x24, 0x3D, 0x29, 0x15, 0x29,
+0x38, 0x15, 0x10, 0x3D, 0x35, 0x0D, 0x1C, 0x3D, 0x1C, 0x01, 0x30, 0x38, 0x08, 0x01, 0x04, 0x29, 0x3C, 0x1C, 0xA5, 0x65, 0x10, 0x39, 0x29, 0x38,
+0x3C, 0xC0, 0x04, 0x24, 0x2D, 0x10, 0x04, 0x01, 0x28, 0x29, 0x38, 0x28, 0xC0, 0x3D, 0x15, 0x14, 0x34, 0x3D, 0x20, 0x14, 0x24, 0xC0, 0x05, 0x28,
+0x24, 0x00, 0xC1, 0x14, 0xC1, 0x19, 0xC4, 0x28, 0xC6, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC1, 0x39, 0xC0, 0x3C, 0xC4, 0x01, 0x08, 0xC0, 0x0D, 0x10,
+0xC2, 0x15, 0x1C, 0xC1, 0x2C, 0xA4, 0x66, 0x3C, 0x9B, 0xAB, 0x20, 0xC0, 0x28, 0xC9, 0x51, 0x00, 0xC2, 0x05, 0x00, 0xC0, 0x05, 0xC4, 0x14, 0x19,
+0xC1, 0x14, 0x2D, 0x28, 0x19, 0x14, 0xC2, 0x69, 0x14, 0xC0, 0x19, 0xC0, 0x20, 0x28, 0xC0, 0x2D, 0x34, 0x39, 0x3C, 0xC1, 0x01, 0x08, 0xC0, 0x10,
+0x08, 0xC0, 0x10, 0xC6, 0x08, 0x01, 0xC1, 0x3C, 0xC0, 0x34, 0x2D, 0xC0, 0x28, 0x20, 0x19, 0x14, 0xC4, 0x20, 0x28, 0xC0, 0x2D, 0x28, 0xC6, 0x2D,
+0x19, 0xC6, 0x14, 0xC0, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x34, 0x3C, 0xC1, 0x34, 0xC4, 0x3C, 0x01, 0x2D, 0x00, 0xC2, 0x38, 0xC0, 0x28,
+0x01, 0x18, 0x99, 0xBB, 0x2D, 0x29, 0xA3, 0x77, 0x39, 0x3C, 0x09, 0x29, 0x2D, 0x1C, 0x11, 0x08, 0x3C, 0x38, 0x04, 0x3C, 0x08, 0x0C, 0x24, 0x3C,
+0x24, 0x0C, 0x0D, 0x01, 0x04, 0x38, 0x08, 0x1C, 0x0C, 0x29, 0x08, 0x30, 0x09, 0x1C, 0x15, 0x38, 0x3D, 0x24, 0x29, 0x38, 0x29, 0x38, 0x35, 0x24,
+0x38, 0x3D, 0x01, 0xC0, 0x1C, 0x00, 0xC1, 0x05, 0x14, 0xC0, 0x19, 0xC4, 0x28, 0xC6, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC1, 0x39, 0xC0, 0x3C, 0xC4,
+0x01, 0x08, 0xC0, 0x10, 0xC3, 0x1C, 0xC1, 0x35, 0xAA, 0x43, 0x35, 0x95, 0xEE, 0x19, 0x20, 0xC2, 0x28, 0xC6, 0x2D, 0x28, 0x14, 0x05, 0x00, 0xC6,
+0x05, 0x14, 0x28, 0x2D, 0x19, 0x14, 0xC0, 0x19, 0x08, 0x10, 0x08, 0xC0, 0x3C, 0xC0, 0x2D, 0xC0, 0x28, 0xC0, 0x19, 0xC0, 0x14, 0xC0, 0x0C, 0x05,
+0x6F, 0x14, 0xC0, 0x11, 0x0C, 0x14, 0xC0, 0x19, 0x20, 0xC1, 0x19, 0x20, 0xC6, 0x19, 0xC0, 0x14, 0xC2, 0x0C, 0xC0, 0x14, 0x0C, 0x14, 0xC0, 0x20,
+0x28, 0xC0, 0x34, 0x3C, 0x34, 0x2D, 0x28, 0x2D, 0x20, 0x28, 0xC0, 0x2D, 0xC2, 0x28, 0x20, 0x28, 0x19, 0xC5, 0x14, 0xC0, 0x00, 0xC2, 0x05, 0x14,
+0x19, 0x28, 0x2D, 0x3C, 0xC1, 0x34, 0xC0, 0x3C, 0xC4, 0x01, 0x28, 0x00, 0xC2, 0x24, 0x10, 0x14, 0x19, 0x3D, 0x97, 0xCD, 0x14, 0x08, 0x30, 0x14,
+0xC0, 0x30, 0x08, 0x05, 0x20, 0x3D, 0x14, 0x05, 0x10, 0x30, 0x05, 0xC0, 0x38, 0x3C, 0x05, 0x2D, 0x3D, 0x11, 0x05, 0xA8, 0x45, 0x21, 0x05, 0xC0,
+0x04, 0x34, 0x05, 0x34, 0x04, 0x05, 0x00, 0x29, 0x1C, 0x00, 0x19, 0x09, 0x01, 0x05, 0x15, 0xA5, 0x66, 0x2D, 0x01, 0x0C, 0x04, 0x3C, 0x00, 0xC1,
+0x05, 0xC0, 0x14, 0x19, 0xC4, 0x28, 0xC6, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC9, 0x01, 0x08, 0xC2, 0x0D, 0x10, 0xC0, 0x15, 0x21, 0x1C, 0xA9, 0x43,
+0x6E, 0x19, 0x14, 0x19, 0xC0, 0x28, 0xCA, 0x2D, 0x28, 0x19, 0x14, 0xC4, 0x19, 0x28, 0x01, 0x10, 0x3C, 0x19, 0x14, 0x19, 0xC0, 0x28, 0x01, 0xC0,
+0x08, 0x10, 0xC3, 0x08, 0x01, 0x3C, 0xC3, 0x2D, 0xC1, 0x28, 0xC0, 0x20, 0xC1, 0x19, 0x14, 0xCD, 0x19, 0xC0, 0x20, 0x28, 0xC1, 0x6F, 0x3C, 0xC4,
+0x2D, 0x28, 0xC0, 0x2D, 0xC0, 0x28, 0xC0, 0x2D, 0x3C, 0x2D, 0x28, 0x2D, 0x28, 0xC0, 0x20, 0x19, 0xC6, 0x14, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28,
+0x34, 0x3C, 0xC1, 0x34, 0xC0, 0x3C, 0x34, 0xC2, 0x3C, 0x01, 0x28, 0x00, 0xC1, 0xA2, 0x76, 0x24, 0x38, 0x24, 0x29, 0x38, 0x29, 0x24, 0x35, 0xC0,
+0x21, 0x24, 0x38, 0x30, 0x15, 0x24, 0x04, 0x24, 0x10, 0x38, 0x3D, 0x15, 0x10, 0x3D, 0x29, 0x10, 0x24, 0x04, 0x15, 0x56, 0x35, 0x38, 0x0D, 0x10,
+0x04, 0x24, 0x01, 0x1C, 0x04, 0x01, 0x56, 0x38, 0x30, 0x2D, 0x39, 0x04, 0x10, 0x19, 0x08, 0x3D, 0x14, 0xC0, 0x29, 0x15, 0x00, 0x05, 0x00, 0xC0,
+0x05, 0x14, 0xC1, 0x19, 0xC2, 0x28, 0xC7, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC9, 0x01, 0x08, 0xC2, 0x10, 0x15, 0x10, 0x1C, 0x10, 0x38, 0xA9, 0x34,
+0x1C, 0x05, 0x19, 0xC0, 0x28, 0xCC, 0x2D, 0xC2, 0x3C, 0x08, 0x10, 0xC2, 0x08, 0x28, 0x51, 0xC0, 0x19, 0x28, 0x3C, 0x01, 0x08, 0x01, 0xC1, 0x3C,
+0x34, 0xC0, 0x2D, 0xC0, 0x28, 0xC0, 0x2D, 0x3C, 0x01, 0x10, 0x08, 0xC3, 0x01, 0xC1, 0x3C, 0x01, 0xC0, 0x3C, 0xCB, 0x01, 0xC0, 0x08, 0xC0, 0x01,
+0x3C, 0x34, 0xC1, 0x3C, 0xC0, 0x34, 0x28, 0xC1, 0x2D, 0x28, 0xC0, 0x2D, 0xC0, 0x3C, 0x34, 0x28, 0x3C, 0x28, 0xC1, 0x20, 0x19, 0xC6, 0x14, 0x00,
+0xC3, 0x05, 0x14, 0x28, 0x34, 0x3C, 0xC2, 0x34, 0x3C, 0x34, 0xC2, 0x3C, 0x01, 0x2D, 0x00, 0xC1, 0x14, 0x19, 0x28, 0x0C, 0x24, 0x14, 0x08, 0x1D,
+0x3C, 0x19, 0x38, 0x3D, 0x28, 0x39, 0xA9, 0x43, 0x1C, 0x28, 0x1C, 0x18, 0x3C, 0x28, 0x04, 0x3D, 0x2D, 0x01, 0x18, 0x1C, 0x2D, 0x24, 0x11, 0x01,
+0xC0, 0x09, 0x3D, 0x39, 0x10, 0x11, 0x24, 0x01, 0x38, 0x0C, 0x10, 0xC0, 0x09, 0x3D, 0x15, 0x35, 0x38, 0x29, 0x38, 0x66, 0x24, 0x38, 0xC0, 0x2D,
+0x05, 0x00, 0xC0, 0x05, 0x14, 0x19, 0x14, 0x19, 0xC2, 0x28, 0xC7, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC7, 0x01, 0xC2, 0x08, 0xC0, 0x0D, 0x10, 0xC0,
+0x15, 0xC0, 0x1C, 0xAA, 0x32, 0x51, 0x14, 0x19, 0xC1, 0x28, 0xCD, 0x2D, 0xC0, 0x28, 0xC0, 0x2D, 0x34, 0x2D, 0x28, 0x14, 0x56, 0xC0, 0x19, 0x20,
+0x28, 0x3C, 0x10, 0xC0, 0x34, 0x28, 0xC4, 0x2D, 0x34, 0x3C, 0xC1, 0x01, 0x08, 0x01, 0xC0, 0x3C, 0xC0, 0x2D, 0xC0, 0x28, 0x20, 0x28, 0x2D, 0x3C,
+0xC0, 0x10, 0x08, 0xC1, 0x01, 0x3C, 0x34, 0x2D, 0xC1, 0x3C, 0xC0, 0x01, 0xC0, 0x3C, 0xC0, 0x2D, 0x28, 0x19, 0x28, 0x34, 0x3C, 0x34, 0x28, 0x20,
+0x28, 0x34, 0xC0, 0x28, 0xC1, 0x34, 0x01, 0x34, 0x2D, 0x10, 0x2D, 0x28, 0x2D, 0x28, 0xC0, 0x19, 0xC5, 0x14, 0xC0, 0x00, 0xC3, 0x05, 0x14, 0x28,
+0x34, 0x3C, 0xC3, 0x34, 0xC1, 0x3C, 0xC1, 0x08, 0x2D, 0x00, 0xC1, 0x19, 0x28, 0x19, 0x38, 0x15, 0x14, 0x28, 0xAA, 0x33, 0x96, 0xCD, 0x14, 0x1C,
+0x29, 0x14, 0xC0, 0x04, 0x01, 0x14, 0x3C, 0x0C, 0x14, 0xC0, 0x24, 0x29, 0x14, 0xC0, 0x04, 0x3C, 0x9C, 0x9A, 0x3C, 0x04, 0x14, 0x11, 0x29, 0x1C,
+0x05, 0x14, 0x0C, 0x2D, 0x05, 0x01, 0x04, 0x05, 0xC0, 0x35, 0x1C, 0x00, 0x28, 0x0C, 0x2D, 0x14, 0x24, 0x04, 0x01, 0x24, 0x30, 0x00, 0xC1, 0x05,
+0x14, 0x19, 0x14, 0x19, 0xC2, 0x28, 0xC7, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC7, 0x01, 0xC2, 0x08, 0x01, 0x08, 0x0D, 0x15, 0xC0, 0x08, 0x04, 0xA7,
+0x54, 0x93, 0xEF, 0x9A, 0xBB, 0x19, 0x28, 0xD4, 0x20, 0x19, 0x0C, 0x14, 0x19, 0xC0, 0x28, 0x3C, 0x10, 0x15, 0x10, 0xC0, 0x28, 0x2D, 0x34, 0x3C,
+0xC0, 0x08, 0x10, 0xC2, 0x08, 0xC0, 0x01, 0x3C, 0x28, 0xC0, 0x20, 0x19, 0xC0, 0x28, 0x20, 0x28, 0x3C, 0x01, 0xC0, 0x3C, 0x01, 0x3C, 0xC0, 0x2D,
+0x28, 0x19, 0xC0, 0x20, 0x2D, 0x3C, 0x01, 0xC0, 0x3C, 0x34, 0x28, 0x19, 0x20, 0x28, 0x3C, 0x01, 0x3C, 0x2D, 0x20, 0x28, 0x34, 0x3C, 0x2D, 0x28,
+0xC0, 0x2D, 0x3C, 0x01, 0x34, 0x2D, 0x1C, 0x3C, 0x28, 0x3C, 0x28, 0x2D, 0x28, 0x19, 0xC5, 0x14, 0xC0, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x34,
+0x3C, 0xC3, 0x34, 0xC0, 0x3C, 0xC2, 0x08, 0x2D, 0x00, 0xC1, 0x14, 0x24, 0x38, 0x30, 0xC0, 0x29, 0x38, 0xC0, 0x29, 0xC0, 0x38, 0xC0, 0x29, 0xC0,
+0x38, 0x35, 0x24, 0x38, 0xC0, 0x24, 0xC0, 0x38, 0xC0, 0x24, 0xC0, 0x04, 0x30, 0x21, 0x30, 0x04, 0x21, 0x1C, 0x3D, 0x38, 0x15, 0x24, 0x04, 0x29,
+0x10, 0x30, 0x04, 0x10, 0x01, 0x3D, 0x38, 0x34, 0x3C, 0x09, 0x01, 0x19, 0x10, 0x38, 0x14, 0xC0, 0x1C, 0x05, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0xC0,
+0x19, 0xC2, 0x28, 0xC7, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC7, 0x01, 0xC1, 0x08, 0xC1, 0x10, 0xC0, 0x15, 0x0D, 0x15, 0xAA, 0x34, 0x9B, 0xBA, 0x93,
+0xEF, 0x20, 0x19, 0x28, 0xD3, 0x20, 0x19, 0xC0, 0x14, 0x19, 0x20, 0x2D, 0x01, 0x10, 0x1C, 0xC0, 0x10, 0x15, 0x10, 0x15, 0xC0, 0x10, 0x08, 0x10,
+0x08, 0x3C, 0x2D, 0x28, 0xC1, 0x20, 0x19, 0x20, 0x28, 0x2D, 0x34, 0x10, 0xC0, 0x08, 0xC0, 0x10, 0x3C, 0x34, 0x28, 0x20, 0x14, 0x19, 0x20, 0x28,
+0x34, 0x3C, 0x08, 0x10, 0x08, 0x2D, 0x20, 0xC1, 0x28, 0x34, 0x08, 0xC0, 0x3C, 0x28, 0x19, 0x28, 0x3C, 0x01, 0x3C, 0x28, 0xC0, 0x34, 0x2D, 0x6F,
+0x10, 0x34, 0x2D, 0x24, 0x08, 0x20, 0x08, 0x28, 0x2D, 0xC0, 0x19, 0x28, 0x19, 0xC4, 0x14, 0xC0, 0x51, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x34, 0x3C,
+0xC1, 0x34, 0x3C, 0x34, 0xC0, 0x3C, 0xC2, 0x08, 0x2D, 0x00, 0xC2, 0x24, 0x38, 0x05, 0x14, 0xAC, 0x22, 0x10, 0x14, 0x01, 0x0C, 0x20, 0x14, 0x38,
+0xC0, 0x14, 0x2D, 0xAA, 0x33, 0x08, 0x14, 0x1C, 0x0C, 0x28, 0x19, 0x04, 0x38, 0x19, 0x3C, 0x18, 0x08, 0x19, 0x24, 0x11, 0x2D, 0x39, 0x0C, 0x35,
+0x25, 0x10, 0x18, 0x10, 0x34, 0x3D, 0x0C, 0x01, 0x10, 0x0C, 0x38, 0x15, 0x38, 0x3D, 0x38, 0x3D, 0x29, 0x24, 0xC0, 0x05, 0x00, 0x05, 0xC1, 0x14,
+0xC0, 0x19, 0xC2, 0x28, 0xC7, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC7, 0x01, 0xC1, 0x08, 0xC0, 0x0D, 0xC0, 0x08, 0x10, 0x08, 0x0C, 0xA6, 0x55, 0x34,
+0x14, 0x20, 0x28, 0xD3, 0x20, 0x14, 0xC1, 0x20, 0x28, 0x34, 0xA2, 0x77, 0x10, 0xC0, 0x15, 0xC1, 0x10, 0x08, 0x01, 0x3C, 0x34, 0x28, 0xC4, 0x2D,
+0x34, 0x3C, 0xC0, 0x10, 0xC3, 0x3C, 0x2D, 0x28, 0x19, 0x14, 0xC0, 0x20, 0x28, 0x34, 0x08, 0x10, 0xC1, 0x3C, 0x2D, 0x28, 0x19, 0xC0, 0x28, 0x3C,
+0x08, 0x10, 0x08, 0x34, 0x20, 0x19, 0x28, 0x3C, 0x08, 0x3C, 0x28, 0x20, 0x28, 0x3C, 0xC1, 0x08, 0x34, 0x2D, 0x24, 0x10, 0x14, 0x10, 0x01, 0x20,
+0x3C, 0x28, 0xC0, 0x19, 0xC6, 0x14, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x2D, 0x3C, 0xC4, 0x34, 0xC0, 0x3C, 0xC1, 0x01, 0x34, 0x00, 0xC2, 0x15,
+0x38, 0x19, 0xC0, 0x38, 0x10, 0x19, 0x3C, 0x04, 0x20, 0x19, 0x30, 0xC0, 0x14, 0x20, 0x04, 0x3C, 0x14, 0x08, 0x04, 0x19, 0x14, 0x30, 0x24, 0x14,
+0x19, 0x04, 0x34, 0x14, 0x08, 0x04, 0x14, 0xC0, 0x38, 0x15, 0x14, 0x20, 0x09, 0x25, 0x14, 0x15, 0x38, 0x05, 0xC0, 0x38, 0x10, 0x00, 0x34, 0x0C,
+0x28, 0x19, 0x3D, 0x0C, 0x2D, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x14, 0x19, 0xC2, 0x20, 0x28, 0xC6, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC7, 0x01, 0xC1,
+0x08, 0xC0, 0x0D, 0x10, 0xC1, 0x15, 0xAA, 0x34, 0x3D, 0x14, 0x20, 0xC0, 0x28, 0xD2, 0x20, 0x19, 0x14, 0x19, 0xC0, 0x2D, 0x3C, 0x0D, 0x15, 0x10,
+0xC4, 0x28, 0x20, 0x28, 0xC0, 0x2D, 0x34, 0x3C, 0x01, 0x10, 0x15, 0xC2, 0x01, 0x3C, 0x34, 0x28, 0xC0, 0x14, 0xC0, 0x19, 0x20, 0x28, 0x3C, 0x10,
+0xC0, 0x15, 0x10, 0x08, 0x34, 0x28, 0x19, 0x14, 0x19, 0x34, 0x3C, 0x10, 0xC1, 0x3C, 0x28, 0x19, 0x14, 0x28, 0x10, 0xC0, 0x01, 0x28, 0x19, 0x28,
+0x3C, 0xC0, 0x34, 0x3C, 0x01, 0x34, 0xC0, 0x24, 0x15, 0x19, 0x10, 0x1C, 0x19, 0x08, 0x2D, 0x20, 0x28, 0x19, 0xC7, 0x9D, 0xAA, 0xC2, 0x05, 0x14,
+0xC0, 0x28, 0x34, 0x3C, 0xC3, 0x34, 0xC2, 0x3C, 0xC0, 0x01, 0x34, 0x00, 0xC1, 0x05, 0x15, 0x29, 0x3D, 0x04, 0x21, 0x29, 0x04, 0x38, 0x24, 0x38,
+0x3D, 0x38, 0x30, 0x38, 0xC0, 0x30, 0x38, 0xC6, 0x35, 0x38, 0xC0, 0x35, 0x29, 0x38, 0xC0, 0x29, 0x30, 0x04, 0x38, 0x24, 0x30, 0x09, 0x30, 0x24,
+0x35, 0x38, 0x15, 0x10, 0x09, 0x30, 0x39, 0x10, 0x0C, 0x3C, 0x14, 0x24, 0xC0, 0x97, 0xCD, 0x05, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0xC2,
+0x20, 0x28, 0xC6, 0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC6, 0x01, 0x3C, 0x01, 0x08, 0xC1, 0x10, 0xC1, 0x08, 0x09, 0xA4, 0x76, 0x28, 0x14, 0x28, 0xD2,
+0x20, 0x19, 0x14, 0xC1, 0x28, 0x6F, 0x3C, 0x0D, 0x10, 0xC6, 0x34, 0x3C, 0x08, 0x10, 0x15, 0xC0, 0x10, 0xC1, 0x08, 0x01, 0x2D, 0x28, 0x19, 0x20,
+0x19, 0x20, 0x2D, 0xC0, 0x3C, 0x10, 0xC1, 0x15, 0x08, 0x34, 0x28, 0x20, 0x14, 0xC0, 0x20, 0x2D, 0x01, 0x10, 0x1C, 0xC0, 0x3C, 0x28, 0x19, 0x14,
+0x20, 0x3C, 0x10, 0x15, 0x10, 0x28, 0x14, 0x20, 0x3C, 0x10, 0x01, 0x28, 0x34, 0x01, 0x3C, 0xC0, 0x24, 0x15, 0x20, 0x10, 0x35, 0x20, 0x3C, 0x10,
+0x20, 0x28, 0x20, 0x19, 0xC6, 0x14, 0x00, 0xC2, 0x05, 0x14, 0x19, 0x28, 0x34, 0x3C, 0xC3, 0x34, 0xC2, 0x3C, 0xC0, 0x01, 0x3C, 0x00, 0xC1, 0x14,
+0xC0, 0x00, 0x30, 0x38, 0x00, 0x19, 0x11, 0x3C, 0x00, 0x10, 0xA6, 0x55, 0x93, 0xEF, 0xC0, 0x38, 0x24, 0x05, 0x2D, 0x18, 0x3C, 0x05, 0x1C, 0xA5,
+0x65, 0x14, 0xC0, 0x0C, 0x21, 0x14, 0x3C, 0x0C, 0x3C, 0x14, 0x30, 0x04, 0x19, 0x28, 0x11, 0x24, 0x20, 0x10, 0x18, 0x34, 0x28, 0x3D, 0x09, 0x3C,
+0x10, 0x11, 0x30, 0x21, 0x3D, 0x38, 0xC0, 0x3D, 0x1C, 0x19, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0xC0, 0x19, 0xC2, 0x20, 0x28, 0xC5, 0x2D, 0xC2, 0x34,
+0xC0, 0x3C, 0xC6, 0x01, 0x3C, 0x08, 0xC3, 0x10, 0x0D, 0x24, 0xA9, 0x33, 0x24, 0x14, 0x20, 0x28, 0xD1, 0x19, 0xC0, 0x14, 0xC0, 0x20, 0x28, 0x3C,
+0x10, 0xC0, 0x15, 0xC0, 0x10, 0xC1, 0x15, 0xC1, 0x10, 0x15, 0x1C, 0x15, 0x10, 0x08, 0x01, 0x3C, 0x2D, 0x28, 0x20, 0xC1, 0x28, 0x2D, 0x3C, 0x08,
+0x15, 0x1C, 0x15, 0xC0, 0x10, 0x3C, 0x28, 0xC0, 0x14, 0xC1, 0x28, 0x3C, 0x08, 0x10, 0x15, 0x10, 0x3C, 0x2D, 0x20, 0x14, 0x19, 0x28, 0x08, 0x24,
+0x1C, 0x08, 0x28, 0x14, 0x19, 0x3C, 0x15, 0x10, 0x34, 0x28, 0x34, 0x01, 0x3C, 0xC0, 0x24, 0x1C, 0x20, 0x01, 0x09, 0x34, 0x20, 0x29, 0x20, 0x28,
+0xFE, 0x66, 0x58, 0x9F, 0xCA, 0x2A, 0x25, 0xC1, 0x5A, 0x25, 0xC0, 0xFE, 0x43, 0x28, 0x14, 0x05, 0x00, 0xC1, 0x05, 0xC0, 0x19, 0x28, 0xA1, 0xB9,
+0x3B, 0xC0, 0x36, 0xC4, 0x49, 0x3C, 0xC0, 0x01, 0x3C, 0x05, 0x00, 0xC0, 0x14, 0x2D, 0x1A, 0xA6, 0x65, 0xC0, 0x9A, 0x58, 0x34, 0x0C, 0x15, 0x9A,
+0xBB, 0xFE, 0xC8, 0x70, 0xA5, 0x45, 0x25, 0x36, 0x35, 0x30, 0x19, 0x2D, 0x11, 0x01, 0x19, 0xA4, 0xFA, 0x1E, 0x22, 0xC0, 0xA7, 0x33, 0x51, 0x22,
+0x2F, 0x2A, 0x98, 0xFD, 0x52, 0x15, 0xA3, 0x77, 0x14, 0x6E, 0x3D, 0x15, 0x14, 0xFE, 0x86, 0x60, 0xA7, 0x45, 0x97, 0xFE, 0x1D, 0x0F, 0xA2, 0x66,
+0x1D, 0xC0, 0xA9, 0x12, 0x9A, 0xDC, 0x9C, 0x36, 0x01, 0x0C, 0x95, 0xDD, 0x2D, 0x0C, 0x19, 0x9D, 0xAA, 0xC0, 0x6E, 0x2E, 0xFE, 0x27, 0x68, 0xC0,
+0x22, 0xC0, 0x7A, 0xC2, 0x1A, 0x28, 0xC3, 0x2D, 0xC0, 0x34, 0xC0, 0xFE, 0x86, 0x60, 0x2F, 0x36, 0xA1, 0x24, 0x3C, 0xC3, 0x01, 0xC1, 0x08, 0xC2,
+0x10, 0xC0, 0x08, 0x18, 0xA2, 0x76, 0x93, 0xEF, 0x19, 0x28, 0xD1, 0x19, 0x14, 0x19, 0xC0, 0x20, 0x2D, 0x3C, 0x10, 0xC1, 0x15, 0xC0, 0x10, 0x15,
+0xC1, 0x10, 0x15, 0xC0, 0x08, 0x3C, 0x34, 0x28, 0xC0, 0x20, 0xC0, 0x28, 0x2D, 0x3C, 0x01, 0x08, 0x15, 0xC0, 0x10, 0xC1, 0x3C, 0x2D, 0x28, 0x14,
+0xC1, 0x20, 0x28, 0x3C, 0x15, 0x1C, 0xC0, 0x10, 0x3C, 0x2D, 0x14, 0xC1, 0x28, 0x01, 0x15, 0x1C, 0x15, 0x3C, 0x19, 0x14, 0x19, 0x3C, 0x10, 0x1C,
+0x01, 0x20, 0x28, 0x3C, 0x10, 0x3C, 0x01, 0x24, 0x15, 0x28, 0x08, 0x11, 0x08, 0x14, 0xA9, 0x33, 0x01, 0x19, 0xFE, 0x6A, 0xA0, 0xFE, 0x10, 0xF8,
+0xC7, 0x03, 0x2E, 0x05, 0x00, 0xC0, 0x05, 0xC1, 0x19, 0xA1, 0xC9, 0x03, 0x0D, 0xC7, 0x11, 0x3C, 0x08, 0x3C, 0x05, 0x00, 0xC1, 0x15, 0xFE, 0x8E,
+0xD0, 0x0D, 0xC0, 0xFE, 0x0C, 0xA1, 0xFE, 0x86, 0x31, 0x1C, 0x24, 0x09, 0x0D, 0xC1, 0xFE, 0x4A, 0x79, 0x24, 0xC0, 0x3D, 0x38, 0x24, 0x30, 0x3D,
+0x3F, 0x0D, 0xC8, 0x30, 0xC0, 0x38, 0xC0, 0x35, 0x38, 0x35, 0x3F, 0x0D, 0xC7, 0x03, 0xFE, 0x26, 0x41, 0x0C, 0x2D, 0x19, 0x30, 0x2D, 0x00, 0xC0,
+0xA1, 0xC9, 0x03, 0x0D, 0xC7, 0xFE, 0x2A, 0x98, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0xFE, 0x2D, 0xD0, 0x0D, 0xC0, 0x11, 0x3C, 0xC3, 0x01, 0xC3,
+0x08, 0x10, 0xC0, 0x08, 0x1C, 0x39, 0x15, 0x14, 0x28, 0xD0, 0x20, 0x19, 0xC2, 0x28, 0x3C, 0x08, 0x6E, 0x10, 0x08, 0x0D, 0x10, 0xC2, 0x15, 0xC1,
+0x1C, 0x10, 0x20, 0x14, 0x19, 0x28, 0x2D, 0x3C, 0x08, 0x10, 0xC0, 0x1C, 0x24, 0x10, 0x08, 0x3C, 0x2D, 0x28, 0x14, 0xC0, 0x19, 0xC0, 0x28, 0x3C,
+0x10, 0x15, 0x1C, 0x24, 0x10, 0x3C, 0x28, 0x14, 0xC1, 0x19, 0x34, 0x15, 0x24, 0x1C, 0x01, 0x2D, 0x20, 0x51, 0x19, 0x34, 0x15, 0x1C, 0x08, 0x28,
+0x14, 0x28, 0x08, 0x10, 0x3C, 0x01, 0x1C, 0x10, 0x28, 0x3C, 0xA9, 0x33, 0x24, 0x0C, 0x24, 0x29, 0x14, 0x01, 0x2E, 0x9F, 0xEC, 0xC8, 0x1D, 0x05,
+0x00, 0xC1, 0x05, 0x14, 0x19, 0xFE, 0x67, 0x70, 0x0D, 0xC8, 0x2E, 0x3C, 0x01, 0x3C, 0x0C, 0x00, 0xC1, 0x3C, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xA2,
+0x34, 0x24, 0x96, 0xDD, 0x14, 0xAC, 0x22, 0x0D, 0xC1, 0x25, 0x00, 0xC0, 0x3D, 0x1C, 0x00, 0x2D, 0x0C, 0xFE, 0x0D, 0xD0, 0x0D, 0xC8, 0x28, 0x05,
+0x38, 0x3D, 0x05, 0x20, 0x18, 0xFE, 0x4E, 0xD0, 0x0D, 0xC8, 0xFE, 0x09, 0x79, 0x21, 0xA3, 0x77, 0xC0, 0x38, 0x19, 0x00, 0xC0, 0xFE, 0x06, 0x68,
+0x0D, 0xC8, 0x29, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC2, 0x08, 0x6E, 0x10, 0xC0, 0x08,
+0x0C, 0xA2, 0x77, 0x28, 0x19, 0x28, 0xD0, 0x19, 0x66, 0x19, 0x6B, 0x28, 0x3C, 0x0D, 0x08, 0x10, 0xC0, 0x0D, 0x10, 0xC1, 0x15, 0xC2, 0x1C, 0x08,
+0x28, 0x2D, 0x3C, 0x08, 0x10, 0x1C, 0xC0, 0x10, 0xC1, 0x01, 0x3C, 0x28, 0x19, 0x14, 0x19, 0x20, 0x28, 0x3C, 0x08, 0x10, 0x15, 0x1C, 0x15, 0x01,
+0x34, 0x28, 0x14, 0x56, 0x14, 0x20, 0x34, 0x10, 0x1C, 0x15, 0x10, 0x3C, 0x20, 0x0C, 0xC0, 0x19, 0x3C, 0x24, 0x1C, 0x08, 0x28, 0x14, 0xC0, 0x3C,
+0x15, 0x10, 0x34, 0x3C, 0x15, 0x10, 0x2D, 0x0D, 0xA6, 0x65, 0x24, 0x14, 0x10, 0x0C, 0x19, 0x2D, 0x10, 0x29, 0xA0, 0xDB, 0xC0, 0x49, 0x29, 0xC2,
+0x0D, 0xC1, 0x1D, 0x05, 0x66, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x2E, 0xC2, 0x9F, 0xCB, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0xC0, 0x14, 0x51,
+0xC1, 0x08, 0xFE, 0x8E, 0xD0, 0x0D, 0xC1, 0xFE, 0x48, 0x69, 0x3C, 0x10, 0x0C, 0x0D, 0xC1, 0xFE, 0x6A, 0x79, 0x9B, 0x06, 0x2D, 0xA8, 0x45, 0x30,
+0x28, 0x10, 0x0C, 0xFE, 0x6B, 0xA8, 0x29, 0x3F, 0x6E, 0x0D, 0xC1, 0xA1, 0x45, 0x29, 0x2E, 0x04, 0x3C, 0x19, 0x38, 0x3D, 0x19, 0x20, 0x0C, 0x3A,
+0x0D, 0xC0, 0xA2, 0x45, 0x29, 0xC0, 0x3F, 0xC0, 0x0D, 0xC1, 0xFE, 0x67, 0x70, 0x00, 0x10, 0x0C, 0x14, 0x00, 0xC1, 0xFE, 0x06, 0x68, 0x0D, 0xC1,
+0x29, 0xC2, 0xA0, 0xBA, 0x0D, 0xC0, 0x29, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC0, 0x08,
+0xC1, 0x6E, 0xC0, 0x08, 0x1C, 0xA9, 0x43, 0x1C, 0x19, 0x28, 0xCF, 0x20, 0x19, 0x20, 0x19, 0x20, 0x28, 0x3C, 0x10, 0xC0, 0x0D, 0x15, 0xC0, 0x10,
+0xC3, 0x1C, 0x15, 0x10, 0x9D, 0x9A, 0x14, 0x56, 0x15, 0x10, 0xC1, 0x08, 0x01, 0x3C, 0x2D, 0x28, 0x19, 0x14, 0x19, 0x28, 0x3C, 0x01, 0x10, 0xC0,
+0x15, 0xC0, 0x10, 0x3C, 0x2D, 0x20, 0x14, 0xC0, 0x19, 0x20, 0x28, 0x10, 0x1C, 0xC0, 0x15, 0x01, 0x28, 0x14, 0x0C, 0xC0, 0x20, 0x01, 0x1C, 0x24,
+0x08, 0x28, 0x14, 0xC0, 0x2D, 0x10, 0x1C, 0x01, 0x28, 0x34, 0x10, 0xC0, 0x39, 0x08, 0xA6, 0x55, 0x30, 0x14, 0x3C, 0xAA, 0x23, 0x01, 0x05, 0x24,
+0x28, 0x29, 0xA0, 0xDB, 0xC0, 0xFE, 0x4A, 0x98, 0x19, 0xC2, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x05, 0x66, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D, 0xC1,
+0x3C, 0xC2, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0xC0, 0x14, 0x00, 0xC1, 0x2D, 0x2E, 0x0D, 0xC1, 0xFE, 0x8B, 0xB0, 0xFE, 0xC7, 0x39, 0x38, 0x08,
+0x0D, 0xC1, 0xFE, 0xC8, 0x70, 0x3D, 0x0C, 0x1C, 0xC0, 0x0C, 0x38, 0x15, 0x38, 0x0C, 0x9D, 0x99, 0x1C, 0x0D, 0xC1, 0xFE, 0x09, 0x79, 0x0C, 0x38,
+0x24, 0x38, 0xA2, 0x67, 0x30, 0x29, 0x04, 0x3D, 0x29, 0x3F, 0x0D, 0xC0, 0xFE, 0xEB, 0xA0, 0x38, 0xC1, 0x3D, 0x0D, 0xC1, 0x14, 0x3C, 0x24, 0x04,
+0x28, 0x51, 0x51, 0xC0, 0x16, 0x0D, 0xC1, 0x19, 0xC2, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0x2E, 0x0D,
+0xC0, 0x11, 0x3C, 0xC3, 0x01, 0xC2, 0x08, 0x10, 0xC0, 0x5A, 0x0C, 0xA2, 0x77, 0x28, 0x19, 0x28, 0xCE, 0x56, 0x19, 0x14, 0x19, 0x28, 0x34, 0x3C,
+0x08, 0x10, 0x0D, 0x10, 0xC0, 0x0D, 0xC0, 0x15, 0x10, 0xC0, 0x15, 0x1C, 0x3C, 0x20, 0x14, 0xC0, 0x19, 0x08, 0x3C, 0xC0, 0x2D, 0x28, 0x19, 0x14,
+0xC0, 0x28, 0x34, 0x01, 0x08, 0x15, 0x1C, 0x15, 0x10, 0x08, 0x3C, 0x2D, 0x20, 0x14, 0xC0, 0x19, 0x28, 0x34, 0x08, 0x1C, 0xC1, 0x01, 0x2D, 0x19,
+0x14, 0x05, 0x14, 0x2D, 0x10, 0x1C, 0x15, 0x01, 0x28, 0x9D, 0x9A, 0x05, 0x20, 0x08, 0x24, 0x10, 0x28, 0x20, 0x34, 0x0D, 0x10, 0x01, 0x08, 0x38,
+0x55, 0x19, 0x3C, 0xAA, 0x33, 0x29, 0x00, 0x10, 0x1C, 0x14, 0x2E, 0x9F, 0xEC, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x25, 0x05, 0x00, 0xC1, 0x05,
+0x14, 0x19, 0x25, 0x0D, 0xC1, 0x3C, 0xC2, 0x11, 0x0D, 0xC0, 0x2E, 0x01, 0xC1, 0x14, 0x00, 0xC0, 0x05, 0x14, 0xFE, 0x0D, 0xD0, 0x0D, 0xC1, 0x49,
+0x38, 0x10, 0x05, 0x0D, 0xC1, 0xFE, 0x06, 0x68, 0x15, 0x3D, 0x05, 0xC0, 0xAD, 0x22, 0x01, 0x99, 0xCC, 0x2D, 0x0C, 0x14, 0x00, 0x0D, 0xC1, 0xFE,
+0x27, 0x68, 0x0C, 0x01, 0x00, 0x01, 0x0C, 0x93, 0xEF, 0x00, 0x38, 0x55, 0x00, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x09, 0x98, 0x24, 0xA5, 0x55,
+0x14, 0x19, 0x0D, 0xC1, 0xFE, 0x09, 0x79, 0x18, 0x9C, 0xA9, 0x21, 0x11, 0x08, 0x00, 0xC0, 0x16, 0x0D, 0xC1, 0x19, 0xC2, 0x04, 0x0D, 0xC0, 0xA0,
+0x35, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC0, 0x08, 0xC1, 0x6E, 0x08, 0x1C, 0xA8, 0x44,
+0x24, 0x98, 0xCC, 0x28, 0xC2, 0x2D, 0xC0, 0x28, 0xC5, 0x2D, 0xC0, 0x28, 0xC0, 0x56, 0xC0, 0x19, 0x20, 0x34, 0x08, 0x10, 0xC1, 0x0D, 0x10, 0xC0,
+0x08, 0x10, 0xC0, 0x15, 0xC0, 0x08, 0x2D, 0x14, 0xC0, 0x19, 0x28, 0x14, 0x2D, 0x28, 0x14, 0xC0, 0x19, 0x28, 0x3C, 0x08, 0x10, 0x15, 0xC0, 0x10,
+0x08, 0x01, 0x3C, 0x28, 0x20, 0x14, 0xC0, 0x20, 0x2D, 0x3C, 0x08, 0x10, 0x15, 0x1C, 0x08, 0x34, 0x28, 0x14, 0xC1, 0x19, 0x3C, 0x15, 0x1C, 0x15,
+0x3C, 0x20, 0x0C, 0x05, 0x19, 0x3C, 0x1C, 0x15, 0x3C, 0x20, 0x14, 0x3C, 0x10, 0xC0, 0x3C, 0x08, 0x30, 0x24, 0x28, 0x34, 0xAB, 0x32, 0x51, 0x05,
+0x2D, 0x3D, 0x19, 0x28, 0x2E, 0x9F, 0xEC, 0xC0, 0x04, 0x28, 0x19, 0xC1, 0x0D, 0xC1, 0xFE, 0x47, 0x68, 0x05, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x2A,
+0x0D, 0xC1, 0x3C, 0xC2, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0x08, 0x14, 0x00, 0xC1, 0x3C, 0x3A, 0x0D, 0xC2, 0xFE, 0x4A, 0x89, 0xFE, 0x86, 0x31,
+0x08, 0x0D, 0xC1, 0xFE, 0xA8, 0x70, 0x38, 0x6F, 0x01, 0x10, 0xA7, 0x44, 0x30, 0x3C, 0x1C, 0x11, 0x10, 0x3C, 0x0D, 0xC1, 0x3B, 0x0C, 0x24, 0x3C,
+0x1C, 0x11, 0x3C, 0x2D, 0x3D, 0xC0, 0x28, 0x2E, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x24, 0x0C, 0x19, 0xC0, 0x0D, 0xC1, 0x25, 0x0C, 0x95, 0xDE, 0x00,
+0x30, 0x1C, 0x00, 0xC0, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x19, 0xC2, 0x04, 0x0D, 0xC0, 0x29, 0x28, 0xC1, 0x2D, 0xC1, 0x34, 0xC0, 0x2E, 0x0D, 0xC0,
+0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC1, 0x08, 0xC0, 0x10, 0x01, 0xA6, 0x56, 0xA3, 0x66, 0x28, 0x20, 0x28, 0xC2, 0x2D, 0xC0, 0x28, 0xC0, 0x2D,
+0x28, 0xC1, 0x2D, 0xC0, 0x28, 0x20, 0xC0, 0x19, 0x20, 0x28, 0x3C, 0x08, 0x10, 0xC2, 0x5A, 0x10, 0xC2, 0x15, 0xC0, 0x01, 0x9D, 0x9A, 0x51, 0x14,
+0x20, 0x14, 0x39, 0xAC, 0x32, 0x14, 0x19, 0xA2, 0x78, 0x08, 0x10, 0x15, 0x10, 0xC0, 0x08, 0x01, 0x3C, 0x34, 0x28, 0x14, 0xC0, 0x19, 0x28, 0x34,
+0x01, 0x08, 0x15, 0x1C, 0x10, 0x3C, 0xC0, 0x28, 0x14, 0xC1, 0x20, 0x34, 0x08, 0x15, 0x1C, 0x10, 0x34, 0x20, 0x51, 0x05, 0x14, 0x3C, 0x24, 0xC0,
+0x01, 0x20, 0x0C, 0x14, 0x3C, 0x1C, 0x10, 0x39, 0x3C, 0x24, 0x21, 0x2D, 0x39, 0xA8, 0x54, 0x18, 0x28, 0x14, 0x3D, 0x15, 0x05, 0x15, 0x29, 0xA0,
+0xDB, 0xC0, 0xFE, 0x2A, 0x98, 0x19, 0xC2, 0x0D, 0xC1, 0xFE, 0x27, 0x68, 0x05, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x3C, 0xC2, 0xFE,
+0x6A, 0xA0, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0x10, 0x19, 0x00, 0xC1, 0x2D, 0xFE, 0xAE, 0xD8, 0x0D, 0xC2, 0xFE, 0x4C, 0xB8, 0x01, 0x18, 0x0D, 0xC1,
+0xFE, 0x8A, 0x81, 0x10, 0x01, 0xA7, 0x55, 0xC0, 0x08, 0x1C, 0x18, 0x30, 0x08, 0x38, 0xA3, 0x66, 0x0D, 0xC1, 0xFE, 0x6A, 0x81, 0x10, 0x24, 0xA6,
+0x55, 0x30, 0x10, 0xA5, 0x56, 0x18, 0x1C, 0xC0, 0x11, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xFE, 0x0C, 0xA9, 0x38, 0x24, 0x3D, 0xC0, 0x0D, 0xC1, 0xFE,
+0x09, 0x79, 0x0C, 0x9D, 0x99, 0x39, 0x30, 0x24, 0x00, 0xC0, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x19, 0xC2, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35,
+0x28, 0xC2, 0x6E, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC1, 0x01, 0xC4, 0x08, 0xC0, 0x6E, 0x2C, 0x24, 0x98, 0xCC, 0x28, 0xC2,
+0x2D, 0xC1, 0x28, 0xC0, 0x2D, 0xC3, 0x28, 0xC0, 0x56, 0x19, 0xC0, 0x28, 0x3C, 0x0D, 0x10, 0xC7, 0x15, 0x10, 0x3C, 0x19, 0x14, 0xC0, 0x19, 0x14,
+0x24, 0xAE, 0x11, 0xC0, 0x10, 0x1C, 0x24, 0x15, 0x10, 0x01, 0x3C, 0xC0, 0x2D, 0x20, 0x19, 0x14, 0x19, 0x28, 0x3C, 0x08, 0x10, 0x15, 0x10, 0xC0,
+0x08, 0x3C, 0x28, 0x14, 0xC0, 0x19, 0x20, 0x2D, 0x01, 0x10, 0x1C, 0x10, 0x3C, 0x28, 0x19, 0x52, 0x05, 0x14, 0x3C, 0x10, 0x1C, 0x08, 0x28, 0x14,
+0x0C, 0x28, 0x10, 0x24, 0x08, 0x2D, 0x39, 0x1C, 0xC0, 0x39, 0x3C, 0xA7, 0x45, 0xA3, 0x76, 0x28, 0x05, 0xAA, 0x34, 0x04, 0x05, 0x3C, 0x1C, 0x29,
+0xA0, 0xDB, 0xC0, 0xFE, 0x2A, 0x98, 0x19, 0xC2, 0x22, 0xC0, 0x1D, 0xFE, 0x43, 0x28, 0x05, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x3C,
+0xC2, 0x11, 0x0D, 0xC0, 0xA1, 0x24, 0x3C, 0xC0, 0x10, 0x9B, 0xAB, 0x00, 0xC1, 0x14, 0xFE, 0x8E, 0xD0, 0x0D, 0xC3, 0xFE, 0x43, 0x28, 0xFE, 0xA7,
+0x31, 0x0D, 0xC1, 0xFE, 0x6A, 0x81, 0x14, 0x0C, 0x24, 0x30, 0x05, 0x14, 0xAC, 0x22, 0x3C, 0x05, 0x3C, 0x0C, 0x0D, 0xC1, 0xFE, 0x09, 0x79, 0x05,
+0x7F, 0xAD, 0x11, 0x96, 0xDD, 0x05, 0x10, 0x0C, 0x05, 0xC0, 0x09, 0x3A, 0x0D, 0xC0, 0xFE, 0x2C, 0xA9, 0x28, 0x9C, 0xAA, 0x24, 0x04, 0x0D, 0xC1,
+0xFE, 0xE8, 0x78, 0x2D, 0xA6, 0x55, 0xA5, 0x56, 0x24, 0x3C, 0x00, 0xC0, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x19, 0xC2, 0xFE, 0x2A, 0x98, 0x0D, 0xC0,
+0xA0, 0x35, 0x28, 0xC2, 0x2D, 0x34, 0xC1, 0xFE, 0x2D, 0xD0, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC1, 0x01, 0xC1, 0x6B, 0x01, 0x08, 0x6E, 0x01,
+0x38, 0x18, 0x34, 0x20, 0x28, 0xC3, 0x2D, 0xC2, 0x28, 0x2D, 0xC1, 0x28, 0x20, 0xC0, 0x19, 0xC0, 0x28, 0x01, 0x0D, 0x10, 0x0D, 0x10, 0x15, 0x10,
+0xC0, 0x15, 0x10, 0x15, 0xC0, 0x08, 0x2D, 0x14, 0xC0, 0x20, 0x14, 0x2D, 0x2C, 0xA6, 0x54, 0xC1, 0x10, 0x01, 0x3C, 0x34, 0xC0, 0x28, 0xC0, 0x20,
+0x14, 0xC0, 0x2D, 0x3C, 0x10, 0x15, 0xC0, 0x10, 0x08, 0x01, 0x34, 0x2D, 0x20, 0x14, 0xC0, 0x20, 0x28, 0x3C, 0x10, 0x15, 0xC0, 0x08, 0x34, 0x28,
+0x14, 0x05, 0x6B, 0x19, 0x3C, 0x15, 0x1C, 0x01, 0x28, 0x14, 0x05, 0x14, 0x34, 0x1C, 0x15, 0x3C, 0x28, 0x2D, 0x10, 0x15, 0x3C, 0xC0, 0x35, 0xA4,
+0x76, 0x01, 0x05, 0x10, 0x20, 0x34, 0x0C, 0x30, 0x3C, 0x29, 0xA0, 0xDB, 0xC0, 0xFE, 0x4A, 0x98, 0x19, 0xC6, 0x05, 0x00, 0xC1, 0x05, 0x14, 0x19,
+0x2A, 0x0D, 0xC1, 0x3C, 0x01, 0x3C, 0xC0, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0xC0, 0x10, 0x28, 0x00, 0xC1, 0x28, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0x5A,
+0x0D, 0xC0, 0xFE, 0xEA, 0x90, 0xFE, 0xC7, 0x39, 0x0D, 0xC1, 0xFE, 0x6A, 0x81, 0xFE, 0x65, 0x29, 0x1C, 0xA4, 0x66, 0x0C, 0x15, 0x24, 0xA5, 0x55,
+0x30, 0x10, 0x30, 0x11, 0x0D, 0xC1, 0x2D, 0x10, 0x1C, 0x11, 0x29, 0x08, 0x30, 0x0C, 0x9A, 0xAB, 0x08, 0x0C, 0x3F, 0xFE, 0x10, 0xF8, 0xC0, 0xFE,
+0x2C, 0xA9, 0x10, 0x9D, 0x99, 0x29, 0x04, 0x0D, 0xC1, 0xFE, 0xC8, 0x70, 0x14, 0x34, 0xA9, 0x33, 0x14, 0x05, 0x14, 0x51, 0xFE, 0x06, 0x68, 0x0D,
+0xC1, 0x19, 0xC2, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC2, 0x2D, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x08,
+0xC0, 0x01, 0x6F, 0x08, 0x10, 0x20, 0x24, 0x14, 0x28, 0xC5, 0x2D, 0xC1, 0x28, 0x2D, 0xC0, 0x28, 0x56, 0xC2, 0x28, 0x3C, 0x10, 0x0D, 0x10, 0xC0,
+0x15, 0x10, 0x0D, 0x10, 0xC0, 0x15, 0xC0, 0x01, 0x19, 0x14, 0x19, 0xC1, 0x08, 0xAF, 0x10, 0xC3, 0x2D, 0xC0, 0x28, 0x20, 0x19, 0x52, 0x19, 0x28,
+0x01, 0x10, 0x15, 0x10, 0xC0, 0x01, 0x3C, 0xC0, 0x2D, 0x20, 0x14, 0xC0, 0x19, 0x2D, 0x3C, 0x08, 0x10, 0xC1, 0x01, 0x2D, 0x14, 0x0C, 0x14, 0xC0,
+0x28, 0x3C, 0x15, 0x10, 0x01, 0x28, 0x14, 0x05, 0xC0, 0x28, 0x10, 0x6F, 0x01, 0x28, 0x20, 0x28, 0x10, 0x1C, 0x0D, 0x3C, 0x30, 0xA3, 0x76, 0x01,
+0x9A, 0xBC, 0x08, 0x2C, 0x10, 0x00, 0x15, 0xA2, 0x77, 0x0C, 0x2E, 0x9F, 0xEC, 0xC0, 0xFE, 0x4A, 0x98, 0x19, 0xC6, 0x14, 0x00, 0xC1, 0x05, 0x14,
+0x19, 0x2A, 0x0D, 0xC1, 0x01, 0xC0, 0x3C, 0xC0, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0x10, 0x2D, 0x00, 0xC0, 0x05, 0x19, 0xFE, 0x0D, 0xD0, 0x0D,
+0xC0, 0xA1, 0x03, 0x0D, 0xC0, 0xFE, 0x8E, 0xD0, 0x19, 0x0D, 0xC1, 0xFE, 0x47, 0x70, 0x24, 0xA6, 0x55, 0x34, 0x2D, 0xA9, 0x44, 0x3D, 0x28, 0x08,
+0x20, 0x1C, 0x2D, 0x0D, 0xC1, 0xFE, 0xA8, 0x70, 0x18, 0x3D, 0x3C, 0x24, 0x20, 0x15, 0x01, 0xA7, 0x45, 0x18, 0x01, 0x3A, 0x0D, 0xC0, 0xFE, 0x8B,
+0xA0, 0xFE, 0x68, 0x59, 0x32, 0x9C, 0xBB, 0x65, 0x0D, 0xC1, 0x1E, 0x3D, 0x35, 0x0C, 0x24, 0x51, 0x9A, 0xBB, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1,
+0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0x29, 0x28, 0xC2, 0x2D, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC2, 0x01, 0xC0,
+0x6B, 0xC1, 0x01, 0x38, 0xA4, 0x56, 0x2D, 0x19, 0x28, 0xC1, 0x2D, 0xC5, 0x28, 0xC2, 0x19, 0xC0, 0x6B, 0x28, 0x3C, 0x10, 0xC4, 0x15, 0x10, 0xC0,
+0x15, 0x10, 0x3C, 0x19, 0x14, 0x19, 0xC1, 0x0C, 0xA7, 0x44, 0xC4, 0x20, 0x14, 0xC1, 0x28, 0x01, 0x10, 0x1C, 0xC0, 0x10, 0x3C, 0xC1, 0x2D, 0x20,
+0x14, 0xC0, 0x19, 0x2D, 0x3C, 0x08, 0x10, 0xC0, 0x01, 0x3C, 0x2D, 0x28, 0x19, 0x14, 0xC0, 0x28, 0x34, 0x01, 0x10, 0x15, 0x01, 0x28, 0x14, 0x05,
+0x6B, 0x20, 0x08, 0x1C, 0x10, 0x34, 0x19, 0xC0, 0x28, 0x10, 0x24, 0x08, 0x3C, 0x24, 0xA3, 0x67, 0x10, 0x14, 0x3C, 0xAA, 0x33, 0x3D, 0x00, 0x28,
+0xAA, 0x33, 0x28, 0x14, 0x3A, 0x9E, 0xFC, 0xC0, 0xFE, 0x2A, 0x98, 0x19, 0xC0, 0x28, 0x19, 0xC3, 0x14, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D,
+0xC1, 0x01, 0xC1, 0x3C, 0x11, 0x0D, 0xC0, 0x2E, 0x01, 0xC0, 0x10, 0x3C, 0x00, 0xC1, 0x28, 0x29, 0x0D, 0xC0, 0x04, 0xFE, 0x0E, 0xD8, 0x0D, 0xC0,
+0xFE, 0x44, 0x48, 0x0D, 0xC1, 0xFE, 0x27, 0x68, 0xFE, 0xE3, 0x18, 0x0C, 0x19, 0x14, 0x38, 0x24, 0x14, 0x19, 0x0C, 0x3C, 0x14, 0x0D, 0xC1, 0x1D,
+0xFE, 0xA7, 0x31, 0x24, 0x14, 0x6F, 0x18, 0x20, 0x14, 0x24, 0x3D, 0x14, 0x29, 0x0D, 0xC0, 0xFE, 0x0A, 0x98, 0xA2, 0x76, 0x0D, 0xC4, 0x2A, 0xFE,
+0x08, 0x42, 0x15, 0x2D, 0x04, 0xA2, 0x76, 0x05, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0x29, 0x28,
+0xC2, 0x2D, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC1, 0x01, 0xC2, 0x08, 0xC1, 0xA8, 0x43, 0x9C, 0xAA, 0x19, 0x28, 0xC0, 0x2D,
+0x28, 0x2D, 0xC6, 0x28, 0xC0, 0x56, 0x19, 0xC0, 0x2D, 0x3C, 0x7F, 0x15, 0x10, 0x5A, 0x10, 0x08, 0xC0, 0x10, 0x15, 0xC0, 0x10, 0x34, 0x14, 0xC0,
+0x20, 0x14, 0x2D, 0xAF, 0x11, 0xC6, 0x14, 0x28, 0x10, 0x1C, 0x24, 0x1C, 0x01, 0x3C, 0xC1, 0x2D, 0x28, 0x19, 0x52, 0x14, 0x2D, 0x01, 0x10, 0xC1,
+0x56, 0x01, 0x3C, 0x2D, 0x19, 0x0C, 0x14, 0x19, 0x34, 0x3C, 0x08, 0x10, 0x08, 0x3C, 0x2D, 0x19, 0x0C, 0xC0, 0x19, 0x34, 0x10, 0x1C, 0x01, 0x20,
+0x14, 0x19, 0x2D, 0x10, 0x1C, 0x08, 0x39, 0x10, 0x38, 0x15, 0x28, 0x3C, 0x11, 0xC0, 0x14, 0x0C, 0xAC, 0x22, 0x29, 0x00, 0x08, 0x2E, 0x9F, 0xEC,
+0xC0, 0xFE, 0x2A, 0x98, 0x28, 0x19, 0xC0, 0x28, 0x19, 0xC2, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x01, 0xC0, 0x3C, 0xC0, 0xFE, 0x4A,
+0xA0, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0x08, 0x01, 0x05, 0x00, 0xC0, 0x6F, 0xFE, 0x6E, 0xD0, 0x0D, 0xC0, 0xFE, 0xEB, 0xA0, 0x6F, 0x0D, 0xC0, 0xFE,
+0x0B, 0xA1, 0x0D, 0xC1, 0x1E, 0xFE, 0x86, 0x31, 0xC2, 0x6F, 0x38, 0x35, 0x38, 0x09, 0x38, 0x30, 0x0D, 0xC1, 0xFE, 0x09, 0x79, 0x04, 0x3D, 0x24,
+0x29, 0x11, 0x38, 0x24, 0x3D, 0x04, 0x9D, 0x99, 0x3A, 0x0D, 0xC0, 0xFE, 0xAB, 0xA0, 0x27, 0x0D, 0xC3, 0xFE, 0x2C, 0xB8, 0x2D, 0x11, 0x08, 0x9B,
+0xBA, 0x08, 0xA6, 0x65, 0x05, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x2D,
+0xC0, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC0, 0x08, 0x01, 0x1C, 0x18, 0x3C, 0x19, 0x28, 0xC1, 0x2D, 0xC1, 0x34,
+0x2D, 0xC1, 0x34, 0x28, 0x20, 0xC0, 0x19, 0xC0, 0x2D, 0x01, 0x6F, 0xC0, 0x10, 0xC4, 0x15, 0xC0, 0x10, 0x28, 0x14, 0xC0, 0x19, 0x56, 0x3C, 0xAD,
+0x11, 0xC7, 0x24, 0xC0, 0x1C, 0x10, 0x34, 0x28, 0x2D, 0xC0, 0x28, 0x19, 0x14, 0xC0, 0x28, 0x3C, 0x10, 0x15, 0x10, 0x08, 0x01, 0x3C, 0x2D, 0x28,
+0x14, 0xC1, 0x2D, 0x3C, 0x01, 0x08, 0x01, 0xC0, 0x34, 0x28, 0x14, 0x05, 0x14, 0x20, 0x34, 0x08, 0x10, 0x3C, 0x28, 0x14, 0xC0, 0x19, 0x3C, 0x15,
+0xC0, 0x3C, 0x2D, 0x08, 0x24, 0x1C, 0x3C, 0xC0, 0xA7, 0x45, 0xA3, 0x76, 0x28, 0x00, 0x1C, 0x18, 0x19, 0x14, 0x24, 0x29, 0xA0, 0xDB, 0xC0, 0xFE,
+0x2A, 0x98, 0x28, 0x19, 0xC4, 0x14, 0x05, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x01, 0xC0, 0x3C, 0xC0, 0xFE, 0x6A, 0xA0, 0x0D, 0xC0, 0x2E,
+0x3C, 0xC0, 0x08, 0xC0, 0x19, 0x00, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x8B, 0xA0, 0xFE, 0xC9, 0x61, 0x0D, 0xC0, 0x4D, 0x0D, 0xC1, 0xFE, 0xAA, 0x81,
+0x08, 0x9A, 0xBA, 0x24, 0xA6, 0x45, 0x19, 0xC0, 0x18, 0x30, 0x19, 0x01, 0x20, 0x0D, 0xC1, 0x32, 0x19, 0x28, 0x1D, 0x9B, 0xBA, 0x28, 0x1C, 0x20,
+0x3C, 0x28, 0xA9, 0x34, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xFE, 0x4C, 0xA9, 0x9E, 0x26, 0x0D, 0xC1, 0xFE, 0xE7, 0x60, 0x15, 0xA5, 0x66, 0x56, 0x29,
+0x3D, 0x66, 0xC0, 0xA3, 0x66, 0x2D, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1,
+0x2D, 0xC0, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0xC0, 0x08, 0x01, 0x3D, 0xC0, 0x96, 0xDE, 0xC0, 0x28, 0xC1, 0x2D,
+0xC5, 0x28, 0xC0, 0x20, 0x19, 0xC0, 0x28, 0x01, 0x6F, 0x10, 0xC2, 0x15, 0xC0, 0x10, 0xC0, 0x15, 0x08, 0x20, 0x14, 0x20, 0x19, 0x14, 0xA9, 0x33,
+0xA7, 0x55, 0x39, 0x34, 0xC2, 0x39, 0xC1, 0x34, 0x10, 0x2D, 0x20, 0xC3, 0x14, 0xC0, 0x19, 0x3C, 0x10, 0x15, 0x1C, 0x08, 0x51, 0xC1, 0x28, 0x20,
+0x14, 0xC0, 0x20, 0x34, 0x01, 0x10, 0x08, 0x01, 0xC0, 0x34, 0x20, 0x14, 0xC1, 0x28, 0x34, 0x01, 0x10, 0x3C, 0x28, 0x19, 0x14, 0xC0, 0x28, 0x3C,
+0x1C, 0x10, 0x2D, 0xC0, 0x3C, 0x1C, 0x24, 0x01, 0xC0, 0x38, 0xA4, 0x66, 0x3C, 0x00, 0x2D, 0xAC, 0x23, 0x10, 0x00, 0x10, 0xC0, 0xFE, 0x0D, 0xD0,
+0xA0, 0xDB, 0xC0, 0x04, 0x19, 0xC6, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x01, 0xC0, 0x3C, 0xC0, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0xC0,
+0x01, 0x10, 0x2D, 0x00, 0xC1, 0x29, 0x0D, 0xC0, 0xFE, 0x8B, 0xA0, 0x0C, 0xFE, 0x2D, 0xC0, 0x0D, 0xC0, 0x0A, 0x0D, 0xC0, 0xFE, 0x6A, 0x81, 0xFE,
+0x04, 0x19, 0x19, 0x15, 0xA6, 0x55, 0x94, 0xEF, 0x19, 0xAA, 0x34, 0x24, 0x19, 0xA2, 0x77, 0x11, 0xFE, 0x10, 0xF8, 0xC1, 0xFE, 0x4A, 0x79, 0x19,
+0xC0, 0x09, 0x1C, 0x14, 0xA4, 0x56, 0x11, 0x20, 0x14, 0xA9, 0x33, 0x3F, 0x0D, 0xC0, 0xFE, 0x2C, 0xA9, 0x3C, 0x33, 0x0D, 0xC0, 0x12, 0xFE, 0x20,
+0x00, 0x38, 0x24, 0x96, 0xDD, 0xA4, 0x66, 0xAC, 0x22, 0x10, 0x34, 0x28, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98,
+0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC2, 0x01, 0xC2, 0x10, 0x18, 0x10, 0x19,
+0x28, 0xC1, 0x2D, 0xC5, 0x28, 0xC0, 0x56, 0x19, 0xC0, 0x28, 0x3C, 0x10, 0xC3, 0x5A, 0x10, 0xC1, 0x15, 0x3C, 0x41, 0x14, 0x20, 0x14, 0x19, 0xAC,
+0x22, 0xA2, 0x88, 0x6E, 0xC8, 0x19, 0x20, 0x28, 0x19, 0x14, 0x56, 0x19, 0x2D, 0x15, 0x24, 0x1C, 0x10, 0x3C, 0x2D, 0x28, 0xC0, 0x20, 0x14, 0x0C,
+0x19, 0xA2, 0x78, 0x08, 0x10, 0x08, 0x3C, 0x34, 0x3C, 0x2D, 0x20, 0x14, 0xC0, 0x20, 0x34, 0x3C, 0x01, 0xC1, 0x34, 0x19, 0x14, 0xC0, 0x19, 0x34,
+0x10, 0xC0, 0x34, 0x28, 0xC0, 0x3C, 0x15, 0x24, 0x10, 0x3C, 0xA5, 0x55, 0x11, 0x10, 0x0C, 0x28, 0xAA, 0x33, 0x56, 0x00, 0x28, 0x3D, 0x20, 0xFE,
+0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0xFE, 0x4A, 0x98, 0x19, 0xC2, 0xFE, 0x2A, 0x98, 0xC1, 0xFE, 0x44, 0x48, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D,
+0xC1, 0xFE, 0xE3, 0x18, 0xC0, 0x3C, 0x01, 0xFE, 0x6A, 0xA0, 0x0D, 0xC0, 0x2E, 0x3C, 0xC0, 0x01, 0x10, 0x3C, 0x05, 0x00, 0xC0, 0x29, 0x0D, 0xC0,
+0xFE, 0xEB, 0xA0, 0x21, 0xFE, 0x0B, 0x99, 0x0D, 0xC3, 0xFE, 0x09, 0x79, 0x35, 0x0C, 0x3D, 0x51, 0x3D, 0x0C, 0x30, 0x38, 0xA2, 0x67, 0x38, 0xC0,
+0x0D, 0xC1, 0xFE, 0x29, 0x79, 0x38, 0x6F, 0x38, 0xC1, 0x3D, 0x38, 0xC1, 0x3D, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0xFE, 0x0C, 0xA9, 0x38, 0x1F, 0x0D,
+0xC0, 0x03, 0x10, 0xA5, 0x56, 0x3D, 0x34, 0x08, 0x0C, 0x01, 0x9C, 0xAA, 0x28, 0x05, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0xFE, 0x41, 0x08, 0x19, 0xC1,
+0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0xC1, 0xFE, 0x2D, 0xD0, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC2, 0x01,
+0xC2, 0x30, 0x0C, 0x2D, 0x28, 0xC2, 0x2D, 0xC4, 0x28, 0xC0, 0x20, 0xC0, 0x19, 0x28, 0x3C, 0x10, 0xC1, 0x5A, 0xC0, 0x10, 0xC0, 0x0D, 0x10, 0xC0,
+0x3C, 0x20, 0x14, 0x28, 0x14, 0x28, 0xAD, 0x11, 0xCB, 0x19, 0xC0, 0x14, 0xC0, 0x28, 0x08, 0x24, 0x30, 0x1C, 0x3C, 0x28, 0x20, 0x2D, 0x28, 0x19,
+0x14, 0xC0, 0x20, 0x3C, 0x10, 0x15, 0x08, 0x34, 0x2D, 0xC0, 0x28, 0x20, 0x14, 0xC0, 0x28, 0x3C, 0xC2, 0x34, 0xC0, 0x28, 0x14, 0xC0, 0x19, 0x28,
+0x01, 0x10, 0x3C, 0x2D, 0x20, 0x28, 0x3C, 0x10, 0xA3, 0x66, 0x10, 0x01, 0x24, 0x3D, 0x24, 0x28, 0x20, 0x30, 0xA5, 0x65, 0x19, 0x05, 0x29, 0x24,
+0x00, 0x2E, 0x9F, 0xEC, 0xC0, 0xFE, 0x4A, 0x98, 0x19, 0xC1, 0x28, 0x0D, 0xC1, 0xFE, 0x47, 0x68, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1,
+0x01, 0x3C, 0xC0, 0x01, 0x11, 0x0D, 0xC0, 0x2E, 0x3C, 0x01, 0xC0, 0x6F, 0x08, 0x9C, 0xAA, 0x00, 0xC0, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0x11,
+0x05, 0xA6, 0x97, 0x0D, 0xC3, 0xFE, 0x06, 0x68, 0x28, 0xAC, 0x12, 0x2D, 0x00, 0x24, 0x0C, 0x00, 0xA2, 0x67, 0x18, 0x1C, 0x00, 0x0D, 0xC1, 0xFE,
+0x06, 0x68, 0x3D, 0xC0, 0x00, 0x20, 0xAD, 0x21, 0x10, 0x05, 0x21, 0x20, 0x19, 0x29, 0x0D, 0xC0, 0x04, 0x3C, 0xA9, 0x64, 0x0D, 0xC1, 0xFE, 0x6B,
+0x91, 0x08, 0x15, 0x18, 0x51, 0x50, 0x3D, 0x0C, 0x10, 0x00, 0x11, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A, 0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28,
+0xC1, 0x2D, 0xC0, 0x34, 0xC1, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC1, 0x01, 0xC2, 0x08, 0xA7, 0x44, 0x24, 0x99, 0xBC, 0x28, 0xC0, 0x2D,
+0xC5, 0x28, 0xC1, 0x20, 0x19, 0x28, 0x01, 0x10, 0xC1, 0x15, 0x10, 0x5A, 0x10, 0xC1, 0x15, 0x01, 0x19, 0xC0, 0x20, 0x14, 0x2D, 0xAB, 0x33, 0xCC,
+0x14, 0x19, 0x01, 0xA4, 0x66, 0x38, 0x24, 0x08, 0x2D, 0x19, 0x6B, 0x28, 0x20, 0x19, 0x52, 0x14, 0x34, 0x15, 0x24, 0x15, 0x3C, 0x28, 0xC2, 0x14,
+0x0C, 0x19, 0x34, 0x08, 0x10, 0x3C, 0x2D, 0x3C, 0x28, 0x14, 0xC0, 0x0C, 0x20, 0x2D, 0x3C, 0xC0, 0x01, 0x34, 0x28, 0x20, 0x28, 0x34, 0x15, 0x24,
+0x08, 0x01, 0xA3, 0x67, 0x38, 0x29, 0x3C, 0x28, 0x24, 0xA5, 0x55, 0x01, 0x00, 0x3C, 0x11, 0x19, 0x14, 0xFE, 0x4E, 0xD0, 0x9E, 0xFC, 0xC0, 0xFE,
+0x4A, 0x98, 0x19, 0xC2, 0x0D, 0xC1, 0x22, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x01, 0xC1, 0x3C, 0xFE, 0x6A, 0xA0, 0x0D, 0xC0, 0x2E,
+0x3C, 0x01, 0xC0, 0x08, 0x10, 0x3C, 0x05, 0x00, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0x27, 0x01, 0xA4, 0x66, 0xFE, 0xED, 0xC0, 0x0D, 0xC2, 0x2A, 0x10,
+0xA7, 0x44, 0x15, 0x28, 0x30, 0x11, 0x28, 0x2D, 0x11, 0x29, 0x19, 0x0D, 0xC1, 0x22, 0x30, 0xA2, 0x77, 0x19, 0x28, 0x11, 0x10, 0x19, 0x15, 0x11,
+0x20, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x2A, 0x98, 0x28, 0x11, 0x1E, 0x0D, 0xC0, 0xFE, 0xAD, 0xC8, 0x14, 0xC0, 0xAC, 0x22, 0x10, 0x05, 0x3C,
+0x11, 0x28, 0x00, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x14, 0x19, 0xC1, 0x04, 0x0D, 0xC0, 0x29, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0x2E, 0x0D,
+0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC1, 0x01, 0x3C, 0x01, 0x3C, 0x1C, 0x0C, 0x3C, 0x19, 0x28, 0x2D, 0xC5, 0x34, 0x28, 0x20, 0xC0, 0x19, 0x28, 0x3C,
+0x10, 0xC5, 0x5A, 0x10, 0x15, 0x3C, 0x19, 0x14, 0x20, 0x00, 0x34, 0xAA, 0x32, 0xCD, 0x1C, 0x38, 0xC0, 0x1C, 0x3C, 0x19, 0x14, 0x19, 0x20, 0xC0,
+0x14, 0xC0, 0x19, 0x01, 0x24, 0xC0, 0x15, 0x3C, 0x20, 0x28, 0xC0, 0x20, 0x14, 0xC1, 0x3C, 0x10, 0xC0, 0x01, 0x2D, 0x28, 0xC1, 0x14, 0x56, 0x20,
+0x34, 0x3C, 0x34, 0xC1, 0x28, 0x19, 0x28, 0xC0, 0x34, 0x15, 0xC0, 0x3C, 0xC0, 0x15, 0x24, 0x38, 0x15, 0x2D, 0x10, 0xA6, 0x55, 0x24, 0x05, 0x14,
+0x0C, 0x24, 0x00, 0x01, 0x2E, 0x9F, 0xEC, 0xC0, 0x04, 0x19, 0xC2, 0x0D, 0xC1, 0x22, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC1, 0x01, 0x3C,
+0x01, 0x3C, 0xFE, 0x6A, 0xA0, 0x0D, 0xC0, 0x2E, 0x01, 0x3C, 0x01, 0xC0, 0x08, 0x10, 0x28, 0x00, 0x29, 0x0D, 0xC0, 0xFE, 0x8B, 0xA0, 0x0C, 0x30,
+0xFE, 0xA9, 0x80, 0x0D, 0xC2, 0xFE, 0x6A, 0x81, 0xFE, 0xA7, 0x31, 0x10, 0x38, 0x0C, 0x30, 0x21, 0x0C, 0xC0, 0x24, 0x6E, 0x0C, 0x0D, 0xC1, 0x2D,
+0x29, 0xC0, 0x0C, 0x5A, 0x29, 0x38, 0x0C, 0x38, 0x30, 0x04, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0x3B, 0xFE, 0xA7, 0x31, 0x3D, 0xFE, 0x49, 0x79, 0x0D,
+0xC1, 0xFE, 0x46, 0x41, 0x24, 0x0C, 0x38, 0x01, 0x6F, 0x0C, 0x3C, 0x00, 0xFE, 0x06, 0x68, 0xFE, 0x10, 0xF8, 0xC1, 0x14, 0x19, 0xC1, 0xFE, 0x2A,
+0x98, 0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x6E, 0xC0, 0x6B, 0xC0, 0x3C, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC3, 0x01, 0x3C, 0x38, 0xC0,
+0x28, 0x2D, 0xC7, 0x28, 0xC0, 0x20, 0x19, 0x20, 0x3C, 0xA2, 0x67, 0x10, 0xC0, 0x15, 0x10, 0xC1, 0x15, 0xC0, 0x10, 0x3C, 0x19, 0xC0, 0x20, 0x05,
+0x01, 0x0C, 0xC9, 0x6E, 0x0C, 0xC0, 0x11, 0x0C, 0x9D, 0x99, 0x01, 0x14, 0xC1, 0x20, 0x19, 0x14, 0x56, 0x14, 0x2D, 0x15, 0x30, 0x24, 0x9D, 0x9A,
+0x28, 0x19, 0x20, 0x28, 0x19, 0x14, 0x0C, 0x20, 0x01, 0x15, 0xC0, 0x34, 0x28, 0xC0, 0x2D, 0x28, 0x14, 0x0C, 0x20, 0x3C, 0xC0, 0x34, 0x2D, 0x34,
+0x28, 0x19, 0xC0, 0x28, 0x34, 0x3C, 0x08, 0x10, 0x34, 0x3C, 0x10, 0x1C, 0x38, 0x29, 0x3C, 0x0D, 0xA6, 0x65, 0x38, 0x14, 0x00, 0x1C, 0x0C, 0x14,
+0xC0, 0x24, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC0, 0x04, 0x28, 0x19, 0xC1, 0x0D, 0xC1, 0x22, 0x14, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x2A, 0x0D, 0xC1,
+0x01, 0xC1, 0x3C, 0xFE, 0x6A, 0xA0, 0x0D, 0xC0, 0x2E, 0x3C, 0xC0, 0x01, 0xC0, 0x08, 0x10, 0x5A, 0x20, 0x29, 0xA0, 0xDB, 0xC0, 0xFE, 0x09, 0x98,
+0x08, 0x2D, 0x05, 0x03, 0x0D, 0xC1, 0xFE, 0x6A, 0x81, 0x15, 0x05, 0xA4, 0x66, 0x0C, 0x19, 0x05, 0xAA, 0x33, 0x7F, 0x05, 0xC0, 0x0C, 0x0D, 0xC1,
+0xFE, 0x6A, 0x81, 0x05, 0x00, 0xAD, 0x12, 0x30, 0x00, 0x20, 0x0C, 0x97, 0xCC, 0x00, 0x21, 0xFE, 0x8E, 0xD0, 0x0D, 0xC0, 0x3B, 0x24, 0x05, 0x01,
+0xFE, 0x2F, 0xE8, 0x0D, 0xC0, 0x2C, 0x0C, 0x3C, 0x1C, 0x0C, 0x38, 0x24, 0x38, 0x14, 0xFE, 0x06, 0x68, 0x0D, 0xC1, 0x19, 0xC2, 0xFE, 0x2A, 0x98,
+0x0D, 0xC0, 0xA0, 0x35, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0x2E, 0x0D, 0xC0, 0xFE, 0x6A, 0xA0, 0x3C, 0xC0, 0x01, 0x3C, 0x01, 0x3C, 0xA2,
+0x67, 0x09, 0x10, 0x19, 0x2D, 0xC1, 0x34, 0x2D, 0xC2, 0x28, 0xC0, 0x20, 0x19, 0x20, 0x34, 0x08, 0x10, 0xC0, 0x0D, 0x10, 0xC1, 0x15, 0xC0, 0x1C,
+0x3C, 0x19, 0xC0, 0x28, 0x00, 0x08, 0x0C, 0xCF, 0x14, 0x56, 0x19, 0xC0, 0x14, 0xC1, 0x19, 0x3C, 0xA5, 0x55, 0x3D, 0x24, 0x3C, 0x19, 0x0C, 0x20,
+0x28, 0x19, 0x14, 0xC0, 0x28, 0x10, 0x24, 0x15, 0x34, 0x20, 0x28, 0xC1, 0x14, 0xC0, 0x28, 0x01, 0x08, 0x3C, 0x28, 0xC1, 0x20, 0x14, 0x19, 0x34,
+0x3C, 0xC0, 0x01, 0x3C, 0x28, 0x34, 0x10, 0x15, 0x38, 0xC0, 0x08, 0x0D, 0x3D, 0x38, 0x34, 0x9C, 0xA9, 0x2D, 0x3D, 0x10, 0x00, 0x3C, 0x24, 0xFE,
+0x0D, 0xD0, 0xA0, 0xDB, 0xC8, 0x22, 0x14, 0x00, 0xC2, 0x14, 0x19, 0x2A, 0x0D, 0xC8, 0x2E, 0x3C, 0xC0, 0x01, 0xC0, 0x3C, 0x08, 0x10, 0x01, 0x29,
+0x0D, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0x19, 0x01, 0xFE, 0xCC, 0xB0, 0x0D, 0xC1, 0x1E, 0xFE, 0x86, 0x31, 0x10, 0x24, 0x3D, 0x21, 0x01, 0x3D, 0xC0,
+0x01, 0x6F, 0x3D, 0xFE, 0x10, 0xF8, 0xC1, 0x1E, 0xFE, 0x04, 0x19, 0x3C, 0x3D, 0xC0, 0x3C, 0x08, 0x3D, 0x1C, 0x2D, 0x30, 0xFE, 0x8E, 0xD0, 0xFE,
+0x10, 0xF8, 0xC0, 0x31, 0x30, 0x20, 0x08, 0x31, 0x0D, 0xC0, 0xA1, 0x45, 0x3D, 0x14, 0xC0, 0x3D, 0x9B, 0xAB, 0x05, 0x01, 0x2D, 0xFE, 0x06, 0x68,
+0xFE, 0x10, 0xF8, 0xC8, 0x29, 0x28, 0xC1, 0x2D, 0xC0, 0x6B, 0xC0, 0x3C, 0x2E, 0x0D, 0xC6, 0x3C, 0x24, 0x38, 0x2D, 0x28, 0xC2, 0x34, 0xC0, 0x2D,
+0xC1, 0x28, 0xC0, 0x20, 0x19, 0x34, 0xA3, 0x66, 0x10, 0x0D, 0x10, 0xC0, 0x0D, 0xC1, 0x15, 0xC0, 0x3C, 0x19, 0xC0, 0x28, 0x00, 0x10, 0x3D, 0xD0,
+0x14, 0xC1, 0x05, 0x14, 0x34, 0x1C, 0x38, 0xC0, 0x24, 0x2D, 0x0C, 0x14, 0x20, 0x19, 0x14, 0x0C, 0x14, 0x2D, 0x1C, 0x30, 0x1C, 0x2D, 0x14, 0x19,
+0x28, 0x20, 0x14, 0x0C, 0x20, 0x10, 0x15, 0x01, 0x28, 0xC1, 0x20, 0x14, 0xC0, 0x28, 0x3C, 0xC0, 0x34, 0xC0, 0x2D, 0x28, 0x3C, 0x08, 0x10, 0x38,
+0xC0, 0x0D, 0x10, 0x38, 0xC0, 0x01, 0x19, 0xC0, 0x38, 0xC0, 0x05, 0x14, 0xA9, 0x33, 0x01, 0xFE, 0x0D, 0xD0, 0xA0, 0xDB, 0xC8, 0x22, 0x14, 0x00,
+0xC2, 0x05, 0x19, 0x2A, 0x0D, 0xC8, 0x2E, 0x3C, 0xC3, 0x01, 0x10, 0xC0, 0x2E, 0x0D, 0xC0, 0xFE, 0x09, 0x98, 0x00, 0xC0, 0x28, 0xFE, 0xA7, 0x60,
+0x0D, 0xC1, 0xFE, 0xA8, 0x70, 0xFE, 0x04, 0x19, 0xA4, 0x76, 0xC0, 0x01, 0x30, 0x38, 0x15, 0x08, 0x38, 0xC0, 0x10, 0xFE, 0x10, 0xF8, 0xC1, 0xFE,
+0xC8, 0x70, 0x38, 0xC0, 0x10, 0x15, 0x38, 0xC0, 0x10, 0x38, 0xC0, 0x55, 0x3A, 0x0D, 0xC0, 0x27, 0x29, 0x38, 0xC0, 0xFE, 0x27, 0x59, 0x0D, 0xC1,
+0xFE, 0x48, 0x69, 0x38, 0x29, 0x38, 0xC0, 0x01, 0x1C, 0x34, 0xFE, 0x06, 0x68, 0x0D, 0xC8, 0xA0, 0x35, 0x28, 0xC1, 0x2D, 0xC0, 0x34, 0xC0, 0x3C,
+0xFE, 0x2D, 0xD0, 0x0D, 0xC6, 0x01, 0x38, 0x21, 0x9A, 0xBB, 0x2D, 0xC3, 0x34, 0x2D, 0xC0, 0x28, 0xC0, 0x20, 0x19, 0x28, 0x10, 0xC0, 0x08, 0x6E,
+0xC0, 0x10, 0xC3, 0x01, 0x20, 0x19, 0x20, 0x9D, 0xA9, 0x01, 0x38, 0xD1, 0x14, 0xC0, 0x20, 0x10, 0xA3, 0x66, 0xC1, 0x10, 0x20, 0x0C, 0x14, 0x19,
+0xC0, 0x14, 0x0C, 0x19, 0x3C, 0x29, 0xC0, 0x15, 0x28, 0x14, 0x19, 0x20, 0x19, 0x14, 0x0C, 0x28, 0x10, 0x1C, 0x08, 0x28, 0x19, 0x20, 0x28, 0x19,
+0x14, 0x20, 0x01, 0xC0, 0x2D, 0x28, 0x2D, 0x28, 0xC0, 0x3C, 0x10, 0xC0, 0x24, 0x29, 0x08, 0x10, 0x29, 0xC0, 0x21, 0x34, 0x14, 0x24, 0x29, 0x28,
+0x00, 0x01, 0x29, 0x14, 0xFE, 0x48, 0x80, 0x03, 0x7B, 0xC6, 0xA0, 0x35, 0x19, 0x14, 0x00, 0xC1, 0x05, 0xC0, 0x19, 0x28, 0x2E, 0x0D, 0xC6, 0x03,
+0xFE, 0x89, 0x80, 0x3C, 0xC0, 0x01, 0xC0, 0x3C, 0x08, 0xC0, 0x6E, 0x2E, 0x9F, 0xEC, 0xC0, 0xFE, 0x2A, 0x98, 0x0C, 0x05, 0x00, 0xC0, 0xFE, 0x0F,
+0xE8, 0x0D, 0xC0, 0x11, 0x0C, 0xAA, 0x32, 0x10, 0x14, 0x3C, 0x29, 0x14, 0xC0, 0x29, 0xC0, 0x14, 0x0D, 0xC1, 0xFE, 0x27, 0x68, 0x10, 0x29, 0x14,
+0x0C, 0x29, 0x24, 0x05, 0x28, 0x29, 0x25, 0xFE, 0x0D, 0xD0, 0x0D, 0xC0, 0xFE, 0x0A, 0x98, 0x05, 0xAA, 0x33, 0x9D, 0x9A, 0x98, 0xDC, 0xFE, 0x4D,
+0xC0, 0xFE, 0x10, 0xF8, 0xC0, 0xFE, 0x0B, 0xA8, 0x29, 0xC0, 0x28, 0x10, 0x29, 0xC0, 0x14, 0x00, 0xFE, 0x0D, 0xD0, 0x0D, 0xC6, 0x59, 0x32, 0x28,
+0xC0, 0x6E, 0xC0, 0x34, 0xC0, 0x3C, 0xC0, 0x2E, 0x0D, 0xC6, 0x10, 0xA3, 0x66, 0x08, 0x28, 0x2D, 0xC5, 0x28, 0xC1, 0x20, 0x28, 0x01, 0x10, 0xC5,
+0x15, 0x10, 0x3C, 0x28, 0x19, 0x20, 0x00, 0x01, 0x29, 0xD2, 0x3C, 0x24, 0xC2, 0x3C, 0x14, 0x05, 0x14, 0x19, 0xC0, 0x52, 0x14, 0x20, 0x10, 0x29,
+0xC0, 0x15, 0x28, 0x0C, 0x14, 0x20, 0x14, 0x0C, 0x14, 0x28, 0x10, 0x24, 0x15, 0x28, 0x14, 0x20, 0x28, 0x14, 0xC1, 0x3C, 0x10, 0x3C, 0x28, 0x20,
+0x28, 0x20, 0x28, 0x01, 0x10, 0x5A, 0x21, 0xC0, 0x01, 0x10, 0x29, 0xC1, 0x15, 0x25, 0x01, 0x24, 0x10, 0x05, 0x14, 0x29, 0x08, 0x00, 0x01, 0x34,
+0x19, 0x28, 0x19, 0xC7, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x28, 0x34, 0x3C, 0xC0, 0x01, 0xC2, 0x3C, 0xC6, 0x01, 0xC1, 0x08, 0xC0, 0x0D, 0xC0, 0x34,
+0x28, 0xC0, 0x14, 0x05, 0xC0, 0x00, 0x14, 0x20, 0x34, 0x29, 0xC0, 0x24, 0xC0, 0x29, 0xC1, 0x24, 0x29, 0x24, 0xC0, 0x29, 0xC0, 0x1C, 0x29, 0xC0,
+0x24, 0x1C, 0x29, 0x24, 0x10, 0x29, 0xC1, 0x10, 0x24, 0x29, 0x10, 0x08, 0x24, 0xC0, 0x3C, 0x1C, 0x29, 0x3C, 0x19, 0x29, 0xC0, 0x19, 0xC0, 0x29,
+0x39, 0x05, 0xC0, 0x00, 0x05, 0x14, 0xC0, 0x19, 0xC1, 0x20, 0xC0, 0x28, 0xC2, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0xC9, 0x29, 0xC0, 0x2D, 0xC3, 0x34,
+0xC1, 0x2D, 0x28, 0x20, 0x28, 0xC0, 0x3C, 0x10, 0xC0, 0x08, 0x0D, 0x10, 0x1C, 0x0D, 0x10, 0x15, 0x01, 0x20, 0x19, 0x28, 0x05, 0x34, 0x29, 0xC1,
+0x24, 0xC0, 0x29, 0xCE, 0x24, 0xC0, 0x10, 0x28, 0x05, 0x0C, 0x14, 0x19, 0xC0, 0x0C, 0x14, 0x2D, 0x24, 0xC1, 0x10, 0x20, 0x05, 0x14, 0x20, 0x19,
+0x0C, 0x14, 0x28, 0x1C, 0x24, 0xC0, 0x2D, 0x14, 0xC0, 0x28, 0x19, 0x0C, 0x14, 0x3C, 0x1C, 0x10, 0x28, 0x19, 0x28, 0xC0, 0x19, 0x28, 0x10, 0x1C,
+0x01, 0x08, 0x0D, 0x3C, 0x10, 0x24, 0xC2, 0x34, 0x3C, 0x24, 0xC0, 0x14, 0x05, 0x10, 0x24, 0x0C, 0x14, 0x10, 0x20, 0x28, 0xC0, 0x19, 0x28, 0x19,
+0xC4, 0x14, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x28, 0x34, 0x3C, 0x01, 0xC3, 0x3C, 0xC7, 0x01, 0xC2, 0x08, 0x10, 0xC0, 0x3C, 0x2D, 0xC0, 0x34, 0x28,
+0x14, 0xC0, 0x05, 0x00, 0x05, 0x28, 0x15, 0x01, 0x20, 0x24, 0xC0, 0x34, 0x2D, 0x24, 0xC0, 0x28, 0x15, 0x24, 0x0D, 0x2D, 0x24, 0xC0, 0x3C, 0x01,
+0x24, 0xC0, 0x34, 0x24, 0xC0, 0x08, 0x01, 0x24, 0xC0, 0x01, 0x24, 0xC1, 0x15, 0x24, 0xC6, 0x2D, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x19, 0xC1, 0x20,
+0xC0, 0x28, 0xC2, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0xC5, 0x01, 0x3C, 0x01, 0x3C, 0x24, 0x21, 0x28, 0x2D, 0x34, 0x2D, 0xC0, 0x34, 0xC0, 0x2D, 0x28,
+0xC0, 0x20, 0xC0, 0x2D, 0x08, 0x10, 0x08, 0x10, 0xC0, 0x0D, 0x10, 0xC0, 0x15, 0x08, 0x20, 0x19, 0x28, 0x05, 0x2D, 0x24, 0xD4, 0x3C, 0x14, 0x05,
+0xC0, 0x14, 0xC1, 0x0C, 0x19, 0x01, 0x15, 0xC1, 0x08, 0x19, 0x05, 0x14, 0x19, 0xC0, 0x0C, 0x14, 0x28, 0x15, 0xC1, 0x2D, 0x0C, 0x14, 0x28, 0x19,
+0x14, 0xC0, 0x2D, 0x15, 0xC0, 0x3C, 0x14, 0x19, 0x28, 0x19, 0x14, 0x3C, 0x15, 0x10, 0x34, 0x3C, 0xC0, 0x34, 0x0D, 0x15, 0xC2, 0x08, 0x34, 0x15,
+0xC0, 0x28, 0x0C, 0x19, 0x15, 0x10, 0x00, 0x34, 0x10, 0x14, 0x28, 0xC0, 0x19, 0x28, 0x19, 0xC4, 0x14, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x28, 0x34,
+0x01, 0xC0, 0x08, 0x01, 0xC1, 0x3C, 0xC6, 0x01, 0x3C, 0x01, 0xC2, 0x08, 0x10, 0xC0, 0x01, 0x3C, 0xC1, 0x08, 0x10, 0x01, 0x28, 0x14, 0xC0, 0x05,
+0x00, 0xC1, 0x2D, 0x00, 0xC0, 0x15, 0xC0, 0x05, 0x28, 0x15, 0x28, 0x14, 0x15, 0xC0, 0x19, 0x14, 0x15, 0x10, 0x14, 0x3C, 0x15, 0x19, 0x14, 0x15,
+0xC0, 0x14, 0xC0, 0x15, 0x39, 0x05, 0x01, 0x15, 0x0C, 0x14, 0x15, 0xC0, 0x28, 0x15, 0x01, 0x00, 0xC0, 0x05, 0xC0, 0x14, 0x19, 0xC1, 0x20, 0xC0,
+0x28, 0xC2, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0xC5, 0x01, 0x3C, 0xC0, 0x08, 0x15, 0x08, 0x2D, 0x34, 0xC0, 0x2D, 0xC0, 0x34, 0xC0, 0x28, 0xC1, 0x20,
+0x28, 0x01, 0x10, 0x08, 0x10, 0x15, 0xC0, 0x10, 0x08, 0x10, 0xC0, 0x28, 0x14, 0x28, 0x14, 0x28, 0x15, 0xD5, 0x05, 0x14, 0xC1, 0x05, 0x14, 0x28,
+0x15, 0xC2, 0x3C, 0x14, 0x05, 0x14, 0xC1, 0x05, 0x14, 0x2D, 0x15, 0xC1, 0x34, 0x0C, 0x05, 0x19, 0xC0, 0x14, 0x05, 0x28, 0x15, 0xC0, 0x08, 0x14,
+0x0C, 0x19, 0x20, 0x14, 0x20, 0x10, 0x15, 0x08, 0x20, 0x28, 0x34, 0x2D, 0x0D, 0x15, 0xC2, 0x10, 0x34, 0x15, 0xC0, 0x34, 0x19, 0x0C, 0x15, 0xC0,
+0x14, 0xC0, 0x15, 0x2D, 0x14, 0x2D, 0x19, 0x28, 0x19, 0xC4, 0x14, 0x19, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x28, 0x3C, 0xC0, 0x01, 0x08, 0x01, 0xC1,
+0x3C, 0xC5, 0x01, 0xC0, 0x3C, 0xC0, 0x01, 0x08, 0xC0, 0x01, 0x10, 0x08, 0x01, 0x10, 0x08, 0x3C, 0xC0, 0x08, 0x15, 0xC2, 0x08, 0x28, 0x19, 0x14,
+0x05, 0xC0, 0x00, 0x14, 0x28, 0xC0, 0x3C, 0x15, 0xD5, 0x10, 0x2D, 0x15, 0xC0, 0x19, 0x2D, 0x28, 0x00, 0xC1, 0x05, 0x14, 0xC0, 0x19, 0xC0, 0x20,
+0xC0, 0x28, 0xC2, 0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0xC8, 0x15, 0xC0, 0x39, 0x2D, 0xC0, 0x34, 0xC0, 0x2D, 0x34, 0x2D, 0x28, 0xC2, 0x3C, 0x10, 0xC2,
+0x15, 0x10, 0x0D, 0xC0, 0x10, 0x34, 0x14, 0x28, 0x14, 0x19, 0x15, 0xD4, 0x10, 0x15, 0x14, 0x0C, 0x05, 0x19, 0x34, 0x10, 0xC2, 0x2D, 0x05, 0x00,
+0x14, 0xC1, 0x05, 0x14, 0x3C, 0x10, 0xC1, 0x3C, 0x14, 0x00, 0x14, 0xC1, 0x0C, 0x20, 0x10, 0xC1, 0x28, 0x05, 0x14, 0x28, 0x14, 0xC0, 0x34, 0x10,
+0xC0, 0x34, 0x19, 0x28, 0x2D, 0x28, 0x08, 0x10, 0xC3, 0x01, 0x10, 0xC0, 0x08, 0x28, 0x14, 0x2D, 0x10, 0x2D, 0x00, 0x2D, 0x10, 0x14, 0x28, 0xC0,
+0x19, 0x28, 0x20, 0x19, 0xC5, 0x00, 0xC1, 0x05, 0x14, 0x19, 0x28, 0x3C, 0xC1, 0x01, 0xC2, 0x3C, 0xC7, 0x01, 0x3C, 0x01, 0xC0, 0x08, 0xC5, 0x10,
+0x0D, 0x01, 0x39, 0x3C, 0x10, 0xC5, 0x3C, 0x20, 0x19, 0x14, 0x05, 0xC0, 0x00, 0x28, 0x01, 0x28, 0x20, 0x10, 0xC0, 0x20, 0x3C, 0x10, 0xC0, 0x19,
+0x10, 0xC0, 0x34, 0x28, 0x10, 0xC0, 0x2D, 0x10, 0xC1, 0x01, 0x10, 0xC4, 0x14, 0x00, 0xC1, 0x05, 0x14, 0xC0, 0x19, 0xC0, 0x20, 0xC0, 0x28, 0xC2,
+0x2D, 0xC0, 0x34, 0xC0, 0x3C, 0xC6, 0x01, 0xC0, 0x10, 0xC0, 0x2D, 0xC1, 0x34, 0xC0, 0x2D, 0x34, 0x2D, 0x28, 0x20, 0x28, 0x3C, 0x01, 0x10, 0xC3,
+0x08, 0xC0, 0x10, 0x3C, 0x20, 0x28, 0x19, 0x14, 0x10, 0xD7, 0x14, 0x28, 0x01, 0x7A, 0x5E, 0xC0, 0x01, 0x19, 0x05, 0xC0, 0x14, 0xC0, 0x0C, 0x05,
+0x19, 0x3C, 0x01, 0x06, 0xC0, 0x34, 0x05, 0xC0, 0x19, 0x14, 0xC0, 0x0C, 0x19, 0x01, 0xC1, 0x2D, 0x05, 0x0C, 0x19, 0x14, 0xC1, 0x01, 0xC1, 0x19,
+0x14, 0x28, 0xC1, 0x06, 0xC0, 0x01, 0x04, 0x01, 0xC3, 0x08, 0x3C, 0x20, 0x19, 0x01, 0xC0, 0x05, 0xC0, 0x01, 0xC0, 0x05, 0x28, 0xC0, 0x20, 0xC2,
+0x19, 0xC4, 0x00, 0xC2, 0x14, 0x19, 0x28, 0x34, 0x3C, 0xC0, 0x01, 0xC2, 0x3C, 0xC9, 0x01, 0xCA, 0x08, 0xC0, 0x3C, 0x34, 0x39, 0x3C, 0x06, 0x01,
+0x04, 0x0B, 0x01, 0xC2, 0x3C, 0x19, 0x14, 0xC0, 0x05, 0x00, 0xC0, 0x05, 0x00, 0xC0, 0x01, 0x3C, 0x05, 0x01, 0x06, 0x20, 0x14, 0x01, 0xC0, 0x19,
+0x25, 0x01, 0x2D, 0x14, 0x04, 0x01, 0x14, 0x05, 0x01, 0xC0, 0x00, 0xC2, 0x05, 0xC0, 0x19, 0xC2, 0x28, 0xC2, 0x2D, 0xC2, 0x34, 0x3C, 0xC5, 0x01,
+0x3C, 0x01, 0xC1, 0x34, 0x2D, 0x34, 0xC1, 0x2D, 0xC0, 0x28, 0xC0, 0x20, 0x34, 0x04, 0x01, 0xC4, 0x08, 0x01, 0x3C, 0x19, 0x28, 0xC0, 0x00, 0x08,
+0x01, 0xC0, 0x0D, 0x01, 0xC1, 0x08, 0xC0, 0x01, 0xC2, 0x08, 0x01, 0x06, 0xC0, 0x01, 0xC2, 0x08, 0x01, 0xC7, 0x14, 0x05, 0x0C, 0x14, 0x19, 0x05,
+0xC0, 0x20, 0x01, 0xC2, 0x3C, 0x05, 0xC0, 0x14, 0x19, 0x14, 0x05, 0x19, 0x01, 0xC2, 0x0C, 0x05, 0x14, 0x19, 0x14, 0x0C, 0x34, 0x01, 0xC0, 0x3C,
+0x0C, 0x14, 0x28, 0xC1, 0x01, 0xC4, 0x3C, 0x01, 0xC2, 0x2D, 0x14, 0x01, 0xC0, 0x19, 0x00, 0x28, 0x01, 0x20, 0x14, 0x3C, 0x19, 0x20, 0xC1, 0x19,
+0xC5, 0x00, 0xC2, 0x14, 0x19, 0x28, 0x34, 0x3C, 0x01, 0xC3, 0x3C, 0xC7, 0x01, 0xC6, 0x3C, 0x01, 0xC9, 0x3C, 0xC2, 0x01, 0xC7, 0x34, 0x19, 0x14,
+0xC0, 0x05, 0x00, 0x14, 0x19, 0x2D, 0x01, 0xCD, 0x14, 0x00, 0xC2, 0x05, 0xC0, 0x19, 0xC2, 0x28, 0xC2, 0x2D, 0xC2, 0x34, 0x3C, 0xC5, 0x01, 0x39,
+0x01, 0xC0, 0x39, 0x34, 0x2D, 0x34, 0xC0, 0x2D, 0xC0, 0x28, 0xC0, 0x20, 0x28, 0x01, 0xC8, 0x28, 0x20, 0x28, 0x00, 0x01, 0xD0, 0x3C, 0x05, 0xC0,
+0x00, 0xA2, 0x67, 0x01, 0xC2, 0x3C, 0xC0, 0x28, 0x05, 0xC0, 0x14, 0xC1, 0x05, 0x14, 0x28, 0x3C, 0xC2, 0x34, 0x05, 0xC0, 0x14, 0xC1, 0x05, 0x19,
+0x3C, 0xC2, 0x14, 0x00, 0x0C, 0x20, 0x14, 0xC0, 0x20, 0x3C, 0xC1, 0x20, 0x05, 0x19, 0x20, 0xC0, 0x2D, 0x3C, 0xCA, 0x20, 0x3C, 0xC1, 0x0C, 0x05,
+0x3C, 0xC0, 0x00, 0x2D, 0x3C, 0x14, 0x28, 0x20, 0xC0, 0x19, 0xC3, 0x14, 0x19, 0x00, 0xC2, 0x14, 0x19, 0x28, 0x3C, 0xE8, 0x34, 0xC0, 0x39, 0x3C,
+0xC7, 0x2D, 0x19, 0x14, 0xC0, 0x05, 0xC0, 0x14, 0x05, 0x14, 0x3C, 0xC0, 0x14, 0x3C, 0xC4, 0x19, 0x00, 0xC3, 0x05, 0xC0, 0x19, 0xC2, 0x28, 0xC2,
+0x2D, 0xC1, 0x34, 0xC0, 0x3C, 0xC9, 0x34, 0xC0, 0x2D, 0xC0, 0x34, 0x2D, 0xC0, 0x28, 0xC1, 0x34, 0x3C, 0xC7, 0x2D, 0x19, 0x28, 0x14, 0x2D, 0x3C,
+0xCF, 0x20, 0x0C, 0x3C, 0xC0, 0x59, 0x19, 0x00, 0x3C, 0xC1, 0x14, 0x00, 0x14, 0xC2, 0x05, 0x14, 0x2D, 0x7E, 0x34, 0xC0, 0x3C, 0x2D, 0x00, 0x05,
+0x14, 0xC1, 0x00, 0x19, 0x34, 0xC0, 0x39, 0x35, 0x28, 0x00, 0x0C, 0x14, 0x19, 0x0C, 0x14, 0x32, 0x35, 0x66, 0x35, 0x00, 0x0C, 0x20, 0x19, 0x14,
+0x35, 0x2D, 0xC0, 0x32, 0x28, 0x35, 0x2D, 0x35, 0xC0, 0x2D, 0x35, 0x2D, 0xC0, 0x28, 0x39, 0x3C, 0xC0, 0x14, 0x0C, 0x2D, 0xC0, 0x20, 0x05, 0x3C,
+0x28, 0x20, 0x28, 0x20, 0xC2, 0x19, 0xC1, 0x14, 0x19, 0x05, 0x00, 0xC1, 0x14, 0x19, 0x28, 0x34, 0x32, 0x39, 0xC2, 0x34, 0xC0, 0x3C, 0x35, 0x39,
+0xC0, 0x32, 0x3C, 0xC0, 0x35, 0x39, 0xC0, 0x3C, 0x39, 0x76, 0xC1, 0x39, 0xC1, 0x37, 0x39, 0xC1, 0x35, 0xC0, 0x32, 0x39, 0x3C, 0xC0, 0x39, 0xC1,
+0x35, 0x32, 0x35, 0xC0, 0x2D, 0x37, 0xC0, 0x34, 0x35, 0x30, 0x37, 0x3C, 0xC1, 0x35, 0xC2, 0x2D, 0xC0, 0x28, 0x19, 0xC0, 0x14, 0xC0, 0x05, 0x00,
+0xC0, 0x14, 0x00, 0xC7, 0x05, 0x00, 0x05, 0x19, 0xC2, 0x28, 0xC2, 0x2D, 0x28, 0x2D, 0xC0, 0x34, 0xC1, 0x37, 0x3C, 0xC0, 0x32, 0x35, 0x3C, 0xC0,
+0x35, 0xC0, 0x2D, 0xC4, 0x28, 0xC0, 0x20, 0x2D, 0x35, 0xC0, 0x39, 0x34, 0xC0, 0x30, 0x35, 0xC0, 0x32, 0x34, 0x19, 0x28, 0x19, 0x14, 0x32, 0x3C,
+0x34, 0x39, 0xC0, 0x32, 0x3C, 0xC0, 0x39, 0x37, 0x3C, 0xC0, 0x37, 0x39, 0xC0, 0x2D, 0x39, 0x3C, 0xC0, 0x28, 0x32, 0xC0, 0x35, 0xC0, 0x00, 0x0C,
+0x3C, 0x37, 0x14, 0xC1, 0x0C, 0x05, 0x19, 0x2D, 0xC3, 0x28, 0x00, 0x05, 0x14, 0xC0, 0x0C, 0x05, 0x19, 0x2D, 0xC3, 0x05, 0xC0, 0x19, 0x14, 0x0C,
+0x14, 0x2D, 0xC2, 0x14, 0x00, 0x14, 0x20, 0x14, 0x20, 0x2D, 0xC1, 0x28, 0x14, 0x2D, 0xCA, 0x28, 0x14, 0xC0, 0x2D, 0xC0, 0x00, 0x28, 0x2D, 0x14,
+0x28, 0xC1, 0x19, 0xC4, 0x14, 0x19, 0x05, 0x00, 0xC1, 0x14, 0x19, 0x28, 0x2D, 0xFD, 0xC2, 0x19, 0x14, 0x05, 0x00, 0xC8, 0x05, 0x14, 0x19, 0xC1,
+0x28, 0xC2, 0x2D, 0x28, 0x2D, 0xD2, 0x28, 0xC1, 0x2D, 0xC8, 0x19, 0x28, 0x20, 0x00, 0x2D, 0xD2, 0x19, 0xC0, 0x2D, 0xC1, 0x19, 0x2D, 0xC1, 0x14,
+0x05, 0x14, 0x28, 0xC4, 0x19, 0x00, 0x14, 0xC2, 0x05, 0x19, 0x28, 0xC3, 0x05, 0xC0, 0x14, 0xC1, 0x05, 0x28, 0xC3, 0x00, 0x0C, 0x19, 0xC0, 0x14,
+0x28, 0xC2, 0x14, 0xC0, 0x28, 0xCB, 0x20, 0x0C, 0x28, 0xC0, 0x20, 0x0C, 0x28, 0xC0, 0x19, 0x28, 0x19, 0x28, 0x19, 0xC6, 0x05, 0x00, 0xC1, 0x05,
+0x19, 0x28, 0xFD, 0xC6, 0x19, 0x05, 0x00, 0xC3, 0x05, 0xC0, 0x00, 0xC0, 0x14, 0x19, 0xC1, 0x28, 0xE5, 0x19, 0x28, 0x00, 0x28, 0xCD, 0x05, 0x28,
+0xCC, 0x19, 0x28, 0xC4, 0x14, 0x00, 0x0C, 0x19, 0xC0, 0x05, 0xC0, 0x28, 0xC4, 0x05, 0xC0, 0x14, 0xC1, 0x00, 0x20, 0x28, 0xC2, 0x05, 0xC0, 0x14,
+0x19, 0x0C, 0x14, 0x28, 0xC2, 0x0C, 0x14, 0x28, 0xCC, 0x14, 0x20, 0x28, 0xC0, 0x00, 0x28, 0xC0, 0x14, 0x28, 0xC0, 0x69, 0x19, 0xC6, 0x28, 0x05,
+0x00, 0xC1, 0x05, 0x19, 0x28, 0xFD, 0xC8, 0x25, 0x19, 0x14, 0xC1, 0x05, 0xC1, 0x00, 0x14, 0x19, 0xC1, 0x28, 0xE4, 0x19, 0x28, 0x14, 0x19, 0x28,
+0xCE, 0x00, 0x28, 0xCB, 0x19, 0xC3, 0x05, 0x00, 0x14, 0x19, 0x14, 0x0C, 0x05, 0x19, 0xC4, 0x05, 0xC0, 0x14, 0x19, 0x14, 0x05, 0x19, 0xC3, 0x14,
+0x05, 0x14, 0x19, 0x14, 0x05, 0x19, 0xC3, 0x00, 0x19, 0xD1, 0x14, 0x0C, 0x19, 0xC0, 0x14, 0x19, 0xC7, 0x14, 0x19, 0xC0, 0x05, 0x00, 0xC1, 0x14,
+0x19, 0xFD, 0xCD, 0x14, 0xC0, 0x05, 0xC0, 0x00, 0x05, 0x19, 0xE9, 0x05, 0x19, 0xD0, 0x00, 0x19, 0xCD, 0x00, 0x05, 0x14, 0xC1, 0x05, 0xC0, 0x19,
+0xC4, 0x05, 0xC0, 0x14, 0x19, 0x14, 0x05, 0x14, 0x19, 0xC3, 0x00, 0x0C, 0x19, 0xC0, 0x14, 0xC0, 0x19, 0xC2, 0x0C, 0xC0, 0x19, 0xD2, 0x00, 0x19,
+0xC0, 0x0C, 0x19, 0xCB, 0x05, 0x00, 0xC1, 0x14, 0x19, 0xFD, 0xCD, 0x14, 0x05, 0xC3, 0x19, 0xE8, 0x00, 0x19, 0xD2, 0x00, 0x19, 0xC9, 0x14, 0x05,
+0x14, 0xC2, 0x0C, 0x14, 0xC5, 0x0C, 0x00, 0x14, 0xC1, 0x05, 0x14, 0xC4, 0x00, 0x05, 0x14, 0xC1, 0x0C, 0x14, 0xC3, 0x00, 0x14, 0xD3, 0x00, 0x14,
+0xC1, 0x05, 0x14, 0xCB, 0x05, 0x00, 0xC0, 0x05, 0x14, 0xFD, 0xD0, 0x05, 0xC0, 0x00, 0xC0, 0x14, 0xFD, 0xCF, 0x0C, 0x14, 0xC5, 0x00, 0x0C, 0x14,
+0xC1, 0x0C, 0xC0, 0x14, 0xC3, 0x05, 0x00, 0x14, 0xC7, 0x00, 0x0C, 0x14, 0xD3, 0x0C, 0xC0, 0x14, 0xC0, 0x00, 0x14, 0xCD, 0x00, 0xC1, 0x05, 0x14,
+0xFD, 0xCF, 0x05, 0xC0, 0x00, 0xC0, 0x14, 0xE7, 0x00, 0x14, 0xDF, 0x05, 0xD5, 0x00, 0x05, 0xF4, 0x00, 0xC1, 0x05, 0xFD, 0xD2, 0x00, 0xC0, 0x05,
+0xFD, 0xFD, 0xCA, 0x00, 0x05, 0xCE, 0x00, 0xC1, 0x05, 0xFD, 0xD3, 0x00, 0x05, 0xFD, 0xFD, 0xDB, 0x00, 0xC1, 0x05, 0xFD, 0xD3, 0x00, 0x05, 0xE5,
+0x00, 0x05, 0xE1, 0x00, 0xC1, 0x05, 0xC0, 0x00, 0xCD, 0x05, 0x00, 0xC8, 0x05, 0xC0, 0x00, 0xC7, 0x05, 0xC0, 0x00, 0xCD, 0x05, 0xC0, 0x00, 0x05,
+0xC0, 0x00, 0xC2, 0x05, 0x00, 0xC4, 0x05, 0x00, 0xCF, 0x05, 0xC0, 0x00, 0xC6, 0x05, 0x00, 0xC5, 0x05, 0xC0, 0x00, 0xDF, 0x05, 0xC0, 0x00, 0xC1,
+0x05, 0x00, 0xC1, 0x05, 0x00, 0xC0, 0x05, 0x00, 0xC1, 0x05, 0x00, 0xC4, 0x05, 0xC0, 0x00, 0xDF, 0x05, 0xC0, 0x00, 0xC7, 0x05, 0xC0, 0x00, 0x05,
+0xC1, 0x00, 0x05, 0xC0, 0x00, 0xC1, 0x05, 0x00, 0xC5, 0x05, 0xC0, 0x00, 0xFD, 0xFD, 0xFD, 0xF7,
+};
@@ -0,0 +1,92 @@
+#include "BandRenderer.h"
+#include <esp_heap_caps.h>
+
+DisplayPresenter::Backend BandRenderer::backend;
+BandRenderer::BeginBand BandRenderer::beginBand = nullptr;
+bool BandRenderer::started = false;
+short BandRenderer::screenWidth = 0;
+short BandRenderer::screenHeight = 0;
+short BandRenderer::bandHeight = 0;
+uint8_t* BandRenderer::bands[2] = { nullptr, nullptr };
+
+unsigned long BandRenderer::frames = 0;
+unsigned long BandRenderer::totalFrameMicros = 0;
+unsigned long BandRenderer::lastFrameMicros = 0;
+unsigned long BandRenderer::maxFrameMicros = 0;
+
+bool BandRenderer::begin(const DisplayPresenter::Backend& inBackend, BeginBand inBeginBand, short width, short height, short bandRows)
+{
+    if(started)
+        return true;
+
+    backend = inBackend;
+    beginBand = inBeginBand;
+    screenWidth = width;
+    screenHeight = height;
+    bandHeight = bandRows;
+
+    // Band buffers have to be in internal memory for DMA
+    for(byte index = 0; index < 2; index++)
+    {
+        bands[index] = static_cast<uint8_t*>(heap_caps_malloc(width * bandRows * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+        if(bands[index] == nullptr)
+        {
+            DEBUG_ERROR("BandRenderer: Unable to allocate band buffers");
+
+            free(bands[0]);
+            bands[0] = nullptr;
+            return false;
+        }
+    }
+
+    started = true;
+
+    DEBUG_INFO("BandRenderer: %dx%d in bands of %d rows, %u bytes", width, height, bandRows, static_cast<unsigned int>(getBufferBytes()));
+
+    return true;
+}
+
+void BandRenderer::render(DrawScreen drawScreen)
+{
+    if(!started)
+        return;
+
+    unsigned long start = micros();
+
+    backend.beginTransfers();
+
+    byte band = 0;
+    for(short top = 0; top < screenHeight; top += bandHeight)
+    {
+        short rows = min(bandHeight, static_cast<short>(screenHeight - top));
+
+        // This buffer's last transfer finished before the other one's started
+        beginBand(bands[band], top, rows);
+        drawScreen();
+
+        waitForTransfer();
+        backend.transfer(0, top, screenWidth, rows, reinterpret_cast<const uint16_t*>(bands[band]));
+
+        band ^= 1;
+    }
+
+    waitForTransfer();
+    backend.endTransfers();
+
+    lastFrameMicros = micros() - start;
+    totalFrameMicros += lastFrameMicros;
+    if(lastFrameMicros > maxFrameMicros)
+        maxFrameMicros = lastFrameMicros;
+    frames++;
+}
+
+void BandRenderer::waitForTransfer()
+{
+    // A band goes out in a millisecond or two, not worth giving up the rest of a tick for
+    while(backend.busy());
+}
+
+void BandRenderer::reportStats(size_t fullFrameBytes)
+{
+    DEBUG_INFO("BandRenderer: %u bytes of band buffers (a full frame is %u bytes), %lu frames, last %luus, average %luus, slowest %luus", static_cast<unsigned int>(getBufferBytes()), static_cast<unsigned int>(fullFrameBytes), frames, lastFrameMicros, frames > 0 ? totalFrameMicros / frames : 0, maxFrameMicros);
+}
@@ -0,0 +1,50 @@
+#ifndef BANDRENDERER_H
+#define BANDRENDERER_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+#include "UI/DisplayPresenter.h"
+
+// Draws a screen a band of rows at a time into a small buffer and sends each band to the display, for boards without the memory
+// for a full screen sprite (the M5Stack Grey has no PSRAM). The screen's draw function is called once per band with drawing clipped
+// to that band, so it must only draw (no camera commands or other side effects). There are two band buffers, the next band is drawn
+// into one while the last goes out over DMA from the other, and the display only ever receives finished rows so there's no flashing.
+class BandRenderer
+{
+    public:
+        // Points the screen's drawing at buffer, which holds rows starting at top (16 bit pixels in the display's byte order)
+        typedef void (*BeginBand)(uint8_t* buffer, short top, short rows);
+        typedef void (*DrawScreen)();
+
+        // Uses the same transfers as the display presenter
+        static bool begin(const DisplayPresenter::Backend& inBackend, BeginBand inBeginBand, short width, short height, short bandRows);
+        static bool isStarted() { return started; }
+
+        static void render(DrawScreen drawScreen);
+
+        static size_t getBufferBytes() { return started ? 2 * static_cast<size_t>(screenWidth) * bandHeight * sizeof(uint16_t) : 0; }
+        static unsigned long getFrames() { return frames; }
+        static unsigned long getLastFrameMicros() { return lastFrameMicros; }
+        static unsigned long getMaxFrameMicros() { return maxFrameMicros; }
+
+        // Logs the band buffers' memory and the frame times, against the full frame buffer they replace
+        static void reportStats(size_t fullFrameBytes);
+
+    private:
+        static void waitForTransfer();
+
+        static DisplayPresenter::Backend backend;
+        static BeginBand beginBand;
+        static bool started;
+        static short screenWidth;
+        static short screenHeight;
+        static short bandHeight;
+        static uint8_t* bands[2];
+
+        static unsigned long frames;
+        static unsigned long totalFrameMicros;
+        static unsigned long lastFrameMicros;
+        static unsigned long maxFrameMicros;
+};
+
+#endif
@@ -0,0 +1,201 @@
+#include "CodecScreen.h"
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    typedef CCUPacketTypes::CodecVariants Variants;
+
+    // BRAW settings in the order of the four buttons
+    const byte kBRAWBitrate[] = { Variants::kBRAW3_1, Variants::kBRAW5_1, Variants::kBRAW8_1, Variants::kBRAW12_1 };
+    const byte kBRAWQuality[] = { Variants::kBRAWQ0, Variants::kBRAWQ1, Variants::kBRAWQ3, Variants::kBRAWQ5 };
+    const char* const kBRAWBitrateText[] = { "3:1", "5:1", "8:1", "12:1" };
+    const char* const kBRAWQualityText[] = { "Q0", "Q1", "Q3", "Q5" };
+    const byte kBRAWSettingCount = 4;
+
+    // ProRes settings as the Grey's button steps through them
+    const byte kProRes[] = { Variants::kProRes444XQ, Variants::kProRes444, Variants::kProResHQ, Variants::kProRes422, Variants::kProResLT, Variants::kProResProxy };
+    const byte kProResCount = sizeof(kProRes) / sizeof(kProRes[0]);
+    const byte kProRes444Count = 2; // The first two, only on cameras with them
+
+    // Button values that aren't settings, BRAW setting buttons are kBRAWSetting + their index and ProRes ones kProResSetting + variant
+    const int kBRAW = 1;
+    const int kProResCodec = 2;
+    const int kBitrate = 3;
+    const int kQuality = 4;
+    const int kBRAWSetting = 100;
+    const int kProResSetting = 200;
+
+    const byte kTitleIndex = 0;
+    const byte kBRAWIndex = 1;
+    const byte kProResIndex = 2;
+    const byte kBitrateIndex = 3;
+    const byte kQualityIndex = 4;
+    const byte kBRAWSettingIndex = 5;  // First of four
+    const byte kProResIndexes = 9;     // First of the four without 444
+    const byte kProRes444Indexes = 13; // First of the six with 444
+
+    bool isBitrate(byte variant)
+    {
+        return variant >= Variants::kBRAW3_1 && variant <= Variants::kBRAW18_1;
+    }
+}
+
+const UIWidgetSpec CodecScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,     30,   9, 120, 16, "CODEC",   nullptr,    0 },
+
+    { UIWidgetType::Button,    20,  30, 145, 40, "BRAW",    nullptr,    kBRAW },
+    { UIWidgetType::Button,   170,  30, 145, 40, "ProRes",  nullptr,    kProResCodec },
+
+    // BRAW, the setting buttons' text is the bitrate or quality
+    { UIWidgetType::Button,    20,  75, 145, 40, "BITRATE", "CONSTANT", kBitrate },
+    { UIWidgetType::Button,   170,  75, 145, 40, "QUALITY", "CONSTANT", kQuality },
+    { UIWidgetType::Button,    20, 120,  70, 40, "",        nullptr,    kBRAWSetting },
+    { UIWidgetType::Button,    95, 120,  70, 40, "",        nullptr,    kBRAWSetting + 1 },
+    { UIWidgetType::Button,   170, 120,  70, 40, "",        nullptr,    kBRAWSetting + 2 },
+    { UIWidgetType::Button,   245, 120,  70, 40, "",        nullptr,    kBRAWSetting + 3 },
+
+    // ProRes
+    { UIWidgetType::Button,    20,  75, 145, 40, "HQ",      nullptr,    kProResSetting + Variants::kProResHQ },
+    { UIWidgetType::Button,   170,  75, 145, 40, "422",     nullptr,    kProResSetting + Variants::kProRes422 },
+    { UIWidgetType::Button,    20, 120, 145, 40, "LT",      nullptr,    kProResSetting + Variants::kProResLT },
+    { UIWidgetType::Button,   170, 120, 145, 40, "PXY",     nullptr,    kProResSetting + Variants::kProResProxy },
+
+    // ProRes with 444
+    { UIWidgetType::Button,    20,  75,  95, 40, "XQ",      nullptr,    kProResSetting + Variants::kProRes444XQ },
+    { UIWidgetType::Button,   120,  75,  95, 40, "444",     nullptr,    kProResSetting + Variants::kProRes444 },
+    { UIWidgetType::Button,   220,  75,  95, 40, "HQ",      nullptr,    kProResSetting + Variants::kProResHQ },
+    { UIWidgetType::Button,    20, 120,  95, 40, "422",     nullptr,    kProResSetting + Variants::kProRes422 },
+    { UIWidgetType::Button,   120, 120,  95, 40, "LT",      nullptr,    kProResSetting + Variants::kProResLT },
+    { UIWidgetType::Button,   220, 120,  95, 40, "PXY",     nullptr,    kProResSetting + Variants::kProResProxy }
+};
+
+UIScreen CodecScreen::screen(CodecScreen::kWidgets, sizeof(CodecScreen::kWidgets) / sizeof(CodecScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+CodecInfo CodecScreen::codec = CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW3_1);
+bool CodecScreen::proRes444 = false;
+
+bool CodecScreen::update(const CodecInfo* currentCodec, bool inProRes444)
+{
+    bool hasCodec = currentCodec != nullptr;
+    if(hasCodec)
+        codec = *currentCodec;
+
+    proRes444 = inProRes444;
+
+    bool changed = screen.setText(kTitleIndex, hasCodec ? "CODEC" : "NO CODEC INFO.");
+
+    bool isBRAW = hasCodec && codec.basicCodec == CCUPacketTypes::BasicCodec::BRAW;
+    bool isProRes = hasCodec && codec.basicCodec == CCUPacketTypes::BasicCodec::ProRes;
+    bool bitrate = isBitrate(codec.codecVariant);
+
+    changed = screen.setVisible(kBRAWIndex, hasCodec) || changed;
+    changed = screen.setVisible(kProResIndex, hasCodec) || changed;
+    changed = screen.setSelected(kBRAWIndex, isBRAW) || changed;
+    changed = screen.setSelected(kProResIndex, isProRes) || changed;
+
+    // BRAW
+    changed = screen.setVisible(kBitrateIndex, isBRAW) || changed;
+    changed = screen.setVisible(kQualityIndex, isBRAW) || changed;
+    changed = screen.setSelected(kBitrateIndex, bitrate) || changed;
+    changed = screen.setSelected(kQualityIndex, !bitrate) || changed;
+
+    for(byte setting = 0; setting < kBRAWSettingCount; setting++)
+    {
+        byte index = kBRAWSettingIndex + setting;
+        byte variant = bitrate ? kBRAWBitrate[setting] : kBRAWQuality[setting];
+
+        changed = screen.setVisible(index, isBRAW) || changed;
+        changed = screen.setText(index, bitrate ? kBRAWBitrateText[setting] : kBRAWQualityText[setting]) || changed;
+        changed = screen.setSelected(index, codec.codecVariant == variant) || changed;
+    }
+
+    // ProRes, with or without the 444 buttons
+    for(byte index = kProResIndexes; index < screen.getCount(); index++)
+    {
+        bool visible = isProRes && (index >= kProRes444Indexes) == proRes444;
+
+        changed = screen.setVisible(index, visible) || changed;
+        changed = screen.setSelected(index, screen.getNode(index).value == kProResSetting + codec.codecVariant) || changed;
+    }
+
+    return changed;
+}
+
+bool CodecScreen::hitTest(int x, int y, const BMDCamera& camera, CodecInfo& newCodec)
+{
+    int index = screen.hitTest(x, y);
+    if(index == -1)
+        return false;
+
+    int value = screen.getNode(index).value;
+    bool bitrate = isBitrate(codec.codecVariant);
+
+    if(value == kBRAW || value == kProResCodec)
+    {
+        // Switching between BRAW and ProRes, to the last known setting
+        // Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023
+        if(screen.getNode(index).selected)
+            return false;
+
+        newCodec = getOtherCodec(camera);
+    }
+    else if(value == kBitrate || value == kQuality)
+    {
+        // Constant bitrate or constant quality, nothing to do if it's already on it
+        if((value == kBitrate) == bitrate)
+            return false;
+
+        newCodec = value == kBitrate ? camera.lastKnownBRAWBitrate : camera.lastKnownBRAWQuality;
+    }
+    else if(value >= kProResSetting)
+        newCodec = CodecInfo(CCUPacketTypes::BasicCodec::ProRes, static_cast<byte>(value - kProResSetting));
+    else
+    {
+        byte setting = value - kBRAWSetting;
+        newCodec = CodecInfo(CCUPacketTypes::BasicCodec::BRAW, bitrate ? kBRAWBitrate[setting] : kBRAWQuality[setting]);
+    }
+
+    return true;
+}
+
+CodecInfo CodecScreen::getOtherCodec(const BMDCamera& camera)
+{
+    if(codec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
+        return camera.lastKnownProRes;
+    else
+        return camera.lastKnownBRAWIsBitrate ? camera.lastKnownBRAWBitrate : camera.lastKnownBRAWQuality;
+}
+
+CodecInfo CodecScreen::getNextSetting()
+{
+    if(codec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
+    {
+        // Bitrates then qualities, a setting without a button (e.g. 18:1) goes to the first
+        byte all[kBRAWSettingCount * 2];
+        memcpy(all, kBRAWBitrate, kBRAWSettingCount);
+        memcpy(all + kBRAWSettingCount, kBRAWQuality, kBRAWSettingCount);
+
+        byte next = 0;
+        for(byte index = 0; index < kBRAWSettingCount * 2; index++)
+        {
+            if(all[index] == codec.codecVariant)
+                next = (index + 1) % (kBRAWSettingCount * 2);
+        }
+
+        return CodecInfo(CCUPacketTypes::BasicCodec::BRAW, all[next]);
+    }
+
+    byte first = proRes444 ? 0 : kProRes444Count;
+    byte next = first;
+    for(byte index = first; index < kProResCount; index++)
+    {
+        if(kProRes[index] == codec.codecVariant)
+            next = index + 1 < kProResCount ? index + 1 : first;
+    }
+
+    return CodecInfo(CCUPacketTypes::BasicCodec::ProRes, kProRes[next]);
+}
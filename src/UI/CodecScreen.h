@@ -0,0 +1,39 @@
+#ifndef CODECSCREEN_H
+#define CODECSCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+#include "Camera/BMDCamera.h"
+
+// The codec screen's widgets and behaviour, shared by every board: BRAW / ProRes, then BRAW's constant bitrate or quality and
+// its setting, or the ProRes setting. The URSA Mini Pro G2 adds ProRes 444 XQ and 444.
+class CodecScreen
+{
+    public:
+        static void layout(short width, short height) { screen.layout(width, height); }
+
+        // Shows the camera's codec (nullptr when it hasn't sent it yet), returns true if that changed what's shown. proRes444 is for
+        // cameras with the 444 options.
+        static bool update(const CodecInfo* currentCodec, bool proRes444);
+
+        // The codec a tap at x, y changes to, returns false if it isn't on a button or it's already the codec
+        static bool hitTest(int x, int y, const BMDCamera& camera, CodecInfo& newCodec);
+
+        // For boards without touch, BRAW if it's ProRes and the other way around (each at their last known setting)
+        static CodecInfo getOtherCodec(const BMDCamera& camera);
+
+        // For boards without touch, the next setting of the current codec (wrapping around, BRAW goes through bitrate then quality)
+        static CodecInfo getNextSetting();
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+
+        // Codec shown by the last update
+        static CodecInfo codec;
+        static bool proRes444;
+};
+
+#endif
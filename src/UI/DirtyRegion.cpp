@@ -0,0 +1,82 @@
+#include "DirtyRegion.h"
+
+bool UIRect::intersects(const UIRect& other) const
+{
+    return x < other.x + other.w && other.x < x + w && y < other.y + other.h && other.y < y + h;
+}
+
+UIRect UIRect::unionWith(const UIRect& other) const
+{
+    if(isEmpty())
+        return other;
+    if(other.isEmpty())
+        return *this;
+
+    int left = x < other.x ? x : other.x;
+    int top = y < other.y ? y : other.y;
+    int right = x + w > other.x + other.w ? x + w : other.x + other.w;
+    int bottom = y + h > other.y + other.h ? y + h : other.y + other.h;
+
+    return UIRect(left, top, right - left, bottom - top);
+}
+
+DirtyRegion::DirtyRegion(short inScreenWidth, short inScreenHeight) : screenWidth(inScreenWidth), screenHeight(inScreenHeight)
+{
+}
+
+void DirtyRegion::add(const UIRect& rect)
+{
+    if(full || rect.isEmpty())
+        return;
+
+    // Merge with anything it overlaps, the merged rectangle may now overlap others so keep going until it doesn't
+    UIRect merged = rect;
+    bool mergedAny = true;
+    while(mergedAny)
+    {
+        mergedAny = false;
+        for(byte index = 0; index < count; index++)
+        {
+            if(rects[index].intersects(merged))
+            {
+                merged = merged.unionWith(rects[index]);
+                rects[index] = rects[--count];
+                mergedAny = true;
+                break;
+            }
+        }
+    }
+
+    if(count == kMaxRects)
+    {
+        full = true;
+        return;
+    }
+
+    rects[count++] = merged;
+
+    long changedArea = 0;
+    for(byte index = 0; index < count; index++)
+        changedArea += rects[index].area();
+
+    if(changedArea * 100 >= static_cast<long>(screenWidth) * screenHeight * kFullFramePercent)
+        full = true;
+}
+
+void DirtyRegion::clear()
+{
+    count = 0;
+    full = false;
+}
+
+size_t DirtyRegion::getPushBytes() const
+{
+    if(full)
+        return getFullFrameBytes();
+
+    size_t bytes = 0;
+    for(byte index = 0; index < count; index++)
+        bytes += static_cast<size_t>(rects[index].area()) * 2;
+
+    return bytes;
+}
@@ -0,0 +1,56 @@
+#ifndef DIRTYREGION_H
+#define DIRTYREGION_H
+
+#include <Arduino.h>
+
+// Screen rectangle in display pixels
+struct UIRect
+{
+    short x = 0;
+    short y = 0;
+    short w = 0;
+    short h = 0;
+
+    UIRect() {}
+    UIRect(short inX, short inY, short inW, short inH) : x(inX), y(inY), w(inW), h(inH) {}
+
+    bool isEmpty() const { return w <= 0 || h <= 0; }
+    bool contains(int pointX, int pointY) const { return pointX >= x && pointY >= y && pointX < x + w && pointY < y + h; }
+    bool intersects(const UIRect& other) const;
+    UIRect unionWith(const UIRect& other) const;
+    long area() const { return static_cast<long>(w) * h; }
+};
+
+// The areas of a frame that changed and need to be pushed to the display.
+// Overlapping rectangles are merged and once the changed area is most of the screen it becomes a full frame, one push is cheaper than many.
+class DirtyRegion
+{
+    public:
+        static const byte kMaxRects = 12;
+
+        DirtyRegion(short inScreenWidth, short inScreenHeight);
+
+        void add(const UIRect& rect);
+        void markFull() { full = true; }
+        void clear();
+
+        bool isEmpty() const { return !full && count == 0; }
+        bool isFull() const { return full; }
+        byte getCount() const { return count; }
+        const UIRect& getRect(byte index) const { return rects[index]; }
+
+        // Bytes that pushing this region at 16 bits per pixel sends to the display
+        size_t getPushBytes() const;
+        size_t getFullFrameBytes() const { return static_cast<size_t>(screenWidth) * screenHeight * 2; }
+
+    private:
+        static const byte kFullFramePercent = 70; // Push the whole frame once this much of the screen has changed
+
+        UIRect rects[kMaxRects];
+        byte count = 0;
+        bool full = false;
+        short screenWidth;
+        short screenHeight;
+};
+
+#endif
@@ -0,0 +1,319 @@
+#include "DisplayPresenter.h"
+#include <esp_heap_caps.h>
+#include <esp_freertos_hooks.h>
+
+DisplayPresenter::Backend DisplayPresenter::backend = { nullptr, nullptr, nullptr, nullptr };
+bool DisplayPresenter::started = false;
+short DisplayPresenter::screenWidth = 0;
+short DisplayPresenter::screenHeight = 0;
+DisplayPresenter::PixelFormat DisplayPresenter::pixelFormat = DisplayPresenter::PixelFormat::RGB565Swapped;
+byte DisplayPresenter::bytesPerPixel = 2;
+short DisplayPresenter::bandHeight = 0;
+
+uint8_t* DisplayPresenter::backBuffer = nullptr;
+uint16_t* DisplayPresenter::bands[2] = { nullptr, nullptr };
+uint16_t DisplayPresenter::rgb332ToSwapped565[256];
+
+const uint8_t* DisplayPresenter::source = nullptr;
+DirtyRegion DisplayPresenter::pendingRegion(0, 0);
+volatile bool DisplayPresenter::inFlight = false;
+
+TaskHandle_t DisplayPresenter::taskHandle = nullptr;
+SemaphoreHandle_t DisplayPresenter::frameReady = nullptr;
+SemaphoreHandle_t DisplayPresenter::sourceReleased = nullptr;
+SemaphoreHandle_t DisplayPresenter::frameDone = nullptr;
+
+DisplayPresenter::CompletionCallback DisplayPresenter::completionCallback = nullptr;
+unsigned long DisplayPresenter::frames = 0;
+unsigned long DisplayPresenter::fenceWaitMicros = 0;
+
+volatile bool DisplayPresenter::measuringIdle = false;
+unsigned long DisplayPresenter::lastIdleHook[2] = { 0, 0 };
+unsigned long DisplayPresenter::idleMicros[2] = { 0, 0 };
+unsigned long DisplayPresenter::idleMicrosAtLastFrame[2] = { 0, 0 };
+unsigned long DisplayPresenter::burstStart = 0;
+unsigned long DisplayPresenter::burstFrames = 0;
+unsigned long DisplayPresenter::firstFrameTime = 0;
+unsigned long DisplayPresenter::lastFrameTime = 0;
+float DisplayPresenter::burstFramesPerSecond = 0;
+byte DisplayPresenter::burstCpuIdlePercent[2] = { 0, 0 };
+
+bool DisplayPresenter::begin(const Backend& inBackend, short width, short height, PixelFormat format, short bandRows, bool doubleBuffered)
+{
+    if(started)
+        return true;
+
+    backend = inBackend;
+    screenWidth = width;
+    screenHeight = height;
+    pixelFormat = format;
+    bytesPerPixel = format == PixelFormat::RGB332 ? 1 : 2;
+    bandHeight = bandRows;
+
+    // Band buffers have to be in internal memory for DMA
+    for(byte index = 0; index < 2; index++)
+    {
+        bands[index] = static_cast<uint16_t*>(heap_caps_malloc(width * bandRows * sizeof(uint16_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL));
+        if(bands[index] == nullptr)
+        {
+            DEBUG_ERROR("DisplayPresenter: Unable to allocate band buffers");
+            return false;
+        }
+    }
+
+    if(doubleBuffered)
+    {
+        backBuffer = static_cast<uint8_t*>(heap_caps_malloc(width * height * bytesPerPixel, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if(backBuffer == nullptr)
+            DEBUG_INFO("DisplayPresenter: No memory for a back buffer, presenting single buffered");
+    }
+
+    if(format == PixelFormat::RGB332)
+    {
+        for(int colour = 0; colour < 256; colour++)
+        {
+            uint16_t red = (colour >> 5) & 0x07;
+            uint16_t green = (colour >> 2) & 0x07;
+            uint16_t blue = colour & 0x03;
+
+            uint16_t rgb565 = (((red << 2) | (red >> 1)) << 11) | (((green << 3) | green) << 5) | ((blue << 3) | (blue << 1) | (blue >> 1));
+            rgb332ToSwapped565[colour] = (rgb565 >> 8) | (rgb565 << 8);
+        }
+    }
+
+    frameReady = xSemaphoreCreateBinary();
+    sourceReleased = xSemaphoreCreateBinary();
+    frameDone = xSemaphoreCreateBinary();
+
+    esp_register_freertos_idle_hook_for_cpu(idleHookCore0, 0);
+#if portNUM_PROCESSORS > 1
+    esp_register_freertos_idle_hook_for_cpu(idleHookCore1, 1);
+#endif
+
+    // Core 0, the loop runs on core 1. Mostly waiting on DMA so it doesn't take much from the Bluetooth stack.
+    xTaskCreatePinnedToCore(presenterTask, "Presenter", 4096, nullptr, 2, &taskHandle, 0);
+
+    started = true;
+
+    DEBUG_INFO("DisplayPresenter: %dx%d, %d row bands, %s buffered", width, height, bandRows, backBuffer != nullptr ? "double" : "single");
+
+    return true;
+}
+
+void DisplayPresenter::present(const void* frameBuffer, const DirtyRegion& region)
+{
+    if(!started || region.isEmpty())
+        return;
+
+    // Fence, the back buffer and band buffers may still be going out with the previous frame
+    unsigned long waitStart = micros();
+    waitIdle();
+    fenceWaitMicros += micros() - waitStart;
+
+    if(!measuringIdle)
+        startBurst();
+
+    pendingRegion = region;
+
+    const uint8_t* frame = static_cast<const uint8_t*>(frameBuffer);
+    if(backBuffer != nullptr)
+    {
+        if(region.isFull())
+            memcpy(backBuffer, frame, screenWidth * screenHeight * bytesPerPixel);
+        else
+        {
+            for(byte index = 0; index < region.getCount(); index++)
+                copyRect(backBuffer, frame, region.getRect(index));
+        }
+
+        source = backBuffer;
+    }
+    else
+        source = frame;
+
+    inFlight = true;
+    xSemaphoreGive(frameReady);
+
+    // Single buffered, the screens can't draw until the frame buffer has been copied into the bands
+    if(backBuffer == nullptr)
+        xSemaphoreTake(sourceReleased, portMAX_DELAY);
+}
+
+void DisplayPresenter::presentFull(const void* frameBuffer)
+{
+    DirtyRegion region(screenWidth, screenHeight);
+    region.markFull();
+
+    present(frameBuffer, region);
+}
+
+void DisplayPresenter::waitIdle()
+{
+    // Short timeout as there may be more than one task waiting on the one semaphore
+    while(inFlight)
+        xSemaphoreTake(frameDone, 1);
+}
+
+void DisplayPresenter::presenterTask(void* parameter)
+{
+    while(true)
+    {
+        if(xSemaphoreTake(frameReady, pdMS_TO_TICKS(kBurstGapMs)) != pdTRUE)
+        {
+            if(measuringIdle)
+                endBurst();
+
+            continue;
+        }
+
+        transferRegion();
+
+        frames++;
+        burstFrames++;
+        lastFrameTime = micros();
+        if(burstFrames == 1)
+            firstFrameTime = lastFrameTime;
+
+        idleMicrosAtLastFrame[0] = idleMicros[0];
+        idleMicrosAtLastFrame[1] = idleMicros[1];
+
+        inFlight = false;
+        xSemaphoreGive(frameDone);
+
+        if(completionCallback != nullptr)
+            completionCallback(frames);
+    }
+}
+
+void DisplayPresenter::transferRegion()
+{
+    backend.beginTransfers();
+
+    bool full = pendingRegion.isFull();
+    byte rectCount = full ? 1 : pendingRegion.getCount();
+    byte band = 0;
+
+    for(byte index = 0; index < rectCount; index++)
+    {
+        UIRect rect = full ? UIRect(0, 0, screenWidth, screenHeight) : pendingRegion.getRect(index);
+
+        for(short row = 0; row < rect.h; row += bandHeight)
+        {
+            short rows = rect.h - row < bandHeight ? rect.h - row : bandHeight;
+
+            // This band buffer went out two transfers ago, fill it while the other one is transferring
+            convertRows(bands[band], source, rect, row, rows);
+
+            waitForTransfer();
+            backend.transfer(rect.x, rect.y + row, rect.w, rows, bands[band]);
+
+            band ^= 1;
+        }
+    }
+
+    if(backBuffer == nullptr)
+        xSemaphoreGive(sourceReleased);
+
+    waitForTransfer();
+    backend.endTransfers();
+}
+
+void DisplayPresenter::copyRect(uint8_t* destination, const uint8_t* frame, const UIRect& rect)
+{
+    for(short row = 0; row < rect.h; row++)
+    {
+        size_t offset = ((rect.y + row) * screenWidth + rect.x) * bytesPerPixel;
+        memcpy(destination + offset, frame + offset, rect.w * bytesPerPixel);
+    }
+}
+
+void DisplayPresenter::convertRows(uint16_t* band, const uint8_t* frame, const UIRect& rect, short row, short rows)
+{
+    for(short bandRow = 0; bandRow < rows; bandRow++)
+    {
+        size_t pixelOffset = (rect.y + row + bandRow) * screenWidth + rect.x;
+        uint16_t* destination = band + bandRow * rect.w;
+
+        if(pixelFormat == PixelFormat::RGB565Swapped)
+            memcpy(destination, frame + pixelOffset * 2, rect.w * 2);
+        else
+        {
+            const uint8_t* pixels = frame + pixelOffset;
+            for(short column = 0; column < rect.w; column++)
+                destination[column] = rgb332ToSwapped565[pixels[column]];
+        }
+    }
+}
+
+void DisplayPresenter::waitForTransfer()
+{
+    // A band goes out in a millisecond or two, a tick's delay would cap the bands per frame. Yield rather than
+    // spin outright (as BandRenderer does from loop()) so other tasks at the presenter's priority still run.
+    while(backend.busy())
+        taskYIELD();
+}
+
+void DisplayPresenter::startBurst()
+{
+    burstStart = micros();
+    burstFrames = 0;
+
+    for(byte core = 0; core < 2; core++)
+    {
+        idleMicros[core] = 0;
+        idleMicrosAtLastFrame[core] = 0;
+        lastIdleHook[core] = burstStart;
+    }
+
+    measuringIdle = true;
+}
+
+void DisplayPresenter::endBurst()
+{
+    measuringIdle = false;
+
+    // Measured up to the end of the last frame, not the quiet period that ended the burst
+    unsigned long duration = lastFrameTime - burstStart;
+    if(burstFrames < 2 || duration == 0)
+        return;
+
+    burstFramesPerSecond = (burstFrames - 1) * 1000000.0f / (lastFrameTime - firstFrameTime);
+
+    for(byte core = 0; core < portNUM_PROCESSORS && core < 2; core++)
+        burstCpuIdlePercent[core] = static_cast<byte>(min(100UL, idleMicrosAtLastFrame[core] * 100 / duration));
+
+    DEBUG_INFO("DisplayPresenter: Burst of %lu frames at %.1f fps, CPU idle %u%% (core 0) %u%% (core 1)", burstFrames, burstFramesPerSecond, burstCpuIdlePercent[0], burstCpuIdlePercent[1]);
+}
+
+bool DisplayPresenter::idleHookCore0()
+{
+    return countIdle(0);
+}
+
+bool DisplayPresenter::idleHookCore1()
+{
+    return countIdle(1);
+}
+
+// While measuring, the idle task calls this back to back, so the time between calls is idle time. Returning false keeps it
+// calling rather than waiting for an interrupt. Longer gaps mean another task ran in between.
+bool DisplayPresenter::countIdle(byte core)
+{
+    if(!measuringIdle)
+        return true;
+
+    unsigned long now = micros();
+    unsigned long gap = now - lastIdleHook[core];
+    if(gap < kIdleGapUs)
+        idleMicros[core] += gap;
+
+    lastIdleHook[core] = now;
+
+    return false;
+}
+
+void DisplayPresenter::reportStats()
+{
+    DEBUG_INFO("DisplayPresenter: %lu frames, %lu us waiting on the fence, last burst %.1f fps, CPU idle %u%% (core 0) %u%% (core 1)",
+        frames, fenceWaitMicros, burstFramesPerSecond, burstCpuIdlePercent[0], burstCpuIdlePercent[1]);
+}
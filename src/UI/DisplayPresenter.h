@@ -0,0 +1,113 @@
+#ifndef DISPLAYPRESENTER_H
+#define DISPLAYPRESENTER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "Arduino_DebugUtils.h"
+#include "UI/DirtyRegion.h"
+
+// Sends frames to the display from a background task so the UI can get on with the next frame while the current one is transferring.
+// The frame is sent in bands: while one band buffer is going out over DMA the next band is copied (and converted) into the other.
+//
+// Double buffered (needs PSRAM): present() copies the changed areas into a back buffer and returns, the screens can draw straight away.
+// Single buffered: present() returns once the last band has been copied out of the frame buffer, only the last bands' transfers overlap.
+//
+// Anything that draws directly to the display (e.g. the pass key screens) must call waitIdle() first.
+class DisplayPresenter
+{
+    public:
+        enum class PixelFormat : byte
+        {
+            RGB565Swapped = 0,  // 16 bit sprites (TFT_eSPI and M5GFX store them byte swapped, ready for the panel)
+            RGB332 = 1          // 8 bit sprites, converted to RGB565 a band at a time
+        };
+
+        // Board specific display access, set up in the main file.
+        // transfer() may return before the pixels have gone out as long as busy() reports true until they have.
+        struct Backend
+        {
+            void (*beginTransfers)();
+            void (*transfer)(short x, short y, short w, short h, const uint16_t* pixels);
+            bool (*busy)();
+            void (*endTransfers)();
+        };
+
+        typedef void (*CompletionCallback)(unsigned long frame);
+
+        static bool begin(const Backend& inBackend, short width, short height, PixelFormat format, short bandRows, bool doubleBuffered);
+        static bool isStarted() { return started; }
+
+        // Queues the region of the frame buffer to go to the display. Waits (fence) if the previous frame still holds the buffer it needs.
+        static void present(const void* frameBuffer, const DirtyRegion& region);
+        static void presentFull(const void* frameBuffer);
+
+        // Fence, returns once everything presented has reached the display
+        static bool isBusy() { return inFlight; }
+        static void waitIdle();
+
+        static void setCompletionCallback(CompletionCallback callback) { completionCallback = callback; }
+
+        static unsigned long getFrames() { return frames; }
+        static unsigned long getFenceWaitMicros() { return fenceWaitMicros; } // Total time present() has waited on the previous frame
+
+        // Burst statistics (frames presented close together, e.g. while swiping between screens), logged when each burst ends
+        static float getBurstFramesPerSecond() { return burstFramesPerSecond; }
+        static byte getBurstCpuIdlePercent(byte core) { return core < portNUM_PROCESSORS ? burstCpuIdlePercent[core] : 0; }
+        static void reportStats();
+
+    private:
+        static void presenterTask(void* parameter);
+        static void transferRegion();
+        static void copyRect(uint8_t* destination, const uint8_t* frame, const UIRect& rect);
+        static void convertRows(uint16_t* band, const uint8_t* frame, const UIRect& rect, short row, short rows);
+        static void waitForTransfer();
+
+        static void startBurst();
+        static void endBurst();
+        static bool idleHookCore0();
+        static bool idleHookCore1();
+        static bool countIdle(byte core);
+
+        static const unsigned long kBurstGapMs = 500;   // A burst ends when nothing has been presented for this long
+        static const unsigned long kIdleGapUs = 100;    // Idle hook calls closer together than this are counted as idle time
+
+        static Backend backend;
+        static bool started;
+        static short screenWidth;
+        static short screenHeight;
+        static PixelFormat pixelFormat;
+        static byte bytesPerPixel;
+        static short bandHeight;
+
+        static uint8_t* backBuffer;
+        static uint16_t* bands[2];
+        static uint16_t rgb332ToSwapped565[256];
+
+        static const uint8_t* source; // Frame buffer the presenter task reads from
+        static DirtyRegion pendingRegion;
+        static volatile bool inFlight;
+
+        static TaskHandle_t taskHandle;
+        static SemaphoreHandle_t frameReady;     // Given by present(), taken by the task
+        static SemaphoreHandle_t sourceReleased; // Given by the task once the source has been copied into the bands
+        static SemaphoreHandle_t frameDone;      // Given by the task once the frame is on the display
+
+        static CompletionCallback completionCallback;
+        static unsigned long frames;
+        static unsigned long fenceWaitMicros;
+
+        static volatile bool measuringIdle;
+        static unsigned long lastIdleHook[2];
+        static unsigned long idleMicros[2];
+        static unsigned long idleMicrosAtLastFrame[2];
+        static unsigned long burstStart;
+        static unsigned long burstFrames;
+        static unsigned long firstFrameTime;
+        static unsigned long lastFrameTime;
+        static float burstFramesPerSecond;
+        static byte burstCpuIdlePercent[2];
+};
+
+#endif
@@ -0,0 +1,74 @@
+#include "ISOScreen.h"
+
+// In order of value, for stepping up and down
+const int ISOScreen::kOptions[kOptionCount] = { 200, 400, 640, 800, 1250, 3200, 8000, 12800 };
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    const byte kCustomIndex = 9; // Last widget, shows the ISO when it's not one of the options
+}
+
+const UIWidgetSpec ISOScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,     30,   9,  60, 16, "ISO",   nullptr,  0 },
+
+    { UIWidgetType::Button,    20,  30,  90, 40, "200",   nullptr,  200 },
+    { UIWidgetType::Button,   115,  30,  90, 40, "400",   "NATIVE", 400 },
+    { UIWidgetType::Button,   210,  30, 100, 40, "8000",  nullptr,  8000 },
+
+    { UIWidgetType::Button,    20,  75,  90, 40, "640",   nullptr,  640 },
+    { UIWidgetType::Button,   115,  75,  90, 40, "800",   nullptr,  800 },
+    { UIWidgetType::Button,   210,  75, 100, 40, "12800", nullptr,  12800 },
+
+    { UIWidgetType::Button,    20, 120,  90, 40, "1250",  nullptr,  1250 },
+    { UIWidgetType::Button,   115, 120,  90, 40, "3200",  "NATIVE", 3200 },
+    { UIWidgetType::Indicator, 210, 120, 100, 40, "",     "CUSTOM", 0 }
+};
+
+UIScreen ISOScreen::screen(ISOScreen::kWidgets, sizeof(ISOScreen::kWidgets) / sizeof(ISOScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+bool ISOScreen::update(int currentISO)
+{
+    bool changed = false;
+    bool isOption = false;
+
+    for(byte index = 0; index < screen.getCount(); index++)
+    {
+        const UINode& node = screen.getNode(index);
+        if(node.type != UIWidgetType::Button)
+            continue;
+
+        bool selected = node.value == currentISO;
+        isOption = isOption || selected;
+
+        changed = screen.setSelected(index, selected) || changed;
+    }
+
+    // Custom ISO - show if ISO is not one of the options
+    bool showCustom = currentISO != 0 && !isOption;
+    changed = screen.setVisible(kCustomIndex, showCustom) || changed;
+
+    if(showCustom)
+    {
+        changed = screen.setSelected(kCustomIndex, true) || changed;
+        changed = screen.setText(kCustomIndex, String(currentISO).c_str()) || changed;
+    }
+
+    return changed;
+}
+
+int ISOScreen::hitTest(int x, int y)
+{
+    int index = screen.hitTest(x, y);
+
+    return index == -1 ? 0 : screen.getNode(index).value;
+}
+
+int ISOScreen::getNextOption(int currentISO, bool up)
+{
+    return UIScreen::getNextOption(kOptions, kOptionCount, currentISO, up);
+}
@@ -0,0 +1,36 @@
+#ifndef ISOSCREEN_H
+#define ISOSCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+
+// The ISO screen's widgets and behaviour, shared by every board. Boards lay it out for their display, pass taps/button presses
+// in and draw it through their UIBackend.
+class ISOScreen
+{
+    public:
+        static const byte kOptionCount = 8;
+
+        static void layout(short width, short height) { screen.layout(width, height); }
+
+        // Selects the button for the camera's ISO (or shows it as a custom value), returns true if that changed what's shown
+        static bool update(int currentISO);
+
+        // ISO of the button at x, y, or 0 if there isn't one
+        static int hitTest(int x, int y);
+
+        // For boards without touch, the next ISO up or down from the current one (wrapping around)
+        static int getNextOption(int currentISO, bool up);
+
+        // The ISOs offered, for UIs that build their own buttons (e.g. the CoreS3's LVGL screens)
+        static int getOption(byte index) { return index < kOptionCount ? kOptions[index] : 0; }
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const int kOptions[kOptionCount];
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+};
+
+#endif
@@ -0,0 +1,199 @@
+#include "InputQueue.h"
+#include "RenderScheduler.h"
+
+InputQueue::Event InputQueue::queue[kQueueSize];
+std::atomic<byte> InputQueue::head(0);
+std::atomic<byte> InputQueue::tail(0);
+
+InputQueue::Button InputQueue::buttons[kMaxButtons];
+byte InputQueue::buttonCount = 0;
+bool InputQueue::repeating = false;
+
+volatile unsigned long InputQueue::events = 0;
+volatile unsigned long InputQueue::bounces = 0;
+volatile unsigned long InputQueue::overflows = 0;
+unsigned long InputQueue::repeats = 0;
+unsigned long InputQueue::actions = 0;
+unsigned long InputQueue::averageLatencyMicros = 0;
+unsigned long InputQueue::maxLatencyMicros = 0;
+
+static portMUX_TYPE buttonLock = portMUX_INITIALIZER_UNLOCKED;
+
+bool InputQueue::attachButton(byte id, byte pin, bool activeLow, bool internalPull)
+{
+    if(buttonCount >= kMaxButtons)
+    {
+        DEBUG_ERROR("InputQueue: No room for button %u", id);
+        return false;
+    }
+
+    Button& button = buttons[buttonCount];
+    button.id = id;
+    button.pin = pin;
+    button.activeLow = activeLow;
+    button.lastEdgeMicros = micros();
+    button.nextRepeatMillis = 0;
+    button.repeatIntervalMs = kRepeatStartMs;
+
+    if(internalPull)
+        pinMode(pin, activeLow ? INPUT_PULLUP : INPUT_PULLDOWN);
+    else
+        pinMode(pin, INPUT);
+    button.pressed = (digitalRead(pin) == LOW) == activeLow;
+
+    attachInterruptArg(digitalPinToInterrupt(pin), buttonISR, &button, CHANGE);
+    buttonCount++;
+
+    DEBUG_INFO("InputQueue: Button %u on pin %u", id, pin);
+
+    return true;
+}
+
+void IRAM_ATTR InputQueue::buttonISR(void* argument)
+{
+    Button* button = static_cast<Button*>(argument);
+    unsigned long now = micros();
+
+    bool pressed = (digitalRead(button->pin) == LOW) == button->activeLow;
+
+    // Contacts bounce for a few milliseconds, only the first edge counts
+    if(pressed == button->pressed || now - button->lastEdgeMicros < kDebounceMicros)
+    {
+        bounces++;
+        return;
+    }
+
+    portENTER_CRITICAL_ISR(&buttonLock);
+    button->pressed = pressed;
+    button->lastEdgeMicros = now;
+    portEXIT_CRITICAL_ISR(&buttonLock);
+
+    push(button->id, pressed ? Type::Press : Type::Release, now);
+}
+
+void IRAM_ATTR InputQueue::pushFromISR(byte id, Type type)
+{
+    push(id, type, micros());
+}
+
+void IRAM_ATTR InputQueue::push(byte id, Type type, unsigned long micros)
+{
+    byte currentTail = tail.load(std::memory_order_relaxed);
+    byte nextTail = (currentTail + 1) % kQueueSize;
+
+    if(nextTail == head.load(std::memory_order_acquire))
+    {
+        overflows++;
+        return;
+    }
+
+    queue[currentTail].id = id;
+    queue[currentTail].type = type;
+    queue[currentTail].micros = micros;
+
+    // The event is written before loop() can see it
+    tail.store(nextTail, std::memory_order_release);
+    events++;
+
+    RenderScheduler::wakeFromISR();
+}
+
+bool InputQueue::poll(Event& event)
+{
+    byte currentHead = head.load(std::memory_order_relaxed);
+
+    if(currentHead != tail.load(std::memory_order_acquire))
+    {
+        event = queue[currentHead];
+        head.store((currentHead + 1) % kQueueSize, std::memory_order_release);
+
+        // Held buttons start repeating after a pause
+        for(byte index = 0; index < buttonCount; index++)
+        {
+            if(buttons[index].id != event.id)
+                continue;
+
+            if(event.type == Type::Press)
+            {
+                buttons[index].nextRepeatMillis = millis() + kRepeatDelayMs;
+                buttons[index].repeatIntervalMs = kRepeatStartMs;
+            }
+            else if(event.type == Type::Release)
+                buttons[index].nextRepeatMillis = 0;
+        }
+
+        return true;
+    }
+
+    // Nothing queued, repeats and any release that was lost in a bounce are raised here
+    unsigned long now = millis();
+    for(byte index = 0; index < buttonCount; index++)
+    {
+        Button& button = buttons[index];
+
+        if(button.pressed && micros() - button.lastEdgeMicros > kDebounceMicros && (digitalRead(button.pin) == LOW) != button.activeLow)
+        {
+            portENTER_CRITICAL(&buttonLock);
+            button.pressed = false;
+            button.lastEdgeMicros = micros();
+            portEXIT_CRITICAL(&buttonLock);
+
+            button.nextRepeatMillis = 0;
+
+            event.id = button.id;
+            event.type = Type::Release;
+            event.micros = micros();
+            return true;
+        }
+
+        if(!repeating || !button.pressed || button.nextRepeatMillis == 0 || static_cast<long>(now - button.nextRepeatMillis) < 0)
+            continue;
+
+        // Repeats get quicker the longer it's held, a late one isn't made up for
+        button.nextRepeatMillis = now + button.repeatIntervalMs;
+        button.repeatIntervalMs = std::max(static_cast<unsigned long>(kRepeatFastestMs), button.repeatIntervalMs * kRepeatAcceleratePercent / 100);
+        repeats++;
+
+        event.id = button.id;
+        event.type = Type::Repeat;
+        event.micros = micros();
+        return true;
+    }
+
+    return false;
+}
+
+bool InputQueue::isHeld(byte id)
+{
+    for(byte index = 0; index < buttonCount; index++)
+    {
+        if(buttons[index].id == id)
+            return buttons[index].pressed;
+    }
+
+    return false;
+}
+
+void InputQueue::clear()
+{
+    head.store(tail.load(std::memory_order_acquire), std::memory_order_release);
+
+    for(byte index = 0; index < buttonCount; index++)
+        buttons[index].nextRepeatMillis = 0;
+}
+
+void InputQueue::actionTaken(const Event& event)
+{
+    unsigned long latency = micros() - event.micros;
+
+    averageLatencyMicros = actions == 0 ? latency : (averageLatencyMicros * 7 + latency) / 8;
+    if(latency > maxLatencyMicros)
+        maxLatencyMicros = latency;
+
+    actions++;
+}
+
+void InputQueue::reportStats()
+{
+    DEBUG_INFO("InputQueue: %lu events, %lu bounces ignored, %lu repeats, %lu lost (queue full), input to action %lu us average, %lu us max over %lu actions", events, bounces, repeats, overflows, averageLatencyMicros, maxLatencyMicros, actions);
+}
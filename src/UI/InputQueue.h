@@ -0,0 +1,98 @@
+#ifndef INPUTQUEUE_H
+#define INPUTQUEUE_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "Arduino_DebugUtils.h"
+
+// Button presses and touch reports from their interrupts, in the order they happened, for loop() to take in its own time.
+// A press during a slow redraw or a blocking scan is queued with the time it happened rather than missed. Buttons are debounced in
+// the interrupt (edges within kDebounceMicros of the last one are bounces), a button held down repeats, slowly at first and then
+// faster the longer it's held. The interrupts also wake loop() early (RenderScheduler::wakeFromISR).
+//
+// Only the interrupts add events and only loop() takes them, so the queue needs no lock. actionTaken() records how long an event
+// waited between its interrupt and loop() acting on it.
+class InputQueue
+{
+    public:
+        enum class Type : byte
+        {
+            Press = 0,
+            Release,
+            Repeat,     // Still held
+            Touch       // The touch controller has a report, it's read from loop()
+        };
+
+        struct Event
+        {
+            byte id = 0;                    // The button's (or touch controller's) id
+            Type type = Type::Press;
+            unsigned long micros = 0;       // When it happened
+        };
+
+        static const byte kMaxButtons = 4;
+
+        // A button on a GPIO, interrupts on both edges. internalPull for a button without its own pull up (or down) resistor.
+        static bool attachButton(byte id, byte pin, bool activeLow = true, bool internalPull = false);
+
+        // Held buttons repeat while this is on, e.g. only on screens where a button steps a value
+        static void setRepeating(bool on) { repeating = on; }
+
+        // From an interrupt without its own debouncing, e.g. the touch controller's
+        static void IRAM_ATTR pushFromISR(byte id, Type type);
+
+        // Next event, false when there are none. Also raises the repeats of a held button.
+        static bool poll(Event& event);
+
+        static bool isHeld(byte id);
+
+        // Drops anything queued, e.g. while another screen had the buttons
+        static void clear();
+
+        // The UI has acted on the event
+        static void actionTaken(const Event& event);
+
+        static unsigned long getAverageLatencyMicros() { return averageLatencyMicros; }
+        static unsigned long getMaxLatencyMicros() { return maxLatencyMicros; }
+        static void reportStats();
+
+    private:
+        static const byte kQueueSize = 32;
+        static const unsigned long kDebounceMicros = 20000;
+        static const unsigned long kRepeatDelayMs = 400;      // Held this long before it repeats
+        static const unsigned long kRepeatStartMs = 200;      // First repeats
+        static const unsigned long kRepeatFastestMs = 40;     // Reached after a couple of seconds
+        static const byte kRepeatAcceleratePercent = 85;      // Each repeat comes this much sooner
+
+        struct Button
+        {
+            byte id;
+            byte pin;
+            bool activeLow;
+            volatile bool pressed;
+            volatile unsigned long lastEdgeMicros;
+            unsigned long nextRepeatMillis;
+            unsigned long repeatIntervalMs;
+        };
+
+        static void IRAM_ATTR buttonISR(void* argument);
+        static void IRAM_ATTR push(byte id, Type type, unsigned long micros);
+
+        static Event queue[kQueueSize];
+        static std::atomic<byte> head;  // Next to take, only changed by loop()
+        static std::atomic<byte> tail;  // Next free, only changed by the interrupts
+
+        static Button buttons[kMaxButtons];
+        static byte buttonCount;
+        static bool repeating;
+
+        static volatile unsigned long events;
+        static volatile unsigned long bounces;
+        static volatile unsigned long overflows;
+        static unsigned long repeats;
+        static unsigned long actions;
+        static unsigned long averageLatencyMicros;
+        static unsigned long maxLatencyMicros;
+};
+
+#endif
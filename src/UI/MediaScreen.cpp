@@ -0,0 +1,123 @@
+#include "MediaScreen.h"
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    // Each slot's row is its button (value is the slot's index) then its text
+    const byte kWidgetsPerSlot = 6;
+    const byte kFirstSlotIndex = 1;
+
+    const byte kNameOffset = 1;
+    const byte kRemainingOffset = 2;
+    const byte kStatusOffset = 3;
+    const byte kRemainingLabelOffset = 4;
+
+    // Slot names on the Pockets
+    const char* const kPocketNames[] = { "CFAST", "SD", "USB" };
+}
+
+const UIWidgetSpec MediaScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,   30,   9, 120, 16, "MEDIA",          nullptr, 0 },
+
+    { UIWidgetType::Button,  20,  30, 295, 40, "",               nullptr, 0 },
+    { UIWidgetType::Text,    28,  50,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Text,   155,  50,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,    28,  35,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,   155,  35,   0,  0, "REMAINING TIME", nullptr, 0 },
+    { UIWidgetType::Note,   300,  35,   0,  0, "1",              nullptr, 0 },
+
+    { UIWidgetType::Button,  20,  75, 295, 40, "",               nullptr, 1 },
+    { UIWidgetType::Text,    28,  95,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Text,   155,  95,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,    28,  80,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,   155,  80,   0,  0, "REMAINING TIME", nullptr, 0 },
+    { UIWidgetType::Note,   300,  80,   0,  0, "2",              nullptr, 0 },
+
+    { UIWidgetType::Button,  20, 120, 295, 40, "",               nullptr, 2 },
+    { UIWidgetType::Text,    28, 140,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Text,   155, 140,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,    28, 125,   0,  0, "",               nullptr, 0 },
+    { UIWidgetType::Note,   155, 125,   0,  0, "REMAINING TIME", nullptr, 0 },
+    { UIWidgetType::Note,   300, 125,   0,  0, "3",              nullptr, 0 }
+};
+
+UIScreen MediaScreen::screen(MediaScreen::kWidgets, sizeof(MediaScreen::kWidgets) / sizeof(MediaScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+byte MediaScreen::slotCount = 0;
+bool MediaScreen::hasMedia[kMaxSlots] = { false, false, false };
+bool MediaScreen::active[kMaxSlots] = { false, false, false };
+
+bool MediaScreen::update(const std::vector<BMDCamera::MediaSlot>& slots, bool pocket)
+{
+    bool changed = false;
+
+    slotCount = std::min(static_cast<byte>(slots.size()), static_cast<byte>(pocket ? kMaxSlots : 2));
+
+    for(byte slotIndex = 0; slotIndex < kMaxSlots; slotIndex++)
+    {
+        byte first = kFirstSlotIndex + slotIndex * kWidgetsPerSlot;
+        bool shown = slotIndex < slotCount;
+
+        for(byte index = first; index < first + kWidgetsPerSlot; index++)
+            changed = screen.setVisible(index, shown) || changed;
+
+        if(!shown)
+        {
+            hasMedia[slotIndex] = false;
+            active[slotIndex] = false;
+            continue;
+        }
+
+        BMDCamera::MediaSlot slot = slots[slotIndex];
+        hasMedia[slotIndex] = slot.status != CCUPacketTypes::MediaStatus::None;
+        active[slotIndex] = slot.active;
+
+        changed = screen.setSelected(first, slot.active) || changed;
+        changed = screen.setOutline(first, slot.StatusIsError() ? UIColour::Alert : UIColour::Background) || changed;
+
+        changed = screen.setText(first + kNameOffset, pocket ? kPocketNames[slotIndex] : slot.GetMediumString().c_str()) || changed;
+        changed = screen.setText(first + kStatusOffset, slot.GetStatusString().c_str()) || changed;
+
+        // Remaining time only when there's media
+        changed = screen.setVisible(first + kRemainingOffset, hasMedia[slotIndex]) || changed;
+        changed = screen.setVisible(first + kRemainingLabelOffset, hasMedia[slotIndex]) || changed;
+        changed = screen.setText(first + kRemainingOffset, slot.remainingRecordTimeString.c_str()) || changed;
+    }
+
+    return changed;
+}
+
+int MediaScreen::hitTest(int x, int y)
+{
+    int index = screen.hitTest(x, y);
+    if(index == -1)
+        return -1;
+
+    int slotIndex = screen.getNode(index).value;
+
+    return hasMedia[slotIndex] && !active[slotIndex] ? slotIndex : -1;
+}
+
+int MediaScreen::getNextSlot(bool forward)
+{
+    byte activeIndex = 0;
+    for(byte slotIndex = 0; slotIndex < slotCount; slotIndex++)
+    {
+        if(active[slotIndex])
+            activeIndex = slotIndex;
+    }
+
+    // Goes around the slots from the active one, skipping those without media
+    for(byte step = 1; step < slotCount; step++)
+    {
+        byte slotIndex = forward ? (activeIndex + step) % slotCount : (activeIndex + slotCount - step) % slotCount;
+        if(hasMedia[slotIndex])
+            return slotIndex;
+    }
+
+    return -1;
+}
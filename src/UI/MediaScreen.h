@@ -0,0 +1,40 @@
+#ifndef MEDIASCREEN_H
+#define MEDIASCREEN_H
+
+#include <Arduino.h>
+#include <vector>
+#include "UI/UIScreen.h"
+#include "Camera/BMDCamera.h"
+
+// The media screen's widgets and behaviour, shared by every board: a row for each slot with its status and remaining record
+// time, the active one highlighted and ones with an error outlined. The Pockets have CFast, SD and USB slots, the URSA Mini Pro G2
+// two slots named by the media in them.
+class MediaScreen
+{
+    public:
+        static const byte kMaxSlots = 3;
+
+        static void layout(short width, short height) { screen.layout(width, height); }
+
+        // Shows the camera's media slots, returns true if that changed what's shown
+        static bool update(const std::vector<BMDCamera::MediaSlot>& slots, bool pocket);
+
+        // The slot a tap at x, y makes active, or -1 if it isn't on one, it has no media or it's already active
+        static int hitTest(int x, int y);
+
+        // For boards without touch, the next slot with media after (or before) the active one, or -1 if there isn't another
+        static int getNextSlot(bool forward);
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+
+        // Slots shown by the last update
+        static byte slotCount;
+        static bool hasMedia[kMaxSlots];
+        static bool active[kMaxSlots];
+};
+
+#endif
@@ -0,0 +1,37 @@
+#include "ParameterSlider.h"
+
+void ParameterSlider::begin(int inValue, short x)
+{
+    active = true;
+    startValue = value = inValue;
+    startX = lastX = x;
+}
+
+bool ParameterSlider::drag(short x)
+{
+    if(!active)
+        return false;
+
+    lastX = x;
+    return setValue(startValue + (x - startX) * unitsPerPixel);
+}
+
+bool ParameterSlider::fling(float velocityX)
+{
+    if(!active)
+        return false;
+
+    return setValue(startValue + (lastX - startX + velocityX * kFlingSeconds) * unitsPerPixel);
+}
+
+bool ParameterSlider::setValue(float unsnapped)
+{
+    int snapped = static_cast<int>(lroundf(unsnapped / step)) * step;
+    snapped = std::max(minimum, std::min(maximum, snapped));
+
+    if(snapped == value)
+        return false;
+
+    value = snapped;
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef PARAMETERSLIDER_H
+#define PARAMETERSLIDER_H
+
+#include <Arduino.h>
+#include "UI/DirtyRegion.h"
+
+// A value on screen that can be dragged sideways to change it, e.g. the white balance and tint boxes.
+// A drag has to start on the slider but can then go anywhere, the value follows the finger from where it went down (unitsPerPixel),
+// snapped to the step and held within the range. A fling carries the value on as if the finger had kept going for kFlingSeconds.
+class ParameterSlider
+{
+    public:
+        ParameterSlider(short x, short y, short w, short h, int inMinimum, int inMaximum, int inStep, float inUnitsPerPixel)
+            : rect(x, y, w, h), minimum(inMinimum), maximum(inMaximum), step(inStep), unitsPerPixel(inUnitsPerPixel) {}
+
+        const UIRect& getRect() const { return rect; }
+        bool contains(int x, int y) const { return rect.contains(x, y); }
+
+        // Finger down on the slider at x with the parameter currently at value
+        void begin(int value, short x);
+        void end() { active = false; }
+        bool isActive() const { return active; }
+
+        // Returns true if the value changed
+        bool drag(short x);
+        bool fling(float velocityX);
+
+        int getValue() const { return value; }
+
+    private:
+        static constexpr float kFlingSeconds = 0.25f;
+
+        bool setValue(float unsnapped);
+
+        UIRect rect;
+        int minimum;
+        int maximum;
+        int step;
+        float unitsPerPixel;
+
+        bool active = false;
+        int startValue = 0;
+        short startX = 0;
+        short lastX = 0;
+        int value = 0;
+};
+
+#endif
@@ -0,0 +1,112 @@
+#include "RenderScheduler.h"
+
+unsigned long RenderScheduler::framePeriodUs = 1000000 / 30;
+unsigned long RenderScheduler::inputPeriodUs = 1000000 / 100;
+unsigned long RenderScheduler::nextFrameTime = 0;
+unsigned long RenderScheduler::nextInputTime = 0;
+bool RenderScheduler::invalid = true;
+SemaphoreHandle_t RenderScheduler::wakeSignal = nullptr;
+
+unsigned long RenderScheduler::framesRendered = 0;
+unsigned long RenderScheduler::framesSkipped = 0;
+unsigned long RenderScheduler::framesLate = 0;
+unsigned long RenderScheduler::invalidations = 0;
+unsigned long RenderScheduler::wakes = 0;
+
+void RenderScheduler::begin(unsigned int targetFramesPerSecond, unsigned int inputSamplesPerSecond)
+{
+    framePeriodUs = 1000000 / targetFramesPerSecond;
+    inputPeriodUs = 1000000 / inputSamplesPerSecond;
+
+    unsigned long now = micros();
+    nextFrameTime = now;
+    nextInputTime = now;
+    invalid = true;
+
+    if(wakeSignal == nullptr)
+        wakeSignal = xSemaphoreCreateBinary();
+
+    DEBUG_INFO("RenderScheduler: Up to %u frames per second, input sampled %u times per second", targetFramesPerSecond, inputSamplesPerSecond);
+}
+
+void RenderScheduler::invalidate()
+{
+    invalid = true;
+    invalidations++;
+}
+
+bool RenderScheduler::frameDue()
+{
+    unsigned long now = micros();
+
+    // Signed so it copes with micros() wrapping
+    long sinceDue = static_cast<long>(now - nextFrameTime);
+    if(sinceDue < 0)
+        return false;
+
+    // Ticks that have gone by since the last check, the next tick is lined up on the frame period rather than on now
+    unsigned long ticks = 1 + sinceDue / framePeriodUs;
+    nextFrameTime += ticks * framePeriodUs;
+
+    if(!invalid)
+    {
+        framesSkipped += ticks;
+        return false;
+    }
+
+    if(ticks > 1)
+        framesLate++;
+
+    framesRendered++;
+    invalid = false;
+
+    return true;
+}
+
+void RenderScheduler::waitForNextTick()
+{
+    unsigned long now = micros();
+
+    // Line up on the input period, unless we've fallen behind (e.g. a blocking scan) in which case start again from now
+    if(static_cast<long>(now - nextInputTime) > static_cast<long>(inputPeriodUs))
+        nextInputTime = now;
+
+    nextInputTime += inputPeriodUs;
+
+    unsigned long wakeTime = nextInputTime;
+    if(invalid && static_cast<long>(nextFrameTime - wakeTime) < 0)
+        wakeTime = nextFrameTime;
+
+    long waitUs = static_cast<long>(wakeTime - now);
+    TickType_t waitTicks = waitUs >= 1000 ? pdMS_TO_TICKS(waitUs / 1000) : 0;
+    if(waitTicks == 0)
+        waitTicks = 1; // Always give the other tasks a chance
+
+    if(wakeSignal == nullptr)
+        vTaskDelay(waitTicks);
+    else if(xSemaphoreTake(wakeSignal, waitTicks) == pdTRUE)
+        wakes++; // Input arrived, loop() deals with it now
+}
+
+void IRAM_ATTR RenderScheduler::wakeFromISR()
+{
+    if(wakeSignal == nullptr)
+        return;
+
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    xSemaphoreGiveFromISR(wakeSignal, &higherPriorityTaskWoken);
+
+    if(higherPriorityTaskWoken == pdTRUE)
+        portYIELD_FROM_ISR();
+}
+
+void RenderScheduler::wake()
+{
+    if(wakeSignal != nullptr)
+        xSemaphoreGive(wakeSignal);
+}
+
+void RenderScheduler::reportStats()
+{
+    DEBUG_INFO("RenderScheduler: %lu frames rendered, %lu skipped (nothing to draw), %lu late, %lu invalidations, %lu waits ended by input", framesRendered, framesSkipped, framesLate, invalidations, wakes);
+}
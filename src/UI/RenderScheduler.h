@@ -0,0 +1,55 @@
+#ifndef RENDERSCHEDULER_H
+#define RENDERSCHEDULER_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "Arduino_DebugUtils.h"
+
+// Decides when loop() renders, separately from how often it samples input.
+// Anything that changes what's on screen calls invalidate(), invalidations are collected and the screen is drawn at most once per
+// frame tick (at the target frame rate), nothing is drawn while the screen is valid. Input is sampled on its own faster tick, and
+// an input interrupt wakes loop() straight away rather than waiting for the tick.
+class RenderScheduler
+{
+    public:
+        static void begin(unsigned int targetFramesPerSecond, unsigned int inputSamplesPerSecond);
+
+        static void invalidate();
+        static bool isInvalid() { return invalid; }
+
+        // True when a frame tick has been reached and the screen is invalid, the caller renders and the screen is valid again
+        static bool frameDue();
+
+        // Replaces loop()'s delay, sleeps until the next input sample (or frame tick if that's sooner and the screen is invalid)
+        static void waitForNextTick();
+
+        // Ends the current (or next) wait early, from an interrupt with input for loop()
+        static void IRAM_ATTR wakeFromISR();
+
+        // The same from another task, e.g. the I2C scheduler with a touch report
+        static void wake();
+
+        static unsigned long getFramesRendered() { return framesRendered; }
+        static unsigned long getFramesSkipped() { return framesSkipped; }   // Frame ticks that passed with nothing to draw
+        static unsigned long getFramesLate() { return framesLate; }         // Frames drawn more than a tick after they were due
+        static unsigned long getInvalidations() { return invalidations; }   // Calls to invalidate(), several are usually drawn in one frame
+        static unsigned long getWakes() { return wakes; }                   // Waits ended early by input
+        static void reportStats();
+
+    private:
+        static unsigned long framePeriodUs;
+        static unsigned long inputPeriodUs;
+        static unsigned long nextFrameTime;
+        static unsigned long nextInputTime;
+        static bool invalid;
+        static SemaphoreHandle_t wakeSignal;
+
+        static unsigned long framesRendered;
+        static unsigned long framesSkipped;
+        static unsigned long framesLate;
+        static unsigned long invalidations;
+        static unsigned long wakes;
+};
+
+#endif
@@ -0,0 +1,60 @@
+#include "RenderStats.h"
+
+unsigned long RenderStats::frameStart = 0;
+unsigned long RenderStats::lastFrameMicros = 0;
+size_t RenderStats::lastFrameBytes = 0;
+
+unsigned long RenderStats::fullFrames = 0;
+unsigned long RenderStats::partialFrames = 0;
+unsigned long RenderStats::fullFrameMicros = 0;
+unsigned long RenderStats::partialFrameMicros = 0;
+size_t RenderStats::fullFrameBytes = 0;
+size_t RenderStats::partialFrameBytes = 0;
+
+void RenderStats::beginFrame()
+{
+    frameStart = micros();
+}
+
+void RenderStats::endFrame(size_t bytesPushed, bool fullFrame)
+{
+    lastFrameMicros = micros() - frameStart;
+    lastFrameBytes = bytesPushed;
+
+    if(fullFrame)
+    {
+        fullFrames++;
+        fullFrameMicros = average(fullFrameMicros, lastFrameMicros, fullFrames);
+        fullFrameBytes = average(fullFrameBytes, bytesPushed, fullFrames);
+    }
+    else
+    {
+        partialFrames++;
+        partialFrameMicros = average(partialFrameMicros, lastFrameMicros, partialFrames);
+        partialFrameBytes = average(partialFrameBytes, bytesPushed, partialFrames);
+    }
+}
+
+// Running average over roughly the last 16 frames, the first frames are averaged normally so it doesn't start from zero
+unsigned long RenderStats::average(unsigned long current, unsigned long sample, unsigned long count)
+{
+    unsigned long weight = count < 16 ? count : 16;
+    return (current * (weight - 1) + sample) / weight;
+}
+
+String RenderStats::getSummary()
+{
+    char summary[48];
+    snprintf(summary, sizeof(summary), "Part %.1fms %uKB  Full %.1fms %uKB",
+        partialFrameMicros / 1000.0f, static_cast<unsigned int>(partialFrameBytes / 1024),
+        fullFrameMicros / 1000.0f, static_cast<unsigned int>(fullFrameBytes / 1024));
+
+    return String(summary);
+}
+
+void RenderStats::reportStats()
+{
+    DEBUG_INFO("RenderStats: %lu full frames (%luus, %u bytes), %lu partial frames (%luus, %u bytes)",
+        fullFrames, fullFrameMicros, static_cast<unsigned int>(fullFrameBytes),
+        partialFrames, partialFrameMicros, static_cast<unsigned int>(partialFrameBytes));
+}
@@ -0,0 +1,47 @@
+#ifndef RENDERSTATS_H
+#define RENDERSTATS_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+
+// Frame times and bytes sent to the display, kept separately for full and partial (dirty rectangle) frames so they can be compared.
+// A frame is timed from the start of drawing until the push to the display completes.
+class RenderStats
+{
+    public:
+        static void beginFrame();
+        static void endFrame(size_t bytesPushed, bool fullFrame);
+
+        static unsigned long getFrames() { return fullFrames + partialFrames; }
+        static unsigned long getFullFrames() { return fullFrames; }
+        static unsigned long getPartialFrames() { return partialFrames; }
+
+        // Averages over recent frames
+        static unsigned long getFullFrameMicros() { return fullFrameMicros; }
+        static unsigned long getPartialFrameMicros() { return partialFrameMicros; }
+        static size_t getFullFrameBytes() { return fullFrameBytes; }
+        static size_t getPartialFrameBytes() { return partialFrameBytes; }
+
+        static unsigned long getLastFrameMicros() { return lastFrameMicros; }
+        static size_t getLastFrameBytes() { return lastFrameBytes; }
+
+        // One line summary for the screen, e.g. "Part 1.9ms 6KB  Full 14.2ms 106KB"
+        static String getSummary();
+        static void reportStats();
+
+    private:
+        static unsigned long average(unsigned long current, unsigned long sample, unsigned long count);
+
+        static unsigned long frameStart;
+        static unsigned long lastFrameMicros;
+        static size_t lastFrameBytes;
+
+        static unsigned long fullFrames;
+        static unsigned long partialFrames;
+        static unsigned long fullFrameMicros;
+        static unsigned long partialFrameMicros;
+        static size_t fullFrameBytes;
+        static size_t partialFrameBytes;
+};
+
+#endif
@@ -0,0 +1,285 @@
+#include "ResolutionScreen.h"
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    // A resolution button's recording format, sensor windowed or not (or kKeepWindow to leave it as it is)
+    struct Option
+    {
+        short width;
+        short height;
+        sbyte window;
+    };
+
+    const sbyte kKeepWindow = -1;
+
+    // Buttons' values are the index of their option, the sensor area buttons keep the resolution
+    const int kSensorFull = 100;
+    const int kSensorWindow = 101;
+
+    // Order of ResolutionScreen::screens
+    const byte kPocket4KBRAW = 0;
+    const byte kPocket4KProRes = 1;
+    const byte kPocket6KBRAW = 2;
+    const byte kPocket6KProRes = 3;
+    const byte kURSAMiniProG2 = 4;
+
+    const byte kTitleIndex = 0;
+
+    // BRAW on the Pockets, the sensor area is shown under the resolutions
+    const byte kSensorIndex = 7;
+    const byte kSensorDimensionsIndex = 8;
+
+    // ProRes on the Pockets, the resolution is scaled from a sensor area
+    const byte kDimensionsIndex = 4;
+    const byte kSensorAreaIndex = 6; // Pocket 4K: FULL or WINDOW, Pocket 6K: FULL for 4K DCI
+    const byte kSensorHDIndex = 7;   // Pocket 4K: HD's sensor area can't be told
+    const byte kSensorFullIndex = 7;     // Pocket 6K UHD and HD
+    const byte kSensor57KIndex = 8;      // Pocket 6K UHD
+    const byte kSensorHDWindowIndex = 9; // Pocket 6K HD
+
+    const Option kPocket4KBRAWOptions[] = { { 4096, 2160, 0 }, { 4096, 1720, 1 }, { 3840, 2160, 1 }, { 2880, 2160, 1 }, { 2688, 1512, 1 }, { 1920, 1080, 1 } };
+    const Option kPocket4KProResOptions[] = { { 4096, 2160, 0 }, { 3840, 2160, 1 }, { 1920, 1080, 1 } };
+    const Option kPocket6KBRAWOptions[] = { { 6144, 3456, 0 }, { 6144, 2560, 1 }, { 5744, 3024, 1 }, { 4096, 2160, 1 }, { 3728, 3104, 1 }, { 2868, 1512, 1 } };
+    const Option kPocket6KProResOptions[] = { { 4096, 2160, 1 }, { 3840, 2160, kKeepWindow }, { 1920, 1080, kKeepWindow } };
+    const Option kURSAMiniProG2Options[] = { { 4608, 2592, 0 }, { 4608, 1920, 1 }, { 4096, 2304, 1 }, { 4096, 2160, 1 }, { 3840, 2160, 1 }, { 3072, 2560, 1 }, { 2048, 1152, 1 }, { 2048, 1080, 1 }, { 1920, 1080, 1 } };
+
+    // Indexed as ResolutionScreen::screens
+    const Option* const kOptions[] = { kPocket4KBRAWOptions, kPocket4KProResOptions, kPocket6KBRAWOptions, kPocket6KProResOptions, kURSAMiniProG2Options };
+    const byte kOptionCounts[] = { 6, 3, 6, 3, 9 };
+
+    const UIWidgetSpec kPocket4KBRAWWidgets[] =
+    {
+        { UIWidgetType::Label,      30,   9, 160, 16, "BRAW RESOLUTION",         nullptr,      0 },
+
+        { UIWidgetType::Button,     20,  30,  90, 40, "4K",                      "DCI",        0 },
+        { UIWidgetType::Button,    115,  30,  90, 40, "4K",                      "2.4:1",      1 },
+        { UIWidgetType::Button,    210,  30, 100, 40, "4K",                      "UHD",        2 },
+        { UIWidgetType::Button,     20,  75,  90, 40, "2.8K",                    "ANAMORPHIC", 3 },
+        { UIWidgetType::Button,    115,  75,  90, 40, "2.6K",                    "16:9",       4 },
+        { UIWidgetType::Button,    210,  75, 100, 40, "HD",                      nullptr,      5 },
+
+        { UIWidgetType::Text,       20, 127, 290, 20, "",                        nullptr,      0 },
+        { UIWidgetType::Note,       20, 146, 290, 12, "",                        nullptr,      0 }
+    };
+
+    const UIWidgetSpec kPocket4KProResWidgets[] =
+    {
+        { UIWidgetType::Label,      30,   9, 160, 16, "ProRes RESOLUTION",       nullptr,      0 },
+
+        { UIWidgetType::Button,     20,  30,  90, 40, "4K",                      "DCI",        0 },
+        { UIWidgetType::Button,    115,  30,  90, 40, "UHD",                     nullptr,      1 },
+        { UIWidgetType::Button,    210,  30, 100, 40, "HD",                      nullptr,      2 },
+
+        { UIWidgetType::Note,       30,  90,   0,  0, "",                        nullptr,      0 },
+        { UIWidgetType::Note,       30, 105,   0,  0, "SCALED FROM SENSOR AREA", nullptr,      0 },
+
+        { UIWidgetType::Indicator,  20, 120,  90, 40, "",                        nullptr,      0 },
+        { UIWidgetType::Indicator,  20, 120, 290, 40, "FULL / 2.6K / WINDOW",    "CHECK/SET ON CAMERA", 0 }
+    };
+
+    const UIWidgetSpec kPocket6KBRAWWidgets[] =
+    {
+        { UIWidgetType::Label,      30,   9, 160, 16, "BRAW RESOLUTION",         nullptr,      0 },
+
+        { UIWidgetType::Button,     20,  30,  90, 40, "6K",                      nullptr,      0 },
+        { UIWidgetType::Button,    115,  30,  90, 40, "6K",                      "2.4:1",      1 },
+        { UIWidgetType::Button,    210,  30, 100, 40, "5.7K",                    "17:9",       2 },
+        { UIWidgetType::Button,     20,  75,  90, 40, "4K",                      "DCI",        3 },
+        { UIWidgetType::Button,    115,  75,  90, 40, "3.7K",                    "6:5 ANA",    4 },
+        { UIWidgetType::Button,    210,  75, 100, 40, "2.8K",                    "17:9",       5 },
+
+        { UIWidgetType::Text,       20, 127, 290, 20, "",                        nullptr,      0 },
+        { UIWidgetType::Note,       20, 146, 290, 12, "",                        nullptr,      0 }
+    };
+
+    const UIWidgetSpec kPocket6KProResWidgets[] =
+    {
+        { UIWidgetType::Label,      30,   9, 160, 16, "ProRes RESOLUTION",       nullptr,      0 },
+
+        { UIWidgetType::Button,     20,  30,  90, 40, "4K",                      "DCI",        0 },
+        { UIWidgetType::Button,    115,  30,  90, 40, "UHD",                     nullptr,      1 },
+        { UIWidgetType::Button,    210,  30, 100, 40, "HD",                      nullptr,      2 },
+
+        { UIWidgetType::Note,       30,  90,   0,  0, "",                        nullptr,      0 },
+        { UIWidgetType::Note,       30, 105,   0,  0, "SCALED FROM SENSOR AREA", nullptr,      0 },
+
+        { UIWidgetType::Indicator,  20, 120,  90, 40, "FULL",                    nullptr,      0 },
+        { UIWidgetType::Button,     20, 120,  90, 40, "FULL",                    nullptr,      kSensorFull },
+        { UIWidgetType::Button,    115, 120,  90, 40, "5.7K",                    nullptr,      kSensorWindow },
+        { UIWidgetType::Button,    115, 120, 195, 40, "5.7K / 2.8K",             "CHECK/SET ON CAMERA", kSensorWindow }
+    };
+
+    const UIWidgetSpec kURSAMiniProG2Widgets[] =
+    {
+        { UIWidgetType::Label,      30,   9, 160, 16, "",                        nullptr,      0 },
+
+        { UIWidgetType::Button,     20,  30,  90, 40, "4.6K",                    nullptr,      0 },
+        { UIWidgetType::Button,    115,  30,  90, 40, "4.6K",                    "2.4:1",      1 },
+        { UIWidgetType::Button,    210,  30, 100, 40, "4K",                      "16:9",       2 },
+        { UIWidgetType::Button,     20,  75,  90, 40, "4K",                      "DCI",        3 },
+        { UIWidgetType::Button,    115,  75,  90, 40, "UHD",                     nullptr,      4 },
+        { UIWidgetType::Button,    210,  75, 100, 40, "3K",                      "ANA",        5 },
+        { UIWidgetType::Button,     20, 120,  90, 40, "2K",                      "16:9",       6 },
+        { UIWidgetType::Button,    115, 120,  90, 40, "2K",                      "DCI",        7 },
+        { UIWidgetType::Button,    210, 120, 100, 40, "HD",                      nullptr,      8 }
+    };
+
+    // Short name of an option's resolution ("4K DCI", "HD", etc.), compared rather than the sizes as some have two widths
+    std::string getName(CCUPacketTypes::RecordingFormatData recordingFormat, const Option& option)
+    {
+        recordingFormat.width = option.width;
+        recordingFormat.height = option.height;
+        return recordingFormat.frameDimensionsShort_string();
+    }
+
+    // Index of the option showing the recording format, or -1
+    int findOption(byte screen, const CCUPacketTypes::RecordingFormatData& recordingFormat)
+    {
+        CCUPacketTypes::RecordingFormatData current = recordingFormat;
+        std::string currentName = current.frameDimensionsShort_string();
+
+        for(byte index = 0; index < kOptionCounts[screen]; index++)
+        {
+            if(getName(recordingFormat, kOptions[screen][index]) == currentName)
+                return index;
+        }
+
+        return -1;
+    }
+}
+
+UIScreen ResolutionScreen::screens[] =
+{
+    UIScreen(kPocket4KBRAWWidgets, sizeof(kPocket4KBRAWWidgets) / sizeof(kPocket4KBRAWWidgets[0]), kDesignWidth, kDesignHeight),
+    UIScreen(kPocket4KProResWidgets, sizeof(kPocket4KProResWidgets) / sizeof(kPocket4KProResWidgets[0]), kDesignWidth, kDesignHeight),
+    UIScreen(kPocket6KBRAWWidgets, sizeof(kPocket6KBRAWWidgets) / sizeof(kPocket6KBRAWWidgets[0]), kDesignWidth, kDesignHeight),
+    UIScreen(kPocket6KProResWidgets, sizeof(kPocket6KProResWidgets) / sizeof(kPocket6KProResWidgets[0]), kDesignWidth, kDesignHeight),
+    UIScreen(kURSAMiniProG2Widgets, sizeof(kURSAMiniProG2Widgets) / sizeof(kURSAMiniProG2Widgets[0]), kDesignWidth, kDesignHeight)
+};
+
+byte ResolutionScreen::shown = kPocket4KBRAW;
+CCUPacketTypes::RecordingFormatData ResolutionScreen::format = {};
+
+void ResolutionScreen::layout(short width, short height)
+{
+    for(UIScreen& screen : screens)
+        screen.layout(width, height);
+}
+
+bool ResolutionScreen::update(Model model, CCUPacketTypes::BasicCodec codec, const CCUPacketTypes::RecordingFormatData& currentFormat)
+{
+    bool braw = codec == CCUPacketTypes::BasicCodec::BRAW;
+
+    byte newShown = kURSAMiniProG2;
+    if(model == Model::Pocket4K)
+        newShown = braw ? kPocket4KBRAW : kPocket4KProRes;
+    else if(model == Model::Pocket6K)
+        newShown = braw ? kPocket6KBRAW : kPocket6KProRes;
+
+    bool changed = newShown != shown;
+    shown = newShown;
+    format = currentFormat;
+
+    UIScreen& screen = screens[shown];
+    int option = findOption(shown, format);
+
+    for(byte index = 0; index < screen.getCount(); index++)
+    {
+        const UINode& node = screen.getNode(index);
+        if(node.type == UIWidgetType::Button && node.value < kSensorFull)
+            changed = screen.setSelected(index, node.value == option) || changed;
+    }
+
+    std::string dimensions = format.frameWidthHeight_string();
+
+    switch(shown)
+    {
+        case kPocket4KBRAW:
+        case kPocket6KBRAW:
+        {
+            // All but the full size are windowed
+            bool full = option != -1 && kOptions[shown][option].window == 0;
+            changed = screen.setText(kSensorIndex, full ? "FULL SENSOR" : "SENSOR WINDOWED") || changed;
+            changed = screen.setText(kSensorDimensionsIndex, dimensions.c_str()) || changed;
+            break;
+        }
+
+        case kPocket4KProRes:
+            // 4K DCI is from the full sensor and UHD windowed, HD is scaled from full, 2.6K or windowed (however we can't tell which)
+            changed = screen.setText(kDimensionsIndex, dimensions.c_str()) || changed;
+            changed = screen.setVisible(kSensorAreaIndex, option == 0 || option == 1) || changed;
+            changed = screen.setSelected(kSensorAreaIndex, true) || changed;
+            changed = screen.setText(kSensorAreaIndex, option == 0 ? "FULL" : "WINDOW") || changed;
+            changed = screen.setVisible(kSensorHDIndex, option != 0 && option != 1) || changed;
+            changed = screen.setSelected(kSensorHDIndex, true) || changed;
+            break;
+
+        case kPocket6KProRes:
+            // 4K DCI is scaled from 5.7K, UHD from full or 5.7K, HD from full, 5.7K or 2.8K (however we can't change the 5.7K or 2.8K)
+            changed = screen.setText(kDimensionsIndex, dimensions.c_str()) || changed;
+            changed = screen.setVisible(kSensorAreaIndex, option == 0) || changed;
+            changed = screen.setSelected(kSensorAreaIndex, true) || changed;
+            changed = screen.setVisible(kSensorFullIndex, option != 0) || changed;
+            changed = screen.setSelected(kSensorFullIndex, !format.windowedModeEnabled) || changed;
+            changed = screen.setVisible(kSensor57KIndex, option == 1) || changed;
+            changed = screen.setSelected(kSensor57KIndex, format.windowedModeEnabled) || changed;
+            changed = screen.setVisible(kSensorHDWindowIndex, option != 0 && option != 1) || changed;
+            changed = screen.setSelected(kSensorHDWindowIndex, format.windowedModeEnabled) || changed;
+            break;
+
+        default:
+            changed = screen.setText(kTitleIndex, braw ? "BRAW RESOLUTION" : "ProRes RESOLUTION") || changed;
+            break;
+    }
+
+    return changed;
+}
+
+bool ResolutionScreen::hitTest(int x, int y, CCUPacketTypes::RecordingFormatData& newFormat)
+{
+    int index = screens[shown].hitTest(x, y);
+    if(index == -1)
+        return false;
+
+    int value = screens[shown].getNode(index).value;
+
+    newFormat = format;
+
+    if(value == kSensorFull || value == kSensorWindow)
+        newFormat.windowedModeEnabled = value == kSensorWindow;
+    else
+    {
+        const Option& option = kOptions[shown][value];
+        newFormat.width = option.width;
+        newFormat.height = option.height;
+        if(option.window != kKeepWindow)
+            newFormat.windowedModeEnabled = option.window == 1;
+    }
+
+    return true;
+}
+
+void ResolutionScreen::getNextOption(bool forward, CCUPacketTypes::RecordingFormatData& newFormat)
+{
+    byte count = kOptionCounts[shown];
+    int current = findOption(shown, format);
+
+    // A resolution without a button goes to the first (or last)
+    byte next;
+    if(current == -1)
+        next = forward ? 0 : count - 1;
+    else
+        next = forward ? (current + 1) % count : (current + count - 1) % count;
+
+    const Option& option = kOptions[shown][next];
+
+    newFormat = format;
+    newFormat.width = option.width;
+    newFormat.height = option.height;
+    if(option.window != kKeepWindow)
+        newFormat.windowedModeEnabled = option.window == 1;
+}
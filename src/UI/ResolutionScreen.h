@@ -0,0 +1,41 @@
+#ifndef RESOLUTIONSCREEN_H
+#define RESOLUTIONSCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+#include "CCU/CCUPacketTypes.h"
+
+// The resolution screen's widgets and behaviour, shared by every board. Each camera (and codec) has its own resolutions and
+// sensor areas, so there's a laid out screen for each and update picks the one to show.
+class ResolutionScreen
+{
+    public:
+        enum class Model : byte
+        {
+            Pocket4K = 0,
+            Pocket6K = 1,
+            URSAMiniProG2 = 2
+        };
+
+        static void layout(short width, short height);
+
+        // Shows the camera's recording format, returns true if that changed what's shown
+        static bool update(Model model, CCUPacketTypes::BasicCodec codec, const CCUPacketTypes::RecordingFormatData& currentFormat);
+
+        // The recording format a tap at x, y changes to, returns false if it isn't on a button
+        static bool hitTest(int x, int y, CCUPacketTypes::RecordingFormatData& newFormat);
+
+        // For boards without touch, the resolution after (or before) the current one as they're shown (wrapping around)
+        static void getNextOption(bool forward, CCUPacketTypes::RecordingFormatData& newFormat);
+
+        static void draw(const UIBackend& backend) { screens[shown].draw(backend); }
+
+    private:
+        static UIScreen screens[];
+
+        // Which of screens is shown, and the recording format it's showing
+        static byte shown;
+        static CCUPacketTypes::RecordingFormatData format;
+};
+
+#endif
@@ -0,0 +1,43 @@
+#include "RotaryAccelerator.h"
+
+int RotaryAccelerator::turn(int detents, unsigned long sampleMicros)
+{
+    if(detents == 0)
+        return 0;
+
+    int direction = detents > 0 ? 1 : -1;
+    unsigned long elapsed = sampleMicros - lastMicros;
+
+    // A new turn, or the other way, starts slow
+    if(lastMicros == 0 || elapsed > kPauseMicros || direction != lastDirection)
+    {
+        detentsPerSecond = 0;
+        remainder = 0;
+    }
+    else if(elapsed > 0)
+    {
+        float speed = abs(detents) * 1000000.0f / elapsed;
+        detentsPerSecond = detentsPerSecond == 0 ? speed : detentsPerSecond + (speed - detentsPerSecond) * kSmoothing;
+    }
+
+    lastDirection = direction;
+    lastMicros = sampleMicros;
+
+    float ratio = std::min(1.0f, detentsPerSecond / fastDetentsPerSecond);
+    multiplier = 1.0f + (maxMultiplier - 1.0f) * ratio * ratio;
+
+    float units = detents * unitsPerDetent * multiplier + remainder;
+    int whole = static_cast<int>(units);
+    remainder = units - whole;
+
+    return whole;
+}
+
+void RotaryAccelerator::reset()
+{
+    detentsPerSecond = 0;
+    multiplier = 1.0f;
+    remainder = 0;
+    lastDirection = 0;
+    lastMicros = 0;
+}
@@ -0,0 +1,42 @@
+#ifndef ROTARYACCELERATOR_H
+#define ROTARYACCELERATOR_H
+
+#include <Arduino.h>
+
+// Turns the detents of a rotary encoder into units (e.g. focus), more units a detent the faster it's turned.
+// A slow turn is unitsPerDetent a detent so it stays precise, the multiplier rises with the square of the speed up to maxMultiplier
+// at fastDetentsPerSecond and above. The speed is smoothed over the last few samples and starts again from slow after a pause or a
+// change of direction. Fractions of a unit are carried to the next turn, so every detent counts.
+class RotaryAccelerator
+{
+    public:
+        RotaryAccelerator(float inUnitsPerDetent, float inFastDetentsPerSecond, float inMaxMultiplier)
+            : unitsPerDetent(inUnitsPerDetent), fastDetentsPerSecond(inFastDetentsPerSecond), maxMultiplier(inMaxMultiplier) {}
+
+        void setUnitsPerDetent(float units) { unitsPerDetent = units; }
+
+        // Detents turned since the last sample (negative is anticlockwise) and when they were read, returns the units they're worth
+        int turn(int detents, unsigned long sampleMicros);
+
+        // Back to slow, e.g. the encoder has been handed to something else
+        void reset();
+
+        float getDetentsPerSecond() const { return detentsPerSecond; }
+        float getMultiplier() const { return multiplier; }
+
+    private:
+        static const unsigned long kPauseMicros = 250000;  // Still this long and it's a new turn
+        static constexpr float kSmoothing = 0.5f;          // Weight of the newest speed
+
+        float unitsPerDetent;
+        float fastDetentsPerSecond;
+        float maxMultiplier;
+
+        float detentsPerSecond = 0;
+        float multiplier = 1.0f;
+        float remainder = 0;
+        int lastDirection = 0;
+        unsigned long lastMicros = 0;
+};
+
+#endif
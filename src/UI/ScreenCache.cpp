@@ -0,0 +1,164 @@
+#include "ScreenCache.h"
+#include <esp_heap_caps.h>
+
+ScreenCache::Slot ScreenCache::slots[kMaxSlots];
+byte ScreenCache::slotCount = 0;
+size_t ScreenCache::slotBytes = 0;
+unsigned long ScreenCache::useCounter = 0;
+
+unsigned long ScreenCache::hits = 0;
+unsigned long ScreenCache::misses = 0;
+unsigned long ScreenCache::stores = 0;
+
+bool ScreenCache::begin(size_t frameBytes, byte slotsWanted)
+{
+    if(isStarted())
+        return true;
+
+    if(slotsWanted > kMaxSlots)
+        slotsWanted = kMaxSlots;
+
+    // Only worth it with PSRAM, internal RAM can't spare whole frames
+    for(byte index = 0; index < slotsWanted; index++)
+    {
+        uint8_t* pixels = static_cast<uint8_t*>(heap_caps_malloc(frameBytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+        if(pixels == nullptr)
+            break;
+
+        slots[index] = { 0, 0, false, 0, pixels };
+        slotCount++;
+    }
+
+    slotBytes = frameBytes;
+
+    if(slotCount < 2)
+    {
+        DEBUG_INFO("ScreenCache: No PSRAM for cached screens, they'll be drawn each time");
+
+        for(byte index = 0; index < slotCount; index++)
+            free(slots[index].pixels);
+
+        slotCount = 0;
+        return false;
+    }
+
+    DEBUG_INFO("ScreenCache: %u screens of %u bytes in PSRAM", slotCount, static_cast<unsigned int>(frameBytes));
+
+    return true;
+}
+
+ScreenCache::Slot* ScreenCache::find(byte screen)
+{
+    for(byte index = 0; index < slotCount; index++)
+    {
+        if(slots[index].valid && slots[index].screen == screen)
+            return &slots[index];
+    }
+
+    return nullptr;
+}
+
+bool ScreenCache::has(byte screen, unsigned long version)
+{
+    Slot* slot = find(screen);
+    if(slot == nullptr || slot->version != version)
+        return false;
+
+    slot->lastUsed = ++useCounter;
+    return true;
+}
+
+const uint8_t* ScreenCache::get(byte screen, unsigned long& version)
+{
+    Slot* slot = find(screen);
+    if(slot == nullptr)
+    {
+        misses++;
+        return nullptr;
+    }
+
+    slot->lastUsed = ++useCounter;
+    hits++;
+
+    version = slot->version;
+    return slot->pixels;
+}
+
+void ScreenCache::store(byte screen, unsigned long version, const uint8_t* frame)
+{
+    if(!isStarted() || frame == nullptr)
+        return;
+
+    // The screen's older frame if it has one, otherwise an empty slot or the least recently used
+    Slot* target = find(screen);
+    for(byte index = 0; index < slotCount && target == nullptr; index++)
+    {
+        if(!slots[index].valid)
+            target = &slots[index];
+    }
+
+    if(target == nullptr)
+    {
+        target = &slots[0];
+        for(byte index = 1; index < slotCount; index++)
+        {
+            if(slots[index].lastUsed < target->lastUsed)
+                target = &slots[index];
+        }
+    }
+
+    memcpy(target->pixels, frame, slotBytes);
+
+    target->screen = screen;
+    target->version = version;
+    target->valid = true;
+    target->lastUsed = ++useCounter;
+
+    stores++;
+}
+
+bool ScreenCache::restore(byte screen, unsigned long version, uint8_t* frame)
+{
+    Slot* slot = find(screen);
+    if(slot == nullptr || slot->version != version || frame == nullptr)
+        return false;
+
+    memcpy(frame, slot->pixels, slotBytes);
+    return true;
+}
+
+void ScreenCache::invalidate()
+{
+    for(byte index = 0; index < slotCount; index++)
+        slots[index].valid = false;
+}
+
+void ScreenCache::composeSlide(uint8_t* frame, const uint8_t* from, const uint8_t* to, short width, short height, byte bytesPerPixel, short offset, bool forward)
+{
+    size_t rowBytes = static_cast<size_t>(width) * bytesPerPixel;
+    size_t offsetBytes = static_cast<size_t>(offset) * bytesPerPixel;
+
+    for(short row = 0; row < height; row++)
+    {
+        uint8_t* destination = frame + row * rowBytes;
+        const uint8_t* fromRow = from + row * rowBytes;
+        const uint8_t* toRow = to + row * rowBytes;
+
+        if(forward)
+        {
+            // The old screen moves left, the new one follows it in from the right
+            memcpy(destination, fromRow + offsetBytes, rowBytes - offsetBytes);
+            memcpy(destination + rowBytes - offsetBytes, toRow, offsetBytes);
+        }
+        else
+        {
+            memcpy(destination, toRow + rowBytes - offsetBytes, offsetBytes);
+            memcpy(destination + offsetBytes, fromRow, rowBytes - offsetBytes);
+        }
+    }
+}
+
+void ScreenCache::reportStats()
+{
+    DEBUG_INFO("ScreenCache: %lu hits, %lu misses, %lu screens stored, %u slots of %u bytes", hits, misses, stores, slotCount, static_cast<unsigned int>(slotBytes));
+}
@@ -0,0 +1,66 @@
+#ifndef SCREENCACHE_H
+#define SCREENCACHE_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+
+// Whole frames of screens that have already been drawn, kept in PSRAM so moving to one of them is a copy rather than drawing it
+// again. Each frame is tagged with the version of the camera state it shows (the camera's last modified time). The main file draws
+// the screens next to the current one into the cache in idle time and again as the camera changes, so a swipe to them shows a
+// frame straight away and the screen is only redrawn afterwards if the camera has moved on since.
+class ScreenCache
+{
+    public:
+        // Allocates slots frames of frameBytes each, false if there isn't the PSRAM for them (screens are drawn as before)
+        static bool begin(size_t frameBytes, byte slots);
+        static bool isStarted() { return slotCount != 0; }
+
+        // True if screen is cached at version, it's then kept ahead of the others when a slot is needed
+        static bool has(byte screen, unsigned long version);
+
+        // The latest cached frame of screen and the version it shows, nullptr if there isn't one
+        static const uint8_t* get(byte screen, unsigned long& version);
+
+        // Copies a frame that has just been drawn for screen into the least recently used slot (or the one it already has)
+        static void store(byte screen, unsigned long version, const uint8_t* frame);
+
+        // Copies the cached frame of screen at version into frame, false if there isn't one
+        static bool restore(byte screen, unsigned long version, uint8_t* frame);
+
+        // Drops every frame, for changes that affect all screens but not the camera's version (e.g. the sidebar's link health)
+        static void invalidate();
+
+        // Builds a frame of a horizontal slide from one frame to another, offset columns across. Forward slides the new frame in
+        // from the right, otherwise from the left.
+        static void composeSlide(uint8_t* frame, const uint8_t* from, const uint8_t* to, short width, short height, byte bytesPerPixel, short offset, bool forward);
+
+        static unsigned long getHits() { return hits; }
+        static unsigned long getMisses() { return misses; }
+        static unsigned long getStores() { return stores; }
+        static void reportStats();
+
+    private:
+        struct Slot
+        {
+            byte screen;
+            unsigned long version;
+            bool valid;
+            unsigned long lastUsed;
+            uint8_t* pixels;
+        };
+
+        static Slot* find(byte screen);
+
+        static const byte kMaxSlots = 6;
+
+        static Slot slots[kMaxSlots];
+        static byte slotCount;
+        static size_t slotBytes;
+        static unsigned long useCounter;
+
+        static unsigned long hits;
+        static unsigned long misses;
+        static unsigned long stores;
+};
+
+#endif
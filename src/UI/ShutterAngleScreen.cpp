@@ -0,0 +1,77 @@
+#include "ShutterAngleScreen.h"
+
+// In order of value, for stepping up and down
+const int ShutterAngleScreen::kOptions[kOptionCount] = { 1500, 6000, 9000, 12000, 15000, 18000, 27000, 36000 };
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    const byte k180Index = 7;     // Outlined, it's the usual one
+    const byte kCustomIndex = 10; // Last widget, shows the shutter angle when it's not one of the options
+}
+
+const UIWidgetSpec ShutterAngleScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,     30,   9, 120, 16, "SHUTTER ANGLE", nullptr,  0 },
+    { UIWidgetType::Note,     265,   9,   0,  0, "DEGREES",       nullptr,  0 },
+
+    { UIWidgetType::Button,    20,  30,  90, 40, "15",            nullptr,  1500 },
+    { UIWidgetType::Button,   115,  30,  90, 40, "60",            nullptr,  6000 },
+    { UIWidgetType::Button,   210,  30, 100, 40, "90",            nullptr,  9000 },
+
+    { UIWidgetType::Button,    20,  75,  90, 40, "120",           nullptr,  12000 },
+    { UIWidgetType::Button,   115,  75,  90, 40, "150",           nullptr,  15000 },
+    { UIWidgetType::Button,   210,  75, 100, 40, "180",           nullptr,  18000 },
+
+    { UIWidgetType::Button,    20, 120,  90, 40, "270",           nullptr,  27000 },
+    { UIWidgetType::Button,   115, 120,  90, 40, "360",           nullptr,  36000 },
+    { UIWidgetType::Indicator, 210, 120, 100, 40, "",             "CUSTOM", 0 }
+};
+
+UIScreen ShutterAngleScreen::screen(ShutterAngleScreen::kWidgets, sizeof(ShutterAngleScreen::kWidgets) / sizeof(ShutterAngleScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+void ShutterAngleScreen::layout(short width, short height)
+{
+    screen.layout(width, height);
+    screen.setOutline(k180Index, UIColour::Text);
+}
+
+bool ShutterAngleScreen::update(int currentShutterAngle)
+{
+    bool changed = false;
+    bool isOption = false;
+
+    for(byte index = 0; index < screen.getCount(); index++)
+    {
+        const UINode& node = screen.getNode(index);
+        if(node.type != UIWidgetType::Button)
+            continue;
+
+        bool selected = node.value == currentShutterAngle;
+        isOption = isOption || selected;
+
+        changed = screen.setSelected(index, selected) || changed;
+    }
+
+    // Custom shutter angle - show if it's not one of the options, with a decimal place when it has one
+    bool showCustom = currentShutterAngle != 0 && !isOption;
+    changed = screen.setVisible(kCustomIndex, showCustom) || changed;
+
+    if(showCustom)
+    {
+        changed = screen.setSelected(kCustomIndex, true) || changed;
+        changed = screen.setText(kCustomIndex, String(currentShutterAngle / 100.0, currentShutterAngle % 100 == 0 ? 0 : 1).c_str()) || changed;
+    }
+
+    return changed;
+}
+
+int ShutterAngleScreen::hitTest(int x, int y)
+{
+    int index = screen.hitTest(x, y);
+
+    return index == -1 ? 0 : screen.getNode(index).value;
+}
@@ -0,0 +1,33 @@
+#ifndef SHUTTERANGLESCREEN_H
+#define SHUTTERANGLESCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+
+// The shutter angle screen's widgets and behaviour, shared by every board. Angles are times 100, as the protocol has them (180
+// degrees is 18000, 172.8 degrees is 17280).
+class ShutterAngleScreen
+{
+    public:
+        static const byte kOptionCount = 8;
+
+        static void layout(short width, short height);
+
+        // Selects the button for the camera's shutter angle (or shows it as a custom value), returns true if that changed what's shown
+        static bool update(int currentShutterAngle);
+
+        // Shutter angle of the button at x, y, or 0 if there isn't one
+        static int hitTest(int x, int y);
+
+        // For boards without touch, the next shutter angle up or down from the current one (wrapping around)
+        static int getNextOption(int currentShutterAngle, bool up) { return UIScreen::getNextOption(kOptions, kOptionCount, currentShutterAngle, up); }
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const int kOptions[kOptionCount];
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#include "ShutterSpeedScreen.h"
+
+// In order of value, for stepping up and down
+const int ShutterSpeedScreen::kOptions[kOptionCount] = { 30, 50, 60, 125, 200, 250, 500, 2000 };
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    const byte kFrameRateIndex = 1;
+    const byte kCustomIndex = 10; // Last widget, shows the shutter speed when it's not one of the options
+}
+
+const UIWidgetSpec ShutterSpeedScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,     30,   9, 120, 16, "SHUTTER SPEED", nullptr,  0 },
+    { UIWidgetType::Note,     250,   7,  60, 12, "",              nullptr,  0 },
+
+    { UIWidgetType::Button,    20,  30,  90, 40, "1/30",          nullptr,  30 },
+    { UIWidgetType::Button,   115,  30,  90, 40, "1/50",          nullptr,  50 },
+    { UIWidgetType::Button,   210,  30, 100, 40, "1/60",          nullptr,  60 },
+
+    { UIWidgetType::Button,    20,  75,  90, 40, "1/125",         nullptr,  125 },
+    { UIWidgetType::Button,   115,  75,  90, 40, "1/200",         nullptr,  200 },
+    { UIWidgetType::Button,   210,  75, 100, 40, "1/250",         nullptr,  250 },
+
+    { UIWidgetType::Button,    20, 120,  90, 40, "1/500",         nullptr,  500 },
+    { UIWidgetType::Button,   115, 120,  90, 40, "1/2000",        nullptr,  2000 },
+    { UIWidgetType::Indicator, 210, 120, 100, 40, "",             "CUSTOM", 0 }
+};
+
+UIScreen ShutterSpeedScreen::screen(ShutterSpeedScreen::kWidgets, sizeof(ShutterSpeedScreen::kWidgets) / sizeof(ShutterSpeedScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+bool ShutterSpeedScreen::update(int currentShutterSpeed, const char* frameRate)
+{
+    bool changed = screen.setVisible(kFrameRateIndex, frameRate != nullptr);
+
+    if(frameRate != nullptr)
+        changed = screen.setText(kFrameRateIndex, (String(frameRate) + " fps").c_str()) || changed;
+
+    bool isOption = false;
+
+    for(byte index = 0; index < screen.getCount(); index++)
+    {
+        const UINode& node = screen.getNode(index);
+        if(node.type != UIWidgetType::Button)
+            continue;
+
+        bool selected = node.value == currentShutterSpeed;
+        isOption = isOption || selected;
+
+        changed = screen.setSelected(index, selected) || changed;
+    }
+
+    // Custom shutter speed - show if it's not one of the options
+    bool showCustom = currentShutterSpeed != 0 && !isOption;
+    changed = screen.setVisible(kCustomIndex, showCustom) || changed;
+
+    if(showCustom)
+    {
+        changed = screen.setSelected(kCustomIndex, true) || changed;
+        changed = screen.setText(kCustomIndex, ("1/" + String(currentShutterSpeed)).c_str()) || changed;
+    }
+
+    return changed;
+}
+
+int ShutterSpeedScreen::hitTest(int x, int y)
+{
+    int index = screen.hitTest(x, y);
+
+    return index == -1 ? 0 : screen.getNode(index).value;
+}
@@ -0,0 +1,34 @@
+#ifndef SHUTTERSPEEDSCREEN_H
+#define SHUTTERSPEEDSCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+
+// The shutter speed screen's widgets and behaviour, shared by every board. Speeds are the denominator, as the protocol has them
+// (1/60 is 60).
+class ShutterSpeedScreen
+{
+    public:
+        static const byte kOptionCount = 8;
+
+        static void layout(short width, short height) { screen.layout(width, height); }
+
+        // Selects the button for the camera's shutter speed (or shows it as a custom value) and shows the frame rate it's against
+        // (nullptr if it isn't known), returns true if that changed what's shown
+        static bool update(int currentShutterSpeed, const char* frameRate);
+
+        // Shutter speed of the button at x, y, or 0 if there isn't one
+        static int hitTest(int x, int y);
+
+        // For boards without touch, the next shutter speed up or down from the current one (wrapping around)
+        static int getNextOption(int currentShutterSpeed, bool up) { return UIScreen::getNextOption(kOptions, kOptionCount, currentShutterSpeed, up); }
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const int kOptions[kOptionCount];
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+};
+
+#endif
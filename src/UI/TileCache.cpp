@@ -0,0 +1,152 @@
+#include "TileCache.h"
+#include <esp_heap_caps.h>
+
+std::vector<TileCache::Entry> TileCache::entries;
+size_t TileCache::budget = 0;
+size_t TileCache::bytesUsed = 0;
+unsigned long TileCache::useCounter = 0;
+
+unsigned long TileCache::hits = 0;
+unsigned long TileCache::misses = 0;
+unsigned long TileCache::evictions = 0;
+
+void TileCache::begin(size_t budgetBytes)
+{
+    clear();
+    budget = budgetBytes;
+
+    DEBUG_INFO("TileCache: %u byte budget, %s", static_cast<unsigned int>(budget), heap_caps_get_free_size(MALLOC_CAP_SPIRAM) > 0 ? "PSRAM" : "internal RAM");
+}
+
+TileCache::Key TileCache::makeKey(const char* text, const char* caption, byte state, short w, short h)
+{
+    Key key;
+    key.hash = 2166136261u; // FNV-1a
+    key.length = 0;
+
+    bool tooLong = false;
+    auto addByte = [&key, &tooLong](uint8_t value)
+    {
+        key.hash ^= value;
+        key.hash *= 16777619u;
+
+        if(key.length < kMaxKeyLength)
+            key.text[key.length++] = static_cast<char>(value);
+        else
+            tooLong = true;
+    };
+
+    for(const char* character = text; character != nullptr && *character != '\0'; character++)
+        addByte(*character);
+
+    addByte(0); // So "A" + "BC" differs from "AB" + "C"
+
+    for(const char* character = caption; character != nullptr && *character != '\0'; character++)
+        addByte(*character);
+
+    addByte(state);
+    addByte(w & 0xFF);
+    addByte(w >> 8);
+    addByte(h & 0xFF);
+    addByte(h >> 8);
+
+    if(tooLong)
+        key.length = 0;
+
+    return key;
+}
+
+TileCache::Entry* TileCache::find(const Key& key, short w, short h, byte bytesPerPixel)
+{
+    for(Entry& entry : entries)
+    {
+        if(entry.key == key && entry.w == w && entry.h == h && entry.bytesPerPixel == bytesPerPixel)
+            return &entry;
+    }
+
+    return nullptr;
+}
+
+bool TileCache::draw(const Key& key, const UIRect& rect, uint8_t* frame, short frameWidth, byte bytesPerPixel)
+{
+    if(!isStarted() || frame == nullptr || !key.isCacheable())
+        return false;
+
+    Entry* entry = find(key, rect.w, rect.h, bytesPerPixel);
+    if(entry == nullptr)
+    {
+        misses++;
+        return false;
+    }
+
+    entry->lastUsed = ++useCounter;
+    hits++;
+
+    size_t rowBytes = static_cast<size_t>(rect.w) * bytesPerPixel;
+    for(short row = 0; row < rect.h; row++)
+        memcpy(frame + (static_cast<size_t>(rect.y + row) * frameWidth + rect.x) * bytesPerPixel, entry->pixels + row * rowBytes, rowBytes);
+
+    return true;
+}
+
+void TileCache::store(const Key& key, const UIRect& rect, const uint8_t* frame, short frameWidth, byte bytesPerPixel)
+{
+    if(!isStarted() || frame == nullptr || rect.isEmpty() || !key.isCacheable())
+        return;
+
+    size_t rowBytes = static_cast<size_t>(rect.w) * bytesPerPixel;
+    size_t bytes = rowBytes * rect.h;
+
+    // Not worth emptying the cache for
+    if(bytes > budget / 2)
+        return;
+
+    while(bytesUsed + bytes > budget && !entries.empty())
+        evictLeastRecentlyUsed();
+
+    // Use PSRAM for the tiles if we have it
+    uint8_t* pixels = static_cast<uint8_t*>(heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT));
+    if(pixels == nullptr)
+        pixels = static_cast<uint8_t*>(malloc(bytes));
+
+    if(pixels == nullptr)
+        return;
+
+    for(short row = 0; row < rect.h; row++)
+        memcpy(pixels + row * rowBytes, frame + (static_cast<size_t>(rect.y + row) * frameWidth + rect.x) * bytesPerPixel, rowBytes);
+
+    entries.push_back({ key, rect.w, rect.h, bytesPerPixel, pixels, bytes, ++useCounter });
+    bytesUsed += bytes;
+}
+
+void TileCache::evictLeastRecentlyUsed()
+{
+    size_t oldest = 0;
+    for(size_t index = 1; index < entries.size(); index++)
+    {
+        if(entries[index].lastUsed < entries[oldest].lastUsed)
+            oldest = index;
+    }
+
+    free(entries[oldest].pixels);
+    bytesUsed -= entries[oldest].bytes;
+
+    entries[oldest] = entries.back();
+    entries.pop_back();
+
+    evictions++;
+}
+
+void TileCache::clear()
+{
+    for(Entry& entry : entries)
+        free(entry.pixels);
+
+    entries.clear();
+    bytesUsed = 0;
+}
+
+void TileCache::reportStats()
+{
+    DEBUG_INFO("TileCache: %u tiles, %u of %u bytes, %lu hits, %lu misses, %lu evictions", static_cast<unsigned int>(entries.size()), static_cast<unsigned int>(bytesUsed), static_cast<unsigned int>(budget), hits, misses, evictions);
+}
@@ -0,0 +1,74 @@
+#ifndef TILECACHE_H
+#define TILECACHE_H
+
+#include <Arduino.h>
+#include <vector>
+#include "Arduino_DebugUtils.h"
+#include "UI/DirtyRegion.h"
+
+// Pixels of tiles that have already been drawn (anti-aliased rounded rectangles and GFX font text are slow), so the next time the
+// same tile is needed it's copied into the frame instead. Tiles are kept in the frame's own pixel format (e.g. byte swapped RGB565,
+// RGB332), in PSRAM when there is some, and the least recently used are dropped to stay within the memory budget.
+class TileCache
+{
+    public:
+        static void begin(size_t budgetBytes);
+        static bool isStarted() { return budget != 0; }
+
+        static const size_t kMaxKeyLength = 64;
+
+        // Everything that affects how a tile looks. The hash is only there to skip most entries quickly, a tile is matched on the whole
+        // text, so two tiles whose hashes collide can't be mixed up. Ones with too much text to keep aren't cached (length is 0).
+        struct Key
+        {
+            uint32_t hash;
+            byte length;
+            char text[kMaxKeyLength];
+
+            bool isCacheable() const { return length != 0; }
+            bool operator==(const Key& other) const { return hash == other.hash && length == other.length && memcmp(text, other.text, length) == 0; }
+        };
+
+        // Identifies a tile by everything that affects how it looks
+        static Key makeKey(const char* text, const char* caption, byte state, short w, short h);
+
+        // Copies a cached tile into the frame at rect, returns false if it isn't cached
+        static bool draw(const Key& key, const UIRect& rect, uint8_t* frame, short frameWidth, byte bytesPerPixel);
+
+        // Copies a tile that has just been drawn at rect out of the frame into the cache
+        static void store(const Key& key, const UIRect& rect, const uint8_t* frame, short frameWidth, byte bytesPerPixel);
+
+        static void clear();
+
+        static unsigned long getHits() { return hits; }
+        static unsigned long getMisses() { return misses; }
+        static unsigned long getEvictions() { return evictions; }
+        static size_t getBytesUsed() { return bytesUsed; }
+        static void reportStats();
+
+    private:
+        struct Entry
+        {
+            Key key;
+            short w;
+            short h;
+            byte bytesPerPixel;
+            uint8_t* pixels;
+            size_t bytes;
+            unsigned long lastUsed;
+        };
+
+        static Entry* find(const Key& key, short w, short h, byte bytesPerPixel);
+        static void evictLeastRecentlyUsed();
+
+        static std::vector<Entry> entries;
+        static size_t budget;
+        static size_t bytesUsed;
+        static unsigned long useCounter;
+
+        static unsigned long hits;
+        static unsigned long misses;
+        static unsigned long evictions;
+};
+
+#endif
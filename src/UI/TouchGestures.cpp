@@ -0,0 +1,171 @@
+#include "TouchGestures.h"
+
+TouchGestures::Event TouchGestures::queue[kQueueSize];
+byte TouchGestures::queueHead = 0;
+byte TouchGestures::queueCount = 0;
+
+bool TouchGestures::fingerDown = false;
+bool TouchGestures::dragging = false;
+bool TouchGestures::longPressed = false;
+bool TouchGestures::cancelled = false;
+short TouchGestures::startX = 0;
+short TouchGestures::startY = 0;
+short TouchGestures::lastX = 0;
+short TouchGestures::lastY = 0;
+short TouchGestures::lastDragX = 0;
+short TouchGestures::lastDragY = 0;
+unsigned long TouchGestures::downMicros = 0;
+unsigned long TouchGestures::lastMicros = 0;
+float TouchGestures::velocityX = 0;
+float TouchGestures::velocityY = 0;
+
+unsigned long TouchGestures::reports = 0;
+unsigned long TouchGestures::contactMicros = 0;
+unsigned long TouchGestures::taps = 0;
+unsigned long TouchGestures::longPresses = 0;
+unsigned long TouchGestures::drags = 0;
+unsigned long TouchGestures::flings = 0;
+unsigned long TouchGestures::dropped = 0;
+
+void TouchGestures::sample(bool down, short x, short y, unsigned long sampleMicros)
+{
+    if(down && !fingerDown)
+    {
+        // Finger down, a new touch
+        fingerDown = true;
+        dragging = false;
+        longPressed = false;
+        cancelled = false;
+        startX = lastX = lastDragX = x;
+        startY = lastY = lastDragY = y;
+        downMicros = lastMicros = sampleMicros;
+        velocityX = velocityY = 0;
+        reports++;
+        return;
+    }
+
+    if(!fingerDown)
+        return;
+
+    reports++;
+
+    if(down)
+    {
+        // Moved (or the same place reported again), half of each new reading so one jittery report doesn't throw the velocity
+        unsigned long elapsed = sampleMicros - lastMicros;
+        if(elapsed > 0 && (x != lastX || y != lastY))
+        {
+            velocityX = velocityX * 0.5f + (static_cast<float>(x - lastX) * 1000000.0f / elapsed) * 0.5f;
+            velocityY = velocityY * 0.5f + (static_cast<float>(y - lastY) * 1000000.0f / elapsed) * 0.5f;
+            lastMicros = sampleMicros;
+        }
+
+        lastX = x;
+        lastY = y;
+
+        if(cancelled)
+            return;
+
+        if(!dragging && !longPressed && (abs(x - startX) > kSlopPixels || abs(y - startY) > kSlopPixels))
+        {
+            dragging = true;
+            drags++;
+            push(Gesture::DragStart, x, y, sampleMicros);
+        }
+        else if(dragging && (x != lastDragX || y != lastDragY))
+            push(Gesture::Drag, x, y, sampleMicros);
+
+        return;
+    }
+
+    // Lifted
+    fingerDown = false;
+    contactMicros += sampleMicros - downMicros;
+
+    if(cancelled)
+        return;
+
+    if(dragging)
+    {
+        // Stopped before lifting, it's placed rather than thrown
+        if(sampleMicros - lastMicros > kStaleVelocityMs * 1000)
+            velocityX = velocityY = 0;
+
+        // A fling comes before the drag's end so it's still part of the drag
+        if(fabsf(velocityX) >= kFlingPixelsPerSecond || fabsf(velocityY) >= kFlingPixelsPerSecond)
+        {
+            flings++;
+            push(Gesture::Fling, x, y, sampleMicros);
+        }
+
+        push(Gesture::DragEnd, x, y, sampleMicros);
+
+        dragging = false;
+    }
+    else if(!longPressed)
+    {
+        taps++;
+        push(Gesture::Tap, x, y, sampleMicros);
+    }
+}
+
+bool TouchGestures::poll(Event& event)
+{
+    // Held still, nothing more may be reported until the finger moves or lifts so check the time here
+    if(fingerDown && !dragging && !longPressed && !cancelled && micros() - downMicros >= kLongPressMs * 1000)
+    {
+        longPressed = true;
+        longPresses++;
+        push(Gesture::LongPress, lastX, lastY, micros());
+    }
+
+    if(queueCount == 0)
+        return false;
+
+    event = queue[queueHead];
+    queueHead = (queueHead + 1) % kQueueSize;
+    queueCount--;
+
+    return true;
+}
+
+void TouchGestures::cancel()
+{
+    cancelled = true;
+    dragging = false;
+    queueCount = 0;
+}
+
+void TouchGestures::push(Gesture gesture, short x, short y, unsigned long sampleMicros)
+{
+    if(queueCount == kQueueSize)
+    {
+        dropped++;
+        return;
+    }
+
+    Event& event = queue[(queueHead + queueCount) % kQueueSize];
+    event.gesture = gesture;
+    event.x = x;
+    event.y = y;
+    event.startX = startX;
+    event.startY = startY;
+    event.deltaX = x - lastDragX;
+    event.deltaY = y - lastDragY;
+    event.velocityX = velocityX;
+    event.velocityY = velocityY;
+    event.sampleMicros = sampleMicros;
+
+    queueCount++;
+
+    lastDragX = x;
+    lastDragY = y;
+}
+
+void TouchGestures::reportStats()
+{
+    // Reports per second while a finger was down, how often the controller is actually being read
+    unsigned long reportRate = contactMicros > 0 ? static_cast<unsigned long>(static_cast<uint64_t>(reports) * 1000000 / contactMicros) : 0;
+
+    DEBUG_INFO("TouchGestures: %lu reports (%lu per second in contact), %lu taps, %lu long presses, %lu drags, %lu flings, %lu dropped", reports, reportRate, taps, longPresses, drags, flings, dropped);
+}
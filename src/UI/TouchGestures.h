@@ -0,0 +1,92 @@
+#ifndef TOUCHGESTURES_H
+#define TOUCHGESTURES_H
+
+#include <Arduino.h>
+#include "Arduino_DebugUtils.h"
+
+// Turns touch reports into taps, long presses, drags and flings.
+// Every report from the touch controller is passed in with the time it was taken (the CST816S's interrupt time, the CoreS3's read
+// time), not just the finger lifting. A finger that moves further than kSlopPixels is a drag and is reported on each move until it
+// lifts, a fling comes just before the drag ends if it was still moving quickly. Velocities are pixels per second, smoothed over the
+// last few reports.
+class TouchGestures
+{
+    public:
+        enum class Gesture : byte
+        {
+            None = 0,
+            Tap,
+            LongPress,
+            DragStart,
+            Drag,
+            DragEnd,
+            Fling
+        };
+
+        struct Event
+        {
+            Gesture gesture = Gesture::None;
+            short x = 0;                 // Where the finger is, or lifted
+            short y = 0;
+            short startX = 0;            // Where it went down
+            short startY = 0;
+            short deltaX = 0;            // Movement since the previous drag event
+            short deltaY = 0;
+            float velocityX = 0;
+            float velocityY = 0;
+            unsigned long sampleMicros = 0; // When the report behind this event was taken
+        };
+
+        // A report from the touch controller, down is false once the finger has lifted
+        static void sample(bool down, short x, short y, unsigned long sampleMicros);
+
+        // Next gesture, false when there are none. A long press is raised here once the finger has been still long enough, the
+        // controller may not report a finger that isn't moving.
+        static bool poll(Event& event);
+
+        static bool isDown() { return fingerDown; }
+        static bool isDragging() { return dragging; }
+
+        // The rest of this touch produces no gestures, e.g. the screen has changed under the finger
+        static void cancel();
+
+        static void reportStats();
+
+    private:
+        static const byte kQueueSize = 8;
+        static const short kSlopPixels = 8;                 // Movement allowed in a tap or long press
+        static const unsigned long kLongPressMs = 600;
+        static const unsigned long kStaleVelocityMs = 60;   // A finger that stopped this long before lifting isn't flung
+        static constexpr float kFlingPixelsPerSecond = 500.0f;
+
+        static void push(Gesture gesture, short x, short y, unsigned long sampleMicros);
+
+        static Event queue[kQueueSize];
+        static byte queueHead;
+        static byte queueCount;
+
+        static bool fingerDown;
+        static bool dragging;
+        static bool longPressed;
+        static bool cancelled;
+        static short startX;
+        static short startY;
+        static short lastX;
+        static short lastY;
+        static short lastDragX;
+        static short lastDragY;
+        static unsigned long downMicros;
+        static unsigned long lastMicros;
+        static float velocityX;
+        static float velocityY;
+
+        static unsigned long reports;
+        static unsigned long contactMicros;
+        static unsigned long taps;
+        static unsigned long longPresses;
+        static unsigned long drags;
+        static unsigned long flings;
+        static unsigned long dropped;
+};
+
+#endif
@@ -0,0 +1,210 @@
+#include "UIScreen.h"
+#include "UI/TileCache.h"
+
+UIScreen::UIScreen(const UIWidgetSpec* specs, byte count, short inDesignWidth, short inDesignHeight) : designWidth(inDesignWidth), designHeight(inDesignHeight)
+{
+    nodes.reserve(count);
+
+    for(byte index = 0; index < count; index++)
+    {
+        UINode node;
+        node.type = specs[index].type;
+        node.value = specs[index].value;
+        node.caption = specs[index].caption;
+        node.designRect = UIRect(specs[index].x, specs[index].y, specs[index].w, specs[index].h);
+
+        strncpy(node.text, specs[index].text != nullptr ? specs[index].text : "", sizeof(node.text) - 1);
+        node.text[sizeof(node.text) - 1] = '\0';
+
+        nodes.push_back(node);
+    }
+}
+
+void UIScreen::layout(short width, short height)
+{
+    if(width == laidOutWidth && height == laidOutHeight)
+        return;
+
+    hitRegions.clear();
+
+    for(byte index = 0; index < nodes.size(); index++)
+    {
+        UINode& node = nodes[index];
+
+        // Scale the edges rather than the size so neighbouring widgets keep their gaps
+        short left = static_cast<long>(node.designRect.x) * width / designWidth;
+        short top = static_cast<long>(node.designRect.y) * height / designHeight;
+        short right = static_cast<long>(node.designRect.x + node.designRect.w) * width / designWidth;
+        short bottom = static_cast<long>(node.designRect.y + node.designRect.h) * height / designHeight;
+
+        // Text without a width is drawn from its position
+        if(node.designRect.w == 0)
+            node.rect = UIRect(left, top, 0, 0);
+        else
+            node.rect = UIRect(left, top, right - left, bottom - top);
+
+        if(node.type == UIWidgetType::Label || node.rect.w == 0)
+        {
+            node.textX = node.rect.x;
+            node.textY = node.rect.y;
+        }
+        else
+        {
+            // Value in the middle, or in the top part when there's a caption underneath
+            node.textX = node.rect.x + node.rect.w / 2;
+            node.textY = node.rect.y + (node.caption != nullptr ? node.rect.h * 7 / 20 : node.rect.h / 2);
+            node.captionY = node.rect.y + node.rect.h * 4 / 5;
+        }
+
+        if(node.type == UIWidgetType::Button || node.type == UIWidgetType::IconButton)
+            hitRegions.push_back({ node.rect, index });
+    }
+
+    laidOutWidth = width;
+    laidOutHeight = height;
+}
+
+int UIScreen::hitTest(int x, int y) const
+{
+    for(const HitRegion& region : hitRegions)
+    {
+        if(nodes[region.index].visible && region.rect.contains(x, y))
+            return region.index;
+    }
+
+    return -1;
+}
+
+void UIScreen::draw(const UIBackend& backend) const
+{
+    uint8_t* frame = backend.frameBuffer != nullptr && TileCache::isStarted() ? backend.frameBuffer() : nullptr;
+
+    for(const UINode& node : nodes)
+    {
+        if(!node.visible)
+            continue;
+
+        if(node.type == UIWidgetType::Label)
+        {
+            backend.drawText(node.text, node.textX, node.textY, UITextStyle::Title, UITextAlign::TopLeft, UIColour::Background);
+            continue;
+        }
+
+        if(node.type == UIWidgetType::Text || node.type == UIWidgetType::Note)
+        {
+            UITextStyle style = node.type == UIWidgetType::Text ? UITextStyle::Value : UITextStyle::Caption;
+            UITextAlign align = node.rect.w == 0 ? UITextAlign::TopLeft : UITextAlign::Centre;
+            UIColour background = getBackground(node.textX, node.textY);
+
+            backend.drawText(node.text, node.textX, node.textY, style, align, background);
+
+            if(node.caption != nullptr && node.rect.w != 0)
+                backend.drawText(node.caption, node.textX, node.captionY, UITextStyle::Caption, UITextAlign::Centre, background);
+
+            continue;
+        }
+
+        // Buttons are drawn on the cleared background, so one that looks the same can be copied from the cache
+        bool cacheable = frame != nullptr && node.rect.x >= 0 && node.rect.y >= 0 && node.rect.x + node.rect.w <= backend.frameWidth && node.rect.y + node.rect.h <= backend.frameHeight;
+        TileCache::Key key = {};
+
+        if(cacheable)
+        {
+            byte state = (node.selected ? 1 : 0) | (static_cast<byte>(node.outline) << 1) | (node.type == UIWidgetType::IconButton ? 0x80 : 0);
+            key = TileCache::makeKey(node.text, node.caption, state, node.rect.w, node.rect.h);
+            if(TileCache::draw(key, node.rect, frame, backend.frameWidth, backend.bytesPerPixel))
+                continue;
+        }
+
+        UIColour fill = node.selected ? UIColour::ButtonSelected : UIColour::Button;
+        backend.fillRoundRect(node.rect.x, node.rect.y, node.rect.w, node.rect.h, 3, fill);
+
+        if(node.outline != UIColour::Background)
+            backend.drawRoundRect(node.rect.x, node.rect.y, node.rect.w, node.rect.h, 3, node.outline);
+
+        if(node.type == UIWidgetType::IconButton)
+            backend.drawIcon(node.text, node.textX, node.textY, node.selected);
+        else if(node.text[0] != '\0')
+            backend.drawText(node.text, node.textX, node.textY, UITextStyle::Value, UITextAlign::Centre, fill);
+
+        if(node.caption != nullptr)
+            backend.drawText(node.caption, node.textX, node.captionY, UITextStyle::Caption, UITextAlign::Centre, fill);
+
+        if(cacheable)
+            TileCache::store(key, node.rect, frame, backend.frameWidth, backend.bytesPerPixel);
+    }
+}
+
+UIColour UIScreen::getBackground(short x, short y) const
+{
+    for(const UINode& node : nodes)
+    {
+        if(!node.visible || node.rect.w == 0 || !node.rect.contains(x, y))
+            continue;
+
+        if(node.type == UIWidgetType::Button || node.type == UIWidgetType::Indicator || node.type == UIWidgetType::IconButton)
+            return node.selected ? UIColour::ButtonSelected : UIColour::Button;
+    }
+
+    return UIColour::Background;
+}
+
+bool UIScreen::setSelected(byte index, bool selected)
+{
+    if(nodes[index].selected == selected)
+        return false;
+
+    nodes[index].selected = selected;
+    return true;
+}
+
+bool UIScreen::setVisible(byte index, bool visible)
+{
+    if(nodes[index].visible == visible)
+        return false;
+
+    nodes[index].visible = visible;
+    return true;
+}
+
+bool UIScreen::setText(byte index, const char* text)
+{
+    if(strncmp(nodes[index].text, text, sizeof(nodes[index].text) - 1) == 0)
+        return false;
+
+    strncpy(nodes[index].text, text, sizeof(nodes[index].text) - 1);
+    nodes[index].text[sizeof(nodes[index].text) - 1] = '\0';
+    return nodes[index].visible;
+}
+
+bool UIScreen::setOutline(byte index, UIColour outline)
+{
+    if(nodes[index].outline == outline)
+        return false;
+
+    nodes[index].outline = outline;
+    return nodes[index].visible;
+}
+
+int UIScreen::getNextOption(const int* options, byte count, int current, bool up)
+{
+    // Find the closest option (particularly if it's not one of them)
+    byte closestIndex = 0;
+    int minDifference = std::abs(current - options[0]);
+
+    for(byte index = 1; index < count; index++)
+    {
+        int difference = std::abs(current - options[index]);
+        if(difference < minDifference)
+        {
+            minDifference = difference;
+            closestIndex = index;
+        }
+    }
+
+    // Up on the last option goes to the first, down on the first goes to the last
+    if(up)
+        return options[(closestIndex + 1) % count];
+    else
+        return options[(closestIndex + count - 1) % count];
+}
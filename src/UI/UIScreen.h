@@ -0,0 +1,143 @@
+#ifndef UISCREEN_H
+#define UISCREEN_H
+
+#include <Arduino.h>
+#include <vector>
+#include "UI/DirtyRegion.h"
+
+// Colours are named by what they're for, each board's backend maps them to its display's colour format (RGB565, RGB332)
+enum class UIColour : byte
+{
+    Background = 0,
+    Text = 1,
+    Button = 2,
+    ButtonSelected = 3,
+    Alert = 4    // Outline of a button showing an error, e.g. a media slot
+};
+
+// Each board's backend maps these to its fonts (TFT_eSPI text sizes, M5GFX/Chimera-Core free fonts)
+enum class UITextStyle : byte
+{
+    Title = 0,   // Screen name, top left
+    Value = 1,   // Button values
+    Caption = 2  // Small text under a button's value, e.g. "NATIVE"
+};
+
+enum class UITextAlign : byte
+{
+    TopLeft = 0,
+    Centre = 1   // x, y is the middle of the text
+};
+
+// The drawing a board has to provide, everything else about a screen is shared
+struct UIBackend
+{
+    void (*fillRoundRect)(short x, short y, short w, short h, short radius, UIColour colour);
+    void (*drawText)(const char* text, short x, short y, UITextStyle style, UITextAlign align, UIColour background);
+    void (*drawRoundRect)(short x, short y, short w, short h, short radius, UIColour colour);
+
+    // Draws the board's image called name with its middle at x, y (selected images are drawn on the selected button colour)
+    void (*drawIcon)(const char* name, short x, short y, bool selected);
+
+    // The frame being drawn into, so drawn buttons can be cached (UI/TileCache). frameBuffer can be nullptr to not cache.
+    uint8_t* (*frameBuffer)();
+    short frameWidth;
+    short frameHeight;
+    byte bytesPerPixel;
+};
+
+// Text and notes are drawn from x, y when they have no width, otherwise in the middle of their rectangle. Over a button they're drawn
+// after it, on its colour.
+enum class UIWidgetType : byte
+{
+    Label = 0,
+    Button = 1,     // Tappable, hit-testing returns its value
+    Indicator = 2,  // Looks like a button but isn't tappable (e.g. showing a custom value)
+    IconButton = 3, // A button showing the board's image named by its text
+    Text = 4,       // Value sized text without a button, with its caption underneath
+    Note = 5        // Caption sized text
+};
+
+// Declarative description of a widget, positions are in the screen's design units
+struct UIWidgetSpec
+{
+    UIWidgetType type;
+    short x;
+    short y;
+    short w;
+    short h;
+    const char* text;
+    const char* caption;
+    int value;
+};
+
+// A widget once laid out for a display, with its state
+struct UINode
+{
+    UIWidgetType type;
+    int value;
+    char text[24];
+    const char* caption;
+
+    UIRect designRect; // Design units, as described
+    UIRect rect;       // Display pixels, once laid out
+    short textX = 0;   // Where the text and caption are drawn, worked out when laid out
+    short textY = 0;
+    short captionY = 0;
+
+    bool selected = false;
+    bool visible = true;
+    UIColour outline = UIColour::Background; // Background for no outline
+};
+
+// Retained widget tree for a screen.
+// The screen is described once (an array of UIWidgetSpec), laid out once for the display's size and then kept: drawing and tap
+// handling reuse the laid out rectangles and a hit-test table rather than redoing the coordinate maths every frame.
+// Buttons are drawn from the tile cache when it's started and they've been drawn the same way before.
+class UIScreen
+{
+    public:
+        UIScreen(const UIWidgetSpec* specs, byte count, short inDesignWidth, short inDesignHeight);
+
+        // Scales the design to the display area, does nothing if it's already laid out for this size
+        void layout(short width, short height);
+        bool isLaidOut() const { return laidOutWidth != 0; }
+
+        // Returns the index of the button at x, y, or -1
+        int hitTest(int x, int y) const;
+
+        void draw(const UIBackend& backend) const;
+
+        byte getCount() const { return static_cast<byte>(nodes.size()); }
+        const UINode& getNode(byte index) const { return nodes[index]; }
+
+        // State changes, these return true when something visible changed
+        bool setSelected(byte index, bool selected);
+        bool setVisible(byte index, bool visible);
+        bool setText(byte index, const char* text);
+        bool setOutline(byte index, UIColour outline);
+
+        // For boards without touch, the option after (or before) current in options, wrapping around. A value that isn't one of
+        // the options starts from the closest one.
+        static int getNextOption(const int* options, byte count, int current, bool up);
+
+    private:
+        // The colour of the visible button under x, y, text over it is drawn on that
+        UIColour getBackground(short x, short y) const;
+
+        struct HitRegion
+        {
+            UIRect rect;
+            byte index;
+        };
+
+        std::vector<UINode> nodes;
+        std::vector<HitRegion> hitRegions;
+
+        short designWidth;
+        short designHeight;
+        short laidOutWidth = 0;
+        short laidOutHeight = 0;
+};
+
+#endif
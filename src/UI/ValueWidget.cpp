@@ -0,0 +1,51 @@
+#include "ValueWidget.h"
+
+bool ValueWidget::update(const std::string& value, DirtyRegion& region)
+{
+    if(valid && value == lastValue)
+        return false;
+
+    lastValue = value;
+    valid = true;
+    region.add(rect);
+
+    return true;
+}
+
+bool ValueWidget::drawCached(const UIBackend& backend) const
+{
+    uint8_t* frame = getCacheFrame(backend);
+    if(frame == nullptr)
+        return false;
+
+    return TileCache::draw(getCacheKey(), rect, frame, backend.frameWidth, backend.bytesPerPixel);
+}
+
+void ValueWidget::storeCached(const UIBackend& backend) const
+{
+    uint8_t* frame = getCacheFrame(backend);
+    if(frame == nullptr)
+        return;
+
+    TileCache::store(getCacheKey(), rect, frame, backend.frameWidth, backend.bytesPerPixel);
+}
+
+uint8_t* ValueWidget::getCacheFrame(const UIBackend& backend) const
+{
+    if(!valid || backend.frameBuffer == nullptr || !TileCache::isStarted())
+        return nullptr;
+
+    if(rect.x < 0 || rect.y < 0 || rect.x + rect.w > backend.frameWidth || rect.y + rect.h > backend.frameHeight)
+        return nullptr;
+
+    return backend.frameBuffer();
+}
+
+TileCache::Key ValueWidget::getCacheKey() const
+{
+    // Tiles the same size can show the same value with different labels (e.g. ISO and shutter), so where it is is part of the key
+    char position[16];
+    snprintf(position, sizeof(position), "%d,%d", rect.x, rect.y);
+
+    return TileCache::makeKey(lastValue.c_str(), position, 0, rect.w, rect.h);
+}
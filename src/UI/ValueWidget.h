@@ -0,0 +1,41 @@
+#ifndef VALUEWIDGET_H
+#define VALUEWIDGET_H
+
+#include <Arduino.h>
+#include <string>
+#include "UI/DirtyRegion.h"
+#include "UI/UIScreen.h"
+#include "UI/TileCache.h"
+
+// A tile on a screen that remembers what it last drew and where.
+// The screen builds a short string of everything the tile shows (value, labels, highlight) and the tile is only redrawn when that changes.
+class ValueWidget
+{
+    public:
+        ValueWidget(short x, short y, short w, short h) : rect(x, y, w, h) {}
+
+        const UIRect& getRect() const { return rect; }
+        bool contains(int x, int y) const { return rect.contains(x, y); }
+
+        // Returns true if the tile needs redrawing and, if so, remembers the value and adds the tile to the region to push
+        bool update(const std::string& value, DirtyRegion& region);
+
+        // Next update redraws regardless of value, e.g. when the whole screen has been cleared
+        void invalidate() { valid = false; }
+
+        // Copies the tile from UI/TileCache if it has been drawn showing this value before, returns false if it has to be drawn
+        bool drawCached(const UIBackend& backend) const;
+
+        // Keeps the tile that has just been drawn in the frame, so the next time it shows this value it's copied in
+        void storeCached(const UIBackend& backend) const;
+
+    private:
+        uint8_t* getCacheFrame(const UIBackend& backend) const;
+        TileCache::Key getCacheKey() const;
+
+        UIRect rect;
+        std::string lastValue;
+        bool valid = false;
+};
+
+#endif
@@ -0,0 +1,152 @@
+#include "WhiteBalanceScreen.h"
+
+// Presets in the order they're shown, Kelvin with their tints
+const int WhiteBalanceScreen::kPresetWB[kPresetCount] = { 5600, 3200, 4000, 4500, 6500 };
+const int WhiteBalanceScreen::kPresetTint[kPresetCount] = { 10, 0, 15, 15, 10 };
+
+// Designed on the 320 x 170 LilyGo screen
+namespace
+{
+    const short kDesignWidth = 320;
+    const short kDesignHeight = 170;
+
+    // Limits of the < > buttons
+    const int kMinWB = 2500;
+    const int kMaxWB = 10000;
+    const int kWBStep = 50;
+    const int kMinTint = -50;
+    const int kMaxTint = 50;
+
+    // Tints the Grey's buttons step through, finer around 0
+    const int kTintOptions[] = { -50, -40, -30, -20, -15, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 15, 20, 30, 40, 50 };
+    const byte kTintOptionCount = sizeof(kTintOptions) / sizeof(kTintOptions[0]);
+
+    // Button values that aren't presets
+    const int kWBDown = 100;
+    const int kWBUp = 101;
+    const int kTintDown = 102;
+    const int kTintUp = 103;
+
+    const byte kTitleIndex = 0;
+    const byte kWBDownIndex = 6;
+    const byte kWBIndex = 7;
+    const byte kWBUpIndex = 8;
+    const byte kTintDownIndex = 10;
+    const byte kTintIndex = 11;
+    const byte kTintUpIndex = 12;
+}
+
+const UIWidgetSpec WhiteBalanceScreen::kWidgets[] =
+{
+    { UIWidgetType::Label,       30,   9, 120, 16, "WHITE BALANCE",  nullptr,  0 },
+
+    // Presets, their values are the index into kPresetWB/kPresetTint
+    { UIWidgetType::IconButton,  20,  30,  70, 40, "WBBright",       nullptr,  0 },
+    { UIWidgetType::IconButton,  95,  30,  70, 40, "WBIncandescent", nullptr,  1 },
+    { UIWidgetType::IconButton, 170,  30,  70, 40, "WBFlourescent",  nullptr,  2 },
+    { UIWidgetType::IconButton, 245,  30,  70, 40, "WBMixedLight",   nullptr,  3 },
+    { UIWidgetType::IconButton,  20,  75,  70, 40, "WBCloud",        nullptr,  4 },
+
+    { UIWidgetType::Button,      95,  75,  60, 40, "<",              nullptr,  kWBDown },
+    { UIWidgetType::Indicator,  160,  75,  90, 40, "",               "KELVIN", 0 },
+    { UIWidgetType::Button,     255,  75,  60, 40, ">",              nullptr,  kWBUp },
+
+    { UIWidgetType::Text,        20, 120,  70, 40, "TINT",           nullptr,  0 },
+    { UIWidgetType::Button,      95, 120,  60, 40, "<",              nullptr,  kTintDown },
+    { UIWidgetType::Indicator,  160, 120,  90, 40, "",               nullptr,  0 },
+    { UIWidgetType::Button,     255, 120,  60, 40, ">",              nullptr,  kTintUp }
+};
+
+UIScreen WhiteBalanceScreen::screen(WhiteBalanceScreen::kWidgets, sizeof(WhiteBalanceScreen::kWidgets) / sizeof(WhiteBalanceScreen::kWidgets[0]), kDesignWidth, kDesignHeight);
+
+bool WhiteBalanceScreen::update(int currentWB, int currentTint, Editing editing)
+{
+    bool changed = false;
+
+    for(byte index = 0; index < screen.getCount(); index++)
+    {
+        const UINode& node = screen.getNode(index);
+        if(node.type != UIWidgetType::IconButton)
+            continue;
+
+        // A preset is only selected when the tint matches too
+        bool selected = currentWB == kPresetWB[node.value] && currentTint == kPresetTint[node.value];
+        changed = screen.setSelected(index, selected) || changed;
+    }
+
+    bool editWB = editing != Editing::Tint;
+    bool editTint = editing != Editing::WhiteBalance;
+
+    changed = screen.setText(kTitleIndex, editing == Editing::Tint ? "TINT" : "WHITE BALANCE") || changed;
+
+    changed = screen.setText(kWBIndex, String(currentWB).c_str()) || changed;
+    changed = screen.setSelected(kWBIndex, editWB) || changed;
+    changed = screen.setVisible(kWBDownIndex, editWB) || changed;
+    changed = screen.setVisible(kWBUpIndex, editWB) || changed;
+
+    changed = screen.setText(kTintIndex, String(currentTint).c_str()) || changed;
+    changed = screen.setSelected(kTintIndex, editTint) || changed;
+    changed = screen.setVisible(kTintDownIndex, editTint) || changed;
+    changed = screen.setVisible(kTintUpIndex, editTint) || changed;
+
+    return changed;
+}
+
+bool WhiteBalanceScreen::hitTest(int x, int y, int currentWB, int currentTint, int& newWB, int& newTint)
+{
+    int index = screen.hitTest(x, y);
+    if(index == -1)
+        return false;
+
+    const UINode& node = screen.getNode(index);
+
+    // Send a preset
+    if(node.type == UIWidgetType::IconButton)
+    {
+        newWB = kPresetWB[node.value];
+        newTint = kPresetTint[node.value];
+        return true;
+    }
+
+    // The < > buttons adjust what the camera has, so need its values
+    if(currentWB == 0)
+        return false;
+
+    newWB = currentWB;
+    newTint = currentTint;
+
+    switch(node.value)
+    {
+        case kWBDown:
+            newWB = currentWB - kWBStep;
+            break;
+        case kWBUp:
+            newWB = currentWB + kWBStep;
+            break;
+        case kTintDown:
+            newTint = currentTint - 1;
+            break;
+        case kTintUp:
+            newTint = currentTint + 1;
+            break;
+    }
+
+    return newWB >= kMinWB && newWB <= kMaxWB && newTint >= kMinTint && newTint <= kMaxTint;
+}
+
+void WhiteBalanceScreen::getNextPreset(int currentWB, int& newWB, int& newTint)
+{
+    // Steps through the presets as they're shown, each has a different Kelvin so that finds its tint
+    newWB = UIScreen::getNextOption(kPresetWB, kPresetCount, currentWB, true);
+
+    for(byte index = 0; index < kPresetCount; index++)
+    {
+        if(kPresetWB[index] == newWB)
+            newTint = kPresetTint[index];
+    }
+}
+
+int WhiteBalanceScreen::getNextTint(int currentTint, bool up)
+{
+    return UIScreen::getNextOption(kTintOptions, kTintOptionCount, currentTint, up);
+}
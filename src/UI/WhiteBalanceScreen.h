@@ -0,0 +1,45 @@
+#ifndef WHITEBALANCESCREEN_H
+#define WHITEBALANCESCREEN_H
+
+#include <Arduino.h>
+#include "UI/UIScreen.h"
+
+// The white balance and tint screen's widgets and behaviour, shared by every board: presets (bright, incandescent, fluorescent,
+// mixed light, cloud), and < > buttons either side of the Kelvin and tint values.
+class WhiteBalanceScreen
+{
+    public:
+        // Boards with buttons edit one of the two at a time, its value is highlighted and only it has < > buttons
+        enum class Editing : byte
+        {
+            Both = 0,
+            WhiteBalance = 1,
+            Tint = 2
+        };
+
+        static const byte kPresetCount = 5;
+
+        static void layout(short width, short height) { screen.layout(width, height); }
+
+        // Shows the camera's white balance and tint, returns true if that changed what's shown
+        static bool update(int currentWB, int currentTint, Editing editing = Editing::Both);
+
+        // The white balance and tint a tap at x, y changes them to, returns false if it isn't on a button or the value is at its limit
+        static bool hitTest(int x, int y, int currentWB, int currentTint, int& newWB, int& newTint);
+
+        // For boards without touch, the preset after the current white balance (wrapping around)
+        static void getNextPreset(int currentWB, int& newWB, int& newTint);
+
+        // For boards without touch, the next tint up or down from the current one (wrapping around)
+        static int getNextTint(int currentTint, bool up);
+
+        static void draw(const UIBackend& backend) { screen.draw(backend); }
+
+    private:
+        static const int kPresetWB[kPresetCount];
+        static const int kPresetTint[kPresetCount];
+        static const UIWidgetSpec kWidgets[];
+        static UIScreen screen;
+};
+
+#endif
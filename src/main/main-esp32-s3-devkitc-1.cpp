@@ -10,9 +10,20 @@
 #include "CCU/CCUPacketTypes.h"
 #include "CCU/CCUValidationFunctions.h"
 #include "Camera/BMDCameraConnection.h"
+#include "Camera/LinkHealthMonitor.h"
 #include "Camera/BMDCamera.h"
 #include "BMDControlSystem.h"
 
+// Camera emulator, generates camera traffic without a camera to measure decode and redraw headroom (no Bluetooth connection is made)
+#define USING_CAMERA_EMULATOR 0   // 1 = Run the emulator load profiles, 0 = Connect to a real camera
+#define CAMERA_EMULATOR_PROFILE_MS 10000 // How long to run each load profile for
+#define CAMERA_EMULATOR_SOAK_CYCLES 5000 // Connect/disconnect cycles to check for heap leaks and fragmentation before the load profiles, 0 = skip
+#define CAMERA_EMULATOR_SOAK_CAMERA nullptr // Address of a bonded camera, e.g. "90:fd:9f:12:34:56", to soak real connections, nullptr = no radio
+
+#if USING_CAMERA_EMULATOR == 1
+    #include "Camera/CameraEmulator.h"
+#endif
+
 BMDCameraConnection cameraConnection;
 std::shared_ptr<BMDControlSystem> BMDControlSystem::instance = nullptr; // Required for Singleton pattern and the constructor for BMDControlSystem
 BMDCameraConnection* BMDCameraConnection::instancePtr = &cameraConnection; // Required for the scan function to run non-blocking and call the object back with the result
@@ -29,8 +40,25 @@ void setup() {
   Debug.setDebugLevel(DBG_VERBOSE);
   Debug.timestampOn();
 
+  #if USING_CAMERA_EMULATOR == 1
+    // A failed soak stops here so it can't be missed among the load profile stats
+    if(CAMERA_EMULATOR_SOAK_CYCLES > 0 && !CameraEmulator::runConnectionSoak(&cameraConnection, CAMERA_EMULATOR_SOAK_CYCLES, CAMERA_EMULATOR_SOAK_CAMERA))
+    {
+      while(true)
+      {
+        DEBUG_ERROR("Connection soak FAILED, see above");
+        delay(5000);
+      }
+    }
+
+    // Run through each of the load profiles, stats are reported to serial at the end of each
+    CameraEmulator::runAllProfiles(CAMERA_EMULATOR_PROFILE_MS);
+    return;
+  #endif
+
   // Prepare for Bluetooth connections and start scanning for cameras
   cameraConnection.initialise(); // Serial pin code entry, not touch screen
+  LinkHealthMonitor::begin(&cameraConnection); // Watches the link once connected
 }
 
 int memoryLoopCounter;
@@ -38,13 +66,24 @@ bool hitRecord = false; // Let's just hit record once.
 
 void loop() {
 
-  static unsigned long lastConnectedTime = 0;
-  const unsigned long reconnectInterval = 5000;  // 5 seconds (milliseconds)
+  #if USING_CAMERA_EMULATOR == 1
+    CameraEmulator::service();
+    delay(5);
+    return;
+  #endif
 
-  unsigned long currentTime = millis();
+  // The camera is waiting for a pass key, it's read from serial without blocking until it's answered
+  if(cameraConnection.servicePassKey())
+  {
+    delay(10);
+    return;
+  }
+
+  LinkHealthMonitor::update();
 
-  if (cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected && currentTime - lastConnectedTime >= reconnectInterval) {
-    DEBUG_VERBOSE("Disconnected for too long, trying to reconnect");
+  // The connection works out when to try again, backing off while no camera is found
+  if (cameraConnection.reconnectDue()) {
+    DEBUG_VERBOSE("Not connected, trying to reconnect");
 
     cameraConnection.scan();
   }
@@ -79,22 +118,17 @@ void loop() {
 
     // WHERE THE ACTION HAPPENS
     // We can do other important things in here, such as call a function to look for the status of the camera, use buttons / keypads to update the camera settings
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningFound)
   {
     DEBUG_DEBUG("Cameras found!");
 
-    cameraConnection.connect(cameraConnection.cameraAddresses[0]);
-
-    lastConnectedTime = currentTime;
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[0]);
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningNoneFound)
   {
     DEBUG_VERBOSE("Status Scanning NONE Found. Marking as Disconnected.");
     cameraConnection.status = BMDCameraConnection::Disconnected;
-    lastConnectedTime = currentTime;
   }
 
   // Keep track of the memory use to check that there aren't memory leaks (or significant memory leaks)
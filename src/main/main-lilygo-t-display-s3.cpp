@@ -3,6 +3,13 @@
 
 #define USING_TFT_ESPI 1  // Using the TFT_eSPI graphics library <-- must include this in every main file, 0 = not using, 1 = using
 #define USING_M5GFX = 0   // Using the M5GFX graphics library <-- must include this in every main file, 0 = not using, 1 = using
+#define USING_DISPLAY_PRESENTER 1 // 1 = Send frames to the display from a background task, 0 = Push them directly
+#define RENDER_TARGET_FPS 30      // Most frames drawn per second, nothing is drawn while the screen is unchanged
+#define INPUT_SAMPLES_PER_SECOND 100 // How often touch and the button are checked
+#define TILE_CACHE_BYTES (96 * 1024) // Memory for pre-drawn buttons, 0 = draw them every time
+#define SCREEN_CACHE_FRAMES 3     // Screens kept drawn in PSRAM (this one and the two a swipe away), 0 = draw them on each swipe
+#define SCREEN_SLIDE_FRAMES 6     // Frames in the slide between two cached screens, 0 = switch straight to the new screen
+#define SCREEN_PRERENDER_MS 250   // Screens a swipe away are redrawn at most this often while the camera is changing
 
 #include <Arduino.h>
 #include <stdint.h>
@@ -10,10 +17,8 @@
 
 #include "Arduino_DebugUtils.h" // Debugging to Serial - https://github.com/arduino-libraries/Arduino_DebugUtils
 
-#include "OneButton.h" // For handling button presses
 #include <esp_sleep.h> // Library to put it to be able to put it into sleep and wake up
 #define SLEEP_BUTTON_PIN 0 // Boot button, used to put it to sleep
-OneButton sleepButton(SLEEP_BUTTON_PIN, true);
 
 #include <TFT_eSPI.h> // Master copy here: https://github.com/Bodmer/TFT_eSPI
 
@@ -30,10 +35,34 @@ OneButton sleepButton(SLEEP_BUTTON_PIN, true);
 #include "CCU/CCUPacketTypes.h"
 #include "CCU/CCUValidationFunctions.h"
 #include "Camera/BMDCameraConnection.h"
+#include "Camera/LinkHealthMonitor.h"
+#include "Camera/LookPresets.h"
+#include "Camera/CommandCoalescer.h"
 #include "Camera/BMDCamera.h"
 #include "BMDControlSystem.h"
 
-// Images
+// UI
+#include "UI/DirtyRegion.h"
+#include "UI/ValueWidget.h"
+#include "UI/RenderStats.h"
+#include "UI/DisplayPresenter.h"
+#include "UI/RenderScheduler.h"
+#include "UI/UIScreen.h"
+#include "UI/ISOScreen.h"
+#include "UI/ShutterAngleScreen.h"
+#include "UI/ShutterSpeedScreen.h"
+#include "UI/WhiteBalanceScreen.h"
+#include "UI/CodecScreen.h"
+#include "UI/ResolutionScreen.h"
+#include "UI/MediaScreen.h"
+#include "UI/TileCache.h"
+#include "UI/ScreenCache.h"
+#include "UI/TouchGestures.h"
+#include "UI/ParameterSlider.h"
+#include "UI/InputQueue.h"
+
+// Images, drawn from the assets partition when it has them (see AssetStore), otherwise from these built in copies
+#include "Images/AssetStore.h"
 #include "Images/MPCSplash.h"
 #include "Images/ImageBluetooth.h"
 #include "Images/ImagePocket4k.h"
@@ -48,7 +77,7 @@ OneButton sleepButton(SLEEP_BUTTON_PIN, true);
 #include "Images/WBIncandescentBG.h"
 #include "Images/WBMixedLightBG.h"
 
-// Include the watchdog library so we can stop it timing out while pass key entry.
+// Include the watchdog library to set its timeout
 #include "esp_task_wdt.h"
 
 // Fonts
@@ -68,20 +97,6 @@ TFT_eSPI tft = TFT_eSPI();  // Invoke library, pins defined in User_Setup.h
 TFT_eSprite window = TFT_eSprite(&tft);
 TFT_eSprite spritePassKey = TFT_eSprite(&tft);
 
-// Images
-TFT_eSprite spriteMPCSplash = TFT_eSprite(&tft);
-TFT_eSprite spriteBluetooth = TFT_eSprite(&tft);
-TFT_eSprite spritePocket4k = TFT_eSprite(&tft);
-TFT_eSprite spriteWBBright = TFT_eSprite(&tft);
-TFT_eSprite spriteWBCloud = TFT_eSprite(&tft);
-TFT_eSprite spriteWBFlourescent = TFT_eSprite(&tft);
-TFT_eSprite spriteWBIncandescent = TFT_eSprite(&tft);
-TFT_eSprite spriteWBMixedLight = TFT_eSprite(&tft);
-TFT_eSprite spriteWBBrightBG = TFT_eSprite(&tft);
-TFT_eSprite spriteWBCloudBG = TFT_eSprite(&tft);
-TFT_eSprite spriteWBFlourescentBG = TFT_eSprite(&tft);
-TFT_eSprite spriteWBIncandescentBG = TFT_eSprite(&tft);
-TFT_eSprite spriteWBMixedLightBG = TFT_eSprite(&tft);
 
 
 #define IWIDTH 320
@@ -102,7 +117,8 @@ enum class Screens : byte
   Media = 108,
   Lens = 109,
   Slate = 110,
-  Project = 111
+  Project = 111,
+  Looks = 112
 };
 
 Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen we're on:
@@ -118,6 +134,7 @@ Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen
 // 107 is Resolution (one for each camera group, 4K, 6K/G2/Pro, Mini Pro G2, Mini Pro 12K)
 // 108 is Media
 // 109 is Lens
+// 112 is Looks
 
 // Keep track of the last camera modified time that we refreshed a screen so we don't keep refreshing a screen when the camera object remains unchanged.
 static unsigned long lastRefreshedScreen = 0;
@@ -125,6 +142,179 @@ static unsigned long lastRefreshedScreen = 0;
 int tapped_x = -1;
 int tapped_y = -1;
 
+// Dragging the Kelvin and tint values sideways changes them, 20K and 0.4 a pixel
+ParameterSlider whiteBalanceSlider(160, 75, 90, 40, 2500, 10000, 50, 20.0f);
+ParameterSlider tintSlider(160, 120, 90, 40, -50, 50, 1, 0.4f);
+bool sliderTouch = false; // The current touch belongs to a slider, the touch controller's own tap and swipe are ignored
+
+// Interrupts queue the sleep button and touch reports (InputQueue) and wake loop()
+enum class Inputs : byte
+{
+  SleepButton = 0,
+  Touch = 1
+};
+
+InputQueue::Event touchInput; // The latest touch report's interrupt, for timing the tap or swipe it ends in
+unsigned long sleepButtonPressed = 0;
+
+void IRAM_ATTR Touch_Interrupt()
+{
+  InputQueue::pushFromISR(static_cast<byte>(Inputs::Touch), InputQueue::Type::Touch);
+}
+
+void Sleep_Now()
+{
+  DEBUG_INFO("Going to Sleep");
+  pinMode(PIN_POWER_ON, OUTPUT);
+  pinMode(PIN_LCD_BL, OUTPUT);
+  digitalWrite(PIN_POWER_ON, LOW);
+  digitalWrite(PIN_LCD_BL, LOW); // Turn screen off
+  esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_BUTTON_2, 0); // 1 = High, 0 = Low
+  esp_deep_sleep_start();
+}
+
+// Display presenter backend. TFT_eSPI has no DMA for the 8 bit parallel bus, so the transfer is synchronous but it runs
+// in the presenter's task on the other core while the loop draws the next frame.
+bool presenterSwapBytes = false;
+
+void Presenter_BeginTransfers()
+{
+  tft.startWrite();
+
+  // Sprite pixels are already byte swapped
+  presenterSwapBytes = tft.getSwapBytes();
+  tft.setSwapBytes(false);
+}
+
+void Presenter_Transfer(short x, short y, short w, short h, const uint16_t* pixels)
+{
+  tft.pushImage(x, y, w, h, pixels);
+}
+
+bool Presenter_Busy()
+{
+  return false;
+}
+
+void Presenter_EndTransfers()
+{
+  tft.setSwapBytes(presenterSwapBytes);
+  tft.endWrite();
+}
+
+// Drawing a screen into the screen cache, it isn't sent to the display
+bool screenPrerendering = false;
+
+// Sends the whole frame to the display
+void Screen_Present()
+{
+  if(screenPrerendering)
+    return;
+
+  if(DisplayPresenter::isStarted())
+    DisplayPresenter::presentFull(window.getPointer());
+  else
+    window.pushSprite(0, 0);
+}
+
+// Draws an image into the window straight from the mapped assets partition, or from the built in copy if it isn't there
+void Screen_DrawImage(const char* assetName, const unsigned short* builtIn, short x, short y, short w, short h)
+{
+  // One that isn't the size the screen is laid out for (e.g. a replaced asset file) isn't used
+  const AssetStore::Asset* asset = AssetStore::find(assetName);
+  if(asset != nullptr && asset->format == AssetStore::Format::RGB565Swapped && asset->width == w && asset->height == h)
+  {
+    // Already in the sprite's byte order, so it's copied as is
+    window.pushImage(x, y, w, h, (uint16_t*)asset->data);
+    return;
+  }
+
+  window.setSwapBytes(true);
+  window.pushImage(x, y, w, h, builtIn);
+  window.setSwapBytes(false);
+}
+
+// Shared UI (UI/UIScreen.h) drawing for this display
+uint32_t UI_Colour(UIColour colour)
+{
+  switch(colour)
+  {
+    case UIColour::Text:
+      return TFT_WHITE;
+    case UIColour::Button:
+      return TFT_DARKGREY;
+    case UIColour::ButtonSelected:
+      return TFT_DARKGREEN;
+    case UIColour::Alert:
+      return TFT_RED;
+    default:
+      return TFT_BLACK;
+  }
+}
+
+void UI_FillRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  window.fillSmoothRoundRect(x, y, w, h, radius, UI_Colour(colour), TFT_TRANSPARENT);
+}
+
+void UI_DrawRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  // A two pixel border inside the button
+  window.drawSmoothRoundRect(x, y, radius + 1, radius - 1, w, h, UI_Colour(colour), TFT_TRANSPARENT);
+}
+
+void UI_DrawText(const char* text, short x, short y, UITextStyle style, UITextAlign align, UIColour background)
+{
+  window.setTextSize(style == UITextStyle::Caption ? 1 : 2);
+  window.textcolor = TFT_WHITE;
+  window.textbgcolor = UI_Colour(background);
+  window.setTextDatum(align == UITextAlign::Centre ? MC_DATUM : TL_DATUM);
+  window.drawString(text, x, y);
+  window.setTextDatum(TL_DATUM);
+}
+
+// Images named by the shared screens' icon buttons, with the version drawn on the selected button colour
+struct UIIcon
+{
+  const char* name;
+  const char* selectedName;
+  const unsigned short* image;
+  const unsigned short* selectedImage;
+};
+
+const UIIcon uiIcons[] =
+{
+  { "WBBright", "WBBrightBG", WBBright, WBBrightBG },
+  { "WBIncandescent", "WBIncandescentBG", WBIncandescent, WBIncandescentBG },
+  { "WBFlourescent", "WBFlourescentBG", WBFlourescent, WBFlourescentBG },
+  { "WBMixedLight", "WBMixedLightBG", WBMixedLight, WBMixedLightBG },
+  { "WBCloud", "WBCloudBG", WBCloud, WBCloudBG }
+};
+
+void UI_DrawIcon(const char* name, short x, short y, bool selected)
+{
+  for(const UIIcon& icon : uiIcons)
+  {
+    if(strcmp(icon.name, name) != 0)
+      continue;
+
+    // Icons are 30 x 30, x and y are the middle
+    if(selected)
+      Screen_DrawImage(icon.selectedName, icon.selectedImage, x - 15, y - 15, 30, 30);
+    else
+      Screen_DrawImage(icon.name, icon.image, x - 15, y - 15, 30, 30);
+
+    return;
+  }
+}
+
+uint8_t* UI_FrameBuffer()
+{
+  return static_cast<uint8_t*>(window.getPointer());
+}
+
+const UIBackend uiBackend = { UI_FillRoundRect, UI_DrawText, UI_DrawRoundRect, UI_DrawIcon, UI_FrameBuffer, IWIDTH, IHEIGHT, 2 };
+
 // Display elements on the screen common to all pages
 void Screen_Common(int sideBarColour)
 {
@@ -133,11 +323,20 @@ void Screen_Common(int sideBarColour)
     window.fillRect(13, 0, 2, IHEIGHT, TFT_DARKGREY);
 }
 
+// Sidebar is grey until we have the camera's details, then shows the health of the link
+int Screen_Common_ConnectedSideBarColour()
+{
+  if(cameraConnection.getInitialPayloadTime() >= millis())
+    return TFT_DARKGREY;
+
+  return LinkHealthMonitor::getSidebarColour(LinkHealthMonitor::getLevel());
+}
+
 void Screen_Common_Connected()
 {
   if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera())
   {
-    Screen_Common(cameraConnection.getInitialPayloadTime() < millis() ? TFT_GREEN : TFT_DARKGREY);
+    Screen_Common(Screen_Common_ConnectedSideBarColour());
 
     // Show the recording outline
     if(BMDControlSystem::getInstance()->getCamera()->isRecording)
@@ -158,13 +357,13 @@ void Screen_NoConnection()
   connectedScreenIndex = Screens::NoConnection;
 
   // window.fillSprite(TFT_BLACK);
-  spriteMPCSplash.pushToSprite(&window, 0, 0);
+  Screen_DrawImage("MPCSplash", MPCSplash, 0, 0, IWIDTH, IHEIGHT);
 
   // Black background for text and Bluetooth Logo
   window.fillRect(0, 3, IWIDTH, 51, TFT_BLACK);
 
   // Bluetooth Image
-  spriteBluetooth.pushToSprite(&window, 26, 6);
+  Screen_DrawImage("ImageBluetooth", Wikipedia_Bluetooth_30x46, 26, 6, 30, 46);
 
   window.setTextSize(2);
   window.textbgcolor = TFT_BLACK;
@@ -224,7 +423,7 @@ void Screen_NoConnection()
     if(connectToCameraIndex != -1 && connectToCameraIndex == count)
       window.drawSmoothRoundRect(25 + (count * 125) + (count * 10), 60, 5, 2, 125, 100, TFT_GREEN, TFT_DARKGREY);
 
-    spritePocket4k.pushToSprite(&window, 33 + (count * 125) + (count * 10), 69);
+    Screen_DrawImage("ImagePocket4k", blackmagic_pocket_4k_110x61, 33 + (count * 125) + (count * 10), 69, 110, 61);
     window.setTextSize(1);
     window.textbgcolor = TFT_DARKGREY;
     window.drawString(cameraConnection.cameraAddresses[count].toString().c_str(), 33 + (count * 125) + (count * 10), 144);
@@ -245,21 +444,72 @@ void Screen_NoConnection()
       }
   }
 
-  window.pushSprite(0, 0);
+  Screen_Present();
 
   if(connectToCameraIndex != -1)
   {
-    cameraConnection.connect(cameraConnection.cameraAddresses[connectToCameraIndex]);
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[connectToCameraIndex]);
     connectToCameraIndex = -1;
   }
 }
 
+// Moves to a screen, it's drawn on the next frame tick
+void Screen_Show(Screens screen)
+{
+  connectedScreenIndex = screen;
+  lastRefreshedScreen = 0; // Forces a refresh
+  RenderScheduler::invalidate();
+}
+
+// Pushes only the changed areas of the window to the display
+void Screen_PushRegion(const DirtyRegion& region)
+{
+  if(screenPrerendering)
+    return;
+
+  if(DisplayPresenter::isStarted())
+    DisplayPresenter::present(window.getPointer(), region);
+  else if(region.isFull())
+    window.pushSprite(0, 0);
+  else
+  {
+    for(byte index = 0; index < region.getCount(); index++)
+    {
+      const UIRect& rect = region.getRect(index);
+      window.pushSprite(rect.x, rect.y, rect.x, rect.y, rect.w, rect.h);
+    }
+  }
+}
+
+// Dashboard tiles, each is only redrawn and pushed to the display when what it shows changes. One showing what it has shown before
+// is copied from UI/TileCache rather than drawn (the render stats change too often to be worth keeping).
+DirtyRegion dashboardRegion(IWIDTH, IHEIGHT);
+ValueWidget dashboardISO(20, 5, 75, 65);
+ValueWidget dashboardShutter(100, 5, 75, 65);
+ValueWidget dashboardWBTint(180, 5, 135, 65);
+ValueWidget dashboardCodec(20, 75, 155, 40);
+ValueWidget dashboardFramerate(180, 75, 135, 40);
+ValueWidget dashboardMedia(20, 120, 100, 40);
+ValueWidget dashboardResolution(125, 120, 190, 40);
+ValueWidget dashboardRenderStats(20, 160, 295, 8);
+ValueWidget* dashboardWidgets[] = { &dashboardISO, &dashboardShutter, &dashboardWBTint, &dashboardCodec, &dashboardFramerate, &dashboardMedia, &dashboardResolution, &dashboardRenderStats };
+std::string dashboardFrameValue; // Sidebar colour and recording outline
+
+void Screen_Dashboard_ClearTile(const ValueWidget& widget)
+{
+  const UIRect& rect = widget.getRect();
+  window.fillRect(rect.x, rect.y, rect.w, rect.h, TFT_BLACK);
+}
+
 // Default screen for connected state
 void Screen_Dashboard(bool forceRefresh = false)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
 
+  // Another screen has drawn over the dashboard (screen changes reset lastRefreshedScreen)
+  bool fromOtherScreen = connectedScreenIndex != Screens::Dashboard || lastRefreshedScreen == 0;
+
   connectedScreenIndex = Screens::Dashboard;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
@@ -329,88 +579,142 @@ void Screen_Dashboard(bool forceRefresh = false)
   
   DEBUG_DEBUG("Screen Dashboard Refreshed.");
 
-  window.fillSprite(TFT_BLACK);
+  // Redraw everything when coming from another screen or when the sidebar or recording outline changes, otherwise only the tiles that changed
+  std::string frameValue = std::to_string(Screen_Common_ConnectedSideBarColour()) + (camera->isRecording ? "R" : "");
+  bool fullRedraw = forceRefresh || fromOtherScreen || frameValue != dashboardFrameValue;
 
-  Screen_Common_Connected(); // Common elements
+  RenderStats::beginFrame();
+  dashboardRegion.clear();
+
+  if(fullRedraw)
+  {
+    window.fillSprite(TFT_BLACK);
+
+    Screen_Common_Connected(); // Common elements
+
+    for(auto widget : dashboardWidgets)
+      widget->invalidate();
+
+    dashboardRegion.markFull();
+    dashboardFrameValue = frameValue;
+  }
+
+  window.textcolor = TFT_WHITE;
+  window.textbgcolor = TFT_DARKGREY;
 
   // ISO
-  if(camera->hasSensorGainISOValue())
+  std::string isoValue = camera->hasSensorGainISOValue() ? std::to_string(camera->getSensorGainISOValue()) : "";
+  if(dashboardISO.update(isoValue, dashboardRegion) && !dashboardISO.drawCached(uiBackend))
   {
-    window.fillSmoothRoundRect(20, 5, 75, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_DARKGREY;
+    Screen_Dashboard_ClearTile(dashboardISO);
 
-    window.drawCentreString(String(camera->getSensorGainISOValue()), 58, 28, tft.textfont);
+    if(!isoValue.empty())
+    {
+      window.fillSmoothRoundRect(20, 5, 75, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+      window.setTextSize(2);
 
-    window.setTextSize(1);
-    window.drawCentreString("ISO", 58, 59, tft.textfont);
+      window.drawCentreString(isoValue.c_str(), 58, 28, tft.textfont);
+
+      window.setTextSize(1);
+      window.drawCentreString("ISO", 58, 59, tft.textfont);
+    }
+
+    dashboardISO.storeCached(uiBackend);
   }
 
   // Shutter
   xshift = 80;
+  String shutterValue;
   if(camera->hasShutterAngle())
   {
-    window.fillSmoothRoundRect(20 + xshift, 5, 75, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_DARKGREY;
-
     if(camera->shutterValueIsAngle)
     {
       // Shutter Angle
       int currentShutterAngle = camera->getShutterAngle();
       float ShutterAngleFloat = currentShutterAngle / 100.0;
 
-      window.drawCentreString(String(ShutterAngleFloat, (currentShutterAngle % 100 == 0 ? 0 : 1)), 58 + xshift, 28, tft.textfont);
+      shutterValue = String(ShutterAngleFloat, (currentShutterAngle % 100 == 0 ? 0 : 1));
     }
     else
     {
       // Shutter Speed
       int currentShutterSpeed = camera->getShutterSpeed();
 
-      window.drawCentreString("1/" + String(currentShutterSpeed), 58 + xshift, 28, tft.textfont);
+      shutterValue = "1/" + String(currentShutterSpeed);
     }
+  }
 
-    window.setTextSize(1);
-    window.drawCentreString(camera->shutterValueIsAngle ? "DEGREES" : "SPEED", 58 + xshift, 59, tft.textfont); //  "SHUTTER"
+  if(dashboardShutter.update(shutterValue.c_str(), dashboardRegion) && !dashboardShutter.drawCached(uiBackend))
+  {
+    Screen_Dashboard_ClearTile(dashboardShutter);
+
+    if(camera->hasShutterAngle())
+    {
+      window.fillSmoothRoundRect(20 + xshift, 5, 75, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+      window.setTextSize(2);
+
+      window.drawCentreString(shutterValue, 58 + xshift, 28, tft.textfont);
+
+      window.setTextSize(1);
+      window.drawCentreString(camera->shutterValueIsAngle ? "DEGREES" : "SPEED", 58 + xshift, 59, tft.textfont); //  "SHUTTER"
+    }
+
+    dashboardShutter.storeCached(uiBackend);
   }
 
   // WhiteBalance and Tint
   xshift += 80;
+  std::string wbTintValue;
   if(camera->hasWhiteBalance() || camera->hasTint())
+    wbTintValue = (camera->hasWhiteBalance() ? std::to_string(camera->getWhiteBalance()) : "-") + "/" + (camera->hasTint() ? std::to_string(camera->getTint()) : "-");
+
+  if(dashboardWBTint.update(wbTintValue, dashboardRegion) && !dashboardWBTint.drawCached(uiBackend))
   {
-    window.fillSmoothRoundRect(20 + xshift, 5, 135, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_DARKGREY;
+    Screen_Dashboard_ClearTile(dashboardWBTint);
 
-    if(camera->hasWhiteBalance())
-      window.drawCentreString(String(camera->getWhiteBalance()), 58 + xshift, 28, tft.textfont);
+    if(!wbTintValue.empty())
+    {
+      window.fillSmoothRoundRect(20 + xshift, 5, 135, 65, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+      window.setTextSize(2);
 
-    window.setTextSize(1);
-    window.drawCentreString("WB", 58 + xshift, 59, tft.textfont);
+      if(camera->hasWhiteBalance())
+        window.drawCentreString(String(camera->getWhiteBalance()), 58 + xshift, 28, tft.textfont);
 
-    xshift += 66;
+      window.setTextSize(1);
+      window.drawCentreString("WB", 58 + xshift, 59, tft.textfont);
 
-    window.setTextSize(2);
-    if(camera->hasTint())
-      window.drawCentreString(String(camera->getTint()), 58 + xshift, 28, tft.textfont);
+      xshift += 66;
 
-    window.setTextSize(1);
-    window.drawCentreString("TINT", 58 + xshift, 59, tft.textfont);
+      window.setTextSize(2);
+      if(camera->hasTint())
+        window.drawCentreString(String(camera->getTint()), 58 + xshift, 28, tft.textfont);
+
+      window.setTextSize(1);
+      window.drawCentreString("TINT", 58 + xshift, 59, tft.textfont);
+    }
+
+    dashboardWBTint.storeCached(uiBackend);
   }
 
   // Codec
-  if(camera->hasCodec())
+  std::string codecValue = camera->hasCodec() ? camera->getCodec().to_string() : "";
+  if(dashboardCodec.update(codecValue, dashboardRegion) && !dashboardCodec.drawCached(uiBackend))
   {
-    window.fillSmoothRoundRect(20, 75, 155, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+    Screen_Dashboard_ClearTile(dashboardCodec);
 
-    window.setTextSize(2);
-    window.drawCentreString(camera->getCodec().to_string().c_str(), 97, 87, tft.textfont);
+    if(camera->hasCodec())
+    {
+      window.fillSmoothRoundRect(20, 75, 155, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+
+      window.setTextSize(2);
+      window.drawCentreString(codecValue.c_str(), 97, 87, tft.textfont);
+    }
+
+    dashboardCodec.storeCached(uiBackend);
   }
 
   // Media
+  std::string mediaValue;
   if(camera->getMediaSlots().size() != 0)
   {
     std::string slotString;
@@ -440,47 +744,94 @@ void Screen_Dashboard(bool forceRefresh = false)
       }
     }
 
-    if(!slotString.empty())
+    // Recording error is part of the value as it changes the tile's outline
+    mediaValue = slotString.empty() ? "NO MEDIA" : slotString + (camera->hasRecordError() ? "!" : "");
+  }
+
+  if(dashboardMedia.update(mediaValue, dashboardRegion) && !dashboardMedia.drawCached(uiBackend))
+  {
+    Screen_Dashboard_ClearTile(dashboardMedia);
+
+    if(!mediaValue.empty())
     {
       window.fillSmoothRoundRect(20, 120, 100, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
 
-      window.setTextSize(2);
-      window.drawCentreString(slotString.c_str(), 70, 133, tft.textfont);
+      if(mediaValue != "NO MEDIA")
+      {
+        window.setTextSize(2);
+        window.drawCentreString(mediaValue.substr(0, mediaValue.find('!')).c_str(), 70, 133, tft.textfont);
 
-      // Show recording error
-      if(camera->hasRecordError())
-        window.drawSmoothRoundRect(20, 120, 3, 5, 100, 40, TFT_RED, TFT_DARKGREY);
+        // Show recording error
+        if(camera->hasRecordError())
+          window.drawSmoothRoundRect(20, 120, 3, 5, 100, 40, TFT_RED, TFT_DARKGREY);
+      }
+      else
+      {
+        // Show no Media
+        window.setTextSize(1);
+        window.drawCentreString("NO MEDIA", 70, 135, tft.textfont);
+      }
     }
-    else
+
+    dashboardMedia.storeCached(uiBackend);
+  }
+
+  // Recording Format - Frame Rate and Resolution
+  std::string framerateValue = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "";
+  if(dashboardFramerate.update(framerateValue, dashboardRegion) && !dashboardFramerate.drawCached(uiBackend))
+  {
+    Screen_Dashboard_ClearTile(dashboardFramerate);
+
+    if(camera->hasRecordingFormat())
     {
-      // Show no Media
-      window.fillSmoothRoundRect(20, 120, 100, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+      // Frame Rate
+      window.fillSmoothRoundRect(180, 75, 135, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+      window.setTextSize(2);
+
+      window.drawCentreString(framerateValue.c_str(), 237, 87, tft.textfont);
+
       window.setTextSize(1);
-      window.drawCentreString("NO MEDIA", 70, 135, tft.textfont);
+      window.drawCentreString("fps", 285, 97, tft.textfont);
     }
+
+    dashboardFramerate.storeCached(uiBackend);
   }
 
-  // Recording Format - Frame Rate and Resolution
-  if(camera->hasRecordingFormat())
+  std::string resolutionValue = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameDimensionsShort_string() : "";
+  if(dashboardResolution.update(resolutionValue, dashboardRegion) && !dashboardResolution.drawCached(uiBackend))
   {
-    // Frame Rate
-    window.fillSmoothRoundRect(180, 75, 135, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-    window.setTextSize(2);
+    Screen_Dashboard_ClearTile(dashboardResolution);
+
+    if(camera->hasRecordingFormat())
+    {
+      // Resolution
+      window.fillSmoothRoundRect(125, 120, 190, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
 
-    window.drawCentreString(camera->getRecordingFormat().frameRate_string().c_str(), 237, 87, tft.textfont);
+      window.setTextSize(2);
+      window.drawCentreString(resolutionValue.c_str(), 220, 133, tft.textfont);
+    }
 
-    window.setTextSize(1);
-    window.drawCentreString("fps", 285, 97, tft.textfont);
+    dashboardResolution.storeCached(uiBackend);
+  }
 
-    // Resolution
-    window.fillSmoothRoundRect(125, 120, 190, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
+  // While recording, compare drawing and pushing only the changed tiles against full frames
+  std::string renderStatsValue = camera->isRecording ? RenderStats::getSummary().c_str() : "";
+  if(dashboardRenderStats.update(renderStatsValue, dashboardRegion))
+  {
+    Screen_Dashboard_ClearTile(dashboardRenderStats);
 
-    std::string resolution = camera->getRecordingFormat().frameDimensionsShort_string();
-    window.setTextSize(2);
-    window.drawCentreString(resolution.c_str(), 220, 133, tft.textfont);
+    window.setTextSize(1);
+    window.textcolor = TFT_LIGHTGREY;
+    window.textbgcolor = TFT_BLACK;
+    window.drawString(renderStatsValue.c_str(), 20, 160);
   }
 
-  window.pushSprite(0, 0);
+  if(dashboardRegion.isEmpty())
+    return;
+
+  Screen_PushRegion(dashboardRegion);
+
+  RenderStats::endFrame(dashboardRegion.getPushBytes(), dashboardRegion.isFull());
 }
 
 void Screen_Recording(bool forceRefresh = false)
@@ -644,7 +995,7 @@ void Screen_Recording(bool forceRefresh = false)
     }
   }
 
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_ISO(bool forceRefresh = false)
@@ -656,50 +1007,19 @@ void Screen_ISO(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // ISO Values, 200 / 400 / 1250 / 3200 / 8000
-
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    // Serial.print("Screen_Recording tapped at: ");
-    // Serial.print(tapped_x);
-    // Serial.print(",");
-    // Serial.println(tapped_y);
+    int newISO = ISOScreen::hitTest(tapped_x, tapped_y);
 
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
+    if(newISO != 0)
     {
-      // Tapped within the area
-      int newISO = 0;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newISO = 200;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newISO = 400;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newISO = 8000;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newISO = 640;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newISO = 800;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newISO = 12800;
-
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newISO = 1250;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newISO = 3200;
-
-      if(newISO != 0)
-      {
-        // ISO selected, send it to the camera
-        PacketWriter::writeISO(newISO, &cameraConnection);
+      // ISO selected, send it to the camera
+      PacketWriter::writeISO(newISO, &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
-
   }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -707,7 +1027,7 @@ void Screen_ISO(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
+
   DEBUG_DEBUG("Screen ISO Refreshed.");
 
   window.fillSprite(TFT_BLACK);
@@ -719,84 +1039,11 @@ void Screen_ISO(bool forceRefresh = false)
   if(camera->hasSensorGainISOValue())
     currentISO = camera->getSensorGainISOValue();
 
-  // ISO label
-  window.setTextSize(2);
-  window.textcolor = TFT_WHITE;
-  window.textbgcolor = TFT_BLACK;
-  window.drawString("ISO", 30, 9);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // 200
-  int labelISO = 200;
-  window.setTextSize(2);
-  window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 65, 41, tft.textfont);
-
-  // 400
-  labelISO = 400;
-  window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 160, 36, tft.textfont);
-  window.setTextSize(1);
-  window.drawCentreString("NATIVE", 160, 59, tft.textfont);
-  window.setTextSize(2);
-
-  // 8000
-  labelISO = 8000;
-  window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 260, 41, tft.textfont);
-
-  // 640
-  labelISO = 640;
-  window.fillSmoothRoundRect(20, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 65, 87, tft.textfont);
-
-  // 800
-  labelISO = 800;
-  window.fillSmoothRoundRect(115, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 160, 87, tft.textfont);
-
-  // 12800
-  labelISO = 12800;
-  window.fillSmoothRoundRect(210, 75, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 260, 87, tft.textfont);
-
-  // 1250
-  labelISO = 1250;
-  window.fillSmoothRoundRect(20, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 65, 131, tft.textfont);
-
-  // 3200
-  labelISO = 3200;
-  window.fillSmoothRoundRect(115, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentISO == labelISO) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelISO).c_str(), 160, 126, tft.textfont);
-  window.setTextSize(1);
-  window.drawCentreString("NATIVE", 160, 149, tft.textfont);
-  window.setTextSize(2);
+  // Buttons, labels and layout are shared (UI/ISOScreen), only the drawing is this display's
+  ISOScreen::update(currentISO);
+  ISOScreen::draw(uiBackend);
 
-  // Custom ISO - show if ISO is not one of the above values
-  if(currentISO != 0)
-  {
-    // Only show the ISO value if it's not a standard one
-    if(currentISO != 200 && currentISO != 400 && currentISO != 640 && currentISO != 800 && currentISO != 1250 && currentISO != 3200 && currentISO != 8000 && currentISO != 12800)
-    {
-      window.fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString(String(currentISO).c_str(), 260, 126, tft.textfont);
-      window.setTextSize(1);
-      window.drawCentreString("CUSTOM", 260, 149, tft.textfont);
-    }
-  }
-
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_ShutterAngle(bool forceRefresh = false)
@@ -808,44 +1055,20 @@ void Screen_ShutterAngle(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Shutter Angle Values: 15, 60, 90, 120, 150, 180, 270, 360, CUSTOM
   // Note that the protocol takes shutter angle times 100, so 180 = 180 x 100 = 18000. This is so it can accommodate decimal places, like 172.8 degrees = 17280 for the protocol.
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
+    int newShutterAngle = ShutterAngleScreen::hitTest(tapped_x, tapped_y);
+
+    if(newShutterAngle != 0)
     {
-      // Tapped within the area
-      int newShutterAngle = 0;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newShutterAngle = 1500;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newShutterAngle = 6000;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newShutterAngle = 9000;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newShutterAngle = 12000;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newShutterAngle = 15000;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newShutterAngle = 18000;
-
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newShutterAngle = 27000;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newShutterAngle = 36000;
-
-      if(newShutterAngle != 0)
-      {
-        // Shutter Angle selected, send it to the camera
-        PacketWriter::writeShutterAngle(newShutterAngle, &cameraConnection);
+      // Shutter Angle selected, send it to the camera
+      PacketWriter::writeShutterAngle(newShutterAngle, &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -854,7 +1077,7 @@ void Screen_ShutterAngle(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
+
   DEBUG_DEBUG("Screen Shutter Angle Refreshed.");
 
   window.fillSprite(TFT_BLACK);
@@ -866,82 +1089,11 @@ void Screen_ShutterAngle(bool forceRefresh = false)
   if(camera->hasShutterAngle())
     currentShutterAngle = camera->getShutterAngle();
 
-  // Shutter Angle label
-  window.textcolor = TFT_WHITE;
-  window.textbgcolor = TFT_BLACK;
-  window.setTextSize(1);
-  window.drawString("DEGREES", 265, 9);
-  window.setTextSize(2);
-  window.drawString("SHUTTER ANGLE", 30, 9);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // 15
-  int labelShutterAngle = 1500;
-  window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 41, tft.textfont);
-
-  // 60
-  labelShutterAngle = 6000;
-  window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 41, tft.textfont);
-
-  // 90
-  labelShutterAngle = 9000;
-  window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 41, tft.textfont);
-
-  // 120
-  labelShutterAngle = 12000;
-  window.fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 87, tft.textfont);
-
-  // 150
-  labelShutterAngle = 15000;
-  window.fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 87, tft.textfont);
-
-  // 180 (with a border around it)
-  labelShutterAngle = 18000;
-  window.fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  window.drawSmoothRoundRect(210, 75, 3, 5, 100, 40, TFT_WHITE, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 87, tft.textfont);
-
-  // 270
-  labelShutterAngle = 27000;
-  window.fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 131, tft.textfont);
-
-  // 360
-  labelShutterAngle = 36000;
-  window.fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterAngle == labelShutterAngle) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 131, tft.textfont);
-
-  // Custom Shutter Angle - show if not one of the above values
-  if(currentShutterAngle != 0)
-  {
-    // Only show the Shutter angle value if it's not a standard one
-    if(currentShutterAngle != 1500 && currentShutterAngle != 6000 && currentShutterAngle != 9000 && currentShutterAngle != 12000 && currentShutterAngle != 15000 && currentShutterAngle != 18000 && currentShutterAngle != 27000 && currentShutterAngle != 36000)
-    {
-      float customShutterAngle = currentShutterAngle / 100.0;
-
-      window.fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString(String(customShutterAngle, (currentShutterAngle % 100 == 0 ? 0 : 1)).c_str(), 260, 126, tft.textfont);
-      window.setTextSize(1);
-      window.drawCentreString("CUSTOM", 260, 149, tft.textfont);
-    }
-  }
+  // Buttons, labels and layout are shared (UI/ShutterAngleScreen), only the drawing is this display's
+  ShutterAngleScreen::update(currentShutterAngle);
+  ShutterAngleScreen::draw(uiBackend);
 
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_ShutterSpeed(bool forceRefresh = false)
@@ -953,44 +1105,20 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Shutter Speed Values: 1/30, 1/50, 1/60, 1/125, 1/200, 1/250, 1/500, 1/2000, CUSTOM
   // Note that the protocol takes the denominator as its parameter value. So for 1/60 we'll pass 60.
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
+    int newShutterSpeed = ShutterSpeedScreen::hitTest(tapped_x, tapped_y);
+
+    if(newShutterSpeed != 0)
     {
-      // Tapped within the area
-      int newShutterSpeed = 0;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newShutterSpeed = 30;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newShutterSpeed = 50;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newShutterSpeed = 60;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newShutterSpeed = 125;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newShutterSpeed = 200;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newShutterSpeed = 250;
-
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newShutterSpeed = 500;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newShutterSpeed = 2000;
-
-      if(newShutterSpeed != 0)
-      {
-        // Shutter Speed selected, send it to the camera
-        PacketWriter::writeShutterSpeed(newShutterSpeed, &cameraConnection);
+      // Shutter Speed selected, send it to the camera
+      PacketWriter::writeShutterSpeed(newShutterSpeed, &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -999,9 +1127,8 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Shutter Speed Refreshed.");
 
+  DEBUG_DEBUG("Screen Shutter Speed Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
@@ -1011,87 +1138,15 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
   int currentShutterSpeed = 0;
   if(camera->hasShutterSpeed())
     currentShutterSpeed = camera->getShutterSpeed();
-  else
-    DEBUG_DEBUG("DO NOT HAVE SHUTTER SPEED!");
 
-  // Shutter Speed label
-  window.textcolor = TFT_WHITE;
-  window.textbgcolor = TFT_BLACK;
+  // Frame rate shown alongside, as the shutter speed is relative to it
+  std::string frameRate = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "";
 
-  if(camera->hasRecordingFormat())
-  {
-    window.setTextSize(1);
-    window.drawRightString(camera->getRecordingFormat().frameRate_string().c_str() + String(" fps"), 310, 9, tft.textfont);
-  }
+  // Buttons, labels and layout are shared (UI/ShutterSpeedScreen), only the drawing is this display's
+  ShutterSpeedScreen::update(currentShutterSpeed, camera->hasRecordingFormat() ? frameRate.c_str() : nullptr);
+  ShutterSpeedScreen::draw(uiBackend);
 
-  window.setTextSize(2);
-  window.drawString("SHUTTER SPEED", 30, 9);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // 1/30
-  int labelShutterSpeed = 30;
-  window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 65, 41, tft.textfont);
-
-  // 1/50
-  labelShutterSpeed = 50;
-  window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 160, 41, tft.textfont);
-
-  // 1/60
-  labelShutterSpeed = 60;
-  window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 260, 41, tft.textfont);
-
-  // 1/125
-  labelShutterSpeed = 125;
-  window.fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 65, 87, tft.textfont);
-
-  // 1/200
-  labelShutterSpeed = 200;
-  window.fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 160, 87, tft.textfont);
-
-  // 1/250
-  labelShutterSpeed = 250;
-  window.fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 260, 87, tft.textfont);
-
-  // 1/500
-  labelShutterSpeed = 500;
-  window.fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 65, 131, tft.textfont);
-
-  // 1/2000
-  labelShutterSpeed = 2000;
-  window.fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentShutterSpeed == labelShutterSpeed) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("1/" + String(labelShutterSpeed), 160, 131, tft.textfont);
-
-  // Custom Shutter Speed - show if not one of the above values
-  if(currentShutterSpeed != 0)
-  {
-    // Only show the Shutter Speed value if it's not a standard one
-    if(currentShutterSpeed != 30 && currentShutterSpeed != 50 && currentShutterSpeed != 60 && currentShutterSpeed != 125 && currentShutterSpeed != 200 && currentShutterSpeed != 250 && currentShutterSpeed != 500 && currentShutterSpeed != 2000)
-    {
-      window.fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString("1/" + String(currentShutterSpeed), 260, 126, tft.textfont);
-      window.setTextSize(1);
-      window.drawCentreString("CUSTOM", 260, 149, tft.textfont);
-    }
-  }
-
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_WBTint(bool forceRefresh = false)
@@ -1116,90 +1171,25 @@ void Screen_WBTint(bool forceRefresh = false)
   if(camera->hasTint())
     currentTint = camera->getTint();
 
+  // Being dragged, show where the finger has it rather than waiting for the camera
+  if(whiteBalanceSlider.isActive())
+    currentWB = whiteBalanceSlider.getValue();
+  if(tintSlider.isActive())
+    currentTint = tintSlider.getValue();
+
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      int newWB = 0;
-      int newTint = 0;
+    int newWB = 0;
+    int newTint = 0;
 
-      // Check Preset Clicks
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 90 && tapped_y <= 70)
-      {
-        // Bright
-        newWB = 5600;
-        newTint = 10;
-      }
-      else if(tapped_x >= 95 && tapped_y >= 30 && tapped_x <= 165 && tapped_y <= 70)
-      {
-        // Incandescent
-        newWB = 3200;
-        newTint = 0;
-      }
-      else if(tapped_x >= 170 && tapped_y >= 30 && tapped_x <= 240 && tapped_y <= 70)
-      {
-        // Fluorescent
-        newWB = 4000;
-        newTint = 15;
-      }
-      else if(tapped_x >= 245 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // Mixed Light
-        newWB = 4500;
-        newTint = 15;
-      }
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 90 && tapped_y <= 115)
-      {
-        // Cloud
-        newWB = 6500;
-        newTint = 10;
-      }
-
-      // Preset clicked
-      if(newWB != 0)
-      {
-        // Send preset to camera
-        PacketWriter::writeWhiteBalance(newWB, newTint, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else
-      {
-        // Not a preset
-
-        // WB Left
-        if(currentWB != 0 && currentWB >= 2550 && tapped_x >= 95 && tapped_y >= 75 && tapped_x <= 155 && tapped_y <= 115)
-        {
-          // Adjust down by 50
-          PacketWriter::writeWhiteBalance(currentWB - 50, currentTint, &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentWB <= 9950 && tapped_x >= 255 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // Adjust up by 50
-          PacketWriter::writeWhiteBalance(currentWB + 50, currentTint, &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentTint > -50 && tapped_x >= 95 && tapped_y >= 120 && tapped_x <= 155 && tapped_y <= 160)
-        {
-          // Adjust down by 1
-          PacketWriter::writeWhiteBalance(currentWB, currentTint - 1, &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentWB <= 9950 && tapped_x >= 255 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-        {
-          // Adjust up by 1
-          PacketWriter::writeWhiteBalance(currentWB, currentTint + 1, &cameraConnection);
+    // A preset, or < > on the Kelvin or tint
+    if(WhiteBalanceScreen::hitTest(tapped_x, tapped_y, currentWB, currentTint, newWB, newTint))
+    {
+      PacketWriter::writeWhiteBalance(newWB, newTint, &cameraConnection);
 
-          tappedAction = true;
-        }
-      }
+      tappedAction = true;
     }
   }
 
@@ -1208,101 +1198,18 @@ void Screen_WBTint(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
+
   DEBUG_DEBUG("Screen WB Tint Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  // ISO label
-  window.setTextSize(2);
-  window.textcolor = TFT_WHITE;
-  window.textbgcolor = TFT_BLACK;
-  window.drawString("WHITE BALANCE", 30, 9);
-  window.drawCentreString("TINT", 54, 132, tft.textfont);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // Bright, 5600K
-  int lblWBKelvin = 5600;
-  int lblTint = 10;
-  window.fillSmoothRoundRect(20, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    spriteWBBrightBG.pushToSprite(&window, 40, 35);
-  else
-    spriteWBBright.pushToSprite(&window, 40, 35);
-
-  // Incandescent, 3200K
-  lblWBKelvin = 3200;
-  lblTint = 0;
-  window.fillSmoothRoundRect(95, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    spriteWBIncandescentBG.pushToSprite(&window, 115, 35);
-  else
-    spriteWBIncandescent.pushToSprite(&window, 115, 35);
-
-  // Fluorescent, 4000K
-  lblWBKelvin = 4000;
-  lblTint = 15;
-  window.fillSmoothRoundRect(170, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    spriteWBFlourescentBG.pushToSprite(&window, 190, 35);
-  else
-    spriteWBFlourescent.pushToSprite(&window, 190, 35);
-
-  // Mixed Light, 4500K
-  lblWBKelvin = 4500;
-  lblTint = 15;
-  window.fillSmoothRoundRect(245, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    spriteWBMixedLightBG.pushToSprite(&window, 265, 35);
-  else
-    spriteWBMixedLight.pushToSprite(&window, 265, 35);
-
-  // Cloud, 6500K
-  lblWBKelvin = 6500;
-  lblTint = 10;
-  window.fillSmoothRoundRect(20, 75, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    spriteWBCloudBG.pushToSprite(&window, 40, 80);
-  else
-    spriteWBCloud.pushToSprite(&window, 40, 80);
-
-  // WB Adjust Left <
-  window.fillSmoothRoundRect(95, 75, 60, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-  window.drawCentreString("<", 125, 87, tft.textfont);
-
-  // Current White Balance Kelvin
-  window.fillSmoothRoundRect(160, 75, 90, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-  window.textbgcolor = TFT_DARKGREEN;
-  window.drawCentreString(String(currentWB), 205, 82, tft.textfont);
-  window.setTextSize(1);
-  window.drawCentreString("KELVIN", 205, 104, tft.textfont);
-  window.setTextSize(2);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // WB Adjust Right >
-  window.fillSmoothRoundRect(255, 75, 60, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-  window.drawCentreString(">", 284, 87, tft.textfont);
-
-  // Tint Adjust Left <
-  window.fillSmoothRoundRect(95, 120, 60, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-  window.drawCentreString("<", 125, 132, tft.textfont);
-
-  // Current Tint
-  window.fillSmoothRoundRect(160, 120, 90, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-  window.textbgcolor = TFT_DARKGREEN;
-  window.drawCentreString(String(currentTint), 205, 132, tft.textfont);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // Tint Adjust Right >
-  window.fillSmoothRoundRect(255, 120, 60, 40, 3, TFT_DARKGREY, TFT_TRANSPARENT);
-  window.drawCentreString(">", 284, 132, tft.textfont);
+  // Buttons, labels and layout are shared (UI/WhiteBalanceScreen), only the drawing is this display's
+  WhiteBalanceScreen::update(currentWB, currentTint);
+  WhiteBalanceScreen::draw(uiBackend);
 
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Codec Screen for Pocket 4K and 6K + Variants
@@ -1315,137 +1222,21 @@ void Screen_Codec4K6K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
   // Codec: BRAW and ProRes
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1 && camera->hasCodec())
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Switching between BRAW and ProRes
-      if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::BRAW && tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 165 && tapped_y <= 70)
-      {
-        // Switch to BRAW (using the last known setting)
-        DEBUG_DEBUG("Changing to last unknown BRAW");
-        DEBUG_DEBUG("Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023");
-
-        PacketWriter::writeCodec(camera->lastKnownBRAWIsBitrate ? camera->lastKnownBRAWBitrate : camera->lastKnownBRAWQuality, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::ProRes && tapped_x >= 170 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // Switch to ProRes (using the last known setting)
-        DEBUG_DEBUG("Changing to last unknown ProRes");
-        DEBUG_DEBUG("Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023");
+    CodecInfo newCodec = camera->getCodec();
 
-        PacketWriter::writeCodec(camera->lastKnownProRes, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-        // BRAW
-
-        // Are we Constant Bitrate or Constant Quality
-        std::string currentCodecString = currentCodec.to_string();
-        auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-        bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-        // Constant Bitrate and Constant Quality
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 165 && tapped_y <= 115)
-        {
-          // Change to Constant Bitrate if we're not already on Constant Bitrate. If it is we do nothing
-          if(!isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWBitrate, &cameraConnection);
-
-            tappedAction = true;
-          }
-        } 
-        else if(tapped_x >= 170 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // Change to Constant Quality if we're not already on Constant Quality. If it is we do nothing
-          if(isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWQuality, &cameraConnection);
-
-            tappedAction = true;
-          }
-        } 
-        else
-        {
-          // Setting
-
-          if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 90 && tapped_y <= 160)
-          {
-            // 3:1 / Q0
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW3_1 : CCUPacketTypes::CodecVariants::kBRAWQ0), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 95 && tapped_y >= 120 && tapped_x <= 165 && tapped_y <= 160)
-          {
-            // 5:1 / Q1
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW5_1 : CCUPacketTypes::CodecVariants::kBRAWQ1), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 120 && tapped_x <= 240 && tapped_y <= 160)
-          {
-            // 8:1 / Q3
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW8_1 : CCUPacketTypes::CodecVariants::kBRAWQ3), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 245 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-          {
-            // 12:1 / Q5
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW12_1 : CCUPacketTypes::CodecVariants::kBRAWQ5), &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-      }
-      else
-      {
-        // ProRes
-
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 165 && tapped_y <= 115)
-          {
-            // HQ
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-          {
-            // 422
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 165 && tapped_y <= 160)
-          {
-            // LT
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-          {
-            // PXY
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy), &cameraConnection);
+    if(CodecScreen::hitTest(tapped_x, tapped_y, *camera, newCodec))
+    {
+      // Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023
+      PacketWriter::writeCodec(newCodec, &cameraConnection);
 
-            tappedAction = true;
-          }
-      }
+      tappedAction = true;
     }
-
   }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -1453,157 +1244,32 @@ void Screen_Codec4K6K(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Codec 4K/6K Refreshed.");
+
+  DEBUG_DEBUG("Screen Codec Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  // We need to have the Codec information to show the screen
-  if(!camera->hasCodec())
-  {
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_BLACK;
-    window.drawString("NO CODEC INFO.", 30, 9);
-
-    window.pushSprite(0, 0);
-
-    return;
-  }
-
-  // Codec label
-  window.setTextSize(2);
-  window.textcolor = TFT_WHITE;
-  window.textbgcolor = TFT_BLACK;
-  window.drawString("CODEC", 30, 9);
-
-  window.textbgcolor = TFT_DARKGREY;
-
-  // BRAW and ProRes selector buttons
-
-  // BRAW
-  window.setTextSize(2);
-  window.fillSmoothRoundRect(20, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  window.drawSmoothRoundRect(20, 30, 3, 4, 145, 40, TFT_NAVY, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("BRAW", 93, 41, tft.textfont);
-
-  // ProRes
-  window.fillSmoothRoundRect(170, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  window.drawSmoothRoundRect(170, 30, 3, 4, 145, 40, TFT_NAVY, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawCentreString("ProRes", 242, 41, tft.textfont);
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
+  // Buttons, labels and layout are shared (UI/CodecScreen), only the drawing is this display's. The URSA Mini Pro G2 adds ProRes 444.
+  if(camera->hasCodec())
   {
-    // BRAW
-
-    window.setTextSize(2);
-
-    // Are we Constant Bitrate or Constant Quality
-    std::string currentCodecString = currentCodec.to_string();
-    auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-    bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-    // Get the bitrate or quality setting
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string qualityBitrateSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 3:1, Q3, etc.
-
-    // Constant Bitrate
-    window.fillSmoothRoundRect(20, 75, 145, 40, 3, (isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(isConstantBitrate) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("BITRATE", 93, 83, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("CONSTANT", 93, 102, tft.textfont);
-
-    // Constant Quality
-    window.fillSmoothRoundRect(170, 75, 145, 40, 3, (!isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(!isConstantBitrate) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.setTextSize(2);
-    window.drawCentreString("QUALITY", 242, 83, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("CONSTANT", 242, 102, tft.textfont);
-
-    window.setTextSize(2);
-
-    // Setting 1 of 4
-    std::string optionString = (isConstantBitrate ? "3:1" : "Q0");
-    window.fillSmoothRoundRect(20, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(optionString == qualityBitrateSetting) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(optionString.c_str(), 55, 131, tft.textfont);
-
-    // Setting 2 of 4
-    optionString = (isConstantBitrate ? "5:1" : "Q1");
-    window.fillSmoothRoundRect(95, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(optionString == qualityBitrateSetting) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(optionString.c_str(), 130, 131, tft.textfont);
-
-  //   Setting 3 of 4
-    optionString = (isConstantBitrate ? "8:1" : "Q3");
-    window.fillSmoothRoundRect(170, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(optionString == qualityBitrateSetting) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(optionString.c_str(), 205, 131, tft.textfont);
-
-    // Setting 4 of 4
-    optionString = (isConstantBitrate ? "12:1" : "Q5");
-    window.fillSmoothRoundRect(245, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(optionString == qualityBitrateSetting) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(optionString.c_str(), 280, 131, tft.textfont);
+    CodecInfo currentCodec = camera->getCodec();
+    CodecScreen::update(&currentCodec, camera->isURSAMiniProG2());
   }
   else
-  {
-    // ProRes
+    CodecScreen::update(nullptr, false); // We need to have the Codec information to show the screen
 
-    window.setTextSize(2);
-
-    // Get the ProRes Setting
-    std::string currentCodecString = currentCodec.to_string();
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string currentProResSetting = currentCodecString.substr(spaceIndex + 1); // e.g. HQ, 422, LT, PXY
-
-    // HQ
-    std::string proResLabel = "HQ";
-    window.fillSmoothRoundRect(20, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentProResSetting == proResLabel) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(proResLabel.c_str(), 93, 87, tft.textfont);
-
-    // 422
-    proResLabel = "422";
-    window.fillSmoothRoundRect(170, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentProResSetting == proResLabel) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(proResLabel.c_str(), 242, 87, tft.textfont);
-
-    // LT
-    proResLabel = "LT";
-    window.fillSmoothRoundRect(20, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentProResSetting == proResLabel) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(proResLabel.c_str(), 93, 131, tft.textfont);
-
-    // PXY
-    proResLabel = "PXY";
-    window.fillSmoothRoundRect(170, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentProResSetting == proResLabel) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(proResLabel.c_str(), 242, 131, tft.textfont);
+  CodecScreen::draw(uiBackend);
 
-    window.setTextSize(2);
-  }
-
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Codec Screen for URSA Mini Pro G2
 void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Codec;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
+  // Same screen as the Pockets, with ProRes 444 XQ and 444
+  Screen_Codec4K6K(forceRefresh);
 }
 
 // Codec Screen for URSA Mini Pro 12K
@@ -1645,8 +1311,8 @@ void Screen_Codec(bool forceRefresh = false)
 
 }
 
-// Resolution screen for Pocket 4K
-void Screen_Resolution4K(bool forceRefresh = false)
+// Resolution screen for the Pocket 4K, Pocket 6K and URSA Mini Pro G2, each has its own resolutions and sensor areas in UI/ResolutionScreen
+void Screen_ResolutionModel(ResolutionScreen::Model model, bool forceRefresh)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
@@ -1655,125 +1321,25 @@ void Screen_Resolution4K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Pocket 4K Resolution and Sensor Windows
-
   // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
+  CCUPacketTypes::RecordingFormatData currentRecordingFormat = {};
   if(camera->hasRecordingFormat())
     currentRecordingFormat = camera->getRecordingFormat();
 
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
+  CCUPacketTypes::BasicCodec currentCodec = camera->hasCodec() ? camera->getCodec().basicCodec : CCUPacketTypes::BasicCodec::BRAW;
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K DCI
-        width = 4096; height = 2160;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K 2.4:1
-        width = 4096; height = 1720;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = true;
-      }
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-      {
-        // 2.8K Ana
-        width = 2880; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-      {
-        // 2.6K 16:9
-        width = 2688; height = 1512;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = true;
-      }
+    CCUPacketTypes::RecordingFormatData newRecordingFormat;
 
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
+    if(ResolutionScreen::hitTest(tapped_x, tapped_y, newRecordingFormat))
     {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K
-        width = 4096; height = 2160;
-        window = false; // true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = true; // currentRecordingFormat.windowedModeEnabled;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = true; // currentRecordingFormat.windowedModeEnabled;
-      }
+      // Resolution or Sensor Area selected, write to camera
+      PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
 
-      // Windowed options
-      /*
-      else if(currentRes == "HD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 310 && tapped_y <= 160)
-      {
-        // HD - Scaled from Full sensor, 2.6K, or Windowed, can't distinguish
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
-      */
-
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -1782,309 +1348,103 @@ void Screen_Resolution4K(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Resolution Pocket 4K Refreshed.");
+
+  DEBUG_DEBUG("Screen Resolution Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_BLACK;
-    window.drawString("BRAW RESOLUTION", 30, 9);
-
-    window.textbgcolor = TFT_DARKGREY;
+  // Buttons, labels and layout are shared (UI/ResolutionScreen), only the drawing is this display's
+  ResolutionScreen::update(model, currentCodec, currentRecordingFormat);
+  ResolutionScreen::draw(uiBackend);
 
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K 2.4:1", "4K UHD", "2.8K Ana", "2.6K 16:9", "HD"
+  Screen_Present();
+}
 
-    // 4K DCI
-    String labelRes = "4K DCI";
-    window.setTextSize(2);
-    window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 65, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("DCI", 65, 58, tft.textfont);
-    window.setTextSize(2);
+// Resolution screen for Pocket 4K
+void Screen_Resolution4K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket4K, forceRefresh);
+}
 
-    // 4K 2.4:1
-    labelRes = "4K 2.4:1";
-    window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 160, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("2.4:1", 160, 58, tft.textfont);
-    window.setTextSize(2);
+// Resolution screen for Pocket 6K
+void Screen_Resolution6K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket6K, forceRefresh);
+}
 
-    // 4K UHD
-    labelRes = "4K UHD";
-    window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 260, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("UHD", 260, 58, tft.textfont);
-    window.setTextSize(2);
+// Resolution Screen for URSA Mini Pro G2
+void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::URSAMiniProG2, forceRefresh);
+}
 
-    // 2.8K Ana
-    labelRes = "2.8K Ana";
-    window.fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("2.8K", 65, 82, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("ANAMORPHIC", 65, 104, tft.textfont);
-    window.setTextSize(2);
+// Resolution Screen for URSA Mini Pro 12K
+void Screen_ResolutionURSAMiniPro12K(bool forceRefresh = false)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
+    return;
 
-    // 2.6K 16:9
-    labelRes = "2.6K 16:9";
-    window.fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("2.6K", 160, 82, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("16:9", 160, 104, tft.textfont);
-    window.setTextSize(2);
+  connectedScreenIndex = Screens::Resolution;
 
-    // HD
-    labelRes = "HD";
-    window.fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("HD", 260, 87, tft.textfont);
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+  
+  // TO DO
+}
 
-    // Sensor Area
+// Resolution screen - redirects to appropriate screen fro camera
+void Screen_Resolution(bool forceRefresh = false)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
 
-    // Pocket 4K all are Windowed except 4K
-    // window.drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY, TFT_TRANSPARENT); // Optionally draw a rectangle around this info.
-    window.textbgcolor = TFT_BLACK;
-    window.drawCentreString(currentRes == "4K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 148, tft.textfont);
-    window.setTextSize(2);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
+  if(camera->hasCodec())
   {
-    // Main label
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_BLACK;
-    window.drawString("ProRes RESOLUTION", 30, 9);
-
-    window.textbgcolor = TFT_DARKGREY;
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    window.setTextSize(2);
-    window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 65, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("DCI", 65, 58, tft.textfont);
-    window.setTextSize(2);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("UHD", 160, 41, tft.textfont);
-
-    // HD
-    labelRes = "HD";
-    window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("HD", 260, 41, tft.textfont);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    window.setTextSize(1);
-    window.textbgcolor = TFT_BLACK;
-    window.drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, tft.textfont);
-    window.drawString("SCALED FROM SENSOR AREA", 30, 105, tft.textfont);
-    window.setTextSize(2);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      window.fillSmoothRoundRect(20, 120, 90, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString("FULL", 65, 131, tft.textfont);
-    }
-    else if(currentRes == "4K UHD")
+    if(camera->hasRecordingFormat())
     {
-      // Full sensor area only]
-      window.fillSmoothRoundRect(20, 120, 90, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString("WINDOW", 65, 131, tft.textfont);
-    }
+      if(camera->isPocket4K())
+        Screen_Resolution4K(forceRefresh); // Pocket 4K
+      else if(camera->isPocket6K())
+        Screen_Resolution6K(forceRefresh); // Pocket 6K
+      else if(camera->isURSAMiniProG2())
+        Screen_ResolutionURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
+      else if(camera->isURSAMiniPro12K())
+        Screen_ResolutionURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
+      else
+        DEBUG_DEBUG("No Codec screen for this camera.");
+    } 
     else
-    {
-      // HD
-
-      // Scaled from Full, 2.6K or Windowed (however we can't tell which)
-      window.fillSmoothRoundRect(20, 120, 290, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString("FULL / 2.6K / WINDOW", 165, 129, tft.textfont);
-      window.setTextSize(1);
-      window.drawCentreString("CHECK/SET ON CAMERA", 165, 146, tft.textfont);
-      window.setTextSize(2);
-    }
+      Screen_Resolution4K(forceRefresh); // Handle no model name in 4K screen
   }
   else
-    DEBUG_ERROR("Resolution Pocket 4K - Codec not catered for.");
-
-  window.pushSprite(0, 0);
+    Screen_Resolution4K(forceRefresh); // If we don't have any codec info, we show the 4K screen that shows no codec
 }
 
-// Resolution screen for Pocket 6K
-void Screen_Resolution6K(bool forceRefresh = false)
+// Media screen for the Pockets (CFast, SD and USB) and URSA Mini Pro G2 (two slots, named by their media)
+void Screen_MediaSlots(bool pocket, bool forceRefresh)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
 
-  connectedScreenIndex = Screens::Resolution;
+  connectedScreenIndex = Screens::Media;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Pocket 6K Resolution and Sensor Windows
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1)
   {
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 6K
-        width = 6144; height = 3456;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 6K 2.4:1
-        width = 6144; height = 2560;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // 5.7K 17:9
-        width = 5744; height = 3024;
-        window = true;
-      }
+    int slotIndex = MediaScreen::hitTest(tapped_x, tapped_y);
 
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-      {
-        // 4K DCI
-        width = 4096; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-      {
-        // 3.7K Anamorphic
-        width = 3728; height = 3104;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-      {
-        // 2.8K 17:9
-        width = 2868; height = 1512;
-        window = true;
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
+    if(slotIndex != -1)
     {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K
-        width = 4096; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = currentRecordingFormat.windowedModeEnabled;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = currentRecordingFormat.windowedModeEnabled;
-      }
-
-      // Windowed options
-      else if(currentRes == "4K UHD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-      {
-        // 4K UHD - Full Sensor
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = false;
-      }
-      else if(currentRes == "4K UHD" && tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-      {
-        // 4K UHD - Windowed 5.7K
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
-      else if(currentRes == "HD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-      {
-        // HD - Full Sensor
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = false;
-      }
-      else if(currentRes == "HD" && tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 310 && tapped_y <= 160)
-      {
-        // HD - Scaled from 5.7K or 2.8K, can't distinguish which unfortunately
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
+      // Make the slot the active one
+      TransportInfo transportInfo = camera->getTransportMode();
+      for(int index = 0; index < transportInfo.slots.size(); index++)
+        transportInfo.slots[index].active = index == slotIndex;
+      PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
 
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -2093,288 +1453,107 @@ void Screen_Resolution6K(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Resolution Pocket 6K Refreshed.");
+
+  DEBUG_DEBUG("Screen Media Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_BLACK;
-    window.drawString("BRAW RESOLUTION", 30, 9);
-
-    window.textbgcolor = TFT_DARKGREY;
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "6K", "6K 2.4:1", "5.7K 17:9", "4K DCI", "3.7K 6:5A", "2.8K 17:9"
+  // Buttons, labels and layout are shared (UI/MediaScreen), only the drawing is this display's
+  MediaScreen::update(camera->getMediaSlots(), pocket);
+  MediaScreen::draw(uiBackend);
 
-    // 6K
-    String labelRes = "6K";
-    window.setTextSize(2);
-    window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString(String(labelRes).c_str(), 65, 41, tft.textfont);
-
-    // 6K, 2.4:1
-    labelRes = "6K 2.4:1";
-    window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("6K", 160, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("2.4:1", 160, 58, tft.textfont);
-    window.setTextSize(2);
-
-    // 5.7K, 17:9
-    labelRes = "5.7K 17:9";
-    window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("5.7K", 260, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("17:9", 260, 58, tft.textfont);
-    window.setTextSize(2);
-
-    // 4K DCI
-    labelRes = "4K DCI";
-    window.fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 65, 82, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("DCI", 65, 104, tft.textfont);
-    window.setTextSize(2);
-
-    // 3.7K 6:5A
-    labelRes = "3.7K 6:5A";
-    window.fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("3.7K", 160, 82, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("6:5 ANA", 160, 104, tft.textfont);
-    window.setTextSize(2);
-
-    // 2.8K 17:9
-    labelRes = "2.8K 17:9";
-    window.fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("2.8K", 260, 82, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("17:9", 260, 104, tft.textfont);
-    window.setTextSize(2);
-
-    // Sensor Area
-
-    // Pocket 6K all are Windowed except 6K
-    // window.drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY, TFT_TRANSPARENT); // Optionally draw a rectangle around this info.
-    window.textbgcolor = TFT_BLACK;
-    window.drawCentreString(currentRes == "6K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 148, tft.textfont);
-    window.setTextSize(2);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    window.setTextSize(2);
-    window.textcolor = TFT_WHITE;
-    window.textbgcolor = TFT_BLACK;
-    window.drawString("ProRes RESOLUTION", 30, 9);
-
-    window.textbgcolor = TFT_DARKGREY;
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    window.setTextSize(2);
-    window.fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("4K", 65, 36, tft.textfont);
-    window.setTextSize(1);
-    window.drawCentreString("DCI", 65, 58, tft.textfont);
-    window.setTextSize(2);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    window.fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("UHD", 160, 41, tft.textfont);
-
-    // HD
-    labelRes = "HD";
-    window.fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-    if(currentRes == labelRes) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-    window.drawCentreString("HD", 260, 41, tft.textfont);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    window.setTextSize(1);
-    window.textbgcolor = TFT_BLACK;
-    window.drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, tft.textfont);
-    window.drawString("SCALED FROM SENSOR AREA", 30, 105, tft.textfont);
-    window.setTextSize(2);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      window.fillSmoothRoundRect(20, 120, 90, 40, 3, TFT_DARKGREEN, TFT_TRANSPARENT);
-      window.textbgcolor = TFT_DARKGREEN;
-      window.drawCentreString("FULL", 65, 131, tft.textfont);
-    }
-    else if(currentRes == "4K UHD")
-    {
-      // Scaled from Full or 5.7K
-      window.fillSmoothRoundRect(20, 120, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-      if(!currentRecordingFormat.windowedModeEnabled) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-      window.drawCentreString("FULL", 65, 131, tft.textfont);
-
-      // 5.7K
-      window.fillSmoothRoundRect(115, 120, 90, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-      if(currentRecordingFormat.windowedModeEnabled) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-      window.drawCentreString("5.7K", 160, 131, tft.textfont);
-    }
-    else
-    {
-      // HD
-
-      // Scaled from Full, 2.8K or 5.7K (however we can't tell if it's 2.8K or 5.7K)
-      window.fillSmoothRoundRect(20, 120, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-      if(!currentRecordingFormat.windowedModeEnabled) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-      window.drawCentreString("FULL", 65, 131, tft.textfont);
-
-      // 2.8K 5.7K
-      window.fillSmoothRoundRect(115, 120, 195, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-      if(currentRecordingFormat.windowedModeEnabled) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-      window.drawCentreString("5.7K / 2.8K", 212, 126, tft.textfont);
-      window.setTextSize(1);
-      window.drawCentreString("CHECK/SET ON CAMERA", 212, 146, tft.textfont);
-      window.setTextSize(2);
-    }
-  }
-  else
-    DEBUG_ERROR("Resolution Pocket 6K - Codec not catered for.");
-
-  window.pushSprite(0, 0);
+  Screen_Present();
 }
 
-// Resolution Screen for URSA Mini Pro G2
-void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
+// Media screen for Pocket 4K and 6K
+void Screen_Media4K6K(bool forceRefresh = false)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
+  Screen_MediaSlots(true, forceRefresh);
+}
 
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
+// Media Screen for URSA Mini Pro G2
+void Screen_MediaURSAMiniProG2(bool forceRefresh = false)
+{
+  Screen_MediaSlots(false, forceRefresh);
 }
 
-// Resolution Screen for URSA Mini Pro 12K
-void Screen_ResolutionURSAMiniPro12K(bool forceRefresh = false)
+// Media Screen for URSA Mini Pro 12K
+void Screen_MediaURSAMiniPro12K(bool forceRefresh = false)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
 
-  connectedScreenIndex = Screens::Resolution;
+  connectedScreenIndex = Screens::Media;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
   
   // TO DO
 }
 
-// Resolution screen - redirects to appropriate screen fro camera
-void Screen_Resolution(bool forceRefresh = false)
+
+// Media screen - redirects to appropriate screen for camera
+void Screen_Media(bool forceRefresh = false)
 {
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  if(camera->hasCodec())
+  if(camera->getMediaSlots().size() != 0)
   {
-    if(camera->hasRecordingFormat())
+    if(camera->hasModelName())
     {
-      if(camera->isPocket4K())
-        Screen_Resolution4K(forceRefresh); // Pocket 4K
-      else if(camera->isPocket6K())
-        Screen_Resolution6K(forceRefresh); // Pocket 6K
+      if(camera->isPocket4K6K())
+        Screen_Media4K6K(forceRefresh); // Pocket camera
       else if(camera->isURSAMiniProG2())
-        Screen_ResolutionURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
+        Screen_MediaURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
       else if(camera->isURSAMiniPro12K())
-        Screen_ResolutionURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
+        Screen_MediaURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
       else
-        DEBUG_DEBUG("No Codec screen for this camera.");
+        DEBUG_DEBUG("No Media screen for this camera.");
     } 
     else
-      Screen_Resolution4K(forceRefresh); // Handle no model name in 4K screen
+      Screen_Media4K6K(forceRefresh); // Handle no model name in 4K/6K screen
   }
   else
-    Screen_Resolution4K(forceRefresh); // If we don't have any codec info, we show the 4K screen that shows no codec
+    Screen_Media4K6K(forceRefresh); // If we don't have any media info, we show the 4K/6K screen that shows no media
+
 }
 
-// Media screen for Pocket 4K
-void Screen_Media4K6K(bool forceRefresh = false)
+// The look slot under a touch on the Looks screen, two columns of three, or -1
+int Screen_LooksSlotAt(int x, int y)
+{
+  if(x < 20 || x > 315 || y < 30 || y > 160)
+    return -1;
+
+  int column = x < 170 ? 0 : 1;
+  int row = std::min(2, (y - 30) / 45);
+
+  return row * 2 + column;
+}
+
+// Looks screen, a tap recalls a look (or saves into an empty slot), a long press saves the camera's settings over it
+void Screen_Looks(bool forceRefresh = false)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
 
-  connectedScreenIndex = Screens::Media;
+  connectedScreenIndex = Screens::Looks;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // 3 Media Slots - CFAST, SD, USB
-
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
-  if(tapped_x != -1 && camera->getMediaSlots().size() != 0)
+  if(tapped_x != -1)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
+    int slot = Screen_LooksSlotAt(tapped_x, tapped_y);
+    if(slot != -1)
     {
-      // Tapped within the area
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // CFAST
-        if(camera->getMediaSlots()[0].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[0].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = true;
-          transportInfo.slots[1].active = false;
-          transportInfo.slots[2].active = false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-      {
-          // Change to SD
-        if(camera->getMediaSlots()[1].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[1].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = false;
-          transportInfo.slots[1].active = true;
-          transportInfo.slots[2].active = false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-      {
-          // Change to USB
-        if(camera->getMediaSlots()[2].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[2].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = false;
-          transportInfo.slots[1].active = false;
-          transportInfo.slots[2].active = true;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
+      if(LookPresets::isUsed(slot))
+        LookPresets::recall(slot);
+      else
+        LookPresets::capture(slot, "");
 
-          tappedAction = true;
-        }
-      }
+      tappedAction = true;
     }
   }
 
@@ -2383,123 +1562,323 @@ void Screen_Media4K6K(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Media Pocket 4K/6K Refreshed.");
+
+  DEBUG_DEBUG("Screen Looks Refreshed.");
 
   window.fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-    // Media label
+  // Looks label
   window.setTextSize(2);
   window.textcolor = TFT_WHITE;
   window.textbgcolor = TFT_BLACK;
-  window.drawString("MEDIA", 30, 9);
+  window.drawString("LOOKS", 30, 9);
 
-  window.textbgcolor = TFT_DARKGREY;
+  window.setTextSize(1);
+  window.textcolor = TFT_LIGHTGREY;
+  if(LookPresets::getLastRecallMs() != 0 && !LookPresets::isRecalling())
+    window.drawString((std::to_string(LookPresets::getLastRecallMs()) + "ms").c_str(), 100, 13);
+  window.drawRightString("HOLD TO SAVE", 315, 13, tft.textfont);
 
-  // CFAST
-  BMDCamera::MediaSlot cfast = camera->getMediaSlots()[0];
-  window.fillSmoothRoundRect(20, 30, 295, 40, 3, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(cfast.StatusIsError()) window.drawSmoothRoundRect(20, 30, 4, 3, 295, 40, TFT_RED, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(cfast.active) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawString("CFAST", 28, 50, tft.textfont);
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) window.drawString(cfast.remainingRecordTimeString.c_str(), 155, 50, tft.textfont);
+  // Green when the camera is on the look, orange while it's being recalled
+  for(byte slot = 0; slot < LookPresets::kMaxLooks; slot++)
+  {
+    int x = slot % 2 == 0 ? 20 : 170;
+    int y = 30 + (slot / 2) * 45;
 
-  window.setTextSize(1);
-  
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) window.drawString("REMAINING TIME", 155, 35);
-  window.drawString("1", 300, 35);
-  window.drawString(cfast.GetStatusString().c_str(), 28, 35);
+    int colour = TFT_DARKGREY;
+    if(LookPresets::isRecalling() && LookPresets::getLastRecalled() == slot)
+      colour = TFT_ORANGE;
+    else if(LookPresets::matches(slot))
+      colour = TFT_DARKGREEN;
 
-  window.setTextSize(2);
+    window.fillSmoothRoundRect(x, y, 145, 40, 5, colour, TFT_TRANSPARENT);
+    window.textbgcolor = colour;
 
-  // SD
-  BMDCamera::MediaSlot sd = camera->getMediaSlots()[1];
-  window.fillSmoothRoundRect(20, 75, 295, 40, 3, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(sd.StatusIsError()) window.drawSmoothRoundRect(20, 75, 4, 3, 295, 40, TFT_RED, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(sd.active) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawString("SD", 28, 95, tft.textfont);
-  if(sd.status != CCUPacketTypes::MediaStatus::None) window.drawString(sd.remainingRecordTimeString.c_str(), 155, 95, tft.textfont);
+    if(!LookPresets::isUsed(slot))
+    {
+      window.setTextSize(2);
+      window.textcolor = TFT_LIGHTGREY;
+      window.drawCentreString("EMPTY", x + 73, y + 12, tft.textfont);
+      continue;
+    }
 
-  window.setTextSize(1);
-  
-  if(sd.status != CCUPacketTypes::MediaStatus::None) window.drawString("REMAINING TIME", 155, 80);
-  window.drawString("2", 300, 80);
-  window.drawString(sd.GetStatusString().c_str(), 28, 80);
-  if(sd.StatusIsError()) window.textcolor = TFT_WHITE;
+    window.setTextSize(2);
+    window.textcolor = TFT_WHITE;
+    window.drawCentreString(LookPresets::getLook(slot).name, x + 73, y + 4, tft.textfont);
 
-  window.setTextSize(2);
+    window.setTextSize(1);
+    window.drawCentreString(LookPresets::getSummary(slot).c_str(), x + 73, y + 27, tft.textfont);
+  }
 
-  // USB
-  BMDCamera::MediaSlot usb = camera->getMediaSlots()[2];
-  window.fillSmoothRoundRect(20, 120, 295, 40, 3, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY), TFT_TRANSPARENT);
-  if(usb.StatusIsError()) window.drawSmoothRoundRect(20, 120, 4, 3, 295, 40, TFT_RED, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(usb.active) window.textbgcolor = TFT_DARKGREEN; else window.textbgcolor = TFT_DARKGREY;
-  window.drawString("USB", 28, 140, tft.textfont);
-  if(usb.status != CCUPacketTypes::MediaStatus::None) window.drawString(usb.remainingRecordTimeString.c_str(), 155, 140, tft.textfont);
+  Screen_Present();
+}
 
-  window.setTextSize(1);
-  
-  if(usb.status != CCUPacketTypes::MediaStatus::None) window.drawString("REMAINING TIME", 155, 125);
-  window.drawString("3", 300, 125);
-  window.drawString(usb.GetStatusString().c_str(), 28, 125);
-  if(usb.StatusIsError()) window.textcolor = TFT_WHITE;
+// Draws the current connected screen, only if something has changed unless forceRefresh
+void Screen_Render(bool forceRefresh = false)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  switch(connectedScreenIndex)
+  {
+    case Screens::Dashboard:
+      Screen_Dashboard(forceRefresh);
+      break;
+    case Screens::Recording:
+      Screen_Recording(forceRefresh);
+      break;
+    case Screens::ISO:
+      Screen_ISO(forceRefresh);
+      break;
+    case Screens::ShutterAngleSpeed:
+      if(camera->shutterValueIsAngle)
+        Screen_ShutterAngle(forceRefresh);
+      else
+        Screen_ShutterSpeed(forceRefresh);
+      break;
+    case Screens::WhiteBalanceTint:
+      Screen_WBTint(forceRefresh);
+      break;
+    case Screens::Codec:
+      Screen_Codec(forceRefresh);
+      break;
+    case Screens::Resolution:
+      Screen_Resolution(forceRefresh);
+      break;
+    case Screens::Media:
+      Screen_Media(forceRefresh);
+      break;
+    case Screens::Looks:
+      Screen_Looks(forceRefresh);
+      break;
+  }
+}
+
+// Screen cache (UI/ScreenCache), the screens a swipe away are drawn in idle time so swiping to one shows it straight away, sliding
+// in from the current screen. They're drawn again as the camera changes and the new screen is redrawn after the swipe if the
+// camera has moved on since it was cached.
+const Screens swipeOrder[] = { Screens::Dashboard, Screens::Recording, Screens::ISO, Screens::ShutterAngleSpeed, Screens::WhiteBalanceTint, Screens::Codec, Screens::Resolution, Screens::Media, Screens::Looks };
+bool currentScreenCached = false; // The window holds the current screen and it's in the cache
+unsigned long lastPrerender = 0;
+
+const uint8_t* slideFrom = nullptr;
+const uint8_t* slideTo = nullptr;
+bool slideForward = true;
+byte slideFrame = 0;
+
+// Puts the window's frame of the current screen in the cache, it's what's put back after drawing another screen and what a
+// swipe slides away from
+bool Screen_CacheCurrent()
+{
+  if(currentScreenCached && ScreenCache::has(static_cast<byte>(connectedScreenIndex), lastRefreshedScreen))
+    return true;
+
+  // Nothing drawn since the screen changed
+  if(lastRefreshedScreen == 0)
+    return false;
+
+  ScreenCache::store(static_cast<byte>(connectedScreenIndex), lastRefreshedScreen, UI_FrameBuffer());
+  currentScreenCached = true;
 
-  window.pushSprite(0, 0);
+  return true;
 }
 
-// Media Screen for URSA Mini Pro G2
-void Screen_MediaURSAMiniProG2(bool forceRefresh = false)
+// Draws a screen into the cache without showing it, the current screen is put back in the window afterwards
+void Screen_Prerender(Screens screen)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
+  if(!Screen_CacheCurrent())
     return;
 
-  connectedScreenIndex = Screens::Media;
+  Screens currentScreen = connectedScreenIndex;
+  unsigned long currentRefreshed = lastRefreshedScreen;
 
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
+  screenPrerendering = true;
+  connectedScreenIndex = screen;
+  lastRefreshedScreen = 0;
+
+  Screen_Render(true);
+
+  if(connectedScreenIndex == screen && lastRefreshedScreen != 0)
+    ScreenCache::store(static_cast<byte>(screen), lastRefreshedScreen, UI_FrameBuffer());
+
+  screenPrerendering = false;
+  connectedScreenIndex = currentScreen;
+  lastRefreshedScreen = currentRefreshed;
+  ScreenCache::restore(static_cast<byte>(currentScreen), currentRefreshed, UI_FrameBuffer());
+
+  lastPrerender = millis();
 }
 
-// Media Screen for URSA Mini Pro 12K
-void Screen_MediaURSAMiniPro12K(bool forceRefresh = false)
+// Draws one of the screens a swipe away if it isn't cached or is behind the camera, one each time round loop() so input is still
+// checked in between
+void Screen_PrerenderNeighbours()
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
+  if(!ScreenCache::isStarted() || slideTo != nullptr || RenderScheduler::isInvalid() || tapped_x != -1)
     return;
 
-  connectedScreenIndex = Screens::Media;
+  // The current screen is drawn first
+  unsigned long version = BMDControlSystem::getInstance()->getCamera()->getLastModified();
+  if(lastRefreshedScreen != version)
+    return;
 
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
+  const byte screenCount = sizeof(swipeOrder) / sizeof(swipeOrder[0]);
+  for(byte index = 0; index < screenCount; index++)
+  {
+    if(swipeOrder[index] != connectedScreenIndex)
+      continue;
+
+    Screens neighbours[] = { swipeOrder[index + 1 < screenCount ? index + 1 : index], swipeOrder[index > 0 ? index - 1 : index] };
+    for(Screens neighbour : neighbours)
+    {
+      if(neighbour == connectedScreenIndex || ScreenCache::has(static_cast<byte>(neighbour), version))
+        continue;
+
+      // Not cached yet, or behind the camera and due to be redrawn
+      unsigned long cachedVersion;
+      if(ScreenCache::get(static_cast<byte>(neighbour), cachedVersion) == nullptr || millis() - lastPrerender >= SCREEN_PRERENDER_MS)
+        Screen_Prerender(neighbour);
+
+      return;
+    }
+
+    return;
+  }
 }
 
+// Moves to a screen after a swipe, straight away if it's cached, otherwise it's drawn on the next frame tick
+void Screen_SwipeTo(Screens screen, bool forward)
+{
+  unsigned long version = 0;
+  const uint8_t* frame = ScreenCache::isStarted() && BMDControlSystem::getInstance()->hasCamera() ? ScreenCache::get(static_cast<byte>(screen), version) : nullptr;
+  if(frame == nullptr)
+  {
+    Screen_Show(screen);
+    return;
+  }
+
+  slideFrom = nullptr;
+  unsigned long fromVersion;
+  if(SCREEN_SLIDE_FRAMES > 0 && Screen_CacheCurrent())
+    slideFrom = ScreenCache::get(static_cast<byte>(connectedScreenIndex), fromVersion);
 
-// Media screen - redirects to appropriate screen for camera
-void Screen_Media(bool forceRefresh = false)
+  slideTo = frame;
+  slideForward = forward;
+  slideFrame = 0;
+
+  // Redrawn after the slide if the camera has changed since it was cached. The dashboard's tiles only redraw what changed since they
+  // were last drawn, so it's drawn in full.
+  connectedScreenIndex = screen;
+  lastRefreshedScreen = screen == Screens::Dashboard ? 0 : version;
+  currentScreenCached = true;
+
+  RenderScheduler::invalidate();
+}
+
+// Shows the next frame of a slide between two cached screens, false if there isn't a slide in progress
+bool Screen_Slide()
 {
-  auto camera = BMDControlSystem::getInstance()->getCamera();
+  if(slideTo == nullptr)
+    return false;
 
-  if(camera->getMediaSlots().size() != 0)
+  slideFrame++;
+
+  if(slideFrom != nullptr && slideFrame < SCREEN_SLIDE_FRAMES)
   {
-    if(camera->hasModelName())
-    {
-      if(camera->isPocket4K6K())
-        Screen_Media4K6K(forceRefresh); // Pocket camera
-      else if(camera->isURSAMiniProG2())
-        Screen_MediaURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
-      else if(camera->isURSAMiniPro12K())
-        Screen_MediaURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
-      else
-        DEBUG_DEBUG("No Media screen for this camera.");
-    } 
-    else
-      Screen_Media4K6K(forceRefresh); // Handle no model name in 4K/6K screen
+    // Eases out, most of the movement is in the first frames
+    int remaining = SCREEN_SLIDE_FRAMES - slideFrame;
+    short offset = IWIDTH - IWIDTH * remaining * remaining / (SCREEN_SLIDE_FRAMES * SCREEN_SLIDE_FRAMES);
+
+    ScreenCache::composeSlide(UI_FrameBuffer(), slideFrom, slideTo, IWIDTH, IHEIGHT, 2, offset, slideForward);
+    Screen_Present();
+
+    RenderScheduler::invalidate(); // For the next frame of the slide
+    return true;
   }
-  else
-    Screen_Media4K6K(forceRefresh); // If we don't have any media info, we show the 4K/6K screen that shows no media
 
+  memcpy(UI_FrameBuffer(), slideTo, IWIDTH * IHEIGHT * 2);
+  Screen_Present();
+
+  slideFrom = nullptr;
+  slideTo = nullptr;
+
+  return true;
+}
+
+
+// Sends the white balance and tint the sliders are at, the coalescer decides when it's written
+void Touch_SendWhiteBalance(unsigned long sampleMicros)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  int whiteBalance = whiteBalanceSlider.isActive() ? whiteBalanceSlider.getValue() : camera->getWhiteBalance();
+  int tint = tintSlider.isActive() ? tintSlider.getValue() : (camera->hasTint() ? camera->getTint() : 0);
+
+  CommandCoalescer::set(CommandCoalescer::Parameter::WhiteBalanceTint, whiteBalance, tint, sampleMicros);
+
+  lastRefreshedScreen = 0; // Forces a refresh, showing the new value straight away
+}
+
+// Gestures from the touch engine, drags on the white balance and tint values move them and a long press on the Kelvin value is auto
+// white balance. Taps and swipes still come from the touch controller.
+void Touch_Gesture(const TouchGestures::Event& gesture)
+{
+  bool onWhiteBalance = cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && connectedScreenIndex == Screens::WhiteBalanceTint && BMDControlSystem::getInstance()->hasCamera();
+
+  switch(gesture.gesture)
+  {
+    case TouchGestures::Gesture::DragStart:
+      if(onWhiteBalance && BMDControlSystem::getInstance()->getCamera()->hasWhiteBalance())
+      {
+        auto camera = BMDControlSystem::getInstance()->getCamera();
+
+        if(whiteBalanceSlider.contains(gesture.startX, gesture.startY))
+          whiteBalanceSlider.begin(camera->getWhiteBalance(), gesture.startX);
+        else if(tintSlider.contains(gesture.startX, gesture.startY))
+          tintSlider.begin(camera->hasTint() ? camera->getTint() : 0, gesture.startX);
+      }
+
+      sliderTouch = whiteBalanceSlider.isActive() || tintSlider.isActive();
+
+      if(whiteBalanceSlider.drag(gesture.x) || tintSlider.drag(gesture.x))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      break;
+    case TouchGestures::Gesture::Drag:
+      if(whiteBalanceSlider.drag(gesture.x) || tintSlider.drag(gesture.x))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      break;
+    case TouchGestures::Gesture::Fling:
+      if(whiteBalanceSlider.fling(gesture.velocityX) || tintSlider.fling(gesture.velocityX))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      break;
+    case TouchGestures::Gesture::DragEnd:
+      if(sliderTouch)
+      {
+        // Last value goes now
+        CommandCoalescer::flush(CommandCoalescer::Parameter::WhiteBalanceTint);
+        whiteBalanceSlider.end();
+        tintSlider.end();
+      }
+      break;
+    case TouchGestures::Gesture::LongPress:
+      if(onWhiteBalance && whiteBalanceSlider.contains(gesture.x, gesture.y))
+      {
+        PacketWriter::writeAutoWhiteBalance(&cameraConnection);
+        sliderTouch = true;
+      }
+      else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && connectedScreenIndex == Screens::Looks && Screen_LooksSlotAt(gesture.x, gesture.y) != -1)
+      {
+        // Saves the camera's settings over the look, the tap when the finger lifts is ignored
+        LookPresets::capture(Screen_LooksSlotAt(gesture.x, gesture.y), "");
+        sliderTouch = true;
+
+        lastRefreshedScreen = 0; // Forces a refresh
+        ScreenCache::invalidate();
+      }
+      break;
+    default:
+      break;
+  }
 }
 
 
@@ -2511,19 +1890,11 @@ void setup() {
 
   Serial.begin(115200);
 
-  // Allow a timeout of 20 seconds for time for the pass key entry.
-  esp_task_wdt_init(20, true);
+  // Pass key entry runs in loop() and doesn't hold up the Bluetooth task, so the watchdog can stay tight
+  esp_task_wdt_init(5, true);
 
-  // When the Sleep Button (Boot button on the device) is pressed, go to sleep and enable wakeup on button 14 (configured in PinConfig.h)
-  sleepButton.attachClick([]() {
-    DEBUG_INFO("Going to Sleep");
-    pinMode(PIN_POWER_ON, OUTPUT);
-    pinMode(PIN_LCD_BL, OUTPUT);
-    digitalWrite(PIN_POWER_ON, LOW);
-    digitalWrite(PIN_LCD_BL, LOW); // Turn screen off
-    esp_sleep_enable_ext0_wakeup((gpio_num_t)PIN_BUTTON_2, 0); // 1 = High, 0 = Low
-    esp_deep_sleep_start();
-  });
+  // When the Sleep Button (Boot button on the device) is clicked, go to sleep and enable wakeup on button 14 (configured in PinConfig.h)
+  InputQueue::attachButton(static_cast<byte>(Inputs::SleepButton), SLEEP_BUTTON_PIN, true, true);
 
   // SET DEBUG LEVEL
   Debug.setDebugLevel(DBG_VERBOSE);
@@ -2540,12 +1911,11 @@ void setup() {
 
   window.createSprite(IWIDTH, IHEIGHT);
 
-  spriteMPCSplash.createSprite(IWIDTH, IHEIGHT);
-  spriteMPCSplash.setSwapBytes(true);
-  spriteMPCSplash.pushImage(0, 0, IWIDTH, IHEIGHT, MPCSplash);
+  // Images are read from flash as they're drawn rather than kept in sprites
+  AssetStore::begin();
 
-  spriteMPCSplash.pushToSprite(&window, 0, 0);
-  window.pushSprite(0, 0);
+  Screen_DrawImage("MPCSplash", MPCSplash, 0, 0, IWIDTH, IHEIGHT);
+  Screen_Present();
 
   // Fade in the screen
   ledcSetup(0, 10000, 8);
@@ -2555,78 +1925,91 @@ void setup() {
       delay(2);
   }
 
-  // Images, store them in sprites ready to be used when we need them
-  spriteBluetooth.createSprite(30, 46);
-  spriteBluetooth.setSwapBytes(true);
-  spriteBluetooth.pushImage(0, 0, 30, 46, Wikipedia_Bluetooth_30x46);
-
-  spritePocket4k.createSprite(110, 61);
-  spritePocket4k.setSwapBytes(true);
-  spritePocket4k.pushImage(0, 0, 110, 61, blackmagic_pocket_4k_110x61);
-
-  // White Balance images
-  spriteWBBright.createSprite(30, 30);
-  spriteWBBright.setSwapBytes(true);
-  spriteWBBright.pushImage(0, 0, 30, 30, WBBright);
-
-  spriteWBCloud.createSprite(30, 30);
-  spriteWBCloud.setSwapBytes(true);
-  spriteWBCloud.pushImage(0, 0, 30, 30, WBCloud);
-
-  spriteWBFlourescent.createSprite(30, 30);
-  spriteWBFlourescent.setSwapBytes(true);
-  spriteWBFlourescent.pushImage(0, 0, 30, 30, WBFlourescent);
-
-  spriteWBIncandescent.createSprite(30, 30);
-  spriteWBIncandescent.setSwapBytes(true);
-  spriteWBIncandescent.pushImage(0, 0, 30, 30, WBIncandescent);
-
-  spriteWBMixedLight.createSprite(30, 30);
-  spriteWBMixedLight.setSwapBytes(true);
-  spriteWBMixedLight.pushImage(0, 0, 30, 30, WBMixedLight);
-
-  spriteWBBrightBG.createSprite(30, 30);
-  spriteWBBrightBG.setSwapBytes(true);
-  spriteWBBrightBG.pushImage(0, 0, 30, 30, WBBrightBG);
-
-  spriteWBCloudBG.createSprite(30, 30);
-  spriteWBCloudBG.setSwapBytes(true);
-  spriteWBCloudBG.pushImage(0, 0, 30, 30, WBCloudBG);
-
-  spriteWBFlourescentBG.createSprite(30, 30);
-  spriteWBFlourescentBG.setSwapBytes(true);
-  spriteWBFlourescentBG.pushImage(0, 0, 30, 30, WBFlourescentBG);
-
-  spriteWBIncandescentBG.createSprite(30, 30);
-  spriteWBIncandescentBG.setSwapBytes(true);
-  spriteWBIncandescentBG.pushImage(0, 0, 30, 30, WBIncandescentBG);
-
-  spriteWBMixedLightBG.createSprite(30, 30);
-  spriteWBMixedLightBG.setSwapBytes(true);
-  spriteWBMixedLightBG.pushImage(0, 0, 30, 30, WBMixedLightBG);
-
   spritePassKey.createSprite(IWIDTH, IHEIGHT);
 
   // Prepare for Bluetooth connections and start scanning for cameras
   cameraConnection.initialise(&window, &spritePassKey, &touch, IWIDTH, IHEIGHT); // Screen Pass Key entry
-
-  // Start capturing touchscreen touches
+  LinkHealthMonitor::begin(&cameraConnection); // Watches the link once connected
+  LookPresets::begin(&cameraConnection); // Saved looks, from NVS
+  CommandCoalescer::begin(&cameraConnection); // Values from dragging sliders
+
+#if USING_DISPLAY_PRESENTER == 1
+  DisplayPresenter::begin({ Presenter_BeginTransfers, Presenter_Transfer, Presenter_Busy, Presenter_EndTransfers }, IWIDTH, IHEIGHT, DisplayPresenter::PixelFormat::RGB565Swapped, 17, true);
+#endif
+
+  RenderScheduler::begin(RENDER_TARGET_FPS, INPUT_SAMPLES_PER_SECOND);
+
+  // Shared screens are laid out once for the display
+  ISOScreen::layout(IWIDTH, IHEIGHT);
+  ShutterAngleScreen::layout(IWIDTH, IHEIGHT);
+  ShutterSpeedScreen::layout(IWIDTH, IHEIGHT);
+  WhiteBalanceScreen::layout(IWIDTH, IHEIGHT);
+  CodecScreen::layout(IWIDTH, IHEIGHT);
+  ResolutionScreen::layout(IWIDTH, IHEIGHT);
+  MediaScreen::layout(IWIDTH, IHEIGHT);
+
+  // Tiles go in PSRAM
+  if(TILE_CACHE_BYTES > 0)
+    TileCache::begin(TILE_CACHE_BYTES);
+
+  // As do the cached screens
+  if(SCREEN_CACHE_FRAMES > 0)
+    ScreenCache::begin(IWIDTH * IHEIGHT * 2, SCREEN_CACHE_FRAMES);
+
+  // Start capturing touchscreen touches, each move as well so drags can be followed
   touch.begin();
+  touch.enableMotionReports();
+  touch.onInterrupt(Touch_Interrupt);
 }
 
 int memoryLoopCounter;
 
 void loop() {
 
-  static unsigned long lastConnectedTime = 0;
-  const unsigned long reconnectInterval = 5000;  // 5 seconds (milliseconds)
+  // Taps are kept until a screen has been drawn to pick them up
+  bool inputConsumed = true;
+
+  // The camera is waiting for a pass key, its entry screen has the display and input until it's answered
+  if(cameraConnection.servicePassKey())
+  {
+    connectedScreenIndex = Screens::PassKey; // Screens are drawn in full again afterwards
+    InputQueue::clear(); // It reads the touch screen itself
+    delay(10);
+    return;
+  }
+
+  // Refresh the screen when the link health changes so the sidebar shows it
+  if(LinkHealthMonitor::update())
+  {
+    lastRefreshedScreen = 0;
+    ScreenCache::invalidate();
+  }
 
-  unsigned long currentTime = millis();
+  // Refresh when a look has been recalled so it shows as the camera's
+  if(LookPresets::service())
+  {
+    lastRefreshedScreen = 0;
+    ScreenCache::invalidate();
+  }
 
-  sleepButton.tick(); // Check if the sleep button has been pressed
+  // Input queued by the interrupts, a click of the sleep button (pressed and released within a second) puts it to sleep
+  InputQueue::Event input;
+  while(InputQueue::poll(input))
+  {
+    if(input.id == static_cast<byte>(Inputs::Touch))
+      touchInput = input; // Read below
+    else if(input.type == InputQueue::Type::Press)
+      sleepButtonPressed = input.micros;
+    else if(input.type == InputQueue::Type::Release && sleepButtonPressed != 0 && input.micros - sleepButtonPressed < 1000000)
+    {
+      InputQueue::actionTaken(input);
+      Sleep_Now();
+    }
+  }
 
-  if (cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected && currentTime - lastConnectedTime >= reconnectInterval) {
-    DEBUG_VERBOSE("Disconnected for too long, trying to reconnect");
+  // The connection works out when to try again, backing off while no camera is found
+  if (cameraConnection.reconnectDue()) {
+    DEBUG_VERBOSE("Not connected, trying to reconnect");
 
     // Set the status to Scanning and then show the NoConnection screen to render the Scanning page before starting the scan (which blocks so it can't render the Scanning page before it finishes)
     cameraConnection.status = BMDCameraConnection::ConnectionStatus::Scanning;
@@ -2648,85 +2031,86 @@ void loop() {
       if(cameraConnection.getInitialPayloadTime() != ULONG_MAX && cameraConnection.getInitialPayloadTime() > camera->getLastModified())
         camera->setLastModified();
 
-      switch(connectedScreenIndex)
+      // Camera changes, screen changes and taps invalidate the screen, it's drawn on the next frame tick
+      if(lastRefreshedScreen != camera->getLastModified() || tapped_x != -1)
+        RenderScheduler::invalidate();
+
+      inputConsumed = RenderScheduler::frameDue();
+      if(inputConsumed)
       {
-        case Screens::Dashboard:
-          Screen_Dashboard();
-          break;
-        case Screens::Recording:
-          Screen_Recording();
-          break;
-        case Screens::ISO:
-          Screen_ISO();
-          break;
-        case Screens::ShutterAngleSpeed:
-          if(camera->shutterValueIsAngle)
-            Screen_ShutterAngle();
-          else
-            Screen_ShutterSpeed();
-          break;
-        case Screens::WhiteBalanceTint:
-          Screen_WBTint();
-          break;
-        case Screens::Codec:
-          Screen_Codec();
-          break;
-        case Screens::Resolution:
-          Screen_Resolution();
-          break;
-        case Screens::Media:
-          Screen_Media();
-          break;
+        // Taps wait for the slide to finish
+        if(Screen_Slide())
+          inputConsumed = false;
+        else
+        {
+          Screen_Render();
+          currentScreenCached = false;
+        }
       }
 
     }
     else
       Screen_Dashboard(true); // Was on disconnected screen, now we're connected go to the dashboard
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningFound)
   {
     Screen_NoConnection();
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningNoneFound)
   {
     DEBUG_VERBOSE("Status Scanning NONE Found. Marking as Disconnected.");
     cameraConnection.status = BMDCameraConnection::Disconnected;
-    lastConnectedTime = currentTime;
 
     Screen_NoConnection();
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
   {
-    // Pass Key failed, so show it and then delay for 2 seconds and reset status to disconnected.
+    // Pass Key failed, shown until reconnectDue() resets it to disconnected
     Screen_NoConnection();
-
-    delay(2000);
-
-    cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected;
   }
 
   // Reset tapped point
-  tapped_x = -1;
-  tapped_y = -1;
-
+  if(inputConsumed)
+  {
+    tapped_x = -1;
+    tapped_y = -1;
+  }
 
-  // Is there a touch event available?
+  // Is there a touch event available? Every report goes to the gesture engine, the finger lifting is also a tap or swipe.
+  bool touchLifted = false;
+  byte touchGesture = CST816S::GESTURE::NONE;
+  int oriented_x = -1;
+  int oriented_y = -1;
   if (touch.available()) {
 
-    // We only consider events when the finger has lifted up (rather than pressed down or held)
-    if(touch.data.eventID == CST816S::TOUCHEVENT::UP)
+    oriented_x = IWIDTH - touch.data.y;
+    oriented_y = touch.data.x;
+
+    touchLifted = touch.data.eventID == CST816S::TOUCHEVENT::UP;
+    touchGesture = touch.data.gestureID;
+
+    TouchGestures::sample(!touchLifted, oriented_x, oriented_y, touch.data.micros);
+  }
+
+  // Drags on sliders (and a finger held still for a long press)
+  TouchGestures::Event gesture;
+  while(TouchGestures::poll(gesture))
+    Touch_Gesture(gesture);
+
+  CommandCoalescer::service();
+
+  // We only consider the touch controller's gestures when the finger has lifted up (rather than pressed down or held), and not if a
+  // slider had the touch
+  if(touchLifted)
+  {
+    if(!sliderTouch)
     {
-      int oriented_x = IWIDTH - touch.data.y;
-      int oriented_y = touch.data.x;
+      InputQueue::actionTaken(touchInput);
 
       // Display touch point
-      // tft.fillSmoothCircle(IWIDTH - touch.data.y, touch.data.x, 10, TFT_GREEN, TFT_TRANSPARENT);
+      // tft.fillSmoothCircle(oriented_x, oriented_y, 10, TFT_GREEN, TFT_TRANSPARENT);
 
-      switch(touch.data.gestureID)
+      switch(touchGesture)
       {
         case CST816S::GESTURE::SWIPE_DOWN:
           DEBUG_INFO("Swipe Right");
@@ -2734,28 +2118,28 @@ void loop() {
           switch(connectedScreenIndex)
           {
             case Screens::Dashboard:
-              Screen_Recording(true);
+              Screen_SwipeTo(Screens::Recording, true);
               break;
             case Screens::Recording:
-              Screen_ISO(true);
+              Screen_SwipeTo(Screens::ISO, true);
               break;
             case Screens::ISO:
-              if(BMDControlSystem::getInstance()->getCamera()->shutterValueIsAngle)
-                Screen_ShutterAngle(true);
-              else
-                Screen_ShutterSpeed(true);
+              Screen_SwipeTo(Screens::ShutterAngleSpeed, true);
               break;
             case Screens::ShutterAngleSpeed:
-              Screen_WBTint(true);
+              Screen_SwipeTo(Screens::WhiteBalanceTint, true);
               break;
             case Screens::WhiteBalanceTint:
-              Screen_Codec(true);
+              Screen_SwipeTo(Screens::Codec, true);
               break;
             case Screens::Codec:
-              Screen_Resolution(true);
+              Screen_SwipeTo(Screens::Resolution, true);
               break;
             case Screens::Resolution:
-              Screen_Media(true);
+              Screen_SwipeTo(Screens::Media, true);
+              break;
+            case Screens::Media:
+              Screen_SwipeTo(Screens::Looks, true);
               break;
           }
           break;
@@ -2764,41 +2148,41 @@ void loop() {
           // Swiping Left  (sideways), going back through the menus
           switch(connectedScreenIndex)
           {
+            case Screens::Looks:
+              Screen_SwipeTo(Screens::Media, false);
+              break;
             case Screens::Media:
-              Screen_Resolution(true);
+              Screen_SwipeTo(Screens::Resolution, false);
               break;
             case Screens::Resolution:
-              Screen_Codec(true);
+              Screen_SwipeTo(Screens::Codec, false);
               break;
             case Screens::Codec:
-              Screen_WBTint(true);
+              Screen_SwipeTo(Screens::WhiteBalanceTint, false);
               break;
             case Screens::WhiteBalanceTint:
-              if(BMDControlSystem::getInstance()->getCamera()->shutterValueIsAngle)
-                Screen_ShutterAngle(true);
-              else
-                Screen_ShutterSpeed(true);
+              Screen_SwipeTo(Screens::ShutterAngleSpeed, false);
               break;
             case Screens::ShutterAngleSpeed:
-              Screen_ISO(true);
+              Screen_SwipeTo(Screens::ISO, false);
               break;
             case Screens::ISO:
-              Screen_Recording(true);
+              Screen_SwipeTo(Screens::Recording, false);
               break;
             case Screens::Recording:
-              Screen_Dashboard(true);
+              Screen_SwipeTo(Screens::Dashboard, false);
               break;
           }
           break;
         case CST816S::GESTURE::SWIPE_LEFT:
           // Swipe up to recording screen
           if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && connectedScreenIndex != Screens::Recording)
-            Screen_Recording(true);
+            Screen_SwipeTo(Screens::Recording, true);
           break;
         case CST816S::GESTURE::SWIPE_RIGHT:
           // Swipe down to dashboard
           if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && connectedScreenIndex != Screens::Dashboard)
-            Screen_Dashboard(true);
+            Screen_SwipeTo(Screens::Dashboard, false);
           break;
         case CST816S::GESTURE::NONE:
           DEBUG_VERBOSE("Tap");
@@ -2809,13 +2193,27 @@ void loop() {
           break;
       }
     }
+
+    sliderTouch = false;
   }
 
-  delay(25);
+  // Idle, draw the screens a swipe away so they're ready
+  if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && static_cast<byte>(connectedScreenIndex) >= 100)
+    Screen_PrerenderNeighbours();
+
+  // Sleep until the next input sample or frame tick
+  RenderScheduler::waitForNextTick();
 
   // Keep track of the memory use to check that there aren't memory leaks (or significant memory leaks)
   if(Debug.getDebugLevel() >= DBG_VERBOSE && memoryLoopCounter++ % 4000 == 0)
   {
     DEBUG_VERBOSE("Heap Size Free: %d of %d", ESP.getFreeHeap(), ESP.getHeapSize());
+    RenderScheduler::reportStats();
+    TileCache::reportStats();
+    ScreenCache::reportStats();
+    TouchGestures::reportStats();
+    CommandCoalescer::reportStats();
+    InputQueue::reportStats();
+    LookPresets::reportStats();
   }
 }
\ No newline at end of file
@@ -1,6 +1,20 @@
 #define USING_TFT_ESPI 0    // Not using the TFT_eSPI graphics library <-- must include this in every main file, 0 = not using, 1 = using
 #define USING_M5GFX 1       // Using the M5GFX library
 #define USING_M5_BUTTONS 0  // Not using M5 physical buttons (uses touch screen)
+#define USING_DISPLAY_PRESENTER 1 // 1 = Send frames to the display over DMA from a background task, 0 = Push them directly
+#define RENDER_TARGET_FPS 30      // Most frames drawn per second, nothing is drawn while the screen is unchanged
+#define INPUT_SAMPLES_PER_SECOND 200 // How often touch is checked
+#define TILE_CACHE_BYTES (96 * 1024) // Memory for pre-drawn buttons, 0 = draw them every time
+#define SCREEN_CACHE_FRAMES 4     // Screens kept drawn in PSRAM (this one and the bottom buttons' screens), 0 = draw them each time
+#define SCREEN_PRERENDER_MS 250   // The bottom buttons' screens are redrawn at most this often while the camera is changing
+#define USING_LVGL 0              // EXPERIMENTAL, not yet run on a camera: 1 = Connected screens are LVGL widgets (Boards/M5CoreS3/m5gfx_lvgl), 0 = Sprite screens
+#define FOCUS_UNITS_PER_PIXEL 100 // Focus moved for each pixel dragged along the lens screen's focus strip, 65435 is the lens' full range
+#define POWER_POLL_MS 2000        // How often the CoreS3's own battery level is read
+#define RACK_FOCUS_A 0.2f         // The lens screen's rack button moves the focus between these, 0.0 (near) to 1.0 (far)
+#define RACK_FOCUS_B 0.8f
+#define RACK_FOCUS_MS 3000        // How long a rack takes, along an S-curve
+#define TIMELINE_PATH "/timeline.txt" // Keyframes played by the recording screen's timeline button, see Camera/Timeline.h for the format
+#define TIMELINE_START_ON_RECORD 1    // 1 = The timeline also starts when the camera starts recording, 0 = Only from its button or serial
 
 #include <Arduino.h>
 #include <string.h>
@@ -14,10 +28,43 @@
 #include "CCU/CCUPacketTypes.h"
 #include "CCU/CCUValidationFunctions.h"
 #include "Camera/BMDCameraConnection.h"
+#include "Camera/LinkHealthMonitor.h"
+#include "Camera/CommandCoalescer.h"
+#include "Camera/MotionEngine.h"
+#include "Camera/Timeline.h"
+#include "Camera/ExposureEngine.h"
+#include "Camera/SpeedRamp.h"
+#include "Camera/LookPresets.h"
 #include "Camera/BMDCamera.h"
 #include "BMDControlSystem.h"
 
-// Include the watchdog library so we can stop it timing out while pass key entry.
+// UI
+#include "UI/DirtyRegion.h"
+#include "UI/ValueWidget.h"
+#include "UI/RenderStats.h"
+#include "UI/DisplayPresenter.h"
+#include "UI/RenderScheduler.h"
+#include "UI/UIScreen.h"
+#include "UI/ISOScreen.h"
+#include "UI/ShutterAngleScreen.h"
+#include "UI/ShutterSpeedScreen.h"
+#include "UI/WhiteBalanceScreen.h"
+#include "UI/CodecScreen.h"
+#include "UI/ResolutionScreen.h"
+#include "UI/MediaScreen.h"
+#include "UI/TileCache.h"
+#include "UI/ScreenCache.h"
+#include "UI/TouchGestures.h"
+#include "UI/ParameterSlider.h"
+
+// Touch, the encoder unit and the power chip are read on a background task
+#include "ESP32/I2CScheduler.h"
+
+#if USING_LVGL == 1
+  #include "Boards/M5CoreS3/m5gfx_lvgl/LVGLScreens.h"
+#endif
+
+// Include the watchdog library to set its timeout
 #include "esp_task_wdt.h"
 
 // Sprite width and height (S3 can do 16BPP)
@@ -29,14 +76,18 @@
 // https://shop.m5stack.com/products/encoder-unit
 // IMPORTANT - THE ENCODER MUST BE PLUGGED INTO PORT "A" ON THE M5Stack CoreS3 - that is the port next to the USB-C port.
 #define USING_M5_ENCODER 0   // Using the M5Stack Encoder unit, 1 = Yes, 0 = No
+#define ENCODER_SAMPLES_PER_SECOND 100    // How often the encoder is read, every step is counted however quickly it's turned
+#define ENCODER_FAST_STEPS_PER_SECOND 30  // Free focus, turning this fast or faster moves ENCODER_MAX_MULTIPLIER times further a step
+#define ENCODER_MAX_MULTIPLIER 8.0f
 
 // If you have the encoder unit
 #if USING_M5_ENCODER == 1
     #include "Boards/M5CoreS3/Unit_Encoder.h"
+    #include "UI/RotaryAccelerator.h"
     Unit_Encoder encoderSensor;
 
     signed short int prevEncoderValue = 0; // Value of the encoder
-    unsigned long lastEncoderValueTime = millis(); // Last time we got the encoder value
+    signed short int encoderValue = 0; // Latest value read by the I2C scheduler
     unsigned short prevFocusPosition = 0; // Stores the last sent focus position (0-65535)
 
     bool freeFocus = true;  // Free Focus doesn't use the range of focus, it just sends focus offsets.
@@ -45,11 +96,13 @@
                             // Pocket 6K worked with actual lens position sets so focus range is better but can use offsets
 
     // Free-focus variables
-    unsigned short freeFocusIncrement = 1000; // How much we move when rotating - larger moves further for each rotation step
+    unsigned short freeFocusIncrement = 1000; // How much we move for each rotation step when turning slowly - larger moves further
+                                              // Turning faster moves further for each step (ENCODER_MAX_MULTIPLIER)
                                               // You may need to experiment with the lens(es) you use
                                               // Examples of values
                                               // 150 for URSA Mini Pro G2 with Canon 50mm f/1.2
                                               // 1000 for Pocket 6K and Canon EF-S 18-55 f/3.5-5.6 II
+    RotaryAccelerator focusAccelerator(freeFocusIncrement, ENCODER_FAST_STEPS_PER_SECOND, ENCODER_MAX_MULTIPLIER);
 
     // Range-based variables
     unsigned short encoderRange = 90; // A full rotation is 60 steps on the M5Stack encoder, the higher the value the more turning to focus
@@ -61,6 +114,19 @@
 
 #endif
 
+// Packet capture, records all camera traffic to the FFat partition so an issue can be replayed later (see tools/mpc_capture.py)
+#define USING_PACKET_RECORDER 0   // 1 = Record to /capture.mpc while connected, 0 = No
+#define USING_PACKET_REPLAY 0     // 1 = Replay /capture.mpc instead of connecting to a camera, 0 = No
+#define PACKET_REPLAY_SPEED 1.0f  // 1.0 = Original timing, 10.0 = ten times faster, 0 = As fast as possible
+
+#if USING_PACKET_RECORDER == 1
+    #include "Camera/PacketRecorder.h"
+#endif
+
+#if USING_PACKET_REPLAY == 1
+    #include "Camera/PacketReplayer.h"
+#endif
+
 // Based on M5CoreS3 Demo - M5 libraries
 #include <nvs_flash.h>
 #include "Boards/M5CoreS3/config.h"
@@ -122,7 +188,8 @@ enum class Screens : byte
   Media = 108,
   Lens = 109,
   Slate = 110,
-  Project = 111
+  Project = 111,
+  Looks = 112
 };
 
 Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen we're on:
@@ -138,6 +205,7 @@ Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen
 // 107 is Resolution (one for each camera group, 4K, 6K/G2/Pro, Mini Pro G2, Mini Pro 12K)
 // 108 is Media
 // 109 is Lens
+// 112 is Looks
 
 // Keep track of the last camera modified time that we refreshed a screen so we don't keep refreshing a screen when the camera object remains unchanged.
 static unsigned long lastRefreshedScreen = 0;
@@ -145,6 +213,244 @@ static unsigned long lastRefreshedScreen = 0;
 int tapped_x = -1;
 int tapped_y = -1;
 
+// Dragging the Kelvin and tint values sideways changes them, 20K and 0.4 a pixel
+ParameterSlider whiteBalanceSlider(160, 75, 90, 40, 2500, 10000, 50, 20.0f);
+ParameterSlider tintSlider(160, 120, 90, 40, -50, 50, 1, 0.4f);
+
+// Dragging along this strip on the lens screen moves the focus
+UIRect focusStrip(200, 130, 115, 38);
+bool focusDragging = false;
+
+// Racks the focus from one mark to the other, then back again
+UIRect rackButton(200, 172, 115, 38);
+bool rackToB = false;
+
+// Plays the timeline, or stops it
+UIRect timelineButton(200, 150, 115, 38);
+bool timelineWasRecording = false; // To start the timeline as the camera starts recording
+
+// The looks screen, from the recording screen. Tapping SAVE and then a look saves the camera's settings into it.
+UIRect looksButton(30, 172, 160, 34);
+UIRect looksSaveButton(230, 4, 85, 26);
+bool looksSaving = false;
+
+// Serial commands, "(COMMAND:VALUE)" as the TouchDesigner version takes them
+std::string serialCommand = "";
+bool serialCommandStarted = false;
+
+bool sliderTouch = false; // The current touch belongs to a slider, it isn't a tap
+short lastTouchX = 0;     // Where the finger was last reported, the panel doesn't say where it lifted
+short lastTouchY = 0;
+
+// The I2C devices, read on the I2C scheduler's task
+byte touchDevice = 0;
+byte powerDevice = 0;
+byte coreBatteryLevel = 0; // The CoreS3's own battery, percent
+
+// First finger only, down then x and y
+int I2C_ReadTouch(byte* data)
+{
+  lgfx::touch_point_t tp[1];
+  int nums = M5.Display.getTouchRaw(tp, 1);
+
+  if(nums == 0)
+    tp[0].x = tp[0].y = 0;
+
+  data[0] = nums > 0 ? 1 : 0;
+  memcpy(&data[1], &tp[0].x, sizeof(tp[0].x));
+  memcpy(&data[3], &tp[0].y, sizeof(tp[0].y));
+
+  return 5;
+}
+
+// Battery level and whether it's charging
+int I2C_ReadPower(byte* data)
+{
+  int level = M5.Power.getBatteryLevel();
+  if(level < 0)
+    return -1;
+
+  data[0] = static_cast<byte>(level);
+  data[1] = M5.Power.isCharging() == m5::Power_Class::is_charging ? 1 : 0;
+
+  return 2;
+}
+
+#if USING_M5_ENCODER == 1
+  byte encoderDevice = 0;
+
+  int I2C_ReadEncoder(byte* data)
+  {
+    signed short int value = encoderSensor.getEncoderValue();
+    memcpy(data, &value, sizeof(value));
+
+    return sizeof(value);
+  }
+
+  // Queued with the left and right LEDs' colours
+  void I2C_WriteEncoderLEDs(const byte* data, byte length)
+  {
+    uint32_t left, right;
+    memcpy(&left, &data[0], 4);
+    memcpy(&right, &data[4], 4);
+
+    encoderSensor.setLEDColor(1, left);
+    encoderSensor.setLEDColor(2, right);
+  }
+
+  // Only changes are queued, the range mode sets them on every step
+  void Encoder_SetLEDs(uint32_t left, uint32_t right)
+  {
+    static uint32_t lastLeft = 0xFFFFFFFF;
+    static uint32_t lastRight = 0xFFFFFFFF;
+    if(left == lastLeft && right == lastRight)
+      return;
+
+    lastLeft = left;
+    lastRight = right;
+
+    byte data[8];
+    memcpy(&data[0], &left, 4);
+    memcpy(&data[4], &right, 4);
+
+    I2CScheduler::write(encoderDevice, I2C_WriteEncoderLEDs, data, sizeof(data));
+  }
+#endif
+
+#if USING_LVGL == 1
+  // LVGL takes the touch the scheduler has already read
+  bool LVGL_ReadTouch(lv_coord_t* x, lv_coord_t* y)
+  {
+    I2CScheduler::Event touch;
+    if(!I2CScheduler::latest(touchDevice, touch) || touch.data[0] == 0)
+      return false;
+
+    short touchX, touchY;
+    memcpy(&touchX, &touch.data[1], sizeof(touchX));
+    memcpy(&touchY, &touch.data[3], sizeof(touchY));
+    *x = touchX;
+    *y = touchY;
+
+    return true;
+  }
+#endif
+
+// Display presenter backend, bands go out with DMA. Transfers are kept in one write transaction as ending it waits for the DMA.
+void Presenter_BeginTransfers()
+{
+  M5.Display.startWrite();
+}
+
+void Presenter_Transfer(short x, short y, short w, short h, const uint16_t* pixels)
+{
+  M5.Display.pushImageDMA(x, y, w, h, reinterpret_cast<const lgfx::swap565_t*>(pixels));
+}
+
+bool Presenter_Busy()
+{
+  return M5.Display.dmaBusy();
+}
+
+void Presenter_EndTransfers()
+{
+  M5.Display.endWrite();
+}
+
+// Drawing a screen into the screen cache, it isn't sent to the display
+bool screenPrerendering = false;
+
+// Sends the whole frame to the display
+void Screen_Present()
+{
+  if(screenPrerendering)
+    return;
+
+  if(DisplayPresenter::isStarted())
+    DisplayPresenter::presentFull(sprite->getBuffer());
+  else
+    sprite->pushSprite(0, 0);
+}
+
+// Shared UI (UI/UIScreen.h) drawing for this display
+uint32_t UI_Colour(UIColour colour)
+{
+  switch(colour)
+  {
+    case UIColour::Text:
+      return TFT_WHITE;
+    case UIColour::Button:
+      return TFT_DARKGREY;
+    case UIColour::ButtonSelected:
+      return TFT_DARKGREEN;
+    case UIColour::Alert:
+      return TFT_RED;
+    default:
+      return TFT_BLACK;
+  }
+}
+
+void UI_FillRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  sprite->fillSmoothRoundRect(x, y, w, h, radius, UI_Colour(colour));
+}
+
+void UI_DrawRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  sprite->drawRoundRect(x, y, w, h, radius, UI_Colour(colour));
+}
+
+void UI_DrawText(const char* text, short x, short y, UITextStyle style, UITextAlign align, UIColour background)
+{
+  const GFXfont* font = &Lato_Regular11pt7b;
+  if(style == UITextStyle::Title)
+    font = &AgencyFB_Bold9pt7b;
+  else if(style == UITextStyle::Caption)
+    font = &Lato_Regular5pt7b;
+
+  // Text is drawn with a transparent background on these displays
+  sprite->setTextColor(TFT_WHITE);
+  sprite->setTextDatum(align == UITextAlign::Centre ? MC_DATUM : TL_DATUM);
+  sprite->drawString(text, x, y, font);
+  sprite->setTextDatum(TL_DATUM);
+}
+
+// Images named by the shared screens' icon buttons, with the version drawn on the selected button colour
+struct UIIcon
+{
+  const char* name;
+  const unsigned short* image;
+  const unsigned short* selectedImage;
+};
+
+const UIIcon uiIcons[] =
+{
+  { "WBBright", WBBright, WBBrightBG },
+  { "WBIncandescent", WBIncandescent, WBIncandescentBG },
+  { "WBFlourescent", WBFlourescent, WBFlourescentBG },
+  { "WBMixedLight", WBMixedLight, WBMixedLightBG },
+  { "WBCloud", WBCloud, WBCloudBG }
+};
+
+void UI_DrawIcon(const char* name, short x, short y, bool selected)
+{
+  for(const UIIcon& icon : uiIcons)
+  {
+    // Icons are 30 x 30, x and y are the middle
+    if(strcmp(icon.name, name) == 0)
+    {
+      sprite->pushImage(x - 15, y - 15, 30, 30, selected ? icon.selectedImage : icon.image);
+      return;
+    }
+  }
+}
+
+uint8_t* UI_FrameBuffer()
+{
+  return static_cast<uint8_t*>(sprite->getBuffer());
+}
+
+const UIBackend uiBackend = { UI_FillRoundRect, UI_DrawText, UI_DrawRoundRect, UI_DrawIcon, UI_FrameBuffer, IWIDTH_SPRITE, IHEIGHT_SPRITE, BPP_SPRITE / 8 };
+
 // Display elements on the screen common to all pages
 void Screen_Common(int sideBarColour)
 {
@@ -176,11 +482,20 @@ void Screen_Common(int sideBarColour)
     }
 }
 
+// Sidebar is grey until we have the camera's details, then shows the health of the link
+int Screen_Common_ConnectedSideBarColour()
+{
+  if(cameraConnection.getInitialPayloadTime() >= millis())
+    return TFT_DARKGREY;
+
+  return LinkHealthMonitor::getSidebarColour(LinkHealthMonitor::getLevel());
+}
+
 void Screen_Common_Connected()
 {
   if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera())
   {
-    Screen_Common(cameraConnection.getInitialPayloadTime() < millis() ? TFT_GREEN : TFT_DARKGREY);
+    Screen_Common(Screen_Common_ConnectedSideBarColour());
 
     // Show the recording outline
     if(BMDControlSystem::getInstance()->getCamera()->isRecording)
@@ -294,16 +609,54 @@ void Screen_NoConnection()
 
   if(connectToCameraIndex != -1)
   {
-    cameraConnection.connect(cameraConnection.cameraAddresses[connectToCameraIndex]);
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[connectToCameraIndex]);
     connectToCameraIndex = -1;
+  }
+
+  Screen_Present();
+}
+
+// Pushes only the changed areas of the sprite to the display, clipping the push to each area
+void Screen_PushRegion(const DirtyRegion& region)
+{
+  if(screenPrerendering)
+    return;
 
-  if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
+  if(DisplayPresenter::isStarted())
+    DisplayPresenter::present(sprite->getBuffer(), region);
+  else if(region.isFull())
+    sprite->pushSprite(0, 0);
+  else
+  {
+    for(byte index = 0; index < region.getCount(); index++)
     {
-      DEBUG_DEBUG("NoConnection - Failed Pass Key");
+      const UIRect& rect = region.getRect(index);
+      M5.Display.setClipRect(rect.x, rect.y, rect.w, rect.h);
+      sprite->pushSprite(0, 0);
     }
+
+    M5.Display.clearClipRect();
   }
+}
 
-  sprite->pushSprite(0, 0);
+// Dashboard tiles, each is only redrawn and pushed to the display when what it shows changes. One showing what it has shown before
+// is copied from UI/TileCache rather than drawn (the lens tile has the render stats in it, so it changes too often to be worth keeping).
+DirtyRegion dashboardRegion(IWIDTH, IHEIGHT);
+ValueWidget dashboardISO(20, 5, 75, 65);
+ValueWidget dashboardShutter(100, 5, 75, 65);
+ValueWidget dashboardWBTint(180, 5, 135, 65);
+ValueWidget dashboardCodec(20, 75, 155, 40);
+ValueWidget dashboardFramerate(180, 75, 135, 40);
+ValueWidget dashboardMedia(20, 120, 100, 40);
+ValueWidget dashboardResolution(125, 120, 190, 40);
+ValueWidget dashboardLens(20, 165, 295, 40);
+ValueWidget* dashboardWidgets[] = { &dashboardISO, &dashboardShutter, &dashboardWBTint, &dashboardCodec, &dashboardFramerate, &dashboardMedia, &dashboardResolution, &dashboardLens };
+std::string dashboardFrameValue; // Sidebar colour and recording button
+
+void Screen_Dashboard_ClearTile(const ValueWidget& widget)
+{
+  const UIRect& rect = widget.getRect();
+  sprite->fillRect(rect.x, rect.y, rect.w, rect.h, TFT_BLACK);
 }
 
 // Default screen for connected state
@@ -312,6 +665,9 @@ void Screen_Dashboard(bool forceRefresh = false)
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
 
+  // Another screen has drawn over the dashboard (screen changes reset lastRefreshedScreen)
+  bool fromOtherScreen = connectedScreenIndex != Screens::Dashboard || lastRefreshedScreen == 0;
+
   connectedScreenIndex = Screens::Dashboard;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
@@ -390,82 +746,136 @@ void Screen_Dashboard(bool forceRefresh = false)
 
   // DEBUG_DEBUG("Screen Dashboard Refreshing.");
 
-  if(!sprite->createSprite(IWIDTH_SPRITE, IHEIGHT_SPRITE)) return;
+  // Redraw everything when coming from another screen or when the sidebar or record button changes, otherwise only the tiles that changed
+  std::string frameValue = std::to_string(Screen_Common_ConnectedSideBarColour()) + (camera->isRecording ? "R" : "");
+  bool fullRedraw = forceRefresh || fromOtherScreen || frameValue != dashboardFrameValue || sprite->getBuffer() == nullptr;
 
-  if(cameraConnection.getInitialPayloadTime() != ULONG_MAX)
-    sprite->fillSprite(TFT_BLACK);
+  RenderStats::beginFrame();
+  dashboardRegion.clear();
 
-  Screen_Common_Connected(); // Common elements
+  if(fullRedraw)
+  {
+    if(!sprite->createSprite(IWIDTH_SPRITE, IHEIGHT_SPRITE)) return;
 
-  // M5GFX, set font here rather than on each drawString line
-  sprite->setFont(&Lato_Regular11pt7b);
+    if(cameraConnection.getInitialPayloadTime() != ULONG_MAX)
+      sprite->fillSprite(TFT_BLACK);
+
+    Screen_Common_Connected(); // Common elements
+
+    for(auto widget : dashboardWidgets)
+      widget->invalidate();
+
+    dashboardRegion.markFull();
+    dashboardFrameValue = frameValue;
+  }
+
+  // M5GFX, the font is passed on each drawString line as a tile may be drawn on its own
+  sprite->setTextColor(TFT_WHITE);
 
   // ISO
-  if(camera->hasSensorGainISOValue())
+  std::string isoValue = camera->hasSensorGainISOValue() ? std::to_string(camera->getSensorGainISOValue()) : "";
+  if(dashboardISO.update(isoValue, dashboardRegion) && !dashboardISO.drawCached(uiBackend))
   {
-    sprite->fillSmoothRoundRect(20, 5, 75, 65, 3, TFT_DARKGREY);
-    sprite->setTextColor(TFT_WHITE);
+    Screen_Dashboard_ClearTile(dashboardISO);
+
+    if(!isoValue.empty())
+    {
+      sprite->fillSmoothRoundRect(20, 5, 75, 65, 3, TFT_DARKGREY);
+
+      sprite->drawCentreString(isoValue.c_str(), 58, 23, &Lato_Regular11pt7b);
 
-    sprite->drawCentreString(String(camera->getSensorGainISOValue()), 58, 23);
+      sprite->drawCentreString("ISO", 58, 50, &AgencyFB_Regular7pt7b);
+    }
 
-    sprite->drawCentreString("ISO", 58, 50, &AgencyFB_Regular7pt7b);
+    dashboardISO.storeCached(uiBackend);
   }
 
   // Shutter
   xshift = 80;
+  String shutterValue;
   if(camera->hasShutterAngle())
   {
-    sprite->fillSmoothRoundRect(20 + xshift, 5, 75, 65, 3, TFT_DARKGREY);
-    sprite->setTextColor(TFT_WHITE);
-
     if(camera->shutterValueIsAngle)
     {
       // Shutter Angle
       int currentShutterAngle = camera->getShutterAngle();
       float ShutterAngleFloat = currentShutterAngle / 100.0;
 
-      sprite->drawCentreString(String(ShutterAngleFloat, (currentShutterAngle % 100 == 0 ? 0 : 1)), 58 + xshift, 23);
+      shutterValue = String(ShutterAngleFloat, (currentShutterAngle % 100 == 0 ? 0 : 1));
     }
     else
     {
       // Shutter Speed
       int currentShutterSpeed = camera->getShutterSpeed();
 
-      sprite->drawCentreString("1/" + String(currentShutterSpeed), 58 + xshift, 23);
+      shutterValue = "1/" + String(currentShutterSpeed);
+    }
+  }
+
+  if(dashboardShutter.update(shutterValue.c_str(), dashboardRegion) && !dashboardShutter.drawCached(uiBackend))
+  {
+    Screen_Dashboard_ClearTile(dashboardShutter);
+
+    if(camera->hasShutterAngle())
+    {
+      sprite->fillSmoothRoundRect(20 + xshift, 5, 75, 65, 3, TFT_DARKGREY);
+
+      sprite->drawCentreString(shutterValue, 58 + xshift, 23, &Lato_Regular11pt7b);
+
+      sprite->drawCentreString(camera->shutterValueIsAngle ? "DEGREES" : "SPEED", 58 + xshift, 50, &AgencyFB_Regular7pt7b); //  "SHUTTER"
     }
 
-    sprite->drawCentreString(camera->shutterValueIsAngle ? "DEGREES" : "SPEED", 58 + xshift, 50, &AgencyFB_Regular7pt7b); //  "SHUTTER"
+    dashboardShutter.storeCached(uiBackend);
   }
 
   // WhiteBalance and Tint
   xshift += 80;
+  std::string wbTintValue;
   if(camera->hasWhiteBalance() || camera->hasTint())
+    wbTintValue = (camera->hasWhiteBalance() ? std::to_string(camera->getWhiteBalance()) : "-") + "/" + (camera->hasTint() ? std::to_string(camera->getTint()) : "-");
+
+  if(dashboardWBTint.update(wbTintValue, dashboardRegion) && !dashboardWBTint.drawCached(uiBackend))
   {
-    sprite->fillSmoothRoundRect(20 + xshift, 5, 135, 65, 3, TFT_DARKGREY);
-    sprite->setTextColor(TFT_WHITE);
+    Screen_Dashboard_ClearTile(dashboardWBTint);
+
+    if(!wbTintValue.empty())
+    {
+      sprite->fillSmoothRoundRect(20 + xshift, 5, 135, 65, 3, TFT_DARKGREY);
+
+      if(camera->hasWhiteBalance())
+        sprite->drawCentreString(String(camera->getWhiteBalance()), 58 + xshift, 23, &Lato_Regular11pt7b);
 
-    if(camera->hasWhiteBalance())
-      sprite->drawCentreString(String(camera->getWhiteBalance()), 58 + xshift, 23);
+      sprite->drawCentreString("WB", 58 + xshift, 50, &AgencyFB_Regular7pt7b);
 
-    sprite->drawCentreString("WB", 58 + xshift, 50, &AgencyFB_Regular7pt7b);
+      xshift += 66;
 
-    xshift += 66;
+      if(camera->hasTint())
+        sprite->drawCentreString(String(camera->getTint()), 58 + xshift, 23, &Lato_Regular11pt7b);
 
-    if(camera->hasTint())
-      sprite->drawCentreString(String(camera->getTint()), 58 + xshift, 23);
+      sprite->drawCentreString("TINT", 58 + xshift, 50, &AgencyFB_Regular7pt7b);
+    }
 
-    sprite->drawCentreString("TINT", 58 + xshift, 50, &AgencyFB_Regular7pt7b);
+    dashboardWBTint.storeCached(uiBackend);
   }
 
   // Codec
-  if(camera->hasCodec())
+  std::string codecValue = camera->hasCodec() ? camera->getCodec().to_string() : "";
+  if(dashboardCodec.update(codecValue, dashboardRegion) && !dashboardCodec.drawCached(uiBackend))
   {
-    sprite->fillSmoothRoundRect(20, 75, 155, 40, 3, TFT_DARKGREY);
+    Screen_Dashboard_ClearTile(dashboardCodec);
 
-    sprite->drawCentreString(camera->getCodec().to_string().c_str(), 97, 84);
+    if(camera->hasCodec())
+    {
+      sprite->fillSmoothRoundRect(20, 75, 155, 40, 3, TFT_DARKGREY);
+
+      sprite->drawCentreString(codecValue.c_str(), 97, 84, &Lato_Regular11pt7b);
+    }
+
+    dashboardCodec.storeCached(uiBackend);
   }
 
   // Media
+  std::string mediaValue;
   if(camera->getMediaSlots().size() != 0)
   {
     std::string slotString;
@@ -495,59 +905,108 @@ void Screen_Dashboard(bool forceRefresh = false)
       }
     }
 
-    if(!slotString.empty())
-    {
-      sprite->fillSmoothRoundRect(20, 120, 100, 40, 3, TFT_DARKGREY);
+    // Recording error is part of the value as it changes the tile's outline
+    mediaValue = slotString.empty() ? "NO MEDIA" : slotString + (camera->hasRecordError() ? "!" : "");
+  }
 
-      sprite->drawCentreString(slotString.c_str(), 70, 130);
+  if(dashboardMedia.update(mediaValue, dashboardRegion) && !dashboardMedia.drawCached(uiBackend))
+  {
+    Screen_Dashboard_ClearTile(dashboardMedia);
 
-      // Show recording error
-      if(camera->hasRecordError())
-        sprite->drawRoundRect(20, 120, 100, 40, 3, TFT_RED);
-    }
-    else
+    if(!mediaValue.empty())
     {
-      // Show no Media
       sprite->fillSmoothRoundRect(20, 120, 100, 40, 3, TFT_DARKGREY);
-      sprite->drawCentreString("NO MEDIA", 70, 135, &AgencyFB_Regular7pt7b);
+
+      if(mediaValue != "NO MEDIA")
+      {
+        sprite->drawCentreString(mediaValue.substr(0, mediaValue.find('!')).c_str(), 70, 130, &Lato_Regular11pt7b);
+
+        // Show recording error
+        if(camera->hasRecordError())
+          sprite->drawRoundRect(20, 120, 100, 40, 3, TFT_RED);
+      }
+      else
+      {
+        // Show no Media
+        sprite->drawCentreString("NO MEDIA", 70, 135, &AgencyFB_Regular7pt7b);
+      }
     }
+
+    dashboardMedia.storeCached(uiBackend);
   }
 
   // Recording Format - Frame Rate and Resolution
-  if(camera->hasRecordingFormat())
+  std::string framerateValue = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "";
+  if(dashboardFramerate.update(framerateValue, dashboardRegion) && !dashboardFramerate.drawCached(uiBackend))
   {
-    // Frame Rate
-    sprite->fillSmoothRoundRect(180, 75, 135, 40, 3, TFT_DARKGREY);
+    Screen_Dashboard_ClearTile(dashboardFramerate);
 
-    sprite->drawCentreString(camera->getRecordingFormat().frameRate_string().c_str(), 237, 84);
+    if(camera->hasRecordingFormat())
+    {
+      // Frame Rate
+      sprite->fillSmoothRoundRect(180, 75, 135, 40, 3, TFT_DARKGREY);
 
-    sprite->drawCentreString("fps", 285, 89, &AgencyFB_Regular7pt7b);
+      sprite->drawCentreString(framerateValue.c_str(), 237, 84, &Lato_Regular11pt7b);
 
-    // Resolution
-    sprite->fillSmoothRoundRect(125, 120, 190, 40, 3, TFT_DARKGREY);
+      sprite->drawCentreString("fps", 285, 89, &AgencyFB_Regular7pt7b);
+    }
 
-    std::string resolution = camera->getRecordingFormat().frameDimensionsShort_string();
-    sprite->drawCentreString(resolution.c_str(), 220, 130);
+    dashboardFramerate.storeCached(uiBackend);
   }
 
-  // Lens
-  if(camera->hasHasLens())
+  std::string resolutionValue = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameDimensionsShort_string() : "";
+  if(dashboardResolution.update(resolutionValue, dashboardRegion) && !dashboardResolution.drawCached(uiBackend))
   {
-    // Lens
-    sprite->fillSmoothRoundRect(20, 165, 295, 40, 3, TFT_DARKGREY);
+    Screen_Dashboard_ClearTile(dashboardResolution);
 
-    if(camera->hasFocalLengthMM() && camera->hasApertureFStopString())
+    if(camera->hasRecordingFormat())
     {
-      auto focalLength = camera->getFocalLengthMM();
-      std::string focalLengthMM = std::to_string(focalLength);
-      std::string combined = focalLengthMM + "mm";
+      // Resolution
+      sprite->fillSmoothRoundRect(125, 120, 190, 40, 3, TFT_DARKGREY);
+
+      sprite->drawCentreString(resolutionValue.c_str(), 220, 130, &Lato_Regular11pt7b);
+    }
+
+    dashboardResolution.storeCached(uiBackend);
+  }
+
+  // Lens, while recording the right of the tile compares drawing and pushing only the changed tiles against full frames
+  std::string lensValue;
+  if(camera->hasHasLens() && camera->hasFocalLengthMM() && camera->hasApertureFStopString())
+    lensValue = std::to_string(camera->getFocalLengthMM()) + "mm|" + camera->getApertureFStopString();
+
+  std::string renderStatsValue = camera->isRecording ? RenderStats::getSummary().c_str() : "";
+  if(dashboardLens.update((camera->hasHasLens() ? "L" : "") + lensValue + "|" + renderStatsValue, dashboardRegion))
+  {
+    Screen_Dashboard_ClearTile(dashboardLens);
+
+    if(camera->hasHasLens())
+    {
+      sprite->fillSmoothRoundRect(20, 165, 295, 40, 3, TFT_DARKGREY);
+
+      if(!lensValue.empty())
+      {
+        std::string combined = std::to_string(camera->getFocalLengthMM()) + "mm";
+
+        sprite->drawString(combined.c_str(), 30, 174, &Lato_Regular11pt7b);
+        sprite->drawString(camera->getApertureFStopString().c_str(), 100, 174, &Lato_Regular11pt7b);
+      }
+    }
 
-      sprite->drawString(combined.c_str(), 30, 174);
-      sprite->drawString(camera->getApertureFStopString().c_str(), 100, 174);
+    if(!renderStatsValue.empty())
+    {
+      sprite->setTextColor(TFT_LIGHTGREY);
+      sprite->drawRightString(renderStatsValue.c_str(), 308, 180, &AgencyFB_Regular7pt7b);
+      sprite->setTextColor(TFT_WHITE);
     }
   }
 
-  sprite->pushSprite(0, 0);
+  if(dashboardRegion.isEmpty())
+    return;
+
+  Screen_PushRegion(dashboardRegion);
+
+  RenderStats::endFrame(dashboardRegion.getPushBytes(), dashboardRegion.isFull());
 }
 
 
@@ -584,6 +1043,24 @@ void Screen_Recording(bool forceRefresh = false)
 
       tappedAction = true;
     }
+    else if(timelineButton.contains(tapped_x, tapped_y))
+    {
+      if(Timeline::isRunning())
+        Timeline::stop();
+      else
+        Timeline::start();
+
+      sliderTouch = true; // Once for each tap, not again while the finger stays down
+      tappedAction = true;
+    }
+    else if(looksButton.contains(tapped_x, tapped_y))
+    {
+      connectedScreenIndex = Screens::Looks;
+      looksSaving = false;
+      sliderTouch = true;
+      lastRefreshedScreen = 0; // Forces a refresh
+      return;
+    }
   }
 
     // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -610,6 +1087,19 @@ void Screen_Recording(bool forceRefresh = false)
   sprite->setTextColor(camera->isRecording ? TFT_RED : TFT_WHITE);
   sprite->drawString(camera->getTimecodeString().c_str(), 30, 57);
 
+  // Timeline, greyed out when there isn't one loaded
+  bool timelineRunning = Timeline::isRunning();
+  sprite->fillSmoothRoundRect(timelineButton.x, timelineButton.y, timelineButton.w, timelineButton.h, 3, timelineRunning ? TFT_ORANGE : TFT_DARKGREY);
+  sprite->setTextColor(Timeline::getKeyframeCount() != 0 ? TFT_WHITE : TFT_LIGHTGREY);
+  sprite->drawCentreString(timelineRunning ? "STOP TIMELINE" : (Timeline::getKeyframeCount() != 0 ? "PLAY TIMELINE" : "NO TIMELINE"), timelineButton.x + timelineButton.w / 2, timelineButton.y + 12, &AgencyFB_Bold9pt7b);
+
+  // Looks, with the one the camera is on
+  int lastLook = LookPresets::getLastRecalled();
+  bool onLook = lastLook != -1 && LookPresets::matches(lastLook);
+  sprite->fillSmoothRoundRect(looksButton.x, looksButton.y, looksButton.w, looksButton.h, 3, onLook ? TFT_DARKGREEN : TFT_DARKGREY);
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawCentreString(onLook ? (std::string("LOOK: ") + LookPresets::getLook(lastLook).name).c_str() : "LOOKS", looksButton.x + looksButton.w / 2, looksButton.y + 10, &AgencyFB_Bold9pt7b);
+
   // Remaining time and any errors
   if(camera->getMediaSlots().size() != 0 && camera->hasActiveMediaSlot())
   {
@@ -626,7 +1116,7 @@ void Screen_Recording(bool forceRefresh = false)
     }
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_ISO(bool forceRefresh = false)
@@ -638,45 +1128,19 @@ void Screen_ISO(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // ISO Values, 200 / 400 / 1250 / 3200 / 8000
-
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1 && lastRefreshedScreen != 0)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      int newISO = 0;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newISO = 200;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newISO = 400;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newISO = 8000;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newISO = 640;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newISO = 800;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newISO = 12800;
+    int newISO = ISOScreen::hitTest(tapped_x, tapped_y);
 
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newISO = 1250;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newISO = 3200;
-
-      if(newISO != 0)
-      {
-        // ISO selected, send it to the camera
-        PacketWriter::writeISO(newISO, &cameraConnection);
+    if(newISO != 0)
+    {
+      // ISO selected, send it to the camera
+      PacketWriter::writeISO(newISO, &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
-
   }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -691,76 +1155,16 @@ void Screen_ISO(bool forceRefresh = false)
 
   Screen_Common_Connected(); // Common elements
 
-  // M5GFX, set font here rather than on each drawString line
-  sprite->setFont(&Lato_Regular11pt7b);
-
   // Get the current ISO value
   int currentISO = 0;
   if(camera->hasSensorGainISOValue())
     currentISO = camera->getSensorGainISOValue();
 
-  // ISO label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("ISO", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // sprite->textbgcolor = TFT_DARKGREY;
-
-  // 200
-  int labelISO = 200;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 41);
-
-  // 400
-  labelISO = 400;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 36);
-  sprite->drawCentreString("NATIVE", 160, 59, &Lato_Regular5pt7b);
-
-  // 8000
-  labelISO = 8000;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 260, 41);
-
-  // 640
-  labelISO = 640;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 87);
-
-  // 800
-  labelISO = 800;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 87);
-
-  // 12800
-  labelISO = 12800;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 260, 87);
-
-  // 1250
-  labelISO = 1250;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 131);
-
-  // 3200
-  labelISO = 3200;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 126);
-  sprite->drawCentreString("NATIVE", 160, 149, &Lato_Regular5pt7b);
-
-  // Custom ISO - show if ISO is not one of the above values
-  if(currentISO != 0)
-  {
-    // Only show the ISO value if it's not a standard one
-    if(currentISO != 200 && currentISO != 400 && currentISO != 640 && currentISO != 800 && currentISO != 1250 && currentISO != 3200 && currentISO != 8000 && currentISO != 12800)
-    {
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      // sprite->textbgcolor = TFT_DARKGREEN;
-      sprite->drawCentreString(String(currentISO).c_str(), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
+  // Buttons, labels and layout are shared (UI/ISOScreen), only the drawing is this display's
+  ISOScreen::update(currentISO);
+  ISOScreen::draw(uiBackend);
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 
@@ -773,44 +1177,20 @@ void Screen_ShutterAngle(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Shutter Angle Values: 15, 60, 90, 120, 150, 180, 270, 360, CUSTOM
   // Note that the protocol takes shutter angle times 100, so 180 = 180 x 100 = 18000. This is so it can accommodate decimal places, like 172.8 degrees = 17280 for the protocol.
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1 && lastRefreshedScreen != 0)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      int newShutterAngle = 0;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newShutterAngle = 1500;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newShutterAngle = 6000;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newShutterAngle = 9000;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newShutterAngle = 12000;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newShutterAngle = 15000;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newShutterAngle = 18000;
+    int newShutterAngle = ShutterAngleScreen::hitTest(tapped_x, tapped_y);
 
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newShutterAngle = 27000;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newShutterAngle = 36000;
-
-      if(newShutterAngle != 0)
-      {
-        // Shutter Angle selected, send it to the camera
-        PacketWriter::writeShutterAngle(newShutterAngle, &cameraConnection);
+    if(newShutterAngle != 0)
+    {
+      // Shutter Angle selected, send it to the camera
+      PacketWriter::writeShutterAngle(newShutterAngle, &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -831,67 +1211,11 @@ void Screen_ShutterAngle(bool forceRefresh = false)
   if(camera->hasShutterAngle())
     currentShutterAngle = camera->getShutterAngle();
 
-  // Shutter Angle label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("DEGREES", 265, 9, &AgencyFB_Regular7pt7b);
-  sprite->drawString("SHUTTER ANGLE", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // 15
-  int labelShutterAngle = 1500;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 41);
-
-  // 60
-  labelShutterAngle = 6000;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 41);
-
-  // 90
-  labelShutterAngle = 9000;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 41);
-
-  // 120
-  labelShutterAngle = 12000;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 87);
-
-  // 150
-  labelShutterAngle = 15000;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 87);
-
-  // 180 (with a border around it)
-  labelShutterAngle = 18000;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(210, 75, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 87);
-
-  // 270
-  labelShutterAngle = 27000;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 131);
-
-  // 360
-  labelShutterAngle = 36000;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 131);
-
-  // Custom Shutter Angle - show if not one of the above values
-  if(currentShutterAngle != 0)
-  {
-    // Only show the Shutter angle value if it's not a standard one
-    if(currentShutterAngle != 1500 && currentShutterAngle != 6000 && currentShutterAngle != 9000 && currentShutterAngle != 12000 && currentShutterAngle != 15000 && currentShutterAngle != 18000 && currentShutterAngle != 27000 && currentShutterAngle != 36000)
-    {
-      float customShutterAngle = currentShutterAngle / 100.0;
-
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString(String(customShutterAngle, (currentShutterAngle % 100 == 0 ? 0 : 1)).c_str(), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
+  // Buttons, labels and layout are shared (UI/ShutterAngleScreen), only the drawing is this display's
+  ShutterAngleScreen::update(currentShutterAngle);
+  ShutterAngleScreen::draw(uiBackend);
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_ShutterSpeed(bool forceRefresh = false)
@@ -903,46 +1227,22 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Shutter Speed Values: 1/30, 1/50, 1/60, 1/125, 1/200, 1/250, 1/500, 1/2000, CUSTOM
   // Note that the protocol takes the denominator as its parameter value. So for 1/60 we'll pass 60.
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1 && lastRefreshedScreen != 0)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 160)
+    int newShutterSpeed = ShutterSpeedScreen::hitTest(tapped_x, tapped_y);
+
+    if(newShutterSpeed != 0)
     {
-      // Tapped within the area
-      int newShutterSpeed = 0;
+      // Shutter Speed selected, send it to the camera
+      PacketWriter::writeShutterSpeed(newShutterSpeed, &cameraConnection);
 
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-        newShutterSpeed = 30;
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-        newShutterSpeed = 50;
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-        newShutterSpeed = 60;
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-        newShutterSpeed = 125;
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-        newShutterSpeed = 200;
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-        newShutterSpeed = 250;
-
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-        newShutterSpeed = 500;
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-        newShutterSpeed = 2000;
-
-      if(newShutterSpeed != 0)
-      {
-        // Shutter Speed selected, send it to the camera
-        PacketWriter::writeShutterSpeed(newShutterSpeed, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
+      tappedAction = true;
+    }
+  }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
   if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
@@ -952,7 +1252,6 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
 
   // DEBUG_DEBUG("Screen Shutter Speed Refreshed.");
 
-
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
@@ -961,72 +1260,15 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
   int currentShutterSpeed = 0;
   if(camera->hasShutterSpeed())
     currentShutterSpeed = camera->getShutterSpeed();
-  else
-    DEBUG_DEBUG("DO NOT HAVE SHUTTER SPEED!");
-
-  // Shutter Speed label
-  sprite->setTextColor(TFT_WHITE);
-
-  if(camera->hasRecordingFormat())
-  {
-    sprite->drawRightString(camera->getRecordingFormat().frameRate_string().c_str() + String(" fps"), 310, 9, &Lato_Regular5pt7b);
-  }
-
-  sprite->drawString("SHUTTER SPEED", 30, 9);
-
-  // 1/30
-  int labelShutterSpeed = 30;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 41);
-
-  // 1/50
-  labelShutterSpeed = 50;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 41);
-
-  // 1/60
-  labelShutterSpeed = 60;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 260, 41);
-
-  // 1/125
-  labelShutterSpeed = 125;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 87);
 
-  // 1/200
-  labelShutterSpeed = 200;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 87);
+  // Frame rate shown alongside, as the shutter speed is relative to it
+  std::string frameRate = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "";
 
-  // 1/250
-  labelShutterSpeed = 250;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 260, 87);
+  // Buttons, labels and layout are shared (UI/ShutterSpeedScreen), only the drawing is this display's
+  ShutterSpeedScreen::update(currentShutterSpeed, camera->hasRecordingFormat() ? frameRate.c_str() : nullptr);
+  ShutterSpeedScreen::draw(uiBackend);
 
-  // 1/500
-  labelShutterSpeed = 500;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 131);
-
-  // 1/2000
-  labelShutterSpeed = 2000;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 131);
-
-  // Custom Shutter Speed - show if not one of the above values
-  if(currentShutterSpeed != 0)
-  {
-    // Only show the Shutter Speed value if it's not a standard one
-    if(currentShutterSpeed != 30 && currentShutterSpeed != 50 && currentShutterSpeed != 60 && currentShutterSpeed != 125 && currentShutterSpeed != 200 && currentShutterSpeed != 250 && currentShutterSpeed != 500 && currentShutterSpeed != 2000)
-    {
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("1/" + String(currentShutterSpeed), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
-
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_WBTint(bool forceRefresh = false)
@@ -1051,94 +1293,28 @@ void Screen_WBTint(bool forceRefresh = false)
   if(camera->hasTint())
     currentTint = camera->getTint();
 
+  // Being dragged, show where the finger has it rather than waiting for the camera
+  if(whiteBalanceSlider.isActive())
+    currentWB = whiteBalanceSlider.getValue();
+  if(tintSlider.isActive())
+    currentTint = tintSlider.getValue();
+
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
   if(tapped_x != -1 && lastRefreshedScreen != 0)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      int newWB = 0;
-      int newTint = 0;
-
-      // Check Preset Clicks
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 90 && tapped_y <= 70)
-      {
-        // Bright
-        newWB = 5600;
-        newTint = 10;
-      }
-      else if(tapped_x >= 95 && tapped_y >= 30 && tapped_x <= 165 && tapped_y <= 70)
-      {
-        // Incandescent
-        newWB = 3200;
-        newTint = 0;
-      }
-      else if(tapped_x >= 170 && tapped_y >= 30 && tapped_x <= 240 && tapped_y <= 70)
-      {
-        // Fluorescent
-        newWB = 4000;
-        newTint = 15;
-      }
-      else if(tapped_x >= 245 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // Mixed Light
-        newWB = 4500;
-        newTint = 15;
-      }
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 90 && tapped_y <= 115)
-      {
-        // Cloud
-        newWB = 6500;
-        newTint = 10;
-      }
-
-      // Preset clicked
-      if(newWB != 0)
-      {
-        // Send preset to camera
-        PacketWriter::writeWhiteBalance(newWB, newTint, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else
-      {
-        // Not a preset
-
-        // WB Left
-        if(currentWB != 0 && currentWB >= 2550 && tapped_x >= 95 && tapped_y >= 75 && tapped_x <= 155 && tapped_y <= 115)
-        {
-          // Adjust down by 50
-          PacketWriter::writeWhiteBalance(currentWB - 50, currentTint, &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentWB <= 9950 && tapped_x >= 255 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // Adjust up by 50
-          PacketWriter::writeWhiteBalance(currentWB + 50, currentTint, &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentTint > -50 && tapped_x >= 95 && tapped_y >= 120 && tapped_x <= 155 && tapped_y <= 160)
-        {
-          // Adjust down by 1
-          PacketWriter::writeWhiteBalance(currentWB, currentTint - 1, &cameraConnection);
+    int newWB = 0;
+    int newTint = 0;
 
-          tappedAction = true;
-        }
-        else if(currentWB != 0 && currentWB <= 9950 && tapped_x >= 255 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-        {
-          // Adjust up by 1
-          PacketWriter::writeWhiteBalance(currentWB, currentTint + 1, &cameraConnection);
+    // A preset, or < > on the Kelvin or tint
+    if(WhiteBalanceScreen::hitTest(tapped_x, tapped_y, currentWB, currentTint, newWB, newTint))
+    {
+      PacketWriter::writeWhiteBalance(newWB, newTint, &cameraConnection);
 
-          tappedAction = true;
-        }
-      }
+      tappedAction = true;
     }
   }
 
-
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
   if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
     return;
@@ -1151,82 +1327,11 @@ void Screen_WBTint(bool forceRefresh = false)
 
   Screen_Common_Connected(); // Common elements
 
-  // ISO label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("WHITE BALANCE", 30, 9, &AgencyFB_Bold9pt7b);
-  sprite->drawCentreString("TINT", 54, 132, &AgencyFB_Bold9pt7b);
-
-  // Bright, 5600K
-  int lblWBKelvin = 5600;
-  int lblTint = 10;
-  sprite->fillSmoothRoundRect(20, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(40, 35, 30, 30, WBBrightBG);
-  else
-    sprite->pushImage(40, 35, 30, 30, WBBright);
-
-  // Incandescent, 3200K
-  lblWBKelvin = 3200;
-  lblTint = 0;
-  sprite->fillSmoothRoundRect(95, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(115, 35, 30, 30, WBIncandescentBG);
-  else
-    sprite->pushImage(115, 35, 30, 30, WBIncandescent);
-
-  // Fluorescent, 4000K
-  lblWBKelvin = 4000;
-  lblTint = 15;
-  sprite->fillSmoothRoundRect(170, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(190, 35, 30, 30, WBFlourescentBG);
-  else
-    sprite->pushImage(190, 35, 30, 30, WBFlourescent);
-
-  // Mixed Light, 4500K
-  lblWBKelvin = 4500;
-  lblTint = 15;
-  sprite->fillSmoothRoundRect(245, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(265, 35, 30, 30, WBMixedLightBG);
-  else
-    sprite->pushImage(265, 35, 30, 30, WBMixedLight);
-
-  // Cloud, 6500K
-  lblWBKelvin = 6500;
-  lblTint = 10;
-  sprite->fillSmoothRoundRect(20, 75, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(40, 80, 30, 30, WBCloudBG);
-  else
-    sprite->pushImage(40, 80, 30, 30, WBCloud);
-
-  // WB Adjust Left <
-  sprite->fillSmoothRoundRect(95, 75, 60, 40, 3, TFT_DARKGREY);
-  sprite->drawCentreString("<", 125, 87);
-
-  // Current White Balance Kelvin
-  sprite->fillSmoothRoundRect(160, 75, 90, 40, 3, TFT_DARKGREEN);
-  sprite->drawCentreString(String(currentWB), 205, 80);
-  sprite->drawCentreString("KELVIN", 205, 103, &Lato_Regular5pt7b);
-
-  // WB Adjust Right >
-  sprite->fillSmoothRoundRect(255, 75, 60, 40, 3, TFT_DARKGREY);
-  sprite->drawCentreString(">", 284, 87);
-
-  // Tint Adjust Left <
-  sprite->fillSmoothRoundRect(95, 120, 60, 40, 3, TFT_DARKGREY);
-  sprite->drawCentreString("<", 125, 132);
+  // Buttons, labels and layout are shared (UI/WhiteBalanceScreen), only the drawing is this display's
+  WhiteBalanceScreen::update(currentWB, currentTint);
+  WhiteBalanceScreen::draw(uiBackend);
 
-  // Current Tint
-  sprite->fillSmoothRoundRect(160, 120, 90, 40, 3, TFT_DARKGREEN);
-  sprite->drawCentreString(String(currentTint), 205, 132);
-
-  // Tint Adjust Right >
-  sprite->fillSmoothRoundRect(255, 120, 60, 40, 3, TFT_DARKGREY);
-  sprite->drawCentreString(">", 284, 132);
-
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Codec Screen for Pocket 4K and 6K + Variants
@@ -1239,135 +1344,20 @@ void Screen_Codec4K6K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
   // Codec: BRAW and ProRes
 
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
-  if(tapped_x != -1 && camera->hasCodec() && lastRefreshedScreen != 0)
+  if(tapped_x != -1 && lastRefreshedScreen != 0 && camera->hasCodec())
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Switching between BRAW and ProRes
-      if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::BRAW && tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 165 && tapped_y <= 70)
-      {
-        // Switch to BRAW (using the last known setting)
-        DEBUG_DEBUG("Changing to last unknown BRAW");
-        DEBUG_DEBUG("Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023");
-
-        PacketWriter::writeCodec(camera->lastKnownBRAWIsBitrate ? camera->lastKnownBRAWBitrate : camera->lastKnownBRAWQuality, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::ProRes && tapped_x >= 170 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // Switch to ProRes (using the last known setting)
-        DEBUG_DEBUG("Changing to last unknown ProRes");
-        DEBUG_DEBUG("Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023");
-
-        PacketWriter::writeCodec(camera->lastKnownProRes, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-        // BRAW
-
-        // Are we Constant Bitrate or Constant Quality
-        std::string currentCodecString = currentCodec.to_string();
-        auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-        bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-        // Constant Bitrate and Constant Quality
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 165 && tapped_y <= 115)
-        {
-          // Change to Constant Bitrate if we're not already on Constant Bitrate. If it is we do nothing
-          if(!isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWBitrate, &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-        else if(tapped_x >= 170 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // Change to Constant Quality if we're not already on Constant Quality. If it is we do nothing
-          if(isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWQuality, &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-        else
-        {
-          // Setting
-
-          if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 90 && tapped_y <= 160)
-          {
-            // 3:1 / Q0
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW3_1 : CCUPacketTypes::CodecVariants::kBRAWQ0), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 95 && tapped_y >= 120 && tapped_x <= 165 && tapped_y <= 160)
-          {
-            // 5:1 / Q1
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW5_1 : CCUPacketTypes::CodecVariants::kBRAWQ1), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 120 && tapped_x <= 240 && tapped_y <= 160)
-          {
-            // 8:1 / Q3
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW8_1 : CCUPacketTypes::CodecVariants::kBRAWQ3), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 245 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-          {
-            // 12:1 / Q5
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW12_1 : CCUPacketTypes::CodecVariants::kBRAWQ5), &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-      }
-      else
-      {
-        // ProRes
+    CodecInfo newCodec = camera->getCodec();
 
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 165 && tapped_y <= 115)
-          {
-            // HQ
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-          {
-            // 422
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 165 && tapped_y <= 160)
-          {
-            // LT
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-          {
-            // PXY
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy), &cameraConnection);
+    if(CodecScreen::hitTest(tapped_x, tapped_y, *camera, newCodec))
+    {
+      // Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023
+      PacketWriter::writeCodec(newCodec, &cameraConnection);
 
-            tappedAction = true;
-          }
-      }
+      tappedAction = true;
     }
   }
 
@@ -1377,115 +1367,35 @@ void Screen_Codec4K6K(bool forceRefresh = false)
   else
     lastRefreshedScreen = camera->getLastModified();
 
-  // DEBUG_DEBUG("Screen Codec 4K/6K Refreshed.");
+  // DEBUG_DEBUG("Screen Codec Refreshed.");
 
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  // We need to have the Codec information to show the screen
-  if(!camera->hasCodec())
-  {
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("NO CODEC INFO.", 30, 9);
-
-    return;
-  }
-
-  // Codec label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("CODEC", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // BRAW and ProRes selector buttons
-
-  // BRAW
-  sprite->fillSmoothRoundRect(20, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(20, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("BRAW", 93, 41);
-
-  // ProRes
-  sprite->fillSmoothRoundRect(170, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(170, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("ProRes", 242, 41);
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
+  // Buttons, labels and layout are shared (UI/CodecScreen), only the drawing is this display's. The URSA Mini Pro G2 adds ProRes 444.
+  if(camera->hasCodec())
   {
-    // BRAW
-
-    // Are we Constant Bitrate or Constant Quality
-    std::string currentCodecString = currentCodec.to_string();
-    auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-    bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-    // Get the bitrate or quality setting
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string qualityBitrateSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 3:1, Q3, etc.
-
-    // Constant Bitrate
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("BITRATE", 93, 80);
-    sprite->drawCentreString("CONSTANT", 93, 102, &Lato_Regular5pt7b);
-
-    // Constant Quality
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (!isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("QUALITY", 242, 80);
-    sprite->drawCentreString("CONSTANT", 242, 102, &Lato_Regular5pt7b);
-
-    // Setting 1 of 4
-    std::string optionString = (isConstantBitrate ? "3:1" : "Q0");
-    sprite->fillSmoothRoundRect(20, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 55, 131);
-
-    // Setting 2 of 4
-    optionString = (isConstantBitrate ? "5:1" : "Q1");
-    sprite->fillSmoothRoundRect(95, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 130, 131);
-
-  //   Setting 3 of 4
-    optionString = (isConstantBitrate ? "8:1" : "Q3");
-    sprite->fillSmoothRoundRect(170, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 205, 131);
-
-    // Setting 4 of 4
-    optionString = (isConstantBitrate ? "12:1" : "Q5");
-    sprite->fillSmoothRoundRect(245, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 280, 131);
+    CodecInfo currentCodec = camera->getCodec();
+    CodecScreen::update(&currentCodec, camera->isURSAMiniProG2());
   }
   else
-  {
-    // ProRes
-
-    // Get the ProRes Setting
-    std::string currentCodecString = currentCodec.to_string();
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string currentProResSetting = currentCodecString.substr(spaceIndex + 1); // e.g. HQ, 422, LT, PXY
-
-    // HQ
-    std::string proResLabel = "HQ";
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 93, 87);
-
-    // 422
-    proResLabel = "422";
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 242, 87);
-
-    // LT
-    proResLabel = "LT";
-    sprite->fillSmoothRoundRect(20, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 93, 131);
+    CodecScreen::update(nullptr, false); // We need to have the Codec information to show the screen
 
-    // PXY
-    proResLabel = "PXY";
-    sprite->fillSmoothRoundRect(170, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 242, 131);
-  }
+  CodecScreen::draw(uiBackend);
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Codec Screen for URSA Mini Pro G2
 void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
+{
+  // Same screen as the Pockets, with ProRes 444 XQ and 444
+  Screen_Codec4K6K(forceRefresh);
+}
+
+// Codec Screen for URSA Mini Pro 12K
+void Screen_CodecURSAMiniPro12K(bool forceRefresh = false)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
@@ -1494,934 +1404,65 @@ void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
+  // TO DO
+}
 
-  // Codec: BRAW and ProRes
+// Codec screen - redirects to appropriate screen for camera
+void Screen_Codec(bool forceRefresh = false)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // If we have a tap, we should determine if it is on anything
-  bool tappedAction = false;
-  if(tapped_x != -1 && camera->hasCodec() && lastRefreshedScreen != 0)
+  if(camera->hasCodec())
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
+    if(camera->hasModelName())
     {
-      // Switching between BRAW and ProRes
-      if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::BRAW && tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 165 && tapped_y <= 70)
-      {
-        // Switch to BRAW (using the last known setting)
-        DEBUG_DEBUG("Changing to last known BRAW");
-
-        PacketWriter::writeCodec(camera->lastKnownBRAWIsBitrate ? camera->lastKnownBRAWBitrate : camera->lastKnownBRAWQuality, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec != CCUPacketTypes::BasicCodec::ProRes && tapped_x >= 170 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // Switch to ProRes (using the last known setting)
-        DEBUG_DEBUG("Changing to last known ProRes");
-
-        PacketWriter::writeCodec(camera->lastKnownProRes, &cameraConnection);
-
-        tappedAction = true;
-      }
-      else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-        // BRAW
-
-        // Are we Constant Bitrate or Constant Quality
-        std::string currentCodecString = currentCodec.to_string();
-        auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-        bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-        // Constant Bitrate and Constant Quality
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 165 && tapped_y <= 115)
-        {
-          // Change to Constant Bitrate if we're not already on Constant Bitrate. If it is we do nothing
-          if(!isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWBitrate, &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-        else if(tapped_x >= 170 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // Change to Constant Quality if we're not already on Constant Quality. If it is we do nothing
-          if(isConstantBitrate)
-          {
-            PacketWriter::writeCodec(camera->lastKnownBRAWQuality, &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-        else
-        {
-          // Setting
-
-          if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 90 && tapped_y <= 160)
-          {
-            // 3:1 / Q0
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW3_1 : CCUPacketTypes::CodecVariants::kBRAWQ0), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 95 && tapped_y >= 120 && tapped_x <= 165 && tapped_y <= 160)
-          {
-            // 5:1 / Q1
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW5_1 : CCUPacketTypes::CodecVariants::kBRAWQ1), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 170 && tapped_y >= 120 && tapped_x <= 240 && tapped_y <= 160)
-          {
-            // 8:1 / Q3
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW8_1 : CCUPacketTypes::CodecVariants::kBRAWQ3), &cameraConnection);
-
-            tappedAction = true;
-          }
-          else if(tapped_x >= 245 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-          {
-            // 12:1 / Q5
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, isConstantBitrate ? CCUPacketTypes::CodecVariants::kBRAW12_1 : CCUPacketTypes::CodecVariants::kBRAWQ5), &cameraConnection);
-
-            tappedAction = true;
-          }
-        }
-      }
+      if(camera->isPocket4K6K())
+        Screen_Codec4K6K(forceRefresh); // Pocket camera
+      else if(camera->isURSAMiniProG2())
+        Screen_CodecURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
+      else if(camera->isURSAMiniPro12K())
+        Screen_CodecURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
       else
-      {
-        // ProRes
+        DEBUG_DEBUG("No Codec screen for this camera.");
+    }
+    else
+      Screen_Codec4K6K(forceRefresh); // Handle no model name in 4K/6K screen
+  }
+  else
+    Screen_Codec4K6K(forceRefresh); // If we don't have any codec info, we show the 4K/6K screen that shows no codec
 
-        if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 115 && tapped_y <= 115)
-        {
-          // 444XQ
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes444XQ), &cameraConnection);
+}
 
-          tappedAction = true;
-        }
-        else if(tapped_x >= 120 && tapped_y >= 75 && tapped_x <= 215 && tapped_y <= 115)
-        {
-          // 444
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes444), &cameraConnection);
 
-          tappedAction = true;
-        }
-        else if(tapped_x >= 220 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-        {
-          // HQ
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ), &cameraConnection);
+// Resolution screen for the Pocket 4K, Pocket 6K and URSA Mini Pro G2, each has its own resolutions and sensor areas in UI/ResolutionScreen
+void Screen_ResolutionModel(ResolutionScreen::Model model, bool forceRefresh)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
+    return;
 
-          tappedAction = true;
-        }
-        else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 115 && tapped_y <= 160)
-        {
-          // 422
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422), &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(tapped_x >= 120 && tapped_y >= 120 && tapped_x <= 215 && tapped_y <= 160)
-        {
-          // LT
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT), &cameraConnection);
-
-          tappedAction = true;
-        }
-        else if(tapped_x >= 220 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-        {
-          // PXY
-          PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy), &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-
-  // DEBUG_DEBUG("Screen Codec URSA Mini Pro G2 Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  // We need to have the Codec information to show the screen
-  if(!camera->hasCodec())
-  {
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("NO CODEC INFO.", 30, 9);
-
-    return;
-  }
-
-  // Codec label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("CODEC", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // BRAW and ProRes selector buttons
-
-  // BRAW
-  sprite->fillSmoothRoundRect(20, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(20, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("BRAW", 93, 41);
-
-  // ProRes
-  sprite->fillSmoothRoundRect(170, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(170, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("ProRes", 242, 41);
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // BRAW
-
-    // Are we Constant Bitrate or Constant Quality
-    std::string currentCodecString = currentCodec.to_string();
-    auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-    bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-    // Get the bitrate or quality setting
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string qualityBitrateSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 3:1, Q3, etc.
-
-    // Constant Bitrate
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("BITRATE", 93, 80);
-    sprite->drawCentreString("CONSTANT", 93, 102, &Lato_Regular5pt7b);
-
-    // Constant Quality
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (!isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("QUALITY", 242, 80);
-    sprite->drawCentreString("CONSTANT", 242, 102, &Lato_Regular5pt7b);
-
-    // Setting 1 of 4
-    std::string optionString = (isConstantBitrate ? "3:1" : "Q0");
-    sprite->fillSmoothRoundRect(20, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 55, 131);
-
-    // Setting 2 of 4
-    optionString = (isConstantBitrate ? "5:1" : "Q1");
-    sprite->fillSmoothRoundRect(95, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 130, 131);
-
-  //   Setting 3 of 4
-    optionString = (isConstantBitrate ? "8:1" : "Q3");
-    sprite->fillSmoothRoundRect(170, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 205, 131);
-
-    // Setting 4 of 4
-    optionString = (isConstantBitrate ? "12:1" : "Q5");
-    sprite->fillSmoothRoundRect(245, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 280, 131);
-  }
-  else
-  {
-    // ProRes
-
-    // Get the ProRes Setting
-    std::string currentCodecString = currentCodec.to_string();
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string currentProResSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 444XQ, 444, HQ, 422, LT, PXY
-
-    // 444 XQ
-    std::string proResLabel = "444XQ";
-    sprite->fillSmoothRoundRect(20, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("XQ", 67, 87);
-
-    // 444
-    proResLabel = "444";
-    sprite->fillSmoothRoundRect(120, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 167, 87);
-
-    // HQ
-    proResLabel = "HQ";
-    sprite->fillSmoothRoundRect(220, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 267, 87);
-
-    // 422
-    proResLabel = "422";
-    sprite->fillSmoothRoundRect(20, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 67, 131);
-
-    // LT
-    proResLabel = "LT";
-    sprite->fillSmoothRoundRect(120, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 167, 131);
-
-    // PXY
-    proResLabel = "PXY";
-    sprite->fillSmoothRoundRect(220, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 267, 131);
-  }
-
-  sprite->pushSprite(0, 0);
-}
-
-// Codec Screen for URSA Mini Pro 12K
-void Screen_CodecURSAMiniPro12K(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Codec;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // TO DO
-}
-
-// Codec screen - redirects to appropriate screen for camera
-void Screen_Codec(bool forceRefresh = false)
-{
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  if(camera->hasCodec())
-  {
-    if(camera->hasModelName())
-    {
-      if(camera->isPocket4K6K())
-        Screen_Codec4K6K(forceRefresh); // Pocket camera
-      else if(camera->isURSAMiniProG2())
-        Screen_CodecURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
-      else if(camera->isURSAMiniPro12K())
-        Screen_CodecURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
-      else
-        DEBUG_DEBUG("No Codec screen for this camera.");
-    }
-    else
-      Screen_Codec4K6K(forceRefresh); // Handle no model name in 4K/6K screen
-  }
-  else
-    Screen_Codec4K6K(forceRefresh); // If we don't have any codec info, we show the 4K/6K screen that shows no codec
-
-}
-
-
-// Resolution screen for Pocket 4K
-void Screen_Resolution4K(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
+  connectedScreenIndex = Screens::Resolution;
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Pocket 4K Resolution and Sensor Windows
-
   // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
+  CCUPacketTypes::RecordingFormatData currentRecordingFormat = {};
   if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  // If we have a tap, we should determine if it is on anything
-  bool tappedAction = false;
-  if(tapped_x != -1 && lastRefreshedScreen != 0)
-  {
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K DCI
-        width = 4096; height = 2160;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K 2.4:1
-        width = 4096; height = 1720;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = true;
-      }
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-      {
-        // 2.8K Ana
-        width = 2880; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-      {
-        // 2.6K 16:9
-        width = 2688; height = 1512;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = true;
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
-    {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K
-        width = 4096; height = 2160;
-        window = false; // true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = true; // currentRecordingFormat.windowedModeEnabled;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = true; // currentRecordingFormat.windowedModeEnabled;
-      }
-
-      // Windowed options
-      /*
-      else if(currentRes == "HD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 310 && tapped_y <= 160)
-      {
-        // HD - Scaled from Full sensor, 2.6K, or Windowed, can't distinguish
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
-      */
-
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-
-  // DEBUG_DEBUG("Screen Resolution Pocket 4K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("BRAW RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K 2.4:1", "4K UHD", "2.8K Ana", "2.6K 16:9", "HD"
-
-    // 4K DCI
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 35);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K 2.4:1
-    labelRes = "4K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 160, 35);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 260, 35);
-    sprite->drawCentreString("UHD", 260, 58, &Lato_Regular5pt7b);
-
-    // 2.8K Ana
-    labelRes = "2.8K Ana";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.8K", 65, 81);
-    sprite->drawCentreString("ANAMORPHIC", 65, 104, &Lato_Regular5pt7b);
-
-    // 2.6K 16:9
-    labelRes = "2.6K 16:9";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.6K", 160, 81);
-    sprite->drawCentreString("16:9", 160, 104, &Lato_Regular5pt7b);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 87);
-
-    // Sensor Area
-
-    // Pocket 4K all are Windowed except 4K
-    // sprite->drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY); // Optionally draw a rectangle around this info.
-    sprite->drawCentreString(currentRes == "4K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129);
-    sprite->drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 150, &Lato_Regular5pt7b);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("ProRes RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 36);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 41);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 41);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    sprite->drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, &Lato_Regular5pt7b);
-    sprite->drawString("SCALED / SENSOR AREA", 30, 105);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 135, 90, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL", 65, 145);
-    }
-    else if(currentRes == "4K UHD")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 135, 120, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("WINDOW", 80, 145);
-    }
-    else
-    {
-      // HD
-
-      // Scaled from Full, 2.6K or Windowed (however we can't tell which)
-      sprite->fillSmoothRoundRect(20, 135, 290, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL / 2.6K / WINDOW", 165, 140);
-      sprite->drawCentreString("CHECK/SET ON CAMERA", 165, 161, &Lato_Regular5pt7b);
-    }
-  }
-  else
-    DEBUG_ERROR("Resolution Pocket 4K - Codec not catered for.");
-
-  sprite->pushSprite(0, 0);
-}
-
-// Resolution screen for Pocket 6K
-void Screen_Resolution6K(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // Pocket 6K Resolution and Sensor Windows
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  // If we have a tap, we should determine if it is on anything
-  bool tappedAction = false;
-  if(tapped_x != -1 && lastRefreshedScreen != 0)
-  {
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 6K
-        width = 6144; height = 3456;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 6K 2.4:1
-        width = 6144; height = 2560;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // 5.7K 17:9
-        width = 5744; height = 3024;
-        window = true;
-      }
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-      {
-        // 4K DCI
-        width = 4096; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-      {
-        // 3.7K Anamorphic
-        width = 3728; height = 3104;
-        window = true;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-      {
-        // 2.8K 17:9
-        width = 2868; height = 1512;
-        window = true;
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
-    {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4K
-        width = 4096; height = 2160;
-        window = true;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-        window = currentRecordingFormat.windowedModeEnabled;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // HD
-        width = 1920; height = 1080;
-        window = currentRecordingFormat.windowedModeEnabled;
-      }
-
-      // Windowed options
-      else if(currentRes == "4K UHD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-      {
-        // 4K UHD - Full Sensor
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = false;
-      }
-      else if(currentRes == "4K UHD" && tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-      {
-        // 4K UHD - Windowed 5.7K
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
-      else if(currentRes == "HD" && tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-      {
-        // HD - Full Sensor
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = false;
-      }
-      else if(currentRes == "HD" && tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 310 && tapped_y <= 160)
-      {
-        // HD - Scaled from 5.7K or 2.8K, can't distinguish which unfortunately
-        width = currentRecordingFormat.width; height = currentRecordingFormat.height;
-        window = true;
-      }
-
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-
-  // DEBUG_DEBUG("Screen Resolution Pocket 6K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("BRAW RESOLUTION", 30, 9);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "6K", "6K 2.4:1", "5.7K 17:9", "4K DCI", "3.7K 6:5A", "2.8K 17:9"
-
-    // 6K
-    String labelRes = "6K";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(String(labelRes).c_str(), 65, 41);
-
-    // 6K, 2.4:1
-    labelRes = "6K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("6K", 160, 36);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-
-    // 5.7K, 17:9
-    labelRes = "5.7K 17:9";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("5.7K", 260, 36);
-    sprite->drawCentreString("17:9", 260, 58, &Lato_Regular5pt7b);
-
-    // 4K DCI
-    labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 82);
-    sprite->drawCentreString("DCI", 65, 104, &Lato_Regular5pt7b);
-
-    // 3.7K 6:5A
-    labelRes = "3.7K 6:5A";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("3.7K", 160, 82);
-    sprite->drawCentreString("6:5 ANA", 160, 104, &Lato_Regular5pt7b);
-
-    // 2.8K 17:9
-    labelRes = "2.8K 17:9";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.8K", 260, 82);
-    sprite->drawCentreString("17:9", 260, 104, &Lato_Regular5pt7b);
-
-    // Sensor Area
-
-    // Pocket 6K all are Windowed except 6K
-    // sprite->drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY); // Optionally draw a rectangle around this info.
-    sprite->drawCentreString(currentRes == "6K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129);
-    sprite->drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 148, &Lato_Regular5pt7b);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("ProRes RESOLUTION", 30, 9);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 36);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 41);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 41);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    sprite->drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, &Lato_Regular5pt7b);
-    sprite->drawString("SCALED FROM SENSOR AREA", 30, 105);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL", 65, 131);
-    }
-    else if(currentRes == "4K UHD")
-    {
-      // Scaled from Full or 5.7K
-      sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("FULL", 65, 131);
-
-      // 5.7K
-      sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("5.7K", 160, 131);
-    }
-    else
-    {
-      // HD
-
-      // Scaled from Full, 2.8K or 5.7K (however we can't tell if it's 2.8K or 5.7K)
-      sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("FULL", 65, 131);
-
-      // 2.8K 5.7K
-      sprite->fillSmoothRoundRect(115, 120, 195, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("5.7K / 2.8K", 212, 126);
-      sprite->drawCentreString("CHECK/SET ON CAMERA", 212, 146, &Lato_Regular5pt7b);
-    }
-  }
-  else
-    DEBUG_ERROR("Resolution Pocket 6K - Codec not catered for.");
-
-  sprite->pushSprite(0, 0);
-}
-
-// Resolution Screen for URSA Mini Pro G2
-void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // URSA Mini Pro G2 (no window settings, just resolution)
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  // If we have a tap, we should determine if it is on anything
-  bool tappedAction = false;
-  if(tapped_x != -1 && lastRefreshedScreen != 0)
-  {
-    // Love that the G2 has the same resolution options for BRAW and ProRes
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW || currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = true;
-
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 110 && tapped_y <= 70)
-      {
-        // 4.6K
-        width = 4608; height = 2592;
-        window = false;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 30 && tapped_x <= 205 && tapped_y <= 70)
-      {
-        // 4.6K 2.4:1
-        width = 4608; height = 1920;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 30 && tapped_x <= 310 && tapped_y <= 70)
-      {
-        // 4K 16:9
-        width = 4096; height = 2304;
-      }
-
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 110 && tapped_y <= 115)
-      {
-        // 4K DCI
-        width = 4096; height = 2160;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 75 && tapped_x <= 205 && tapped_y <= 115)
-      {
-        // 4K UHD
-        width = 3840; height = 2160;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 75 && tapped_x <= 310 && tapped_y <= 115)
-      {
-        // 3K Ana
-        width = 3072; height = 2560;
-      }
-
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 110 && tapped_y <= 160)
-      {
-        // 2K 16:9
-        width = 2048; height = 1152;
-      }
-      else if(tapped_x >= 115 && tapped_y >= 120 && tapped_x <= 205 && tapped_y <= 160)
-      {
-        // 2K DCI
-        width = 2048; height = 1080;
-      }
-      else if(tapped_x >= 210 && tapped_y >= 120 && tapped_x <= 310 && tapped_y <= 160)
-      {
-        // HD
-        width = 1920; height = 1080;
-      }
+    currentRecordingFormat = camera->getRecordingFormat();
 
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
+  CCUPacketTypes::BasicCodec currentCodec = camera->hasCodec() ? camera->getCodec().basicCodec : CCUPacketTypes::BasicCodec::BRAW;
 
-        tappedAction = true;
-      }
+  // If we have a tap, we should determine if it is on anything
+  bool tappedAction = false;
+  if(tapped_x != -1 && lastRefreshedScreen != 0)
+  {
+    CCUPacketTypes::RecordingFormatData newRecordingFormat;
+
+    if(ResolutionScreen::hitTest(tapped_x, tapped_y, newRecordingFormat))
+    {
+      // Resolution or Sensor Area selected, write to camera
+      PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
+
+      tappedAction = true;
     }
   }
 
@@ -2431,78 +1472,35 @@ void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
   else
     lastRefreshedScreen = camera->getLastModified();
 
-  // DEBUG_DEBUG("Screen Resolution URSA Mini Pro G2 Refreshed.");
+  // DEBUG_DEBUG("Screen Resolution Refreshed.");
 
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW || currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      sprite->drawString("BRAW RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-    else
-      sprite->drawString("PRORES RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4.6K", "4.6K 2.4:1", "4K 16:9", "4K DCI", "4K UHD", "3K Ana", "2K 16:9", "2K DCI", "HD"
-
-    // 4.6K
-    String labelRes = "4.6K";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(String(labelRes).c_str(), 65, 41);
-
-    // 4.6K 2.4:1
-    labelRes = "4.6K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4.6K", 160, 36);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-
-    // 4K 16:9
-    labelRes = "4K 16:9";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4.6K", 260, 36);
-    sprite->drawCentreString("16:9", 260, 58, &Lato_Regular5pt7b);
-
-    // 4K DCI
-    labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 82);
-    sprite->drawCentreString("DCI", 65, 104, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 86);
-
-    // 3K Ana
-    labelRes = "3K Ana";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("3K", 260, 82);
-    sprite->drawCentreString("ANA", 260, 104, &Lato_Regular5pt7b);
-
-    // 2K 16:9
-    labelRes = "2K 16:9";
-    sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2K", 65, 128);
-    sprite->drawCentreString("16:9", 65, 149, &Lato_Regular5pt7b);
-
-    // 2K DCI
-    labelRes = "2K DCI";
-    sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2K", 160, 128);
-    sprite->drawCentreString("DCI", 160, 149, &Lato_Regular5pt7b);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 132);
-  }
-  else
-    DEBUG_ERROR("Resolution URSA Mini Pro G2 - Codec not catered for.");
+  // Buttons, labels and layout are shared (UI/ResolutionScreen), only the drawing is this display's
+  ResolutionScreen::update(model, currentCodec, currentRecordingFormat);
+  ResolutionScreen::draw(uiBackend);
+
+  Screen_Present();
+}
+
+// Resolution screen for Pocket 4K
+void Screen_Resolution4K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket4K, forceRefresh);
+}
+
+// Resolution screen for Pocket 6K
+void Screen_Resolution6K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket6K, forceRefresh);
+}
 
-  sprite->pushSprite(0, 0);
+// Resolution Screen for URSA Mini Pro G2
+void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::URSAMiniProG2, forceRefresh);
 }
 
 // Resolution Screen for URSA Mini Pro 12K
@@ -2670,6 +1668,7 @@ void Screen_FramerateURSAMiniProG2(bool forceRefresh = false)
         newRecordingFormat.frameRate = frameRate;
         newRecordingFormat.mRateEnabled = mRateEnabled;
         newRecordingFormat.offSpeedEnabled = false;
+        SpeedRamp::stop();
         PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
 
         tappedAction = true;
@@ -2754,6 +1753,7 @@ void Screen_FramerateURSAMiniProG2(bool forceRefresh = false)
           CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
           newRecordingFormat.offSpeedEnabled = true;
           newRecordingFormat.offSpeedFrameRate = offSpeedFrameRate;
+          SpeedRamp::stop();
           PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
 
           tappedAction = true;
@@ -2912,7 +1912,7 @@ void Screen_FramerateURSAMiniProG2(bool forceRefresh = false)
   if(labelFR != "")
     sprite->drawCentreString("OFF SPEED", 260, 143, &AgencyFB_Regular7pt7b);
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Frame Rate Screen for URSA Mini Pro 12K
@@ -2955,8 +1955,8 @@ void Screen_Framerate(bool forceRefresh = false)
     Screen_Framerate4K(forceRefresh); // If we don't have any codec info, we show the 4K screen that shows no codec
 }
 
-// Media screen for Pocket 4K
-void Screen_Media4K6K(bool forceRefresh = false)
+// Media screen for the Pockets (CFast, SD and USB) and URSA Mini Pro G2 (two slots, named by their media)
+void Screen_MediaSlots(bool pocket, bool forceRefresh)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
@@ -2965,57 +1965,21 @@ void Screen_Media4K6K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // 3 Media Slots - CFAST, SD, USB
-
   // If we have a tap, we should determine if it is on anything
   bool tappedAction = false;
-  if(tapped_x != -1 && camera->getMediaSlots().size() != 0 && lastRefreshedScreen != 0)
+  if(tapped_x != -1 && lastRefreshedScreen != 0)
   {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // CFAST
-        if(camera->getMediaSlots()[0].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[0].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = true;
-          transportInfo.slots[1].active = false;
-          transportInfo.slots[2].active = false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
+    int slotIndex = MediaScreen::hitTest(tapped_x, tapped_y);
 
-          tappedAction = true;
-        }
-      }
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-      {
-          // Change to SD
-        if(camera->getMediaSlots()[1].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[1].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = false;
-          transportInfo.slots[1].active = true;
-          transportInfo.slots[2].active = false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else if(tapped_x >= 20 && tapped_y >= 120 && tapped_x <= 315 && tapped_y <= 160)
-      {
-          // Change to USB
-        if(camera->getMediaSlots()[2].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[2].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = false;
-          transportInfo.slots[1].active = false;
-          transportInfo.slots[2].active = true;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
+    if(slotIndex != -1)
+    {
+      // Make the slot the active one
+      TransportInfo transportInfo = camera->getTransportMode();
+      for(int index = 0; index < transportInfo.slots.size(); index++)
+        transportInfo.slots[index].active = index == slotIndex;
+      PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
 
-          tappedAction = true;
-        }
-      }
+      tappedAction = true;
     }
   }
 
@@ -3025,141 +1989,29 @@ void Screen_Media4K6K(bool forceRefresh = false)
   else
     lastRefreshedScreen = camera->getLastModified();
 
-  // DEBUG_DEBUG("Screen Media Pocket 4K/6K Refreshed.");
+  // DEBUG_DEBUG("Screen Media Refreshed.");
 
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-    // Media label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("MEDIA", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // CFAST
-  BMDCamera::MediaSlot cfast = camera->getMediaSlots()[0];
-  sprite->fillSmoothRoundRect(20, 30, 295, 40, 3, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(cfast.StatusIsError()) sprite->drawRoundRect(20, 30, 295, 40, 3, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("CFAST", 28, 47);
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(cfast.remainingRecordTimeString.c_str(), 155, 47);
-
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 35, &Lato_Regular5pt7b);
-  sprite->drawString("1", 300, 35, &Lato_Regular5pt7b);
-  sprite->drawString(cfast.GetStatusString().c_str(), 28, 35, &Lato_Regular5pt7b);
-
-  // SD
-  BMDCamera::MediaSlot sd = camera->getMediaSlots()[1];
-  sprite->fillSmoothRoundRect(20, 75, 295, 40, 3, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(sd.StatusIsError()) sprite->drawRoundRect(20, 75, 295, 40, 3, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("SD", 28, 92);
-  if(sd.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(sd.remainingRecordTimeString.c_str(), 155, 92);
-
-  if(sd.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 80, &Lato_Regular5pt7b);
-  sprite->drawString("2", 300, 80, &Lato_Regular5pt7b);
-  sprite->drawString(sd.GetStatusString().c_str(), 28, 80, &Lato_Regular5pt7b);
-  if(sd.StatusIsError()) sprite->setTextColor(TFT_WHITE);
-
-  // USB
-  BMDCamera::MediaSlot usb = camera->getMediaSlots()[2];
-  sprite->fillSmoothRoundRect(20, 120, 295, 40, 3, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(usb.StatusIsError()) sprite->drawRoundRect(20, 120, 295, 40, 3, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("USB", 28, 137);
-  if(usb.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(usb.remainingRecordTimeString.c_str(), 155, 137);
-
-  if(usb.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 125, &Lato_Regular5pt7b);
-  sprite->drawString("3", 300, 125, &Lato_Regular5pt7b);
-  sprite->drawString(usb.GetStatusString().c_str(), 28, 125, &Lato_Regular5pt7b);
-  if(usb.StatusIsError()) sprite->setTextColor(TFT_WHITE);
-
-  sprite->pushSprite(0, 0);
+  // Buttons, labels and layout are shared (UI/MediaScreen), only the drawing is this display's
+  MediaScreen::update(camera->getMediaSlots(), pocket);
+  MediaScreen::draw(uiBackend);
+
+  Screen_Present();
+}
+
+// Media screen for Pocket 4K and 6K
+void Screen_Media4K6K(bool forceRefresh = false)
+{
+  Screen_MediaSlots(true, forceRefresh);
 }
 
 // Media Screen for URSA Mini Pro G2
 void Screen_MediaURSAMiniProG2(bool forceRefresh = false)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Media;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // 2 Media Slots - CFAST/CFAST, CFAST/USB, SD/SD, SD/USB
-  // URSA Mini Pro G2 - Can only choose between two cards
-
-  // If we have a tap, we should determine if it is on anything
-  bool tappedAction = false;
-  if(tapped_x != -1 && camera->getMediaSlots().size() != 0 && lastRefreshedScreen != 0)
-  {
-    if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 160)
-    {
-      // Tapped within the area
-      if(tapped_x >= 20 && tapped_y >= 30 && tapped_x <= 315 && tapped_y <= 70)
-      {
-        // SLOT 1 CFAST or SD
-        if(camera->getMediaSlots()[0].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[0].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = true;
-          transportInfo.slots[1].active = false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else if(tapped_x >= 20 && tapped_y >= 75 && tapped_x <= 315 && tapped_y <= 115)
-      {
-          // SLOT 2 CFAST/SD/USB
-        if(camera->getMediaSlots()[1].status != CCUPacketTypes::MediaStatus::None && !camera->getMediaSlots()[1].active)
-        {
-          TransportInfo transportInfo = camera->getTransportMode();
-          transportInfo.slots[0].active = false;
-          transportInfo.slots[1].active = true;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-    // Media label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("MEDIA", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // CFAST/SD
-  BMDCamera::MediaSlot slotFirst = camera->getMediaSlots()[0];
-  sprite->fillSmoothRoundRect(20, 30, 295, 40, 3, (slotFirst.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(slotFirst.StatusIsError()) sprite->drawRoundRect(20, 30, 295, 40, 3, (slotFirst.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString(slotFirst.GetMediumString().c_str(), 28, 47);
-  if(slotFirst.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(slotFirst.remainingRecordTimeString.c_str(), 155, 47);
-
-  if(slotFirst.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 35, &Lato_Regular5pt7b);
-  sprite->drawString("1", 300, 35, &Lato_Regular5pt7b);
-  sprite->drawString(slotFirst.GetStatusString().c_str(), 28, 35, &Lato_Regular5pt7b);
-
-  // CFAST/SD/USB
-  BMDCamera::MediaSlot slotSecond = camera->getMediaSlots()[1];
-  sprite->fillSmoothRoundRect(20, 75, 295, 40, 3, (slotSecond.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(slotSecond.StatusIsError()) sprite->drawRoundRect(20, 75, 295, 40, 3, (slotSecond.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString(slotSecond.GetMediumString().c_str(), 28, 92);
-  if(slotSecond.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(slotSecond.remainingRecordTimeString.c_str(), 155, 92);
-
-  if(slotSecond.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 80, &Lato_Regular5pt7b);
-  sprite->drawString("2", 300, 80, &Lato_Regular5pt7b);
-  sprite->drawString(slotSecond.GetStatusString().c_str(), 28, 80, &Lato_Regular5pt7b);
-  if(slotSecond.StatusIsError()) sprite->setTextColor(TFT_WHITE);
-
-  sprite->pushSprite(0, 0);
+  Screen_MediaSlots(false, forceRefresh);
 }
 
 // Media Screen for URSA Mini Pro 12K
@@ -3226,8 +2078,8 @@ void Screen_Lens(bool forceRefresh = false)
         if(freeFocus)
         {
           // Free Focus will be lights just as blue
-          encoderSensor.setLEDColor(1, 0x000011);
-          encoderSensor.setLEDColor(2, 0x000011);
+          Encoder_SetLEDs(0x000011, 0x000011);
+          focusAccelerator.reset();
         }
 
       #else
@@ -3241,213 +2093,532 @@ void Screen_Lens(bool forceRefresh = false)
 
       tappedAction = true;
     }
+    else if(rackButton.contains(tapped_x, tapped_y))
+    {
+      // Racks to the other mark, a tap while it's moving turns it back from where it has got to
+      rackToB = !rackToB;
+      float target = rackToB ? RACK_FOCUS_B : RACK_FOCUS_A;
+
+      if(MotionEngine::isMoving(MotionEngine::Axis::Focus))
+        MotionEngine::moveTo(MotionEngine::Axis::Focus, target, RACK_FOCUS_MS);
+      else
+        MotionEngine::move(MotionEngine::Axis::Focus, rackToB ? RACK_FOCUS_A : RACK_FOCUS_B, target, RACK_FOCUS_MS);
+
+      sliderTouch = true; // Once for each tap, not again while the finger stays down
+      tappedAction = true;
+    }
   }
 
+  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
+  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+    return;
+  else
+    lastRefreshedScreen = camera->getLastModified();
+
+  // DEBUG_DEBUG("Screen Lens Refreshed.");
+
+  sprite->fillScreen(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
+
+  // Label
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawString("LENS", 30, 9, &AgencyFB_Bold9pt7b);
+
+  // M5GFX, set font here rather than on each drawString line
+  sprite->setFont(&Lato_Regular11pt7b);
+
+
   // Get the current encoder value
   #if USING_M5_ENCODER
 
+    sprite->drawCircle(257, 63, 57, TFT_BLUE); // Outer
+    sprite->fillSmoothCircle(257, 63, 54, TFT_PURPLE); // Inner
+    sprite->setTextColor(TFT_WHITE);
+    sprite->drawCentreString(freeFocus ? "FREE" : "FOCUS", 257, 38);
+    sprite->drawCentreString(freeFocus ? "FOCUS" : "RANGE", 257, 62);
+
+  #else
 
-    if(freeFocus)
+    // Focus button
+    sprite->drawCircle(257, 63, 57, TFT_BLUE); // Outer
+    sprite->fillSmoothCircle(257, 63, 54, TFT_SKYBLUE); // Inner
+    sprite->setTextColor(TFT_WHITE);
+    sprite->drawCentreString("FOCUS", 257, 50);
+
+  #endif
+
+  // Focus strip, drag along it to move the focus
+  sprite->fillSmoothRoundRect(focusStrip.x, focusStrip.y, focusStrip.w, focusStrip.h, 3, TFT_DARKGREY);
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawCentreString("< DRAG >", focusStrip.x + focusStrip.w / 2, focusStrip.y + 10);
+
+  // Rack focus, shows where the next tap goes (or that it's moving)
+  bool racking = MotionEngine::isMoving(MotionEngine::Axis::Focus);
+  sprite->fillSmoothRoundRect(rackButton.x, rackButton.y, rackButton.w, rackButton.h, 3, racking ? TFT_ORANGE : TFT_DARKGREY);
+  sprite->drawCentreString(racking ? "RACKING" : (rackToB ? "RACK B > A" : "RACK A > B"), rackButton.x + rackButton.w / 2, rackButton.y + 12, &AgencyFB_Bold9pt7b);
+
+  sprite->drawString("LENS TYPE", 30, 53, &Lato_Regular5pt7b);
+  if(camera->hasLensType())
+  {
+    sprite->setTextColor(TFT_LIGHTGREY);
+    sprite->drawString(camera->getLensType().c_str(), 30, 35, &Lato_Regular6pt7b);
+
+  }
+
+  sprite->drawString("FOCAL LENGTH", 30, 98, &Lato_Regular5pt7b);
+  if(camera->hasFocalLengthMM() || camera->hasLensFocalLength())
+  {
+    if(camera->hasFocalLengthMM())
+    {
+      auto focalLength = camera->getFocalLengthMM();
+      std::string focalLengthMM = std::to_string(focalLength);
+      std::string combined = focalLengthMM + "mm";
+
+      sprite->drawString(combined.c_str(), 30, 75, &Lato_Regular12pt7b);
+    }
+    else
+      sprite->drawString(camera->getLensFocalLength().c_str(), 30, 80, &Lato_Regular12pt7b);
+  }
+
+  sprite->drawString("LENS DISTANCE", 30, 143, &Lato_Regular5pt7b);
+  if(camera->hasLensDistance())
+  {
+    sprite->drawString(camera->getLensDistance().c_str(), 30, 120, &Lato_Regular12pt7b);
+  }
+
+  sprite->drawString("APERTURE", 30, 188, &Lato_Regular5pt7b);
+  if(camera->hasApertureFStopString())
+  {
+    sprite->drawString(camera->getApertureFStopString().c_str(), 30, 165, &Lato_Regular12pt7b);
+  }
+
+  Screen_Present();
+}
+
+// Draws the current connected screen, only if something has changed unless forceRefresh
+// Looks screen, a tap recalls a look. Tapping SAVE and then a look (or an empty slot) saves the camera's settings into it.
+void Screen_Looks(bool forceRefresh = false)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
+    return;
+
+  connectedScreenIndex = Screens::Looks;
+
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  // If we have a tap, we should determine if it is on anything
+  bool tappedAction = false;
+  if(tapped_x != -1 && lastRefreshedScreen != 0)
+  {
+    if(looksSaveButton.contains(tapped_x, tapped_y))
     {
-      // Free Focus - rotate dial and it sends offset to rotate the lens
+      looksSaving = !looksSaving;
 
-      unsigned long currentTime = millis();
+      sliderTouch = true; // Once for each tap, not again while the finger stays down
+      tappedAction = true;
+    }
+    else if(tapped_x >= 20 && tapped_x <= 315 && tapped_y >= 35 && tapped_y <= 201)
+    {
+      int slot = std::min(2, (tapped_y - 35) / 57) * 2 + (tapped_x < 170 ? 0 : 1);
 
-      // Only check periodically to allow time for the lens to move
-      if(currentTime > lastEncoderValueTime + 100)
+      if(looksSaving)
       {
-        signed short int currEncoderValue = encoderSensor.getEncoderValue();
+        LookPresets::capture(slot, "");
+        looksSaving = false;
+      }
+      else
+        LookPresets::recall(slot);
 
-        if(currEncoderValue != prevEncoderValue)
-        {
-          if(currEncoderValue < prevEncoderValue)
-          {
-            // Turned counter-clockwise
-            PacketWriter::writeFocusPositionWithOffset(-1 * freeFocusIncrement, &cameraConnection);
-            DEBUG_DEBUG("Focus counter-clockwise");
-          }
-          else
-          {
-            // Turned clockwise
-            PacketWriter::writeFocusPositionWithOffset(freeFocusIncrement, &cameraConnection);
-            DEBUG_DEBUG("Focus clockwise");
-          }
+      sliderTouch = true;
+      tappedAction = true;
+    }
+  }
+
+  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
+  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+    return;
+  else
+    lastRefreshedScreen = camera->getLastModified();
+
+  // DEBUG_DEBUG("Screen Looks Refreshed.");
+
+  sprite->fillSprite(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
+
+  // Looks label
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawString("LOOKS", 30, 9, &AgencyFB_Bold9pt7b);
+
+  if(LookPresets::getLastRecallMs() != 0 && !LookPresets::isRecalling())
+  {
+    sprite->setTextColor(TFT_LIGHTGREY);
+    sprite->drawString((std::to_string(LookPresets::getLastRecallMs()) + "ms").c_str(), 90, 10, &AgencyFB_Regular7pt7b);
+  }
+
+  // Orange while it's waiting for a look to save into
+  sprite->fillSmoothRoundRect(looksSaveButton.x, looksSaveButton.y, looksSaveButton.w, looksSaveButton.h, 3, looksSaving ? TFT_ORANGE : TFT_DARKCYAN);
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawCentreString(looksSaving ? "SAVE TO..." : "SAVE", looksSaveButton.x + looksSaveButton.w / 2, looksSaveButton.y + 5, &AgencyFB_Bold9pt7b);
+
+  // Green when the camera is on the look, orange while it's being recalled
+  for(byte slot = 0; slot < LookPresets::kMaxLooks; slot++)
+  {
+    int x = slot % 2 == 0 ? 20 : 170;
+    int y = 35 + (slot / 2) * 57;
+
+    if(!LookPresets::isUsed(slot))
+    {
+      sprite->drawRoundRect(x, y, 145, 52, 3, looksSaving ? TFT_ORANGE : TFT_DARKGREY);
+      sprite->setTextColor(TFT_DARKGREY);
+      sprite->drawCentreString("EMPTY", x + 73, y + 17, &AgencyFB_Bold9pt7b);
+      continue;
+    }
+
+    int colour = TFT_DARKGREY;
+    if(LookPresets::isRecalling() && LookPresets::getLastRecalled() == slot)
+      colour = TFT_ORANGE;
+    else if(LookPresets::matches(slot))
+      colour = TFT_DARKGREEN;
+
+    sprite->fillSmoothRoundRect(x, y, 145, 52, 3, colour);
+    if(looksSaving)
+      sprite->drawRoundRect(x, y, 145, 52, 3, TFT_ORANGE);
+
+    sprite->setTextColor(TFT_WHITE);
+    sprite->drawCentreString(LookPresets::getLook(slot).name, x + 73, y + 6, &AgencyFB_Bold9pt7b);
+    sprite->setTextColor(TFT_LIGHTGREY);
+    sprite->drawCentreString(LookPresets::getSummary(slot).c_str(), x + 73, y + 31, &AgencyFB_Regular7pt7b);
+  }
+
+  Screen_Present();
+}
+
+void Screen_Render(bool forceRefresh = false)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  switch(connectedScreenIndex)
+  {
+    case Screens::Dashboard:
+      Screen_Dashboard(forceRefresh);
+      break;
+    case Screens::Recording:
+      Screen_Recording(forceRefresh);
+      break;
+    case Screens::ISO:
+      Screen_ISO(forceRefresh);
+      break;
+    case Screens::ShutterAngleSpeed:
+      if(camera->shutterValueIsAngle)
+        Screen_ShutterAngle(forceRefresh);
+      else
+        Screen_ShutterSpeed(forceRefresh);
+      break;
+    case Screens::WhiteBalanceTint:
+      Screen_WBTint(forceRefresh);
+      break;
+    case Screens::Codec:
+      Screen_Codec(forceRefresh);
+      break;
+    case Screens::Resolution:
+      Screen_Resolution(forceRefresh);
+      break;
+    case Screens::Framerate:
+      Screen_Framerate(forceRefresh);
+      break;
+    case Screens::Media:
+      Screen_Media(forceRefresh);
+      break;
+    case Screens::Lens:
+      Screen_Lens(forceRefresh);
+      break;
+    case Screens::Looks:
+      Screen_Looks(forceRefresh);
+      break;
+  }
+}
 
-          prevEncoderValue = currEncoderValue;
-        }
+// Screen cache (UI/ScreenCache), the bottom buttons' screens are drawn in idle time so pressing one shows it straight away. They're
+// drawn again as the camera changes and the new screen is redrawn after it's shown if the camera has moved on since it was cached.
+const Screens bottomButtonScreens[] = { Screens::Dashboard, Screens::Recording, Screens::Codec };
+bool currentScreenCached = false; // The sprite holds the current screen and it's in the cache
+unsigned long lastPrerender = 0;
 
-        lastEncoderValueTime = currentTime; // Keep track of the last time we checked this so we don't do this too often
-      }
-    }
-    else
-    {
-      // Range based (Works with Pocket 6K, didn't work with URSA Mini G2)
+// Puts the sprite's frame of the current screen in the cache, it's what's put back after drawing another screen
+bool Screen_CacheCurrent()
+{
+  if(currentScreenCached && ScreenCache::has(static_cast<byte>(connectedScreenIndex), lastRefreshedScreen))
+    return true;
 
-      unsigned long currentTime = millis();
+  // Nothing drawn since the screen changed
+  if(lastRefreshedScreen == 0 || sprite->getBuffer() == nullptr)
+    return false;
 
-      // Only check periodically to allow time for the lens to move
-      if(currentTime > lastEncoderValueTime + 100)
-      {
-        signed short int currEncoderValue = encoderSensor.getEncoderValue();
+  ScreenCache::store(static_cast<byte>(connectedScreenIndex), lastRefreshedScreen, UI_FrameBuffer());
+  currentScreenCached = true;
 
-        if(currEncoderValue != prevEncoderValue)
-        {
-          // DEBUG_VERBOSE("New encoder value: %i", currEncoderValue);
+  return true;
+}
 
-          int32_t moveOffset = 0;
+// Draws a screen into the cache without showing it, the current screen is put back in the sprite afterwards
+void Screen_Prerender(Screens screen)
+{
+  if(!Screen_CacheCurrent())
+    return;
 
-          if(currEncoderValue > encoderRangeTopValue)
-          {
-            // We've moved passed the top of the window range, so adjust our range and ensure we're focused at the max value
-            encoderRangeTopValue = currEncoderValue;
-            encoderRangeBottomValue = encoderRangeTopValue - encoderRange;
+  Screens currentScreen = connectedScreenIndex;
+  unsigned long currentRefreshed = lastRefreshedScreen;
 
-            prevFocusPosition = 65435;
+  screenPrerendering = true;
+  connectedScreenIndex = screen;
+  lastRefreshedScreen = 0;
 
-            DEBUG_DEBUG("Focus Position (0-65535): %d", prevFocusPosition);
+  Screen_Render(true);
 
-            PacketWriter::writeFocusPositionWithActual(prevFocusPosition, &cameraConnection);
+  if(connectedScreenIndex == screen && lastRefreshedScreen != 0)
+    ScreenCache::store(static_cast<byte>(screen), lastRefreshedScreen, UI_FrameBuffer());
 
-            // Set the right LED to red, left to green
-            encoderSensor.setLEDColor(1, 0x001100);
-            encoderSensor.setLEDColor(2, 0x110000);
+  screenPrerendering = false;
+  connectedScreenIndex = currentScreen;
+  lastRefreshedScreen = currentRefreshed;
+  ScreenCache::restore(static_cast<byte>(currentScreen), currentRefreshed, UI_FrameBuffer());
 
-            DEBUG_VERBOSE("Encoder value window moving, range: %i to %i", encoderRangeBottomValue, encoderRangeTopValue);
-          }
-          else if(currEncoderValue < encoderRangeBottomValue)
-          {
-            // We've moved passed the bottom of the window range, so adjust our range and ensure we're focused at the min value
-            encoderRangeBottomValue = currEncoderValue;
-            encoderRangeTopValue = encoderRangeBottomValue + encoderRange;
+  lastPrerender = millis();
+}
 
-            prevFocusPosition = 100;
+// Draws one of the bottom buttons' screens if it isn't cached or is behind the camera, one each time round loop() so touch is still
+// checked in between
+void Screen_PrerenderNeighbours()
+{
+  if(!ScreenCache::isStarted() || RenderScheduler::isInvalid() || tapped_x != -1)
+    return;
 
-            DEBUG_DEBUG("Focus Position (0-65535): %d", prevFocusPosition);
+  // The current screen is drawn first
+  unsigned long version = BMDControlSystem::getInstance()->getCamera()->getLastModified();
+  if(lastRefreshedScreen != version)
+    return;
 
-            PacketWriter::writeFocusPositionWithActual(prevFocusPosition, &cameraConnection);
+  for(Screens screen : bottomButtonScreens)
+  {
+    if(screen == connectedScreenIndex || ScreenCache::has(static_cast<byte>(screen), version))
+      continue;
 
+    // Not cached yet, or behind the camera and due to be redrawn
+    unsigned long cachedVersion;
+    if(ScreenCache::get(static_cast<byte>(screen), cachedVersion) == nullptr || millis() - lastPrerender >= SCREEN_PRERENDER_MS)
+      Screen_Prerender(screen);
 
-            // Set the left LED to red, right to green
-            encoderSensor.setLEDColor(1, 0x110000);
-            encoderSensor.setLEDColor(2, 0x001100);
+    return;
+  }
+}
 
-            // DEBUG_VERBOSE("Encoder value window moving, range: %i to %i", encoderRangeBottomValue, encoderRangeTopValue);
-          }
-          else
-          {
-            // We've moving within our range, so we're adjusting focus, yay!
+// Shows a cached screen straight away, false if it isn't cached (it's then drawn on the next frame tick as before)
+bool Screen_ShowCached(Screens screen)
+{
+  unsigned long version = 0;
+  if(!ScreenCache::isStarted() || screen == connectedScreenIndex || !BMDControlSystem::getInstance()->hasCamera() || ScreenCache::get(static_cast<byte>(screen), version) == nullptr)
+    return false;
 
-            // DEBUG_VERBOSE("Position in range (0-%i): %i", encoderRange, currEncoderValue - encoderRangeBottomValue);
+  Screen_CacheCurrent();
 
-            int32_t focusDistanceLerped = static_cast<int32_t>(static_cast<float>(currEncoderValue - encoderRangeBottomValue) / static_cast<float>(encoderRange) * 65535);
+  if(sprite->getBuffer() == nullptr || !ScreenCache::restore(static_cast<byte>(screen), version, UI_FrameBuffer()))
+    return false;
 
-            // Clamping to the range [100, 65435]
-            focusDistanceLerped = std::max(100, std::min(65435, focusDistanceLerped));
+  Screen_Present();
 
-            DEBUG_VERBOSE("New focus distance lerped: %i", focusDistanceLerped);
+  // Redrawn on the next frame tick if the camera has changed since it was cached. The dashboard's tiles only redraw what changed since
+  // they were last drawn, so it's drawn in full.
+  connectedScreenIndex = screen;
+  lastRefreshedScreen = screen == Screens::Dashboard ? 0 : version;
+  currentScreenCached = true;
 
-            PacketWriter::writeFocusPositionWithActual(focusDistanceLerped, &cameraConnection);
+  return true;
+}
 
-            prevFocusPosition = focusDistanceLerped;
 
-            // LEDs both green
-            encoderSensor.setLEDColor(1, 0x001100);
-            encoderSensor.setLEDColor(2, 0x001100);
+// Sends the white balance and tint the sliders are at, the coalescer decides when it's written
+void Touch_SendWhiteBalance(unsigned long sampleMicros)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
 
-          }
+  int whiteBalance = whiteBalanceSlider.isActive() ? whiteBalanceSlider.getValue() : camera->getWhiteBalance();
+  int tint = tintSlider.isActive() ? tintSlider.getValue() : (camera->hasTint() ? camera->getTint() : 0);
 
-          prevEncoderValue = currEncoderValue;
-        }
+  CommandCoalescer::set(CommandCoalescer::Parameter::WhiteBalanceTint, whiteBalance, tint, sampleMicros);
 
-        lastEncoderValueTime = currentTime; // Keep track of the last time we checked this so we don't do this too often
-      }
-    }
+  lastRefreshedScreen = 0; // Forces a refresh, showing the new value straight away
+}
 
-  #endif
+// Gestures from the touch engine. Drags on the white balance and tint values move them, a long press on the Kelvin value is auto
+// white balance and dragging the focus strip on the lens screen moves the focus. Taps are still read straight from the touch panel.
+void Touch_Gesture(const TouchGestures::Event& gesture)
+{
+  bool connected = cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera();
+  bool onWhiteBalance = connected && connectedScreenIndex == Screens::WhiteBalanceTint;
 
+  switch(gesture.gesture)
+  {
+    case TouchGestures::Gesture::DragStart:
+      if(onWhiteBalance && BMDControlSystem::getInstance()->getCamera()->hasWhiteBalance())
+      {
+        auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
+        if(whiteBalanceSlider.contains(gesture.startX, gesture.startY))
+          whiteBalanceSlider.begin(camera->getWhiteBalance(), gesture.startX);
+        else if(tintSlider.contains(gesture.startX, gesture.startY))
+          tintSlider.begin(camera->hasTint() ? camera->getTint() : 0, gesture.startX);
+      }
 
-  // DEBUG_DEBUG("Screen Lens Refreshed.");
+      focusDragging = connected && connectedScreenIndex == Screens::Lens && focusStrip.contains(gesture.startX, gesture.startY);
+      if(focusDragging)
+        MotionEngine::cancel(MotionEngine::Axis::Focus); // The finger takes over from a rack
+      sliderTouch = whiteBalanceSlider.isActive() || tintSlider.isActive() || focusDragging;
 
-  sprite->fillScreen(TFT_BLACK);
+      if(whiteBalanceSlider.drag(gesture.x) || tintSlider.drag(gesture.x))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      else if(focusDragging)
+        CommandCoalescer::add(CommandCoalescer::Parameter::FocusOffset, gesture.deltaX * FOCUS_UNITS_PER_PIXEL, gesture.sampleMicros);
+      break;
+    case TouchGestures::Gesture::Drag:
+      if(whiteBalanceSlider.drag(gesture.x) || tintSlider.drag(gesture.x))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      else if(focusDragging)
+        CommandCoalescer::add(CommandCoalescer::Parameter::FocusOffset, gesture.deltaX * FOCUS_UNITS_PER_PIXEL, gesture.sampleMicros);
+      break;
+    case TouchGestures::Gesture::Fling:
+      if(whiteBalanceSlider.fling(gesture.velocityX) || tintSlider.fling(gesture.velocityX))
+        Touch_SendWhiteBalance(gesture.sampleMicros);
+      else if(focusDragging)
+        CommandCoalescer::add(CommandCoalescer::Parameter::FocusOffset, static_cast<int>(gesture.velocityX * 0.25f) * FOCUS_UNITS_PER_PIXEL, gesture.sampleMicros); // Carries on for a quarter of a second
+      break;
+    case TouchGestures::Gesture::DragEnd:
+      // Last value goes now
+      if(whiteBalanceSlider.isActive() || tintSlider.isActive())
+        CommandCoalescer::flush(CommandCoalescer::Parameter::WhiteBalanceTint);
+      if(focusDragging)
+        CommandCoalescer::flush(CommandCoalescer::Parameter::FocusOffset);
+
+      whiteBalanceSlider.end();
+      tintSlider.end();
+      focusDragging = false;
+      break;
+    case TouchGestures::Gesture::LongPress:
+      if(onWhiteBalance && whiteBalanceSlider.contains(gesture.x, gesture.y))
+      {
+        PacketWriter::writeAutoWhiteBalance(&cameraConnection);
+        sliderTouch = true;
+      }
+      break;
+    default:
+      break;
+  }
+}
 
-  Screen_Common_Connected(); // Common elements
+#if USING_M5_ENCODER == 1
+  // The encoder has turned, it moves the focus while the lens screen is showing. It's read quickly enough that no step is missed, the
+  // focus is written by the coalescer so a fast spin is one write each time it can send rather than one per step.
+  void Encoder_Turned(signed short int value, unsigned long sampleMicros)
+  {
+    signed short int steps = value - encoderValue; // Wraps the same way the encoder's count does
+    encoderValue = value;
 
-  // Label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("LENS", 30, 9, &AgencyFB_Bold9pt7b);
+    bool onLens = cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera() && connectedScreenIndex == Screens::Lens;
+    if(!onLens || value == prevEncoderValue)
+      return;
 
-  // M5GFX, set font here rather than on each drawString line
-  sprite->setFont(&Lato_Regular11pt7b);
+    if(freeFocus)
+    {
+      // Free Focus - rotate dial and it sends offsets to rotate the lens, they add up until they're written. Faster turns move further each step.
+      int offset = focusAccelerator.turn(steps, sampleMicros);
+      if(offset != 0)
+        CommandCoalescer::add(CommandCoalescer::Parameter::FocusOffset, offset, sampleMicros);
+    }
+    else
+    {
+      // Range based (Works with Pocket 6K, didn't work with URSA Mini G2)
+      if(value > encoderRangeTopValue)
+      {
+        // We've moved passed the top of the window range, so adjust our range and ensure we're focused at the max value
+        encoderRangeTopValue = value;
+        encoderRangeBottomValue = encoderRangeTopValue - encoderRange;
 
+        prevFocusPosition = 65435;
 
-  // Get the current encoder value
-  #if USING_M5_ENCODER
+        // Set the right LED to red, left to green
+        Encoder_SetLEDs(0x001100, 0x110000);
 
-    sprite->drawCircle(257, 63, 57, TFT_BLUE); // Outer
-    sprite->fillSmoothCircle(257, 63, 54, TFT_PURPLE); // Inner
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawCentreString(freeFocus ? "FREE" : "FOCUS", 257, 38);
-    sprite->drawCentreString(freeFocus ? "FOCUS" : "RANGE", 257, 62);
+        DEBUG_VERBOSE("Encoder value window moving, range: %i to %i", encoderRangeBottomValue, encoderRangeTopValue);
+      }
+      else if(value < encoderRangeBottomValue)
+      {
+        // We've moved passed the bottom of the window range, so adjust our range and ensure we're focused at the min value
+        encoderRangeBottomValue = value;
+        encoderRangeTopValue = encoderRangeBottomValue + encoderRange;
 
-  #else
+        prevFocusPosition = 100;
 
-    // Focus button
-    sprite->drawCircle(257, 63, 57, TFT_BLUE); // Outer
-    sprite->fillSmoothCircle(257, 63, 54, TFT_SKYBLUE); // Inner
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawCentreString("FOCUS", 257, 50);
+        // Set the left LED to red, right to green
+        Encoder_SetLEDs(0x110000, 0x001100);
+      }
+      else
+      {
+        // We've moving within our range, so we're adjusting focus, yay!
+        int32_t focusDistanceLerped = static_cast<int32_t>(static_cast<float>(value - encoderRangeBottomValue) / static_cast<float>(encoderRange) * 65535);
 
-  #endif
+        // Clamping to the range [100, 65435]
+        prevFocusPosition = std::max(100, std::min(65435, focusDistanceLerped));
 
-  sprite->drawString("LENS TYPE", 30, 53, &Lato_Regular5pt7b);
-  if(camera->hasLensType())
-  {
-    sprite->setTextColor(TFT_LIGHTGREY);
-    sprite->drawString(camera->getLensType().c_str(), 30, 35, &Lato_Regular6pt7b);
+        // LEDs both green
+        Encoder_SetLEDs(0x001100, 0x001100);
+      }
+
+      // Only the latest position is written
+      CommandCoalescer::set(CommandCoalescer::Parameter::FocusPosition, prevFocusPosition, 0, sampleMicros);
+    }
 
+    prevEncoderValue = value;
   }
+#endif
 
-  sprite->drawString("FOCAL LENGTH", 30, 98, &Lato_Regular5pt7b);
-  if(camera->hasFocalLengthMM() || camera->hasLensFocalLength())
+// Changes read by the I2C scheduler. Every touch report goes to the gesture engine with the time it was read, for dragging the sliders.
+void I2C_Event(const I2CScheduler::Event& event, bool touchToScreens)
+{
+  if(event.device == touchDevice)
   {
-    if(camera->hasFocalLengthMM())
-    {
-      auto focalLength = camera->getFocalLengthMM();
-      std::string focalLengthMM = std::to_string(focalLength);
-      std::string combined = focalLengthMM + "mm";
+    if(!touchToScreens)
+      return;
 
-      sprite->drawString(combined.c_str(), 30, 75, &Lato_Regular12pt7b);
+    if(event.data[0] != 0)
+    {
+      memcpy(&lastTouchX, &event.data[1], sizeof(lastTouchX));
+      memcpy(&lastTouchY, &event.data[3], sizeof(lastTouchY));
+      TouchGestures::sample(true, lastTouchX, lastTouchY, event.micros);
     }
-    else
-      sprite->drawString(camera->getLensFocalLength().c_str(), 30, 80, &Lato_Regular12pt7b);
+    else if(TouchGestures::isDown())
+      TouchGestures::sample(false, lastTouchX, lastTouchY, event.micros);
   }
-
-  sprite->drawString("LENS DISTANCE", 30, 143, &Lato_Regular5pt7b);
-  if(camera->hasLensDistance())
+  else if(event.device == powerDevice)
   {
-    sprite->drawString(camera->getLensDistance().c_str(), 30, 120, &Lato_Regular12pt7b);
+    coreBatteryLevel = event.data[0];
+    DEBUG_VERBOSE("CoreS3 battery %u%%%s", coreBatteryLevel, event.data[1] ? ", charging" : "");
   }
-
-  sprite->drawString("APERTURE", 30, 188, &Lato_Regular5pt7b);
-  if(camera->hasApertureFStopString())
+#if USING_M5_ENCODER == 1
+  else if(event.device == encoderDevice)
   {
-    sprite->drawString(camera->getApertureFStopString().c_str(), 30, 165, &Lato_Regular12pt7b);
+    signed short int value;
+    memcpy(&value, event.data, sizeof(value));
+    Encoder_Turned(value, event.micros);
   }
-
-  sprite->pushSprite(0, 0);
+#endif
 }
 
 
 void setup() {
 
-  // Allow a timeout of 20 seconds for time for the pass key entry.
-  esp_task_wdt_init(20, true);
+  // Pass key entry runs in loop() and doesn't hold up the Bluetooth task, so the watchdog can stay tight
+  esp_task_wdt_init(5, true);
 
   // M5CoreS3 Demo
   esp_err_t ret = nvs_flash_init();
@@ -3521,23 +2692,271 @@ void setup() {
       DEBUG_VERBOSE("Start encoder value and the range: %i, %i to %i", baseEncoderValue, encoderRangeBottomValue, encoderRangeTopValue);
   #endif
 
+  #if USING_PACKET_REPLAY == 1
+    // Send the capture to serial first so it can be saved and examined with tools/mpc_capture.py
+    PacketRecorder::dump(USBSerial, "/capture.mpc");
+
+    // No Bluetooth, the capture is decoded as if it came from a connected camera and the screens render it
+    if(PacketReplayer::begin("/capture.mpc", PACKET_REPLAY_SPEED))
+    {
+      cameraConnection.status = BMDCameraConnection::ConnectionStatus::Connected;
+      return;
+    }
+  #endif
+
+  #if USING_PACKET_RECORDER == 1
+    PacketRecorder::begin("/capture.mpc");
+  #endif
+
   // Prepare for Bluetooth connections and start scanning for cameras
   cameraConnection.initialise(touch, &M5.Display, IWIDTH, IHEIGHT); // Screen Pass Key entry
+  LinkHealthMonitor::begin(&cameraConnection); // Watches the link once connected
+  MotionEngine::begin(&cameraConnection); // Rack focus moves
+  Timeline::begin(&cameraConnection); // Keyframed passes
+  ExposureEngine::begin(&cameraConnection); // Exposure kept through ISO, shutter and iris changes
+  SpeedRamp::begin(&cameraConnection); // Off-speed frame rate ramps
+  LookPresets::begin(&cameraConnection); // Saved looks, from NVS
+  Timeline::load(TIMELINE_PATH);
+  CommandCoalescer::begin(&cameraConnection); // Values from dragging sliders
+
+#if USING_DISPLAY_PRESENTER == 1
+  DisplayPresenter::begin({ Presenter_BeginTransfers, Presenter_Transfer, Presenter_Busy, Presenter_EndTransfers }, IWIDTH, IHEIGHT, DisplayPresenter::PixelFormat::RGB565Swapped, 24, true);
+#endif
+
+  RenderScheduler::begin(RENDER_TARGET_FPS, INPUT_SAMPLES_PER_SECOND);
+
+  // Touch goes ahead of everything else on the bus, the encoder is read steadily and the power chip now and again. Changes wake loop().
+  touchDevice = I2CScheduler::addDevice("Touch", I2CScheduler::Priority::Touch, 1000000 / INPUT_SAMPLES_PER_SECOND, I2C_ReadTouch);
+  #if USING_M5_ENCODER == 1
+    encoderValue = baseEncoderValue;
+    encoderDevice = I2CScheduler::addDevice("Encoder", I2CScheduler::Priority::Input, 1000000 / ENCODER_SAMPLES_PER_SECOND, I2C_ReadEncoder);
+  #endif
+  powerDevice = I2CScheduler::addDevice("Power", I2CScheduler::Priority::Status, POWER_POLL_MS * 1000UL, I2C_ReadPower);
+  I2CScheduler::begin(0, RenderScheduler::wake);
+
+  // Shared screens are laid out once, they use the 320 x 170 area above the bottom buttons
+  ISOScreen::layout(320, 170);
+  ShutterAngleScreen::layout(320, 170);
+  ShutterSpeedScreen::layout(320, 170);
+  WhiteBalanceScreen::layout(320, 170);
+  CodecScreen::layout(320, 170);
+  ResolutionScreen::layout(320, 170);
+  MediaScreen::layout(320, 170);
+
+  // Tiles go in PSRAM
+  if(TILE_CACHE_BYTES > 0)
+    TileCache::begin(TILE_CACHE_BYTES);
+
+  // As do the cached screens
+  if(SCREEN_CACHE_FRAMES > 0)
+    ScreenCache::begin(IWIDTH_SPRITE * IHEIGHT_SPRITE * BPP_SPRITE / 8, SCREEN_CACHE_FRAMES);
+
+#if USING_LVGL == 1
+  // LVGL has the display once connected, the sprite still draws the pass key and connection screens
+  lv_init();
+  m5gfx_lvgl_init();
+  m5gfx_lvgl_set_touch_reader(LVGL_ReadTouch);
+  LVGLScreens::begin(&cameraConnection);
+  LVGLScreens::setRackFocus(RACK_FOCUS_A, RACK_FOCUS_B, RACK_FOCUS_MS);
+#endif
+}
+
+// Commands from serial, in the same "(COMMAND:VALUE)" form as the TouchDesigner version, not case sensitive:
+// TIMELINE:PLAY, TIMELINE:STOP                 Plays the timeline from the start (or the timecode), or stops it
+// TIMELINE:LOAD, TIMELINE:SAVE                 Reads or writes TIMELINE_PATH on FFat
+// TIMELINE:CLEAR                               Empties it, ready for TIMELINEADD
+// TIMELINE:LIST                                Writes it out in the file's format
+// TIMELINEADD:line                             Adds a line of a timeline file, e.g. (TIMELINEADD:4.5,FOCUS,0.8,SCURVE)
+// EXPOSEIRIS:fstop[,milliseconds]              Changes the iris keeping the exposure, e.g. (EXPOSEIRIS:1.8,2000)
+// EXPOSEISO:iso[,milliseconds]                 The same for ISO
+// EXPOSESHUTTER:value[,milliseconds]           The same for the shutter, degrees or 1/x as the camera is using
+// SPEEDRAMP:to,milliseconds[,easing[,from]]    Ramps the off-speed frame rate, e.g. (SPEEDRAMP:120,4000,SCURVE,24)
+// SPEEDRAMPDRY:to,milliseconds[,easing[,from]] Writes out the steps the ramp would send, sends nothing
+// SPEEDRAMP:STOP                               Stops the ramp at the rate it has got to
+// LOOK:look                                    Recalls a look, by its number (1 to 6) or name, e.g. (LOOK:INTERVIEW)
+// LOOKSAVE:number[,name]                       Saves the camera's settings as a look, e.g. (LOOKSAVE:2,B-ROLL)
+// LOOKDELETE:look                              Deletes a look
+// LOOKLIST:0                                   Writes out the looks
+void Serial_RunCommand(std::string command, std::string value)
+{
+  std::string upperValue = value;
+  for(char& c : command)
+    c = std::toupper(c);
+  for(char& c : upperValue)
+    c = std::toupper(c);
+
+  if(command == "TIMELINE")
+  {
+    if(upperValue == "PLAY" || upperValue == "START")
+      Timeline::start();
+    else if(upperValue == "STOP")
+      Timeline::stop();
+    else if(upperValue == "LOAD")
+      Timeline::load(TIMELINE_PATH);
+    else if(upperValue == "SAVE")
+      Timeline::save(TIMELINE_PATH);
+    else if(upperValue == "CLEAR")
+      Timeline::clear();
+    else if(upperValue == "LIST")
+      Timeline::print(USBSerial);
+    else
+      DEBUG_ERROR("Unknown timeline command: %s", value.c_str());
+  }
+  else if(command == "TIMELINEADD")
+    Timeline::addLine(value.c_str());
+  else if(command == "EXPOSEISO" || command == "EXPOSESHUTTER" || command == "EXPOSEIRIS")
+  {
+    float target = 0;
+    unsigned long durationMs = 0;
+    if(sscanf(value.c_str(), "%f,%lu", &target, &durationMs) < 1)
+    {
+      DEBUG_ERROR("Not a valid exposure change, value[,milliseconds]: %s", value.c_str());
+      return;
+    }
+
+    ExposureEngine::Parameter parameter = command == "EXPOSEISO" ? ExposureEngine::Parameter::ISO : (command == "EXPOSESHUTTER" ? ExposureEngine::Parameter::Shutter : ExposureEngine::Parameter::Iris);
+    ExposureEngine::transitionTo(parameter, target, durationMs);
+  }
+  else if(command == "SPEEDRAMP" && upperValue == "STOP")
+    SpeedRamp::stop();
+  else if(command == "LOOK" || command == "LOOKDELETE")
+  {
+    int slot = LookPresets::parseSlot(value.c_str());
+    if(slot == -1)
+    {
+      DEBUG_ERROR("No look %s", value.c_str());
+      return;
+    }
+
+    if(command == "LOOK")
+      LookPresets::recall(slot);
+    else
+      LookPresets::remove(slot);
+  }
+  else if(command == "LOOKSAVE")
+  {
+    // A number, or the name of a look to save over, then the name to give it
+    size_t comma = value.find(',');
+    int slot = LookPresets::parseSlot(value.substr(0, comma).c_str());
+    if(slot == -1)
+    {
+      DEBUG_ERROR("Not a valid look, number[,name]: %s", value.c_str());
+      return;
+    }
+
+    LookPresets::capture(slot, comma != std::string::npos ? value.substr(comma + 1).c_str() : "");
+  }
+  else if(command == "LOOKLIST")
+    LookPresets::print(USBSerial);
+  else if(command == "SPEEDRAMP" || command == "SPEEDRAMPDRY")
+  {
+    int toFrameRate = 0;
+    int fromFrameRate = 0;
+    unsigned long durationMs = 0;
+    char easingName[12] = "SCURVE";
+    MotionEngine::Easing easing = MotionEngine::Easing::SCurve;
+
+    if(sscanf(value.c_str(), "%i,%lu,%11[^,],%i", &toFrameRate, &durationMs, easingName, &fromFrameRate) < 2 || !MotionEngine::parseEasing(easingName, easing))
+    {
+      DEBUG_ERROR("Not a valid speed ramp, to,milliseconds[,easing[,from]]: %s", value.c_str());
+      return;
+    }
+
+    if(command == "SPEEDRAMPDRY")
+      SpeedRamp::dryRun(fromFrameRate, toFrameRate, durationMs, easing, USBSerial);
+    else if(fromFrameRate != 0)
+      SpeedRamp::start(fromFrameRate, toFrameRate, durationMs, easing);
+    else
+      SpeedRamp::startTo(toFrameRate, durationMs, easing);
+  }
+  else
+  {
+    DEBUG_ERROR("Unknown command: %s", command.c_str());
+    return;
+  }
+
+  lastRefreshedScreen = 0; // The recording screen shows the timeline
+}
+
+void Serial_Commands()
+{
+  while(USBSerial.available())
+  {
+    char incomingChar = static_cast<char>(USBSerial.read());
+
+    if(incomingChar == '(')
+    {
+      serialCommand = "";
+      serialCommandStarted = true;
+    }
+    else if(incomingChar == ')' && serialCommandStarted)
+    {
+      serialCommandStarted = false;
+
+      // The command and its value are either side of the first colon, timecodes in the value have colons of their own
+      size_t colon = serialCommand.find(':');
+      if(colon != std::string::npos)
+        Serial_RunCommand(serialCommand.substr(0, colon), serialCommand.substr(colon + 1));
+    }
+    else if(serialCommandStarted && serialCommand.length() < 80)
+      serialCommand += incomingChar;
+  }
 }
 
 int memoryLoopCounter;
 
 void loop() {
 
+  // Taps are kept until a screen has been drawn to pick them up
+  bool inputConsumed = true;
+
+  // The camera is waiting for a pass key, its entry screen has the display and input until it's answered
+  if(cameraConnection.servicePassKey())
+  {
+    connectedScreenIndex = Screens::PassKey; // Screens are drawn in full again afterwards
+    I2CScheduler::clear(); // Its taps aren't for the screen underneath
+    delay(10);
+    return;
+  }
+
   memoryLoopCounter++;
 
-  static unsigned long lastConnectedTime = 0;
-  const unsigned long reconnectInterval = 5000;  // 5 seconds (milliseconds)
+  #if USING_PACKET_REPLAY == 1
+    PacketReplayer::service();
+  #endif
+
+  // Refresh the screen when the link health changes so the sidebar shows it
+  if(LinkHealthMonitor::update())
+  {
+    lastRefreshedScreen = 0;
+    ScreenCache::invalidate();
+  }
+
+  Serial_Commands();
+
+  // The timeline writes the keyframes that are due and starts the lens moves between them, the recording screen shows if it's playing
+  if(Timeline::service())
+    lastRefreshedScreen = 0;
+
+  // A rack focus writes its next position, the lens screen's button changes back once it's done
+  if(MotionEngine::service())
+    lastRefreshedScreen = 0;
+
+  // An exposure change sends its next step
+  if(ExposureEngine::service())
+    lastRefreshedScreen = 0;
+
+  // A speed ramp sends its next frame rate once the camera has echoed the last
+  if(SpeedRamp::service())
+    lastRefreshedScreen = 0;
 
-  unsigned long currentTime = millis();
+  // A look's recall has been echoed, the looks screen shows the camera on it
+  if(LookPresets::service())
+    lastRefreshedScreen = 0;
 
-  if (cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected && currentTime - lastConnectedTime >= reconnectInterval) {
-    DEBUG_VERBOSE("Disconnected for too long, trying to reconnect");
+  // The connection works out when to try again, backing off while no camera is found
+  if (cameraConnection.reconnectDue()) {
+    DEBUG_VERBOSE("Not connected, trying to reconnect");
 
     // Set the status to Scanning and then show the NoConnection screen to render the Scanning page before starting the scan (which blocks so it can't render the Scanning page before it finishes)
     cameraConnection.status = BMDCameraConnection::ConnectionStatus::Scanning;
@@ -3552,88 +2971,119 @@ void loop() {
   {
     auto camera = BMDControlSystem::getInstance()->getCamera();
 
+    #if TIMELINE_START_ON_RECORD == 1
+      // Each take plays the timeline from the start
+      if(camera->isRecording && !timelineWasRecording && Timeline::getKeyframeCount() != 0)
+      {
+        Timeline::stop();
+        Timeline::start();
+      }
+    #endif
+    timelineWasRecording = camera->isRecording;
+
     if(static_cast<byte>(connectedScreenIndex) >= 100)
     {
       // Check if the initial payload has been fully received and if it was after the camera's last modified time, update the camera's modified time
       if(cameraConnection.getInitialPayloadTime() != ULONG_MAX && cameraConnection.getInitialPayloadTime() > camera->getLastModified())
         camera->setLastModified();
 
-      switch(connectedScreenIndex)
+#if USING_LVGL == 1
+      // Widgets are updated with camera changes, LVGL redraws and sends just the areas that changed. Touch goes to LVGL.
+      if(lastRefreshedScreen != camera->getLastModified())
       {
-        case Screens::Dashboard:
-          Screen_Dashboard();
-          break;
-        case Screens::Recording:
-          Screen_Recording();
-          break;
-        case Screens::ISO:
-          Screen_ISO();
-          break;
-        case Screens::ShutterAngleSpeed:
-          if(camera->shutterValueIsAngle)
-            Screen_ShutterAngle();
-          else
-            Screen_ShutterSpeed();
-          break;
-        case Screens::WhiteBalanceTint:
-          Screen_WBTint();
-          break;
-        case Screens::Codec:
-          Screen_Codec();
-          break;
-        case Screens::Resolution:
-          Screen_Resolution();
-          break;
-        case Screens::Framerate:
-          Screen_Framerate();
-          break;
-        case Screens::Media:
-          Screen_Media();
-          break;
-        case Screens::Lens:
-          Screen_Lens();
-          break;
+        if(lastRefreshedScreen == 0)
+        {
+          // The sprite screens may have been drawing, everything is redrawn once they're done
+          DisplayPresenter::waitIdle();
+          LVGLScreens::invalidateAll();
+        }
+
+        LVGLScreens::update(camera);
+        lastRefreshedScreen = camera->getLastModified();
+      }
+
+      lv_timer_handler();
+
+      if(Debug.getDebugLevel() >= DBG_VERBOSE && memoryLoopCounter % 4000 == 0)
+        LVGLScreens::reportStats();
+#else
+      // Camera changes, screen changes and taps invalidate the screen, it's drawn on the next frame tick
+      if(lastRefreshedScreen != camera->getLastModified() || tapped_x != -1)
+        RenderScheduler::invalidate();
+
+      inputConsumed = RenderScheduler::frameDue();
+      if(inputConsumed)
+      {
+        Screen_Render();
+        currentScreenCached = false;
       }
+#endif
     }
     else
+    {
+#if USING_LVGL == 1
+      // Was on disconnected screen, LVGL shows the dashboard from the next loop
+      connectedScreenIndex = Screens::Dashboard;
+      lastRefreshedScreen = 0;
+#else
       Screen_Dashboard(true); // Was on disconnected screen, now we're connected go to the dashboard
-
-    lastConnectedTime = currentTime;
+#endif
+    }
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningFound)
   {
     Screen_NoConnection();
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningNoneFound)
   {
     DEBUG_VERBOSE("Status Scanning NONE Found. Marking as Disconnected.");
     cameraConnection.status = BMDCameraConnection::Disconnected;
-    lastConnectedTime = currentTime;
 
     Screen_NoConnection();
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
   {
-    // Pass Key failed, so show it and then delay for 2 seconds and reset status to disconnected.
+    // Pass Key failed, shown until reconnectDue() resets it to disconnected
     Screen_NoConnection();
-
-    delay(2000);
-
-    cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected;
   }
 
   // Reset tapped point
-  tapped_x = -1;
-  tapped_y = -1;
+  if(inputConsumed)
+  {
+    tapped_x = -1;
+    tapped_y = -1;
+  }
 
-  // Touch
+  // Touch, the encoder and the power chip have been read on the I2C scheduler's task. LVGL takes touch itself while it has the screen.
+  bool touchToScreens = USING_LVGL == 0 || cameraConnection.status != BMDCameraConnection::ConnectionStatus::Connected || static_cast<byte>(connectedScreenIndex) < 100;
+
+  I2CScheduler::Event i2cEvent;
+  while(I2CScheduler::poll(i2cEvent))
+    I2C_Event(i2cEvent, touchToScreens);
+
+  // Taps go by whether a finger is down now
   lgfx::touch_point_t tp[3];
-  int nums = M5.Display.getTouchRaw(tp, 3);
+  int nums = 0;
+  I2CScheduler::Event touchState;
+  if(touchToScreens && I2CScheduler::latest(touchDevice, touchState) && touchState.data[0] != 0)
+  {
+    memcpy(&tp[0].x, &touchState.data[1], sizeof(tp[0].x));
+    memcpy(&tp[0].y, &touchState.data[3], sizeof(tp[0].y));
+    nums = 1;
+  }
 
-  // Is there a touch event available?
-  if (nums)
+  TouchGestures::Event gesture;
+  while(TouchGestures::poll(gesture))
+    Touch_Gesture(gesture);
+
+  CommandCoalescer::service();
+
+  // Finger lifted, the next touch may be a tap again
+  if(!nums)
+    sliderTouch = false;
+
+  // Is there a touch event available? Not while it's dragging a slider, it may pass over buttons.
+  if (nums && !sliderTouch)
   {
     for (int i = 0; i < nums; ++i)
     {
@@ -3649,22 +3099,46 @@ void loop() {
     }
 
     // If they have tapped on the bottom left button area, then take them to the dashboard
+    Screens bottomButtonScreen = connectedScreenIndex;
     if(tapped_x > 0 && tapped_x <= 100 && tapped_y > 220)
-    {
-        connectedScreenIndex = Screens::Dashboard;
-        lastRefreshedScreen = 0; // Forces a refresh
-    }
+      bottomButtonScreen = Screens::Dashboard;
     else if(tapped_x > 100 && tapped_x <= 220 && tapped_y > 220) // Recording page
-    {
-        connectedScreenIndex = Screens::Recording;
-        lastRefreshedScreen = 0; // Forces a refresh
-    }
+      bottomButtonScreen = Screens::Recording;
     else if(tapped_x > 220 && tapped_x <= 320 && tapped_y > 220) // Codec Page
+      bottomButtonScreen = Screens::Codec;
+
+    if(tapped_y > 220 && tapped_x > 0 && tapped_x <= 320)
     {
-        connectedScreenIndex = Screens::Codec;
+      // A cached screen is already showing, the tap has been dealt with
+      if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && Screen_ShowCached(bottomButtonScreen))
+      {
+        tapped_x = -1;
+        tapped_y = -1;
+      }
+      else
+      {
+        connectedScreenIndex = bottomButtonScreen;
         lastRefreshedScreen = 0; // Forces a refresh
+      }
     }
   }
 
-  delay(5);
+  // Idle, draw the bottom buttons' screens so they're ready
+  if(USING_LVGL == 0 && cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && static_cast<byte>(connectedScreenIndex) >= 100)
+    Screen_PrerenderNeighbours();
+
+  if(Debug.getDebugLevel() >= DBG_VERBOSE && memoryLoopCounter % 4000 == 0)
+  {
+    TouchGestures::reportStats();
+    CommandCoalescer::reportStats();
+    I2CScheduler::reportStats();
+    MotionEngine::reportStats();
+    Timeline::reportStats();
+    ExposureEngine::reportStats();
+    SpeedRamp::reportStats();
+    LookPresets::reportStats();
+  }
+
+  // Sleep until the next input sample or frame tick
+  RenderScheduler::waitForNextTick();
 }
\ No newline at end of file
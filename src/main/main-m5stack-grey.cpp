@@ -1,6 +1,13 @@
 #define USING_TFT_ESPI 0          // Not using the TFT_eSPI graphics library <-- must include this in every main file, 0 = not using, 1 = using
 #define USING_M5GFX 0             // Using the M5GFX library with touch screen
 #define USING_M5_BUTTONS 1        // Using the M5GFX library with the 3 buttons (buttons A, B, C)
+#define USING_DISPLAY_PRESENTER 1 // 1 = Send frames to the display over DMA from a background task, 0 = Push them directly
+#define RENDER_TARGET_FPS 30      // Most frames drawn per second, nothing is drawn while the screen is unchanged
+#define INPUT_SAMPLES_PER_SECOND 200 // How often the buttons are checked
+#define TILE_CACHE_BYTES (24 * 1024) // Memory for pre-drawn buttons, 0 = draw them every time
+#define USING_BAND_RENDERER 1     // 1 = Shared screens are drawn in bands through a small buffer instead of the full screen sprite
+#define BAND_ROWS 12              // Rows in each band, there are two bands of 320 x BAND_ROWS 16 bit pixels
+#define BENCHMARK_BAND_RENDERER 0 // 1 = Also draw band rendered screens in the full sprite and log both times and memory
 
 #define OUTPUT_CAMERA_SETTINGS 1  // 1 = Outputs camera settings through serial (so other applications can read them)
 
@@ -44,10 +51,27 @@ static LGFX_Sprite *sprite;
 #include "CCU/CCUPacketTypes.h"
 #include "CCU/CCUValidationFunctions.h"
 #include "Camera/BMDCameraConnection.h"
+#include "Camera/LinkHealthMonitor.h"
+#include "Camera/LookPresets.h"
 #include "Camera/BMDCamera.h"
 #include "BMDControlSystem.h"
 
-// Include the watchdog library so we can stop it timing out while pass key entry.
+// UI
+#include "UI/DisplayPresenter.h"
+#include "UI/RenderScheduler.h"
+#include "UI/UIScreen.h"
+#include "UI/ISOScreen.h"
+#include "UI/ShutterAngleScreen.h"
+#include "UI/ShutterSpeedScreen.h"
+#include "UI/WhiteBalanceScreen.h"
+#include "UI/CodecScreen.h"
+#include "UI/ResolutionScreen.h"
+#include "UI/MediaScreen.h"
+#include "UI/TileCache.h"
+#include "UI/BandRenderer.h"
+#include "UI/InputQueue.h"
+
+// Include the watchdog library to set its timeout
 #include "esp_task_wdt.h"
 
 // Lato font from Google Fonts
@@ -125,7 +149,8 @@ enum class Screens : byte
   Media = 108,
   Lens = 109,
   Slate = 110,
-  Project = 111
+  Project = 111,
+  Looks = 112
 };
 
 Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen we're on:
@@ -141,6 +166,7 @@ Screens connectedScreenIndex = Screens::NoConnection; // The index of the screen
 // 107 is Resolution (one for each camera group, 4K, 6K/G2/Pro, Mini Pro G2, Mini Pro 12K)
 // 108 is Media
 // 109 is Lens
+// 112 is Looks
 // 124 is WB / Tint - Edit Tint
 
 // Keep track of the last camera modified time that we refreshed a screen so we don't keep refreshing a screen when the camera object remains unchanged.
@@ -150,6 +176,216 @@ static unsigned long lastRefreshedScreen = 0;
 bool btnAPressed = false;
 bool btnBPressed = false;
 
+// Buttons A, B and C (left to right) are read through their interrupts, they have their own pull up resistors
+#define BUTTON_A_PIN 39
+#define BUTTON_B_PIN 38
+#define BUTTON_C_PIN 37
+
+enum class Buttons : byte
+{
+  A = 0,
+  B = 1,
+  C = 2
+};
+
+InputQueue::Event pendingButton; // The press behind btnAPressed / btnBPressed, timed when a screen has acted on it
+
+// Display presenter backend, bands go out with DMA. Transfers are kept in one write transaction as ending it waits for the DMA.
+void Presenter_BeginTransfers()
+{
+  tft.startWrite();
+}
+
+void Presenter_Transfer(short x, short y, short w, short h, const uint16_t* pixels)
+{
+  tft.pushImageDMA(x, y, w, h, reinterpret_cast<const lgfx::swap565_t*>(pixels));
+}
+
+bool Presenter_Busy()
+{
+  return tft.dmaBusy();
+}
+
+void Presenter_EndTransfers()
+{
+  tft.endWrite();
+}
+
+// Sends the whole frame to the display
+void Screen_Present()
+{
+  if(DisplayPresenter::isStarted())
+    DisplayPresenter::presentFull(sprite->getBuffer());
+  else
+    sprite->pushSprite(0, 0);
+}
+
+// Shared UI (UI/UIScreen.h) drawing for this display
+uint32_t UI_Colour(UIColour colour)
+{
+  switch(colour)
+  {
+    case UIColour::Text:
+      return TFT_WHITE;
+    case UIColour::Button:
+      return TFT_DARKGREY;
+    case UIColour::ButtonSelected:
+      return TFT_DARKGREEN;
+    case UIColour::Alert:
+      return TFT_RED;
+    default:
+      return TFT_BLACK;
+  }
+}
+
+void UI_FillRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  sprite->fillSmoothRoundRect(x, y, w, h, radius, UI_Colour(colour));
+}
+
+void UI_DrawRoundRect(short x, short y, short w, short h, short radius, UIColour colour)
+{
+  sprite->drawRoundRect(x, y, w, h, radius, UI_Colour(colour));
+}
+
+void UI_DrawText(const char* text, short x, short y, UITextStyle style, UITextAlign align, UIColour background)
+{
+  const GFXfont* font = &Lato_Regular11pt7b;
+  if(style == UITextStyle::Title)
+    font = &AgencyFB_Bold9pt7b;
+  else if(style == UITextStyle::Caption)
+    font = &Lato_Regular5pt7b;
+
+  // Text is drawn with a transparent background on these displays
+  sprite->setTextColor(TFT_WHITE);
+  sprite->setTextDatum(align == UITextAlign::Centre ? MC_DATUM : TL_DATUM);
+  sprite->drawString(text, x, y, font);
+  sprite->setTextDatum(TL_DATUM);
+}
+
+// Images named by the shared screens' icon buttons, with the version drawn on the selected button colour
+struct UIIcon
+{
+  const char* name;
+  const unsigned short* image;
+  const unsigned short* selectedImage;
+};
+
+const UIIcon uiIcons[] =
+{
+  { "WBBright", WBBright, WBBrightBG },
+  { "WBIncandescent", WBIncandescent, WBIncandescentBG },
+  { "WBFlourescent", WBFlourescent, WBFlourescentBG },
+  { "WBMixedLight", WBMixedLight, WBMixedLightBG },
+  { "WBCloud", WBCloud, WBCloudBG }
+};
+
+void UI_DrawIcon(const char* name, short x, short y, bool selected)
+{
+  for(const UIIcon& icon : uiIcons)
+  {
+    // Icons are 30 x 30, x and y are the middle
+    if(strcmp(icon.name, name) == 0)
+    {
+      sprite->pushImage(x - 15, y - 15, 30, 30, selected ? icon.selectedImage : icon.image);
+      return;
+    }
+  }
+}
+
+uint8_t* UI_FrameBuffer()
+{
+  return static_cast<uint8_t*>(sprite->getBuffer());
+}
+
+const UIBackend uiBackend = { UI_FillRoundRect, UI_DrawText, UI_DrawRoundRect, UI_DrawIcon, UI_FrameBuffer, IWIDTH_SPRITE, IHEIGHT_SPRITE, BPP_SPRITE / 8 };
+
+#if USING_BAND_RENDERER == 1
+// Band renderer (UI/BandRenderer), screens draw into bandSprite which is pointed at each band buffer in turn. The buffer is offset
+// so the sprite's coordinates are the screen's, and drawing is clipped to the band's rows.
+LGFX_Sprite bandSprite(&tft);
+
+void Band_BeginTransfers()
+{
+  // Anything the presenter is still sending goes out first
+  DisplayPresenter::waitIdle();
+  tft.startWrite();
+}
+
+void Band_Begin(uint8_t* buffer, short top, short rows)
+{
+  bandSprite.setBuffer(buffer - top * IWIDTH * sizeof(uint16_t), IWIDTH, IHEIGHT, 16);
+  bandSprite.setClipRect(0, top, IWIDTH, rows);
+  sprite = &bandSprite;
+}
+
+// No frame buffer, the tile cache copies buttons out of a full frame
+const UIBackend uiBandBackend = { UI_FillRoundRect, UI_DrawText, UI_DrawRoundRect, UI_DrawIcon, nullptr, IWIDTH, IHEIGHT, 2 };
+#endif
+
+// The UI backend for whatever the screen is drawing into
+const UIBackend& Screen_UIBackend()
+{
+#if USING_BAND_RENDERER == 1
+  if(sprite == &bandSprite)
+    return uiBandBackend;
+#endif
+
+  return uiBackend;
+}
+
+// The full screen sprite is freed while a band rendered screen is showing, screens that draw in it get it back here
+bool Screen_UseSprite()
+{
+  if(sprite->getBuffer() != nullptr)
+    return true;
+
+  return sprite->createSprite(IWIDTH_SPRITE, IHEIGHT_SPRITE) != nullptr;
+}
+
+// Draws a screen in bands if the band renderer is running, otherwise in the full screen sprite. drawScreen must only draw, it's
+// called once for each band.
+void Screen_Draw(void (*drawScreen)())
+{
+#if USING_BAND_RENDERER == 1
+  if(BandRenderer::isStarted())
+  {
+#if BENCHMARK_BAND_RENDERER == 1
+    // The same frame through the full 8 bit sprite, to compare against
+    unsigned long spriteMicros = 0;
+    if(Screen_UseSprite())
+    {
+      unsigned long start = micros();
+      drawScreen();
+      Screen_Present();
+      DisplayPresenter::waitIdle();
+      spriteMicros = micros() - start;
+    }
+#endif
+
+    // Its memory goes back to the heap until a screen needs the full sprite again
+    LGFX_Sprite* screenSprite = sprite;
+    DisplayPresenter::waitIdle();
+    screenSprite->deleteSprite();
+
+    BandRenderer::render(drawScreen);
+    sprite = screenSprite;
+
+#if BENCHMARK_BAND_RENDERER == 1
+    DEBUG_INFO("Full %d bit sprite: %d bytes, %luus", BPP_SPRITE, IWIDTH_SPRITE * IHEIGHT_SPRITE * BPP_SPRITE / 8, spriteMicros);
+    BandRenderer::reportStats(IWIDTH_SPRITE * IHEIGHT_SPRITE * BPP_SPRITE / 8);
+#endif
+    return;
+  }
+#endif
+
+  if(!Screen_UseSprite()) return;
+
+  drawScreen();
+
+  Screen_Present();
+}
+
 // Display elements on the screen common to all pages
 void Screen_Common(int sideBarColour)
 {
@@ -231,6 +467,13 @@ void Screen_Common(int sideBarColour)
             sprite->fillSmoothRoundRect(30, 210, 80, 40, 3, TFT_DARKCYAN);
             sprite->drawCenterString("FOCUS", 70, 217, &AgencyFB_Bold9pt7b);
             break;
+          case Screens::Looks:
+            sprite->fillSmoothRoundRect(30, 210, 80, 40, 3, TFT_DARKCYAN);
+            sprite->drawCenterString("LOOK >", 70, 217, &AgencyFB_Bold9pt7b);
+
+            sprite->fillSmoothRoundRect(120, 210, 80, 40, 3, TFT_DARKCYAN);
+            sprite->drawCenterString("SAVE", 160, 217, &AgencyFB_Bold9pt7b);
+            break;
         }
       }
 
@@ -244,7 +487,12 @@ void Screen_Common_Connected()
 {
   if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Connected && BMDControlSystem::getInstance()->hasCamera())
   {
-    Screen_Common(cameraConnection.getInitialPayloadTime() < millis() ? TFT_GREEN : TFT_DARKGREY);
+    // Sidebar is grey until we have the camera's details, then shows the health of the link
+    int sideBarColour = TFT_DARKGREY;
+    if(cameraConnection.getInitialPayloadTime() < millis())
+      sideBarColour = LinkHealthMonitor::getSidebarColour(LinkHealthMonitor::getLevel());
+
+    Screen_Common(sideBarColour);
 
     // Show the recording outline
     if(BMDControlSystem::getInstance()->getCamera()->isRecording)
@@ -360,16 +608,11 @@ void Screen_NoConnection()
 
   if(connectToCameraIndex != -1)
   {
-    cameraConnection.connect(cameraConnection.cameraAddresses[connectToCameraIndex]);
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[connectToCameraIndex]);
     connectToCameraIndex = -1;
-
-    if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
-    {
-      DEBUG_DEBUG("NoConnection - Failed Pass Key");
-    }
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 short testFocusPosition = 18;
@@ -567,7 +810,7 @@ void Screen_Dashboard(bool forceRefresh = false)
     }
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 void Screen_Recording(bool forceRefresh = false)
@@ -616,6 +859,8 @@ void Screen_Recording(bool forceRefresh = false)
 
   DEBUG_DEBUG("Screen Recording Refreshed.");
 
+  if(!Screen_UseSprite()) return;
+
   sprite->fillSprite(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
@@ -648,7 +893,17 @@ void Screen_Recording(bool forceRefresh = false)
     }
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
+}
+
+// Drawing only, it's called for each band when band rendering
+void Screen_ISO_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
+
+  ISOScreen::draw(Screen_UIBackend());
 }
 
 void Screen_ISO(bool forceRefresh = false)
@@ -662,57 +917,16 @@ void Screen_ISO(bool forceRefresh = false)
 
   // If we have an up/down button press
   bool tappedAction = false;
-  std::vector<int> Options_ISO = {200, 400, 640, 800, 1250, 3200, 8000, 12800};
-  int Options_ISO_SelectingIndex = -1; // when using up/down buttons keeps track of what option you are navigating to
   if(btnAPressed || btnBPressed)
   {
     if(camera->hasSensorGainISOValue()) // Ensure we have the ISO value before allowing it to be changed
     {
-      int currentValue = camera->getSensorGainISOValue();
-
       bool up = btnBPressed; // up = true, down = false
 
-      // Find the closest ISO (particularly if it's not the standard set)
-      int closestValue = Options_ISO[0];
-      int minDifference = std::abs(currentValue - closestValue);
-
-      for (int i = 1; i < Options_ISO.size(); ++i) {
-          int difference = std::abs(currentValue - Options_ISO[i]);
-          if (difference < minDifference) {
-              minDifference = difference;
-              closestValue = Options_ISO[i];
-          }
-      }
-
-      auto iter = std::find(Options_ISO.begin(), Options_ISO.end(), closestValue);
-      // Get the closest ISO
-      if (iter != Options_ISO.end()) {
-          Options_ISO_SelectingIndex = std::distance(Options_ISO.begin(), iter);
-      }
-
-      DEBUG_DEBUG("Options_ISO_SelectingIndex");
-      DEBUG_DEBUG(std::to_string(Options_ISO_SelectingIndex).c_str());
-
-      if(Options_ISO_SelectingIndex != -1)
-      {
-        Options_ISO_SelectingIndex = Options_ISO_SelectingIndex + (up ? 1 : -1); // Move the selected option
-
-        if(Options_ISO_SelectingIndex < 0)
-        {
-          // Down button on the first option, go to the last option
-          Options_ISO_SelectingIndex = Options_ISO.size() -1;
-        }
-        else if(Options_ISO_SelectingIndex > (Options_ISO.size() - 1))
-        {
-          // Up button on the last option, go to the first option
-          Options_ISO_SelectingIndex = 0;
-        }
-
-        // ISO selected, send it to the camera
-        PacketWriter::writeISO(Options_ISO[Options_ISO_SelectingIndex], &cameraConnection);
+      // ISO selected, send it to the camera
+      PacketWriter::writeISO(ISOScreen::getNextOption(camera->getSensorGainISOValue(), up), &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -721,83 +935,28 @@ void Screen_ISO(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen ISO Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
 
-  // M5GFX, set font here rather than on each drawString line
-  sprite->setFont(&Lato_Regular11pt7b);
+  DEBUG_DEBUG("Screen ISO Refreshed.");
 
   // Get the current ISO value
   int currentISO = 0;
   if(camera->hasSensorGainISOValue())
     currentISO = camera->getSensorGainISOValue();
 
-  // ISO label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("ISO", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // sprite->textbgcolor = TFT_DARKGREY;
-
-  // 200
-  int labelISO = 200;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 41);
-
-  // 400
-  labelISO = 400;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 36);
-  sprite->drawCentreString("NATIVE", 160, 59, &Lato_Regular5pt7b);
-
-  // 8000
-  labelISO = 8000;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 260, 41);
-
-  // 640
-  labelISO = 640;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 87);
-
-  // 800
-  labelISO = 800;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 87);
-
-  // 12800
-  labelISO = 12800;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 260, 87);
-
-  // 1250
-  labelISO = 1250;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 65, 131);
-
-  // 3200
-  labelISO = 3200;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentISO == labelISO ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString(String(labelISO).c_str(), 160, 126);
-  sprite->drawCentreString("NATIVE", 160, 149, &Lato_Regular5pt7b);
-
-  // Custom ISO - show if ISO is not one of the above values
-  if(currentISO != 0)
-  {
-    // Only show the ISO value if it's not a standard one
-    if(currentISO != 200 && currentISO != 400 && currentISO != 640 && currentISO != 800 && currentISO != 1250 && currentISO != 3200 && currentISO != 8000 && currentISO != 12800)
-    {
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      // sprite->textbgcolor = TFT_DARKGREEN;
-      sprite->drawCentreString(String(currentISO).c_str(), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
+  // Buttons, labels and layout are shared (UI/ISOScreen), only the drawing is this display's
+  ISOScreen::update(currentISO);
+
+  Screen_Draw(Screen_ISO_Draw);
+}
+
+// Drawing only, it's called for each band when band rendering
+void Screen_ShutterAngle_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
 
-  sprite->pushSprite(0, 0);
+  Screen_Common_Connected(); // Common elements
+
+  ShutterAngleScreen::draw(Screen_UIBackend());
 }
 
 void Screen_ShutterAngle(bool forceRefresh = false)
@@ -811,84 +970,18 @@ void Screen_ShutterAngle(bool forceRefresh = false)
 
   // If we have an up/down button press
   bool tappedAction = false;
-  std::vector<int> Options_ShutterAngle = {1500, 6000, 9000, 12000, 15000, 18000, 27000, 36000}; // Values are X100
-  int Options_ShutterAngle_SelectingIndex = -1; // when using up/down buttons keeps track of what option you are navigating to
   if(btnAPressed || btnBPressed)
   {
     DEBUG_DEBUG("Shutter Angle Screen: Btn A/B pressed");
 
     if(camera->hasShutterAngle()) // Ensure we have a value before allowing it to be changed
     {
-      // Get the current Shutter Angle (comes through X100, so 180 degrees = 18000)
-      int currentValue = camera->getShutterAngle();
-
       bool up = btnBPressed; // up = true, down = false
 
-      // If we don't have a selected value yet, set to the current one
-      if(Options_ShutterAngle_SelectingIndex == -1)
-      {
-        auto iter = std::find(Options_ShutterAngle.begin(), Options_ShutterAngle.end(), currentValue);
-        int index = (iter != Options_ShutterAngle.end()) ? std::distance(Options_ShutterAngle.begin(), iter) : -1;
-
-        if(index != -1)
-          Options_ShutterAngle_SelectingIndex = index;
-        else // Custom Shutter Angle, use the latest one
-        {
-          int closestIndex = -1;
-          int closestValue = std::numeric_limits<int>::min();  // Initialize with the lowest possible value
-
-          for (int i = 0; i < Options_ShutterAngle.size(); ++i) {
-              int optionValue = Options_ShutterAngle[i];
-
-              if (optionValue <= currentValue && optionValue > closestValue) {
-                  closestIndex = i;
-                  closestValue = optionValue;
-              }
-          }
-
-          if (closestIndex != -1)
-          {
-            if(up)
-              Options_ShutterAngle_SelectingIndex = closestIndex; // Pressing up, closest one lower is right
-            else
-            {
-              if(closestIndex < Options_ShutterAngle.size() - 1)
-                Options_ShutterAngle_SelectingIndex = closestIndex + 1; // Pressing down, go up
-              else
-                Options_ShutterAngle_SelectingIndex = 0; // Already at the top, so go back to the start
-            }
-          }
-          else // Lower than the lowest, so set to lowest in options
-          {
-            if(up)
-              Options_ShutterAngle_SelectingIndex = Options_ShutterAngle.size() - 1; // Pressing up on a number lower than the lowest, put on the highest so we can go back around to the lowest in the set
-            else
-              Options_ShutterAngle_SelectingIndex = 0; // Otherwise pressing down and keep at the lowest and we'll be going to the highest
-          }
-        }
-      }
-
-      // Move to the next option and send it to the camera
-      if(Options_ShutterAngle_SelectingIndex != -1)
-      {
-        Options_ShutterAngle_SelectingIndex = Options_ShutterAngle_SelectingIndex + (up ? 1 : -1); // Move the selected option
-
-        if(Options_ShutterAngle_SelectingIndex < 0)
-        {
-          // Down button on the first option, go to the last option
-          Options_ShutterAngle_SelectingIndex = Options_ShutterAngle.size() -1;
-        }
-        else if(Options_ShutterAngle_SelectingIndex > (Options_ShutterAngle.size() - 1))
-        {
-          // Up button on the last option, go to the first option
-          Options_ShutterAngle_SelectingIndex = 0;
-        }
-
-        // Shutter Angle selected, send it to the camera
-        PacketWriter::writeShutterAngle(Options_ShutterAngle[Options_ShutterAngle_SelectingIndex], &cameraConnection);
+      // Shutter Angle selected (X100, so 180 degrees = 18000), send it to the camera
+      PacketWriter::writeShutterAngle(ShutterAngleScreen::getNextOption(camera->getShutterAngle(), up), &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -897,87 +990,28 @@ void Screen_ShutterAngle(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Shutter Angle Refreshed.");
 
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
+  DEBUG_DEBUG("Screen Shutter Angle Refreshed.");
 
   // Get the current Shutter Angle (comes through X100, so 180 degrees = 18000)
   int currentShutterAngle = 0;
   if(camera->hasShutterAngle())
     currentShutterAngle = camera->getShutterAngle();
 
-  // Shutter Angle label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("DEGREES", 265, 9, &AgencyFB_Regular7pt7b);
-  sprite->drawString("SHUTTER ANGLE", 30, 9, &AgencyFB_Bold9pt7b);
+  // Buttons, labels and layout are shared (UI/ShutterAngleScreen), only the drawing is this display's
+  ShutterAngleScreen::update(currentShutterAngle);
 
-  // 15
-  int labelShutterAngle = 1500;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 0) sprite->drawRoundRect(20, 30, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 41);
+  Screen_Draw(Screen_ShutterAngle_Draw);
+}
 
-  // 60
-  labelShutterAngle = 6000;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 1) sprite->drawRoundRect(115, 30, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 41);
-
-  // 90
-  labelShutterAngle = 9000;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 2) sprite->drawRoundRect(210, 30, 100, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 41);
-
-  // 120
-  labelShutterAngle = 12000;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 3) sprite->drawRoundRect(20, 75, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 87);
-
-  // 150
-  labelShutterAngle = 15000;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 4) sprite->drawRoundRect(115, 75, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 87);
-
-  // 180 (with a border around it)
-  labelShutterAngle = 18000;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(210, 75, 100, 40, 3, TFT_DARKGREEN);
-  if(Options_ShutterAngle_SelectingIndex == 5) sprite->drawRoundRect(210, 75, 100, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 260, 87);
-
-  // 270
-  labelShutterAngle = 27000;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 6) sprite->drawRoundRect(20, 120, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 65, 131);
-
-  // 360
-  labelShutterAngle = 36000;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterAngle == labelShutterAngle ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(Options_ShutterAngle_SelectingIndex == 7) sprite->drawRoundRect(115, 120, 90, 40, 1, TFT_WHITE);
-  sprite->drawCentreString(String(labelShutterAngle / 100).c_str(), 160, 131);
-
-  // Custom Shutter Angle - show if not one of the above values
-  if(currentShutterAngle != 0)
-  {
-    // Only show the Shutter angle value if it's not a standard one
-    if(currentShutterAngle != 1500 && currentShutterAngle != 6000 && currentShutterAngle != 9000 && currentShutterAngle != 12000 && currentShutterAngle != 15000 && currentShutterAngle != 18000 && currentShutterAngle != 27000 && currentShutterAngle != 36000)
-    {
-      float customShutterAngle = currentShutterAngle / 100.0;
+// Drawing only, it's called for each band when band rendering
+void Screen_ShutterSpeed_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
 
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString(String(customShutterAngle, (currentShutterAngle % 100 == 0 ? 0 : 1)).c_str(), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
+  Screen_Common_Connected(); // Common elements
 
-  sprite->pushSprite(0, 0);
+  ShutterSpeedScreen::draw(Screen_UIBackend());
 }
 
 void Screen_ShutterSpeed(bool forceRefresh = false)
@@ -989,89 +1023,22 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Shutter Speed Values: 1/30, 1/50, 1/60, 1/125, 1/200, 1/250, 1/500, 1/2000, CUSTOM
   // Note that the protocol takes the denominator as its parameter value. So for 1/60 we'll pass 60.
 
   // If we have an up/down button press
   bool tappedAction = false;
-  std::vector<int> Options_ShutterSpeed = {30, 50, 60, 125, 200, 250, 500, 2000};
-  int Options_ShutterSpeed_SelectingIndex = -1; // when using up/down buttons keeps track of what option you are navigating to
   if(btnAPressed || btnBPressed)
   {
     DEBUG_DEBUG("Shutter Speed Screen: Btn A/B pressed");
 
     if(camera->hasShutterSpeed()) // Ensure we have a value before allowing it to be changed
     {
-      // Get the current Shutter Speed (denominator, e.g. 1/60 will return 60)
-      int currentValue = camera->getShutterSpeed();
-
       bool up = btnBPressed; // up = true, down = false
 
-      // If we don't have a selected value yet, set to the current one
-      if(Options_ShutterSpeed_SelectingIndex == -1)
-      {
-        auto iter = std::find(Options_ShutterSpeed.begin(), Options_ShutterSpeed.end(), currentValue);
-        int index = (iter != Options_ShutterSpeed.end()) ? std::distance(Options_ShutterSpeed.begin(), iter) : -1;
-
-        if(index != -1)
-          Options_ShutterSpeed_SelectingIndex = index;
-        else // Custom Shutter Speed, use the latest one
-        {
-          int closestIndex = -1;
-          int closestValue = std::numeric_limits<int>::min();  // Initialize with the lowest possible value
-
-          for (int i = 0; i < Options_ShutterSpeed.size(); ++i) {
-              int optionValue = Options_ShutterSpeed[i];
-
-              if (optionValue <= currentValue && optionValue > closestValue) {
-                  closestIndex = i;
-                  closestValue = optionValue;
-              }
-          }
-
-          if (closestIndex != -1)
-          {
-            if(up)
-              Options_ShutterSpeed_SelectingIndex = closestIndex; // Pressing up, closest one lower is right
-            else
-            {
-              if(closestIndex < Options_ShutterSpeed.size() - 1)
-                Options_ShutterSpeed_SelectingIndex = closestIndex + 1; // Pressing down, go up
-              else
-                Options_ShutterSpeed_SelectingIndex = 0; // Already at the top, so go back to the start
-            }
-          }
-          else // Lower than the lowest, so set to lowest in options
-          {
-            if(up)
-              Options_ShutterSpeed_SelectingIndex = Options_ShutterSpeed.size() - 1; // Pressing up on a number lower than the lowest, put on the highest so we can go back around to the lowest in the set
-            else
-              Options_ShutterSpeed_SelectingIndex = 0; // Otherwise pressing down and keep at the lowest and we'll be going to the highest
-          }
-        }
-      }
-
-      // Move to the next option and send it to the camera
-      if(Options_ShutterSpeed_SelectingIndex != -1)
-      {
-        Options_ShutterSpeed_SelectingIndex = Options_ShutterSpeed_SelectingIndex + (up ? 1 : -1); // Move the selected option
-
-        if(Options_ShutterSpeed_SelectingIndex < 0)
-        {
-          // Down button on the first option, go to the last option
-          Options_ShutterSpeed_SelectingIndex = Options_ShutterSpeed.size() -1;
-        }
-        else if(Options_ShutterSpeed_SelectingIndex > (Options_ShutterSpeed.size() - 1))
-        {
-          // Up button on the last option, go to the first option
-          Options_ShutterSpeed_SelectingIndex = 0;
-        }
-
-        // Shutter Speed selected, send it to the camera
-        PacketWriter::writeShutterSpeed(Options_ShutterSpeed[Options_ShutterSpeed_SelectingIndex], &cameraConnection);
+      // Shutter Speed selected, send it to the camera
+      PacketWriter::writeShutterSpeed(ShutterSpeedScreen::getNextOption(camera->getShutterSpeed(), up), &cameraConnection);
 
-        tappedAction = true;
-      }
+      tappedAction = true;
     }
   }
 
@@ -1080,84 +1047,31 @@ void Screen_ShutterSpeed(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Shutter Speed Refreshed.");
 
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
+  DEBUG_DEBUG("Screen Shutter Speed Refreshed.");
 
   // Get the current Shutter Speed
   int currentShutterSpeed = 0;
   if(camera->hasShutterSpeed())
     currentShutterSpeed = camera->getShutterSpeed();
-  else
-    DEBUG_DEBUG("DO NOT HAVE SHUTTER SPEED!");
 
-  // Shutter Speed label
-  sprite->setTextColor(TFT_WHITE);
+  // Frame rate shown alongside, as the shutter speed is relative to it
+  std::string frameRate = camera->hasRecordingFormat() ? camera->getRecordingFormat().frameRate_string() : "";
 
-  if(camera->hasRecordingFormat())
-  {
-    sprite->drawRightString(camera->getRecordingFormat().frameRate_string().c_str() + String(" fps"), 310, 9, &Lato_Regular5pt7b);
-  }
+  // Buttons, labels and layout are shared (UI/ShutterSpeedScreen), only the drawing is this display's
+  ShutterSpeedScreen::update(currentShutterSpeed, camera->hasRecordingFormat() ? frameRate.c_str() : nullptr);
 
-  sprite->drawString("SHUTTER SPEED", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // 1/30
-  int labelShutterSpeed = 30;
-  sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 41);
-
-  // 1/50
-  labelShutterSpeed = 50;
-  sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 41);
-
-  // 1/60
-  labelShutterSpeed = 60;
-  sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 260, 41);
-
-  // 1/125
-  labelShutterSpeed = 125;
-  sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 87);
-
-  // 1/200
-  labelShutterSpeed = 200;
-  sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 87);
-
-  // 1/250
-  labelShutterSpeed = 250;
-  sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 260, 87);
-
-  // 1/500
-  labelShutterSpeed = 500;
-  sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 65, 131);
-
-  // 1/2000
-  labelShutterSpeed = 2000;
-  sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentShutterSpeed == labelShutterSpeed ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("1/" + String(labelShutterSpeed), 160, 131);
-
-  // Custom Shutter Speed - show if not one of the above values
-  if(currentShutterSpeed != 0)
-  {
-    // Only show the Shutter Speed value if it's not a standard one
-    if(currentShutterSpeed != 30 && currentShutterSpeed != 50 && currentShutterSpeed != 60 && currentShutterSpeed != 125 && currentShutterSpeed != 200 && currentShutterSpeed != 250 && currentShutterSpeed != 500 && currentShutterSpeed != 2000)
-    {
-      sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("1/" + String(currentShutterSpeed), 260, 126);
-      sprite->drawCentreString("CUSTOM", 260, 149, &Lato_Regular5pt7b);
-    }
-  }
+  Screen_Draw(Screen_ShutterSpeed_Draw);
+}
+
+// Drawing only, it's called for each band when band rendering
+void Screen_WBTint_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
 
-  sprite->pushSprite(0, 0);
+  WhiteBalanceScreen::draw(Screen_UIBackend());
 }
 
 void Screen_WBTint(bool editWB, bool forceRefresh = false) // editWB indicates editing White Balance when true, editing Tint when false
@@ -1188,273 +1102,49 @@ void Screen_WBTint(bool editWB, bool forceRefresh = false) // editWB indicates e
   {
     DEBUG_DEBUG("White Balance Screen: Btn A/B pressed");
 
-    if(editWB) // White Balance Edit
+    int newWB = currentWB;
+    int newTint = currentTint;
+
+    if(editWB && btnAPressed)
+      WhiteBalanceScreen::getNextPreset(currentWB, newWB, newTint); // White Balance Presets
+    else if(editWB)
     {
-      if(btnAPressed)
-      {
-        // White Balance Presets
+      // White Balance +100
+      newWB = currentWB + 100;
 
-        std::vector<int> Options_WB = {5600, 3200, 4000, 4500, 6500};
-        std::vector<int> Options_WB_Tint = {10, 0, 15, 15, 10}; // Corresponding Tints for WB presets
-        int Options_WB_SelectingIndex = -1; // when using up/down buttons keeps track of what option you are navigating to
+      if(newWB > 10000)
+        newWB = 2500;
+    }
+    else
+      newTint = WhiteBalanceScreen::getNextTint(currentTint, btnBPressed);
 
-        // Get the current White Balance
-        int currentValue = currentWB;
+    PacketWriter::writeWhiteBalance(newWB, newTint, &cameraConnection);
 
-        bool up = true;
+    tappedAction = true;
+  }
 
-        // If we don't have a selected value yet, set to the current one
-        if(Options_WB_SelectingIndex == -1)
-        {
-          auto iter = std::find(Options_WB.begin(), Options_WB.end(), currentValue);
-          int index = (iter != Options_WB.end()) ? std::distance(Options_WB.begin(), iter) : -1;
+  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
+  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+    return;
+  else
+    lastRefreshedScreen = camera->getLastModified();
 
-          if(index != -1)
-            Options_WB_SelectingIndex = index;
-          else // Custom Shutter Speed, use the latest one
-          {
-            int closestIndex = -1;
-            int closestValue = std::numeric_limits<int>::min();  // Initialize with the lowest possible value
+  DEBUG_DEBUG("Screen WB Tint Refreshed.");
 
-            for (int i = 0; i < Options_WB.size(); ++i) {
-                int optionValue = Options_WB[i];
+  // Buttons, labels and layout are shared (UI/WhiteBalanceScreen), only the drawing is this display's
+  WhiteBalanceScreen::update(currentWB, currentTint, editWB ? WhiteBalanceScreen::Editing::WhiteBalance : WhiteBalanceScreen::Editing::Tint);
 
-                if (optionValue <= currentValue && optionValue > closestValue) {
-                    closestIndex = i;
-                    closestValue = optionValue;
-                }
-            }
+  Screen_Draw(Screen_WBTint_Draw);
+}
 
-            if (closestIndex != -1)
-            {
-              if(up)
-                Options_WB_SelectingIndex = closestIndex; // Pressing up, closest one lower is right
-              else
-              {
-                if(closestIndex < Options_WB.size() - 1)
-                  Options_WB_SelectingIndex = closestIndex + 1; // Pressing down, go up
-                else
-                  Options_WB_SelectingIndex = 0; // Already at the top, so go back to the start
-              }
-            }
-            else // Lower than the lowest, so set to lowest in options
-            {
-              if(up)
-                Options_WB_SelectingIndex = Options_WB.size() - 1; // Pressing up on a number lower than the lowest, put on the highest so we can go back around to the lowest in the set
-              else
-                Options_WB_SelectingIndex = 0; // Otherwise pressing down and keep at the lowest and we'll be going to the highest
-            }
-          }
-        }
-
-        // Move to the next option and send it to the camera
-        if(Options_WB_SelectingIndex != -1)
-        {
-          Options_WB_SelectingIndex = Options_WB_SelectingIndex + (up ? 1 : -1); // Move the selected option
-
-          if(Options_WB_SelectingIndex < 0)
-          {
-            // Down button on the first option, go to the last option
-            Options_WB_SelectingIndex = Options_WB.size() -1;
-          }
-          else if(Options_WB_SelectingIndex > (Options_WB.size() - 1))
-          {
-            // Up button on the last option, go to the first option
-            Options_WB_SelectingIndex = 0;
-          }
-
-          // Shutter Speed selected, send it to the camera
-          PacketWriter::writeWhiteBalance(Options_WB[Options_WB_SelectingIndex], Options_WB_Tint[Options_WB_SelectingIndex], &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else
-      {
-        // White Balance +100
-        int newWB = currentWB + 100;
-
-        if(newWB > 10000)
-          newWB = 2500;
-
-          // Shutter Speed selected, send it to the camera
-          PacketWriter::writeWhiteBalance(newWB, currentTint, &cameraConnection);
-
-          tappedAction = true;
-      }
-    }
-    else if(!editWB && camera->hasTint())
-    {
-      std::vector<int> Options_Tint = {-50, -40, -30, -20, -15, -10, -9, -8, -7, -6, -5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 15, 20, 30, 40, 50};
-      int Options_Tint_SelectingIndex = -1; // when using up/down buttons keeps track of what option you are navigating to
-
-      // Get the current Tint
-      int currentValue = currentTint;
-
-      bool up = btnBPressed; // up = true, down = false
-
-      // If we don't have a selected value yet, set to the current one
-      if(Options_Tint_SelectingIndex == -1)
-      {
-        auto iter = std::find(Options_Tint.begin(), Options_Tint.end(), currentValue);
-        int index = (iter != Options_Tint.end()) ? std::distance(Options_Tint.begin(), iter) : -1;
-
-        if(index != -1)
-          Options_Tint_SelectingIndex = index;
-        else // Custom Shutter Speed, use the latest one
-        {
-          int closestIndex = -1;
-          int closestValue = std::numeric_limits<int>::min();  // Initialize with the lowest possible value
-
-          for (int i = 0; i < Options_Tint.size(); ++i) {
-              int optionValue = Options_Tint[i];
-
-              if (optionValue <= currentValue && optionValue > closestValue) {
-                  closestIndex = i;
-                  closestValue = optionValue;
-              }
-          }
-
-          if (closestIndex != -1)
-          {
-            if(up)
-              Options_Tint_SelectingIndex = closestIndex; // Pressing up, closest one lower is right
-            else
-            {
-              if(closestIndex < Options_Tint.size() - 1)
-                Options_Tint_SelectingIndex = closestIndex + 1; // Pressing down, go up
-              else
-                Options_Tint_SelectingIndex = 0; // Already at the top, so go back to the start
-            }
-          }
-          else // Lower than the lowest, so set to lowest in options
-          {
-            if(up)
-              Options_Tint_SelectingIndex = Options_Tint.size() - 1; // Pressing up on a number lower than the lowest, put on the highest so we can go back around to the lowest in the set
-            else
-              Options_Tint_SelectingIndex = 0; // Otherwise pressing down and keep at the lowest and we'll be going to the highest
-          }
-        }
-      }
-
-      // Move to the next option and send it to the camera
-      if(Options_Tint_SelectingIndex != -1)
-      {
-        Options_Tint_SelectingIndex = Options_Tint_SelectingIndex + (up ? 1 : -1); // Move the selected option
-
-        if(Options_Tint_SelectingIndex < 0)
-        {
-          // Down button on the first option, go to the last option
-          Options_Tint_SelectingIndex = Options_Tint.size() -1;
-        }
-        else if(Options_Tint_SelectingIndex > (Options_Tint.size() - 1))
-        {
-          // Up button on the last option, go to the first option
-          Options_Tint_SelectingIndex = 0;
-        }
-
-        // Shutter Speed selected, send it to the camera
-        PacketWriter::writeWhiteBalance(currentWB, Options_Tint[Options_Tint_SelectingIndex], &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen WB Tint Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
+// Drawing only, it's called for each band when band rendering
+void Screen_Codec_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  // ISO label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString(editWB ? "WHITE BALANCE" : "TINT", 30, 9, &AgencyFB_Bold9pt7b);
-  sprite->drawCentreString("TINT", 54, 132, &AgencyFB_Bold9pt7b);
-
-  // Bright, 5600K
-  int lblWBKelvin = 5600;
-  int lblTint = 10;
-  sprite->fillSmoothRoundRect(20, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(40, 35, 30, 30, WBBrightBG);
-  else
-    sprite->pushImage(40, 35, 30, 30, WBBright);
-
-  // Incandescent, 3200K
-  lblWBKelvin = 3200;
-  lblTint = 0;
-  sprite->fillSmoothRoundRect(95, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(115, 35, 30, 30, WBIncandescentBG);
-  else
-    sprite->pushImage(115, 35, 30, 30, WBIncandescent);
-
-  // Fluorescent, 4000K
-  lblWBKelvin = 4000;
-  lblTint = 15;
-  sprite->fillSmoothRoundRect(170, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(190, 35, 30, 30, WBFlourescentBG);
-  else
-    sprite->pushImage(190, 35, 30, 30, WBFlourescent);
-
-  // Mixed Light, 4500K
-  lblWBKelvin = 4500;
-  lblTint = 15;
-  sprite->fillSmoothRoundRect(245, 30, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(265, 35, 30, 30, WBMixedLightBG);
-  else
-    sprite->pushImage(265, 35, 30, 30, WBMixedLight);
-
-  // Cloud, 6500K
-  lblWBKelvin = 6500;
-  lblTint = 10;
-  sprite->fillSmoothRoundRect(20, 75, 70, 40, 3, (currentWB == lblWBKelvin && currentTint == lblTint ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(currentWB == lblWBKelvin && currentTint == lblTint)
-    sprite->pushImage(40, 80, 30, 30, WBCloudBG);
-  else
-    sprite->pushImage(40, 80, 30, 30, WBCloud);
-
-  // Current White Balance Kelvin
-  sprite->fillSmoothRoundRect(160, 75, 90, 40, 3, editWB ? TFT_DARKGREEN : TFT_DARKGREY);
-  sprite->drawCentreString(String(currentWB), 205, 80);
-  sprite->drawCentreString("KELVIN", 205, 103, &Lato_Regular5pt7b);
-
-  if(editWB)
-  {
-    // WB Adjust Left <
-    sprite->fillSmoothRoundRect(95, 75, 60, 40, 3, TFT_DARKGREY);
-    sprite->drawCentreString("<", 125, 87);
-
-    // WB Adjust Right >
-    sprite->fillSmoothRoundRect(255, 75, 60, 40, 3, TFT_DARKGREY);
-    sprite->drawCentreString(">", 284, 87);
-  }
-
-  // Current Tint
-  sprite->fillSmoothRoundRect(160, 120, 90, 40, 3, !editWB ? TFT_DARKGREEN : TFT_DARKGREY);
-  sprite->drawCentreString(String(currentTint), 205, 130);
-
-  if(!editWB)
-  {
-    // Tint Adjust Left <
-    sprite->fillSmoothRoundRect(95, 120, 60, 40, 3, TFT_DARKGREY);
-    sprite->drawCentreString("<", 125, 132);
-
-    // Tint Adjust Right >
-    sprite->fillSmoothRoundRect(255, 120, 60, 40, 3, TFT_DARKGREY);
-    sprite->drawCentreString(">", 284, 132);
-  }
-
-  sprite->pushSprite(0, 0);
+  CodecScreen::draw(Screen_UIBackend());
 }
 
 // Codec Screen for Pocket 4K and 6K + Variants
@@ -1467,315 +1157,26 @@ void Screen_Codec4K6K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  // Codec: BRAW and ProRes
-
-  // If we have an up/down button press
-  bool tappedAction = false;
-  if(btnAPressed || btnBPressed)
-  {
-    DEBUG_DEBUG("Codec 4K/6K: Btn A/B pressed");
-
-    // Switching between BRAW and ProRes
-    if(btnAPressed)
-    {
-      if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-        // Switch to ProRes
-        PacketWriter::writeCodec(camera->lastKnownProRes, &cameraConnection);
-      }
-      else
-      {
-        // Switch to BRAW
-        PacketWriter::writeCodec(camera->lastKnownBRAWIsBitrate ? camera->lastKnownBRAWBitrate : camera->lastKnownBRAWQuality, &cameraConnection);
-      }
-
-      tappedAction = true;
-    }
-    else if(btnBPressed)
-    {
-        // Current setting
-        std::string currentCodecString = currentCodec.to_string();
-
-      // Change the setting on the current Codec
-      if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-          if(currentCodecString == "BRAW 3:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW5_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 5:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW8_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 8:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW12_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 12:1")
-          {
-            // Switch across to Constant Quality
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ0), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q0")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ3), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q3")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ5), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q5")
-          {
-            // Switch across to Constant Bitrate
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW3_1), &cameraConnection);
-          }
-      }
-      else
-      {
-          if(currentCodecString == "ProRes HQ")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes 422")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes LT")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes PXY")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ), &cameraConnection);
-          }
-      }
-
-      tappedAction = true;
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Codec 4K/6K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  // We need to have the Codec information to show the screen
-  if(!camera->hasCodec())
-  {
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("NO CODEC INFO.", 30, 9);
-
-    return;
-  }
-
-  // Codec label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("CODEC", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // BRAW and ProRes selector buttons
-
-  // BRAW
-  sprite->fillSmoothRoundRect(20, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(20, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("BRAW", 93, 41);
-
-  // ProRes
-  sprite->fillSmoothRoundRect(170, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(170, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("ProRes", 242, 41);
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
+  // Codec: BRAW and ProRes. The URSA Mini Pro G2 adds ProRes 444.
+  if(camera->hasCodec())
   {
-    // BRAW
-
-    // Are we Constant Bitrate or Constant Quality
-    std::string currentCodecString = currentCodec.to_string();
-    auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-    bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-    // Get the bitrate or quality setting
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string qualityBitrateSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 3:1, Q3, etc.
-
-    // Constant Bitrate
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("BITRATE", 93, 80);
-    sprite->drawCentreString("CONSTANT", 93, 102, &Lato_Regular5pt7b);
-
-    // Constant Quality
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (!isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("QUALITY", 242, 80);
-    sprite->drawCentreString("CONSTANT", 242, 102, &Lato_Regular5pt7b);
-
-    // Setting 1 of 4
-    std::string optionString = (isConstantBitrate ? "3:1" : "Q0");
-    sprite->fillSmoothRoundRect(20, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 55, 131);
-
-    // Setting 2 of 4
-    optionString = (isConstantBitrate ? "5:1" : "Q1");
-    sprite->fillSmoothRoundRect(95, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 130, 131);
-
-  //   Setting 3 of 4
-    optionString = (isConstantBitrate ? "8:1" : "Q3");
-    sprite->fillSmoothRoundRect(170, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 205, 131);
-
-    // Setting 4 of 4
-    optionString = (isConstantBitrate ? "12:1" : "Q5");
-    sprite->fillSmoothRoundRect(245, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 280, 131);
+    CodecInfo currentCodec = camera->getCodec();
+    CodecScreen::update(&currentCodec, camera->isURSAMiniProG2());
   }
   else
-  {
-    // ProRes
-
-    // Get the ProRes Setting
-    std::string currentCodecString = currentCodec.to_string();
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string currentProResSetting = currentCodecString.substr(spaceIndex + 1); // e.g. HQ, 422, LT, PXY
-
-    // HQ
-    std::string proResLabel = "HQ";
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 93, 87);
-
-    // 422
-    proResLabel = "422";
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 242, 87);
-
-    // LT
-    proResLabel = "LT";
-    sprite->fillSmoothRoundRect(20, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 93, 131);
-
-    // PXY
-    proResLabel = "PXY";
-    sprite->fillSmoothRoundRect(170, 120, 145, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 242, 131);
-  }
-
-  sprite->pushSprite(0, 0);
-}
-
-// Codec Screen for URSA Mini Pro G2
-void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Codec;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  // Codec: BRAW and ProRes
+    CodecScreen::update(nullptr, false); // We need to have the Codec information to show the screen
 
   // If we have an up/down button press
   bool tappedAction = false;
-  if(btnAPressed || btnBPressed)
+  if((btnAPressed || btnBPressed) && camera->hasCodec())
   {
-    DEBUG_DEBUG("Codec URSA Mini Pro G2: Btn A/B pressed");
-
-    // Switching between BRAW and ProRes
-    if(btnAPressed)
-    {
-      if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-        // Switch to ProRes
-        PacketWriter::writeCodec(camera->lastKnownProRes, &cameraConnection);
-      }
-      else
-      {
-        // Switch to BRAW
-        PacketWriter::writeCodec(camera->lastKnownBRAWIsBitrate ? camera->lastKnownBRAWBitrate : camera->lastKnownBRAWQuality, &cameraConnection);
-      }
-
-      tappedAction = true;
-    }
-    else if(btnBPressed)
-    {
-        // Current setting
-        std::string currentCodecString = currentCodec.to_string();
+    DEBUG_DEBUG("Codec: Btn A/B pressed");
 
-      // Change the setting on the current Codec
-      if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      {
-          if(currentCodecString == "BRAW 3:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW5_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 5:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW8_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 8:1")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW12_1), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW 12:1")
-          {
-            // Switch across to Constant Quality
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ0), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q0")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAWQ5), &cameraConnection);
-          }
-          else if(currentCodecString == "BRAW Q5")
-          {
-            // Switch across to Constant Bitrate
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::BRAW, CCUPacketTypes::CodecVariants::kBRAW3_1), &cameraConnection);
-          }
-      }
-      else
-      {
-          if(currentCodecString == "ProRes 444XQ")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes444), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes 444")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResHQ), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes HQ")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes422), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes 422")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResLT), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes LT")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProResProxy), &cameraConnection);
-          }
-          else if(currentCodecString == "ProRes PXY")
-          {
-            PacketWriter::writeCodec(CodecInfo(CCUPacketTypes::BasicCodec::ProRes, CCUPacketTypes::CodecVariants::kProRes444XQ), &cameraConnection);
-          }
-      }
+    // Switching between BRAW and ProRes, or to the next setting on the current Codec
+    // Changing Codecs through Bluetooth is a known bug from Blackmagic Design as of April 2023
+    PacketWriter::writeCodec(btnAPressed ? CodecScreen::getOtherCodec(*camera) : CodecScreen::getNextSetting(), &cameraConnection);
 
-      tappedAction = true;
-    }
+    tappedAction = true;
   }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -1783,1119 +1184,132 @@ void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Codec URSA Mini Pro G2 Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
 
-  Screen_Common_Connected(); // Common elements
-
-  // We need to have the Codec information to show the screen
-  if(!camera->hasCodec())
-  {
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("NO CODEC INFO.", 30, 9);
-
-    return;
-  }
-
-  // Codec label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("CODEC", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // BRAW and ProRes selector buttons
-
-  // BRAW
-  sprite->fillSmoothRoundRect(20, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(20, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("BRAW", 93, 41);
-
-  // ProRes
-  sprite->fillSmoothRoundRect(170, 30, 145, 40, 5, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawRoundRect(170, 30, 145, 40, 3, (currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawCentreString("ProRes", 242, 41);
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // BRAW
-
-    // Are we Constant Bitrate or Constant Quality
-    std::string currentCodecString = currentCodec.to_string();
-    auto pos = std::find(currentCodecString.begin(), currentCodecString.end(), ':');
-    bool isConstantBitrate = pos != currentCodecString.end(); // Is there a colon, :, in the string? If so, it's Constant Bitrate
-
-    // Get the bitrate or quality setting
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string qualityBitrateSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 3:1, Q3, etc.
-
-    // Constant Bitrate
-    sprite->fillSmoothRoundRect(20, 75, 145, 40, 3, (isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("BITRATE", 93, 80);
-    sprite->drawCentreString("CONSTANT", 93, 102, &Lato_Regular5pt7b);
-
-    // Constant Quality
-    sprite->fillSmoothRoundRect(170, 75, 145, 40, 3, (!isConstantBitrate ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("QUALITY", 242, 80);
-    sprite->drawCentreString("CONSTANT", 242, 102, &Lato_Regular5pt7b);
-
-    // Setting 1 of 4
-    std::string optionString = (isConstantBitrate ? "3:1" : "Q0");
-    sprite->fillSmoothRoundRect(20, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 55, 131);
-
-    // Setting 2 of 4
-    optionString = (isConstantBitrate ? "5:1" : "Q1");
-    sprite->fillSmoothRoundRect(95, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 130, 131);
-
-  //   Setting 3 of 4
-    optionString = (isConstantBitrate ? "8:1" : "Q3");
-    sprite->fillSmoothRoundRect(170, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 205, 131);
-
-    // Setting 4 of 4
-    optionString = (isConstantBitrate ? "12:1" : "Q5");
-    sprite->fillSmoothRoundRect(245, 120, 70, 40, 3, (optionString == qualityBitrateSetting ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(optionString.c_str(), 280, 131);
-  }
-  else
-  {
-    // ProRes
-
-    // Get the ProRes Setting
-    std::string currentCodecString = currentCodec.to_string();
-    std::size_t spaceIndex = currentCodecString.find(" ");
-    std::string currentProResSetting = currentCodecString.substr(spaceIndex + 1); // e.g. 444XQ, 444, HQ, 422, LT, PXY
-
-    // 444 XQ
-    std::string proResLabel = "444XQ";
-    sprite->fillSmoothRoundRect(20, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("XQ", 67, 87);
-
-    // 444
-    proResLabel = "444";
-    sprite->fillSmoothRoundRect(120, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 167, 87);
-
-    // HQ
-    proResLabel = "HQ";
-    sprite->fillSmoothRoundRect(220, 75, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 267, 87);
-
-    // 422
-    proResLabel = "422";
-    sprite->fillSmoothRoundRect(20, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 67, 131);
-
-    // LT
-    proResLabel = "LT";
-    sprite->fillSmoothRoundRect(120, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 167, 131);
-
-    // PXY
-    proResLabel = "PXY";
-    sprite->fillSmoothRoundRect(220, 120, 95, 40, 3, (currentProResSetting == proResLabel ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(proResLabel.c_str(), 267, 131);
-  }
+  DEBUG_DEBUG("Screen Codec Refreshed.");
 
-  sprite->pushSprite(0, 0);
+  // Buttons, labels and layout are shared (UI/CodecScreen), only the drawing is this display's
+  Screen_Draw(Screen_Codec_Draw);
 }
 
-// Codec Screen for URSA Mini Pro 12K
-void Screen_CodecURSAMiniPro12K(bool forceRefresh = false)
+// Codec Screen for URSA Mini Pro G2
+void Screen_CodecURSAMiniProG2(bool forceRefresh = false)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Codec;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
-}
-
-// Codec screen - redirects to appropriate screen for camera
-void Screen_Codec(bool forceRefresh = false)
-{
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  if(camera->hasCodec())
-  {
-    if(camera->hasModelName())
-    {
-      if(camera->isPocket4K6K())
-        Screen_Codec4K6K(forceRefresh); // Pocket camera
-      else if(camera->isURSAMiniProG2())
-        Screen_CodecURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
-      else if(camera->isURSAMiniPro12K())
-        Screen_CodecURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
-      else
-        DEBUG_DEBUG("No Codec screen for this camera.");
-    } 
-    else
-      Screen_Codec4K6K(forceRefresh); // Handle no model name in 4K/6K screen
-  }
-  else
-    Screen_Codec4K6K(forceRefresh); // If we don't have any codec info, we show the 4K/6K screen that shows no codec
-}
-
-
-// Resolution screen for Pocket 4K
-void Screen_Resolution4K(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // Pocket 4K Resolution and Sensor Windows
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  bool tappedAction = false;
-  if(btnAPressed || btnBPressed)
-  {
-    DEBUG_DEBUG("Resolution4K: Btn A/B pressed");
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "HD", "2.6K 16:9", "4K DCI", "4K UHD", "HD"
-
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(currentRes == "4K DCI")
-      {
-        if(btnAPressed)
-        {
-          // 4K 2.4:1
-          width = 4096; height = 1720;
-          window = true;
-        }
-        else
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = true;
-        }
-      }
-      else if(currentRes == "4K 2.4:1")
-      {
-        if(btnAPressed)
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = true;
-        }
-        else
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-        }
-      }
-      else if(currentRes == "4K UHD")
-      {
-        if(btnAPressed)
-        {
-          // 2.8K Ana
-          width = 2880; height = 2160;
-          window = true;
-        }
-        else
-        {
-          // 4K 2.4:1
-          width = 4096; height = 1720;
-          window = true;
-        }
-      }
-      else if(currentRes == "2.8K Ana")
-      {
-        if(btnAPressed)
-        {
-          // 2.6K 16:9
-          width = 2688; height = 1512;
-          window = true;
-        }
-        else
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = true;
-        }
-      }
-      else if(currentRes == "2.6K 16:9")
-      {
-        if(btnAPressed)
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = true;
-        }
-        else
-        {
-          // 2.8K Ana
-          width = 2880; height = 2160;
-          window = true;
-        }
-      }
-      else // HD
-      {
-        if(btnAPressed)
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-        }
-        else
-        {
-          // 2.6K 16:9
-          width = 2688; height = 1512;
-          window = true;
-        }
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
-    {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      DEBUG_DEBUG("Before change:");
-      DEBUG_DEBUG(currentRecordingFormat.frameDimensionsShort_string().c_str());
-      DEBUG_DEBUG(currentRecordingFormat.frameRate_string().c_str());
-      DEBUG_DEBUG("Frame Rate: %hi", currentRecordingFormat.frameRate);
-      DEBUG_DEBUG("Off Speed Frame Rate: %hi", currentRecordingFormat.offSpeedFrameRate);
-      DEBUG_DEBUG("Width: %i", currentRecordingFormat.width);
-      DEBUG_DEBUG("Height: %i", currentRecordingFormat.height);
-      DEBUG_DEBUG("mRateEnabled: %s", currentRecordingFormat.mRateEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("offSpeedEnabled: %s", currentRecordingFormat.offSpeedEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("interlacedEnabled: %s", currentRecordingFormat.interlacedEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("windowedModeEnabled: %s", currentRecordingFormat.windowedModeEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("sensorMRateEnabled: %s", currentRecordingFormat.sensorMRateEnabled ? "Yes" : "No");
-
-      if(currentRes == "4K DCI")
-      {
-        if(btnAPressed)
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = true;
-        }
-        else
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = true;
-        }
-      }
-      else if(currentRes == "4K UHD")
-      {
-        if(btnAPressed)
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = true;
-        }
-        else
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = false;
-        }
-      }
-      else // UHD
-      {
-        if(btnAPressed)
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = false;
-        }
-        else
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = true;
-        }
-      }
-
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-
-        DEBUG_DEBUG("Attempting to change to:");
-        DEBUG_DEBUG(newRecordingFormat.frameDimensionsShort_string().c_str());
-        DEBUG_DEBUG(newRecordingFormat.frameRate_string().c_str());
-        DEBUG_DEBUG("Frame Rate: %hi", newRecordingFormat.frameRate);
-        DEBUG_DEBUG("Off Speed Frame Rate: %hi", newRecordingFormat.offSpeedFrameRate);
-        DEBUG_DEBUG("Width: %i", newRecordingFormat.width);
-        DEBUG_DEBUG("Height: %i", newRecordingFormat.height);
-        DEBUG_DEBUG("mRateEnabled: %s", newRecordingFormat.mRateEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("offSpeedEnabled: %s", newRecordingFormat.offSpeedEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("interlacedEnabled: %s", newRecordingFormat.interlacedEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("windowedModeEnabled: %s", newRecordingFormat.windowedModeEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("sensorMRateEnabled: %s", newRecordingFormat.sensorMRateEnabled ? "Yes" : "No");
-
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Resolution Pocket 4K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("BRAW RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K 2.4:1", "4K UHD", "2.8K Ana", "2.6K 16:9", "HD"
-
-    // 4K DCI
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 35);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K 2.4:1
-    labelRes = "4K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 160, 35);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 260, 35);
-    sprite->drawCentreString("UHD", 260, 58, &Lato_Regular5pt7b);
-
-    // 2.8K Ana
-    labelRes = "2.8K Ana";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.8K", 65, 81);
-    sprite->drawCentreString("ANAMORPHIC", 65, 104, &Lato_Regular5pt7b);
-
-    // 2.6K 16:9
-    labelRes = "2.6K 16:9";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.6K", 160, 81);
-    sprite->drawCentreString("16:9", 160, 104, &Lato_Regular5pt7b);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 87);
-
-    // Sensor Area
-
-    // Pocket 4K all are Windowed except 4K
-    // sprite->drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY); // Optionally draw a rectangle around this info.
-    sprite->drawCentreString(currentRes == "4K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129);
-    sprite->drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 150, &Lato_Regular5pt7b);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("ProRes RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 36);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 41);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 41);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    sprite->drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, &Lato_Regular5pt7b);
-    sprite->drawString("SCALED / SENSOR AREA", 30, 105);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 135, 90, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL", 65, 145);
-    }
-    else if(currentRes == "4K UHD")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 135, 120, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("WINDOW", 80, 145);
-    }
-    else
-    {
-      // HD
-
-      // Scaled from Full, 2.6K or Windowed (however we can't tell which)
-      sprite->fillSmoothRoundRect(20, 135, 290, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL / 2.6K / WINDOW", 165, 140);
-      sprite->drawCentreString("CHECK/SET ON CAMERA", 165, 161, &Lato_Regular5pt7b);
-    }
-  }
-  else
-    DEBUG_ERROR("Resolution Pocket 4K - Codec not catered for.");
-
-  sprite->pushSprite(0, 0);
-}
-
-// Resolution screen for Pocket 6K
-void Screen_Resolution6K(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // Pocket 6K Resolution and Sensor Windows
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  bool tappedAction = false;
-  if(btnAPressed || btnBPressed)
-  {
-    DEBUG_DEBUG("Resolution6K: Btn A/B pressed");
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str();
-
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      if(currentRes == "6K")
-      {
-        if(btnAPressed)
-        {
-          // 6K 2.4:1
-          width = 6144; height = 2560;
-          window = true;
-        }
-        else
-        {
-          // 2.8K 17:9 - Note V8.1 width is 2880 not 2868
-          width = 2880; height = 1512;
-          window = true;
-        }
-      }
-      else if(currentRes == "6K 2.4:1")
-      {
-        if(btnAPressed)
-        {
-          // 5.7K 17:9
-          width = 5744; height = 3024;
-          window = true;
-        }
-        else
-        {
-          // 6K
-          width = 6144; height = 3456;
-        }
-      }
-      else if(currentRes == "5.7K 17:9")
-      {
-        if(btnAPressed)
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = true;
-        }
-        else
-        {
-          // 6K 2.4:1
-          width = 6144; height = 2560;
-          window = true;
-        }
-      }
-      else if(currentRes == "4K DCI")
-      {
-        if(btnAPressed)
-        {
-          // 3.7K Anamorphic
-          width = 3728; height = 3104;
-          window = true;
-        }
-        else
-        {
-          // 5.7K 17:9
-          width = 5744; height = 3024;
-          window = true;
-        }
-      }
-      else if(currentRes == "3.7K 6:5A")
-      {
-        if(btnAPressed)
-        {
-          // 2.8K 17:9 - Note V8.1 width is 2880 not 2868
-          width = 2880; height = 1512;
-          window = true;
-        }
-        else
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = true;
-        }
-      }
-      else // 2.8K 17:9
-      {
-        if(btnAPressed)
-        {
-          // 6K
-          width = 6144; height = 3456;
-        }
-        else
-        {
-          // 3.7K Anamorphic
-          width = 3728; height = 3104;
-          window = true;
-        }
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-    else
-    {
-      // ProRes
-
-      int width = 0;
-      int height = 0;
-      bool window = false;
-
-      DEBUG_DEBUG("Before change:");
-      DEBUG_DEBUG(currentRecordingFormat.frameDimensionsShort_string().c_str());
-      DEBUG_DEBUG(currentRecordingFormat.frameRate_string().c_str());
-      DEBUG_DEBUG("Frame Rate: %hi", currentRecordingFormat.frameRate);
-      DEBUG_DEBUG("Off Speed Frame Rate: %hi", currentRecordingFormat.offSpeedFrameRate);
-      DEBUG_DEBUG("Width: %i", currentRecordingFormat.width);
-      DEBUG_DEBUG("Height: %i", currentRecordingFormat.height);
-      DEBUG_DEBUG("mRateEnabled: %s", currentRecordingFormat.mRateEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("offSpeedEnabled: %s", currentRecordingFormat.offSpeedEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("interlacedEnabled: %s", currentRecordingFormat.interlacedEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("windowedModeEnabled: %s", currentRecordingFormat.windowedModeEnabled ? "Yes" : "No");
-      DEBUG_DEBUG("sensorMRateEnabled: %s", currentRecordingFormat.sensorMRateEnabled ? "Yes" : "No");
-
-      if(currentRes == "4K DCI")
-      {
-        if(btnAPressed)
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = false;
-        }
-        else
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = false;
-        }
-      }
-      else if(currentRes == "4K UHD")
-      {
-        if(btnAPressed)
-        {
-          // HD
-          width = 1920; height = 1080;
-          window = false;
-        }
-        else
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = true;
-        }
-      }
-      else // UHD
-      {
-        if(btnAPressed)
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-          window = true;
-        }
-        else
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-          window = false;
-        }
-      }
-
-      if(width != 0)
-      {
-        // Resolution or Sensor Area selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-
-        DEBUG_DEBUG("Attempting to change to:");
-        DEBUG_DEBUG(newRecordingFormat.frameDimensionsShort_string().c_str());
-        DEBUG_DEBUG(newRecordingFormat.frameRate_string().c_str());
-        DEBUG_DEBUG("Frame Rate: %hi", newRecordingFormat.frameRate);
-        DEBUG_DEBUG("Off Speed Frame Rate: %hi", newRecordingFormat.offSpeedFrameRate);
-        DEBUG_DEBUG("Width: %i", newRecordingFormat.width);
-        DEBUG_DEBUG("Height: %i", newRecordingFormat.height);
-        DEBUG_DEBUG("mRateEnabled: %s", newRecordingFormat.mRateEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("offSpeedEnabled: %s", newRecordingFormat.offSpeedEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("interlacedEnabled: %s", newRecordingFormat.interlacedEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("windowedModeEnabled: %s", newRecordingFormat.windowedModeEnabled ? "Yes" : "No");
-        DEBUG_DEBUG("sensorMRateEnabled: %s", newRecordingFormat.sensorMRateEnabled ? "Yes" : "No");
-
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
-
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
-    return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Resolution Pocket 6K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
-
-  Screen_Common_Connected(); // Common elements
-
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("BRAW RESOLUTION", 30, 9);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "6K", "6K 2.4:1", "5.7K 17:9", "4K DCI", "3.7K 6:5A", "2.8K 17:9"
-
-    // 6K
-    String labelRes = "6K";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(String(labelRes).c_str(), 65, 41);
-
-    // 6K, 2.4:1
-    labelRes = "6K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("6K", 160, 36);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-  
-    // 5.7K, 17:9
-    labelRes = "5.7K 17:9";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("5.7K", 260, 36);
-    sprite->drawCentreString("17:9", 260, 58, &Lato_Regular5pt7b);
-
-    // 4K DCI
-    labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 82);
-    sprite->drawCentreString("DCI", 65, 104, &Lato_Regular5pt7b);
-
-    // 3.7K 6:5A
-    labelRes = "3.7K 6:5A";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("3.7K", 160, 82);
-    sprite->drawCentreString("6:5 ANA", 160, 104, &Lato_Regular5pt7b);
-
-    // 2.8K 17:9
-    labelRes = "2.8K 17:9";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2.8K", 260, 82);
-    sprite->drawCentreString("17:9", 260, 104, &Lato_Regular5pt7b);
-
-    // Sensor Area
-
-    // Pocket 6K all are Windowed except 6K
-    // sprite->drawSmoothRoundRect(20, 120, 5, 3, 290, 40, TFT_DARKGREY); // Optionally draw a rectangle around this info.
-    sprite->drawCentreString(currentRes == "6K" ? "FULL SENSOR" :"SENSOR WINDOWED", 165, 129);
-    sprite->drawCentreString(currentRecordingFormat.frameWidthHeight_string().c_str(), 165, 148, &Lato_Regular5pt7b);
-  }
-  else if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-  {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    sprite->drawString("ProRes RESOLUTION", 30, 9);
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4K DCI", "4K UHD", "HD"
-
-    // 4K
-    String labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 36);
-    sprite->drawCentreString("DCI", 65, 58, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 41);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 41);
-
-    // Sensor Area
-
-    // 4K DCI is Scaled from 5.7K, Ultra HD is Scaled from Full or 5.7K, HD is Scaled from Full, 5.7K, or 2.8K (however we can't change the 5.7K or 2.8K)
-
-    sprite->drawString(currentRecordingFormat.frameWidthHeight_string().c_str(), 30, 90, &Lato_Regular5pt7b);
-    sprite->drawString("SCALED FROM SENSOR AREA", 30, 105);
-
-    if(currentRes == "4K DCI")
-    {
-      // Full sensor area only]
-      sprite->fillSmoothRoundRect(20, 130, 90, 40, 3, TFT_DARKGREEN);
-      sprite->drawCentreString("FULL", 65, 141);
-    }
-    else if(currentRes == "4K UHD")
-    {
-      // Scaled from Full or 5.7K
-      sprite->fillSmoothRoundRect(20, 130, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("FULL", 65, 141);
-
-      // 5.7K
-      sprite->fillSmoothRoundRect(115, 130, 90, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("5.3K", 160, 141);
-    }
-    else
-    {
-      // HD
-
-      // Scaled from Full, 2.8K or 5.7K (however we can't tell if it's 2.8K or 5.7K)
-      sprite->fillSmoothRoundRect(20, 130, 90, 40, 3, (!currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("FULL", 65, 141);
-
-      // 2.8K 5.7K
-      sprite->fillSmoothRoundRect(115, 130, 195, 40, 3, (currentRecordingFormat.windowedModeEnabled ? TFT_DARKGREEN : TFT_DARKGREY));
-      sprite->drawCentreString("5.3K / 2.8K", 212, 136);
-      sprite->drawCentreString("CHECK/SET ON CAMERA", 212, 156, &Lato_Regular5pt7b);
-    }
-  }
-  else
-    DEBUG_ERROR("Resolution Pocket 6K - Codec not catered for.");
-
-  sprite->pushSprite(0, 0);
-}
-
-// Resolution Screen for URSA Mini Pro G2
-void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
-{
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Resolution;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-
-  // URSA Mini Pro G2 (no window settings, just resolution)
-
-  // Get the current Resolution and Codec
-  CCUPacketTypes::RecordingFormatData currentRecordingFormat;
-  if(camera->hasRecordingFormat())
-    currentRecordingFormat = camera->getRecordingFormat();
-
-  // Get the current Codec values
-  CodecInfo currentCodec = camera->getCodec();
-
-  bool tappedAction = false;
-  if(btnAPressed || btnBPressed)
-  {
-    DEBUG_DEBUG("ResolutionURSAMiniProG2: Btn A/B pressed");
-
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str();
-    int currentWidth = currentRecordingFormat.width;
-    int currentHeight = currentRecordingFormat.height;
-
-    // URSA Mini Pro G2 has the same resolutions for BRAW and ProRes
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW || currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
-    {
-      int width = 0;
-      int height = 0;
-      bool window = true;
-
-      if(currentRes == "4.6K")
-      {
-        if(btnAPressed)
-        {
-          // 4.6K 2.4:1
-          width = 4608; height = 1920;
-        }
-        else
-        {
-          // HD
-          width = 1920; height = 1080;
-        }
-      }
-      else if(currentRes == "4.6K 2.4:1")
-      {
-        if(btnAPressed)
-        {
-          // 4K 16:9
-          width = 4096; height = 2304;
-        }
-        else
-        {
-          // 4.6K
-          width = 4608; height = 2592;
-          window = false;
-        }
-      }
-      else if(currentRes == "4K 16:9")
-      {
-        if(btnAPressed)
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-        }
-        else
-        {
-          // 4.6K 2.4:1
-          width = 4608; height = 1920;
-        }
-      }
-      else if(currentRes == "4K DCI")
-      {
-        if(btnAPressed)
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-        }
-        else
-        {
-          // 4K 16:9
-          width = 4096; height = 2304;
-        }
-      }
-      else if(currentRes == "4K UHD")
-      {
-        if(btnAPressed)
-        {
-          // 3K Ana
-          width = 3072; height = 2560;
-        }
-        else
-        {
-          // 4K DCI
-          width = 4096; height = 2160;
-        }
-      }
-      else if(currentRes == "3K Ana")
-      {
-        if(btnAPressed)
-        {
-          // 2K 16:9
-          width = 2048; height = 1152;
-        }
-        else
-        {
-          // 4K UHD
-          width = 3840; height = 2160;
-        }
-      }
-      else if(currentRes == "2K 16:9")
-      {
-        if(btnAPressed)
-        {
-          // 2K DCI
-          width = 2048; height = 1080;
-        }
-        else
-        {
-          // 3K Ana
-          width = 3072; height = 2560;
-        }
-      }
-      else if(currentRes == "2K DCI")
-      {
-        if(btnAPressed)
-        {
-          // HD
-          width = 1920; height = 1080;
-        }
-        else
-        {
-          // 2K 16:9
-          width = 2048; height = 1152;
-        }
-      }
-      else // HD
-      {
-        if(btnAPressed)
-        {
-          // 4.6K
-          width = 4608; height = 2592;
-          window = false;
-        }
-        else
-        {
-          // 2K DCI
-          width = 2048; height = 1080;
-        }
-      }
-
-      if(width != 0)
-      {
-        // Resolution selected, write to camera
-        CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
-        newRecordingFormat.width = width;
-        newRecordingFormat.height = height;
-        newRecordingFormat.windowedModeEnabled = window;
-        PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
-
-        tappedAction = true;
-      }
-    }
-  }
+  // Same screen as the Pockets, with ProRes 444 XQ and 444
+  Screen_Codec4K6K(forceRefresh);
+}
 
-  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
-  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+// Codec Screen for URSA Mini Pro 12K
+void Screen_CodecURSAMiniPro12K(bool forceRefresh = false)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
     return;
-  else
-    lastRefreshedScreen = camera->getLastModified();
+
+  connectedScreenIndex = Screens::Codec;
+
+  auto camera = BMDControlSystem::getInstance()->getCamera();
   
-  DEBUG_DEBUG("Screen Resolution URSA Mini Pro G2 Refreshed.");
+  // TO DO
+}
+
+// Codec screen - redirects to appropriate screen for camera
+void Screen_Codec(bool forceRefresh = false)
+{
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  if(camera->hasCodec())
+  {
+    if(camera->hasModelName())
+    {
+      if(camera->isPocket4K6K())
+        Screen_Codec4K6K(forceRefresh); // Pocket camera
+      else if(camera->isURSAMiniProG2())
+        Screen_CodecURSAMiniProG2(forceRefresh); // URSA Mini Pro G2
+      else if(camera->isURSAMiniPro12K())
+        Screen_CodecURSAMiniPro12K(forceRefresh); // URSA Mini Pro 12K
+      else
+        DEBUG_DEBUG("No Codec screen for this camera.");
+    } 
+    else
+      Screen_Codec4K6K(forceRefresh); // Handle no model name in 4K/6K screen
+  }
+  else
+    Screen_Codec4K6K(forceRefresh); // If we don't have any codec info, we show the 4K/6K screen that shows no codec
+}
 
+
+// Drawing only, it's called for each band when band rendering
+void Screen_Resolution_Draw()
+{
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
 
-  if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW || currentCodec.basicCodec == CCUPacketTypes::BasicCodec::ProRes)
+  ResolutionScreen::draw(Screen_UIBackend());
+}
+
+// Resolution screen for the Pocket 4K, Pocket 6K and URSA Mini Pro G2, each has its own resolutions and sensor areas in UI/ResolutionScreen
+void Screen_ResolutionModel(ResolutionScreen::Model model, bool forceRefresh)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
+    return;
+
+  connectedScreenIndex = Screens::Resolution;
+
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  // Get the current Resolution and Codec
+  CCUPacketTypes::RecordingFormatData currentRecordingFormat = {};
+  if(camera->hasRecordingFormat())
+    currentRecordingFormat = camera->getRecordingFormat();
+
+  CCUPacketTypes::BasicCodec currentCodec = camera->hasCodec() ? camera->getCodec().basicCodec : CCUPacketTypes::BasicCodec::BRAW;
+
+  // The buttons step through the resolutions as they're shown
+  ResolutionScreen::update(model, currentCodec, currentRecordingFormat);
+
+  // If we have an up/down button press
+  bool tappedAction = false;
+  if((btnAPressed || btnBPressed) && camera->hasRecordingFormat())
   {
-    // Main label
-    sprite->setTextColor(TFT_WHITE);
-    if(currentCodec.basicCodec == CCUPacketTypes::BasicCodec::BRAW)
-      sprite->drawString("BRAW RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
-    else
-      sprite->drawString("PRORES RESOLUTION", 30, 9, &AgencyFB_Bold9pt7b);
+    DEBUG_DEBUG("Resolution: Btn A/B pressed");
 
-    String currentRes = currentRecordingFormat.frameDimensionsShort_string().c_str(); // "4.6K", "4.6K 2.4:1", "4K 16:9", "4K DCI", "4K UHD", "3K Ana", "2K 16:9", "2K DCI", "HD"
+    CCUPacketTypes::RecordingFormatData newRecordingFormat;
+    ResolutionScreen::getNextOption(btnAPressed, newRecordingFormat);
 
-    // 4.6K
-    String labelRes = "4.6K";
-    sprite->fillSmoothRoundRect(20, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString(String(labelRes).c_str(), 65, 41);
+    // Resolution or Sensor Area selected, write to camera
+    PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
 
-    // 4.6K 2.4:1
-    labelRes = "4.6K 2.4:1";
-    sprite->fillSmoothRoundRect(115, 30, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4.6K", 160, 36);
-    sprite->drawCentreString("2.4:1", 160, 58, &Lato_Regular5pt7b);
-  
-    // 4K 16:9
-    labelRes = "4K 16:9";
-    sprite->fillSmoothRoundRect(210, 30, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4.6K", 260, 36);
-    sprite->drawCentreString("16:9", 260, 58, &Lato_Regular5pt7b);
-
-    // 4K DCI
-    labelRes = "4K DCI";
-    sprite->fillSmoothRoundRect(20, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("4K", 65, 82);
-    sprite->drawCentreString("DCI", 65, 104, &Lato_Regular5pt7b);
-
-    // 4K UHD
-    labelRes = "4K UHD";
-    sprite->fillSmoothRoundRect(115, 75, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("UHD", 160, 86);
-
-    // 3K Ana
-    labelRes = "3K Ana";
-    sprite->fillSmoothRoundRect(210, 75, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("3K", 260, 82);
-    sprite->drawCentreString("ANA", 260, 104, &Lato_Regular5pt7b);
-
-    // 2K 16:9
-    labelRes = "2K 16:9";
-    sprite->fillSmoothRoundRect(20, 120, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2K", 65, 128);
-    sprite->drawCentreString("16:9", 65, 149, &Lato_Regular5pt7b);
-
-    // 2K DCI
-    labelRes = "2K DCI";
-    sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("2K", 160, 128);
-    sprite->drawCentreString("DCI", 160, 149, &Lato_Regular5pt7b);
-
-    // HD
-    labelRes = "HD";
-    sprite->fillSmoothRoundRect(210, 120, 100, 40, 3, (currentRes == labelRes ? TFT_DARKGREEN : TFT_DARKGREY));
-    sprite->drawCentreString("HD", 260, 132);
+    tappedAction = true;
   }
+
+  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
+  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+    return;
   else
-    DEBUG_ERROR("Resolution URSA Mini Pro G2 - Codec not catered for.");
+    lastRefreshedScreen = camera->getLastModified();
+
+  DEBUG_DEBUG("Screen Resolution Refreshed.");
+
+  // Buttons, labels and layout are shared (UI/ResolutionScreen), only the drawing is this display's
+  Screen_Draw(Screen_Resolution_Draw);
+}
+
+// Resolution screen for Pocket 4K
+void Screen_Resolution4K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket4K, forceRefresh);
+}
+
+// Resolution screen for Pocket 6K
+void Screen_Resolution6K(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::Pocket6K, forceRefresh);
+}
 
-  sprite->pushSprite(0, 0);
+// Resolution Screen for URSA Mini Pro G2
+void Screen_ResolutionURSAMiniProG2(bool forceRefresh = false)
+{
+  Screen_ResolutionModel(ResolutionScreen::Model::URSAMiniProG2, forceRefresh);
 }
 
 // Resolution Screen for URSA Mini Pro 12K
@@ -3082,7 +1496,7 @@ void Screen_Framerate4K(bool forceRefresh = false)
     if(frameRate != 0)
     {
       // Frame rate selected, write to camera
-      CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
+      CCUPacketTypes::RecordingFormatData newRecordingFormat;
       newRecordingFormat.frameRate = frameRate;
       newRecordingFormat.mRateEnabled = mRateEnabled;
       PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
@@ -3099,6 +1513,8 @@ void Screen_Framerate4K(bool forceRefresh = false)
   
   DEBUG_DEBUG("Frame Rate Pocket 4K Refreshed.");
 
+  if(!Screen_UseSprite()) return;
+
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
@@ -3154,7 +1570,7 @@ void Screen_Framerate4K(bool forceRefresh = false)
   sprite->fillSmoothRoundRect(115, 120, 90, 40, 3, (currentFrameRate == labelFR ? TFT_DARKGREEN : TFT_DARKGREY));
   sprite->drawCentreString(labelFR.c_str(), 160, 131);
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Frame Rate Screen for Pocket 6K
@@ -3314,7 +1730,7 @@ void Screen_Framerate6K(bool forceRefresh = false)
     if(frameRate != 0)
     {
       // Frame rate selected, write to camera
-      CCUPacketTypes::RecordingFormatData newRecordingFormat = currentRecordingFormat;
+      CCUPacketTypes::RecordingFormatData newRecordingFormat;
       newRecordingFormat.frameRate = frameRate;
       newRecordingFormat.mRateEnabled = mRateEnabled;
       PacketWriter::writeRecordingFormat(newRecordingFormat, &cameraConnection);
@@ -3331,6 +1747,8 @@ void Screen_Framerate6K(bool forceRefresh = false)
   
   DEBUG_DEBUG("Frame Rate Pocket 4K Refreshed.");
 
+  if(!Screen_UseSprite()) return;
+
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
@@ -3389,7 +1807,7 @@ void Screen_Framerate6K(bool forceRefresh = false)
     sprite->drawCentreString(labelFR.c_str(), 160, 131);
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
 }
 
 // Frame Rate Screen for URSA Mini Pro G2
@@ -3446,8 +1864,18 @@ void Screen_Framerate(bool forceRefresh = false)
 }
 
 
-// Media screen for Pocket 4K
-void Screen_Media4K6K(bool forceRefresh = false)
+// Drawing only, it's called for each band when band rendering
+void Screen_Media_Draw()
+{
+  sprite->fillScreen(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
+
+  MediaScreen::draw(Screen_UIBackend());
+}
+
+// Media screen for the Pockets (CFast, SD and USB) and URSA Mini Pro G2 (two slots, named by their media)
+void Screen_MediaSlots(bool pocket, bool forceRefresh)
 {
   if(!BMDControlSystem::getInstance()->hasCamera())
     return;
@@ -3456,85 +1884,30 @@ void Screen_Media4K6K(bool forceRefresh = false)
 
   auto camera = BMDControlSystem::getInstance()->getCamera();
 
-  // 3 Media Slots - CFAST, SD, USB
+  // The buttons step through the slots as they're shown
+  MediaScreen::update(camera->getMediaSlots(), pocket);
 
+  // If we have an up/down button press
   bool tappedAction = false;
   if(btnAPressed || btnBPressed)
   {
-    DEBUG_DEBUG("Media Pocket 4K/6K: Btn A/B pressed");
+    DEBUG_DEBUG("Media: Btn A/B pressed");
 
-    // Make sure we have some media
-    bool hasMedia = camera->getMediaSlots()[0].status != CCUPacketTypes::MediaStatus::None || camera->getMediaSlots()[1].status != CCUPacketTypes::MediaStatus::None || camera->getMediaSlots()[2].status != CCUPacketTypes::MediaStatus::None;
+    // Down to the next slot with media, or up to the previous
+    int slotIndex = MediaScreen::getNextSlot(btnAPressed);
 
-    if(hasMedia)
+    if(slotIndex != -1)
     {
+      // Make the slot the active one
       TransportInfo transportInfo = camera->getTransportMode();
+      for(int index = 0; index < transportInfo.slots.size(); index++)
+        transportInfo.slots[index].active = index == slotIndex;
+      PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
 
-      bool slotAvail1 = camera->getMediaSlots()[0].status != CCUPacketTypes::MediaStatus::None;
-      bool slotAvail2 = camera->getMediaSlots()[1].status != CCUPacketTypes::MediaStatus::None;
-      bool slotAvail3 = camera->getMediaSlots()[2].status != CCUPacketTypes::MediaStatus::None;
-
-      // Make sure we have more than one available slot
-      if(slotAvail1 + slotAvail2 + slotAvail3 > 1)
-      {
-        short changeToSlot = -1;
-        short slotActive = 0;
-        if(slotAvail1 && transportInfo.slots[0].active)
-          slotActive = 1;
-        else if(slotAvail2 && transportInfo.slots[1].active)
-          slotActive = 2;
-        else
-          slotActive = 3;
-
-        if(btnAPressed)
-        {
-          // Down to the next
-          switch(slotActive)
-          {
-            case 1:
-              changeToSlot = slotAvail2 ? 2 : 3;
-              break;
-            case 2:
-              changeToSlot = slotAvail3 ? 3 : 1;
-              break;
-            case 3:
-              changeToSlot = slotAvail1 ? 1 : 2;
-              break;
-          }
-        }
-        else
-        {
-          // Up to the previous
-          switch(slotActive)
-          {
-            case 1:
-              changeToSlot = slotAvail3 ? 3 : 2;
-              break;
-            case 2:
-              changeToSlot = slotAvail1 ? 1 : 3;
-              break;
-            case 3:
-              changeToSlot = slotAvail2 ? 2 : 1;
-              break;
-          }
-        }
-
-        // Change the media slot
-        if(changeToSlot != -1)
-        {
-          transportInfo.slots[0].active = changeToSlot == 1 ? true : false;
-          transportInfo.slots[1].active = changeToSlot == 2 ? true : false;
-          transportInfo.slots[2].active = changeToSlot == 3 ? true : false;
-          PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
-
-          tappedAction = true;
-        }
-      }
-      else
-        DEBUG_DEBUG("Only 1 media available, can't change active media.");
+      tappedAction = true;
     }
     else
-      DEBUG_DEBUG("No media, can't change active media.");
+      DEBUG_DEBUG("No other media, can't change active media.");
   }
 
   // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
@@ -3542,66 +1915,23 @@ void Screen_Media4K6K(bool forceRefresh = false)
     return;
   else
     lastRefreshedScreen = camera->getLastModified();
-  
-  DEBUG_DEBUG("Screen Media Pocket 4K/6K Refreshed.");
-
-  sprite->fillScreen(TFT_BLACK);
 
-  Screen_Common_Connected(); // Common elements
+  DEBUG_DEBUG("Screen Media Refreshed.");
 
-    // Media label
-  sprite->setTextColor(TFT_WHITE);
-  sprite->drawString("MEDIA", 30, 9, &AgencyFB_Bold9pt7b);
-
-  // CFAST
-  BMDCamera::MediaSlot cfast = camera->getMediaSlots()[0];
-  sprite->fillSmoothRoundRect(20, 30, 295, 40, 3, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(cfast.StatusIsError()) sprite->drawRoundRect(20, 30, 295, 40, 3, (cfast.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("CFAST", 28, 47);
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(cfast.remainingRecordTimeString.c_str(), 155, 47);
-
-  if(cfast.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 35, &Lato_Regular5pt7b);
-  sprite->drawString("1", 300, 35, &Lato_Regular5pt7b);
-  sprite->drawString(cfast.GetStatusString().c_str(), 28, 35, &Lato_Regular5pt7b);
-
-  // SD
-  BMDCamera::MediaSlot sd = camera->getMediaSlots()[1];
-  sprite->fillSmoothRoundRect(20, 75, 295, 40, 3, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(sd.StatusIsError()) sprite->drawRoundRect(20, 75, 295, 40, 3, (sd.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("SD", 28, 92);
-  if(sd.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(sd.remainingRecordTimeString.c_str(), 155, 92);
-
-  if(sd.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 80, &Lato_Regular5pt7b);
-  sprite->drawString("2", 300, 80, &Lato_Regular5pt7b);
-  sprite->drawString(sd.GetStatusString().c_str(), 28, 80, &Lato_Regular5pt7b);
-  if(sd.StatusIsError()) sprite->setTextColor(TFT_WHITE);
-
-  // USB
-  BMDCamera::MediaSlot usb = camera->getMediaSlots()[2];
-  sprite->fillSmoothRoundRect(20, 120, 295, 40, 3, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  if(usb.StatusIsError()) sprite->drawRoundRect(20, 120, 295, 40, 3, (usb.active ? TFT_DARKGREEN : TFT_DARKGREY));
-  sprite->drawString("USB", 28, 137);
-  if(usb.status != CCUPacketTypes::MediaStatus::None) sprite->drawString(usb.remainingRecordTimeString.c_str(), 155, 137);
-  
-  if(usb.status != CCUPacketTypes::MediaStatus::None) sprite->drawString("REMAINING TIME", 155, 125, &Lato_Regular5pt7b);
-  sprite->drawString("3", 300, 125, &Lato_Regular5pt7b);
-  sprite->drawString(usb.GetStatusString().c_str(), 28, 125, &Lato_Regular5pt7b);
-  if(usb.StatusIsError()) sprite->setTextColor(TFT_WHITE);
+  // Buttons, labels and layout are shared (UI/MediaScreen), only the drawing is this display's
+  Screen_Draw(Screen_Media_Draw);
+}
 
-  sprite->pushSprite(0, 0);
+// Media screen for Pocket 4K and 6K
+void Screen_Media4K6K(bool forceRefresh = false)
+{
+  Screen_MediaSlots(true, forceRefresh);
 }
 
 // Media Screen for URSA Mini Pro G2
 void Screen_MediaURSAMiniProG2(bool forceRefresh = false)
 {
-  if(!BMDControlSystem::getInstance()->hasCamera())
-    return;
-
-  connectedScreenIndex = Screens::Media;
-
-  auto camera = BMDControlSystem::getInstance()->getCamera();
-  
-  // TO DO
+  Screen_MediaSlots(false, forceRefresh);
 }
 
 // Media Screen for URSA Mini Pro 12K
@@ -3677,6 +2007,8 @@ void Screen_Lens(bool forceRefresh = false)
 
   DEBUG_DEBUG("Screen Lens Refreshed.");
 
+  if(!Screen_UseSprite()) return;
+
   sprite->fillScreen(TFT_BLACK);
 
   Screen_Common_Connected(); // Common elements
@@ -3723,7 +2055,102 @@ void Screen_Lens(bool forceRefresh = false)
     sprite->drawString(camera->getApertureFStopString().c_str(), 30, 165, &Lato_Regular12pt7b);
   }
 
-  sprite->pushSprite(0, 0);
+  Screen_Present();
+}
+
+void Screen_Looks(bool forceRefresh = false)
+{
+  if(!BMDControlSystem::getInstance()->hasCamera())
+    return;
+
+  connectedScreenIndex = Screens::Looks;
+
+  auto camera = BMDControlSystem::getInstance()->getCamera();
+
+  bool tappedAction = false;
+  if(btnAPressed || btnBPressed)
+  {
+    DEBUG_DEBUG("Looks: Btn A/B pressed");
+
+    if(btnAPressed)
+    {
+      // Next look after the last one recalled
+      for(byte offset = 1; offset <= LookPresets::kMaxLooks; offset++)
+      {
+        byte slot = (LookPresets::getLastRecalled() + offset) % LookPresets::kMaxLooks;
+        if(LookPresets::isUsed(slot))
+        {
+          LookPresets::recall(slot);
+          break;
+        }
+      }
+
+      tappedAction = true;
+    }
+    else if(btnBPressed)
+    {
+      // Into the first empty slot, or over the last one recalled when they're all used
+      int slot = LookPresets::findEmpty();
+      if(slot == -1)
+        slot = std::max(0, LookPresets::getLastRecalled());
+
+      LookPresets::capture(slot, "");
+
+      tappedAction = true;
+    }
+  }
+
+  // If the screen hasn't changed, there were no touch events and we don't have to refresh, return.
+  if(lastRefreshedScreen == camera->getLastModified() && !forceRefresh && !tappedAction)
+    return;
+  else
+    lastRefreshedScreen = camera->getLastModified();
+
+  DEBUG_DEBUG("Screen Looks Refreshed.");
+
+  if(!Screen_UseSprite()) return;
+
+  sprite->fillScreen(TFT_BLACK);
+
+  Screen_Common_Connected(); // Common elements
+
+  // Looks label
+  sprite->setTextColor(TFT_WHITE);
+  sprite->drawString("LOOKS", 30, 9, &AgencyFB_Bold9pt7b);
+
+  if(LookPresets::getLastRecallMs() != 0 && !LookPresets::isRecalling())
+  {
+    std::string recallTime = std::to_string(LookPresets::getLastRecallMs()) + "ms";
+    sprite->setTextColor(TFT_LIGHTGREY);
+    sprite->drawRightString(recallTime.c_str(), 310, 9, &AgencyFB_Regular7pt7b);
+  }
+
+  // A row for each slot, green when the camera is on it, orange while it's being recalled
+  for(byte slot = 0; slot < LookPresets::kMaxLooks; slot++)
+  {
+    int y = 32 + slot * 29;
+
+    if(!LookPresets::isUsed(slot))
+    {
+      sprite->drawRoundRect(30, y, 280, 25, 3, TFT_DARKGREY);
+      sprite->setTextColor(TFT_DARKGREY);
+      sprite->drawString("EMPTY", 40, y + 6, &AgencyFB_Regular7pt7b);
+      continue;
+    }
+
+    int colour = TFT_DARKCYAN;
+    if(LookPresets::isRecalling() && LookPresets::getLastRecalled() == slot)
+      colour = TFT_ORANGE;
+    else if(LookPresets::matches(slot))
+      colour = TFT_DARKGREEN;
+
+    sprite->fillSmoothRoundRect(30, y, 280, 25, 3, colour);
+    sprite->setTextColor(TFT_WHITE);
+    sprite->drawString(LookPresets::getLook(slot).name, 40, y + 4, &AgencyFB_Bold9pt7b);
+    sprite->drawRightString(LookPresets::getSummary(slot).c_str(), 300, y + 6, &AgencyFB_Regular7pt7b);
+  }
+
+  Screen_Present();
 }
 
 void setup() {
@@ -3772,14 +2199,46 @@ void setup() {
   Debug.setDebugLevel(DBG_VERBOSE);
   Debug.timestampOn();
 
-  // Allow a timeout of 30 seconds for time for the pass key entry. It's slower with buttons
-  esp_task_wdt_init(35, true);
+  // Pass key entry runs in loop() and doesn't hold up the Bluetooth task, so the watchdog can stay tight
+  esp_task_wdt_init(5, true);
 
   // Splash screen
   tft.pushImage(0, 0, IWIDTH, IHEIGHT, MPCSplash_M5Stack_CoreS3);
 
   // Prepare for Bluetooth connections and start scanning for cameras
   cameraConnection.initialise(&tft, IWIDTH, IHEIGHT); // Screen Pass Key entry
+  LinkHealthMonitor::begin(&cameraConnection); // Watches the link once connected
+  LookPresets::begin(&cameraConnection); // Saved looks, from NVS
+
+#if USING_DISPLAY_PRESENTER == 1
+  DisplayPresenter::begin({ Presenter_BeginTransfers, Presenter_Transfer, Presenter_Busy, Presenter_EndTransfers }, IWIDTH, IHEIGHT, DisplayPresenter::PixelFormat::RGB332, 8, false);
+#endif
+
+#if USING_BAND_RENDERER == 1
+  // Shared screens are drawn a band at a time in 16 bit colour, the full screen sprite is only allocated for the other screens
+  bandSprite.setSwapBytes(true);
+  BandRenderer::begin({ Band_BeginTransfers, Presenter_Transfer, Presenter_Busy, Presenter_EndTransfers }, Band_Begin, IWIDTH, IHEIGHT, BAND_ROWS);
+#endif
+
+  RenderScheduler::begin(RENDER_TARGET_FPS, INPUT_SAMPLES_PER_SECOND);
+
+  // Shared screens are laid out once, they use the 320 x 170 area above the bottom buttons
+  ISOScreen::layout(320, 170);
+  ShutterAngleScreen::layout(320, 170);
+  ShutterSpeedScreen::layout(320, 170);
+  WhiteBalanceScreen::layout(320, 170);
+  CodecScreen::layout(320, 170);
+  ResolutionScreen::layout(320, 170);
+  MediaScreen::layout(320, 170);
+
+  // No PSRAM, so a small budget of internal RAM (8 bit tiles are half the size)
+  if(TILE_CACHE_BYTES > 0)
+    TileCache::begin(TILE_CACHE_BYTES);
+
+  // Presses are queued from the buttons' interrupts and wake loop() up
+  InputQueue::attachButton(static_cast<byte>(Buttons::A), BUTTON_A_PIN);
+  InputQueue::attachButton(static_cast<byte>(Buttons::B), BUTTON_B_PIN);
+  InputQueue::attachButton(static_cast<byte>(Buttons::C), BUTTON_C_PIN);
 }
 
 int memoryLoopCounter;
@@ -3787,17 +2246,33 @@ bool forceRecordOutline = false; // Show the recording outline as we haven't don
 
 void loop() {
 
+  // Button presses are kept until a screen has been drawn to pick them up
+  bool inputConsumed = true;
+
+  // The camera is waiting for a pass key, its entry screen has the display and input until it's answered
+  if(cameraConnection.servicePassKey())
+  {
+    connectedScreenIndex = Screens::PassKey; // Screens are drawn in full again afterwards
+    InputQueue::clear(); // It reads the buttons itself
+    delay(10);
+    return;
+  }
+
   dacWrite (25,0); // Silence the speaker as it sometimes makes high-pitched noise on screen refreshes: https://community.m5stack.com/topic/61/noise-on-speaker/16
 
-  static unsigned long lastConnectedTime = 0;
-  const unsigned long reconnectInterval = 5000;  // 5 seconds (milliseconds)
+  // Refresh the screen when the link health changes so the sidebar shows it
+  if(LinkHealthMonitor::update())
+    lastRefreshedScreen = 0;
 
-  unsigned long currentTime = millis();
+  // Refresh when a look has been recalled so it shows as the camera's
+  if(LookPresets::service())
+    lastRefreshedScreen = 0;
 
-  if ((cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected || cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey) && currentTime - lastConnectedTime >= reconnectInterval) {
+  // The connection works out when to try again, backing off while no camera is found
+  if (cameraConnection.reconnectDue()) {
     
     if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected)
-      DEBUG_VERBOSE("Disconnected for too long, trying to reconnect");
+      DEBUG_VERBOSE("Not connected, trying to reconnect");
     else
       DEBUG_VERBOSE("Failed Pass Key, trying to reconnect");
 
@@ -3820,68 +2295,72 @@ void loop() {
       if(cameraConnection.getInitialPayloadTime() != ULONG_MAX && cameraConnection.getInitialPayloadTime() > camera->getLastModified())
         camera->setLastModified();
 
-      switch(connectedScreenIndex)
+      // Camera changes, screen changes and button presses invalidate the screen, it's drawn on the next frame tick
+      if(lastRefreshedScreen != camera->getLastModified() || btnAPressed || btnBPressed)
+        RenderScheduler::invalidate();
+
+      inputConsumed = RenderScheduler::frameDue();
+      if(inputConsumed)
       {
-        case Screens::Dashboard:
-          Screen_Dashboard();
-          break;
-        case Screens::Recording:
-          Screen_Recording();
-          break;
-        case Screens::ISO:
-          Screen_ISO();
-          break;
-        case Screens::ShutterAngleSpeed:
-          if(camera->shutterValueIsAngle)
-            Screen_ShutterAngle();
-          else
-            Screen_ShutterSpeed();
-          break;
-        case Screens::WhiteBalanceTintWB:
-        case Screens::WhiteBalanceTintT:
-          Screen_WBTint(connectedScreenIndex == Screens::WhiteBalanceTintWB);
-          break;
-        case Screens::Codec:
-          Screen_Codec();
-          break;
-        case Screens::Resolution:
-          Screen_Resolution();
-          break;
-        case Screens::Framerate:
-          Screen_Framerate();
-          break;
-        case Screens::Media:
-          Screen_Media();
-          break;
-        case Screens::Lens:
-          Screen_Lens();
-          break;
+        switch(connectedScreenIndex)
+        {
+          case Screens::Dashboard:
+            Screen_Dashboard();
+            break;
+          case Screens::Recording:
+            Screen_Recording();
+            break;
+          case Screens::ISO:
+            Screen_ISO();
+            break;
+          case Screens::ShutterAngleSpeed:
+            if(camera->shutterValueIsAngle)
+              Screen_ShutterAngle();
+            else
+              Screen_ShutterSpeed();
+            break;
+          case Screens::WhiteBalanceTintWB:
+          case Screens::WhiteBalanceTintT:
+            Screen_WBTint(connectedScreenIndex == Screens::WhiteBalanceTintWB);
+            break;
+          case Screens::Codec:
+            Screen_Codec();
+            break;
+          case Screens::Resolution:
+            Screen_Resolution();
+            break;
+          case Screens::Framerate:
+            Screen_Framerate();
+            break;
+          case Screens::Media:
+            Screen_Media();
+            break;
+          case Screens::Lens:
+            Screen_Lens();
+            break;
+          case Screens::Looks:
+            Screen_Looks();
+            break;
+        }
       }
     }
     else
       Screen_Dashboard(true); // Was on disconnected screen, now we're connected go to the dashboard
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningFound)
   {
     DEBUG_DEBUG("Cameras found!");
 
-    cameraConnection.connect(cameraConnection.cameraAddresses[0]);
-
-    if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
-      DEBUG_DEBUG("Loop - Failed Pass Key");
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[0]);
 
     // Clear the screen so we can show the dashboard cleanly
+    DisplayPresenter::waitIdle();
     tft.fillScreen(TFT_BLACK);
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningNoneFound)
   {
     DEBUG_VERBOSE("Status Scanning NONE Found. Marking as Disconnected.");
     cameraConnection.status = BMDCameraConnection::Disconnected;
-    lastConnectedTime = currentTime;
 
     Screen_NoConnection();
   }
@@ -3895,16 +2374,28 @@ void loop() {
   */
 
   // Buttons
-  btnAPressed = false;
-  btnBPressed = false;
+  if(inputConsumed)
+  {
+    // A screen has picked up the press
+    if(btnAPressed || btnBPressed)
+      InputQueue::actionTaken(pendingButton);
+
+    btnAPressed = false;
+    btnBPressed = false;
+  }
 
-  M5.update();
+  // Holding A or B keeps stepping on the screens where they step through values
+  InputQueue::setRepeating(connectedScreenIndex == Screens::ISO || connectedScreenIndex == Screens::ShutterAngleSpeed || connectedScreenIndex == Screens::WhiteBalanceTintWB || connectedScreenIndex == Screens::WhiteBalanceTintT);
 
-  if(M5.BtnA.wasPressed() || M5.BtnB.wasPressed() || M5.BtnC.wasPressed())
+  // Presses come from the buttons' interrupts, so one during a redraw or a scan is still here. One at a time, the screens pick up
+  // A and B on their next frame.
+  InputQueue::Event input;
+  while(!btnAPressed && !btnBPressed && InputQueue::poll(input))
   {
-    // Left button function changes on context
-    // Only handle dashboard here
-    if(M5.BtnA.wasPressed())
+    if(input.type != InputQueue::Type::Press && input.type != InputQueue::Type::Repeat)
+      continue;
+
+    if(input.id == static_cast<byte>(Buttons::A))
     {
       DEBUG_DEBUG("Button A");
 
@@ -3921,12 +2412,14 @@ void loop() {
         case Screens::Framerate:
         case Screens::Media:
         case Screens::Lens:
+        case Screens::Looks:
           // Indicate to the other screens the first button has been pressed
           btnAPressed = true;
+          pendingButton = input;
           break;
       }
     }
-    else if(M5.BtnB.wasPressed())
+    else if(input.id == static_cast<byte>(Buttons::B))
     {
       DEBUG_DEBUG("Button B");
 
@@ -3959,6 +2452,7 @@ void loop() {
 
                     // Send the packet to the camera to start recording
                     PacketWriter::writeTransportInfo(transportInfo, &cameraConnection);
+                    InputQueue::actionTaken(input);
                 }
             }
           }
@@ -3972,12 +2466,14 @@ void loop() {
         case Screens::Framerate:
         case Screens::Media:
         case Screens::Lens:
+        case Screens::Looks:
           // Indicate to the other screens the second button has been pressed
           btnBPressed = true;
+          pendingButton = input;
           break;
       }
     }
-    else if(M5.BtnC.wasPressed())
+    else if(input.id == static_cast<byte>(Buttons::C) && input.type == InputQueue::Type::Press)
     {
       DEBUG_DEBUG("Button C > NEXT SCREEN");
 
@@ -4014,13 +2510,26 @@ void loop() {
           connectedScreenIndex = Screens::Lens;
           break;
         case Screens::Lens:
+          connectedScreenIndex = Screens::Looks;
+          break;
+        case Screens::Looks:
           connectedScreenIndex = Screens::Dashboard;
           break;
       }
 
       lastRefreshedScreen = 0; // Forces a refresh
+      InputQueue::actionTaken(input);
     }
   }
 
-  delay(5);
+  // How long presses waited to be acted on
+  if(Debug.getDebugLevel() >= DBG_VERBOSE && ++memoryLoopCounter % 4000 == 0)
+  {
+    RenderScheduler::reportStats();
+    InputQueue::reportStats();
+    LookPresets::reportStats();
+  }
+
+  // Sleep until the next input sample or frame tick
+  RenderScheduler::waitForNextTick();
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #define USING_TFT_ESPI 0  // Using the TFT_eSPI graphics library <-- must include this in every main file, 0 = not using, 1 = using
 #define USING_M5GFX = 0   // Using the M5GFX graphics library <-- must include this in every main file, 0 = not using, 1 = using
+#define BENCHMARK_IMAGES 0 // 1 = Log the flash saved and decode time of the compressed images against the raw ones at startup
 
 // Note that the M5Stack libraries have their own modified TFT_eSPI libraries
 
@@ -14,14 +15,21 @@
 // Main BMD Libraries
 #include "Camera/PacketWriter.h"
 #include "Camera/BMDCameraConnection.h"
+#include "Camera/LinkHealthMonitor.h"
 
 // Bluetooth for bonding support
 #include <BLEUtils.h>
 #include <BLEServer.h>
 
-// Images
+// Images, compressed with tools/mpc_image.py
+#include "Images/CompressedImage.h"
+#include "Images/MPCSplash-M5StickC-Plus-Compressed.h"
+#include "Images/ImageBluetooth-Compressed.h"
+
+#if BENCHMARK_IMAGES == 1
 #include "Images/MPCSplash-M5StickC-Plus.h"
 #include "Images/ImageBluetooth.h"
+#endif
 
 
 
@@ -40,6 +48,23 @@ TFT_eSprite spriteMPCSplash = TFT_eSprite(&M5.Lcd);
 #define IWIDTH 240
 #define IHEIGHT 135
 
+// Compressed images are decoded a band of rows at a time into the window
+#define IMAGE_BAND_ROWS 9
+uint16_t imageBand[IWIDTH * IMAGE_BAND_ROWS];
+
+CompressedImage imageSplash(MPCSplash_M5StickC_Plus_Compressed, sizeof(MPCSplash_M5StickC_Plus_Compressed));
+CompressedImage imageBluetooth(Wikipedia_Bluetooth_30x46_Compressed, sizeof(Wikipedia_Bluetooth_30x46_Compressed));
+
+void Image_PushBand(short x, short y, short w, short h, const uint16_t* pixels)
+{
+  window.pushImage(x, y, w, h, const_cast<uint16_t*>(pixels));
+}
+
+void Image_Draw(CompressedImage& image, short x, short y)
+{
+  image.draw(x, y, imageBand, IMAGE_BAND_ROWS, Image_PushBand);
+}
+
 enum class Screens : byte
 {
   // PassKey = 9,
@@ -83,13 +108,13 @@ void Screen_NoConnection()
 
   connectedScreenIndex = Screens::NoConnection;
 
-  window.pushImage(0, 0, IWIDTH, IHEIGHT, MPCSplash_M5StickC_Plus);
+  Image_Draw(imageSplash, 0, 0);
 
   // Black background for text and Bluetooth Logo
   window.fillRect(0, 3, IWIDTH, 51, TFT_BLACK);
 
   // Bluetooth Image
-  window.pushImage(20, 6, 30, 46, Wikipedia_Bluetooth_30x46);
+  Image_Draw(imageBluetooth, 20, 6);
   
   window.setTextSize(2);
   window.textbgcolor = TFT_BLACK;
@@ -161,7 +186,7 @@ void Screen_NoConnection()
 
     window.pushSprite(0, 0);
 
-    cameraConnection.connect(cameraConnection.cameraAddresses[connectToCameraIndex]);
+    cameraConnection.connectInBackground(cameraConnection.cameraAddresses[connectToCameraIndex]);
     connectToCameraIndex = -1;
   }
   else
@@ -417,25 +442,45 @@ void setup() {
     window.createSprite(IWIDTH, IHEIGHT);
 
     // Load the splash screen image into the sprite
-    window.pushImage(0, 0, IWIDTH, IHEIGHT, MPCSplash_M5StickC_Plus);
+    Image_Draw(imageSplash, 0, 0);
 
     // And draw it on screen!
     window.pushSprite(0, 0);
 
+#if BENCHMARK_IMAGES == 1
+    CompressedImage::benchmark("Splash", MPCSplash_M5StickC_Plus_Compressed, sizeof(MPCSplash_M5StickC_Plus_Compressed), MPCSplash_M5StickC_Plus);
+    CompressedImage::benchmark("Bluetooth", Wikipedia_Bluetooth_30x46_Compressed, sizeof(Wikipedia_Bluetooth_30x46_Compressed), Wikipedia_Bluetooth_30x46);
+
+    // Into the window, as the screens draw it
+    unsigned long benchmarkStart = micros();
+    window.pushImage(0, 0, IWIDTH, IHEIGHT, MPCSplash_M5StickC_Plus);
+    unsigned long rawMicros = micros() - benchmarkStart;
+
+    benchmarkStart = micros();
+    Image_Draw(imageSplash, 0, 0);
+    DEBUG_INFO("Splash into the window: raw pushImage %luus, compressed %luus", rawMicros, micros() - benchmarkStart);
+#endif
+
     // Prepare for Bluetooth connections and start scanning for cameras
     cameraConnection.initialise(); // For Serial-based pass key entry
+    LinkHealthMonitor::begin(&cameraConnection); // Watches the link once connected
 
 }
 
 void loop() {
 
-  static unsigned long lastConnectedTime = 0;
-  const unsigned long reconnectInterval = 5000;  // 5 seconds (milliseconds)
+  // The camera is waiting for a pass key, it's read from serial without blocking until it's answered
+  if(cameraConnection.servicePassKey())
+  {
+    delay(10);
+    return;
+  }
 
-  unsigned long currentTime = millis();
+  LinkHealthMonitor::update();
 
-  if (cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected && currentTime - lastConnectedTime >= reconnectInterval) {
-    DEBUG_VERBOSE("Disconnected for too long, trying to reconnect");
+  // The connection works out when to try again, backing off while no camera is found
+  if (cameraConnection.reconnectDue()) {
+    DEBUG_VERBOSE("Not connected, trying to reconnect");
 
     // For testing, this removes BLE bondings so the pass key needs to be entered. Remove comment to force pass key entry.
     // BMDCameraConnection::clearBondedDevices();
@@ -468,31 +513,22 @@ void loop() {
     }
     else
       Screen_Dashboard(true); // Was on disconnected screen, now we're connected go to the dashboard
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningFound)
   {
     Screen_NoConnection();
-
-    lastConnectedTime = currentTime;
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::ScanningNoneFound)
   {
     DEBUG_VERBOSE("Status Scanning NONE Found. Marking as Disconnected.");
     cameraConnection.status = BMDCameraConnection::Disconnected;
-    lastConnectedTime = currentTime;
 
     Screen_NoConnection();
   }
   else if(cameraConnection.status == BMDCameraConnection::ConnectionStatus::FailedPassKey)
   {
-    // Pass Key failed, so show it and then delay for 2 seconds and reset status to disconnected.
+    // Pass Key failed, shown until reconnectDue() resets it to disconnected
     Screen_NoConnection();
-
-    delay(2000);
-
-    cameraConnection.status == BMDCameraConnection::ConnectionStatus::Disconnected;
   }
 
   // Read the state of the buttons
@@ -0,0 +1,48 @@
+// Host benchmark of ExposureMath::compensate(), the work ExposureEngine does for each step of a transition
+#include "Camera/ExposureMath.h"
+#include <chrono>
+#include <stdio.h>
+
+typedef ExposureMath::Parameter Parameter;
+typedef ExposureMath::Exposure Exposure;
+
+int main()
+{
+    const int kRepeats = 5;
+
+    double fastestNanos = 0.0;
+    unsigned long calls = 0;
+    float total = 0.0f; // Used so the calls aren't optimised away
+
+    for(int repeat = 0; repeat < kRepeats; repeat++)
+    {
+        calls = 0;
+        auto start = std::chrono::steady_clock::now();
+
+        for(byte isoIndex = 0; isoIndex < ExposureMath::getTableCount(Parameter::ISO, true); isoIndex++)
+        for(byte shutterIndex = 0; shutterIndex < ExposureMath::getTableCount(Parameter::Shutter, true); shutterIndex++)
+        for(byte apertureIndex = 0; apertureIndex < ExposureMath::getTableCount(Parameter::Iris, true); apertureIndex++)
+        {
+            Exposure exposure;
+            exposure.iso = ExposureMath::getTableValue(Parameter::ISO, true, isoIndex);
+            exposure.shutter = ExposureMath::getTableValue(Parameter::Shutter, true, shutterIndex);
+            exposure.aperture = ExposureMath::getTableValue(Parameter::Iris, true, apertureIndex);
+            exposure.hasAperture = true;
+
+            for(byte valueIndex = 0; valueIndex < ExposureMath::getTableCount(Parameter::Iris, true); valueIndex++)
+            {
+                Exposure target = exposure;
+                total += ExposureMath::compensate(exposure, target, Parameter::Iris, ExposureMath::getTableValue(Parameter::Iris, true, valueIndex));
+                calls++;
+            }
+        }
+
+        double nanos = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+        if(repeat == 0 || nanos < fastestNanos)
+            fastestNanos = nanos;
+    }
+
+    printf("ExposureMath::compensate: %lu iris changes, fastest of %i runs %.0f ns each (checksum %.1f)\n", calls, kRepeats, fastestNanos, total);
+
+    return 0;
+}
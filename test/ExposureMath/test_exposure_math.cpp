@@ -0,0 +1,188 @@
+// Host test of ExposureEngine's exposure value maths over every ISO, shutter and aperture table combination
+#include "Camera/ExposureMath.h"
+#include "Config/VideoConfig.h"
+#include "Config/LensConfig.h"
+#include <math.h>
+#include <stdio.h>
+
+typedef ExposureMath::Parameter Parameter;
+typedef ExposureMath::Exposure Exposure;
+
+static const float kConsistencyStops = 0.0001f;
+static const float kRoundingStops = 0.01f;
+
+static unsigned long checks = 0;
+static unsigned long failures = 0;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        checks++; \
+        if(!(condition)) \
+        { \
+            failures++; \
+            if(failures <= 20) \
+            { \
+                printf("FAILED %s:%i: %s, ", __FILE__, __LINE__, #condition); \
+                printf(__VA_ARGS__); \
+                printf("\n"); \
+            } \
+        } \
+    } while(0)
+
+static bool isTableValue(Parameter parameter, bool shutterIsAngle, int32_t value)
+{
+    for(byte index = 0; index < ExposureMath::getTableCount(parameter, shutterIsAngle); index++)
+    {
+        if(ExposureMath::getTableValue(parameter, shutterIsAngle, index) == value)
+            return true;
+    }
+
+    return false;
+}
+
+// Lowest and highest stops the parameter's table can give
+static void tableRange(Parameter parameter, const Exposure& exposure, float& lowest, float& highest)
+{
+    byte count = ExposureMath::getTableCount(parameter, exposure.shutterIsAngle);
+    float first = ExposureMath::getStops(parameter, exposure, ExposureMath::getTableValue(parameter, exposure.shutterIsAngle, 0));
+    float last = ExposureMath::getStops(parameter, exposure, ExposureMath::getTableValue(parameter, exposure.shutterIsAngle, count - 1));
+
+    lowest = fminf(first, last);
+    highest = fmaxf(first, last);
+}
+
+// Widest step between neighbouring values on the parameter's table, in stops
+static float widestGap(Parameter parameter, const Exposure& exposure)
+{
+    float widest = 0.0f;
+    for(byte index = 1; index < ExposureMath::getTableCount(parameter, exposure.shutterIsAngle); index++)
+    {
+        float previous = ExposureMath::getStops(parameter, exposure, ExposureMath::getTableValue(parameter, exposure.shutterIsAngle, index - 1));
+        float current = ExposureMath::getStops(parameter, exposure, ExposureMath::getTableValue(parameter, exposure.shutterIsAngle, index));
+        widest = fmaxf(widest, fabsf(current - previous));
+    }
+
+    return widest;
+}
+
+static void testStops()
+{
+    CHECK(fabsf(ExposureMath::isoStops(100)) < kConsistencyStops, "ISO 100 is %.4f stops", ExposureMath::isoStops(100));
+    CHECK(fabsf(ExposureMath::isoStops(800) - 3.0f) < kConsistencyStops, "ISO 800 is %.4f stops", ExposureMath::isoStops(800));
+    CHECK(fabsf(ExposureMath::shutterStops(true, 18000) + 1.0f) < kConsistencyStops, "180 degrees is %.4f stops", ExposureMath::shutterStops(true, 18000));
+    CHECK(fabsf(ExposureMath::shutterStops(false, 50) + log2f(50.0f)) < kConsistencyStops, "1/50 is %.4f stops", ExposureMath::shutterStops(false, 50));
+    CHECK(fabsf(ExposureMath::apertureStops(4096) + 2.0f) < kConsistencyStops, "f2 is %.4f stops", ExposureMath::apertureStops(4096));
+    CHECK(fabsf(ExposureMath::apertureStops(8192) + 4.0f) < kConsistencyStops, "f4 is %.4f stops", ExposureMath::apertureStops(8192));
+
+    // A stop down on the iris is a stop up on the ISO
+    Exposure start;
+    start.iso = 800;
+    start.shutter = 18000;
+    start.aperture = 6084; // f2.8
+    start.hasAperture = true;
+
+    Exposure target = start;
+    float error = ExposureMath::compensate(start, target, Parameter::Iris, 8192); // f4
+    CHECK(target.iso == 1600 && target.shutter == 18000 && fabsf(error) < 0.05f, "f2.8 to f4 gave ISO %i, shutter %i, %.3f stops", target.iso, static_cast<int>(target.shutter), error);
+}
+
+// Every start on the tables, changing each parameter to every value on its table
+static unsigned long testCombinations(bool shutterIsAngle, bool hasAperture, float& worstError)
+{
+    unsigned long combinations = 0;
+    byte isoCount = ExposureMath::getTableCount(Parameter::ISO, shutterIsAngle);
+    byte shutterCount = ExposureMath::getTableCount(Parameter::Shutter, shutterIsAngle);
+    byte apertureCount = hasAperture ? ExposureMath::getTableCount(Parameter::Iris, shutterIsAngle) : 1;
+
+    for(byte isoIndex = 0; isoIndex < isoCount; isoIndex++)
+    for(byte shutterIndex = 0; shutterIndex < shutterCount; shutterIndex++)
+    for(byte apertureIndex = 0; apertureIndex < apertureCount; apertureIndex++)
+    {
+        Exposure start;
+        start.iso = ExposureMath::getTableValue(Parameter::ISO, shutterIsAngle, isoIndex);
+        start.shutterIsAngle = shutterIsAngle;
+        start.shutter = ExposureMath::getTableValue(Parameter::Shutter, shutterIsAngle, shutterIndex);
+        start.hasAperture = hasAperture;
+        start.aperture = hasAperture ? ExposureMath::getTableValue(Parameter::Iris, shutterIsAngle, apertureIndex) : 0;
+
+        for(byte index = 0; index < static_cast<byte>(Parameter::Count); index++)
+        {
+            Parameter parameter = static_cast<Parameter>(index);
+            if(parameter == Parameter::Iris && !hasAperture)
+                continue;
+
+            for(byte valueIndex = 0; valueIndex < ExposureMath::getTableCount(parameter, shutterIsAngle); valueIndex++)
+            {
+                int32_t value = ExposureMath::getTableValue(parameter, shutterIsAngle, valueIndex);
+
+                Exposure target = start;
+                float error = ExposureMath::compensate(start, target, parameter, value);
+                combinations++;
+
+                float actual = ExposureMath::stops(target) - ExposureMath::stops(start);
+                CHECK(fabsf(error - actual) < kConsistencyStops, "returned %.4f stops but it's %.4f off", error, actual);
+                CHECK(ExposureMath::getValue(parameter, target) == value, "%i wasn't set", static_cast<int>(value));
+                CHECK(target.shutterIsAngle == start.shutterIsAngle && target.hasAperture == start.hasAperture, "the shutter mode or lens changed");
+                CHECK(hasAperture || target.aperture == start.aperture, "the aperture moved without a lens reporting it");
+
+                for(byte otherIndex = 0; otherIndex < static_cast<byte>(Parameter::Count); otherIndex++)
+                {
+                    Parameter other = static_cast<Parameter>(otherIndex);
+                    if(other != parameter && (other != Parameter::Iris || hasAperture))
+                        CHECK(isTableValue(other, shutterIsAngle, ExposureMath::getValue(other, target)), "%i isn't on the table", static_cast<int>(ExposureMath::getValue(other, target)));
+                }
+
+                // Never further off than not compensating at all
+                Exposure uncompensated = start;
+                ExposureMath::setValue(parameter, uncompensated, value);
+                float uncompensatedError = ExposureMath::stops(uncompensated) - ExposureMath::stops(start);
+                CHECK(fabsf(error) <= fabsf(uncompensatedError) + kConsistencyStops, "%.3f stops off is worse than the %.3f of not compensating", error, uncompensatedError);
+
+                // Within tolerance whenever the other tables reach far enough to make up the change. The nearest table value can
+                // be up to half a step off, so the tolerance is half the widest step on the tables that make it up.
+                float lowest = ExposureMath::getStops(parameter, target, value);
+                float highest = lowest;
+                float tolerance = 0.0f;
+                for(byte otherIndex = 0; otherIndex < static_cast<byte>(Parameter::Count); otherIndex++)
+                {
+                    Parameter other = static_cast<Parameter>(otherIndex);
+                    if(other == parameter || (other == Parameter::Iris && !hasAperture))
+                        continue;
+
+                    float otherLowest, otherHighest;
+                    tableRange(other, target, otherLowest, otherHighest);
+                    lowest += otherLowest;
+                    highest += otherHighest;
+                    tolerance = fmaxf(tolerance, widestGap(other, target) / 2.0f + kRoundingStops);
+                }
+
+                float wanted = ExposureMath::stops(start);
+                if(wanted >= lowest && wanted <= highest)
+                {
+                    worstError = fmaxf(worstError, fabsf(error));
+                    CHECK(fabsf(error) <= tolerance, "ISO %i, shutter %i, aperture %i, %s to %i is %.3f stops off", start.iso, static_cast<int>(start.shutter), start.aperture, parameter == Parameter::ISO ? "ISO" : (parameter == Parameter::Shutter ? "shutter" : "iris"), static_cast<int>(value), error);
+                }
+            }
+        }
+    }
+
+    return combinations;
+}
+
+int main()
+{
+    testStops();
+
+    float worstError = 0.0f;
+    unsigned long combinations = 0;
+    combinations += testCombinations(true, true, worstError);
+    combinations += testCombinations(false, true, worstError);
+    combinations += testCombinations(true, false, worstError);
+    combinations += testCombinations(false, false, worstError);
+
+    printf("%lu changes checked, furthest %.3f stops off where the tables could make it up\n", combinations, worstError);
+    printf("%lu checks, %lu failed\n", checks, failures);
+
+    return failures == 0 ? 0 : 1;
+}
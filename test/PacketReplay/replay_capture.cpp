@@ -0,0 +1,207 @@
+// Host replay of a PacketRecorder capture through CCUDecodingFunctions::DecodeCCUPacket, the path incoming packets take on the device.
+// Given a capture (e.g. pulled off the device with tools/mpc_capture.py) it decodes every incoming packet and reports the ones the
+// decoder rejects. Without one it replays a capture built here from known packets and checks what the camera ends up with.
+//   replay_capture [capture.mpc]
+#include "BMDControlSystem.h"
+#include "CCU/CCUDecodingFunctions.h"
+#include "CCU/CCUEncodingFunctions.h"
+#include <stdio.h>
+#include <vector>
+
+std::shared_ptr<BMDControlSystem> BMDControlSystem::instance = nullptr; // Required for Singleton pattern and the constructor for BMDControlSystem
+HostSerial Serial;
+
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+
+// Capture format, see src/Camera/PacketRecorder.h
+static const char kFileMagic[4] = { 'M', 'P', 'C', 'R' };
+static const byte kFileHeaderSize = 8;
+static const byte kRecordHeaderSize = 10;
+static const byte kRecordHeaderSizeVersion1 = 6;
+static const byte kMaxRecordLength = 64;
+static const byte kIncomingCameraControl = 0;
+static const byte kOutgoingCameraControl = 1;
+static const byte kTimecode = 2;
+static const byte kRecordTypeCount = 4;
+
+static unsigned long checks = 0;
+static unsigned long failures = 0;
+
+#define CHECK(condition, ...) \
+    do \
+    { \
+        checks++; \
+        if(!(condition)) \
+        { \
+            failures++; \
+            printf("FAILED %s:%i: %s, ", __FILE__, __LINE__, #condition); \
+            printf(__VA_ARGS__); \
+            printf("\n"); \
+        } \
+    } while(0)
+
+struct ReplayResult
+{
+    bool valid = false;             // False if the capture isn't one or is cut short
+    unsigned long records = 0;
+    unsigned long decoded = 0;      // Incoming camera control packets given to the decoder
+    unsigned long rejected = 0;     // ... that it threw on
+};
+
+static ReplayResult replay(const std::vector<uint8_t>& capture)
+{
+    ReplayResult result;
+
+    if(capture.size() < kFileHeaderSize || memcmp(capture.data(), kFileMagic, sizeof(kFileMagic)) != 0)
+    {
+        printf("Not a capture file\n");
+        return result;
+    }
+
+    byte version = capture[4];
+    if(version != 1 && version != 2)
+    {
+        printf("Capture version %u not supported\n", version);
+        return result;
+    }
+
+    // Timestamps aren't needed, the packets are decoded back to back
+    size_t headerSize = version == 1 ? kRecordHeaderSizeVersion1 : kRecordHeaderSize;
+    size_t offset = kFileHeaderSize;
+    while(offset < capture.size())
+    {
+        if(offset + headerSize > capture.size())
+        {
+            printf("Record %lu header truncated\n", result.records + 1);
+            return result;
+        }
+
+        byte type = capture[offset + headerSize - 2];
+        byte length = capture[offset + headerSize - 1];
+        offset += headerSize;
+
+        if(type >= kRecordTypeCount || length > kMaxRecordLength || offset + length > capture.size())
+        {
+            printf("Record %lu has type %u and length %u, the capture is corrupt from here\n", result.records + 1, type, length);
+            return result;
+        }
+
+        std::vector<byte> packet(capture.begin() + offset, capture.begin() + offset + length);
+        offset += length;
+        result.records++;
+
+        if(type != kIncomingCameraControl)
+            continue;
+
+        result.decoded++;
+
+        try
+        {
+            CCUDecodingFunctions::DecodeCCUPacket(packet);
+        }
+        catch(const std::exception& exception)
+        {
+            result.rejected++;
+            printf("Record %lu rejected: %s\n", result.records, exception.what());
+        }
+        catch(...)
+        {
+            result.rejected++;
+            printf("Record %lu rejected\n", result.records);
+        }
+    }
+
+    result.valid = true;
+    return result;
+}
+
+static void addRecord(std::vector<uint8_t>& capture, byte type, const std::vector<byte>& data)
+{
+    uint64_t timestamp = capture.size() * 100; // Any increasing value
+    for(byte index = 0; index < 8; index++)
+        capture.push_back(static_cast<uint8_t>(timestamp >> (index * 8)));
+
+    capture.push_back(type);
+    capture.push_back(static_cast<uint8_t>(data.size()));
+    capture.insert(capture.end(), data.begin(), data.end());
+}
+
+static std::vector<uint8_t> buildCapture()
+{
+    std::vector<uint8_t> capture = { 'M', 'P', 'C', 'R', 2, 0, 0, 0 };
+
+    // The camera reports its settings in the same packets we send to change them. White balance is written out as the camera sends
+    // it, CreateVideoWhiteBalanceCommand passes the array's size in bytes as its count so its payload is twice as long.
+    CCUPacketTypes::Command whiteBalance(CCUPacketTypes::kBroadcastTarget, CCUPacketTypes::CommandID::ChangeConfiguration, CCUPacketTypes::Category::Video,
+        static_cast<byte>(CCUPacketTypes::VideoParameter::ManualWB), CCUPacketTypes::OperationType::AssignValue,
+        static_cast<byte>(CCUPacketTypes::DataTypes::kInt16), { 0xE0, 0x15, 0x0A, 0x00 }); // 5600K, tint 10
+    addRecord(capture, kIncomingCameraControl, whiteBalance.serialize());
+    addRecord(capture, kIncomingCameraControl, CCUEncodingFunctions::CreateVideoISOCommand(800).serialize());
+    addRecord(capture, kOutgoingCameraControl, CCUEncodingFunctions::CreateVideoISOCommand(1600).serialize());
+    addRecord(capture, kIncomingCameraControl, CCUEncodingFunctions::CreateShutterAngleCommand(18000).serialize());
+    addRecord(capture, kTimecode, std::vector<byte>(12, 0));
+
+    return capture;
+}
+
+static void testBuiltInCapture()
+{
+    std::vector<uint8_t> capture = buildCapture();
+    ReplayResult result = replay(capture);
+
+    CHECK(result.valid, "built in capture");
+    CHECK(result.records == 5, "%lu records", result.records);
+    CHECK(result.decoded == 3, "%lu decoded", result.decoded);
+    CHECK(result.rejected == 0, "%lu rejected", result.rejected);
+
+    std::shared_ptr<BMDCamera> camera = BMDControlSystem::getInstance()->getCamera();
+    CHECK(camera->hasWhiteBalance() && camera->getWhiteBalance() == 5600, "white balance");
+    CHECK(camera->hasTint() && camera->getTint() == 10, "tint");
+    CHECK(camera->getSensorGainISOValue() == 800, "ISO %i, the outgoing 1600 must not be decoded", camera->getSensorGainISOValue());
+    CHECK(camera->getShutterAngle() == 18000, "shutter angle %i", camera->getShutterAngle());
+
+    // Cut off part way through the last record
+    capture.resize(capture.size() - 3);
+    CHECK(!replay(capture).valid, "truncated capture");
+
+    std::vector<uint8_t> notCapture = { 'M', 'P', 'C', 'A', 2, 0, 0, 0 };
+    CHECK(!replay(notCapture).valid, "wrong magic");
+}
+
+static bool replayFile(const char* path)
+{
+    FILE* file = fopen(path, "rb");
+    if(file == nullptr)
+    {
+        printf("Can't open %s\n", path);
+        return false;
+    }
+
+    std::vector<uint8_t> capture;
+    uint8_t buffer[4096];
+    size_t read;
+    while((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        capture.insert(capture.end(), buffer, buffer + read);
+
+    fclose(file);
+
+    ReplayResult result = replay(capture);
+    printf("%s: %lu records, %lu incoming packets decoded, %lu rejected\n", path, result.records, result.decoded, result.rejected);
+
+    return result.valid && result.rejected == 0;
+}
+
+int main(int argc, char** argv)
+{
+    // The decoder writes into the active camera
+    BMDControlSystem::getInstance()->activateCamera();
+
+    if(argc > 1)
+        return replayFile(argv[1]) ? 0 : 1;
+
+    testBuiltInCapture();
+
+    printf("%lu checks, %lu failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
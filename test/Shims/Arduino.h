@@ -0,0 +1,74 @@
+// The small part of the Arduino core the CCU decoding uses, so it can be built on the host (see test/PacketReplay)
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+
+// The ESP32 core pulls these in with Arduino.h, so the sources don't include them themselves
+#include <vector>
+#include <array>
+#include <stdexcept>
+
+typedef uint8_t byte;
+
+unsigned long millis();
+unsigned long micros();
+
+class String
+{
+    public:
+        String() {}
+        String(const char* text) : value(text != nullptr ? text : "") {}
+        String(const std::string& text) : value(text) {}
+        explicit String(int number) : value(std::to_string(number)) {}
+        explicit String(unsigned int number) : value(std::to_string(number)) {}
+        explicit String(long number) : value(std::to_string(number)) {}
+        explicit String(unsigned long number) : value(std::to_string(number)) {}
+        explicit String(float number) : value(std::to_string(number)) {}
+        explicit String(double number) : value(std::to_string(number)) {}
+
+        const char* c_str() const { return value.c_str(); }
+        unsigned int length() const { return value.size(); }
+        String substring(unsigned int from) const { return from < value.size() ? value.substr(from) : std::string(); }
+        String substring(unsigned int from, unsigned int to) const { return from < to && from < value.size() ? value.substr(from, to - from) : std::string(); }
+
+        bool concat(const String& other) { value += other.value; return true; }
+        String& operator+=(const String& other) { value += other.value; return *this; }
+        bool operator==(const String& other) const { return value == other.value; }
+
+        friend String operator+(const String& left, const String& right) { return left.value + right.value; }
+        friend String operator+(const char* left, const String& right) { return left + right.value; }
+        friend String operator+(const String& left, const char* right) { return left.value + right; }
+
+    private:
+        std::string value;
+};
+
+// Serial output goes to stdout
+class HostSerial
+{
+    public:
+        void print(const char* text) { fputs(text, stdout); }
+        void print(const String& text) { fputs(text.c_str(), stdout); }
+        void print(const std::string& text) { fputs(text.c_str(), stdout); }
+        void print(char value) { putchar(value); }
+        void print(int value) { printf("%d", value); }
+        void print(unsigned int value) { printf("%u", value); }
+        void print(long value) { printf("%ld", value); }
+        void print(unsigned long value) { printf("%lu", value); }
+        void print(double value) { printf("%.2f", value); }
+
+        template<typename T>
+        void println(const T& value) { print(value); putchar('\n'); }
+        void println() { putchar('\n'); }
+};
+
+extern HostSerial Serial;
+
+#endif
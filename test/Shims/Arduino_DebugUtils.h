@@ -0,0 +1,13 @@
+// Debug output on the host, errors and warnings go to stderr and the rest is dropped
+#ifndef ARDUINO_DEBUGUTILS_H
+#define ARDUINO_DEBUGUTILS_H
+
+#include <stdio.h>
+
+#define DEBUG_ERROR(...) do { fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); } while(0)
+#define DEBUG_WARNING(...) do { fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); } while(0)
+#define DEBUG_INFO(...) do { } while(0)
+#define DEBUG_DEBUG(...) do { } while(0)
+#define DEBUG_VERBOSE(...) do { } while(0)
+
+#endif
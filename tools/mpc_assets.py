@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Magic Pocket Control asset partition builder.
+
+Packs images into the container read by AssetStore (src/Images/AssetStore.h), to be written to the "assets" flash partition.
+Assets can then be changed by writing the partition again, without rebuilding the firmware.
+
+  build  Pack RGB565 image headers (.h) or PNGs into a container, named by their file name (e.g. WBBright)
+  list   Show what's in a container
+  flash  Write a container to the assets partition of a connected device (needs esptool.py)
+
+Examples:
+  python3 tools/mpc_assets.py build assets.bin src/Images/MPCSplash.h src/Images/ImageBluetooth.h src/Images/WB*.h
+  python3 tools/mpc_assets.py list assets.bin
+  python3 tools/mpc_assets.py flash assets.bin --partitions src/Boards/LilyGo-T-Display-S3/partitions_assets.csv --port /dev/ttyACM0
+"""
+
+import argparse
+import os
+import struct
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from mpc_image import read_image  # noqa: E402
+
+MAGIC = b"MPCA"
+VERSION = 1
+HEADER_SIZE = 16
+ENTRY_SIZE = 40
+NAME_LENGTH = 24
+MAX_ASSETS = 32
+
+FORMAT_RGB565_SWAPPED = 0
+FORMAT_RAW = 1
+FORMAT_NAMES = {FORMAT_RGB565_SWAPPED: "RGB565", FORMAT_RAW: "Raw"}
+
+
+def align(value, boundary=4):
+    return (value + boundary - 1) // boundary * boundary
+
+
+def build(args):
+    if len(args.images) > MAX_ASSETS:
+        sys.exit(f"At most {MAX_ASSETS} assets fit in the container")
+
+    assets = []
+    for path in args.images:
+        _, width, height, pixels = read_image(path)
+        name = os.path.splitext(os.path.basename(path))[0]
+        if len(name) >= NAME_LENGTH:
+            sys.exit(f"{name} is too long for an asset name ({NAME_LENGTH - 1} characters at most)")
+
+        # Stored in the display's byte order so they can be pushed without swapping
+        data = b"".join(pixel.to_bytes(2, "big") for pixel in pixels)
+        assets.append((name, FORMAT_RGB565_SWAPPED, width, height, data))
+
+    offset = align(HEADER_SIZE + ENTRY_SIZE * len(assets))
+    entries = bytearray()
+    body = bytearray()
+    for name, asset_format, width, height, data in assets:
+        # 4 byte aligned so it can be read (and DMAed) straight from mapped flash
+        padding = align(offset + len(body)) - (offset + len(body))
+        body += bytes(padding)
+        entries += struct.pack("<24sBBHHHII", name.encode(), asset_format, 0, width, height, 0, offset + len(body), len(data))
+        body += data
+
+    total = offset + len(body)
+    container = struct.pack("<4sBBHII", MAGIC, VERSION, 0, len(assets), 0, total) + entries
+    container += bytes(offset - len(container)) + body
+
+    with open(args.output, "wb") as f:
+        f.write(container)
+
+    print(f"{args.output}: {len(assets)} assets, {total} bytes")
+
+
+def read_container(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    magic, version, _, count, _, total = struct.unpack_from("<4sBBHII", data)
+    if magic != MAGIC or version != VERSION:
+        sys.exit(f"{path} is not an asset container")
+
+    assets = []
+    for index in range(count):
+        name, asset_format, _, width, height, _, offset, size = struct.unpack_from("<24sBBHHHII", data, HEADER_SIZE + index * ENTRY_SIZE)
+        assets.append((name.rstrip(b"\0").decode(), asset_format, width, height, offset, size))
+
+    return total, assets
+
+
+def list_assets(args):
+    total, assets = read_container(args.container)
+
+    print(f"{'Asset':<24} {'Format':>7} {'Size':>9} {'Offset':>8} {'Bytes':>8}")
+    for name, asset_format, width, height, offset, size in assets:
+        print(f"{name:<24} {FORMAT_NAMES.get(asset_format, '?'):>7} {f'{width}x{height}':>9} {offset:>8} {size:>8}")
+    print(f"{len(assets)} assets, {total} bytes")
+
+
+def parse_size(text):
+    text = text.strip()
+    if text.upper().endswith("K"):
+        return int(text[:-1], 0) * 1024
+    if text.upper().endswith("M"):
+        return int(text[:-1], 0) * 1024 * 1024
+    return int(text, 0)
+
+
+def partition_offset(partitions, label):
+    """Works out where a partition starts, following the same rules as gen_esp32part.py for partitions without an offset."""
+    offset = 0x9000
+    with open(partitions) as f:
+        for line in f:
+            line = line.split("#")[0].strip()
+            if not line:
+                continue
+
+            fields = [field.strip() for field in line.split(",")]
+            name, partition_type = fields[0], fields[1]
+            if fields[3]:
+                offset = parse_size(fields[3])
+            else:
+                offset = align(offset, 0x10000 if partition_type == "app" else 0x1000)
+
+            size = parse_size(fields[4])
+            if name == label:
+                return offset, size
+            offset += size
+
+    sys.exit(f"No {label} partition in {partitions}")
+
+
+def flash(args):
+    offset, size = partition_offset(args.partitions, args.label)
+    container_size = os.path.getsize(args.container)
+    if container_size > size:
+        sys.exit(f"{args.container} is {container_size} bytes, the {args.label} partition is {size}")
+
+    command = ["esptool.py", "--chip", args.chip]
+    if args.port:
+        command += ["--port", args.port]
+    command += ["write_flash", hex(offset), args.container]
+
+    print(" ".join(command))
+    sys.exit(subprocess.call(command))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Magic Pocket Control asset partition builder")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    build_parser = commands.add_parser("build", help="Pack images into an asset container")
+    build_parser.add_argument("output", help="Container to write, e.g. assets.bin")
+    build_parser.add_argument("images", nargs="+", help="RGB565 image headers (.h) or PNGs")
+    build_parser.set_defaults(function=build)
+
+    list_parser = commands.add_parser("list", help="Show what's in an asset container")
+    list_parser.add_argument("container")
+    list_parser.set_defaults(function=list_assets)
+
+    flash_parser = commands.add_parser("flash", help="Write an asset container to a device")
+    flash_parser.add_argument("container")
+    flash_parser.add_argument("--partitions", required=True, help="The board's partition table (.csv)")
+    flash_parser.add_argument("--label", default="assets", help="Partition to write (default assets)")
+    flash_parser.add_argument("--port", help="Serial port, esptool.py finds it if not given")
+    flash_parser.add_argument("--chip", default="esp32s3")
+    flash_parser.set_defaults(function=flash)
+
+    args = parser.parse_args()
+    args.function(args)
+
+
+if __name__ == "__main__":
+    main()
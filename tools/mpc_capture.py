@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""Magic Pocket Control packet capture tool.
+
+Works with the captures recorded by PacketRecorder (src/Camera/PacketRecorder.h).
+
+  pull   Extract a capture from a serial log (the device dumps it between MPCR-BEGIN and MPCR-END when replaying)
+  dump   Print every record with its time, type and decoded CCU header
+  stats  Summarise packet counts, rates and the largest gaps and bursts
+
+To decode a capture through the firmware's CCU decoding on the computer, build the host tests and run
+test/build/replay_capture capture.mpc (see test/PacketReplay).
+
+Examples:
+  python3 tools/mpc_capture.py pull monitor.log capture.mpc
+  python3 tools/mpc_capture.py dump capture.mpc
+  python3 tools/mpc_capture.py stats capture.mpc
+"""
+
+import argparse
+import string
+import struct
+import sys
+from collections import Counter
+
+MAGIC = b"MPCR"
+VERSION = 2
+FILE_HEADER_SIZE = 8
+RECORD_HEADERS = {1: "<IBB", 2: "<QBB"}  # Version 1's micros() timestamp wraps every ~71 minutes, version 2's doesn't
+
+RECORD_TYPES = {0: "IncomingControl", 1: "OutgoingControl", 2: "Timecode", 3: "CameraStatus"}
+MAX_RECORD_LENGTH = 64
+
+CATEGORIES = ["Lens", "Video", "Audio", "Output", "Display", "Tally", "Reference", "Configuration",
+              "ColorCorrection", "Status", "Media", "ExternalDeviceControl", "Metadata"]
+
+
+def read_capture(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < FILE_HEADER_SIZE or data[:4] != MAGIC:
+        sys.exit(f"{path} is not a capture file")
+    version = data[4]
+    if version not in RECORD_HEADERS:
+        sys.exit(f"Capture version {version} not supported")
+    record_header = RECORD_HEADERS[version]
+    record_header_size = struct.calcsize(record_header)
+
+    records = []
+    offset = FILE_HEADER_SIZE
+    first = None
+    elapsed = 0
+    previous = None
+    while offset + record_header_size <= len(data):
+        timestamp, record_type, length = struct.unpack_from(record_header, data, offset)
+        offset += record_header_size
+        if record_type not in RECORD_TYPES or length > MAX_RECORD_LENGTH:
+            print(f"Warning: record {len(records) + 1} has type {record_type} and length {length}, "
+                  "the capture is corrupt from here", file=sys.stderr)
+            break
+        payload = data[offset:offset + length]
+        offset += length
+        if len(payload) != length:
+            print("Warning: capture truncated", file=sys.stderr)
+            break
+
+        if first is None:
+            first = timestamp
+        elif version == 1:
+            elapsed += (timestamp - previous) & 0xFFFFFFFF
+        else:
+            elapsed = timestamp - first
+        previous = timestamp
+
+        records.append((elapsed, record_type, payload))
+
+    return records
+
+
+def describe(record_type, payload):
+    if record_type in (0, 1) and len(payload) >= 8:
+        category = payload[4]
+        name = CATEGORIES[category] if category < len(CATEGORIES) else f"Category{category}"
+        return f"dest={payload[0]} {name}.{payload[5]} type={payload[6]} op={payload[7]}"
+    if record_type == 2 and len(payload) == 12:
+        # BCD values in the last four bytes, frames first, top bits of the hours are flags (e.g. drop frame)
+        frames, seconds, minutes, hours = payload[8:12]
+        return f"{hours & 0x3F:02x}:{minutes:02x}:{seconds:02x}:{frames:02x}"
+    if record_type == 3 and len(payload) >= 1:
+        return f"flags=0x{payload[0]:02x}"
+    return ""
+
+
+def is_hex_line(line):
+    return len(line) > 0 and len(line) % 2 == 0 and all(c in string.hexdigits for c in line)
+
+
+def command_pull(args):
+    with open(args.log, "r", errors="replace") as f:
+        lines = f.read().splitlines()
+
+    capture = None
+    expected = None
+    skipped = 0
+    for number, line in enumerate(lines, 1):
+        # Debug output can have a timestamp in front of the markers
+        if "MPCR-BEGIN" in line:
+            # MPCR-BEGIN <path> <size in bytes>, see PacketRecorder::dump
+            fields = line[line.index("MPCR-BEGIN"):].split()
+            expected = int(fields[2]) if len(fields) >= 3 and fields[2].isdigit() else None
+            capture = bytearray()
+            skipped = 0
+        elif "MPCR-END" in line and capture is not None:
+            break
+        elif capture is not None:
+            # Other output (e.g. debug messages from another task) can end up between the markers
+            data = line.strip()
+            if not is_hex_line(data):
+                print(f"Warning: skipped line {number}, it isn't hex: {data[:60]!r}", file=sys.stderr)
+                skipped += 1
+                continue
+            capture += bytes.fromhex(data)
+
+    if not capture:
+        sys.exit("No capture found in the log")
+
+    if expected is None:
+        print("Warning: MPCR-BEGIN has no size, the length can't be checked", file=sys.stderr)
+    elif len(capture) != expected:
+        sys.exit(f"Capture is {len(capture)} bytes but the device sent {expected}"
+                 + (f" ({skipped} lines skipped)" if skipped else "") + ", not written")
+
+    with open(args.output, "wb") as f:
+        f.write(capture)
+    print(f"Wrote {len(capture)} bytes to {args.output}")
+
+
+def command_dump(args):
+    for elapsed, record_type, payload in read_capture(args.capture):
+        print(f"{elapsed / 1000:12.3f}ms {RECORD_TYPES.get(record_type, record_type):>15} {len(payload):3} "
+              f"{describe(record_type, payload):40} {payload.hex(' ')}")
+
+
+def command_stats(args):
+    records = read_capture(args.capture)
+    if not records:
+        sys.exit("Capture is empty")
+
+    duration = max(records[-1][0], 1)
+    print(f"{len(records)} records over {duration / 1000000:.2f}s")
+
+    counts = Counter(record_type for _, record_type, _ in records)
+    for record_type, count in sorted(counts.items()):
+        print(f"  {RECORD_TYPES.get(record_type, record_type):>15}: {count:6} ({count * 1000000 / duration:.1f}/s)")
+
+    categories = Counter(CATEGORIES[p[4]] if p[4] < len(CATEGORIES) else p[4]
+                         for _, t, p in records if t == 0 and len(p) >= 8)
+    if categories:
+        print("  Incoming by category: " + ", ".join(f"{name} {count}" for name, count in categories.most_common()))
+
+    incoming = [elapsed for elapsed, record_type, _ in records if record_type != 1]
+    gaps = sorted((b - a, a) for a, b in zip(incoming, incoming[1:]))
+    if gaps:
+        print("  Largest gaps between incoming packets:")
+        for gap, at in reversed(gaps[-args.top:]):
+            print(f"    {gap / 1000:10.1f}ms at {at / 1000:.1f}ms")
+
+    # Packets arriving within the same window, e.g. a lens change sending its metadata
+    window = args.burst_window * 1000
+    best, start = 0, 0
+    for end in range(len(incoming)):
+        while incoming[end] - incoming[start] > window:
+            start += 1
+        best = max(best, end - start + 1)
+    print(f"  Largest burst: {best} incoming packets within {args.burst_window}ms")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    pull = commands.add_parser("pull", help="Extract a capture from a serial log")
+    pull.add_argument("log")
+    pull.add_argument("output")
+    pull.set_defaults(func=command_pull)
+
+    dump = commands.add_parser("dump", help="Print every record")
+    dump.add_argument("capture")
+    dump.set_defaults(func=command_dump)
+
+    stats = commands.add_parser("stats", help="Summarise a capture")
+    stats.add_argument("capture")
+    stats.add_argument("--top", type=int, default=5, help="Number of gaps to show")
+    stats.add_argument("--burst-window", type=int, default=20, help="Burst window in milliseconds")
+    stats.set_defaults(func=command_stats)
+
+    args = parser.parse_args()
+    args.func(args)
+
+
+if __name__ == "__main__":
+    main()
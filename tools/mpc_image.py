@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+"""Magic Pocket Control image compressor.
+
+Converts the RGB565 image headers from the online converter (or a PNG, if Pillow is installed) into the compressed
+format decoded by CompressedImage (src/Images/CompressedImage.h), and reports how much flash it saves.
+
+  convert  Write a compressed header (src/Images/<name>-Compressed.h) from an RGB565 header or PNG
+  stats    Show the raw and compressed size of each image without writing anything
+
+Examples:
+  python3 tools/mpc_image.py convert src/Images/MPCSplash-M5StickC-Plus.h
+  python3 tools/mpc_image.py stats src/Images/*.h
+
+Format (little endian), QOI-style operations on RGB565 pixels, top to bottom, left to right:
+  Header:  "MPCI" (4 bytes), width (uint16), height (uint16)
+  00iiiiii            Index: colour from the 64 entry table of recently seen colours
+  01rrggbb            Diff: red, green and blue each changed by -2..1 from the previous pixel
+  10gggggg drdg dbdg  Luma: green changed by -32..31, red and blue by -8..7 more than green did (2 bytes)
+  11nnnnnn            Run: previous pixel repeated n + 1 times (1..62)
+  11111110 lo hi      Colour: RGB565 value (3 bytes)
+"""
+
+import argparse
+import os
+import re
+import sys
+
+MAGIC = b"MPCI"
+HEADER_SIZE = 8
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_COLOUR = 0xFE
+MAX_RUN = 62
+
+
+def colour_hash(colour):
+    red, green, blue = colour >> 11, (colour >> 5) & 0x3F, colour & 0x1F
+    return (red * 3 + green * 5 + blue * 7) % 64
+
+
+def read_header_image(path):
+    with open(path) as f:
+        text = f.read()
+
+    size = re.search(r"Image Size\s*:\s*(\d+)x(\d+)", text)
+    name = re.search(r"unsigned short\s+(\w+)\s*\[", text)
+    body = re.search(r"PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    if size is None or name is None or body is None:
+        sys.exit(f"{path} doesn't look like an RGB565 image header")
+
+    width, height = int(size.group(1)), int(size.group(2))
+
+    # Strip the pixel count comments at the end of each line before reading the values
+    values = re.sub(r"//[^\n]*", "", body.group(1))
+    pixels = [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]+", values)]
+    if len(pixels) < width * height:
+        # Some headers are a few pixels short, repeat the last one like the converter's "divisible by 8" trick does
+        print(f"Warning: {path} has {len(pixels)} pixels, expected {width * height}, padding with the last pixel", file=sys.stderr)
+        pixels += [pixels[-1]] * (width * height - len(pixels))
+
+    # The converter pads some arrays, only the image's pixels are kept
+    return name.group(1), width, height, pixels[:width * height]
+
+
+def read_png_image(path):
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit("Converting PNGs needs Pillow (pip install pillow), or convert the RGB565 header instead")
+
+    image = Image.open(path).convert("RGB")
+    pixels = [((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3) for r, g, b in image.getdata()]
+    name = re.sub(r"\W", "_", os.path.splitext(os.path.basename(path))[0])
+    return name, image.width, image.height, pixels
+
+
+def read_image(path):
+    if path.lower().endswith(".png"):
+        return read_png_image(path)
+    return read_header_image(path)
+
+
+def compress(width, height, pixels):
+    out = bytearray(MAGIC)
+    out += width.to_bytes(2, "little") + height.to_bytes(2, "little")
+
+    index = [0] * 64
+    previous = 0
+    run = 0
+
+    for colour in pixels:
+        if colour == previous:
+            run += 1
+            if run == MAX_RUN:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+
+        if run > 0:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        position = colour_hash(colour)
+        if index[position] == colour:
+            out.append(OP_INDEX | position)
+        else:
+            index[position] = colour
+
+            red_diff = (colour >> 11) - (previous >> 11)
+            green_diff = ((colour >> 5) & 0x3F) - ((previous >> 5) & 0x3F)
+            blue_diff = (colour & 0x1F) - (previous & 0x1F)
+
+            if -2 <= red_diff <= 1 and -2 <= green_diff <= 1 and -2 <= blue_diff <= 1:
+                out.append(OP_DIFF | (red_diff + 2) << 4 | (green_diff + 2) << 2 | (blue_diff + 2))
+            elif -32 <= green_diff <= 31 and -8 <= red_diff - green_diff <= 7 and -8 <= blue_diff - green_diff <= 7:
+                out.append(OP_LUMA | (green_diff + 32))
+                out.append((red_diff - green_diff + 8) << 4 | (blue_diff - green_diff + 8))
+            else:
+                out.append(OP_COLOUR)
+                out += colour.to_bytes(2, "little")
+
+        previous = colour
+
+    if run > 0:
+        out.append(OP_RUN | (run - 1))
+
+    return bytes(out)
+
+
+def decompress(data):
+    """Reference decoder, used to check every conversion round trips."""
+    if data[:4] != MAGIC:
+        raise ValueError("Not a compressed image")
+
+    width = int.from_bytes(data[4:6], "little")
+    height = int.from_bytes(data[6:8], "little")
+
+    pixels = []
+    index = [0] * 64
+    previous = 0
+    position = HEADER_SIZE
+
+    while len(pixels) < width * height:
+        op = data[position]
+        position += 1
+
+        if op == OP_COLOUR:
+            colour = int.from_bytes(data[position:position + 2], "little")
+            position += 2
+        elif op & 0xC0 == OP_RUN:
+            pixels += [previous] * ((op & 0x3F) + 1)
+            continue
+        elif op & 0xC0 == OP_INDEX:
+            colour = index[op & 0x3F]
+        elif op & 0xC0 == OP_DIFF:
+            red = (previous >> 11) + ((op >> 4) & 0x03) - 2
+            green = ((previous >> 5) & 0x3F) + ((op >> 2) & 0x03) - 2
+            blue = (previous & 0x1F) + (op & 0x03) - 2
+            colour = (red & 0x1F) << 11 | (green & 0x3F) << 5 | (blue & 0x1F)
+        else:
+            green_diff = (op & 0x3F) - 32
+            second = data[position]
+            position += 1
+            red = (previous >> 11) + green_diff + (second >> 4) - 8
+            green = ((previous >> 5) & 0x3F) + green_diff
+            blue = (previous & 0x1F) + green_diff + (second & 0x0F) - 8
+            colour = (red & 0x1F) << 11 | (green & 0x3F) << 5 | (blue & 0x1F)
+
+        if op & 0xC0 != OP_INDEX or op == OP_COLOUR:
+            index[colour_hash(colour)] = colour
+
+        pixels.append(colour)
+        previous = colour
+
+    return width, height, pixels[:width * height]
+
+
+def write_header(path, source, name, width, height, data):
+    with open(path, "w") as f:
+        f.write(f"// Compressed with tools/mpc_image.py from {os.path.basename(source)}, decode with CompressedImage\n")
+        f.write(f"// Image Size     : {width}x{height} pixels\n")
+        f.write(f"// Memory usage   : {len(data)} bytes (raw RGB565 is {width * height * 2} bytes)\n\n")
+        f.write("#include <Arduino.h>\n\n")
+        f.write(f"const uint8_t {name}[{len(data)}] PROGMEM = {{\n")
+        for offset in range(0, len(data), 24):
+            f.write(", ".join(f"0x{value:02X}" for value in data[offset:offset + 24]) + ",\n")
+        f.write("};\n")
+
+
+def convert_one(path, output, name):
+    source_name, width, height, pixels = read_image(path)
+    data = compress(width, height, pixels)
+
+    if decompress(data) != (width, height, pixels):
+        sys.exit(f"{path}: compressed image doesn't decode to the original, not written")
+
+    name = name or source_name + "_Compressed"
+    output = output or os.path.splitext(path)[0] + "-Compressed.h"
+    write_header(output, path, name, width, height, data)
+
+    raw = width * height * 2
+    print(f"{output}: {name} {width}x{height}, {raw} -> {len(data)} bytes ({100 * len(data) / raw:.1f}%), {raw - len(data)} bytes of flash saved")
+
+
+def convert(args):
+    if (args.output or args.name) and len(args.images) > 1:
+        sys.exit("--output and --name only work with one image")
+
+    for path in args.images:
+        convert_one(path, args.output, args.name)
+
+
+def stats(args):
+    total_raw = 0
+    total_compressed = 0
+
+    print(f"{'Image':<40} {'Size':>9} {'Raw':>8} {'Compressed':>11} {'Ratio':>7}")
+    for path in args.images:
+        _, width, height, pixels = read_image(path)
+        data = compress(width, height, pixels)
+        raw = width * height * 2
+        total_raw += raw
+        total_compressed += len(data)
+        print(f"{os.path.basename(path):<40} {f'{width}x{height}':>9} {raw:>8} {len(data):>11} {100 * len(data) / raw:>6.1f}%")
+
+    if total_raw > 0:
+        print(f"{'Total':<40} {'':>9} {total_raw:>8} {total_compressed:>11} {100 * total_compressed / total_raw:>6.1f}%")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Magic Pocket Control image compressor")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    convert_parser = commands.add_parser("convert", help="Write compressed image headers")
+    convert_parser.add_argument("images", nargs="+", help="RGB565 image headers (.h) or PNGs")
+    convert_parser.add_argument("--output", help="Header to write (default <image>-Compressed.h)")
+    convert_parser.add_argument("--name", help="Array name (default <source array>_Compressed)")
+    convert_parser.set_defaults(function=convert)
+
+    stats_parser = commands.add_parser("stats", help="Show how well images compress")
+    stats_parser.add_argument("images", nargs="+", help="RGB565 image headers (.h) or PNGs")
+    stats_parser.set_defaults(function=stats)
+
+    args = parser.parse_args()
+    args.function(args)
+
+
+if __name__ == "__main__":
+    main()